@@ -30,16 +30,31 @@ static const char* UESynthService_method_names[] = {
   "/uesynth.UESynthService/CaptureSegmentationMask",
   "/uesynth.UESynthService/SetObjectTransform",
   "/uesynth.UESynthService/GetObjectTransform",
+  "/uesynth.UESynthService/SetObjectTransformsBatch",
+  "/uesynth.UESynthService/GetObjectTransformsBatch",
   "/uesynth.UESynthService/CreateCamera",
   "/uesynth.UESynthService/DestroyCamera",
   "/uesynth.UESynthService/SetResolution",
   "/uesynth.UESynthService/CaptureNormals",
   "/uesynth.UESynthService/CaptureOpticalFlow",
+  "/uesynth.UESynthService/CaptureMulti",
+  "/uesynth.UESynthService/Step",
+  "/uesynth.UESynthService/SetLockstep",
   "/uesynth.UESynthService/SpawnObject",
+  "/uesynth.UESynthService/PreloadAssets",
   "/uesynth.UESynthService/DestroyObject",
+  "/uesynth.UESynthService/ConfigureActorPool",
   "/uesynth.UESynthService/SetMaterial",
+  "/uesynth.UESynthService/SetMaterialsBatch",
+  "/uesynth.UESynthService/ResolveMaterialParameters",
   "/uesynth.UESynthService/ListObjects",
+  "/uesynth.UESynthService/GetSceneSnapshot",
   "/uesynth.UESynthService/SetLighting",
+  "/uesynth.UESynthService/SetLightingBatch",
+  "/uesynth.UESynthService/StartRecording",
+  "/uesynth.UESynthService/StopRecording",
+  "/uesynth.UESynthService/GetServerStats",
+  "/uesynth.UESynthService/GetHealth",
 };
 
 std::unique_ptr< UESynthService::Stub> UESynthService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -57,16 +72,31 @@ UESynthService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& cha
   , rpcmethod_CaptureSegmentationMask_(UESynthService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_SetObjectTransform_(UESynthService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetObjectTransform_(UESynthService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_CreateCamera_(UESynthService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_DestroyCamera_(UESynthService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetResolution_(UESynthService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_CaptureNormals_(UESynthService_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_CaptureOpticalFlow_(UESynthService_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SpawnObject_(UESynthService_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_DestroyObject_(UESynthService_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetMaterial_(UESynthService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ListObjects_(UESynthService_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetLighting_(UESynthService_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetObjectTransformsBatch_(UESynthService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetObjectTransformsBatch_(UESynthService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CreateCamera_(UESynthService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_DestroyCamera_(UESynthService_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetResolution_(UESynthService_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CaptureNormals_(UESynthService_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CaptureOpticalFlow_(UESynthService_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CaptureMulti_(UESynthService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Step_(UESynthService_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetLockstep_(UESynthService_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SpawnObject_(UESynthService_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_PreloadAssets_(UESynthService_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_DestroyObject_(UESynthService_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ConfigureActorPool_(UESynthService_method_names[21], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetMaterial_(UESynthService_method_names[22], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetMaterialsBatch_(UESynthService_method_names[23], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ResolveMaterialParameters_(UESynthService_method_names[24], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ListObjects_(UESynthService_method_names[25], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetSceneSnapshot_(UESynthService_method_names[26], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetLighting_(UESynthService_method_names[27], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetLightingBatch_(UESynthService_method_names[28], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_StartRecording_(UESynthService_method_names[29], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_StopRecording_(UESynthService_method_names[30], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetServerStats_(UESynthService_method_names[31], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetHealth_(UESynthService_method_names[32], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::ClientReaderWriter< ::uesynth::ActionRequest, ::uesynth::FrameResponse>* UESynthService::Stub::ControlStreamRaw(::grpc::ClientContext* context) {
@@ -246,6 +276,52 @@ void UESynthService::Stub::async::GetObjectTransform(::grpc::ClientContext* cont
   return result;
 }
 
+::grpc::Status UESynthService::Stub::SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::uesynth::SetObjectTransformsBatchResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::SetObjectTransformsBatchRequest, ::uesynth::SetObjectTransformsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetObjectTransformsBatch_, context, request, response);
+}
+
+void UESynthService::Stub::async::SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::SetObjectTransformsBatchRequest, ::uesynth::SetObjectTransformsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetObjectTransformsBatch_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetObjectTransformsBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::SetObjectTransformsBatchResponse>* UESynthService::Stub::PrepareAsyncSetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::SetObjectTransformsBatchResponse, ::uesynth::SetObjectTransformsBatchRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetObjectTransformsBatch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::SetObjectTransformsBatchResponse>* UESynthService::Stub::AsyncSetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetObjectTransformsBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::uesynth::GetObjectTransformsBatchResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::GetObjectTransformsBatchRequest, ::uesynth::GetObjectTransformsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetObjectTransformsBatch_, context, request, response);
+}
+
+void UESynthService::Stub::async::GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::GetObjectTransformsBatchRequest, ::uesynth::GetObjectTransformsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetObjectTransformsBatch_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetObjectTransformsBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformsBatchResponse>* UESynthService::Stub::PrepareAsyncGetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::GetObjectTransformsBatchResponse, ::uesynth::GetObjectTransformsBatchRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetObjectTransformsBatch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformsBatchResponse>* UESynthService::Stub::AsyncGetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetObjectTransformsBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status UESynthService::Stub::CreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::uesynth::CommandResponse* response) {
   return ::grpc::internal::BlockingUnaryCall< ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_CreateCamera_, context, request, response);
 }
@@ -361,6 +437,75 @@ void UESynthService::Stub::async::CaptureOpticalFlow(::grpc::ClientContext* cont
   return result;
 }
 
+::grpc::Status UESynthService::Stub::CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::uesynth::MultiImageResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::CaptureMultiRequest, ::uesynth::MultiImageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_CaptureMulti_, context, request, response);
+}
+
+void UESynthService::Stub::async::CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::CaptureMultiRequest, ::uesynth::MultiImageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CaptureMulti_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CaptureMulti_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::MultiImageResponse>* UESynthService::Stub::PrepareAsyncCaptureMultiRaw(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::MultiImageResponse, ::uesynth::CaptureMultiRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_CaptureMulti_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::MultiImageResponse>* UESynthService::Stub::AsyncCaptureMultiRaw(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncCaptureMultiRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::Step(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::uesynth::StepResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::StepRequest, ::uesynth::StepResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Step_, context, request, response);
+}
+
+void UESynthService::Stub::async::Step(::grpc::ClientContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::StepRequest, ::uesynth::StepResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Step_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::Step(::grpc::ClientContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Step_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::StepResponse>* UESynthService::Stub::PrepareAsyncStepRaw(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::StepResponse, ::uesynth::StepRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Step_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::StepResponse>* UESynthService::Stub::AsyncStepRaw(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStepRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::uesynth::LockstepState* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::SetLockstepRequest, ::uesynth::LockstepState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetLockstep_, context, request, response);
+}
+
+void UESynthService::Stub::async::SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::SetLockstepRequest, ::uesynth::LockstepState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetLockstep_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetLockstep_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::LockstepState>* UESynthService::Stub::PrepareAsyncSetLockstepRaw(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::LockstepState, ::uesynth::SetLockstepRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetLockstep_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::LockstepState>* UESynthService::Stub::AsyncSetLockstepRaw(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetLockstepRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status UESynthService::Stub::SpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::uesynth::CommandResponse* response) {
   return ::grpc::internal::BlockingUnaryCall< ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SpawnObject_, context, request, response);
 }
@@ -384,6 +529,29 @@ void UESynthService::Stub::async::SpawnObject(::grpc::ClientContext* context, co
   return result;
 }
 
+::grpc::Status UESynthService::Stub::PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::uesynth::PreloadAssetsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::PreloadAssetsRequest, ::uesynth::PreloadAssetsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_PreloadAssets_, context, request, response);
+}
+
+void UESynthService::Stub::async::PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::PreloadAssetsRequest, ::uesynth::PreloadAssetsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PreloadAssets_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PreloadAssets_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::PreloadAssetsResponse>* UESynthService::Stub::PrepareAsyncPreloadAssetsRaw(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::PreloadAssetsResponse, ::uesynth::PreloadAssetsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_PreloadAssets_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::PreloadAssetsResponse>* UESynthService::Stub::AsyncPreloadAssetsRaw(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncPreloadAssetsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status UESynthService::Stub::DestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::uesynth::CommandResponse* response) {
   return ::grpc::internal::BlockingUnaryCall< ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_DestroyObject_, context, request, response);
 }
@@ -407,6 +575,29 @@ void UESynthService::Stub::async::DestroyObject(::grpc::ClientContext* context,
   return result;
 }
 
+::grpc::Status UESynthService::Stub::ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::uesynth::ActorPoolStats* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::ConfigureActorPoolRequest, ::uesynth::ActorPoolStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ConfigureActorPool_, context, request, response);
+}
+
+void UESynthService::Stub::async::ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::ConfigureActorPoolRequest, ::uesynth::ActorPoolStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ConfigureActorPool_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ConfigureActorPool_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::ActorPoolStats>* UESynthService::Stub::PrepareAsyncConfigureActorPoolRaw(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::ActorPoolStats, ::uesynth::ConfigureActorPoolRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ConfigureActorPool_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::ActorPoolStats>* UESynthService::Stub::AsyncConfigureActorPoolRaw(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncConfigureActorPoolRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status UESynthService::Stub::SetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::uesynth::CommandResponse* response) {
   return ::grpc::internal::BlockingUnaryCall< ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetMaterial_, context, request, response);
 }
@@ -430,29 +621,98 @@ void UESynthService::Stub::async::SetMaterial(::grpc::ClientContext* context, co
   return result;
 }
 
-::grpc::Status UESynthService::Stub::ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::uesynth::ListObjectsResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::google::protobuf::Empty, ::uesynth::ListObjectsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ListObjects_, context, request, response);
+::grpc::Status UESynthService::Stub::SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::uesynth::SetMaterialsBatchResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::SetMaterialsBatchRequest, ::uesynth::SetMaterialsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetMaterialsBatch_, context, request, response);
+}
+
+void UESynthService::Stub::async::SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::SetMaterialsBatchRequest, ::uesynth::SetMaterialsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetMaterialsBatch_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetMaterialsBatch_, context, request, response, reactor);
 }
 
-void UESynthService::Stub::async::ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::google::protobuf::Empty, ::uesynth::ListObjectsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListObjects_, context, request, response, std::move(f));
+::grpc::ClientAsyncResponseReader< ::uesynth::SetMaterialsBatchResponse>* UESynthService::Stub::PrepareAsyncSetMaterialsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::SetMaterialsBatchResponse, ::uesynth::SetMaterialsBatchRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetMaterialsBatch_, context, request);
 }
 
-void UESynthService::Stub::async::ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+::grpc::ClientAsyncResponseReader< ::uesynth::SetMaterialsBatchResponse>* UESynthService::Stub::AsyncSetMaterialsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetMaterialsBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::uesynth::MaterialParameterIds* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::ResolveMaterialParametersRequest, ::uesynth::MaterialParameterIds, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ResolveMaterialParameters_, context, request, response);
+}
+
+void UESynthService::Stub::async::ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::ResolveMaterialParametersRequest, ::uesynth::MaterialParameterIds, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ResolveMaterialParameters_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ResolveMaterialParameters_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::MaterialParameterIds>* UESynthService::Stub::PrepareAsyncResolveMaterialParametersRaw(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::MaterialParameterIds, ::uesynth::ResolveMaterialParametersRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ResolveMaterialParameters_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::MaterialParameterIds>* UESynthService::Stub::AsyncResolveMaterialParametersRaw(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncResolveMaterialParametersRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::uesynth::ListObjectsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::ListObjectsRequest, ::uesynth::ListObjectsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ListObjects_, context, request, response);
+}
+
+void UESynthService::Stub::async::ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::ListObjectsRequest, ::uesynth::ListObjectsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListObjects_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
   ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListObjects_, context, request, response, reactor);
 }
 
-::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>* UESynthService::Stub::PrepareAsyncListObjectsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::ListObjectsResponse, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ListObjects_, context, request);
+::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>* UESynthService::Stub::PrepareAsyncListObjectsRaw(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::ListObjectsResponse, ::uesynth::ListObjectsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ListObjects_, context, request);
 }
 
-::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>* UESynthService::Stub::AsyncListObjectsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>* UESynthService::Stub::AsyncListObjectsRaw(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) {
   auto* result =
     this->PrepareAsyncListObjectsRaw(context, request, cq);
   result->StartCall();
   return result;
 }
 
+::grpc::Status UESynthService::Stub::GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::uesynth::SceneSnapshot* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::GetSceneSnapshotRequest, ::uesynth::SceneSnapshot, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetSceneSnapshot_, context, request, response);
+}
+
+void UESynthService::Stub::async::GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::GetSceneSnapshotRequest, ::uesynth::SceneSnapshot, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetSceneSnapshot_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetSceneSnapshot_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::SceneSnapshot>* UESynthService::Stub::PrepareAsyncGetSceneSnapshotRaw(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::SceneSnapshot, ::uesynth::GetSceneSnapshotRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetSceneSnapshot_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::SceneSnapshot>* UESynthService::Stub::AsyncGetSceneSnapshotRaw(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetSceneSnapshotRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status UESynthService::Stub::SetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::uesynth::CommandResponse* response) {
   return ::grpc::internal::BlockingUnaryCall< ::uesynth::SetLightingRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetLighting_, context, request, response);
 }
@@ -476,6 +736,121 @@ void UESynthService::Stub::async::SetLighting(::grpc::ClientContext* context, co
   return result;
 }
 
+::grpc::Status UESynthService::Stub::SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::uesynth::SetLightingBatchResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::SetLightingBatchRequest, ::uesynth::SetLightingBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetLightingBatch_, context, request, response);
+}
+
+void UESynthService::Stub::async::SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::SetLightingBatchRequest, ::uesynth::SetLightingBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetLightingBatch_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetLightingBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::SetLightingBatchResponse>* UESynthService::Stub::PrepareAsyncSetLightingBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::SetLightingBatchResponse, ::uesynth::SetLightingBatchRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetLightingBatch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::SetLightingBatchResponse>* UESynthService::Stub::AsyncSetLightingBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetLightingBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::uesynth::RecordingStats* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::StartRecordingRequest, ::uesynth::RecordingStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_StartRecording_, context, request, response);
+}
+
+void UESynthService::Stub::async::StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::StartRecordingRequest, ::uesynth::RecordingStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StartRecording_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StartRecording_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>* UESynthService::Stub::PrepareAsyncStartRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::RecordingStats, ::uesynth::StartRecordingRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_StartRecording_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>* UESynthService::Stub::AsyncStartRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStartRecordingRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::uesynth::RecordingStats* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::StopRecordingRequest, ::uesynth::RecordingStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_StopRecording_, context, request, response);
+}
+
+void UESynthService::Stub::async::StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::StopRecordingRequest, ::uesynth::RecordingStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StopRecording_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StopRecording_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>* UESynthService::Stub::PrepareAsyncStopRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::RecordingStats, ::uesynth::StopRecordingRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_StopRecording_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>* UESynthService::Stub::AsyncStopRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStopRecordingRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::uesynth::ServerStats* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::GetServerStatsRequest, ::uesynth::ServerStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetServerStats_, context, request, response);
+}
+
+void UESynthService::Stub::async::GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::GetServerStatsRequest, ::uesynth::ServerStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetServerStats_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetServerStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::ServerStats>* UESynthService::Stub::PrepareAsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::ServerStats, ::uesynth::GetServerStatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetServerStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::ServerStats>* UESynthService::Stub::AsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetServerStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status UESynthService::Stub::GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::uesynth::HealthStatus* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::uesynth::HealthRequest, ::uesynth::HealthStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetHealth_, context, request, response);
+}
+
+void UESynthService::Stub::async::GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::uesynth::HealthRequest, ::uesynth::HealthStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetHealth_, context, request, response, std::move(f));
+}
+
+void UESynthService::Stub::async::GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetHealth_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::HealthStatus>* UESynthService::Stub::PrepareAsyncGetHealthRaw(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::uesynth::HealthStatus, ::uesynth::HealthRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetHealth_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::uesynth::HealthStatus>* UESynthService::Stub::AsyncGetHealthRaw(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetHealthRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 UESynthService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       UESynthService_method_names[0],
@@ -560,6 +935,26 @@ UESynthService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       UESynthService_method_names[8],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::SetObjectTransformsBatchRequest, ::uesynth::SetObjectTransformsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::SetObjectTransformsBatchRequest* req,
+             ::uesynth::SetObjectTransformsBatchResponse* resp) {
+               return service->SetObjectTransformsBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::GetObjectTransformsBatchRequest, ::uesynth::GetObjectTransformsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::GetObjectTransformsBatchRequest* req,
+             ::uesynth::GetObjectTransformsBatchResponse* resp) {
+               return service->GetObjectTransformsBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[10],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
              ::grpc::ServerContext* ctx,
@@ -568,7 +963,7 @@ UESynthService::Service::Service() {
                return service->CreateCamera(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[9],
+      UESynthService_method_names[11],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
@@ -578,7 +973,7 @@ UESynthService::Service::Service() {
                return service->DestroyCamera(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[10],
+      UESynthService_method_names[12],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
@@ -588,7 +983,7 @@ UESynthService::Service::Service() {
                return service->SetResolution(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[11],
+      UESynthService_method_names[13],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::CaptureRequest, ::uesynth::ImageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
@@ -598,7 +993,7 @@ UESynthService::Service::Service() {
                return service->CaptureNormals(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[12],
+      UESynthService_method_names[14],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::CaptureRequest, ::uesynth::ImageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
@@ -608,7 +1003,37 @@ UESynthService::Service::Service() {
                return service->CaptureOpticalFlow(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[13],
+      UESynthService_method_names[15],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::CaptureMultiRequest, ::uesynth::MultiImageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::CaptureMultiRequest* req,
+             ::uesynth::MultiImageResponse* resp) {
+               return service->CaptureMulti(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[16],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::StepRequest, ::uesynth::StepResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::StepRequest* req,
+             ::uesynth::StepResponse* resp) {
+               return service->Step(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[17],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::SetLockstepRequest, ::uesynth::LockstepState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::SetLockstepRequest* req,
+             ::uesynth::LockstepState* resp) {
+               return service->SetLockstep(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[18],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
@@ -618,7 +1043,17 @@ UESynthService::Service::Service() {
                return service->SpawnObject(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[14],
+      UESynthService_method_names[19],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::PreloadAssetsRequest, ::uesynth::PreloadAssetsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::PreloadAssetsRequest* req,
+             ::uesynth::PreloadAssetsResponse* resp) {
+               return service->PreloadAssets(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[20],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
@@ -628,7 +1063,17 @@ UESynthService::Service::Service() {
                return service->DestroyObject(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[15],
+      UESynthService_method_names[21],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::ConfigureActorPoolRequest, ::uesynth::ActorPoolStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::ConfigureActorPoolRequest* req,
+             ::uesynth::ActorPoolStats* resp) {
+               return service->ConfigureActorPool(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[22],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
@@ -638,17 +1083,47 @@ UESynthService::Service::Service() {
                return service->SetMaterial(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[16],
+      UESynthService_method_names[23],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::SetMaterialsBatchRequest, ::uesynth::SetMaterialsBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::SetMaterialsBatchRequest* req,
+             ::uesynth::SetMaterialsBatchResponse* resp) {
+               return service->SetMaterialsBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[24],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::ResolveMaterialParametersRequest, ::uesynth::MaterialParameterIds, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::ResolveMaterialParametersRequest* req,
+             ::uesynth::MaterialParameterIds* resp) {
+               return service->ResolveMaterialParameters(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[25],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::google::protobuf::Empty, ::uesynth::ListObjectsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::ListObjectsRequest, ::uesynth::ListObjectsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
              ::grpc::ServerContext* ctx,
-             const ::google::protobuf::Empty* req,
+             const ::uesynth::ListObjectsRequest* req,
              ::uesynth::ListObjectsResponse* resp) {
                return service->ListObjects(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UESynthService_method_names[17],
+      UESynthService_method_names[26],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::GetSceneSnapshotRequest, ::uesynth::SceneSnapshot, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::GetSceneSnapshotRequest* req,
+             ::uesynth::SceneSnapshot* resp) {
+               return service->GetSceneSnapshot(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[27],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::SetLightingRequest, ::uesynth::CommandResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](UESynthService::Service* service,
@@ -657,6 +1132,56 @@ UESynthService::Service::Service() {
              ::uesynth::CommandResponse* resp) {
                return service->SetLighting(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[28],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::SetLightingBatchRequest, ::uesynth::SetLightingBatchResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::SetLightingBatchRequest* req,
+             ::uesynth::SetLightingBatchResponse* resp) {
+               return service->SetLightingBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[29],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::StartRecordingRequest, ::uesynth::RecordingStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::StartRecordingRequest* req,
+             ::uesynth::RecordingStats* resp) {
+               return service->StartRecording(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[30],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::StopRecordingRequest, ::uesynth::RecordingStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::StopRecordingRequest* req,
+             ::uesynth::RecordingStats* resp) {
+               return service->StopRecording(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[31],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::GetServerStatsRequest, ::uesynth::ServerStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::GetServerStatsRequest* req,
+             ::uesynth::ServerStats* resp) {
+               return service->GetServerStats(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UESynthService_method_names[32],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< UESynthService::Service, ::uesynth::HealthRequest, ::uesynth::HealthStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](UESynthService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::uesynth::HealthRequest* req,
+             ::uesynth::HealthStatus* resp) {
+               return service->GetHealth(ctx, req, resp);
+             }, this)));
 }
 
 UESynthService::Service::~Service() {
@@ -717,6 +1242,20 @@ UESynthService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status UESynthService::Service::SetObjectTransformsBatch(::grpc::ServerContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::GetObjectTransformsBatch(::grpc::ServerContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status UESynthService::Service::CreateCamera(::grpc::ServerContext* context, const ::uesynth::CreateCameraRequest* request, ::uesynth::CommandResponse* response) {
   (void) context;
   (void) request;
@@ -752,6 +1291,27 @@ UESynthService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status UESynthService::Service::CaptureMulti(::grpc::ServerContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::Step(::grpc::ServerContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::SetLockstep(::grpc::ServerContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status UESynthService::Service::SpawnObject(::grpc::ServerContext* context, const ::uesynth::SpawnObjectRequest* request, ::uesynth::CommandResponse* response) {
   (void) context;
   (void) request;
@@ -759,6 +1319,13 @@ UESynthService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status UESynthService::Service::PreloadAssets(::grpc::ServerContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status UESynthService::Service::DestroyObject(::grpc::ServerContext* context, const ::uesynth::DestroyObjectRequest* request, ::uesynth::CommandResponse* response) {
   (void) context;
   (void) request;
@@ -766,6 +1333,13 @@ UESynthService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status UESynthService::Service::ConfigureActorPool(::grpc::ServerContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status UESynthService::Service::SetMaterial(::grpc::ServerContext* context, const ::uesynth::SetMaterialRequest* request, ::uesynth::CommandResponse* response) {
   (void) context;
   (void) request;
@@ -773,7 +1347,28 @@ UESynthService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
-::grpc::Status UESynthService::Service::ListObjects(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response) {
+::grpc::Status UESynthService::Service::SetMaterialsBatch(::grpc::ServerContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::ResolveMaterialParameters(::grpc::ServerContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::ListObjects(::grpc::ServerContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::GetSceneSnapshot(::grpc::ServerContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response) {
   (void) context;
   (void) request;
   (void) response;
@@ -787,6 +1382,41 @@ UESynthService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status UESynthService::Service::SetLightingBatch(::grpc::ServerContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::StartRecording(::grpc::ServerContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::StopRecording(::grpc::ServerContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::GetServerStats(::grpc::ServerContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status UESynthService::Service::GetHealth(::grpc::ServerContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace uesynth
 
@@ -104,6 +104,20 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformResponse>> PrepareAsyncGetObjectTransform(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformResponse>>(PrepareAsyncGetObjectTransformRaw(context, request, cq));
     }
+    virtual ::grpc::Status SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::uesynth::SetObjectTransformsBatchResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetObjectTransformsBatchResponse>> AsyncSetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetObjectTransformsBatchResponse>>(AsyncSetObjectTransformsBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetObjectTransformsBatchResponse>> PrepareAsyncSetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetObjectTransformsBatchResponse>>(PrepareAsyncSetObjectTransformsBatchRaw(context, request, cq));
+    }
+    virtual ::grpc::Status GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::uesynth::GetObjectTransformsBatchResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformsBatchResponse>> AsyncGetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformsBatchResponse>>(AsyncGetObjectTransformsBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformsBatchResponse>> PrepareAsyncGetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformsBatchResponse>>(PrepareAsyncGetObjectTransformsBatchRaw(context, request, cq));
+    }
     // Additional Camera Control
     virtual ::grpc::Status CreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::uesynth::CommandResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> AsyncCreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::grpc::CompletionQueue* cq) {
@@ -141,6 +155,30 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ImageResponse>> PrepareAsyncCaptureOpticalFlow(::grpc::ClientContext* context, const ::uesynth::CaptureRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ImageResponse>>(PrepareAsyncCaptureOpticalFlowRaw(context, request, cq));
     }
+    // Several modalities read back from one rendered frame
+    virtual ::grpc::Status CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::uesynth::MultiImageResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MultiImageResponse>> AsyncCaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MultiImageResponse>>(AsyncCaptureMultiRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MultiImageResponse>> PrepareAsyncCaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MultiImageResponse>>(PrepareAsyncCaptureMultiRaw(context, request, cq));
+    }
+    // Several actions and a capture of the scene they leave, in one game-thread task
+    virtual ::grpc::Status Step(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::uesynth::StepResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::StepResponse>> AsyncStep(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::StepResponse>>(AsyncStepRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::StepResponse>> PrepareAsyncStep(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::StepResponse>>(PrepareAsyncStepRaw(context, request, cq));
+    }
+    // Has the engine wait for a step between frames, see SetLockstepRequest
+    virtual ::grpc::Status SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::uesynth::LockstepState* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::LockstepState>> AsyncSetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::LockstepState>>(AsyncSetLockstepRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::LockstepState>> PrepareAsyncSetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::LockstepState>>(PrepareAsyncSetLockstepRaw(context, request, cq));
+    }
     // Additional Object Manipulation
     virtual ::grpc::Status SpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::uesynth::CommandResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> AsyncSpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::grpc::CompletionQueue* cq) {
@@ -149,6 +187,14 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> PrepareAsyncSpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>>(PrepareAsyncSpawnObjectRaw(context, request, cq));
     }
+    // Streams assets in ahead of the spawns that use them
+    virtual ::grpc::Status PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::uesynth::PreloadAssetsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::PreloadAssetsResponse>> AsyncPreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::PreloadAssetsResponse>>(AsyncPreloadAssetsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::PreloadAssetsResponse>> PrepareAsyncPreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::PreloadAssetsResponse>>(PrepareAsyncPreloadAssetsRaw(context, request, cq));
+    }
     virtual ::grpc::Status DestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::uesynth::CommandResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> AsyncDestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>>(AsyncDestroyObjectRaw(context, request, cq));
@@ -156,6 +202,14 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> PrepareAsyncDestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>>(PrepareAsyncDestroyObjectRaw(context, request, cq));
     }
+    // Limits and clears the pool of actors pooled spawns reuse, and reports it
+    virtual ::grpc::Status ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::uesynth::ActorPoolStats* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ActorPoolStats>> AsyncConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ActorPoolStats>>(AsyncConfigureActorPoolRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ActorPoolStats>> PrepareAsyncConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ActorPoolStats>>(PrepareAsyncConfigureActorPoolRaw(context, request, cq));
+    }
     virtual ::grpc::Status SetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::uesynth::CommandResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> AsyncSetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>>(AsyncSetMaterialRaw(context, request, cq));
@@ -163,14 +217,39 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> PrepareAsyncSetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>>(PrepareAsyncSetMaterialRaw(context, request, cq));
     }
+    // Material parameters of many objects in one game-thread pass
+    virtual ::grpc::Status SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::uesynth::SetMaterialsBatchResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetMaterialsBatchResponse>> AsyncSetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetMaterialsBatchResponse>>(AsyncSetMaterialsBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetMaterialsBatchResponse>> PrepareAsyncSetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetMaterialsBatchResponse>>(PrepareAsyncSetMaterialsBatchRaw(context, request, cq));
+    }
+    // IDs to send instead of material parameter names
+    virtual ::grpc::Status ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::uesynth::MaterialParameterIds* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MaterialParameterIds>> AsyncResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MaterialParameterIds>>(AsyncResolveMaterialParametersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MaterialParameterIds>> PrepareAsyncResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MaterialParameterIds>>(PrepareAsyncResolveMaterialParametersRaw(context, request, cq));
+    }
     // Scene Control
-    virtual ::grpc::Status ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::uesynth::ListObjectsResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>> AsyncListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+    virtual ::grpc::Status ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::uesynth::ListObjectsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>> AsyncListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>>(AsyncListObjectsRaw(context, request, cq));
     }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>> PrepareAsyncListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>> PrepareAsyncListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>>(PrepareAsyncListObjectsRaw(context, request, cq));
     }
+    // Transforms of every registered object in one packed buffer, or only of
+    // those changed since a snapshot the client already has
+    virtual ::grpc::Status GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::uesynth::SceneSnapshot* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SceneSnapshot>> AsyncGetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SceneSnapshot>>(AsyncGetSceneSnapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SceneSnapshot>> PrepareAsyncGetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SceneSnapshot>>(PrepareAsyncGetSceneSnapshotRaw(context, request, cq));
+    }
     virtual ::grpc::Status SetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::uesynth::CommandResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> AsyncSetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>>(AsyncSetLightingRaw(context, request, cq));
@@ -178,6 +257,51 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>> PrepareAsyncSetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>>(PrepareAsyncSetLightingRaw(context, request, cq));
     }
+    // Many lights in one game-thread pass
+    virtual ::grpc::Status SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::uesynth::SetLightingBatchResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetLightingBatchResponse>> AsyncSetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetLightingBatchResponse>>(AsyncSetLightingBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetLightingBatchResponse>> PrepareAsyncSetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetLightingBatchResponse>>(PrepareAsyncSetLightingBatchRaw(context, request, cq));
+    }
+    // Recording
+    // Writes captures to files on the server instead of sending them, see
+    // StartRecordingRequest
+    virtual ::grpc::Status StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::uesynth::RecordingStats* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>> AsyncStartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>>(AsyncStartRecordingRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>> PrepareAsyncStartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>>(PrepareAsyncStartRecordingRaw(context, request, cq));
+    }
+    // Answers once every frame queued for the recording is on disk
+    virtual ::grpc::Status StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::uesynth::RecordingStats* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>> AsyncStopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>>(AsyncStopRecordingRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>> PrepareAsyncStopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>>(PrepareAsyncStopRecordingRaw(context, request, cq));
+    }
+    // Monitoring
+    // Per-RPC latency, per-stage timing and queue depths; answered without
+    // waiting for the game thread
+    virtual ::grpc::Status GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::uesynth::ServerStats* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ServerStats>> AsyncGetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ServerStats>>(AsyncGetServerStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ServerStats>> PrepareAsyncGetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ServerStats>>(PrepareAsyncGetServerStatsRaw(context, request, cq));
+    }
+    // Whether the instance can take work and how busy it is, cheap enough to
+    // poll across a fleet; also answered without waiting for the game thread
+    virtual ::grpc::Status GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::uesynth::HealthStatus* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::HealthStatus>> AsyncGetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::HealthStatus>>(AsyncGetHealthRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::HealthStatus>> PrepareAsyncGetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::HealthStatus>>(PrepareAsyncGetHealthRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -202,6 +326,10 @@ class UESynthService final {
       virtual void SetObjectTransform(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetObjectTransform(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest* request, ::uesynth::GetObjectTransformResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetObjectTransform(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest* request, ::uesynth::GetObjectTransformResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // Additional Camera Control
       virtual void CreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void CreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
@@ -214,18 +342,63 @@ class UESynthService final {
       virtual void CaptureNormals(::grpc::ClientContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void CaptureOpticalFlow(::grpc::ClientContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void CaptureOpticalFlow(::grpc::ClientContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Several modalities read back from one rendered frame
+      virtual void CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Several actions and a capture of the scene they leave, in one game-thread task
+      virtual void Step(::grpc::ClientContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Step(::grpc::ClientContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Has the engine wait for a step between frames, see SetLockstepRequest
+      virtual void SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // Additional Object Manipulation
       virtual void SpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Streams assets in ahead of the spawns that use them
+      virtual void PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void DestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void DestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Limits and clears the pool of actors pooled spawns reuse, and reports it
+      virtual void ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Material parameters of many objects in one game-thread pass
+      virtual void SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // IDs to send instead of material parameter names
+      virtual void ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // Scene Control
-      virtual void ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Transforms of every registered object in one packed buffer, or only of
+      // those changed since a snapshot the client already has
+      virtual void GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Many lights in one game-thread pass
+      virtual void SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Recording
+      // Writes captures to files on the server instead of sending them, see
+      // StartRecordingRequest
+      virtual void StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Answers once every frame queued for the recording is on disk
+      virtual void StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Monitoring
+      // Per-RPC latency, per-stage timing and queue depths; answered without
+      // waiting for the game thread
+      virtual void GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Whether the instance can take work and how busy it is, cheap enough to
+      // poll across a fleet; also answered without waiting for the game thread
+      virtual void GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -248,6 +421,10 @@ class UESynthService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* PrepareAsyncSetObjectTransformRaw(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformResponse>* AsyncGetObjectTransformRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformResponse>* PrepareAsyncGetObjectTransformRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetObjectTransformsBatchResponse>* AsyncSetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetObjectTransformsBatchResponse>* PrepareAsyncSetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformsBatchResponse>* AsyncGetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::GetObjectTransformsBatchResponse>* PrepareAsyncGetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* AsyncCreateCameraRaw(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* PrepareAsyncCreateCameraRaw(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* AsyncDestroyCameraRaw(::grpc::ClientContext* context, const ::uesynth::DestroyCameraRequest& request, ::grpc::CompletionQueue* cq) = 0;
@@ -258,16 +435,42 @@ class UESynthService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ImageResponse>* PrepareAsyncCaptureNormalsRaw(::grpc::ClientContext* context, const ::uesynth::CaptureRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ImageResponse>* AsyncCaptureOpticalFlowRaw(::grpc::ClientContext* context, const ::uesynth::CaptureRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ImageResponse>* PrepareAsyncCaptureOpticalFlowRaw(::grpc::ClientContext* context, const ::uesynth::CaptureRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MultiImageResponse>* AsyncCaptureMultiRaw(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MultiImageResponse>* PrepareAsyncCaptureMultiRaw(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::StepResponse>* AsyncStepRaw(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::StepResponse>* PrepareAsyncStepRaw(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::LockstepState>* AsyncSetLockstepRaw(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::LockstepState>* PrepareAsyncSetLockstepRaw(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* AsyncSpawnObjectRaw(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* PrepareAsyncSpawnObjectRaw(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::PreloadAssetsResponse>* AsyncPreloadAssetsRaw(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::PreloadAssetsResponse>* PrepareAsyncPreloadAssetsRaw(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* AsyncDestroyObjectRaw(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* PrepareAsyncDestroyObjectRaw(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ActorPoolStats>* AsyncConfigureActorPoolRaw(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ActorPoolStats>* PrepareAsyncConfigureActorPoolRaw(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* AsyncSetMaterialRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* PrepareAsyncSetMaterialRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>* AsyncListObjectsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>* PrepareAsyncListObjectsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetMaterialsBatchResponse>* AsyncSetMaterialsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetMaterialsBatchResponse>* PrepareAsyncSetMaterialsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MaterialParameterIds>* AsyncResolveMaterialParametersRaw(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::MaterialParameterIds>* PrepareAsyncResolveMaterialParametersRaw(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>* AsyncListObjectsRaw(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ListObjectsResponse>* PrepareAsyncListObjectsRaw(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SceneSnapshot>* AsyncGetSceneSnapshotRaw(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SceneSnapshot>* PrepareAsyncGetSceneSnapshotRaw(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* AsyncSetLightingRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::CommandResponse>* PrepareAsyncSetLightingRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetLightingBatchResponse>* AsyncSetLightingBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::SetLightingBatchResponse>* PrepareAsyncSetLightingBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>* AsyncStartRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>* PrepareAsyncStartRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>* AsyncStopRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::RecordingStats>* PrepareAsyncStopRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ServerStats>* AsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::ServerStats>* PrepareAsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::HealthStatus>* AsyncGetHealthRaw(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::uesynth::HealthStatus>* PrepareAsyncGetHealthRaw(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -330,6 +533,20 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformResponse>> PrepareAsyncGetObjectTransform(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformResponse>>(PrepareAsyncGetObjectTransformRaw(context, request, cq));
     }
+    ::grpc::Status SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::uesynth::SetObjectTransformsBatchResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetObjectTransformsBatchResponse>> AsyncSetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetObjectTransformsBatchResponse>>(AsyncSetObjectTransformsBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetObjectTransformsBatchResponse>> PrepareAsyncSetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetObjectTransformsBatchResponse>>(PrepareAsyncSetObjectTransformsBatchRaw(context, request, cq));
+    }
+    ::grpc::Status GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::uesynth::GetObjectTransformsBatchResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformsBatchResponse>> AsyncGetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformsBatchResponse>>(AsyncGetObjectTransformsBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformsBatchResponse>> PrepareAsyncGetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformsBatchResponse>>(PrepareAsyncGetObjectTransformsBatchRaw(context, request, cq));
+    }
     ::grpc::Status CreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::uesynth::CommandResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> AsyncCreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(AsyncCreateCameraRaw(context, request, cq));
@@ -365,6 +582,27 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ImageResponse>> PrepareAsyncCaptureOpticalFlow(::grpc::ClientContext* context, const ::uesynth::CaptureRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ImageResponse>>(PrepareAsyncCaptureOpticalFlowRaw(context, request, cq));
     }
+    ::grpc::Status CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::uesynth::MultiImageResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::MultiImageResponse>> AsyncCaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::MultiImageResponse>>(AsyncCaptureMultiRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::MultiImageResponse>> PrepareAsyncCaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::MultiImageResponse>>(PrepareAsyncCaptureMultiRaw(context, request, cq));
+    }
+    ::grpc::Status Step(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::uesynth::StepResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::StepResponse>> AsyncStep(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::StepResponse>>(AsyncStepRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::StepResponse>> PrepareAsyncStep(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::StepResponse>>(PrepareAsyncStepRaw(context, request, cq));
+    }
+    ::grpc::Status SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::uesynth::LockstepState* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::LockstepState>> AsyncSetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::LockstepState>>(AsyncSetLockstepRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::LockstepState>> PrepareAsyncSetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::LockstepState>>(PrepareAsyncSetLockstepRaw(context, request, cq));
+    }
     ::grpc::Status SpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::uesynth::CommandResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> AsyncSpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(AsyncSpawnObjectRaw(context, request, cq));
@@ -372,6 +610,13 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> PrepareAsyncSpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(PrepareAsyncSpawnObjectRaw(context, request, cq));
     }
+    ::grpc::Status PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::uesynth::PreloadAssetsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::PreloadAssetsResponse>> AsyncPreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::PreloadAssetsResponse>>(AsyncPreloadAssetsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::PreloadAssetsResponse>> PrepareAsyncPreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::PreloadAssetsResponse>>(PrepareAsyncPreloadAssetsRaw(context, request, cq));
+    }
     ::grpc::Status DestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::uesynth::CommandResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> AsyncDestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(AsyncDestroyObjectRaw(context, request, cq));
@@ -379,6 +624,13 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> PrepareAsyncDestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(PrepareAsyncDestroyObjectRaw(context, request, cq));
     }
+    ::grpc::Status ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::uesynth::ActorPoolStats* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ActorPoolStats>> AsyncConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ActorPoolStats>>(AsyncConfigureActorPoolRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ActorPoolStats>> PrepareAsyncConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ActorPoolStats>>(PrepareAsyncConfigureActorPoolRaw(context, request, cq));
+    }
     ::grpc::Status SetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::uesynth::CommandResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> AsyncSetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(AsyncSetMaterialRaw(context, request, cq));
@@ -386,13 +638,34 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> PrepareAsyncSetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(PrepareAsyncSetMaterialRaw(context, request, cq));
     }
-    ::grpc::Status ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::uesynth::ListObjectsResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>> AsyncListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+    ::grpc::Status SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::uesynth::SetMaterialsBatchResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetMaterialsBatchResponse>> AsyncSetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetMaterialsBatchResponse>>(AsyncSetMaterialsBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetMaterialsBatchResponse>> PrepareAsyncSetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetMaterialsBatchResponse>>(PrepareAsyncSetMaterialsBatchRaw(context, request, cq));
+    }
+    ::grpc::Status ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::uesynth::MaterialParameterIds* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::MaterialParameterIds>> AsyncResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::MaterialParameterIds>>(AsyncResolveMaterialParametersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::MaterialParameterIds>> PrepareAsyncResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::MaterialParameterIds>>(PrepareAsyncResolveMaterialParametersRaw(context, request, cq));
+    }
+    ::grpc::Status ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::uesynth::ListObjectsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>> AsyncListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>>(AsyncListObjectsRaw(context, request, cq));
     }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>> PrepareAsyncListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>> PrepareAsyncListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>>(PrepareAsyncListObjectsRaw(context, request, cq));
     }
+    ::grpc::Status GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::uesynth::SceneSnapshot* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SceneSnapshot>> AsyncGetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SceneSnapshot>>(AsyncGetSceneSnapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SceneSnapshot>> PrepareAsyncGetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SceneSnapshot>>(PrepareAsyncGetSceneSnapshotRaw(context, request, cq));
+    }
     ::grpc::Status SetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::uesynth::CommandResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> AsyncSetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(AsyncSetLightingRaw(context, request, cq));
@@ -400,6 +673,41 @@ class UESynthService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>> PrepareAsyncSetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>>(PrepareAsyncSetLightingRaw(context, request, cq));
     }
+    ::grpc::Status SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::uesynth::SetLightingBatchResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetLightingBatchResponse>> AsyncSetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetLightingBatchResponse>>(AsyncSetLightingBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetLightingBatchResponse>> PrepareAsyncSetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::SetLightingBatchResponse>>(PrepareAsyncSetLightingBatchRaw(context, request, cq));
+    }
+    ::grpc::Status StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::uesynth::RecordingStats* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>> AsyncStartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>>(AsyncStartRecordingRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>> PrepareAsyncStartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>>(PrepareAsyncStartRecordingRaw(context, request, cq));
+    }
+    ::grpc::Status StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::uesynth::RecordingStats* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>> AsyncStopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>>(AsyncStopRecordingRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>> PrepareAsyncStopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>>(PrepareAsyncStopRecordingRaw(context, request, cq));
+    }
+    ::grpc::Status GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::uesynth::ServerStats* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ServerStats>> AsyncGetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ServerStats>>(AsyncGetServerStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ServerStats>> PrepareAsyncGetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::ServerStats>>(PrepareAsyncGetServerStatsRaw(context, request, cq));
+    }
+    ::grpc::Status GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::uesynth::HealthStatus* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::HealthStatus>> AsyncGetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::HealthStatus>>(AsyncGetHealthRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::HealthStatus>> PrepareAsyncGetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::uesynth::HealthStatus>>(PrepareAsyncGetHealthRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -418,6 +726,10 @@ class UESynthService final {
       void SetObjectTransform(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetObjectTransform(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest* request, ::uesynth::GetObjectTransformResponse* response, std::function<void(::grpc::Status)>) override;
       void GetObjectTransform(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest* request, ::uesynth::GetObjectTransformResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response, std::function<void(::grpc::Status)>) override;
+      void SetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetObjectTransformsBatch(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void CreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) override;
       void CreateCamera(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void DestroyCamera(::grpc::ClientContext* context, const ::uesynth::DestroyCameraRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) override;
@@ -428,16 +740,42 @@ class UESynthService final {
       void CaptureNormals(::grpc::ClientContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void CaptureOpticalFlow(::grpc::ClientContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response, std::function<void(::grpc::Status)>) override;
       void CaptureOpticalFlow(::grpc::ClientContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response, std::function<void(::grpc::Status)>) override;
+      void CaptureMulti(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Step(::grpc::ClientContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response, std::function<void(::grpc::Status)>) override;
+      void Step(::grpc::ClientContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response, std::function<void(::grpc::Status)>) override;
+      void SetLockstep(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) override;
       void SpawnObject(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response, std::function<void(::grpc::Status)>) override;
+      void PreloadAssets(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void DestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) override;
       void DestroyObject(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response, std::function<void(::grpc::Status)>) override;
+      void ConfigureActorPool(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) override;
       void SetMaterial(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response, std::function<void(::grpc::Status)>) override;
-      void ListObjects(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response, std::function<void(::grpc::Status)>) override;
+      void SetMaterialsBatch(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response, std::function<void(::grpc::Status)>) override;
+      void ResolveMaterialParameters(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response, std::function<void(::grpc::Status)>) override;
+      void ListObjects(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response, std::function<void(::grpc::Status)>) override;
+      void GetSceneSnapshot(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest* request, ::uesynth::CommandResponse* response, std::function<void(::grpc::Status)>) override;
       void SetLighting(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest* request, ::uesynth::CommandResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response, std::function<void(::grpc::Status)>) override;
+      void SetLightingBatch(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response, std::function<void(::grpc::Status)>) override;
+      void StartRecording(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response, std::function<void(::grpc::Status)>) override;
+      void StopRecording(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response, std::function<void(::grpc::Status)>) override;
+      void GetServerStats(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response, std::function<void(::grpc::Status)>) override;
+      void GetHealth(::grpc::ClientContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -466,6 +804,10 @@ class UESynthService final {
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* PrepareAsyncSetObjectTransformRaw(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformResponse>* AsyncGetObjectTransformRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformResponse>* PrepareAsyncGetObjectTransformRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::SetObjectTransformsBatchResponse>* AsyncSetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::SetObjectTransformsBatchResponse>* PrepareAsyncSetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformsBatchResponse>* AsyncGetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::GetObjectTransformsBatchResponse>* PrepareAsyncGetObjectTransformsBatchRaw(::grpc::ClientContext* context, const ::uesynth::GetObjectTransformsBatchRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* AsyncCreateCameraRaw(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* PrepareAsyncCreateCameraRaw(::grpc::ClientContext* context, const ::uesynth::CreateCameraRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* AsyncDestroyCameraRaw(::grpc::ClientContext* context, const ::uesynth::DestroyCameraRequest& request, ::grpc::CompletionQueue* cq) override;
@@ -476,16 +818,42 @@ class UESynthService final {
     ::grpc::ClientAsyncResponseReader< ::uesynth::ImageResponse>* PrepareAsyncCaptureNormalsRaw(::grpc::ClientContext* context, const ::uesynth::CaptureRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::ImageResponse>* AsyncCaptureOpticalFlowRaw(::grpc::ClientContext* context, const ::uesynth::CaptureRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::ImageResponse>* PrepareAsyncCaptureOpticalFlowRaw(::grpc::ClientContext* context, const ::uesynth::CaptureRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::MultiImageResponse>* AsyncCaptureMultiRaw(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::MultiImageResponse>* PrepareAsyncCaptureMultiRaw(::grpc::ClientContext* context, const ::uesynth::CaptureMultiRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::StepResponse>* AsyncStepRaw(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::StepResponse>* PrepareAsyncStepRaw(::grpc::ClientContext* context, const ::uesynth::StepRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::LockstepState>* AsyncSetLockstepRaw(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::LockstepState>* PrepareAsyncSetLockstepRaw(::grpc::ClientContext* context, const ::uesynth::SetLockstepRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* AsyncSpawnObjectRaw(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* PrepareAsyncSpawnObjectRaw(::grpc::ClientContext* context, const ::uesynth::SpawnObjectRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::PreloadAssetsResponse>* AsyncPreloadAssetsRaw(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::PreloadAssetsResponse>* PrepareAsyncPreloadAssetsRaw(::grpc::ClientContext* context, const ::uesynth::PreloadAssetsRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* AsyncDestroyObjectRaw(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* PrepareAsyncDestroyObjectRaw(::grpc::ClientContext* context, const ::uesynth::DestroyObjectRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::ActorPoolStats>* AsyncConfigureActorPoolRaw(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::ActorPoolStats>* PrepareAsyncConfigureActorPoolRaw(::grpc::ClientContext* context, const ::uesynth::ConfigureActorPoolRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* AsyncSetMaterialRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* PrepareAsyncSetMaterialRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>* AsyncListObjectsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>* PrepareAsyncListObjectsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::SetMaterialsBatchResponse>* AsyncSetMaterialsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::SetMaterialsBatchResponse>* PrepareAsyncSetMaterialsBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetMaterialsBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::MaterialParameterIds>* AsyncResolveMaterialParametersRaw(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::MaterialParameterIds>* PrepareAsyncResolveMaterialParametersRaw(::grpc::ClientContext* context, const ::uesynth::ResolveMaterialParametersRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>* AsyncListObjectsRaw(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::ListObjectsResponse>* PrepareAsyncListObjectsRaw(::grpc::ClientContext* context, const ::uesynth::ListObjectsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::SceneSnapshot>* AsyncGetSceneSnapshotRaw(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::SceneSnapshot>* PrepareAsyncGetSceneSnapshotRaw(::grpc::ClientContext* context, const ::uesynth::GetSceneSnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* AsyncSetLightingRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::uesynth::CommandResponse>* PrepareAsyncSetLightingRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::SetLightingBatchResponse>* AsyncSetLightingBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::SetLightingBatchResponse>* PrepareAsyncSetLightingBatchRaw(::grpc::ClientContext* context, const ::uesynth::SetLightingBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>* AsyncStartRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>* PrepareAsyncStartRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StartRecordingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>* AsyncStopRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::RecordingStats>* PrepareAsyncStopRecordingRaw(::grpc::ClientContext* context, const ::uesynth::StopRecordingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::ServerStats>* AsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::ServerStats>* PrepareAsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::uesynth::GetServerStatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::HealthStatus>* AsyncGetHealthRaw(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::uesynth::HealthStatus>* PrepareAsyncGetHealthRaw(::grpc::ClientContext* context, const ::uesynth::HealthRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_ControlStream_;
     const ::grpc::internal::RpcMethod rpcmethod_SetCameraTransform_;
     const ::grpc::internal::RpcMethod rpcmethod_GetCameraTransform_;
@@ -494,16 +862,31 @@ class UESynthService final {
     const ::grpc::internal::RpcMethod rpcmethod_CaptureSegmentationMask_;
     const ::grpc::internal::RpcMethod rpcmethod_SetObjectTransform_;
     const ::grpc::internal::RpcMethod rpcmethod_GetObjectTransform_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetObjectTransformsBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetObjectTransformsBatch_;
     const ::grpc::internal::RpcMethod rpcmethod_CreateCamera_;
     const ::grpc::internal::RpcMethod rpcmethod_DestroyCamera_;
     const ::grpc::internal::RpcMethod rpcmethod_SetResolution_;
     const ::grpc::internal::RpcMethod rpcmethod_CaptureNormals_;
     const ::grpc::internal::RpcMethod rpcmethod_CaptureOpticalFlow_;
+    const ::grpc::internal::RpcMethod rpcmethod_CaptureMulti_;
+    const ::grpc::internal::RpcMethod rpcmethod_Step_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetLockstep_;
     const ::grpc::internal::RpcMethod rpcmethod_SpawnObject_;
+    const ::grpc::internal::RpcMethod rpcmethod_PreloadAssets_;
     const ::grpc::internal::RpcMethod rpcmethod_DestroyObject_;
+    const ::grpc::internal::RpcMethod rpcmethod_ConfigureActorPool_;
     const ::grpc::internal::RpcMethod rpcmethod_SetMaterial_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetMaterialsBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_ResolveMaterialParameters_;
     const ::grpc::internal::RpcMethod rpcmethod_ListObjects_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetSceneSnapshot_;
     const ::grpc::internal::RpcMethod rpcmethod_SetLighting_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetLightingBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_StartRecording_;
+    const ::grpc::internal::RpcMethod rpcmethod_StopRecording_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetServerStats_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetHealth_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -525,6 +908,8 @@ class UESynthService final {
     // Object Manipulation
     virtual ::grpc::Status SetObjectTransform(::grpc::ServerContext* context, const ::uesynth::SetObjectTransformRequest* request, ::uesynth::CommandResponse* response);
     virtual ::grpc::Status GetObjectTransform(::grpc::ServerContext* context, const ::uesynth::GetObjectTransformRequest* request, ::uesynth::GetObjectTransformResponse* response);
+    virtual ::grpc::Status SetObjectTransformsBatch(::grpc::ServerContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response);
+    virtual ::grpc::Status GetObjectTransformsBatch(::grpc::ServerContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response);
     // Additional Camera Control
     virtual ::grpc::Status CreateCamera(::grpc::ServerContext* context, const ::uesynth::CreateCameraRequest* request, ::uesynth::CommandResponse* response);
     virtual ::grpc::Status DestroyCamera(::grpc::ServerContext* context, const ::uesynth::DestroyCameraRequest* request, ::uesynth::CommandResponse* response);
@@ -532,13 +917,45 @@ class UESynthService final {
     // Additional Data Capture
     virtual ::grpc::Status CaptureNormals(::grpc::ServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response);
     virtual ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response);
+    // Several modalities read back from one rendered frame
+    virtual ::grpc::Status CaptureMulti(::grpc::ServerContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response);
+    // Several actions and a capture of the scene they leave, in one game-thread task
+    virtual ::grpc::Status Step(::grpc::ServerContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response);
+    // Has the engine wait for a step between frames, see SetLockstepRequest
+    virtual ::grpc::Status SetLockstep(::grpc::ServerContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response);
     // Additional Object Manipulation
     virtual ::grpc::Status SpawnObject(::grpc::ServerContext* context, const ::uesynth::SpawnObjectRequest* request, ::uesynth::CommandResponse* response);
+    // Streams assets in ahead of the spawns that use them
+    virtual ::grpc::Status PreloadAssets(::grpc::ServerContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response);
     virtual ::grpc::Status DestroyObject(::grpc::ServerContext* context, const ::uesynth::DestroyObjectRequest* request, ::uesynth::CommandResponse* response);
+    // Limits and clears the pool of actors pooled spawns reuse, and reports it
+    virtual ::grpc::Status ConfigureActorPool(::grpc::ServerContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response);
     virtual ::grpc::Status SetMaterial(::grpc::ServerContext* context, const ::uesynth::SetMaterialRequest* request, ::uesynth::CommandResponse* response);
+    // Material parameters of many objects in one game-thread pass
+    virtual ::grpc::Status SetMaterialsBatch(::grpc::ServerContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response);
+    // IDs to send instead of material parameter names
+    virtual ::grpc::Status ResolveMaterialParameters(::grpc::ServerContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response);
     // Scene Control
-    virtual ::grpc::Status ListObjects(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response);
+    virtual ::grpc::Status ListObjects(::grpc::ServerContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response);
+    // Transforms of every registered object in one packed buffer, or only of
+    // those changed since a snapshot the client already has
+    virtual ::grpc::Status GetSceneSnapshot(::grpc::ServerContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response);
     virtual ::grpc::Status SetLighting(::grpc::ServerContext* context, const ::uesynth::SetLightingRequest* request, ::uesynth::CommandResponse* response);
+    // Many lights in one game-thread pass
+    virtual ::grpc::Status SetLightingBatch(::grpc::ServerContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response);
+    // Recording
+    // Writes captures to files on the server instead of sending them, see
+    // StartRecordingRequest
+    virtual ::grpc::Status StartRecording(::grpc::ServerContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response);
+    // Answers once every frame queued for the recording is on disk
+    virtual ::grpc::Status StopRecording(::grpc::ServerContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response);
+    // Monitoring
+    // Per-RPC latency, per-stage timing and queue depths; answered without
+    // waiting for the game thread
+    virtual ::grpc::Status GetServerStats(::grpc::ServerContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response);
+    // Whether the instance can take work and how busy it is, cheap enough to
+    // poll across a fleet; also answered without waiting for the game thread
+    virtual ::grpc::Status GetHealth(::grpc::ServerContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_ControlStream : public BaseClass {
@@ -701,835 +1118,789 @@ class UESynthService final {
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_CreateCamera : public BaseClass {
+  class WithAsyncMethod_SetObjectTransformsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_CreateCamera() {
+    WithAsyncMethod_SetObjectTransformsBatch() {
       ::grpc::Service::MarkMethodAsync(8);
     }
-    ~WithAsyncMethod_CreateCamera() override {
+    ~WithAsyncMethod_SetObjectTransformsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformsBatchRequest* /*request*/, ::uesynth::SetObjectTransformsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCreateCamera(::grpc::ServerContext* context, ::uesynth::CreateCameraRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestSetObjectTransformsBatch(::grpc::ServerContext* context, ::uesynth::SetObjectTransformsBatchRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::SetObjectTransformsBatchResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_DestroyCamera : public BaseClass {
+  class WithAsyncMethod_GetObjectTransformsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_DestroyCamera() {
+    WithAsyncMethod_GetObjectTransformsBatch() {
       ::grpc::Service::MarkMethodAsync(9);
     }
-    ~WithAsyncMethod_DestroyCamera() override {
+    ~WithAsyncMethod_GetObjectTransformsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status GetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformsBatchRequest* /*request*/, ::uesynth::GetObjectTransformsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestDestroyCamera(::grpc::ServerContext* context, ::uesynth::DestroyCameraRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestGetObjectTransformsBatch(::grpc::ServerContext* context, ::uesynth::GetObjectTransformsBatchRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::GetObjectTransformsBatchResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_SetResolution : public BaseClass {
+  class WithAsyncMethod_CreateCamera : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_SetResolution() {
+    WithAsyncMethod_CreateCamera() {
       ::grpc::Service::MarkMethodAsync(10);
     }
-    ~WithAsyncMethod_SetResolution() override {
+    ~WithAsyncMethod_CreateCamera() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetResolution(::grpc::ServerContext* context, ::uesynth::SetResolutionRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestCreateCamera(::grpc::ServerContext* context, ::uesynth::CreateCameraRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_CaptureNormals : public BaseClass {
+  class WithAsyncMethod_DestroyCamera : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_CaptureNormals() {
+    WithAsyncMethod_DestroyCamera() {
       ::grpc::Service::MarkMethodAsync(11);
     }
-    ~WithAsyncMethod_CaptureNormals() override {
+    ~WithAsyncMethod_DestroyCamera() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCaptureNormals(::grpc::ServerContext* context, ::uesynth::CaptureRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::ImageResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestDestroyCamera(::grpc::ServerContext* context, ::uesynth::DestroyCameraRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_CaptureOpticalFlow : public BaseClass {
+  class WithAsyncMethod_SetResolution : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_CaptureOpticalFlow() {
+    WithAsyncMethod_SetResolution() {
       ::grpc::Service::MarkMethodAsync(12);
     }
-    ~WithAsyncMethod_CaptureOpticalFlow() override {
+    ~WithAsyncMethod_SetResolution() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCaptureOpticalFlow(::grpc::ServerContext* context, ::uesynth::CaptureRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::ImageResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestSetResolution(::grpc::ServerContext* context, ::uesynth::SetResolutionRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_SpawnObject : public BaseClass {
+  class WithAsyncMethod_CaptureNormals : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_SpawnObject() {
+    WithAsyncMethod_CaptureNormals() {
       ::grpc::Service::MarkMethodAsync(13);
     }
-    ~WithAsyncMethod_SpawnObject() override {
+    ~WithAsyncMethod_CaptureNormals() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSpawnObject(::grpc::ServerContext* context, ::uesynth::SpawnObjectRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestCaptureNormals(::grpc::ServerContext* context, ::uesynth::CaptureRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::ImageResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_DestroyObject : public BaseClass {
+  class WithAsyncMethod_CaptureOpticalFlow : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_DestroyObject() {
+    WithAsyncMethod_CaptureOpticalFlow() {
       ::grpc::Service::MarkMethodAsync(14);
     }
-    ~WithAsyncMethod_DestroyObject() override {
+    ~WithAsyncMethod_CaptureOpticalFlow() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestDestroyObject(::grpc::ServerContext* context, ::uesynth::DestroyObjectRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestCaptureOpticalFlow(::grpc::ServerContext* context, ::uesynth::CaptureRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::ImageResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_SetMaterial : public BaseClass {
+  class WithAsyncMethod_CaptureMulti : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_SetMaterial() {
+    WithAsyncMethod_CaptureMulti() {
       ::grpc::Service::MarkMethodAsync(15);
     }
-    ~WithAsyncMethod_SetMaterial() override {
+    ~WithAsyncMethod_CaptureMulti() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureMulti(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureMultiRequest* /*request*/, ::uesynth::MultiImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetMaterial(::grpc::ServerContext* context, ::uesynth::SetMaterialRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestCaptureMulti(::grpc::ServerContext* context, ::uesynth::CaptureMultiRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::MultiImageResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_ListObjects : public BaseClass {
+  class WithAsyncMethod_Step : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_ListObjects() {
+    WithAsyncMethod_Step() {
       ::grpc::Service::MarkMethodAsync(16);
     }
-    ~WithAsyncMethod_ListObjects() override {
+    ~WithAsyncMethod_Step() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+    ::grpc::Status Step(::grpc::ServerContext* /*context*/, const ::uesynth::StepRequest* /*request*/, ::uesynth::StepResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestListObjects(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::ListObjectsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestStep(::grpc::ServerContext* context, ::uesynth::StepRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::StepResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithAsyncMethod_SetLighting : public BaseClass {
+  class WithAsyncMethod_SetLockstep : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithAsyncMethod_SetLighting() {
+    WithAsyncMethod_SetLockstep() {
       ::grpc::Service::MarkMethodAsync(17);
     }
-    ~WithAsyncMethod_SetLighting() override {
+    ~WithAsyncMethod_SetLockstep() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetLockstep(::grpc::ServerContext* /*context*/, const ::uesynth::SetLockstepRequest* /*request*/, ::uesynth::LockstepState* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetLighting(::grpc::ServerContext* context, ::uesynth::SetLightingRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+    void RequestSetLockstep(::grpc::ServerContext* context, ::uesynth::SetLockstepRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::LockstepState>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
       ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_ControlStream<WithAsyncMethod_SetCameraTransform<WithAsyncMethod_GetCameraTransform<WithAsyncMethod_CaptureRgbImage<WithAsyncMethod_CaptureDepthMap<WithAsyncMethod_CaptureSegmentationMask<WithAsyncMethod_SetObjectTransform<WithAsyncMethod_GetObjectTransform<WithAsyncMethod_CreateCamera<WithAsyncMethod_DestroyCamera<WithAsyncMethod_SetResolution<WithAsyncMethod_CaptureNormals<WithAsyncMethod_CaptureOpticalFlow<WithAsyncMethod_SpawnObject<WithAsyncMethod_DestroyObject<WithAsyncMethod_SetMaterial<WithAsyncMethod_ListObjects<WithAsyncMethod_SetLighting<Service > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
-  class WithCallbackMethod_ControlStream : public BaseClass {
+  class WithAsyncMethod_SpawnObject : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_ControlStream() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackBidiHandler< ::uesynth::ActionRequest, ::uesynth::FrameResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context) { return this->ControlStream(context); }));
+    WithAsyncMethod_SpawnObject() {
+      ::grpc::Service::MarkMethodAsync(18);
     }
-    ~WithCallbackMethod_ControlStream() override {
+    ~WithAsyncMethod_SpawnObject() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ControlStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::uesynth::FrameResponse, ::uesynth::ActionRequest>* /*stream*/)  override {
+    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::uesynth::ActionRequest, ::uesynth::FrameResponse>* ControlStream(
-      ::grpc::CallbackServerContext* /*context*/)
-      { return nullptr; }
+    void RequestSpawnObject(::grpc::ServerContext* context, ::uesynth::SpawnObjectRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SetCameraTransform : public BaseClass {
+  class WithAsyncMethod_PreloadAssets : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetCameraTransform() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::SetCameraTransformRequest* request, ::uesynth::CommandResponse* response) { return this->SetCameraTransform(context, request, response); }));}
-    void SetMessageAllocatorFor_SetCameraTransform(
-        ::grpc::MessageAllocator< ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_PreloadAssets() {
+      ::grpc::Service::MarkMethodAsync(19);
     }
-    ~WithCallbackMethod_SetCameraTransform() override {
+    ~WithAsyncMethod_PreloadAssets() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status PreloadAssets(::grpc::ServerContext* /*context*/, const ::uesynth::PreloadAssetsRequest* /*request*/, ::uesynth::PreloadAssetsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetCameraTransform(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    void RequestPreloadAssets(::grpc::ServerContext* context, ::uesynth::PreloadAssetsRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::PreloadAssetsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_GetCameraTransform : public BaseClass {
+  class WithAsyncMethod_DestroyObject : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_GetCameraTransform() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::GetCameraTransformRequest* request, ::uesynth::GetCameraTransformResponse* response) { return this->GetCameraTransform(context, request, response); }));}
-    void SetMessageAllocatorFor_GetCameraTransform(
-        ::grpc::MessageAllocator< ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_DestroyObject() {
+      ::grpc::Service::MarkMethodAsync(20);
     }
-    ~WithCallbackMethod_GetCameraTransform() override {
+    ~WithAsyncMethod_DestroyObject() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
+    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* GetCameraTransform(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/)  { return nullptr; }
+    void RequestDestroyObject(::grpc::ServerContext* context, ::uesynth::DestroyObjectRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_CaptureRgbImage : public BaseClass {
+  class WithAsyncMethod_ConfigureActorPool : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_CaptureRgbImage() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureRgbImage(context, request, response); }));}
-    void SetMessageAllocatorFor_CaptureRgbImage(
-        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_ConfigureActorPool() {
+      ::grpc::Service::MarkMethodAsync(21);
     }
-    ~WithCallbackMethod_CaptureRgbImage() override {
+    ~WithAsyncMethod_ConfigureActorPool() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status ConfigureActorPool(::grpc::ServerContext* /*context*/, const ::uesynth::ConfigureActorPoolRequest* /*request*/, ::uesynth::ActorPoolStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureRgbImage(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
+    void RequestConfigureActorPool(::grpc::ServerContext* context, ::uesynth::ConfigureActorPoolRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::ActorPoolStats>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_CaptureDepthMap : public BaseClass {
+  class WithAsyncMethod_SetMaterial : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_CaptureDepthMap() {
-      ::grpc::Service::MarkMethodCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureDepthMap(context, request, response); }));}
-    void SetMessageAllocatorFor_CaptureDepthMap(
-        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_SetMaterial() {
+      ::grpc::Service::MarkMethodAsync(22);
     }
-    ~WithCallbackMethod_CaptureDepthMap() override {
+    ~WithAsyncMethod_SetMaterial() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureDepthMap(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
+    void RequestSetMaterial(::grpc::ServerContext* context, ::uesynth::SetMaterialRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_CaptureSegmentationMask : public BaseClass {
+  class WithAsyncMethod_SetMaterialsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_CaptureSegmentationMask() {
-      ::grpc::Service::MarkMethodCallback(5,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureSegmentationMask(context, request, response); }));}
-    void SetMessageAllocatorFor_CaptureSegmentationMask(
-        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_SetMaterialsBatch() {
+      ::grpc::Service::MarkMethodAsync(23);
     }
-    ~WithCallbackMethod_CaptureSegmentationMask() override {
+    ~WithAsyncMethod_SetMaterialsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SetMaterialsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialsBatchRequest* /*request*/, ::uesynth::SetMaterialsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureSegmentationMask(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
+    void RequestSetMaterialsBatch(::grpc::ServerContext* context, ::uesynth::SetMaterialsBatchRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::SetMaterialsBatchResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SetObjectTransform : public BaseClass {
+  class WithAsyncMethod_ResolveMaterialParameters : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetObjectTransform() {
-      ::grpc::Service::MarkMethodCallback(6,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::SetObjectTransformRequest* request, ::uesynth::CommandResponse* response) { return this->SetObjectTransform(context, request, response); }));}
-    void SetMessageAllocatorFor_SetObjectTransform(
-        ::grpc::MessageAllocator< ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_ResolveMaterialParameters() {
+      ::grpc::Service::MarkMethodAsync(24);
     }
-    ~WithCallbackMethod_SetObjectTransform() override {
+    ~WithAsyncMethod_ResolveMaterialParameters() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status ResolveMaterialParameters(::grpc::ServerContext* /*context*/, const ::uesynth::ResolveMaterialParametersRequest* /*request*/, ::uesynth::MaterialParameterIds* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetObjectTransform(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    void RequestResolveMaterialParameters(::grpc::ServerContext* context, ::uesynth::ResolveMaterialParametersRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::MaterialParameterIds>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_GetObjectTransform : public BaseClass {
+  class WithAsyncMethod_ListObjects : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_GetObjectTransform() {
-      ::grpc::Service::MarkMethodCallback(7,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::GetObjectTransformRequest* request, ::uesynth::GetObjectTransformResponse* response) { return this->GetObjectTransform(context, request, response); }));}
-    void SetMessageAllocatorFor_GetObjectTransform(
-        ::grpc::MessageAllocator< ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_ListObjects() {
+      ::grpc::Service::MarkMethodAsync(25);
     }
-    ~WithCallbackMethod_GetObjectTransform() override {
+    ~WithAsyncMethod_ListObjects() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
+    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::uesynth::ListObjectsRequest* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* GetObjectTransform(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/)  { return nullptr; }
+    void RequestListObjects(::grpc::ServerContext* context, ::uesynth::ListObjectsRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::ListObjectsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_CreateCamera : public BaseClass {
+  class WithAsyncMethod_GetSceneSnapshot : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_CreateCamera() {
-      ::grpc::Service::MarkMethodCallback(8,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::CreateCameraRequest* request, ::uesynth::CommandResponse* response) { return this->CreateCamera(context, request, response); }));}
-    void SetMessageAllocatorFor_CreateCamera(
-        ::grpc::MessageAllocator< ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_GetSceneSnapshot() {
+      ::grpc::Service::MarkMethodAsync(26);
     }
-    ~WithCallbackMethod_CreateCamera() override {
+    ~WithAsyncMethod_GetSceneSnapshot() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status GetSceneSnapshot(::grpc::ServerContext* /*context*/, const ::uesynth::GetSceneSnapshotRequest* /*request*/, ::uesynth::SceneSnapshot* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CreateCamera(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    void RequestGetSceneSnapshot(::grpc::ServerContext* context, ::uesynth::GetSceneSnapshotRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::SceneSnapshot>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(26, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_DestroyCamera : public BaseClass {
+  class WithAsyncMethod_SetLighting : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_DestroyCamera() {
-      ::grpc::Service::MarkMethodCallback(9,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::DestroyCameraRequest* request, ::uesynth::CommandResponse* response) { return this->DestroyCamera(context, request, response); }));}
-    void SetMessageAllocatorFor_DestroyCamera(
-        ::grpc::MessageAllocator< ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_SetLighting() {
+      ::grpc::Service::MarkMethodAsync(27);
     }
-    ~WithCallbackMethod_DestroyCamera() override {
+    ~WithAsyncMethod_SetLighting() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* DestroyCamera(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    void RequestSetLighting(::grpc::ServerContext* context, ::uesynth::SetLightingRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::CommandResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(27, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SetResolution : public BaseClass {
+  class WithAsyncMethod_SetLightingBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetResolution() {
-      ::grpc::Service::MarkMethodCallback(10,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::SetResolutionRequest* request, ::uesynth::CommandResponse* response) { return this->SetResolution(context, request, response); }));}
-    void SetMessageAllocatorFor_SetResolution(
-        ::grpc::MessageAllocator< ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_SetLightingBatch() {
+      ::grpc::Service::MarkMethodAsync(28);
     }
-    ~WithCallbackMethod_SetResolution() override {
+    ~WithAsyncMethod_SetLightingBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetLightingBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingBatchRequest* /*request*/, ::uesynth::SetLightingBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetResolution(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    void RequestSetLightingBatch(::grpc::ServerContext* context, ::uesynth::SetLightingBatchRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::SetLightingBatchResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(28, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_CaptureNormals : public BaseClass {
+  class WithAsyncMethod_StartRecording : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_CaptureNormals() {
-      ::grpc::Service::MarkMethodCallback(11,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureNormals(context, request, response); }));}
-    void SetMessageAllocatorFor_CaptureNormals(
-        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_StartRecording() {
+      ::grpc::Service::MarkMethodAsync(29);
     }
-    ~WithCallbackMethod_CaptureNormals() override {
+    ~WithAsyncMethod_StartRecording() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status StartRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StartRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureNormals(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
+    void RequestStartRecording(::grpc::ServerContext* context, ::uesynth::StartRecordingRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::RecordingStats>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(29, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_CaptureOpticalFlow : public BaseClass {
+  class WithAsyncMethod_StopRecording : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_CaptureOpticalFlow() {
-      ::grpc::Service::MarkMethodCallback(12,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureOpticalFlow(context, request, response); }));}
-    void SetMessageAllocatorFor_CaptureOpticalFlow(
-        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_StopRecording() {
+      ::grpc::Service::MarkMethodAsync(30);
     }
-    ~WithCallbackMethod_CaptureOpticalFlow() override {
+    ~WithAsyncMethod_StopRecording() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status StopRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StopRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureOpticalFlow(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
+    void RequestStopRecording(::grpc::ServerContext* context, ::uesynth::StopRecordingRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::RecordingStats>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(30, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SpawnObject : public BaseClass {
+  class WithAsyncMethod_GetServerStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SpawnObject() {
-      ::grpc::Service::MarkMethodCallback(13,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::SpawnObjectRequest* request, ::uesynth::CommandResponse* response) { return this->SpawnObject(context, request, response); }));}
-    void SetMessageAllocatorFor_SpawnObject(
-        ::grpc::MessageAllocator< ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodAsync(31);
     }
-    ~WithCallbackMethod_SpawnObject() override {
+    ~WithAsyncMethod_GetServerStats() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::uesynth::GetServerStatsRequest* /*request*/, ::uesynth::ServerStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SpawnObject(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    void RequestGetServerStats(::grpc::ServerContext* context, ::uesynth::GetServerStatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::ServerStats>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(31, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_DestroyObject : public BaseClass {
+  class WithAsyncMethod_GetHealth : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_DestroyObject() {
-      ::grpc::Service::MarkMethodCallback(14,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::DestroyObjectRequest* request, ::uesynth::CommandResponse* response) { return this->DestroyObject(context, request, response); }));}
-    void SetMessageAllocatorFor_DestroyObject(
-        ::grpc::MessageAllocator< ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_GetHealth() {
+      ::grpc::Service::MarkMethodAsync(32);
     }
-    ~WithCallbackMethod_DestroyObject() override {
+    ~WithAsyncMethod_GetHealth() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status GetHealth(::grpc::ServerContext* /*context*/, const ::uesynth::HealthRequest* /*request*/, ::uesynth::HealthStatus* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* DestroyObject(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    void RequestGetHealth(::grpc::ServerContext* context, ::uesynth::HealthRequest* request, ::grpc::ServerAsyncResponseWriter< ::uesynth::HealthStatus>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(32, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
+  typedef WithAsyncMethod_ControlStream<WithAsyncMethod_SetCameraTransform<WithAsyncMethod_GetCameraTransform<WithAsyncMethod_CaptureRgbImage<WithAsyncMethod_CaptureDepthMap<WithAsyncMethod_CaptureSegmentationMask<WithAsyncMethod_SetObjectTransform<WithAsyncMethod_GetObjectTransform<WithAsyncMethod_SetObjectTransformsBatch<WithAsyncMethod_GetObjectTransformsBatch<WithAsyncMethod_CreateCamera<WithAsyncMethod_DestroyCamera<WithAsyncMethod_SetResolution<WithAsyncMethod_CaptureNormals<WithAsyncMethod_CaptureOpticalFlow<WithAsyncMethod_CaptureMulti<WithAsyncMethod_Step<WithAsyncMethod_SetLockstep<WithAsyncMethod_SpawnObject<WithAsyncMethod_PreloadAssets<WithAsyncMethod_DestroyObject<WithAsyncMethod_ConfigureActorPool<WithAsyncMethod_SetMaterial<WithAsyncMethod_SetMaterialsBatch<WithAsyncMethod_ResolveMaterialParameters<WithAsyncMethod_ListObjects<WithAsyncMethod_GetSceneSnapshot<WithAsyncMethod_SetLighting<WithAsyncMethod_SetLightingBatch<WithAsyncMethod_StartRecording<WithAsyncMethod_StopRecording<WithAsyncMethod_GetServerStats<WithAsyncMethod_GetHealth<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
-  class WithCallbackMethod_SetMaterial : public BaseClass {
+  class WithCallbackMethod_ControlStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetMaterial() {
-      ::grpc::Service::MarkMethodCallback(15,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>(
+    WithCallbackMethod_ControlStream() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackBidiHandler< ::uesynth::ActionRequest, ::uesynth::FrameResponse>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::SetMaterialRequest* request, ::uesynth::CommandResponse* response) { return this->SetMaterial(context, request, response); }));}
-    void SetMessageAllocatorFor_SetMaterial(
-        ::grpc::MessageAllocator< ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+                   ::grpc::CallbackServerContext* context) { return this->ControlStream(context); }));
     }
-    ~WithCallbackMethod_SetMaterial() override {
+    ~WithCallbackMethod_ControlStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status ControlStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::uesynth::FrameResponse, ::uesynth::ActionRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetMaterial(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerBidiReactor< ::uesynth::ActionRequest, ::uesynth::FrameResponse>* ControlStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithCallbackMethod_ListObjects : public BaseClass {
+  class WithCallbackMethod_SetCameraTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_ListObjects() {
-      ::grpc::Service::MarkMethodCallback(16,
-          new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::uesynth::ListObjectsResponse>(
+    WithCallbackMethod_SetCameraTransform() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::uesynth::ListObjectsResponse* response) { return this->ListObjects(context, request, response); }));}
-    void SetMessageAllocatorFor_ListObjects(
-        ::grpc::MessageAllocator< ::google::protobuf::Empty, ::uesynth::ListObjectsResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::uesynth::ListObjectsResponse>*>(handler)
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetCameraTransformRequest* request, ::uesynth::CommandResponse* response) { return this->SetCameraTransform(context, request, response); }));}
+    void SetMessageAllocatorFor_SetCameraTransform(
+        ::grpc::MessageAllocator< ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~WithCallbackMethod_ListObjects() override {
+    ~WithCallbackMethod_SetCameraTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* ListObjects(
-      ::grpc::CallbackServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::uesynth::ListObjectsResponse* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerUnaryReactor* SetCameraTransform(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SetLighting : public BaseClass {
+  class WithCallbackMethod_GetCameraTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetLighting() {
-      ::grpc::Service::MarkMethodCallback(17,
-          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>(
+    WithCallbackMethod_GetCameraTransform() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::uesynth::SetLightingRequest* request, ::uesynth::CommandResponse* response) { return this->SetLighting(context, request, response); }));}
-    void SetMessageAllocatorFor_SetLighting(
-        ::grpc::MessageAllocator< ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>*>(handler)
+                   ::grpc::CallbackServerContext* context, const ::uesynth::GetCameraTransformRequest* request, ::uesynth::GetCameraTransformResponse* response) { return this->GetCameraTransform(context, request, response); }));}
+    void SetMessageAllocatorFor_GetCameraTransform(
+        ::grpc::MessageAllocator< ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~WithCallbackMethod_SetLighting() override {
+    ~WithCallbackMethod_GetCameraTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetLighting(
-      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerUnaryReactor* GetCameraTransform(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_ControlStream<WithCallbackMethod_SetCameraTransform<WithCallbackMethod_GetCameraTransform<WithCallbackMethod_CaptureRgbImage<WithCallbackMethod_CaptureDepthMap<WithCallbackMethod_CaptureSegmentationMask<WithCallbackMethod_SetObjectTransform<WithCallbackMethod_GetObjectTransform<WithCallbackMethod_CreateCamera<WithCallbackMethod_DestroyCamera<WithCallbackMethod_SetResolution<WithCallbackMethod_CaptureNormals<WithCallbackMethod_CaptureOpticalFlow<WithCallbackMethod_SpawnObject<WithCallbackMethod_DestroyObject<WithCallbackMethod_SetMaterial<WithCallbackMethod_ListObjects<WithCallbackMethod_SetLighting<Service > > > > > > > > > > > > > > > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
-  class WithGenericMethod_ControlStream : public BaseClass {
+  class WithCallbackMethod_CaptureRgbImage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ControlStream() {
-      ::grpc::Service::MarkMethodGeneric(0);
+    WithCallbackMethod_CaptureRgbImage() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureRgbImage(context, request, response); }));}
+    void SetMessageAllocatorFor_CaptureRgbImage(
+        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_ControlStream() override {
+    ~WithCallbackMethod_CaptureRgbImage() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ControlStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::uesynth::FrameResponse, ::uesynth::ActionRequest>* /*stream*/)  override {
+    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* CaptureRgbImage(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SetCameraTransform : public BaseClass {
+  class WithCallbackMethod_CaptureDepthMap : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetCameraTransform() {
-      ::grpc::Service::MarkMethodGeneric(1);
+    WithCallbackMethod_CaptureDepthMap() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureDepthMap(context, request, response); }));}
+    void SetMessageAllocatorFor_CaptureDepthMap(
+        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SetCameraTransform() override {
+    ~WithCallbackMethod_CaptureDepthMap() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* CaptureDepthMap(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_GetCameraTransform : public BaseClass {
+  class WithCallbackMethod_CaptureSegmentationMask : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_GetCameraTransform() {
-      ::grpc::Service::MarkMethodGeneric(2);
-    }
-    ~WithGenericMethod_GetCameraTransform() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_CaptureRgbImage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_CaptureRgbImage() {
-      ::grpc::Service::MarkMethodGeneric(3);
+    WithCallbackMethod_CaptureSegmentationMask() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureSegmentationMask(context, request, response); }));}
+    void SetMessageAllocatorFor_CaptureSegmentationMask(
+        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_CaptureRgbImage() override {
+    ~WithCallbackMethod_CaptureSegmentationMask() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* CaptureSegmentationMask(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_CaptureDepthMap : public BaseClass {
+  class WithCallbackMethod_SetObjectTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_CaptureDepthMap() {
-      ::grpc::Service::MarkMethodGeneric(4);
+    WithCallbackMethod_SetObjectTransform() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetObjectTransformRequest* request, ::uesynth::CommandResponse* response) { return this->SetObjectTransform(context, request, response); }));}
+    void SetMessageAllocatorFor_SetObjectTransform(
+        ::grpc::MessageAllocator< ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_CaptureDepthMap() override {
+    ~WithCallbackMethod_SetObjectTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SetObjectTransform(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_CaptureSegmentationMask : public BaseClass {
+  class WithCallbackMethod_GetObjectTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_CaptureSegmentationMask() {
-      ::grpc::Service::MarkMethodGeneric(5);
+    WithCallbackMethod_GetObjectTransform() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::GetObjectTransformRequest* request, ::uesynth::GetObjectTransformResponse* response) { return this->GetObjectTransform(context, request, response); }));}
+    void SetMessageAllocatorFor_GetObjectTransform(
+        ::grpc::MessageAllocator< ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_CaptureSegmentationMask() override {
+    ~WithCallbackMethod_GetObjectTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* GetObjectTransform(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SetObjectTransform : public BaseClass {
+  class WithCallbackMethod_SetObjectTransformsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetObjectTransform() {
-      ::grpc::Service::MarkMethodGeneric(6);
+    WithCallbackMethod_SetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetObjectTransformsBatchRequest, ::uesynth::SetObjectTransformsBatchResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetObjectTransformsBatchRequest* request, ::uesynth::SetObjectTransformsBatchResponse* response) { return this->SetObjectTransformsBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_SetObjectTransformsBatch(
+        ::grpc::MessageAllocator< ::uesynth::SetObjectTransformsBatchRequest, ::uesynth::SetObjectTransformsBatchResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetObjectTransformsBatchRequest, ::uesynth::SetObjectTransformsBatchResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SetObjectTransform() override {
+    ~WithCallbackMethod_SetObjectTransformsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformsBatchRequest* /*request*/, ::uesynth::SetObjectTransformsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SetObjectTransformsBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetObjectTransformsBatchRequest* /*request*/, ::uesynth::SetObjectTransformsBatchResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_GetObjectTransform : public BaseClass {
+  class WithCallbackMethod_GetObjectTransformsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_GetObjectTransform() {
-      ::grpc::Service::MarkMethodGeneric(7);
+    WithCallbackMethod_GetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::GetObjectTransformsBatchRequest, ::uesynth::GetObjectTransformsBatchResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::GetObjectTransformsBatchRequest* request, ::uesynth::GetObjectTransformsBatchResponse* response) { return this->GetObjectTransformsBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_GetObjectTransformsBatch(
+        ::grpc::MessageAllocator< ::uesynth::GetObjectTransformsBatchRequest, ::uesynth::GetObjectTransformsBatchResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::GetObjectTransformsBatchRequest, ::uesynth::GetObjectTransformsBatchResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_GetObjectTransform() override {
+    ~WithCallbackMethod_GetObjectTransformsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
+    ::grpc::Status GetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformsBatchRequest* /*request*/, ::uesynth::GetObjectTransformsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* GetObjectTransformsBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::GetObjectTransformsBatchRequest* /*request*/, ::uesynth::GetObjectTransformsBatchResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_CreateCamera : public BaseClass {
+  class WithCallbackMethod_CreateCamera : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_CreateCamera() {
-      ::grpc::Service::MarkMethodGeneric(8);
+    WithCallbackMethod_CreateCamera() {
+      ::grpc::Service::MarkMethodCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::CreateCameraRequest* request, ::uesynth::CommandResponse* response) { return this->CreateCamera(context, request, response); }));}
+    void SetMessageAllocatorFor_CreateCamera(
+        ::grpc::MessageAllocator< ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_CreateCamera() override {
+    ~WithCallbackMethod_CreateCamera() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -1537,16 +1908,26 @@ class UESynthService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* CreateCamera(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_DestroyCamera : public BaseClass {
+  class WithCallbackMethod_DestroyCamera : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_DestroyCamera() {
-      ::grpc::Service::MarkMethodGeneric(9);
+    WithCallbackMethod_DestroyCamera() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::DestroyCameraRequest* request, ::uesynth::CommandResponse* response) { return this->DestroyCamera(context, request, response); }));}
+    void SetMessageAllocatorFor_DestroyCamera(
+        ::grpc::MessageAllocator< ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_DestroyCamera() override {
+    ~WithCallbackMethod_DestroyCamera() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -1554,16 +1935,26 @@ class UESynthService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* DestroyCamera(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SetResolution : public BaseClass {
+  class WithCallbackMethod_SetResolution : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetResolution() {
-      ::grpc::Service::MarkMethodGeneric(10);
+    WithCallbackMethod_SetResolution() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetResolutionRequest* request, ::uesynth::CommandResponse* response) { return this->SetResolution(context, request, response); }));}
+    void SetMessageAllocatorFor_SetResolution(
+        ::grpc::MessageAllocator< ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SetResolution() override {
+    ~WithCallbackMethod_SetResolution() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -1571,16 +1962,26 @@ class UESynthService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SetResolution(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_CaptureNormals : public BaseClass {
+  class WithCallbackMethod_CaptureNormals : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_CaptureNormals() {
-      ::grpc::Service::MarkMethodGeneric(11);
+    WithCallbackMethod_CaptureNormals() {
+      ::grpc::Service::MarkMethodCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureNormals(context, request, response); }));}
+    void SetMessageAllocatorFor_CaptureNormals(
+        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_CaptureNormals() override {
+    ~WithCallbackMethod_CaptureNormals() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -1588,16 +1989,26 @@ class UESynthService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* CaptureNormals(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_CaptureOpticalFlow : public BaseClass {
+  class WithCallbackMethod_CaptureOpticalFlow : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_CaptureOpticalFlow() {
-      ::grpc::Service::MarkMethodGeneric(12);
+    WithCallbackMethod_CaptureOpticalFlow() {
+      ::grpc::Service::MarkMethodCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureRequest* request, ::uesynth::ImageResponse* response) { return this->CaptureOpticalFlow(context, request, response); }));}
+    void SetMessageAllocatorFor_CaptureOpticalFlow(
+        ::grpc::MessageAllocator< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureRequest, ::uesynth::ImageResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_CaptureOpticalFlow() override {
+    ~WithCallbackMethod_CaptureOpticalFlow() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -1605,751 +2016,812 @@ class UESynthService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* CaptureOpticalFlow(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SpawnObject : public BaseClass {
+  class WithCallbackMethod_CaptureMulti : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SpawnObject() {
-      ::grpc::Service::MarkMethodGeneric(13);
+    WithCallbackMethod_CaptureMulti() {
+      ::grpc::Service::MarkMethodCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureMultiRequest, ::uesynth::MultiImageResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::CaptureMultiRequest* request, ::uesynth::MultiImageResponse* response) { return this->CaptureMulti(context, request, response); }));}
+    void SetMessageAllocatorFor_CaptureMulti(
+        ::grpc::MessageAllocator< ::uesynth::CaptureMultiRequest, ::uesynth::MultiImageResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::CaptureMultiRequest, ::uesynth::MultiImageResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SpawnObject() override {
+    ~WithCallbackMethod_CaptureMulti() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureMulti(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureMultiRequest* /*request*/, ::uesynth::MultiImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* CaptureMulti(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::CaptureMultiRequest* /*request*/, ::uesynth::MultiImageResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_DestroyObject : public BaseClass {
+  class WithCallbackMethod_Step : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_DestroyObject() {
-      ::grpc::Service::MarkMethodGeneric(14);
+    WithCallbackMethod_Step() {
+      ::grpc::Service::MarkMethodCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::StepRequest, ::uesynth::StepResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::StepRequest* request, ::uesynth::StepResponse* response) { return this->Step(context, request, response); }));}
+    void SetMessageAllocatorFor_Step(
+        ::grpc::MessageAllocator< ::uesynth::StepRequest, ::uesynth::StepResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::StepRequest, ::uesynth::StepResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_DestroyObject() override {
+    ~WithCallbackMethod_Step() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status Step(::grpc::ServerContext* /*context*/, const ::uesynth::StepRequest* /*request*/, ::uesynth::StepResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* Step(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::StepRequest* /*request*/, ::uesynth::StepResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SetMaterial : public BaseClass {
+  class WithCallbackMethod_SetLockstep : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetMaterial() {
-      ::grpc::Service::MarkMethodGeneric(15);
+    WithCallbackMethod_SetLockstep() {
+      ::grpc::Service::MarkMethodCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetLockstepRequest, ::uesynth::LockstepState>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetLockstepRequest* request, ::uesynth::LockstepState* response) { return this->SetLockstep(context, request, response); }));}
+    void SetMessageAllocatorFor_SetLockstep(
+        ::grpc::MessageAllocator< ::uesynth::SetLockstepRequest, ::uesynth::LockstepState>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetLockstepRequest, ::uesynth::LockstepState>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SetMaterial() override {
+    ~WithCallbackMethod_SetLockstep() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetLockstep(::grpc::ServerContext* /*context*/, const ::uesynth::SetLockstepRequest* /*request*/, ::uesynth::LockstepState* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SetLockstep(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetLockstepRequest* /*request*/, ::uesynth::LockstepState* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_ListObjects : public BaseClass {
+  class WithCallbackMethod_SpawnObject : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ListObjects() {
-      ::grpc::Service::MarkMethodGeneric(16);
+    WithCallbackMethod_SpawnObject() {
+      ::grpc::Service::MarkMethodCallback(18,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SpawnObjectRequest* request, ::uesynth::CommandResponse* response) { return this->SpawnObject(context, request, response); }));}
+    void SetMessageAllocatorFor_SpawnObject(
+        ::grpc::MessageAllocator< ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(18);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_ListObjects() override {
+    ~WithCallbackMethod_SpawnObject() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SpawnObject(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SetLighting : public BaseClass {
+  class WithCallbackMethod_PreloadAssets : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetLighting() {
-      ::grpc::Service::MarkMethodGeneric(17);
+    WithCallbackMethod_PreloadAssets() {
+      ::grpc::Service::MarkMethodCallback(19,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::PreloadAssetsRequest, ::uesynth::PreloadAssetsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::PreloadAssetsRequest* request, ::uesynth::PreloadAssetsResponse* response) { return this->PreloadAssets(context, request, response); }));}
+    void SetMessageAllocatorFor_PreloadAssets(
+        ::grpc::MessageAllocator< ::uesynth::PreloadAssetsRequest, ::uesynth::PreloadAssetsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(19);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::PreloadAssetsRequest, ::uesynth::PreloadAssetsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SetLighting() override {
+    ~WithCallbackMethod_PreloadAssets() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status PreloadAssets(::grpc::ServerContext* /*context*/, const ::uesynth::PreloadAssetsRequest* /*request*/, ::uesynth::PreloadAssetsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* PreloadAssets(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::PreloadAssetsRequest* /*request*/, ::uesynth::PreloadAssetsResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_ControlStream : public BaseClass {
+  class WithCallbackMethod_DestroyObject : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ControlStream() {
-      ::grpc::Service::MarkMethodRaw(0);
+    WithCallbackMethod_DestroyObject() {
+      ::grpc::Service::MarkMethodCallback(20,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::DestroyObjectRequest* request, ::uesynth::CommandResponse* response) { return this->DestroyObject(context, request, response); }));}
+    void SetMessageAllocatorFor_DestroyObject(
+        ::grpc::MessageAllocator< ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(20);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_ControlStream() override {
+    ~WithCallbackMethod_DestroyObject() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ControlStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::uesynth::FrameResponse, ::uesynth::ActionRequest>* /*stream*/)  override {
+    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestControlStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* DestroyObject(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SetCameraTransform : public BaseClass {
+  class WithCallbackMethod_ConfigureActorPool : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetCameraTransform() {
-      ::grpc::Service::MarkMethodRaw(1);
+    WithCallbackMethod_ConfigureActorPool() {
+      ::grpc::Service::MarkMethodCallback(21,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::ConfigureActorPoolRequest, ::uesynth::ActorPoolStats>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::ConfigureActorPoolRequest* request, ::uesynth::ActorPoolStats* response) { return this->ConfigureActorPool(context, request, response); }));}
+    void SetMessageAllocatorFor_ConfigureActorPool(
+        ::grpc::MessageAllocator< ::uesynth::ConfigureActorPoolRequest, ::uesynth::ActorPoolStats>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(21);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::ConfigureActorPoolRequest, ::uesynth::ActorPoolStats>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_SetCameraTransform() override {
+    ~WithCallbackMethod_ConfigureActorPool() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status ConfigureActorPool(::grpc::ServerContext* /*context*/, const ::uesynth::ConfigureActorPoolRequest* /*request*/, ::uesynth::ActorPoolStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetCameraTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* ConfigureActorPool(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::ConfigureActorPoolRequest* /*request*/, ::uesynth::ActorPoolStats* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_GetCameraTransform : public BaseClass {
+  class WithCallbackMethod_SetMaterial : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_GetCameraTransform() {
-      ::grpc::Service::MarkMethodRaw(2);
+    WithCallbackMethod_SetMaterial() {
+      ::grpc::Service::MarkMethodCallback(22,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetMaterialRequest* request, ::uesynth::CommandResponse* response) { return this->SetMaterial(context, request, response); }));}
+    void SetMessageAllocatorFor_SetMaterial(
+        ::grpc::MessageAllocator< ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(22);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_GetCameraTransform() override {
+    ~WithCallbackMethod_SetMaterial() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
+    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestGetCameraTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* SetMaterial(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_CaptureRgbImage : public BaseClass {
+  class WithCallbackMethod_SetMaterialsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_CaptureRgbImage() {
-      ::grpc::Service::MarkMethodRaw(3);
+    WithCallbackMethod_SetMaterialsBatch() {
+      ::grpc::Service::MarkMethodCallback(23,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetMaterialsBatchRequest, ::uesynth::SetMaterialsBatchResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetMaterialsBatchRequest* request, ::uesynth::SetMaterialsBatchResponse* response) { return this->SetMaterialsBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_SetMaterialsBatch(
+        ::grpc::MessageAllocator< ::uesynth::SetMaterialsBatchRequest, ::uesynth::SetMaterialsBatchResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(23);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetMaterialsBatchRequest, ::uesynth::SetMaterialsBatchResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_CaptureRgbImage() override {
+    ~WithCallbackMethod_SetMaterialsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SetMaterialsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialsBatchRequest* /*request*/, ::uesynth::SetMaterialsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCaptureRgbImage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* SetMaterialsBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetMaterialsBatchRequest* /*request*/, ::uesynth::SetMaterialsBatchResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_CaptureDepthMap : public BaseClass {
+  class WithCallbackMethod_ResolveMaterialParameters : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_CaptureDepthMap() {
-      ::grpc::Service::MarkMethodRaw(4);
+    WithCallbackMethod_ResolveMaterialParameters() {
+      ::grpc::Service::MarkMethodCallback(24,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::ResolveMaterialParametersRequest, ::uesynth::MaterialParameterIds>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::ResolveMaterialParametersRequest* request, ::uesynth::MaterialParameterIds* response) { return this->ResolveMaterialParameters(context, request, response); }));}
+    void SetMessageAllocatorFor_ResolveMaterialParameters(
+        ::grpc::MessageAllocator< ::uesynth::ResolveMaterialParametersRequest, ::uesynth::MaterialParameterIds>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(24);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::ResolveMaterialParametersRequest, ::uesynth::MaterialParameterIds>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_CaptureDepthMap() override {
+    ~WithCallbackMethod_ResolveMaterialParameters() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status ResolveMaterialParameters(::grpc::ServerContext* /*context*/, const ::uesynth::ResolveMaterialParametersRequest* /*request*/, ::uesynth::MaterialParameterIds* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCaptureDepthMap(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* ResolveMaterialParameters(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::ResolveMaterialParametersRequest* /*request*/, ::uesynth::MaterialParameterIds* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_CaptureSegmentationMask : public BaseClass {
+  class WithCallbackMethod_ListObjects : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_CaptureSegmentationMask() {
-      ::grpc::Service::MarkMethodRaw(5);
+    WithCallbackMethod_ListObjects() {
+      ::grpc::Service::MarkMethodCallback(25,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::ListObjectsRequest, ::uesynth::ListObjectsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::ListObjectsRequest* request, ::uesynth::ListObjectsResponse* response) { return this->ListObjects(context, request, response); }));}
+    void SetMessageAllocatorFor_ListObjects(
+        ::grpc::MessageAllocator< ::uesynth::ListObjectsRequest, ::uesynth::ListObjectsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(25);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::ListObjectsRequest, ::uesynth::ListObjectsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_CaptureSegmentationMask() override {
+    ~WithCallbackMethod_ListObjects() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::uesynth::ListObjectsRequest* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCaptureSegmentationMask(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* ListObjects(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::ListObjectsRequest* /*request*/, ::uesynth::ListObjectsResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SetObjectTransform : public BaseClass {
+  class WithCallbackMethod_GetSceneSnapshot : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetObjectTransform() {
-      ::grpc::Service::MarkMethodRaw(6);
+    WithCallbackMethod_GetSceneSnapshot() {
+      ::grpc::Service::MarkMethodCallback(26,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::GetSceneSnapshotRequest, ::uesynth::SceneSnapshot>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::GetSceneSnapshotRequest* request, ::uesynth::SceneSnapshot* response) { return this->GetSceneSnapshot(context, request, response); }));}
+    void SetMessageAllocatorFor_GetSceneSnapshot(
+        ::grpc::MessageAllocator< ::uesynth::GetSceneSnapshotRequest, ::uesynth::SceneSnapshot>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(26);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::GetSceneSnapshotRequest, ::uesynth::SceneSnapshot>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_SetObjectTransform() override {
+    ~WithCallbackMethod_GetSceneSnapshot() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status GetSceneSnapshot(::grpc::ServerContext* /*context*/, const ::uesynth::GetSceneSnapshotRequest* /*request*/, ::uesynth::SceneSnapshot* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetObjectTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* GetSceneSnapshot(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::GetSceneSnapshotRequest* /*request*/, ::uesynth::SceneSnapshot* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_GetObjectTransform : public BaseClass {
+  class WithCallbackMethod_SetLighting : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_GetObjectTransform() {
-      ::grpc::Service::MarkMethodRaw(7);
+    WithCallbackMethod_SetLighting() {
+      ::grpc::Service::MarkMethodCallback(27,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetLightingRequest* request, ::uesynth::CommandResponse* response) { return this->SetLighting(context, request, response); }));}
+    void SetMessageAllocatorFor_SetLighting(
+        ::grpc::MessageAllocator< ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(27);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_GetObjectTransform() override {
+    ~WithCallbackMethod_SetLighting() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
+    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestGetObjectTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* SetLighting(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_CreateCamera : public BaseClass {
+  class WithCallbackMethod_SetLightingBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_CreateCamera() {
-      ::grpc::Service::MarkMethodRaw(8);
+    WithCallbackMethod_SetLightingBatch() {
+      ::grpc::Service::MarkMethodCallback(28,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::SetLightingBatchRequest, ::uesynth::SetLightingBatchResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::SetLightingBatchRequest* request, ::uesynth::SetLightingBatchResponse* response) { return this->SetLightingBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_SetLightingBatch(
+        ::grpc::MessageAllocator< ::uesynth::SetLightingBatchRequest, ::uesynth::SetLightingBatchResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(28);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::SetLightingBatchRequest, ::uesynth::SetLightingBatchResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_CreateCamera() override {
+    ~WithCallbackMethod_SetLightingBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetLightingBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingBatchRequest* /*request*/, ::uesynth::SetLightingBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCreateCamera(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* SetLightingBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::SetLightingBatchRequest* /*request*/, ::uesynth::SetLightingBatchResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_DestroyCamera : public BaseClass {
+  class WithCallbackMethod_StartRecording : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_DestroyCamera() {
-      ::grpc::Service::MarkMethodRaw(9);
+    WithCallbackMethod_StartRecording() {
+      ::grpc::Service::MarkMethodCallback(29,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::StartRecordingRequest, ::uesynth::RecordingStats>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::StartRecordingRequest* request, ::uesynth::RecordingStats* response) { return this->StartRecording(context, request, response); }));}
+    void SetMessageAllocatorFor_StartRecording(
+        ::grpc::MessageAllocator< ::uesynth::StartRecordingRequest, ::uesynth::RecordingStats>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(29);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::StartRecordingRequest, ::uesynth::RecordingStats>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_DestroyCamera() override {
+    ~WithCallbackMethod_StartRecording() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status StartRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StartRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestDestroyCamera(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* StartRecording(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::StartRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SetResolution : public BaseClass {
+  class WithCallbackMethod_StopRecording : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetResolution() {
-      ::grpc::Service::MarkMethodRaw(10);
+    WithCallbackMethod_StopRecording() {
+      ::grpc::Service::MarkMethodCallback(30,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::StopRecordingRequest, ::uesynth::RecordingStats>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::StopRecordingRequest* request, ::uesynth::RecordingStats* response) { return this->StopRecording(context, request, response); }));}
+    void SetMessageAllocatorFor_StopRecording(
+        ::grpc::MessageAllocator< ::uesynth::StopRecordingRequest, ::uesynth::RecordingStats>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(30);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::StopRecordingRequest, ::uesynth::RecordingStats>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_SetResolution() override {
+    ~WithCallbackMethod_StopRecording() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status StopRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StopRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetResolution(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* StopRecording(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::StopRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_CaptureNormals : public BaseClass {
+  class WithCallbackMethod_GetServerStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_CaptureNormals() {
-      ::grpc::Service::MarkMethodRaw(11);
+    WithCallbackMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodCallback(31,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::GetServerStatsRequest, ::uesynth::ServerStats>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::GetServerStatsRequest* request, ::uesynth::ServerStats* response) { return this->GetServerStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetServerStats(
+        ::grpc::MessageAllocator< ::uesynth::GetServerStatsRequest, ::uesynth::ServerStats>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(31);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::GetServerStatsRequest, ::uesynth::ServerStats>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_CaptureNormals() override {
+    ~WithCallbackMethod_GetServerStats() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::uesynth::GetServerStatsRequest* /*request*/, ::uesynth::ServerStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCaptureNormals(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* GetServerStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::GetServerStatsRequest* /*request*/, ::uesynth::ServerStats* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_CaptureOpticalFlow : public BaseClass {
+  class WithCallbackMethod_GetHealth : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_CaptureOpticalFlow() {
-      ::grpc::Service::MarkMethodRaw(12);
+    WithCallbackMethod_GetHealth() {
+      ::grpc::Service::MarkMethodCallback(32,
+          new ::grpc::internal::CallbackUnaryHandler< ::uesynth::HealthRequest, ::uesynth::HealthStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::uesynth::HealthRequest* request, ::uesynth::HealthStatus* response) { return this->GetHealth(context, request, response); }));}
+    void SetMessageAllocatorFor_GetHealth(
+        ::grpc::MessageAllocator< ::uesynth::HealthRequest, ::uesynth::HealthStatus>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(32);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::uesynth::HealthRequest, ::uesynth::HealthStatus>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_CaptureOpticalFlow() override {
+    ~WithCallbackMethod_GetHealth() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status GetHealth(::grpc::ServerContext* /*context*/, const ::uesynth::HealthRequest* /*request*/, ::uesynth::HealthStatus* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCaptureOpticalFlow(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* GetHealth(
+      ::grpc::CallbackServerContext* /*context*/, const ::uesynth::HealthRequest* /*request*/, ::uesynth::HealthStatus* /*response*/)  { return nullptr; }
   };
+  typedef WithCallbackMethod_ControlStream<WithCallbackMethod_SetCameraTransform<WithCallbackMethod_GetCameraTransform<WithCallbackMethod_CaptureRgbImage<WithCallbackMethod_CaptureDepthMap<WithCallbackMethod_CaptureSegmentationMask<WithCallbackMethod_SetObjectTransform<WithCallbackMethod_GetObjectTransform<WithCallbackMethod_SetObjectTransformsBatch<WithCallbackMethod_GetObjectTransformsBatch<WithCallbackMethod_CreateCamera<WithCallbackMethod_DestroyCamera<WithCallbackMethod_SetResolution<WithCallbackMethod_CaptureNormals<WithCallbackMethod_CaptureOpticalFlow<WithCallbackMethod_CaptureMulti<WithCallbackMethod_Step<WithCallbackMethod_SetLockstep<WithCallbackMethod_SpawnObject<WithCallbackMethod_PreloadAssets<WithCallbackMethod_DestroyObject<WithCallbackMethod_ConfigureActorPool<WithCallbackMethod_SetMaterial<WithCallbackMethod_SetMaterialsBatch<WithCallbackMethod_ResolveMaterialParameters<WithCallbackMethod_ListObjects<WithCallbackMethod_GetSceneSnapshot<WithCallbackMethod_SetLighting<WithCallbackMethod_SetLightingBatch<WithCallbackMethod_StartRecording<WithCallbackMethod_StopRecording<WithCallbackMethod_GetServerStats<WithCallbackMethod_GetHealth<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
-  class WithRawMethod_SpawnObject : public BaseClass {
+  class WithGenericMethod_ControlStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SpawnObject() {
-      ::grpc::Service::MarkMethodRaw(13);
+    WithGenericMethod_ControlStream() {
+      ::grpc::Service::MarkMethodGeneric(0);
     }
-    ~WithRawMethod_SpawnObject() override {
+    ~WithGenericMethod_ControlStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status ControlStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::uesynth::FrameResponse, ::uesynth::ActionRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSpawnObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawMethod_DestroyObject : public BaseClass {
+  class WithGenericMethod_SetCameraTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_DestroyObject() {
-      ::grpc::Service::MarkMethodRaw(14);
+    WithGenericMethod_SetCameraTransform() {
+      ::grpc::Service::MarkMethodGeneric(1);
     }
-    ~WithRawMethod_DestroyObject() override {
+    ~WithGenericMethod_SetCameraTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestDestroyObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawMethod_SetMaterial : public BaseClass {
+  class WithGenericMethod_GetCameraTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetMaterial() {
-      ::grpc::Service::MarkMethodRaw(15);
+    WithGenericMethod_GetCameraTransform() {
+      ::grpc::Service::MarkMethodGeneric(2);
     }
-    ~WithRawMethod_SetMaterial() override {
+    ~WithGenericMethod_GetCameraTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetMaterial(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawMethod_ListObjects : public BaseClass {
+  class WithGenericMethod_CaptureRgbImage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ListObjects() {
-      ::grpc::Service::MarkMethodRaw(16);
+    WithGenericMethod_CaptureRgbImage() {
+      ::grpc::Service::MarkMethodGeneric(3);
     }
-    ~WithRawMethod_ListObjects() override {
+    ~WithGenericMethod_CaptureRgbImage() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestListObjects(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawMethod_SetLighting : public BaseClass {
+  class WithGenericMethod_CaptureDepthMap : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetLighting() {
-      ::grpc::Service::MarkMethodRaw(17);
+    WithGenericMethod_CaptureDepthMap() {
+      ::grpc::Service::MarkMethodGeneric(4);
     }
-    ~WithRawMethod_SetLighting() override {
+    ~WithGenericMethod_CaptureDepthMap() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetLighting(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_ControlStream : public BaseClass {
+  class WithGenericMethod_CaptureSegmentationMask : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_ControlStream() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context) { return this->ControlStream(context); }));
+    WithGenericMethod_CaptureSegmentationMask() {
+      ::grpc::Service::MarkMethodGeneric(5);
     }
-    ~WithRawCallbackMethod_ControlStream() override {
+    ~WithGenericMethod_CaptureSegmentationMask() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ControlStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::uesynth::FrameResponse, ::uesynth::ActionRequest>* /*stream*/)  override {
+    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ControlStream(
-      ::grpc::CallbackServerContext* /*context*/)
-      { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetCameraTransform : public BaseClass {
+  class WithGenericMethod_SetObjectTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetCameraTransform() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetCameraTransform(context, request, response); }));
+    WithGenericMethod_SetObjectTransform() {
+      ::grpc::Service::MarkMethodGeneric(6);
     }
-    ~WithRawCallbackMethod_SetCameraTransform() override {
+    ~WithGenericMethod_SetObjectTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetCameraTransform(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_GetCameraTransform : public BaseClass {
+  class WithGenericMethod_GetObjectTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_GetCameraTransform() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetCameraTransform(context, request, response); }));
+    WithGenericMethod_GetObjectTransform() {
+      ::grpc::Service::MarkMethodGeneric(7);
     }
-    ~WithRawCallbackMethod_GetCameraTransform() override {
+    ~WithGenericMethod_GetObjectTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
+    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* GetCameraTransform(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_CaptureRgbImage : public BaseClass {
+  class WithGenericMethod_SetObjectTransformsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_CaptureRgbImage() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureRgbImage(context, request, response); }));
+    WithGenericMethod_SetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodGeneric(8);
     }
-    ~WithRawCallbackMethod_CaptureRgbImage() override {
+    ~WithGenericMethod_SetObjectTransformsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformsBatchRequest* /*request*/, ::uesynth::SetObjectTransformsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureRgbImage(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_CaptureDepthMap : public BaseClass {
+  class WithGenericMethod_GetObjectTransformsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_CaptureDepthMap() {
-      ::grpc::Service::MarkMethodRawCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureDepthMap(context, request, response); }));
+    WithGenericMethod_GetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodGeneric(9);
     }
-    ~WithRawCallbackMethod_CaptureDepthMap() override {
+    ~WithGenericMethod_GetObjectTransformsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status GetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformsBatchRequest* /*request*/, ::uesynth::GetObjectTransformsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureDepthMap(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_CaptureSegmentationMask : public BaseClass {
+  class WithGenericMethod_CreateCamera : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_CaptureSegmentationMask() {
-      ::grpc::Service::MarkMethodRawCallback(5,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureSegmentationMask(context, request, response); }));
+    WithGenericMethod_CreateCamera() {
+      ::grpc::Service::MarkMethodGeneric(10);
     }
-    ~WithRawCallbackMethod_CaptureSegmentationMask() override {
+    ~WithGenericMethod_CreateCamera() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureSegmentationMask(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetObjectTransform : public BaseClass {
+  class WithGenericMethod_DestroyCamera : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetObjectTransform() {
-      ::grpc::Service::MarkMethodRawCallback(6,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetObjectTransform(context, request, response); }));
+    WithGenericMethod_DestroyCamera() {
+      ::grpc::Service::MarkMethodGeneric(11);
     }
-    ~WithRawCallbackMethod_SetObjectTransform() override {
+    ~WithGenericMethod_DestroyCamera() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetObjectTransform(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_GetObjectTransform : public BaseClass {
+  class WithGenericMethod_SetResolution : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_GetObjectTransform() {
-      ::grpc::Service::MarkMethodRawCallback(7,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetObjectTransform(context, request, response); }));
+    WithGenericMethod_SetResolution() {
+      ::grpc::Service::MarkMethodGeneric(12);
     }
-    ~WithRawCallbackMethod_GetObjectTransform() override {
+    ~WithGenericMethod_SetResolution() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
+    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* GetObjectTransform(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_CreateCamera : public BaseClass {
+  class WithGenericMethod_CaptureNormals : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_CreateCamera() {
-      ::grpc::Service::MarkMethodRawCallback(8,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CreateCamera(context, request, response); }));
+    WithGenericMethod_CaptureNormals() {
+      ::grpc::Service::MarkMethodGeneric(13);
     }
-    ~WithRawCallbackMethod_CreateCamera() override {
+    ~WithGenericMethod_CaptureNormals() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CreateCamera(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_DestroyCamera : public BaseClass {
+  class WithGenericMethod_CaptureOpticalFlow : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_DestroyCamera() {
-      ::grpc::Service::MarkMethodRawCallback(9,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->DestroyCamera(context, request, response); }));
+    WithGenericMethod_CaptureOpticalFlow() {
+      ::grpc::Service::MarkMethodGeneric(14);
     }
-    ~WithRawCallbackMethod_DestroyCamera() override {
+    ~WithGenericMethod_CaptureOpticalFlow() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* DestroyCamera(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetResolution : public BaseClass {
+  class WithGenericMethod_CaptureMulti : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetResolution() {
-      ::grpc::Service::MarkMethodRawCallback(10,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetResolution(context, request, response); }));
+    WithGenericMethod_CaptureMulti() {
+      ::grpc::Service::MarkMethodGeneric(15);
     }
-    ~WithRawCallbackMethod_SetResolution() override {
+    ~WithGenericMethod_CaptureMulti() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status CaptureMulti(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureMultiRequest* /*request*/, ::uesynth::MultiImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetResolution(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_CaptureNormals : public BaseClass {
+  class WithGenericMethod_Step : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_CaptureNormals() {
-      ::grpc::Service::MarkMethodRawCallback(11,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureNormals(context, request, response); }));
+    WithGenericMethod_Step() {
+      ::grpc::Service::MarkMethodGeneric(16);
     }
-    ~WithRawCallbackMethod_CaptureNormals() override {
+    ~WithGenericMethod_Step() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status Step(::grpc::ServerContext* /*context*/, const ::uesynth::StepRequest* /*request*/, ::uesynth::StepResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureNormals(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_CaptureOpticalFlow : public BaseClass {
+  class WithGenericMethod_SetLockstep : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_CaptureOpticalFlow() {
-      ::grpc::Service::MarkMethodRawCallback(12,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureOpticalFlow(context, request, response); }));
+    WithGenericMethod_SetLockstep() {
+      ::grpc::Service::MarkMethodGeneric(17);
     }
-    ~WithRawCallbackMethod_CaptureOpticalFlow() override {
+    ~WithGenericMethod_SetLockstep() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SetLockstep(::grpc::ServerContext* /*context*/, const ::uesynth::SetLockstepRequest* /*request*/, ::uesynth::LockstepState* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* CaptureOpticalFlow(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SpawnObject : public BaseClass {
+  class WithGenericMethod_SpawnObject : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SpawnObject() {
-      ::grpc::Service::MarkMethodRawCallback(13,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SpawnObject(context, request, response); }));
+    WithGenericMethod_SpawnObject() {
+      ::grpc::Service::MarkMethodGeneric(18);
     }
-    ~WithRawCallbackMethod_SpawnObject() override {
+    ~WithGenericMethod_SpawnObject() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -2357,21 +2829,33 @@ class UESynthService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SpawnObject(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_DestroyObject : public BaseClass {
+  class WithGenericMethod_PreloadAssets : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_DestroyObject() {
-      ::grpc::Service::MarkMethodRawCallback(14,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->DestroyObject(context, request, response); }));
+    WithGenericMethod_PreloadAssets() {
+      ::grpc::Service::MarkMethodGeneric(19);
     }
-    ~WithRawCallbackMethod_DestroyObject() override {
+    ~WithGenericMethod_PreloadAssets() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PreloadAssets(::grpc::ServerContext* /*context*/, const ::uesynth::PreloadAssetsRequest* /*request*/, ::uesynth::PreloadAssetsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_DestroyObject : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_DestroyObject() {
+      ::grpc::Service::MarkMethodGeneric(20);
+    }
+    ~WithGenericMethod_DestroyObject() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -2379,537 +2863,2465 @@ class UESynthService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* DestroyObject(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetMaterial : public BaseClass {
+  class WithGenericMethod_ConfigureActorPool : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetMaterial() {
-      ::grpc::Service::MarkMethodRawCallback(15,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetMaterial(context, request, response); }));
+    WithGenericMethod_ConfigureActorPool() {
+      ::grpc::Service::MarkMethodGeneric(21);
+    }
+    ~WithGenericMethod_ConfigureActorPool() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConfigureActorPool(::grpc::ServerContext* /*context*/, const ::uesynth::ConfigureActorPoolRequest* /*request*/, ::uesynth::ActorPoolStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetMaterial : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetMaterial() {
+      ::grpc::Service::MarkMethodGeneric(22);
+    }
+    ~WithGenericMethod_SetMaterial() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetMaterialsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetMaterialsBatch() {
+      ::grpc::Service::MarkMethodGeneric(23);
+    }
+    ~WithGenericMethod_SetMaterialsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMaterialsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialsBatchRequest* /*request*/, ::uesynth::SetMaterialsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ResolveMaterialParameters : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ResolveMaterialParameters() {
+      ::grpc::Service::MarkMethodGeneric(24);
+    }
+    ~WithGenericMethod_ResolveMaterialParameters() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResolveMaterialParameters(::grpc::ServerContext* /*context*/, const ::uesynth::ResolveMaterialParametersRequest* /*request*/, ::uesynth::MaterialParameterIds* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ListObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ListObjects() {
+      ::grpc::Service::MarkMethodGeneric(25);
+    }
+    ~WithGenericMethod_ListObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::uesynth::ListObjectsRequest* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetSceneSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetSceneSnapshot() {
+      ::grpc::Service::MarkMethodGeneric(26);
+    }
+    ~WithGenericMethod_GetSceneSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSceneSnapshot(::grpc::ServerContext* /*context*/, const ::uesynth::GetSceneSnapshotRequest* /*request*/, ::uesynth::SceneSnapshot* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetLighting : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetLighting() {
+      ::grpc::Service::MarkMethodGeneric(27);
+    }
+    ~WithGenericMethod_SetLighting() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetLightingBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetLightingBatch() {
+      ::grpc::Service::MarkMethodGeneric(28);
+    }
+    ~WithGenericMethod_SetLightingBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetLightingBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingBatchRequest* /*request*/, ::uesynth::SetLightingBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StartRecording : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StartRecording() {
+      ::grpc::Service::MarkMethodGeneric(29);
+    }
+    ~WithGenericMethod_StartRecording() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StartRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StopRecording : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StopRecording() {
+      ::grpc::Service::MarkMethodGeneric(30);
+    }
+    ~WithGenericMethod_StopRecording() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StopRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StopRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodGeneric(31);
+    }
+    ~WithGenericMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::uesynth::GetServerStatsRequest* /*request*/, ::uesynth::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetHealth : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetHealth() {
+      ::grpc::Service::MarkMethodGeneric(32);
+    }
+    ~WithGenericMethod_GetHealth() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetHealth(::grpc::ServerContext* /*context*/, const ::uesynth::HealthRequest* /*request*/, ::uesynth::HealthStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ControlStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ControlStream() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_ControlStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ControlStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::uesynth::FrameResponse, ::uesynth::ActionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestControlStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetCameraTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetCameraTransform() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_SetCameraTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetCameraTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetCameraTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetCameraTransform() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_GetCameraTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetCameraTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CaptureRgbImage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CaptureRgbImage() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_CaptureRgbImage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCaptureRgbImage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CaptureDepthMap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CaptureDepthMap() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_CaptureDepthMap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCaptureDepthMap(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CaptureSegmentationMask : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CaptureSegmentationMask() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_CaptureSegmentationMask() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCaptureSegmentationMask(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetObjectTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetObjectTransform() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_SetObjectTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetObjectTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetObjectTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetObjectTransform() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_GetObjectTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetObjectTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetObjectTransformsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_SetObjectTransformsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformsBatchRequest* /*request*/, ::uesynth::SetObjectTransformsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetObjectTransformsBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetObjectTransformsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodRaw(9);
+    }
+    ~WithRawMethod_GetObjectTransformsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformsBatchRequest* /*request*/, ::uesynth::GetObjectTransformsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetObjectTransformsBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CreateCamera : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CreateCamera() {
+      ::grpc::Service::MarkMethodRaw(10);
+    }
+    ~WithRawMethod_CreateCamera() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCreateCamera(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_DestroyCamera : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_DestroyCamera() {
+      ::grpc::Service::MarkMethodRaw(11);
+    }
+    ~WithRawMethod_DestroyCamera() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDestroyCamera(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetResolution : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetResolution() {
+      ::grpc::Service::MarkMethodRaw(12);
+    }
+    ~WithRawMethod_SetResolution() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetResolution(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CaptureNormals : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CaptureNormals() {
+      ::grpc::Service::MarkMethodRaw(13);
+    }
+    ~WithRawMethod_CaptureNormals() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCaptureNormals(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CaptureOpticalFlow : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CaptureOpticalFlow() {
+      ::grpc::Service::MarkMethodRaw(14);
+    }
+    ~WithRawMethod_CaptureOpticalFlow() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCaptureOpticalFlow(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CaptureMulti : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CaptureMulti() {
+      ::grpc::Service::MarkMethodRaw(15);
+    }
+    ~WithRawMethod_CaptureMulti() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureMulti(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureMultiRequest* /*request*/, ::uesynth::MultiImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCaptureMulti(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Step : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Step() {
+      ::grpc::Service::MarkMethodRaw(16);
+    }
+    ~WithRawMethod_Step() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Step(::grpc::ServerContext* /*context*/, const ::uesynth::StepRequest* /*request*/, ::uesynth::StepResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStep(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetLockstep : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetLockstep() {
+      ::grpc::Service::MarkMethodRaw(17);
+    }
+    ~WithRawMethod_SetLockstep() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetLockstep(::grpc::ServerContext* /*context*/, const ::uesynth::SetLockstepRequest* /*request*/, ::uesynth::LockstepState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetLockstep(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SpawnObject : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SpawnObject() {
+      ::grpc::Service::MarkMethodRaw(18);
+    }
+    ~WithRawMethod_SpawnObject() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSpawnObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_PreloadAssets : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_PreloadAssets() {
+      ::grpc::Service::MarkMethodRaw(19);
+    }
+    ~WithRawMethod_PreloadAssets() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PreloadAssets(::grpc::ServerContext* /*context*/, const ::uesynth::PreloadAssetsRequest* /*request*/, ::uesynth::PreloadAssetsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPreloadAssets(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_DestroyObject : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_DestroyObject() {
+      ::grpc::Service::MarkMethodRaw(20);
+    }
+    ~WithRawMethod_DestroyObject() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDestroyObject(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ConfigureActorPool : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ConfigureActorPool() {
+      ::grpc::Service::MarkMethodRaw(21);
+    }
+    ~WithRawMethod_ConfigureActorPool() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConfigureActorPool(::grpc::ServerContext* /*context*/, const ::uesynth::ConfigureActorPoolRequest* /*request*/, ::uesynth::ActorPoolStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestConfigureActorPool(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(21, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetMaterial : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetMaterial() {
+      ::grpc::Service::MarkMethodRaw(22);
+    }
+    ~WithRawMethod_SetMaterial() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetMaterial(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(22, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetMaterialsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetMaterialsBatch() {
+      ::grpc::Service::MarkMethodRaw(23);
+    }
+    ~WithRawMethod_SetMaterialsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMaterialsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialsBatchRequest* /*request*/, ::uesynth::SetMaterialsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetMaterialsBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(23, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ResolveMaterialParameters : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ResolveMaterialParameters() {
+      ::grpc::Service::MarkMethodRaw(24);
+    }
+    ~WithRawMethod_ResolveMaterialParameters() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResolveMaterialParameters(::grpc::ServerContext* /*context*/, const ::uesynth::ResolveMaterialParametersRequest* /*request*/, ::uesynth::MaterialParameterIds* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestResolveMaterialParameters(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ListObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ListObjects() {
+      ::grpc::Service::MarkMethodRaw(25);
+    }
+    ~WithRawMethod_ListObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::uesynth::ListObjectsRequest* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestListObjects(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetSceneSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetSceneSnapshot() {
+      ::grpc::Service::MarkMethodRaw(26);
+    }
+    ~WithRawMethod_GetSceneSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSceneSnapshot(::grpc::ServerContext* /*context*/, const ::uesynth::GetSceneSnapshotRequest* /*request*/, ::uesynth::SceneSnapshot* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetSceneSnapshot(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(26, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetLighting : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetLighting() {
+      ::grpc::Service::MarkMethodRaw(27);
+    }
+    ~WithRawMethod_SetLighting() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetLighting(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(27, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetLightingBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetLightingBatch() {
+      ::grpc::Service::MarkMethodRaw(28);
+    }
+    ~WithRawMethod_SetLightingBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetLightingBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingBatchRequest* /*request*/, ::uesynth::SetLightingBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetLightingBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(28, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StartRecording : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StartRecording() {
+      ::grpc::Service::MarkMethodRaw(29);
+    }
+    ~WithRawMethod_StartRecording() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StartRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStartRecording(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(29, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StopRecording : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StopRecording() {
+      ::grpc::Service::MarkMethodRaw(30);
+    }
+    ~WithRawMethod_StopRecording() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StopRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StopRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStopRecording(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(30, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodRaw(31);
+    }
+    ~WithRawMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::uesynth::GetServerStatsRequest* /*request*/, ::uesynth::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetServerStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(31, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetHealth : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetHealth() {
+      ::grpc::Service::MarkMethodRaw(32);
+    }
+    ~WithRawMethod_GetHealth() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetHealth(::grpc::ServerContext* /*context*/, const ::uesynth::HealthRequest* /*request*/, ::uesynth::HealthStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetHealth(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(32, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ControlStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ControlStream() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ControlStream(context); }));
+    }
+    ~WithRawCallbackMethod_ControlStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ControlStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::uesynth::FrameResponse, ::uesynth::ActionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ControlStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetCameraTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetCameraTransform() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetCameraTransform(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetCameraTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetCameraTransform(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetCameraTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetCameraTransform() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetCameraTransform(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetCameraTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetCameraTransform(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CaptureRgbImage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CaptureRgbImage() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureRgbImage(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_CaptureRgbImage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CaptureRgbImage(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CaptureDepthMap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CaptureDepthMap() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureDepthMap(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_CaptureDepthMap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CaptureDepthMap(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CaptureSegmentationMask : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CaptureSegmentationMask() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureSegmentationMask(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_CaptureSegmentationMask() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CaptureSegmentationMask(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetObjectTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetObjectTransform() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetObjectTransform(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetObjectTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetObjectTransform(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetObjectTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetObjectTransform() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetObjectTransform(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetObjectTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetObjectTransform(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetObjectTransformsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetObjectTransformsBatch(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetObjectTransformsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformsBatchRequest* /*request*/, ::uesynth::SetObjectTransformsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetObjectTransformsBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetObjectTransformsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetObjectTransformsBatch(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetObjectTransformsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformsBatchRequest* /*request*/, ::uesynth::GetObjectTransformsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetObjectTransformsBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CreateCamera : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CreateCamera() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CreateCamera(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_CreateCamera() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CreateCamera(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_DestroyCamera : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_DestroyCamera() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->DestroyCamera(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_DestroyCamera() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* DestroyCamera(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetResolution : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetResolution() {
+      ::grpc::Service::MarkMethodRawCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetResolution(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetResolution() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetResolution(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CaptureNormals : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CaptureNormals() {
+      ::grpc::Service::MarkMethodRawCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureNormals(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_CaptureNormals() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CaptureNormals(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CaptureOpticalFlow : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CaptureOpticalFlow() {
+      ::grpc::Service::MarkMethodRawCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureOpticalFlow(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_CaptureOpticalFlow() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CaptureOpticalFlow(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CaptureMulti : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CaptureMulti() {
+      ::grpc::Service::MarkMethodRawCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CaptureMulti(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_CaptureMulti() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CaptureMulti(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureMultiRequest* /*request*/, ::uesynth::MultiImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* CaptureMulti(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Step : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Step() {
+      ::grpc::Service::MarkMethodRawCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Step(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Step() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Step(::grpc::ServerContext* /*context*/, const ::uesynth::StepRequest* /*request*/, ::uesynth::StepResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Step(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetLockstep : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetLockstep() {
+      ::grpc::Service::MarkMethodRawCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetLockstep(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetLockstep() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetLockstep(::grpc::ServerContext* /*context*/, const ::uesynth::SetLockstepRequest* /*request*/, ::uesynth::LockstepState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetLockstep(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SpawnObject : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SpawnObject() {
+      ::grpc::Service::MarkMethodRawCallback(18,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SpawnObject(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SpawnObject() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SpawnObject(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_PreloadAssets : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_PreloadAssets() {
+      ::grpc::Service::MarkMethodRawCallback(19,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->PreloadAssets(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_PreloadAssets() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PreloadAssets(::grpc::ServerContext* /*context*/, const ::uesynth::PreloadAssetsRequest* /*request*/, ::uesynth::PreloadAssetsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* PreloadAssets(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_DestroyObject : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_DestroyObject() {
+      ::grpc::Service::MarkMethodRawCallback(20,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->DestroyObject(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_DestroyObject() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* DestroyObject(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ConfigureActorPool : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ConfigureActorPool() {
+      ::grpc::Service::MarkMethodRawCallback(21,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ConfigureActorPool(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ConfigureActorPool() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConfigureActorPool(::grpc::ServerContext* /*context*/, const ::uesynth::ConfigureActorPoolRequest* /*request*/, ::uesynth::ActorPoolStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ConfigureActorPool(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetMaterial : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetMaterial() {
+      ::grpc::Service::MarkMethodRawCallback(22,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetMaterial(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetMaterial() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetMaterial(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetMaterialsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetMaterialsBatch() {
+      ::grpc::Service::MarkMethodRawCallback(23,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetMaterialsBatch(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetMaterialsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMaterialsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialsBatchRequest* /*request*/, ::uesynth::SetMaterialsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetMaterialsBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ResolveMaterialParameters : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ResolveMaterialParameters() {
+      ::grpc::Service::MarkMethodRawCallback(24,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ResolveMaterialParameters(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ResolveMaterialParameters() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResolveMaterialParameters(::grpc::ServerContext* /*context*/, const ::uesynth::ResolveMaterialParametersRequest* /*request*/, ::uesynth::MaterialParameterIds* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ResolveMaterialParameters(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ListObjects : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ListObjects() {
+      ::grpc::Service::MarkMethodRawCallback(25,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ListObjects(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ListObjects() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::uesynth::ListObjectsRequest* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ListObjects(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetSceneSnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetSceneSnapshot() {
+      ::grpc::Service::MarkMethodRawCallback(26,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetSceneSnapshot(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetSceneSnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSceneSnapshot(::grpc::ServerContext* /*context*/, const ::uesynth::GetSceneSnapshotRequest* /*request*/, ::uesynth::SceneSnapshot* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetSceneSnapshot(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetLighting : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetLighting() {
+      ::grpc::Service::MarkMethodRawCallback(27,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetLighting(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetLighting() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetLighting(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetLightingBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetLightingBatch() {
+      ::grpc::Service::MarkMethodRawCallback(28,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetLightingBatch(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetLightingBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetLightingBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingBatchRequest* /*request*/, ::uesynth::SetLightingBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetLightingBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StartRecording : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StartRecording() {
+      ::grpc::Service::MarkMethodRawCallback(29,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->StartRecording(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_StartRecording() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StartRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* StartRecording(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StopRecording : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StopRecording() {
+      ::grpc::Service::MarkMethodRawCallback(30,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->StopRecording(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_StopRecording() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StopRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StopRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* StopRecording(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodRawCallback(31,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetServerStats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::uesynth::GetServerStatsRequest* /*request*/, ::uesynth::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetServerStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetHealth : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetHealth() {
+      ::grpc::Service::MarkMethodRawCallback(32,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetHealth(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetHealth() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetHealth(::grpc::ServerContext* /*context*/, const ::uesynth::HealthRequest* /*request*/, ::uesynth::HealthStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetHealth(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetCameraTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetCameraTransform() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedSetCameraTransform(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetCameraTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetCameraTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetCameraTransformRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetCameraTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetCameraTransform() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>* streamer) {
+                       return this->StreamedGetCameraTransform(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetCameraTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetCameraTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::GetCameraTransformRequest,::uesynth::GetCameraTransformResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_CaptureRgbImage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_CaptureRgbImage() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
+                       return this->StreamedCaptureRgbImage(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_CaptureRgbImage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCaptureRgbImage(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_CaptureDepthMap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_CaptureDepthMap() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
+                       return this->StreamedCaptureDepthMap(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_CaptureDepthMap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCaptureDepthMap(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_CaptureSegmentationMask : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_CaptureSegmentationMask() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
+                       return this->StreamedCaptureSegmentationMask(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_CaptureSegmentationMask() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCaptureSegmentationMask(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetObjectTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetObjectTransform() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedSetObjectTransform(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetObjectTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetObjectTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetObjectTransformRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetObjectTransform : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetObjectTransform() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>* streamer) {
+                       return this->StreamedGetObjectTransform(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetObjectTransform() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetObjectTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::GetObjectTransformRequest,::uesynth::GetObjectTransformResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetObjectTransformsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::SetObjectTransformsBatchRequest, ::uesynth::SetObjectTransformsBatchResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::SetObjectTransformsBatchRequest, ::uesynth::SetObjectTransformsBatchResponse>* streamer) {
+                       return this->StreamedSetObjectTransformsBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetObjectTransformsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformsBatchRequest* /*request*/, ::uesynth::SetObjectTransformsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetObjectTransformsBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetObjectTransformsBatchRequest,::uesynth::SetObjectTransformsBatchResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetObjectTransformsBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetObjectTransformsBatch() {
+      ::grpc::Service::MarkMethodStreamed(9,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::GetObjectTransformsBatchRequest, ::uesynth::GetObjectTransformsBatchResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::GetObjectTransformsBatchRequest, ::uesynth::GetObjectTransformsBatchResponse>* streamer) {
+                       return this->StreamedGetObjectTransformsBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetObjectTransformsBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetObjectTransformsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformsBatchRequest* /*request*/, ::uesynth::GetObjectTransformsBatchResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetObjectTransformsBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::GetObjectTransformsBatchRequest,::uesynth::GetObjectTransformsBatchResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_CreateCamera : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_CreateCamera() {
+      ::grpc::Service::MarkMethodStreamed(10,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedCreateCamera(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_CreateCamera() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCreateCamera(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CreateCameraRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_DestroyCamera : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_DestroyCamera() {
+      ::grpc::Service::MarkMethodStreamed(11,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedDestroyCamera(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_DestroyCamera() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedDestroyCamera(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::DestroyCameraRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetResolution : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetResolution() {
+      ::grpc::Service::MarkMethodStreamed(12,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedSetResolution(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetResolution() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetResolution(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetResolutionRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_CaptureNormals : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_CaptureNormals() {
+      ::grpc::Service::MarkMethodStreamed(13,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
+                       return this->StreamedCaptureNormals(context,
+                         streamer);
+                  }));
     }
-    ~WithRawCallbackMethod_SetMaterial() override {
+    ~WithStreamedUnaryMethod_CaptureNormals() override {
       BaseClassMustBeDerivedFromService(this);
     }
-    // disable synchronous version of this method
-    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    // disable regular version of this method
+    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetMaterial(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCaptureNormals(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_ListObjects : public BaseClass {
+  class WithStreamedUnaryMethod_CaptureOpticalFlow : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_ListObjects() {
-      ::grpc::Service::MarkMethodRawCallback(16,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ListObjects(context, request, response); }));
+    WithStreamedUnaryMethod_CaptureOpticalFlow() {
+      ::grpc::Service::MarkMethodStreamed(14,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
+                       return this->StreamedCaptureOpticalFlow(context,
+                         streamer);
+                  }));
     }
-    ~WithRawCallbackMethod_ListObjects() override {
+    ~WithStreamedUnaryMethod_CaptureOpticalFlow() override {
       BaseClassMustBeDerivedFromService(this);
     }
-    // disable synchronous version of this method
-    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+    // disable regular version of this method
+    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* ListObjects(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCaptureOpticalFlow(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetLighting : public BaseClass {
+  class WithStreamedUnaryMethod_CaptureMulti : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetLighting() {
-      ::grpc::Service::MarkMethodRawCallback(17,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetLighting(context, request, response); }));
+    WithStreamedUnaryMethod_CaptureMulti() {
+      ::grpc::Service::MarkMethodStreamed(15,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::uesynth::CaptureMultiRequest, ::uesynth::MultiImageResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::uesynth::CaptureMultiRequest, ::uesynth::MultiImageResponse>* streamer) {
+                       return this->StreamedCaptureMulti(context,
+                         streamer);
+                  }));
     }
-    ~WithRawCallbackMethod_SetLighting() override {
+    ~WithStreamedUnaryMethod_CaptureMulti() override {
       BaseClassMustBeDerivedFromService(this);
     }
-    // disable synchronous version of this method
-    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    // disable regular version of this method
+    ::grpc::Status CaptureMulti(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureMultiRequest* /*request*/, ::uesynth::MultiImageResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetLighting(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCaptureMulti(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureMultiRequest,::uesynth::MultiImageResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_SetCameraTransform : public BaseClass {
+  class WithStreamedUnaryMethod_Step : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_SetCameraTransform() {
-      ::grpc::Service::MarkMethodStreamed(1,
+    WithStreamedUnaryMethod_Step() {
+      ::grpc::Service::MarkMethodStreamed(16,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>(
+          ::uesynth::StepRequest, ::uesynth::StepResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::SetCameraTransformRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedSetCameraTransform(context,
+                     ::uesynth::StepRequest, ::uesynth::StepResponse>* streamer) {
+                       return this->StreamedStep(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_SetCameraTransform() override {
+    ~WithStreamedUnaryMethod_Step() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetCameraTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status Step(::grpc::ServerContext* /*context*/, const ::uesynth::StepRequest* /*request*/, ::uesynth::StepResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSetCameraTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetCameraTransformRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedStep(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::StepRequest,::uesynth::StepResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_GetCameraTransform : public BaseClass {
+  class WithStreamedUnaryMethod_SetLockstep : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_GetCameraTransform() {
-      ::grpc::Service::MarkMethodStreamed(2,
+    WithStreamedUnaryMethod_SetLockstep() {
+      ::grpc::Service::MarkMethodStreamed(17,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>(
+          ::uesynth::SetLockstepRequest, ::uesynth::LockstepState>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::GetCameraTransformRequest, ::uesynth::GetCameraTransformResponse>* streamer) {
-                       return this->StreamedGetCameraTransform(context,
+                     ::uesynth::SetLockstepRequest, ::uesynth::LockstepState>* streamer) {
+                       return this->StreamedSetLockstep(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_GetCameraTransform() override {
+    ~WithStreamedUnaryMethod_SetLockstep() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetCameraTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetCameraTransformRequest* /*request*/, ::uesynth::GetCameraTransformResponse* /*response*/) override {
+    ::grpc::Status SetLockstep(::grpc::ServerContext* /*context*/, const ::uesynth::SetLockstepRequest* /*request*/, ::uesynth::LockstepState* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetCameraTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::GetCameraTransformRequest,::uesynth::GetCameraTransformResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedSetLockstep(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetLockstepRequest,::uesynth::LockstepState>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_CaptureRgbImage : public BaseClass {
+  class WithStreamedUnaryMethod_SpawnObject : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_CaptureRgbImage() {
-      ::grpc::Service::MarkMethodStreamed(3,
+    WithStreamedUnaryMethod_SpawnObject() {
+      ::grpc::Service::MarkMethodStreamed(18,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+          ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
-                       return this->StreamedCaptureRgbImage(context,
+                     ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedSpawnObject(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_CaptureRgbImage() override {
+    ~WithStreamedUnaryMethod_SpawnObject() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status CaptureRgbImage(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedCaptureRgbImage(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedSpawnObject(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SpawnObjectRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_CaptureDepthMap : public BaseClass {
+  class WithStreamedUnaryMethod_PreloadAssets : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_CaptureDepthMap() {
-      ::grpc::Service::MarkMethodStreamed(4,
+    WithStreamedUnaryMethod_PreloadAssets() {
+      ::grpc::Service::MarkMethodStreamed(19,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+          ::uesynth::PreloadAssetsRequest, ::uesynth::PreloadAssetsResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
-                       return this->StreamedCaptureDepthMap(context,
+                     ::uesynth::PreloadAssetsRequest, ::uesynth::PreloadAssetsResponse>* streamer) {
+                       return this->StreamedPreloadAssets(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_CaptureDepthMap() override {
+    ~WithStreamedUnaryMethod_PreloadAssets() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status CaptureDepthMap(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status PreloadAssets(::grpc::ServerContext* /*context*/, const ::uesynth::PreloadAssetsRequest* /*request*/, ::uesynth::PreloadAssetsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedCaptureDepthMap(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedPreloadAssets(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::PreloadAssetsRequest,::uesynth::PreloadAssetsResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_CaptureSegmentationMask : public BaseClass {
+  class WithStreamedUnaryMethod_DestroyObject : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_CaptureSegmentationMask() {
-      ::grpc::Service::MarkMethodStreamed(5,
+    WithStreamedUnaryMethod_DestroyObject() {
+      ::grpc::Service::MarkMethodStreamed(20,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+          ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
-                       return this->StreamedCaptureSegmentationMask(context,
+                     ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedDestroyObject(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_CaptureSegmentationMask() override {
+    ~WithStreamedUnaryMethod_DestroyObject() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status CaptureSegmentationMask(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedCaptureSegmentationMask(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedDestroyObject(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::DestroyObjectRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_SetObjectTransform : public BaseClass {
+  class WithStreamedUnaryMethod_ConfigureActorPool : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_SetObjectTransform() {
-      ::grpc::Service::MarkMethodStreamed(6,
+    WithStreamedUnaryMethod_ConfigureActorPool() {
+      ::grpc::Service::MarkMethodStreamed(21,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>(
+          ::uesynth::ConfigureActorPoolRequest, ::uesynth::ActorPoolStats>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::SetObjectTransformRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedSetObjectTransform(context,
+                     ::uesynth::ConfigureActorPoolRequest, ::uesynth::ActorPoolStats>* streamer) {
+                       return this->StreamedConfigureActorPool(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_SetObjectTransform() override {
+    ~WithStreamedUnaryMethod_ConfigureActorPool() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::SetObjectTransformRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status ConfigureActorPool(::grpc::ServerContext* /*context*/, const ::uesynth::ConfigureActorPoolRequest* /*request*/, ::uesynth::ActorPoolStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSetObjectTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetObjectTransformRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedConfigureActorPool(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::ConfigureActorPoolRequest,::uesynth::ActorPoolStats>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_GetObjectTransform : public BaseClass {
+  class WithStreamedUnaryMethod_SetMaterial : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_GetObjectTransform() {
-      ::grpc::Service::MarkMethodStreamed(7,
+    WithStreamedUnaryMethod_SetMaterial() {
+      ::grpc::Service::MarkMethodStreamed(22,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>(
+          ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::GetObjectTransformRequest, ::uesynth::GetObjectTransformResponse>* streamer) {
-                       return this->StreamedGetObjectTransform(context,
+                     ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedSetMaterial(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_GetObjectTransform() override {
+    ~WithStreamedUnaryMethod_SetMaterial() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status GetObjectTransform(::grpc::ServerContext* /*context*/, const ::uesynth::GetObjectTransformRequest* /*request*/, ::uesynth::GetObjectTransformResponse* /*response*/) override {
+    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetObjectTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::GetObjectTransformRequest,::uesynth::GetObjectTransformResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedSetMaterial(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetMaterialRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_CreateCamera : public BaseClass {
+  class WithStreamedUnaryMethod_SetMaterialsBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_CreateCamera() {
-      ::grpc::Service::MarkMethodStreamed(8,
+    WithStreamedUnaryMethod_SetMaterialsBatch() {
+      ::grpc::Service::MarkMethodStreamed(23,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>(
+          ::uesynth::SetMaterialsBatchRequest, ::uesynth::SetMaterialsBatchResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::CreateCameraRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedCreateCamera(context,
+                     ::uesynth::SetMaterialsBatchRequest, ::uesynth::SetMaterialsBatchResponse>* streamer) {
+                       return this->StreamedSetMaterialsBatch(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_CreateCamera() override {
+    ~WithStreamedUnaryMethod_SetMaterialsBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status CreateCamera(::grpc::ServerContext* /*context*/, const ::uesynth::CreateCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetMaterialsBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialsBatchRequest* /*request*/, ::uesynth::SetMaterialsBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedCreateCamera(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CreateCameraRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedSetMaterialsBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetMaterialsBatchRequest,::uesynth::SetMaterialsBatchResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_DestroyCamera : public BaseClass {
+  class WithStreamedUnaryMethod_ResolveMaterialParameters : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_DestroyCamera() {
-      ::grpc::Service::MarkMethodStreamed(9,
+    WithStreamedUnaryMethod_ResolveMaterialParameters() {
+      ::grpc::Service::MarkMethodStreamed(24,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>(
+          ::uesynth::ResolveMaterialParametersRequest, ::uesynth::MaterialParameterIds>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::DestroyCameraRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedDestroyCamera(context,
+                     ::uesynth::ResolveMaterialParametersRequest, ::uesynth::MaterialParameterIds>* streamer) {
+                       return this->StreamedResolveMaterialParameters(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_DestroyCamera() override {
+    ~WithStreamedUnaryMethod_ResolveMaterialParameters() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status DestroyCamera(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyCameraRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status ResolveMaterialParameters(::grpc::ServerContext* /*context*/, const ::uesynth::ResolveMaterialParametersRequest* /*request*/, ::uesynth::MaterialParameterIds* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedDestroyCamera(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::DestroyCameraRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedResolveMaterialParameters(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::ResolveMaterialParametersRequest,::uesynth::MaterialParameterIds>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_SetResolution : public BaseClass {
+  class WithStreamedUnaryMethod_ListObjects : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_SetResolution() {
-      ::grpc::Service::MarkMethodStreamed(10,
+    WithStreamedUnaryMethod_ListObjects() {
+      ::grpc::Service::MarkMethodStreamed(25,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>(
+          ::uesynth::ListObjectsRequest, ::uesynth::ListObjectsResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::SetResolutionRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedSetResolution(context,
+                     ::uesynth::ListObjectsRequest, ::uesynth::ListObjectsResponse>* streamer) {
+                       return this->StreamedListObjects(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_SetResolution() override {
+    ~WithStreamedUnaryMethod_ListObjects() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetResolution(::grpc::ServerContext* /*context*/, const ::uesynth::SetResolutionRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::uesynth::ListObjectsRequest* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSetResolution(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetResolutionRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedListObjects(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::ListObjectsRequest,::uesynth::ListObjectsResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_CaptureNormals : public BaseClass {
+  class WithStreamedUnaryMethod_GetSceneSnapshot : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_CaptureNormals() {
-      ::grpc::Service::MarkMethodStreamed(11,
+    WithStreamedUnaryMethod_GetSceneSnapshot() {
+      ::grpc::Service::MarkMethodStreamed(26,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+          ::uesynth::GetSceneSnapshotRequest, ::uesynth::SceneSnapshot>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
-                       return this->StreamedCaptureNormals(context,
+                     ::uesynth::GetSceneSnapshotRequest, ::uesynth::SceneSnapshot>* streamer) {
+                       return this->StreamedGetSceneSnapshot(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_CaptureNormals() override {
+    ~WithStreamedUnaryMethod_GetSceneSnapshot() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status CaptureNormals(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status GetSceneSnapshot(::grpc::ServerContext* /*context*/, const ::uesynth::GetSceneSnapshotRequest* /*request*/, ::uesynth::SceneSnapshot* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedCaptureNormals(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedGetSceneSnapshot(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::GetSceneSnapshotRequest,::uesynth::SceneSnapshot>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_CaptureOpticalFlow : public BaseClass {
+  class WithStreamedUnaryMethod_SetLighting : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_CaptureOpticalFlow() {
-      ::grpc::Service::MarkMethodStreamed(12,
+    WithStreamedUnaryMethod_SetLighting() {
+      ::grpc::Service::MarkMethodStreamed(27,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::CaptureRequest, ::uesynth::ImageResponse>(
+          ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::CaptureRequest, ::uesynth::ImageResponse>* streamer) {
-                       return this->StreamedCaptureOpticalFlow(context,
+                     ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>* streamer) {
+                       return this->StreamedSetLighting(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_CaptureOpticalFlow() override {
+    ~WithStreamedUnaryMethod_SetLighting() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status CaptureOpticalFlow(::grpc::ServerContext* /*context*/, const ::uesynth::CaptureRequest* /*request*/, ::uesynth::ImageResponse* /*response*/) override {
+    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedCaptureOpticalFlow(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::CaptureRequest,::uesynth::ImageResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedSetLighting(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetLightingRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_SpawnObject : public BaseClass {
+  class WithStreamedUnaryMethod_SetLightingBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_SpawnObject() {
-      ::grpc::Service::MarkMethodStreamed(13,
+    WithStreamedUnaryMethod_SetLightingBatch() {
+      ::grpc::Service::MarkMethodStreamed(28,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>(
+          ::uesynth::SetLightingBatchRequest, ::uesynth::SetLightingBatchResponse>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::SpawnObjectRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedSpawnObject(context,
+                     ::uesynth::SetLightingBatchRequest, ::uesynth::SetLightingBatchResponse>* streamer) {
+                       return this->StreamedSetLightingBatch(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_SpawnObject() override {
+    ~WithStreamedUnaryMethod_SetLightingBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SpawnObject(::grpc::ServerContext* /*context*/, const ::uesynth::SpawnObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status SetLightingBatch(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingBatchRequest* /*request*/, ::uesynth::SetLightingBatchResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSpawnObject(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SpawnObjectRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedSetLightingBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetLightingBatchRequest,::uesynth::SetLightingBatchResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_DestroyObject : public BaseClass {
+  class WithStreamedUnaryMethod_StartRecording : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_DestroyObject() {
-      ::grpc::Service::MarkMethodStreamed(14,
+    WithStreamedUnaryMethod_StartRecording() {
+      ::grpc::Service::MarkMethodStreamed(29,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>(
+          ::uesynth::StartRecordingRequest, ::uesynth::RecordingStats>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::DestroyObjectRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedDestroyObject(context,
+                     ::uesynth::StartRecordingRequest, ::uesynth::RecordingStats>* streamer) {
+                       return this->StreamedStartRecording(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_DestroyObject() override {
+    ~WithStreamedUnaryMethod_StartRecording() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status DestroyObject(::grpc::ServerContext* /*context*/, const ::uesynth::DestroyObjectRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status StartRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StartRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedDestroyObject(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::DestroyObjectRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedStartRecording(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::StartRecordingRequest,::uesynth::RecordingStats>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_SetMaterial : public BaseClass {
+  class WithStreamedUnaryMethod_StopRecording : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_SetMaterial() {
-      ::grpc::Service::MarkMethodStreamed(15,
+    WithStreamedUnaryMethod_StopRecording() {
+      ::grpc::Service::MarkMethodStreamed(30,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>(
+          ::uesynth::StopRecordingRequest, ::uesynth::RecordingStats>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::SetMaterialRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedSetMaterial(context,
+                     ::uesynth::StopRecordingRequest, ::uesynth::RecordingStats>* streamer) {
+                       return this->StreamedStopRecording(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_SetMaterial() override {
+    ~WithStreamedUnaryMethod_StopRecording() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetMaterial(::grpc::ServerContext* /*context*/, const ::uesynth::SetMaterialRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status StopRecording(::grpc::ServerContext* /*context*/, const ::uesynth::StopRecordingRequest* /*request*/, ::uesynth::RecordingStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSetMaterial(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetMaterialRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedStopRecording(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::StopRecordingRequest,::uesynth::RecordingStats>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_ListObjects : public BaseClass {
+  class WithStreamedUnaryMethod_GetServerStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_ListObjects() {
-      ::grpc::Service::MarkMethodStreamed(16,
+    WithStreamedUnaryMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodStreamed(31,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::google::protobuf::Empty, ::uesynth::ListObjectsResponse>(
+          ::uesynth::GetServerStatsRequest, ::uesynth::ServerStats>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::google::protobuf::Empty, ::uesynth::ListObjectsResponse>* streamer) {
-                       return this->StreamedListObjects(context,
+                     ::uesynth::GetServerStatsRequest, ::uesynth::ServerStats>* streamer) {
+                       return this->StreamedGetServerStats(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_ListObjects() override {
+    ~WithStreamedUnaryMethod_GetServerStats() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status ListObjects(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::uesynth::ListObjectsResponse* /*response*/) override {
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::uesynth::GetServerStatsRequest* /*request*/, ::uesynth::ServerStats* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedListObjects(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::uesynth::ListObjectsResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedGetServerStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::GetServerStatsRequest,::uesynth::ServerStats>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
-  class WithStreamedUnaryMethod_SetLighting : public BaseClass {
+  class WithStreamedUnaryMethod_GetHealth : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithStreamedUnaryMethod_SetLighting() {
-      ::grpc::Service::MarkMethodStreamed(17,
+    WithStreamedUnaryMethod_GetHealth() {
+      ::grpc::Service::MarkMethodStreamed(32,
         new ::grpc::internal::StreamedUnaryHandler<
-          ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>(
+          ::uesynth::HealthRequest, ::uesynth::HealthStatus>(
             [this](::grpc::ServerContext* context,
                    ::grpc::ServerUnaryStreamer<
-                     ::uesynth::SetLightingRequest, ::uesynth::CommandResponse>* streamer) {
-                       return this->StreamedSetLighting(context,
+                     ::uesynth::HealthRequest, ::uesynth::HealthStatus>* streamer) {
+                       return this->StreamedGetHealth(context,
                          streamer);
                   }));
     }
-    ~WithStreamedUnaryMethod_SetLighting() override {
+    ~WithStreamedUnaryMethod_GetHealth() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable regular version of this method
-    ::grpc::Status SetLighting(::grpc::ServerContext* /*context*/, const ::uesynth::SetLightingRequest* /*request*/, ::uesynth::CommandResponse* /*response*/) override {
+    ::grpc::Status GetHealth(::grpc::ServerContext* /*context*/, const ::uesynth::HealthRequest* /*request*/, ::uesynth::HealthStatus* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSetLighting(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::SetLightingRequest,::uesynth::CommandResponse>* server_unary_streamer) = 0;
+    virtual ::grpc::Status StreamedGetHealth(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::uesynth::HealthRequest,::uesynth::HealthStatus>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_SetCameraTransform<WithStreamedUnaryMethod_GetCameraTransform<WithStreamedUnaryMethod_CaptureRgbImage<WithStreamedUnaryMethod_CaptureDepthMap<WithStreamedUnaryMethod_CaptureSegmentationMask<WithStreamedUnaryMethod_SetObjectTransform<WithStreamedUnaryMethod_GetObjectTransform<WithStreamedUnaryMethod_CreateCamera<WithStreamedUnaryMethod_DestroyCamera<WithStreamedUnaryMethod_SetResolution<WithStreamedUnaryMethod_CaptureNormals<WithStreamedUnaryMethod_CaptureOpticalFlow<WithStreamedUnaryMethod_SpawnObject<WithStreamedUnaryMethod_DestroyObject<WithStreamedUnaryMethod_SetMaterial<WithStreamedUnaryMethod_ListObjects<WithStreamedUnaryMethod_SetLighting<Service > > > > > > > > > > > > > > > > > StreamedUnaryService;
+  typedef WithStreamedUnaryMethod_SetCameraTransform<WithStreamedUnaryMethod_GetCameraTransform<WithStreamedUnaryMethod_CaptureRgbImage<WithStreamedUnaryMethod_CaptureDepthMap<WithStreamedUnaryMethod_CaptureSegmentationMask<WithStreamedUnaryMethod_SetObjectTransform<WithStreamedUnaryMethod_GetObjectTransform<WithStreamedUnaryMethod_SetObjectTransformsBatch<WithStreamedUnaryMethod_GetObjectTransformsBatch<WithStreamedUnaryMethod_CreateCamera<WithStreamedUnaryMethod_DestroyCamera<WithStreamedUnaryMethod_SetResolution<WithStreamedUnaryMethod_CaptureNormals<WithStreamedUnaryMethod_CaptureOpticalFlow<WithStreamedUnaryMethod_CaptureMulti<WithStreamedUnaryMethod_Step<WithStreamedUnaryMethod_SetLockstep<WithStreamedUnaryMethod_SpawnObject<WithStreamedUnaryMethod_PreloadAssets<WithStreamedUnaryMethod_DestroyObject<WithStreamedUnaryMethod_ConfigureActorPool<WithStreamedUnaryMethod_SetMaterial<WithStreamedUnaryMethod_SetMaterialsBatch<WithStreamedUnaryMethod_ResolveMaterialParameters<WithStreamedUnaryMethod_ListObjects<WithStreamedUnaryMethod_GetSceneSnapshot<WithStreamedUnaryMethod_SetLighting<WithStreamedUnaryMethod_SetLightingBatch<WithStreamedUnaryMethod_StartRecording<WithStreamedUnaryMethod_StopRecording<WithStreamedUnaryMethod_GetServerStats<WithStreamedUnaryMethod_GetHealth<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_SetCameraTransform<WithStreamedUnaryMethod_GetCameraTransform<WithStreamedUnaryMethod_CaptureRgbImage<WithStreamedUnaryMethod_CaptureDepthMap<WithStreamedUnaryMethod_CaptureSegmentationMask<WithStreamedUnaryMethod_SetObjectTransform<WithStreamedUnaryMethod_GetObjectTransform<WithStreamedUnaryMethod_CreateCamera<WithStreamedUnaryMethod_DestroyCamera<WithStreamedUnaryMethod_SetResolution<WithStreamedUnaryMethod_CaptureNormals<WithStreamedUnaryMethod_CaptureOpticalFlow<WithStreamedUnaryMethod_SpawnObject<WithStreamedUnaryMethod_DestroyObject<WithStreamedUnaryMethod_SetMaterial<WithStreamedUnaryMethod_ListObjects<WithStreamedUnaryMethod_SetLighting<Service > > > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_SetCameraTransform<WithStreamedUnaryMethod_GetCameraTransform<WithStreamedUnaryMethod_CaptureRgbImage<WithStreamedUnaryMethod_CaptureDepthMap<WithStreamedUnaryMethod_CaptureSegmentationMask<WithStreamedUnaryMethod_SetObjectTransform<WithStreamedUnaryMethod_GetObjectTransform<WithStreamedUnaryMethod_SetObjectTransformsBatch<WithStreamedUnaryMethod_GetObjectTransformsBatch<WithStreamedUnaryMethod_CreateCamera<WithStreamedUnaryMethod_DestroyCamera<WithStreamedUnaryMethod_SetResolution<WithStreamedUnaryMethod_CaptureNormals<WithStreamedUnaryMethod_CaptureOpticalFlow<WithStreamedUnaryMethod_CaptureMulti<WithStreamedUnaryMethod_Step<WithStreamedUnaryMethod_SetLockstep<WithStreamedUnaryMethod_SpawnObject<WithStreamedUnaryMethod_PreloadAssets<WithStreamedUnaryMethod_DestroyObject<WithStreamedUnaryMethod_ConfigureActorPool<WithStreamedUnaryMethod_SetMaterial<WithStreamedUnaryMethod_SetMaterialsBatch<WithStreamedUnaryMethod_ResolveMaterialParameters<WithStreamedUnaryMethod_ListObjects<WithStreamedUnaryMethod_GetSceneSnapshot<WithStreamedUnaryMethod_SetLighting<WithStreamedUnaryMethod_SetLightingBatch<WithStreamedUnaryMethod_StartRecording<WithStreamedUnaryMethod_StopRecording<WithStreamedUnaryMethod_GetServerStats<WithStreamedUnaryMethod_GetHealth<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace uesynth
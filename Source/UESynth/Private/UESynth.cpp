@@ -9,25 +9,141 @@
 #include "Framework/Commands/UICommandList.h"
 #include "Styling/AppStyle.h"
 #include "ToolMenus.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#include "Interfaces/IPluginManager.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+#include "RenderingThread.h"
+#include "SceneViewExtension.h"
+#include "ShaderCore.h"
+#include "Misc/Parse.h"
+#include "UESynthAssetCache.h"
+#include "UESynthAsyncServer.h"
+#include "UESynthCommandQueue.h"
+#include "UESynthFrameCapture.h"
+#include "UESynthFrameReadback.h"
+#include "UESynthHealth.h"
+#include "UESynthLockstep.h"
+#include "UESynthMetricsEndpoint.h"
+#include "UESynthRecordings.h"
+#include "UESynthRegistration.h"
+#include "UESynthSceneContext.h"
+#include "UESynthServerSettings.h"
 #include "UESynthServiceImpl.h"
+#include "UESynthSessions.h"
+#include "UESynthSubscriptions.h"
 #include <grpcpp/grpcpp.h>
 #include <thread>
 
 #define LOCTEXT_NAMESPACE "FUESynthModule"
 
+FUESynthModule::FUESynthModule() = default;
+
+FUESynthModule::~FUESynthModule() = default;
 
 void FUESynthModule::StartupModule() {
     UE_LOG(LogTemp, Log, TEXT("Starting gRPC server..."));
-    GRPCServerThread = std::thread([&]() {
-        std::string server_address("0.0.0.0:50051");
+
+    // Captures wait for the previous mutations to render unless -UESynthHoldCaptures=false
+    CommandQueue = MakeUnique<FUESynthCommandQueue>();
+    bool bHoldCaptures = true;
+    FParse::Bool(FCommandLine::Get(), TEXT("UESynthHoldCaptures="), bHoldCaptures);
+    CommandQueue->SetHoldCapturesUntilRendered(bHoldCaptures);
+    // Sessions take turns either way; with -UESynthDrainBudgetMs= the rest waits for the next frame
+    float DrainBudgetMs = 0.0f;
+    if (FParse::Value(FCommandLine::Get(), TEXT("UESynthDrainBudgetMs="), DrainBudgetMs)) {
+        CommandQueue->SetDrainBudget(DrainBudgetMs / 1000.0);
+    }
+    FrameReadback = MakeUnique<FUESynthFrameReadback>();
+    SceneContext = MakeUnique<FUESynthSceneContext>();
+    // With -UESynthHeadless the game view is only rendered when it is captured, offscreen
+    SceneContext->SetHeadless(FParse::Param(FCommandLine::Get(), TEXT("UESynthHeadless")));
+    Sessions = MakeUnique<FUESynthSessions>();
+    Subscriptions = MakeUnique<FUESynthSubscriptions>();
+    Recordings = MakeUnique<FUESynthRecordings>();
+    Lockstep = MakeUnique<FUESynthLockstep>();
+    Health = MakeUnique<FUESynthHealth>();
+    // Assets SpawnObject streams in stay resident within -UESynthAssetCacheMB= (1 GiB by default)
+    AssetCache = MakeUnique<FUESynthAssetCache>();
+    int32 AssetCacheMB = 0;
+    if (FParse::Value(FCommandLine::Get(), TEXT("UESynthAssetCacheMB="), AssetCacheMB) && AssetCacheMB >= 0) {
+        AssetCache->SetBudget(uint64(AssetCacheMB) << 20);
+    }
+
+    // JPEG and PNG encoding runs on background workers, which can't load modules themselves
+    FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+
+    // The capture shaders have to be mapped before the engine compiles global shaders
+    const FString ShaderDir = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("UESynth"))->GetBaseDir(), TEXT("Shaders"));
+    AddShaderSourceDirectoryMapping(TEXT("/Plugin/UESynth"), ShaderDir);
+    if (GEngine) {
+        CreateFrameCapture();
+    } else {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FUESynthModule::CreateFrameCapture);
+    }
+
+    // [UESynth.Server] in the engine ini, overridden by -UESynth<Key>= on the command line
+    const FUESynthServerSettings Settings = FUESynthServerSettings::Load();
+    FString SettingsError;
+    if (!Settings.Validate(&SettingsError)) {
+        UE_LOG(LogTemp, Error, TEXT("Not starting gRPC server: %s"), *SettingsError);
+        return;
+    }
+
+    // Prometheus scrapes of the server stats, with -UESynthMetricsPort= or MetricsPort in the ini
+    if (Settings.MetricsPort > 0) {
+        MetricsEndpoint = MakeUnique<FUESynthMetricsEndpoint>(Settings.MetricsPort);
+        if (MetricsEndpoint->Start()) {
+            UE_LOG(LogTemp, Log, TEXT("Serving metrics on port %d"), Settings.MetricsPort);
+        } else {
+            UE_LOG(LogTemp, Error, TEXT("Failed to serve metrics on port %d"), Settings.MetricsPort);
+            MetricsEndpoint.Reset();
+        }
+    }
+
+    if (Settings.bSyncServer) {
+        StartSyncServer(Settings);
+        return;
+    }
+
+    // One polling thread per completion queue; handlers finish from the game thread.
+    // With -UESynthPortRangeSize= it takes the first port of the range no other instance holds
+    AsyncServer = MakeUnique<FUESynthAsyncServer>(Settings);
+    if (AsyncServer->Start()) {
+        const FString& ListenAddress = AsyncServer->GetListenAddress();
+        UE_LOG(LogTemp, Log, TEXT("gRPC async server listening on %s with %d completion queue threads"),
+               *ListenAddress, Settings.CompletionQueueThreads);
+        Health->SetListenAddress(ListenAddress);
+        if (!Settings.RegistrationDir.IsEmpty()) {
+            Registration = MakeUnique<FUESynthRegistration>(Settings.RegistrationDir, ListenAddress, Settings.MetricsPort);
+        }
+    } else {
+        UE_LOG(LogTemp, Error, TEXT("Failed to start gRPC server"));
+        AsyncServer.Reset();
+    }
+}
+
+void FUESynthModule::CreateFrameCapture() {
+    FrameCapture = FSceneViewExtensions::NewExtension<FUESynthFrameCapture>();
+}
+
+void FUESynthModule::StartSyncServer(const FUESynthServerSettings& Settings) {
+    GRPCServerThread = std::thread([this, Settings]() {
         UESynthServiceImpl service;
-        grpc::ServerBuilder builder;
-        builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-        builder.RegisterService(&service);
-        GRPCServer = builder.BuildAndStart();
+        FString ListenAddress;
+        GRPCServer = Settings.BuildAndStart(
+            [&service](grpc::ServerBuilder& builder) { builder.RegisterService(&service); }, &ListenAddress);
         
         if (GRPCServer) {
-            UE_LOG(LogTemp, Log, TEXT("gRPC Server listening on %s"), *FString(server_address.c_str()));
+            UE_LOG(LogTemp, Log, TEXT("gRPC Server listening on %s"), *ListenAddress);
+            FUESynthHealth::Get().SetListenAddress(ListenAddress);
+            // Registered for as long as the server serves
+            TUniquePtr<FUESynthRegistration> ServerRegistration;
+            if (!Settings.RegistrationDir.IsEmpty()) {
+                ServerRegistration = MakeUnique<FUESynthRegistration>(Settings.RegistrationDir, ListenAddress, Settings.MetricsPort);
+            }
             GRPCServer->Wait(); // Block until the server is shutdown
         } else {
             UE_LOG(LogTemp, Error, TEXT("Failed to start gRPC server"));
@@ -38,6 +154,30 @@ void FUESynthModule::StartupModule() {
 void FUESynthModule::ShutdownModule()
 {
     UE_LOG(LogTemp, Log, TEXT("Shutting down gRPC server..."));
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    // Fleet clients stop picking this instance before it stops answering
+    Registration.Reset();
+    MetricsEndpoint.Reset();
+    // Puts the frame limits back and hands the command queue back to the engine's ticks
+    Lockstep.Reset();
+    // Ends their subscriptions and waits until what they queued is on disk
+    Recordings.Reset();
+    // No new frames from here on; the ones in flight complete with the captures below.
+    Subscriptions.Reset();
+    // Cancels the loads in flight; the spawns and preloads waiting for them are answered
+    AssetCache.Reset();
+    // Completes the captures still in flight while their calls can still be answered.
+    // View families in flight hold references to the extension; let them finish first
+    // so the last one is dropped here, on the game thread.
+    FrameReadback.Reset();
+    if (FrameCapture) {
+        FlushRenderingCommands();
+        FrameCapture.Reset();
+    }
+    if (AsyncServer) {
+        AsyncServer->Shutdown();
+        AsyncServer.Reset();
+    }
     if (GRPCServer) {
         GRPCServer->Shutdown();
     }
@@ -45,6 +185,12 @@ void FUESynthModule::ShutdownModule()
     if (GRPCServerThread.joinable()) {
         GRPCServerThread.join();
     }
+    // No server thread can ask for the health any more
+    Health.Reset();
+    // No call holds a session any more; their worlds go before the queue runs what is left
+    Sessions.Reset();
+    CommandQueue.Reset();
+    SceneContext.Reset();
     UE_LOG(LogTemp, Log, TEXT("gRPC server shutdown complete"));
 }
 
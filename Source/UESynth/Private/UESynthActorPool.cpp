@@ -0,0 +1,157 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthActorPool.h"
+#include "Components/MeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "UESynthActorRegistry.h"
+
+namespace
+{
+
+/** Renames of pooled actors are runtime bookkeeping, never edits to undo or save. */
+constexpr ERenameFlags PoolRenameFlags =
+    REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty;
+
+} // namespace
+
+AActor* FUESynthActorPool::Take(const FSoftObjectPath& Asset, FName Name,
+                                const FTransform& Transform, FUESynthActorRegistry& Actors) {
+  check(IsInGameThread());
+  FAssetStats& AssetStats = Stats.FindOrAdd(Asset);
+  TArray<TWeakObjectPtr<AActor>>* Available = Parked.Find(Asset);
+  AActor* Actor = nullptr;
+  while (Available && !Actor && Available->Num() > 0) {
+    Actor = Available->Pop(/*bAllowShrinking=*/false).Get();
+    if (!IsValid(Actor) || Actor->IsActorBeingDestroyed()) {
+      Actor = nullptr;
+    }
+  }
+  if (Actor && !Actor->Rename(*Name.ToString(), nullptr, PoolRenameFlags | REN_Test)) {
+    // Name is held by some other object; the actor waits for the next spawn
+    Available->Add(Actor);
+    Actor = nullptr;
+  }
+  AssetStats.Parked = Available ? Available->Num() : 0;
+  if (!Actor) {
+    ++AssetStats.Misses;
+    return nullptr;
+  }
+
+  // Back to the state a fresh spawn would be in, with the material of its asset
+  const AActor* Defaults = Actor->GetClass()->GetDefaultObject<AActor>();
+  Actor->Rename(*Name.ToString(), nullptr, PoolRenameFlags);
+  Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+  TInlineComponentArray<UMeshComponent*> Meshes(Actor);
+  for (UMeshComponent* Mesh : Meshes) {
+    Mesh->EmptyOverrideMaterials();
+  }
+  Actor->SetActorHiddenInGame(Defaults->IsHidden());
+  Actor->SetActorEnableCollision(Defaults->GetActorEnableCollision());
+  Actor->SetActorTickEnabled(Defaults->PrimaryActorTick.bStartWithTickEnabled);
+  Actors.AddActor(Actor);
+  ++AssetStats.Hits;
+  return Actor;
+}
+
+void FUESynthActorPool::Track(AActor* Actor, const FSoftObjectPath& Asset) {
+  Origins.Add(Actor, Asset);
+}
+
+bool FUESynthActorPool::Park(AActor* Actor, FUESynthActorRegistry& Actors) {
+  check(IsInGameThread());
+  const FSoftObjectPath* Origin = Origins.Find(Actor);
+  if (!Origin) {
+    return false;
+  }
+  const FSoftObjectPath Asset = *Origin;
+  TArray<TWeakObjectPtr<AActor>>& Available = Parked.FindOrAdd(Asset);
+  if (Available.Num() >= MaxParkedPerAsset || Actor->IsActorBeingDestroyed()) {
+    Origins.Remove(Actor);
+    ++Discarded;
+    return false;
+  }
+
+  // Out of the registry first, which knows it by its current name, then out of the way of the
+  // names clients spawn with
+  Actors.RemoveActor(Actor);
+  Actor->SetActorHiddenInGame(true);
+  Actor->SetActorEnableCollision(false);
+  Actor->SetActorTickEnabled(false);
+  Actor->Rename(*MakeUniqueObjectName(Actor->GetOuter(), Actor->GetClass(),
+                                      FName(TEXT("UESynthParked")))
+                     .ToString(),
+                nullptr, PoolRenameFlags);
+  Available.Add(Actor);
+  Stats.FindOrAdd(Asset).Parked = Available.Num();
+  return true;
+}
+
+void FUESynthActorPool::RemoveActor(AActor* Actor) {
+  FSoftObjectPath Asset;
+  if (!Origins.RemoveAndCopyValue(Actor, Asset)) {
+    return;
+  }
+  if (TArray<TWeakObjectPtr<AActor>>* Available = Parked.Find(Asset)) {
+    Available->Remove(Actor);
+    Stats.FindOrAdd(Asset).Parked = Available->Num();
+  }
+}
+
+void FUESynthActorPool::SetMaxParkedPerAsset(int32 Max) {
+  MaxParkedPerAsset = FMath::Max(Max, 0);
+  TArray<FSoftObjectPath> Assets;
+  Parked.GetKeys(Assets);
+  for (const FSoftObjectPath& Asset : Assets) {
+    Discarded += Trim(Asset, MaxParkedPerAsset);
+  }
+}
+
+void FUESynthActorPool::DestroyParked() {
+  TArray<FSoftObjectPath> Assets;
+  Parked.GetKeys(Assets);
+  for (const FSoftObjectPath& Asset : Assets) {
+    Trim(Asset, 0);
+  }
+  Parked.Reset();
+}
+
+void FUESynthActorPool::Reset() {
+  DestroyParked();
+  Origins.Reset();
+}
+
+int32 FUESynthActorPool::NumParked() const {
+  int32 Num = 0;
+  for (const TPair<FSoftObjectPath, TArray<TWeakObjectPtr<AActor>>>& Pair : Parked) {
+    Num += Pair.Value.Num();
+  }
+  return Num;
+}
+
+void FUESynthActorPool::DestroyActor(AActor* Actor) {
+  UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+  if (World && !World->bIsTearingDown && !Actor->IsActorBeingDestroyed()) {
+    Actor->Destroy();
+  }
+}
+
+int32 FUESynthActorPool::Trim(const FSoftObjectPath& Asset, int32 Max) {
+  TArray<TWeakObjectPtr<AActor>>& Available = Parked.FindChecked(Asset);
+  // Taken out first: destroying an actor calls back into RemoveActor
+  TArray<AActor*> Surplus;
+  while (Available.Num() > Max) {
+    TWeakObjectPtr<AActor> Actor = Available.Pop(/*bAllowShrinking=*/false);
+    Origins.Remove(Actor);
+    if (Actor.IsValid()) {
+      Surplus.Add(Actor.Get());
+    }
+  }
+  Stats.FindOrAdd(Asset).Parked = Available.Num();
+
+  for (AActor* Actor : Surplus) {
+    DestroyActor(Actor);
+  }
+  return Surplus.Num();
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class FUESynthActorRegistry;
+
+/**
+ * Actors parked by DestroyObject for the next spawn of the same asset.
+ *
+ * Domain randomization spawns and destroys hundreds of props per episode, and each spawn pays for
+ * actor construction, component registration and, later, garbage collection. Actors spawned with
+ * SpawnObjectRequest.pooled are tracked here by the asset they were spawned from. Destroying one
+ * parks it instead: hidden, without collision or ticking, renamed out of the way and dropped from
+ * the actor registry. A pooled spawn of the same asset takes a parked actor back, renames it and
+ * moves it into place, and only constructs a new one on a miss. Each asset keeps at most
+ * GetMaxParkedPerAsset() actors; past that, destroyed actors are destroyed for real. Game thread
+ * only.
+ */
+class FUESynthActorPool
+{
+public:
+  static constexpr int32 DefaultMaxParkedPerAsset = 32;
+  /** Most actors an asset can be allowed to keep parked. */
+  static constexpr int32 MaxParkedPerAssetLimit = 1024;
+
+  /** How the pooled spawns of one asset went. */
+  struct FAssetStats
+  {
+    int32 Parked = 0;
+    /** Pooled spawns that took a parked actor back. */
+    uint64 Hits = 0;
+    /** Pooled spawns that found none and constructed an actor. */
+    uint64 Misses = 0;
+  };
+
+  /**
+   * Takes an actor parked for Asset back into the world as Name at Transform and adds it to
+   * Actors. Returns null, counting a miss, when none is parked or Name can't be given to it.
+   */
+  AActor* Take(const FSoftObjectPath& Asset, FName Name, const FTransform& Transform,
+               FUESynthActorRegistry& Actors);
+
+  /** Remembers that Actor was spawned from Asset, so destroying it parks it. */
+  void Track(AActor* Actor, const FSoftObjectPath& Asset);
+
+  /**
+   * Parks a tracked actor and drops it from Actors. False if Actor isn't pooled or its asset has
+   * no room left, in which case the caller destroys it.
+   */
+  bool Park(AActor* Actor, FUESynthActorRegistry& Actors);
+
+  /** Forgets an actor destroyed from outside the pool. */
+  void RemoveActor(AActor* Actor);
+
+  /** Sets how many actors each asset may keep parked, destroying the surplus. */
+  void SetMaxParkedPerAsset(int32 Max);
+  int32 GetMaxParkedPerAsset() const {
+    return MaxParkedPerAsset;
+  }
+
+  /** Destroys every parked actor; tracked actors in the world stay pooled. */
+  void DestroyParked();
+
+  /** Destroys every parked actor and forgets every tracked one; the stats are kept. */
+  void Reset();
+
+  const TMap<FSoftObjectPath, FAssetStats>& GetStats() const {
+    return Stats;
+  }
+  int32 NumParked() const;
+  /** Pooled actors destroyed for real because their asset had enough parked already. */
+  uint64 NumDiscarded() const {
+    return Discarded;
+  }
+
+private:
+  static void DestroyActor(AActor* Actor);
+  /** Destroys the actors parked for Asset beyond the first Max; returns how many. */
+  int32 Trim(const FSoftObjectPath& Asset, int32 Max);
+
+  TMap<TWeakObjectPtr<AActor>, FSoftObjectPath> Origins;
+  TMap<FSoftObjectPath, TArray<TWeakObjectPtr<AActor>>> Parked;
+  TMap<FSoftObjectPath, FAssetStats> Stats;
+  int32 MaxParkedPerAsset = DefaultMaxParkedPerAsset;
+  uint64 Discarded = 0;
+};
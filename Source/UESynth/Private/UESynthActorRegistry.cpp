@@ -0,0 +1,365 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthActorRegistry.h"
+#include "Components/MeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+
+/** Velocity changes below this, in cm/s, are taken for noise from the physics solver. */
+constexpr double VelocityTolerance = 0.01;
+
+/**
+ * How many frames back WasRecentlyRendered looks. Actors are marked as rendered a frame late, so
+ * with less than a frame one drawn every frame would flicker.
+ */
+constexpr float VisibilityFrames = 1.5f;
+
+} // namespace
+
+FUESynthActorRegistry::~FUESynthActorRegistry() {
+  for (TPair<FName, FEntry>& Entry : ActorsByName) {
+    UnwatchTransform(Entry.Value);
+  }
+}
+
+void FUESynthActorRegistry::Rebuild(UWorld* World) {
+  Reset();
+  if (!World) {
+    return;
+  }
+
+  for (TActorIterator<AActor> It(World); It; ++It) {
+    AddActor(*It);
+  }
+}
+
+void FUESynthActorRegistry::Reset() {
+  for (TPair<FName, FEntry>& Entry : ActorsByName) {
+    ReleaseSegmentationId(Entry.Value);
+    UnwatchTransform(Entry.Value);
+  }
+  ActorsByName.Reset();
+  ActorsById.Reset();
+  NextId = 1;
+  // IDs start over, so nothing from before can be diffed against
+  Removed.Reset();
+  ForgottenSequence = ++ChangeSequence;
+#if WITH_EDITOR
+  NamesByLabel.Reset();
+#endif
+}
+
+void FUESynthActorRegistry::AddActor(AActor* Actor) {
+  if (!IsValid(Actor)) {
+    return;
+  }
+
+  const FName Name = Actor->GetFName();
+  FEntry& Entry = ActorsByName.FindOrAdd(Name);
+  if (Entry.Actor.Get() != Actor) {
+    if (Entry.Id != InvalidId) {
+      ActorsById.Remove(Entry.Id);
+      RememberRemoved(Entry.Id);
+    }
+    ReleaseSegmentationId(Entry);
+    UnwatchTransform(Entry);
+    Entry.Actor = Actor;
+    Entry.Id = NextId++;
+    Entry.Sampled = FActorState();
+    ActorsById.Add(Entry.Id, Actor);
+    if (bSegmentationEnabled) {
+      AssignSegmentationId(Entry, Actor);
+    }
+    WatchTransform(Entry, Actor);
+    MarkChanged(Entry);
+  }
+#if WITH_EDITOR
+  const FString Label = Actor->GetActorLabel(/*bCreateIfNone=*/false);
+  if (!Label.IsEmpty()) {
+    // First one wins if two actors share a label; the object name always stays addressable.
+    NamesByLabel.FindOrAdd(FName(*Label), Name);
+  }
+#endif
+}
+
+void FUESynthActorRegistry::RemoveActor(AActor* Actor) {
+  if (!Actor) {
+    return;
+  }
+
+  const FName Name = Actor->GetFName();
+  FEntry* Found = ActorsByName.Find(Name);
+  // A same-named replacement may already have taken the slot; only drop our own entry.
+  if (Found && (!Found->Actor.IsValid() || Found->Actor.Get() == Actor)) {
+    ActorsById.Remove(Found->Id);
+    RememberRemoved(Found->Id);
+    ReleaseSegmentationId(*Found);
+    UnwatchTransform(*Found);
+    ActorsByName.Remove(Name);
+  }
+#if WITH_EDITOR
+  const FString Label = Actor->GetActorLabel(/*bCreateIfNone=*/false);
+  if (!Label.IsEmpty()) {
+    const FName LabelName(*Label);
+    if (const FName* Aliased = NamesByLabel.Find(LabelName); Aliased && *Aliased == Name) {
+      NamesByLabel.Remove(LabelName);
+    }
+  }
+#endif
+}
+
+void FUESynthActorRegistry::AddLevel(ULevel* Level) {
+  if (!Level) {
+    return;
+  }
+  for (AActor* Actor : Level->Actors) {
+    AddActor(Actor);
+  }
+}
+
+void FUESynthActorRegistry::RemoveLevel(ULevel* Level) {
+  if (!Level) {
+    return;
+  }
+  for (AActor* Actor : Level->Actors) {
+    RemoveActor(Actor);
+  }
+}
+
+AActor* FUESynthActorRegistry::FindActor(const FString& Name) const {
+  if (Name.IsEmpty()) {
+    return nullptr;
+  }
+
+  // FNAME_Find never grows the name table for names that have never existed.
+  const FName Key(*Name, FNAME_Find);
+  if (Key.IsNone()) {
+    return nullptr;
+  }
+
+  if (const FEntry* Found = ActorsByName.Find(Key)) {
+    return Found->Actor.Get();
+  }
+#if WITH_EDITOR
+  if (const FName* Aliased = NamesByLabel.Find(Key)) {
+    const FEntry* Found = ActorsByName.Find(*Aliased);
+    return Found ? Found->Actor.Get() : nullptr;
+  }
+#endif
+  return nullptr;
+}
+
+AActor* FUESynthActorRegistry::FindActorById(uint32 Id) const {
+  const TWeakObjectPtr<AActor>* Found = ActorsById.Find(Id);
+  return Found ? Found->Get() : nullptr;
+}
+
+uint32 FUESynthActorRegistry::GetActorId(const AActor* Actor) const {
+  if (!Actor) {
+    return InvalidId;
+  }
+  const FEntry* Found = ActorsByName.Find(Actor->GetFName());
+  return Found && Found->Actor.Get() == Actor ? Found->Id : InvalidId;
+}
+
+void FUESynthActorRegistry::GetActorNames(FName Tag, const UClass* Class,
+                                          TArray<FString>& OutNames,
+                                          TArray<uint32>* OutIds) const {
+  OutNames.Reserve(OutNames.Num() + ActorsByName.Num());
+  if (OutIds) {
+    OutIds->Reserve(OutIds->Num() + ActorsByName.Num());
+  }
+  for (const TPair<FName, FEntry>& Entry : ActorsByName) {
+    const AActor* Actor = Entry.Value.Actor.Get();
+    if (!Actor) {
+      continue;
+    }
+    if (!Tag.IsNone() && !Actor->ActorHasTag(Tag)) {
+      continue;
+    }
+    if (Class && !Actor->IsA(Class)) {
+      continue;
+    }
+    OutNames.Add(Entry.Key.ToString());
+    if (OutIds) {
+      OutIds->Add(Entry.Value.Id);
+    }
+  }
+}
+
+void FUESynthActorRegistry::ForEachChangedActor(
+    uint64 Since, bool bVelocity, bool bVisibility,
+    TFunctionRef<void(AActor& Actor, uint32 Id, FName Name, const FActorState& State)> Visit) {
+  for (TPair<FName, FEntry>& Pair : ActorsByName) {
+    FEntry& Entry = Pair.Value;
+    AActor* Actor = Entry.Actor.Get();
+    if (!Actor) {
+      continue;
+    }
+
+    FActorState State = Entry.Sampled;
+    if (bVelocity) {
+      State.Velocity = Actor->GetVelocity();
+    }
+    if (bVisibility) {
+      const UWorld* World = Actor->GetWorld();
+      State.bVisible =
+          Actor->WasRecentlyRendered(World ? World->GetDeltaSeconds() * VisibilityFrames : 0.f);
+    }
+    if (!State.Velocity.Equals(Entry.Sampled.Velocity, VelocityTolerance) ||
+        State.bVisible != Entry.Sampled.bVisible) {
+      Entry.Sampled = State;
+      MarkChanged(Entry);
+    }
+
+    if (Entry.ChangedSequence > Since) {
+      Visit(*Actor, Entry.Id, Pair.Key, State);
+    }
+  }
+}
+
+void FUESynthActorRegistry::GetRemovedSince(uint64 Since, TArray<uint32>& OutIds) const {
+  // Oldest first, so the ones to send are a suffix
+  int32 First = Removed.Num();
+  while (First > 0 && Removed[First - 1].Key > Since) {
+    --First;
+  }
+  OutIds.Reserve(OutIds.Num() + Removed.Num() - First);
+  for (int32 Index = First; Index < Removed.Num(); ++Index) {
+    OutIds.Add(Removed[Index].Value);
+  }
+}
+
+void FUESynthActorRegistry::WatchTransform(FEntry& Entry, AActor* Actor) {
+  USceneComponent* Root = Actor->GetRootComponent();
+  if (!Root) {
+    return;
+  }
+
+  // Moves are only broadcast for components that ask for them
+  Root->bWantsOnUpdateTransform = true;
+  Entry.Root = Root;
+  Entry.TransformUpdatedHandle = Root->TransformUpdated.AddLambda(
+      [this, Name = Actor->GetFName()](USceneComponent*, EUpdateTransformFlags, ETeleportType) {
+        if (FEntry* Found = ActorsByName.Find(Name)) {
+          MarkChanged(*Found);
+        }
+      });
+}
+
+void FUESynthActorRegistry::UnwatchTransform(FEntry& Entry) {
+  if (USceneComponent* Root = Entry.Root.Get()) {
+    Root->TransformUpdated.Remove(Entry.TransformUpdatedHandle);
+  }
+  Entry.Root.Reset();
+  Entry.TransformUpdatedHandle.Reset();
+}
+
+void FUESynthActorRegistry::RememberRemoved(uint32 Id) {
+  Removed.Emplace(++ChangeSequence, Id);
+  if (Removed.Num() > MaxRemovedRemembered) {
+    // Forget the older half at once rather than shifting the array on every removal
+    const int32 Forget = Removed.Num() / 2;
+    ForgottenSequence = Removed[Forget - 1].Key;
+    Removed.RemoveAt(0, Forget, /*bAllowShrinking=*/false);
+  }
+}
+
+void FUESynthActorRegistry::EnableSegmentation() {
+  if (bSegmentationEnabled) {
+    return;
+  }
+  bSegmentationEnabled = true;
+  for (TPair<FName, FEntry>& Entry : ActorsByName) {
+    if (AActor* Actor = Entry.Value.Actor.Get()) {
+      AssignSegmentationId(Entry.Value, Actor);
+    }
+  }
+}
+
+uint8 FUESynthActorRegistry::GetSegmentationId(const AActor* Actor) const {
+  if (!Actor) {
+    return NoSegmentationId;
+  }
+  const FEntry* Found = ActorsByName.Find(Actor->GetFName());
+  return Found && Found->Actor.Get() == Actor ? Found->SegmentationId : NoSegmentationId;
+}
+
+void FUESynthActorRegistry::ForEachSegmentationId(
+    TFunctionRef<void(uint8 SegmentationId, const FString& Name, uint32 Id)> Visit) const {
+  for (const TPair<FName, FEntry>& Entry : ActorsByName) {
+    if (Entry.Value.SegmentationId != NoSegmentationId && Entry.Value.Actor.IsValid()) {
+      Visit(Entry.Value.SegmentationId, Entry.Key.ToString(), Entry.Value.Id);
+    }
+  }
+}
+
+void FUESynthActorRegistry::AssignSegmentationId(FEntry& Entry, AActor* Actor) {
+  TArray<UMeshComponent*, TInlineAllocator<4>> Meshes;
+  Actor->GetComponents(Meshes);
+  if (Meshes.Num() == 0) {
+    return;
+  }
+
+  for (int32 Attempt = 0; Attempt < 255; ++Attempt) {
+    const uint8 Candidate = NextSegmentationId;
+    NextSegmentationId = NextSegmentationId == 255 ? 1 : NextSegmentationId + 1;
+    if (SegmentationIdsInUse[Candidate]) {
+      continue;
+    }
+
+    SegmentationIdsInUse[Candidate] = true;
+    Entry.SegmentationId = Candidate;
+    BumpSegmentationRevision();
+    for (UMeshComponent* Mesh : Meshes) {
+      Mesh->SetCustomDepthStencilValue(Candidate);
+      Mesh->SetRenderCustomDepth(true);
+    }
+    return;
+  }
+
+  UE_LOG(LogTemp, Warning,
+         TEXT("UESynth: All 255 segmentation IDs are taken; %s renders as background"),
+         *Actor->GetName());
+}
+
+void FUESynthActorRegistry::ReleaseSegmentationId(FEntry& Entry) {
+  if (Entry.SegmentationId == NoSegmentationId) {
+    return;
+  }
+  SegmentationIdsInUse[Entry.SegmentationId] = false;
+  Entry.SegmentationId = NoSegmentationId;
+  BumpSegmentationRevision();
+}
+
+void FUESynthActorRegistry::BumpSegmentationRevision() {
+  // Zero stands for "no table yet" on the client side
+  if (++SegmentationRevision == 0) {
+    SegmentationRevision = 1;
+  }
+}
+
+UClass* FUESynthActorRegistry::ResolveActorClass(const FString& ClassName) {
+  if (ClassName.IsEmpty()) {
+    return nullptr;
+  }
+
+  UClass* Class = nullptr;
+  if (ClassName.Contains(TEXT("."))) {
+    Class = FindObject<UClass>(nullptr, *ClassName);
+  } else {
+    Class = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+    if (!Class && ClassName.Len() > 1 && ClassName[0] == TEXT('A')) {
+      Class = FindFirstObject<UClass>(*ClassName.RightChop(1), EFindFirstObjectOptions::NativeFirst);
+    }
+  }
+
+  return Class && Class->IsChildOf(AActor::StaticClass()) ? Class : nullptr;
+}
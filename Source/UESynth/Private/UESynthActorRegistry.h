@@ -0,0 +1,185 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class ULevel;
+class USceneComponent;
+class UWorld;
+
+/**
+ * Name-indexed set of the actors in the bound world.
+ *
+ * Object handlers look actors up by name thousands of times per episode, so instead of walking the
+ * level on every call the registry is built with one pass when a world is bound and then kept
+ * current by the scene context's spawn/destroy and level streaming hooks. Lookups are a single hash
+ * probe and listing iterates the index, never the level. Every addition, removal and move of an
+ * actor is stamped with a change sequence number, so scene snapshots can send only what changed
+ * since the one a client holds. Game thread only.
+ */
+class FUESynthActorRegistry
+{
+public:
+  FUESynthActorRegistry() = default;
+  ~FUESynthActorRegistry();
+
+  FUESynthActorRegistry(const FUESynthActorRegistry&) = delete;
+  FUESynthActorRegistry& operator=(const FUESynthActorRegistry&) = delete;
+
+  /** Replaces the index with every actor currently in World. */
+  void Rebuild(UWorld* World);
+
+  /** Drops every entry. */
+  void Reset();
+
+  void AddActor(AActor* Actor);
+  void RemoveActor(AActor* Actor);
+
+  /** Adds or removes every actor of a level that was streamed in or out. */
+  void AddLevel(ULevel* Level);
+  void RemoveLevel(ULevel* Level);
+
+  /** Finds an actor by object name (or editor label); null if it is unknown or gone. */
+  AActor* FindActor(const FString& Name) const;
+
+  /** Finds an actor by the ID it was registered under; null if it is unknown or gone. */
+  AActor* FindActorById(uint32 Id) const;
+
+  /** The registry ID of an actor, or InvalidId if it isn't registered. */
+  uint32 GetActorId(const AActor* Actor) const;
+
+  /**
+   * Appends the names of registered actors to OutNames, and their IDs to OutIds when given. A Tag
+   * other than NAME_None keeps only actors carrying that tag and a non-null Class keeps only actors
+   * of that class or a subclass.
+   */
+  void GetActorNames(FName Tag, const UClass* Class, TArray<FString>& OutNames,
+                     TArray<uint32>* OutIds = nullptr) const;
+
+  /** Number of live entries, not counting label aliases. */
+  int32 Num() const { return ActorsByName.Num(); }
+
+  /**
+   * Resolves a class filter given either as a path ("/Script/Engine.StaticMeshActor") or a short
+   * name, with or without the native "A" prefix. Returns null for unknown or non-actor classes.
+   */
+  static UClass* ResolveActorClass(const FString& ClassName);
+
+  /**
+   * IDs are handed out once per registered actor and never reused while the world stays bound, so
+   * clients can address actors by a small integer instead of a string. Zero is never assigned.
+   */
+  static constexpr uint32 InvalidId = 0;
+
+  /**
+   * Starts rendering every registered actor with a mesh, and every one registered later, into
+   * custom depth with its segmentation ID as the stencil value.
+   */
+  void EnableSegmentation();
+
+  bool IsSegmentationEnabled() const { return bSegmentationEnabled; }
+
+  /** The segmentation ID of an actor, or NoSegmentationId. */
+  uint8 GetSegmentationId(const AActor* Actor) const;
+
+  /**
+   * Bumped whenever a segmentation ID is assigned or released, so clients can tell whether the
+   * table they hold is still current. Never zero.
+   */
+  uint32 GetSegmentationRevision() const { return SegmentationRevision; }
+
+  /** Calls Visit with the segmentation ID, name and registry ID of every actor holding one. */
+  void ForEachSegmentationId(
+      TFunctionRef<void(uint8 SegmentationId, const FString& Name, uint32 Id)> Visit) const;
+
+  /**
+   * Segmentation IDs are the 8-bit stencil values actors render with, 1 to 255. They are handed
+   * out round-robin so a freed value isn't reused by the very next spawn while frames showing the
+   * old owner may still be in flight. Zero is background, and what actors past the 255th get.
+   */
+  static constexpr uint8 NoSegmentationId = 0;
+
+  /** What a scene snapshot reports of an actor besides its transform. */
+  struct FActorState
+  {
+    FVector Velocity = FVector::ZeroVector;
+    /** Drawn by a view or scene capture in the last frame rendered. */
+    bool bVisible = false;
+  };
+
+  /**
+   * The sequence number of the last change: an actor added, removed, or moved as its root component
+   * reports. It only grows, across worlds too, so it tells a client what it has seen.
+   */
+  uint64 GetChangeSequence() const { return ChangeSequence; }
+
+  /**
+   * Whether the changes after Since are all still known. Removals are only remembered for the last
+   * MaxRemovedRemembered, and none from before the world was bound; a client from before then has
+   * to start over from a full snapshot.
+   */
+  bool CanDiffSince(uint64 Since) const {
+    return Since >= ForgottenSequence && Since <= ChangeSequence;
+  }
+
+  /**
+   * Calls Visit for every registered actor changed after Since, or for every one with 0. Velocity
+   * and visibility raise no events, so with bVelocity or bVisibility they are read from every actor
+   * and one that differs from when it was last read is a change too.
+   */
+  void ForEachChangedActor(
+      uint64 Since, bool bVelocity, bool bVisibility,
+      TFunctionRef<void(AActor& Actor, uint32 Id, FName Name, const FActorState& State)> Visit);
+
+  /** Appends the IDs of the actors removed after Since. */
+  void GetRemovedSince(uint64 Since, TArray<uint32>& OutIds) const;
+
+  static constexpr int32 MaxRemovedRemembered = 4096;
+
+private:
+  struct FEntry
+  {
+    TWeakObjectPtr<AActor> Actor;
+    uint32 Id = InvalidId;
+    uint8 SegmentationId = NoSegmentationId;
+    /** Of the last change to the actor. */
+    uint64 ChangedSequence = 0;
+    /** The root component whose moves are watched, and the watch. */
+    TWeakObjectPtr<USceneComponent> Root;
+    FDelegateHandle TransformUpdatedHandle;
+    /** What ForEachChangedActor read last, to tell whether it changed. */
+    FActorState Sampled;
+  };
+
+  void AssignSegmentationId(FEntry& Entry, AActor* Actor);
+  void ReleaseSegmentationId(FEntry& Entry);
+  void BumpSegmentationRevision();
+
+  void MarkChanged(FEntry& Entry) { Entry.ChangedSequence = ++ChangeSequence; }
+  void WatchTransform(FEntry& Entry, AActor* Actor);
+  static void UnwatchTransform(FEntry& Entry);
+  void RememberRemoved(uint32 Id);
+
+  TMap<FName, FEntry> ActorsByName;
+  TMap<uint32, TWeakObjectPtr<AActor>> ActorsById;
+  uint32 NextId = 1;
+
+  bool bSegmentationEnabled = false;
+  bool SegmentationIdsInUse[256] = {};
+  uint8 NextSegmentationId = 1;
+  uint32 SegmentationRevision = 1;
+
+  uint64 ChangeSequence = 0;
+  /** Removals up to this sequence number may have been forgotten. */
+  uint64 ForgottenSequence = 0;
+  /** The IDs removed since then, with the sequence number of each removal, oldest first. */
+  TArray<TPair<uint64, uint32>> Removed;
+#if WITH_EDITOR
+  /** Outliner labels mapped to object names, so clients can address actors as they appear. */
+  TMap<FName, FName> NamesByLabel;
+#endif
+};
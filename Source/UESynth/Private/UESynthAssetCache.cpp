@@ -0,0 +1,156 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthAssetCache.h"
+
+FUESynthAssetCache* FUESynthAssetCache::Instance = nullptr;
+
+FUESynthAssetCache::FUESynthAssetCache() {
+  check(Instance == nullptr);
+  Instance = this;
+}
+
+FUESynthAssetCache::~FUESynthAssetCache() {
+  // Loads still in flight must not call back into a cache that is gone; whoever waits for them
+  // hears they failed
+  TArray<FOnLoaded> Waiters;
+  for (TPair<FSoftObjectPath, FEntry>& Pair : Entries) {
+    if (Pair.Value.Handle.IsValid()) {
+      Pair.Value.Handle->CancelHandle();
+    }
+    Waiters.Append(MoveTemp(Pair.Value.Waiters));
+  }
+  Entries.Reset();
+  for (FOnLoaded& OnLoaded : Waiters) {
+    OnLoaded(nullptr);
+  }
+  Instance = nullptr;
+}
+
+FUESynthAssetCache& FUESynthAssetCache::Get() {
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+bool FUESynthAssetCache::IsAvailable() {
+  return Instance != nullptr;
+}
+
+UObject* FUESynthAssetCache::Find(const FSoftObjectPath& Path) {
+  check(IsInGameThread());
+  FEntry* Entry = Entries.Find(Path);
+  if (!Entry || Entry->State != EUESynthAssetState::Resident) {
+    return nullptr;
+  }
+  Entry->LastUsed = ++UseCount;
+  return Entry->Handle->GetLoadedAsset();
+}
+
+void FUESynthAssetCache::Load(const FSoftObjectPath& Path, FOnLoaded&& OnLoaded) {
+  check(IsInGameThread());
+  FEntry& Entry = Entries.FindOrAdd(Path);
+  Entry.LastUsed = ++UseCount;
+  if (Entry.State == EUESynthAssetState::Resident) {
+    if (OnLoaded) {
+      OnLoaded(Entry.Handle->GetLoadedAsset());
+    }
+    return;
+  }
+  if (OnLoaded) {
+    Entry.Waiters.Add(MoveTemp(OnLoaded));
+  }
+  if (Entry.State == EUESynthAssetState::Loading) {
+    return;
+  }
+
+  Entry.State = EUESynthAssetState::Loading;
+  // An asset in memory already completes within the request, before the entry has its handle
+  bInRequest = true;
+  TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
+      Path, FStreamableDelegate::CreateRaw(this, &FUESynthAssetCache::OnLoadComplete, Path),
+      FStreamableManager::DefaultAsyncLoadPriority);
+  bInRequest = false;
+  Entries.FindChecked(Path).Handle = Handle;
+  if (!Handle.IsValid() || Handle->HasLoadCompleted()) {
+    OnLoadComplete(Path);
+  }
+}
+
+EUESynthAssetState FUESynthAssetCache::GetState(const FSoftObjectPath& Path) const {
+  const FEntry* Entry = Entries.Find(Path);
+  return Entry ? Entry->State : EUESynthAssetState::NotLoaded;
+}
+
+uint64 FUESynthAssetCache::GetResidentBytes(const FSoftObjectPath& Path) const {
+  const FEntry* Entry = Entries.Find(Path);
+  return Entry && Entry->State == EUESynthAssetState::Resident ? Entry->Bytes : 0;
+}
+
+void FUESynthAssetCache::SetBudget(uint64 Bytes) {
+  BudgetBytes = Bytes;
+  Trim(FSoftObjectPath());
+}
+
+void FUESynthAssetCache::Reset() {
+  for (auto It = Entries.CreateIterator(); It; ++It) {
+    if (It->Value.State == EUESynthAssetState::Loading) {
+      continue;
+    }
+    if (It->Value.Handle.IsValid()) {
+      It->Value.Handle->ReleaseHandle();
+    }
+    It.RemoveCurrent();
+  }
+  TotalBytes = 0;
+}
+
+void FUESynthAssetCache::OnLoadComplete(FSoftObjectPath Path) {
+  FEntry* Entry = Entries.Find(Path);
+  if (!Entry || Entry->State != EUESynthAssetState::Loading || bInRequest) {
+    // Called from inside the request; Load finishes the job once it has the handle
+    return;
+  }
+
+  UObject* Asset = Entry->Handle.IsValid() ? Entry->Handle->GetLoadedAsset() : nullptr;
+  if (Asset) {
+    Entry->State = EUESynthAssetState::Resident;
+    Entry->Bytes = uint64(Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal));
+    TotalBytes += Entry->Bytes;
+  } else {
+    UE_LOG(LogTemp, Warning, TEXT("UESynth: Could not load asset '%s'"), *Path.ToString());
+    Entry->State = EUESynthAssetState::Failed;
+    Entry->Handle.Reset();
+  }
+
+  // Waiters may load or find other assets, which can move the entry
+  TArray<FOnLoaded> Waiters = MoveTemp(Entry->Waiters);
+  Trim(Path);
+  for (FOnLoaded& OnLoaded : Waiters) {
+    OnLoaded(Asset);
+  }
+}
+
+void FUESynthAssetCache::Trim(const FSoftObjectPath& Keep) {
+  if (TotalBytes <= BudgetBytes) {
+    return;
+  }
+
+  TArray<TPair<uint64, FSoftObjectPath>> Resident;
+  for (const TPair<FSoftObjectPath, FEntry>& Pair : Entries) {
+    if (Pair.Value.State == EUESynthAssetState::Resident && Pair.Key != Keep) {
+      Resident.Emplace(Pair.Value.LastUsed, Pair.Key);
+    }
+  }
+  Resident.Sort([](const auto& A, const auto& B) { return A.Key < B.Key; });
+
+  // Only the cache's hold goes; actors spawned from an asset keep it loaded
+  for (const TPair<uint64, FSoftObjectPath>& Candidate : Resident) {
+    if (TotalBytes <= BudgetBytes) {
+      break;
+    }
+    FEntry& Evicted = Entries.FindChecked(Candidate.Value);
+    TotalBytes -= Evicted.Bytes;
+    Evicted.Handle->ReleaseHandle();
+    Entries.Remove(Candidate.Value);
+  }
+}
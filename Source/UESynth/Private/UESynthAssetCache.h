@@ -0,0 +1,103 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/SoftObjectPath.h"
+
+/** Where an asset stands in FUESynthAssetCache. */
+enum class EUESynthAssetState : uint8
+{
+  NotLoaded,
+  Loading,
+  Resident,
+  /** The last load found nothing loadable at the path; the next request tries again. */
+  Failed
+};
+
+/**
+ * Assets streamed in ahead of the spawns that use them.
+ *
+ * Loading a mesh or Blueprint with LoadObject in the middle of a spawn stalls the game thread for
+ * as long as the package takes to load, tens of milliseconds for a single prop. Assets go through
+ * FStreamableManager instead, loading asynchronously while frames keep rendering, and the cache
+ * holds the handles of the loaded ones so a spawn finds them resident. Resident assets are kept
+ * in least-recently-used order within a memory budget, estimated from each asset's resource size;
+ * past it the least recently used ones are let go, and unloaded by the next garbage collection
+ * once nothing spawned from them is left. Game thread only.
+ */
+class FUESynthAssetCache
+{
+public:
+  static constexpr uint64 DefaultBudgetBytes = 1024ull << 20;
+
+  /** Called with the loaded asset, or null if it failed to load. */
+  using FOnLoaded = TUniqueFunction<void(UObject* Asset)>;
+
+  FUESynthAssetCache();
+  ~FUESynthAssetCache();
+
+  FUESynthAssetCache(const FUESynthAssetCache&) = delete;
+  FUESynthAssetCache& operator=(const FUESynthAssetCache&) = delete;
+
+  /** The module-owned cache. Only valid while the UESynth module is loaded. */
+  static FUESynthAssetCache& Get();
+  static bool IsAvailable();
+
+  /** The asset at Path if the cache holds it, counting as its most recent use; else null. */
+  UObject* Find(const FSoftObjectPath& Path);
+
+  /**
+   * Streams Path in unless it is resident or loading already. OnLoaded, if given, runs once it is
+   * resident or has failed; right away when it is resident already.
+   */
+  void Load(const FSoftObjectPath& Path, FOnLoaded&& OnLoaded = nullptr);
+
+  EUESynthAssetState GetState(const FSoftObjectPath& Path) const;
+
+  /** Estimated size of a resident asset, or 0. */
+  uint64 GetResidentBytes(const FSoftObjectPath& Path) const;
+
+  /** Sets the budget and lets go of assets until the cache fits in it. */
+  void SetBudget(uint64 Bytes);
+
+  uint64 GetBudget() const {
+    return BudgetBytes;
+  }
+  uint64 GetTotalBytes() const {
+    return TotalBytes;
+  }
+  int32 Num() const {
+    return Entries.Num();
+  }
+
+  /** Lets go of every asset but the ones still loading, whose waiters still get them. */
+  void Reset();
+
+private:
+  struct FEntry
+  {
+    EUESynthAssetState State = EUESynthAssetState::NotLoaded;
+    TSharedPtr<FStreamableHandle> Handle;
+    uint64 Bytes = 0;
+    /** Value of UseCount when the asset was last found or loaded. */
+    uint64 LastUsed = 0;
+    TArray<FOnLoaded> Waiters;
+  };
+
+  void OnLoadComplete(FSoftObjectPath Path);
+
+  /** Lets go of the least recently used resident assets, but Keep, until the budget is met. */
+  void Trim(const FSoftObjectPath& Keep);
+
+  FStreamableManager Streamable;
+  TMap<FSoftObjectPath, FEntry> Entries;
+  uint64 BudgetBytes = DefaultBudgetBytes;
+  uint64 TotalBytes = 0;
+  uint64 UseCount = 0;
+  bool bInRequest = false;
+
+  static FUESynthAssetCache* Instance;
+};
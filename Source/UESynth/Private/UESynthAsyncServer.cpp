@@ -0,0 +1,737 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthAsyncServer.h"
+#include "UESynthCancellation.h"
+#include "UESynthCommandQueue.h"
+#include "UESynthControlStream.h"
+#include "UESynthMessageArena.h"
+#include "UESynthServerStats.h"
+#include "UESynthSessions.h"
+#include "UESynthSharedMemory.h"
+#include "UESynthSubscriptions.h"
+#include "UESynthWriteQueue.h"
+#include <chrono>
+#include <mutex>
+
+namespace {
+
+using FAsyncService = uesynth::UESynthService::AsyncService;
+
+/** Everything a pending call needs to re-arm itself and reach the handlers. */
+struct FCallEnvironment
+{
+  FAsyncService* Service;
+  UESynthServiceImpl* Handlers;
+  grpc::ServerCompletionQueue* Queue;
+  std::shared_ptr<std::atomic<bool>> bAcceptingWork;
+};
+
+/** Completion-queue tag; every pending operation resolves to one of these. */
+class FAsyncCallTag
+{
+public:
+  virtual ~FAsyncCallTag() = default;
+  virtual void Proceed(bool bOk) = 0;
+};
+
+/**
+ * One unary call: waits for a request, runs the handler in the game thread's command-queue drain
+ * and finishes the RPC from there. Deferred handlers (captures) finish it from whichever thread
+ * completes them instead, and inline ones (stats) run on the polling thread without waiting for
+ * the game thread at all. A call cancelled by its client, or past its deadline, by the time the
+ * game thread gets to it is answered without running, and its captures are dropped at the next
+ * stage they reach.
+ */
+template <typename RequestT, typename ReplyT>
+class TUnaryCall final : public FAsyncCallTag
+{
+public:
+  using FRequestMethod = void (FAsyncService::*)(grpc::ServerContext*, RequestT*,
+                                                 grpc::ServerAsyncResponseWriter<ReplyT>*,
+                                                 grpc::CompletionQueue*,
+                                                 grpc::ServerCompletionQueue*, void*);
+  using FHandlerMethod = grpc::Status (UESynthServiceImpl::*)(grpc::ServerContext*,
+                                                              const RequestT*, ReplyT*);
+  using FDeferredHandlerMethod = void (UESynthServiceImpl::*)(const RequestT&, ReplyT*,
+                                                              UESynthServiceImpl::FReplyCallback&&);
+
+  /** How calls of one method are accepted and handled; shared by every call of it. */
+  struct FMethod
+  {
+    FName Name;
+    EUESynthCommandKind Kind = EUESynthCommandKind::Query;
+    FRequestMethod RequestMethod = nullptr;
+    FHandlerMethod HandlerMethod = nullptr;
+    FDeferredHandlerMethod DeferredHandlerMethod = nullptr;
+    bool bInline = false;
+  };
+
+  static void Listen(const FCallEnvironment& Env, const FMethod& Method) {
+    new TUnaryCall(Env, Method);
+  }
+
+  virtual void Proceed(bool bOk) override {
+    if (!bFinishing && !bOk) {
+      // Never started, so the done tag won't come either
+      delete this;
+      return;
+    }
+    if (bFinishing) {
+      if (bOk) {
+        FUESynthServerStats::Get().RecordStage(EUESynthStage::Write,
+                                               FPlatformTime::Seconds() - FinishSeconds);
+        Timer->OnFinished(FinalStatus);
+      }
+      Release();
+      return;
+    }
+
+    // Accept the next call for this method before handling this one
+    if (*Env.bAcceptingWork) {
+      Listen(Env, Method);
+    }
+
+    bFinishing = true;
+    Timer.Emplace(Method.Name);
+    Cancellation->SetDeadline(Context.deadline());
+    if (Method.bInline) {
+      Finish((Env.Handlers->*Method.HandlerMethod)(&Context, &Request, &Reply));
+      return;
+    }
+    FUESynthCommandQueue::Get().Enqueue(Method.Kind, [this,
+                                                      bAcceptingWork = Env.bAcceptingWork]() {
+      if (!*bAcceptingWork) {
+        // The server was torn down while this call was queued, so nothing can be finished any
+        // more; let go of the finish tag's reference and the done tag's takes the call with it.
+        Release();
+        return;
+      }
+      if (Cancellation->IsCancelled()) {
+        FUESynthServerStats::Get().OnWorkDropped();
+        Finish(Cancellation->GetStatus());
+        return;
+      }
+      Timer->OnStarted();
+      FUESynthStageScope GameThread(EUESynthStage::GameThread);
+      FUESynthCancellation::FScope CancellationScope(&Cancellation.Get());
+      if (Method.DeferredHandlerMethod) {
+        (Env.Handlers->*Method.DeferredHandlerMethod)(
+            Request, &Reply, [this, bAcceptingWork](const grpc::Status& Status) {
+              if (!*bAcceptingWork) {
+                Release();
+              } else if (!Status.ok() && Cancellation->IsCancelled()) {
+                // Dropped along the way; say why rather than which stage
+                Finish(Cancellation->GetStatus());
+              } else {
+                Finish(Status);
+              }
+            });
+        return;
+      }
+      Finish((Env.Handlers->*Method.HandlerMethod)(&Context, &Request, &Reply));
+    });
+  }
+
+private:
+  /** Tells whether the client cancelled once the call is over, one way or the other. */
+  class FDoneTag final : public FAsyncCallTag
+  {
+  public:
+    explicit FDoneTag(TUnaryCall& InOwner) : Owner(InOwner) {}
+
+    virtual void Proceed(bool bOk) override {
+      if (Owner.Context.IsCancelled()) {
+        Owner.Cancellation->Cancel();
+      }
+      Owner.Release();
+    }
+
+  private:
+    TUnaryCall& Owner;
+  };
+
+  TUnaryCall(const FCallEnvironment& InEnv, const FMethod& InMethod)
+      : Env(InEnv), Method(InMethod), Responder(&Context), DoneTag(*this) {
+    Context.AsyncNotifyWhenDone(&DoneTag);
+    (Env.Service->*Method.RequestMethod)(&Context, &Request, &Responder, Env.Queue, Env.Queue,
+                                         this);
+  }
+
+  /** Deletes the call once both its finish and its done tag are back. */
+  void Release() {
+    if (--Refs == 0) {
+      delete this;
+    }
+  }
+
+  void Finish(const grpc::Status& Status) {
+    FinalStatus = Status;
+    FinishSeconds = FPlatformTime::Seconds();
+    Responder.Finish(Reply, Status, this);
+  }
+
+  FCallEnvironment Env;
+  FMethod Method;
+
+  grpc::ServerContext Context;
+  RequestT Request;
+  ReplyT Reply;
+  grpc::ServerAsyncResponseWriter<ReplyT> Responder;
+  FDoneTag DoneTag;
+  std::atomic<int32> Refs{2};
+  bool bFinishing = false;
+  // Shared with the work the call posts; cancelled by the done tag
+  const TSharedRef<FUESynthCancellation> Cancellation = MakeShared<FUESynthCancellation>();
+
+  // Set once the request has arrived
+  TOptional<FUESynthCallTimer> Timer;
+  grpc::Status FinalStatus;
+  double FinishSeconds = 0.0;
+};
+
+template <typename RequestT, typename ReplyT>
+void ListenUnary(const FCallEnvironment& Env, const char* Name, EUESynthCommandKind Kind,
+                 grpc::Status (UESynthServiceImpl::*HandlerMethod)(grpc::ServerContext*,
+                                                                   const RequestT*, ReplyT*),
+                 typename TUnaryCall<RequestT, ReplyT>::FRequestMethod RequestMethod) {
+  TUnaryCall<RequestT, ReplyT>::Listen(Env, {FName(Name), Kind, RequestMethod, HandlerMethod});
+}
+
+/** ListenUnary for a handler that completes through a callback once its work lands. */
+template <typename RequestT, typename ReplyT>
+void ListenDeferredUnary(
+    const FCallEnvironment& Env, const char* Name, EUESynthCommandKind Kind,
+    void (UESynthServiceImpl::*DeferredHandlerMethod)(const RequestT&, ReplyT*,
+                                                      UESynthServiceImpl::FReplyCallback&&),
+    typename TUnaryCall<RequestT, ReplyT>::FRequestMethod RequestMethod) {
+  TUnaryCall<RequestT, ReplyT>::Listen(
+      Env, {FName(Name), Kind, RequestMethod, nullptr, DeferredHandlerMethod});
+}
+
+/** ListenUnary for a handler that is safe on any thread, run on the polling thread. */
+template <typename RequestT, typename ReplyT>
+void ListenInlineUnary(const FCallEnvironment& Env, const char* Name,
+                       grpc::Status (UESynthServiceImpl::*HandlerMethod)(grpc::ServerContext*,
+                                                                         const RequestT*,
+                                                                         ReplyT*),
+                       typename TUnaryCall<RequestT, ReplyT>::FRequestMethod RequestMethod) {
+  TUnaryCall<RequestT, ReplyT>::Listen(Env, {FName(Name), EUESynthCommandKind::Query,
+                                             RequestMethod, HandlerMethod, nullptr,
+                                             /*bInline=*/true});
+}
+
+/**
+ * Async counterpart of FUESynthControlStream: keeps a read posted while the in-flight window and
+ * the outbound queue have room, runs each action on the game thread and writes responses one at a
+ * time as they complete. Once the client cancels, a write fails or the deadline passes, the
+ * actions still queued or capturing are dropped.
+ */
+class FControlStreamCall final : public IUESynthFrameSink
+{
+public:
+  static void Listen(const FCallEnvironment& Env) {
+    new FControlStreamCall(Env);
+  }
+
+  virtual ~FControlStreamCall() override {
+    Link->Detach();
+    if (bOpened) {
+      FUESynthServerStats::Get().OnStreamClosed();
+    }
+  }
+
+  //~ Begin IUESynthFrameSink interface
+  virtual int32 GetNumQueued() const override {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    return Outbound.Num();
+  }
+
+  virtual bool Push(uesynth::FrameResponse&& Response) override {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (bReadsDone || bBroken || bFinishing) {
+      return false;
+    }
+    ++InFlight;
+    EnqueueLocked(MoveTemp(Response));
+    return true;
+  }
+
+  virtual FUESynthWriteQueueStats GetWriteQueueStats() const override {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    return Outbound.GetStats();
+  }
+  //~ End IUESynthFrameSink interface
+
+private:
+  enum class EOp : uint8
+  {
+    Connect,
+    Read,
+    Write,
+    Finish,
+    Done
+  };
+
+  class FOpTag final : public FAsyncCallTag
+  {
+  public:
+    FOpTag(FControlStreamCall& InOwner, EOp InOp) : Owner(InOwner), Op(InOp) {}
+
+    virtual void Proceed(bool bOk) override {
+      Owner.OnOpComplete(Op, bOk);
+    }
+
+  private:
+    FControlStreamCall& Owner;
+    EOp Op;
+  };
+
+  explicit FControlStreamCall(const FCallEnvironment& InEnv)
+      : Env(InEnv), Stream(&Context), ConnectTag(*this, EOp::Connect),
+        ReadTag(*this, EOp::Read), WriteTag(*this, EOp::Write), FinishTag(*this, EOp::Finish),
+        DoneTag(*this, EOp::Done), Link(MakeShared<FUESynthStreamLink>(this)) {
+    Context.AsyncNotifyWhenDone(&DoneTag);
+    Env.Service->RequestControlStream(&Context, &Stream, Env.Queue, Env.Queue, &ConnectTag);
+  }
+
+  void OnOpComplete(EOp Op, bool bOk) {
+    if (Op == EOp::Connect && !bOk) {
+      // Never started, so the done tag won't come either
+      delete this;
+      return;
+    }
+    // Both come back on this polling thread, in either order; the call goes once both have
+    if (Op == EOp::Finish || Op == EOp::Done) {
+      if (Op == EOp::Done && Context.IsCancelled()) {
+        Cancellation->Cancel();
+      }
+      // The finish may have been issued by an action completing on another thread, which
+      // still holds the lock until it returns; wait for it to let go before the call goes
+      bool bDelete = false;
+      {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (Op == EOp::Finish) {
+          bFinished = true;
+        } else {
+          bDoneNotified = true;
+        }
+        bDelete = CanDeleteLocked();
+      }
+      if (bDelete) {
+        delete this;
+      }
+      return;
+    }
+
+    if (Op == EOp::Connect && *Env.bAcceptingWork) {
+      Listen(Env);
+    }
+
+    std::lock_guard<std::mutex> Lock(Mutex);
+    switch (Op) {
+    case EOp::Connect: {
+      const grpc::Status SessionStatus = FUESynthSessions::Get().FromMetadata(&Context, &Session);
+      if (!SessionStatus.ok()) {
+        // Nothing was read, so nothing is in flight
+        bFinishing = true;
+        Stream.Finish(SessionStatus, &FinishTag);
+        return;
+      }
+      bOpened = true;
+      FUESynthServerStats::Get().OnStreamOpened();
+      Cancellation->SetDeadline(Context.deadline());
+      MaxInFlight = FUESynthControlStream::GetRequestedMaxInFlight(&Context);
+      Outbound = FUESynthWriteQueue::FromMetadata(&Context);
+      StartReadLocked();
+      break;
+    }
+
+    case EOp::Read:
+      bReading = false;
+      if (!bOk) {
+        // Client half-closed the stream (or it broke)
+        bReadsDone = true;
+        break;
+      }
+      ++InFlight;
+      Dispatch(MoveTemp(IncomingArena), IncomingRequest);
+      IncomingRequest = nullptr;
+      StartReadLocked();
+      break;
+
+    case EOp::Write:
+      if (bOk) {
+        FUESynthServerStats::Get().RecordStage(EUESynthStage::Write,
+                                               FPlatformTime::Seconds() - WriteStartSeconds);
+      }
+      // Serialized by now; the payloads are free for the next frames and the arena for the next
+      // action
+      UESynthImageBuffers::Reclaim(&OutgoingResponse.Get());
+      OutgoingResponse = FUESynthQueuedResponse();
+      bWriting = false;
+      --InFlight;
+      if (!bOk) {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write response to client stream"));
+        bBroken = true;
+        Cancellation->Cancel();
+        InFlight -= Outbound.Reset();
+      }
+      StartWriteLocked();
+      StartReadLocked();
+      break;
+
+    default:
+      break;
+    }
+    MaybeFinishLocked();
+  }
+
+  /** Runs Request, which lives on Arena, on the game thread; the arena goes with the call. */
+  void Dispatch(FUESynthMessageArena&& Arena, const uesynth::ActionRequest* Request) {
+    const EUESynthCommandKind Kind = UESynthServiceImpl::GetActionKind(*Request);
+    FUESynthCallTimer Timer(FUESynthServerStats::GetActionName(*Request));
+    FUESynthSessions::Enqueue(Session, Kind, [this, Arena = MoveTemp(Arena), Request,
+                                              Timer = MoveTemp(Timer),
+                                              bAcceptingWork = Env.bAcceptingWork]() mutable {
+      if (!*bAcceptingWork) {
+        AbandonAction();
+        return;
+      }
+      if (Cancellation->IsCancelled()) {
+        FUESynthServerStats::Get().OnWorkDropped();
+        const grpc::Status Status = Cancellation->GetStatus();
+        Timer.OnFinished(Status);
+        OnActionCompleted(FUESynthQueuedResponse(), Status);
+        return;
+      }
+      Timer.OnStarted();
+      FUESynthStageScope GameThread(EUESynthStage::GameThread);
+      FUESynthCancellation::FScope CancellationScope(&Cancellation.Get());
+      if (UESynthServiceImpl::IsStreamedAction(*Request)) {
+        // Each response takes a slot of its own; the action's slot is released with OnDone.
+        Env.Handlers->StreamActionOnGameThread(
+            *Request,
+            [this, bAcceptingWork](uesynth::FrameResponse&& Response) {
+              if (*bAcceptingWork) {
+                OnStreamedResponse(MoveTemp(Response));
+              }
+            },
+            [this, bAcceptingWork, Timer = MoveTemp(Timer)](const grpc::Status& Status) mutable {
+              Timer.OnFinished(Status);
+              if (*bAcceptingWork) {
+                OnActionCompleted(FUESynthQueuedResponse(), Status);
+              } else {
+                AbandonAction();
+              }
+            });
+        return;
+      }
+      // Captures finish on a background thread, so the response and its arena live with the
+      // callback, then with the queue until written.
+      FUESynthMessageArena ResponseArena = FUESynthMessageArena::Acquire();
+      uesynth::FrameResponse* Response = ResponseArena.Create<uesynth::FrameResponse>();
+      Env.Handlers->ProcessActionOnGameThread(
+          *Request, Response,
+          [this, bAcceptingWork, ResponseArena = MoveTemp(ResponseArena), Response,
+           Timer = MoveTemp(Timer)](const grpc::Status& Status) mutable {
+            Timer.OnFinished(Status);
+            if (*bAcceptingWork) {
+              OnActionCompleted(FUESynthQueuedResponse(MoveTemp(ResponseArena), Response),
+                                Status);
+            } else {
+              AbandonAction();
+            }
+          },
+          Link);
+    });
+  }
+
+  void OnActionCompleted(FUESynthQueuedResponse&& Response, const grpc::Status& Status) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (!Status.ok() && Cancellation->IsCancelled()) {
+      // Dropped; nobody is waiting to hear why
+      --InFlight;
+    } else if (!Status.ok()) {
+      // Log error and continue processing other requests
+      UE_LOG(LogTemp, Error, TEXT("Error processing action: %s"),
+             *FString(Status.error_message().c_str()));
+      --InFlight;
+    } else if (Response.Get().response_case() == uesynth::FrameResponse::RESPONSE_NOT_SET ||
+               bBroken) {
+      --InFlight;
+    } else {
+      EnqueueLocked(MoveTemp(Response));
+    }
+    StartReadLocked();
+    MaybeFinishLocked();
+  }
+
+  /**
+   * Gives back the slot of an action the torn-down server won't answer. Its queue takes no more
+   * operations, so the call goes once nothing else of it is outstanding.
+   */
+  void AbandonAction() {
+    bool bDelete = false;
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      --InFlight;
+      bDelete = CanDeleteLocked();
+    }
+    if (bDelete) {
+      delete this;
+    }
+  }
+
+  /**
+   * Whether the call can go: once its finish and done tags are back, or, on a torn-down server
+   * that never got to finish it, once the done tag is and no operation or action is left.
+   */
+  bool CanDeleteLocked() const {
+    if (!bDoneNotified) {
+      return false;
+    }
+    if (bFinishing) {
+      return bFinished;
+    }
+    return !*Env.bAcceptingWork && !bReading && !bWriting && InFlight == 0;
+  }
+
+  void OnStreamedResponse(uesynth::FrameResponse&& Response) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (bBroken) {
+      return;
+    }
+    ++InFlight;
+    EnqueueLocked(MoveTemp(Response));
+  }
+
+  /** Queues a response holding a slot; a response the queue drops gives its slot back. */
+  void EnqueueLocked(FUESynthQueuedResponse&& Response) {
+    InFlight -= Outbound.Push(MoveTemp(Response));
+    StartWriteLocked();
+  }
+
+  void StartReadLocked() {
+    if (bReading || bReadsDone || bFinishing) {
+      return;
+    }
+    if (bBroken) {
+      // Nothing more will be answered; stop reading and wind the call down.
+      bReadsDone = true;
+      return;
+    }
+    if (InFlight < MaxInFlight && !Outbound.ShouldThrottleReads()) {
+      // Every action is parsed into an arena of its own
+      bReading = true;
+      IncomingArena = FUESynthMessageArena::Acquire();
+      IncomingRequest = IncomingArena.Create<uesynth::ActionRequest>();
+      Stream.Read(IncomingRequest, &ReadTag);
+    }
+  }
+
+  void StartWriteLocked() {
+    if (bWriting || !Outbound.Pop(&OutgoingResponse)) {
+      return;
+    }
+    // One write at a time, so slots are reused in the order the client reads
+    if (const TSharedPtr<FUESynthSharedMemory> SharedMemory = Link->GetSharedMemory()) {
+      SharedMemory->Pack(&OutgoingResponse.Get());
+    }
+    bWriting = true;
+    WriteStartSeconds = FPlatformTime::Seconds();
+    Stream.Write(OutgoingResponse.Get(), &WriteTag);
+  }
+
+  void MaybeFinishLocked() {
+    if (bFinishing || !bReadsDone || bReading || bWriting || InFlight > 0) {
+      return;
+    }
+    bFinishing = true;
+    Stream.Finish(grpc::Status::OK, &FinishTag);
+  }
+
+  FCallEnvironment Env;
+  grpc::ServerContext Context;
+  grpc::ServerAsyncReaderWriter<uesynth::FrameResponse, uesynth::ActionRequest> Stream;
+  FOpTag ConnectTag;
+  FOpTag ReadTag;
+  FOpTag WriteTag;
+  FOpTag FinishTag;
+  FOpTag DoneTag;
+  TSharedRef<FUESynthStreamLink> Link;
+  // Shared by every action of the stream
+  const TSharedRef<FUESynthCancellation> Cancellation = MakeShared<FUESynthCancellation>();
+  // Set on connect, from the call's metadata
+  TSharedPtr<FUESynthSession> Session;
+
+  mutable std::mutex Mutex;
+  FUESynthMessageArena IncomingArena;
+  uesynth::ActionRequest* IncomingRequest = nullptr;
+  FUESynthQueuedResponse OutgoingResponse;
+  FUESynthWriteQueue Outbound{FUESynthWriteQueue::DefaultCapacity, EUESynthWritePolicy::Block};
+  int32 MaxInFlight = FUESynthControlStream::DefaultMaxInFlight;
+  int32 InFlight = 0;
+  double WriteStartSeconds = 0.0;
+  // Counted in the server's open streams from connect on
+  bool bOpened = false;
+  bool bReading = false;
+  bool bReadsDone = false;
+  bool bWriting = false;
+  bool bBroken = false;
+  bool bFinishing = false;
+  // Set on the polling thread under the lock, since a torn-down server's call may go from
+  // whichever thread gives back its last action
+  bool bFinished = false;
+  bool bDoneNotified = false;
+};
+
+} // namespace
+
+FUESynthAsyncServer::FUESynthAsyncServer(const FUESynthServerSettings& InSettings)
+    : Settings(InSettings),
+      NumCompletionQueueThreads(FMath::Max(1, InSettings.CompletionQueueThreads)),
+      bAcceptingWork(std::make_shared<std::atomic<bool>>(false)) {}
+
+FUESynthAsyncServer::~FUESynthAsyncServer() {
+  Shutdown();
+}
+
+bool FUESynthAsyncServer::Start() {
+  Server = Settings.BuildAndStart(
+      [this](grpc::ServerBuilder& Builder) {
+        AsyncService = std::make_unique<FAsyncService>();
+        Builder.RegisterService(AsyncService.get());
+        CompletionQueues.clear();
+        for (int32 Index = 0; Index < NumCompletionQueueThreads; ++Index) {
+          CompletionQueues.push_back(Builder.AddCompletionQueue());
+        }
+      },
+      &ListenAddress);
+  if (!Server) {
+    CompletionQueues.clear();
+    return false;
+  }
+
+  *bAcceptingWork = true;
+  for (const std::unique_ptr<grpc::ServerCompletionQueue>& Queue : CompletionQueues) {
+    SeedCalls(Queue.get());
+    PollingThreads.emplace_back(&FUESynthAsyncServer::PollCompletionQueue, Queue.get());
+  }
+  return true;
+}
+
+void FUESynthAsyncServer::Shutdown() {
+  if (!Server) {
+    return;
+  }
+
+  *bAcceptingWork = false;
+
+  // A deadline of "now" cancels every in-flight call instead of waiting for game-thread work
+  // that cannot run while the module is shutting down on the game thread.
+  Server->Shutdown(std::chrono::system_clock::now());
+  for (const std::unique_ptr<grpc::ServerCompletionQueue>& Queue : CompletionQueues) {
+    Queue->Shutdown();
+  }
+  for (std::thread& Thread : PollingThreads) {
+    if (Thread.joinable()) {
+      Thread.join();
+    }
+  }
+
+  PollingThreads.clear();
+  CompletionQueues.clear();
+  Server.reset();
+}
+
+void FUESynthAsyncServer::SeedCalls(grpc::ServerCompletionQueue* Queue) {
+  const FCallEnvironment Env{AsyncService.get(), &Handlers, Queue, bAcceptingWork};
+
+  FControlStreamCall::Listen(Env);
+
+  constexpr EUESynthCommandKind Mutation = EUESynthCommandKind::Mutation;
+  constexpr EUESynthCommandKind Query = EUESynthCommandKind::Query;
+  constexpr EUESynthCommandKind Capture = EUESynthCommandKind::Capture;
+
+  ListenUnary(Env, "SetCameraTransform", Mutation, &UESynthServiceImpl::SetCameraTransform,
+              &FAsyncService::RequestSetCameraTransform);
+  ListenUnary(Env, "GetCameraTransform", Query, &UESynthServiceImpl::GetCameraTransform,
+              &FAsyncService::RequestGetCameraTransform);
+  ListenDeferredUnary(Env, "CaptureRgbImage", Capture,
+                      &UESynthServiceImpl::CaptureRgbImageOnGameThread,
+                      &FAsyncService::RequestCaptureRgbImage);
+  ListenDeferredUnary(Env, "CaptureDepthMap", Capture,
+                      &UESynthServiceImpl::CaptureDepthMapOnGameThread,
+                      &FAsyncService::RequestCaptureDepthMap);
+  ListenDeferredUnary(Env, "CaptureSegmentationMask", Capture,
+                      &UESynthServiceImpl::CaptureSegmentationMaskOnGameThread,
+                      &FAsyncService::RequestCaptureSegmentationMask);
+  ListenUnary(Env, "SetObjectTransform", Mutation, &UESynthServiceImpl::SetObjectTransform,
+              &FAsyncService::RequestSetObjectTransform);
+  ListenUnary(Env, "GetObjectTransform", Query, &UESynthServiceImpl::GetObjectTransform,
+              &FAsyncService::RequestGetObjectTransform);
+  ListenUnary(Env, "SetObjectTransformsBatch", Mutation,
+              &UESynthServiceImpl::SetObjectTransformsBatch,
+              &FAsyncService::RequestSetObjectTransformsBatch);
+  ListenUnary(Env, "GetObjectTransformsBatch", Query, &UESynthServiceImpl::GetObjectTransformsBatch,
+              &FAsyncService::RequestGetObjectTransformsBatch);
+  ListenUnary(Env, "CreateCamera", Mutation, &UESynthServiceImpl::CreateCamera,
+              &FAsyncService::RequestCreateCamera);
+  ListenUnary(Env, "DestroyCamera", Mutation, &UESynthServiceImpl::DestroyCamera,
+              &FAsyncService::RequestDestroyCamera);
+  ListenUnary(Env, "SetResolution", Mutation, &UESynthServiceImpl::SetResolution,
+              &FAsyncService::RequestSetResolution);
+  ListenDeferredUnary(Env, "CaptureNormals", Capture,
+                      &UESynthServiceImpl::CaptureNormalsOnGameThread,
+                      &FAsyncService::RequestCaptureNormals);
+  ListenDeferredUnary(Env, "CaptureOpticalFlow", Capture,
+                      &UESynthServiceImpl::CaptureOpticalFlowOnGameThread,
+                      &FAsyncService::RequestCaptureOpticalFlow);
+  ListenDeferredUnary(Env, "SpawnObject", Mutation, &UESynthServiceImpl::SpawnObjectOnGameThread,
+                      &FAsyncService::RequestSpawnObject);
+  ListenDeferredUnary(Env, "PreloadAssets", Query, &UESynthServiceImpl::PreloadAssetsOnGameThread,
+                      &FAsyncService::RequestPreloadAssets);
+  ListenUnary(Env, "DestroyObject", Mutation, &UESynthServiceImpl::DestroyObject,
+              &FAsyncService::RequestDestroyObject);
+  ListenUnary(Env, "ConfigureActorPool", Mutation, &UESynthServiceImpl::ConfigureActorPool,
+              &FAsyncService::RequestConfigureActorPool);
+  ListenUnary(Env, "SetMaterial", Mutation, &UESynthServiceImpl::SetMaterial,
+              &FAsyncService::RequestSetMaterial);
+  ListenUnary(Env, "SetMaterialsBatch", Mutation, &UESynthServiceImpl::SetMaterialsBatch,
+              &FAsyncService::RequestSetMaterialsBatch);
+  ListenUnary(Env, "ResolveMaterialParameters", Query,
+              &UESynthServiceImpl::ResolveMaterialParameters,
+              &FAsyncService::RequestResolveMaterialParameters);
+  ListenUnary(Env, "ListObjects", Query, &UESynthServiceImpl::ListObjects,
+              &FAsyncService::RequestListObjects);
+  ListenUnary(Env, "GetSceneSnapshot", Query, &UESynthServiceImpl::GetSceneSnapshot,
+              &FAsyncService::RequestGetSceneSnapshot);
+  ListenUnary(Env, "SetLighting", Mutation, &UESynthServiceImpl::SetLighting,
+              &FAsyncService::RequestSetLighting);
+  ListenUnary(Env, "SetLightingBatch", Mutation, &UESynthServiceImpl::SetLightingBatch,
+              &FAsyncService::RequestSetLightingBatch);
+  ListenDeferredUnary(Env, "CaptureMulti", Capture, &UESynthServiceImpl::CaptureMultiOnGameThread,
+                      &FAsyncService::RequestCaptureMulti);
+  ListenDeferredUnary(Env, "Step", Mutation, &UESynthServiceImpl::StepOnGameThread,
+                      &FAsyncService::RequestStep);
+  ListenUnary(Env, "SetLockstep", Mutation, &UESynthServiceImpl::SetLockstep,
+              &FAsyncService::RequestSetLockstep);
+  ListenUnary(Env, "StartRecording", Mutation, &UESynthServiceImpl::StartRecording,
+              &FAsyncService::RequestStartRecording);
+  ListenDeferredUnary(Env, "StopRecording", Mutation,
+                      &UESynthServiceImpl::StopRecordingOnGameThread,
+                      &FAsyncService::RequestStopRecording);
+  ListenInlineUnary(Env, "GetServerStats", &UESynthServiceImpl::GetServerStats,
+                    &FAsyncService::RequestGetServerStats);
+  ListenInlineUnary(Env, "GetHealth", &UESynthServiceImpl::GetHealth,
+                    &FAsyncService::RequestGetHealth);
+}
+
+void FUESynthAsyncServer::PollCompletionQueue(grpc::ServerCompletionQueue* Queue) {
+  void* Tag = nullptr;
+  bool bOk = false;
+  while (Queue->Next(&Tag, &bOk)) {
+    static_cast<FAsyncCallTag*>(Tag)->Proceed(bOk);
+  }
+}
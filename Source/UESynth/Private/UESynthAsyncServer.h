@@ -0,0 +1,65 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UESynthServerSettings.h"
+#include "UESynthServiceImpl.h"
+#include "pb/uesynth.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Completion-queue based gRPC server for UESynthService.
+ *
+ * No gRPC thread ever waits on the game thread: every call is handed to the game thread and the
+ * RPC is finished from that continuation, so the number of concurrent clients is no longer bound
+ * by the size of the synchronous thread pool. Each polling thread owns one completion queue.
+ */
+class FUESynthAsyncServer
+{
+public:
+  explicit FUESynthAsyncServer(const FUESynthServerSettings& InSettings);
+  ~FUESynthAsyncServer();
+
+  /**
+   * Builds the server on the first free port of the settings' range, seeds one pending call per
+   * method on every queue and starts polling.
+   */
+  bool Start();
+
+  /** The host:port the server bound once started. */
+  const FString& GetListenAddress() const {
+    return ListenAddress;
+  }
+
+  /** Cancels in-flight calls, drains the completion queues and joins the polling threads. */
+  void Shutdown();
+
+private:
+  void SeedCalls(grpc::ServerCompletionQueue* Queue);
+  static void PollCompletionQueue(grpc::ServerCompletionQueue* Queue);
+
+  const FUESynthServerSettings Settings;
+  const int32 NumCompletionQueueThreads;
+
+  // A new one per port tried: an async service can only ever be registered with one server
+  std::unique_ptr<uesynth::UESynthService::AsyncService> AsyncService;
+
+  // The synchronous service doubles as the handler backend; its handlers run inline when they
+  // are already on the game thread.
+  UESynthServiceImpl Handlers;
+
+  std::unique_ptr<grpc::Server> Server;
+  FString ListenAddress;
+  std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> CompletionQueues;
+  std::vector<std::thread> PollingThreads;
+
+  // Cleared before shutdown so queued game-thread continuations stop touching their calls.
+  std::shared_ptr<std::atomic<bool>> bAcceptingWork;
+};
@@ -0,0 +1,227 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthCameraPool.h"
+#include "Camera/CameraActor.h"
+#include "Camera/CameraComponent.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "TextureResource.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+const FIntPoint FUESynthCameraPool::DefaultResolution(1280, 720);
+
+bool FUESynthCameraPool::CreateCamera(UWorld* World, FName Name, const FTransform& Transform,
+                                      FIntPoint Resolution) {
+  check(IsInGameThread());
+  if (!World || Name.IsNone() || !IsValidResolution(Resolution) || Contains(Name) ||
+      StaticFindObjectFast(AActor::StaticClass(), World->PersistentLevel, Name)) {
+    return false;
+  }
+
+  FActorSpawnParameters Params;
+  Params.Name = Name;
+  Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+  Params.ObjectFlags |= RF_Transient;
+  ACameraActor* Actor = World->SpawnActor<ACameraActor>(ACameraActor::StaticClass(), Transform,
+                                                        Params);
+  if (!Actor) {
+    return false;
+  }
+
+  // Only renders when Capture asks it to. Persisting the rendering state keeps temporal history
+  // and eye adaptation between captures, so a camera's frames look like a viewport's.
+  USceneCaptureComponent2D* Capture =
+      NewObject<USceneCaptureComponent2D>(Actor, TEXT("UESynthSceneCapture"));
+  Capture->bCaptureEveryFrame = false;
+  Capture->bCaptureOnMovement = false;
+  Capture->bAlwaysPersistRenderingState = true;
+  Capture->SetupAttachment(Actor->GetCameraComponent());
+  Capture->RegisterComponent();
+  Actor->AddInstanceComponent(Capture);
+
+  FCamera& Camera = Cameras.Add(Name);
+  Camera.Actor = Actor;
+  Camera.Capture = Capture;
+  Camera.Resolution = Resolution;
+  // Most captures are RGB, so that target is taken now rather than on the first capture.
+  Camera.Targets[ColorTarget] = AcquireTarget(FBucket{Resolution, ColorTarget});
+  return true;
+}
+
+bool FUESynthCameraPool::DestroyCamera(FName Name) {
+  check(IsInGameThread());
+  FCamera Camera;
+  if (!Cameras.RemoveAndCopyValue(Name, Camera)) {
+    return false;
+  }
+
+  ReleaseTargets(Camera);
+  // Out of the map first, so the world's destroy handler finds nothing left to remove.
+  if (ACameraActor* Actor = Camera.Actor.Get()) {
+    Actor->Destroy();
+  }
+  return true;
+}
+
+bool FUESynthCameraPool::SetResolution(FName Name, FIntPoint Resolution) {
+  check(IsInGameThread());
+  FCamera* Camera = Cameras.Find(Name);
+  if (!Camera || !IsValidResolution(Resolution)) {
+    return false;
+  }
+  if (Camera->Resolution == Resolution) {
+    return true;
+  }
+
+  for (int32 Target = 0; Target < NumTargets; ++Target) {
+    if (Camera->Targets[Target]) {
+      ReleaseTarget(FBucket{Camera->Resolution, ETarget(Target)}, Camera->Targets[Target]);
+      Camera->Targets[Target] = AcquireTarget(FBucket{Resolution, ETarget(Target)});
+    }
+  }
+  Camera->Resolution = Resolution;
+  return true;
+}
+
+bool FUESynthCameraPool::Contains(FName Name) const {
+  const FCamera* Camera = Cameras.Find(Name);
+  return Camera && Camera->Actor.IsValid();
+}
+
+FIntPoint FUESynthCameraPool::GetResolution(FName Name) const {
+  const FCamera* Camera = Cameras.Find(Name);
+  return Camera ? Camera->Resolution : FIntPoint::ZeroValue;
+}
+
+FTextureRenderTargetResource* FUESynthCameraPool::Capture(FName Name,
+                                                          EUESynthCaptureModality Modality) {
+  check(IsInGameThread());
+  FCamera* Camera = Cameras.Find(Name);
+  if (!Camera) {
+    return nullptr;
+  }
+
+  ACameraActor* Actor = Camera->Actor.Get();
+  USceneCaptureComponent2D* Capture = Camera->Capture.Get();
+  if (!Actor || !Capture) {
+    ReleaseTargets(*Camera);
+    Cameras.Remove(Name);
+    return nullptr;
+  }
+
+  ETarget Target;
+  ESceneCaptureSource Source;
+  switch (Modality) {
+  case EUESynthCaptureModality::Rgb:
+    Target = ColorTarget;
+    Source = SCS_FinalColorLDR;
+    break;
+  case EUESynthCaptureModality::Depth:
+    Target = DepthTarget;
+    Source = SCS_SceneDepth;
+    break;
+  default:
+    return nullptr;
+  }
+
+  TObjectPtr<UTextureRenderTarget2D>& Texture = Camera->Targets[Target];
+  if (!Texture) {
+    Texture = AcquireTarget(FBucket{Camera->Resolution, Target});
+  }
+
+  Capture->TextureTarget = Texture;
+  Capture->CaptureSource = Source;
+  Capture->FOVAngle = Actor->GetCameraComponent()->FieldOfView;
+  Capture->CaptureScene();
+  return Texture->GameThread_GetRenderTargetResource();
+}
+
+void FUESynthCameraPool::RemoveActor(AActor* Actor) {
+  for (auto It = Cameras.CreateIterator(); It; ++It) {
+    if (It->Value.Actor.Get() == Actor) {
+      ReleaseTargets(It->Value);
+      It.RemoveCurrent();
+      return;
+    }
+  }
+}
+
+void FUESynthCameraPool::Reset() {
+  // Taken out first: destroying the actors calls back into RemoveActor.
+  TMap<FName, FCamera> Destroyed = MoveTemp(Cameras);
+  Cameras.Reset();
+
+  for (TPair<FName, FCamera>& Pair : Destroyed) {
+    ReleaseTargets(Pair.Value);
+    ACameraActor* Actor = Pair.Value.Actor.Get();
+    UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    if (World && !World->bIsTearingDown && !Actor->IsActorBeingDestroyed()) {
+      Actor->Destroy();
+    }
+  }
+}
+
+bool FUESynthCameraPool::IsValidResolution(FIntPoint Resolution) {
+  return Resolution.X > 0 && Resolution.Y > 0 && Resolution.X <= MaxResolution &&
+         Resolution.Y <= MaxResolution;
+}
+
+int32 FUESynthCameraPool::NumFreeTargets() const {
+  int32 Count = 0;
+  for (const TPair<FBucket, TArray<TObjectPtr<UTextureRenderTarget2D>>>& Pair : FreeTargets) {
+    Count += Pair.Value.Num();
+  }
+  return Count;
+}
+
+void FUESynthCameraPool::AddReferencedObjects(FReferenceCollector& Collector) {
+  for (TPair<FName, FCamera>& Pair : Cameras) {
+    for (TObjectPtr<UTextureRenderTarget2D>& Target : Pair.Value.Targets) {
+      Collector.AddReferencedObject(Target);
+    }
+  }
+  for (TPair<FBucket, TArray<TObjectPtr<UTextureRenderTarget2D>>>& Pair : FreeTargets) {
+    Collector.AddReferencedObjects(Pair.Value);
+  }
+}
+
+FString FUESynthCameraPool::GetReferencerName() const {
+  return TEXT("FUESynthCameraPool");
+}
+
+UTextureRenderTarget2D* FUESynthCameraPool::AcquireTarget(const FBucket& Bucket) {
+  if (TArray<TObjectPtr<UTextureRenderTarget2D>>* Free = FreeTargets.Find(Bucket)) {
+    if (Free->Num() > 0) {
+      return Free->Pop(/*bAllowShrinking=*/false);
+    }
+  }
+
+  UTextureRenderTarget2D* Target = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+  Target->RenderTargetFormat = Bucket.Target == DepthTarget ? RTF_R32f : RTF_RGBA8;
+  Target->ClearColor = FLinearColor::Black;
+  Target->InitAutoFormat(Bucket.Size.X, Bucket.Size.Y);
+  Target->UpdateResourceImmediate(/*bClearRenderTarget=*/true);
+  return Target;
+}
+
+void FUESynthCameraPool::ReleaseTarget(const FBucket& Bucket,
+                                       TObjectPtr<UTextureRenderTarget2D>& Target) {
+  // Past the cap the target is simply dropped and garbage collected. Its resource is released on
+  // the render thread, behind any readback of it that is still queued.
+  TArray<TObjectPtr<UTextureRenderTarget2D>>& Free = FreeTargets.FindOrAdd(Bucket);
+  if (Free.Num() < MaxFreeTargetsPerBucket) {
+    Free.Add(Target);
+  }
+  Target = nullptr;
+}
+
+void FUESynthCameraPool::ReleaseTargets(FCamera& Camera) {
+  for (int32 Target = 0; Target < NumTargets; ++Target) {
+    if (Camera.Targets[Target]) {
+      ReleaseTarget(FBucket{Camera.Resolution, ETarget(Target)}, Camera.Targets[Target]);
+    }
+  }
+}
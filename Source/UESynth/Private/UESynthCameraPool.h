@@ -0,0 +1,129 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UESynthFrameCapture.h"
+#include "UObject/GCObject.h"
+#include "UObject/ObjectPtr.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class ACameraActor;
+class FTextureRenderTargetResource;
+class USceneCaptureComponent2D;
+class UTextureRenderTarget2D;
+class UWorld;
+
+/**
+ * Named virtual cameras that render on demand through their own USceneCaptureComponent2D.
+ *
+ * The game viewport only shows one view, while multi-view rigs need a dozen. Each camera here is
+ * an ACameraActor, so the transform handlers address it like any other camera, carrying a scene
+ * capture component that never renders on its own: a capture renders just the cameras it names.
+ * Render targets are the expensive part, so they are bucketed by size and format and kept in free
+ * lists. Destroying a camera returns its targets, and creating one or resizing it takes a free
+ * target from the matching bucket before allocating a new one. Game thread only.
+ */
+class FUESynthCameraPool final : public FGCObject
+{
+public:
+  /** What a pooled camera can render: final color and view-space depth. */
+  static constexpr EUESynthCaptureModality SupportedModalities =
+      EUESynthCaptureModality::Rgb | EUESynthCaptureModality::Depth;
+
+  /** Largest width or height a camera can render at. */
+  static constexpr int32 MaxResolution = 8192;
+
+  /** Size of cameras created while there is no game viewport to match. */
+  static const FIntPoint DefaultResolution;
+
+  /** The camera rendering the game view where there is no viewport; see FUESynthSceneContext. */
+  static constexpr const TCHAR* HeadlessViewName = TEXT("UESynthHeadlessView");
+
+  /** Free targets kept per bucket, enough to rebuild a torn-down rig without allocating. */
+  static constexpr int32 MaxFreeTargetsPerBucket = 16;
+
+  /**
+   * Spawns a camera named Name into World at Transform, rendering at Resolution. Returns false if
+   * an actor of that name already exists or spawning failed.
+   */
+  bool CreateCamera(UWorld* World, FName Name, const FTransform& Transform, FIntPoint Resolution);
+
+  /** Destroys a camera and returns its targets to the free lists; false if there is none. */
+  bool DestroyCamera(FName Name);
+
+  /** Changes a camera's resolution; its targets are only swapped when the bucket changes. */
+  bool SetResolution(FName Name, FIntPoint Resolution);
+
+  /** Whether Name is a live camera of this pool. */
+  bool Contains(FName Name) const;
+
+  /** The resolution of camera Name, or zero if there is no such camera. */
+  FIntPoint GetResolution(FName Name) const;
+
+  /**
+   * Renders one supported modality of camera Name now and returns the target holding it, or null
+   * if there is no such camera. The target keeps the frame until that camera renders the same
+   * modality again.
+   */
+  FTextureRenderTargetResource* Capture(FName Name, EUESynthCaptureModality Modality);
+
+  /** Drops a camera whose actor was destroyed from outside the pool. */
+  void RemoveActor(AActor* Actor);
+
+  /** Destroys every camera; their targets stay in the free lists for the next world. */
+  void Reset();
+
+  /** Whether a camera can render at Resolution. */
+  static bool IsValidResolution(FIntPoint Resolution);
+
+  int32 Num() const { return Cameras.Num(); }
+
+  /** Render targets waiting in the free lists. */
+  int32 NumFreeTargets() const;
+
+  //~ Begin FGCObject interface
+  virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+  virtual FString GetReferencerName() const override;
+  //~ End FGCObject interface
+
+private:
+  /** Index into FCamera::Targets of each supported modality. */
+  enum ETarget : int32
+  {
+    ColorTarget,
+    DepthTarget,
+    NumTargets
+  };
+
+  struct FBucket
+  {
+    FIntPoint Size = FIntPoint::ZeroValue;
+    ETarget Target = ColorTarget;
+
+    bool operator==(const FBucket& Other) const {
+      return Size == Other.Size && Target == Other.Target;
+    }
+    friend uint32 GetTypeHash(const FBucket& Bucket) {
+      return HashCombine(GetTypeHash(Bucket.Size), GetTypeHash(int32(Bucket.Target)));
+    }
+  };
+
+  struct FCamera
+  {
+    TWeakObjectPtr<ACameraActor> Actor;
+    TWeakObjectPtr<USceneCaptureComponent2D> Capture;
+    FIntPoint Resolution = FIntPoint::ZeroValue;
+    /** Allocated on first use; a camera only ever used for RGB never holds a depth target. */
+    TObjectPtr<UTextureRenderTarget2D> Targets[NumTargets] = {};
+  };
+
+  UTextureRenderTarget2D* AcquireTarget(const FBucket& Bucket);
+  void ReleaseTarget(const FBucket& Bucket, TObjectPtr<UTextureRenderTarget2D>& Target);
+  void ReleaseTargets(FCamera& Camera);
+
+  TMap<FName, FCamera> Cameras;
+  TMap<FBucket, TArray<TObjectPtr<UTextureRenderTarget2D>>> FreeTargets;
+};
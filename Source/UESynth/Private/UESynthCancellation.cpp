@@ -0,0 +1,59 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthCancellation.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+
+// Raw, as the scopes that set it hold the token alive
+thread_local FUESynthCancellation* ActiveToken = nullptr;
+
+/** Deadlines further out than this are gRPC's "none". */
+constexpr double MaxDeadlineSeconds = 365.0 * 24.0 * 60.0 * 60.0;
+
+} // namespace
+
+TSharedRef<FUESynthCancellation> FUESynthCancellation::Create(const grpc::ServerContext* Context) {
+  TSharedRef<FUESynthCancellation> Token = MakeShared<FUESynthCancellation>();
+  if (Context) {
+    Token->SetDeadline(Context->deadline());
+  }
+  return Token;
+}
+
+void FUESynthCancellation::SetDeadline(std::chrono::system_clock::time_point Deadline) {
+  const std::chrono::system_clock::time_point Now = std::chrono::system_clock::now();
+  if (Deadline <= Now) {
+    // Already past; anything but zero does
+    DeadlineSeconds = FPlatformTime::Seconds() - 1.0;
+    return;
+  }
+  const double Remaining = std::chrono::duration<double>(Deadline - Now).count();
+  DeadlineSeconds = Remaining < MaxDeadlineSeconds ? FPlatformTime::Seconds() + Remaining : 0.0;
+}
+
+bool FUESynthCancellation::IsCancelled() const {
+  return bCancelled.load(std::memory_order_relaxed) ||
+         (DeadlineSeconds > 0.0 && FPlatformTime::Seconds() >= DeadlineSeconds);
+}
+
+grpc::Status FUESynthCancellation::GetStatus() const {
+  if (DeadlineSeconds > 0.0 && FPlatformTime::Seconds() >= DeadlineSeconds) {
+    return grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline exceeded");
+  }
+  return grpc::Status(grpc::StatusCode::CANCELLED, "Call cancelled");
+}
+
+TSharedPtr<FUESynthCancellation> FUESynthCancellation::GetActive() {
+  return ActiveToken ? TSharedPtr<FUESynthCancellation>(ActiveToken->AsShared()) : nullptr;
+}
+
+FUESynthCancellation::FScope::FScope(FUESynthCancellation* Token) : Previous(ActiveToken) {
+  ActiveToken = Token;
+}
+
+FUESynthCancellation::FScope::~FScope() {
+  ActiveToken = Previous;
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+
+/**
+ * Whether the call some queued work belongs to still wants it.
+ *
+ * Every unary call and ControlStream gets one when it arrives, with the call's deadline. The
+ * server cancels it once the client has cancelled or gone away, and it counts as cancelled by
+ * itself once the deadline has passed. Work posted for the call checks it before each expensive
+ * stage (running the command on the game thread, rendering and reading back a capture, converting
+ * and encoding its pixels) and drops itself instead of finishing for nobody.
+ *
+ * The handlers don't take one; the dispatch makes the call's token active on the game thread
+ * while its command runs, and the capture pipeline keeps the active token with every request and
+ * makes it active again wherever the request's callbacks run.
+ */
+class FUESynthCancellation final : public TSharedFromThis<FUESynthCancellation>
+{
+public:
+  /** A token for a call of Context, with its deadline; never cancelled by itself without one. */
+  static TSharedRef<FUESynthCancellation> Create(const grpc::ServerContext* Context = nullptr);
+
+  /** For a call whose deadline is only known once it has arrived. Before sharing the token. */
+  void SetDeadline(std::chrono::system_clock::time_point Deadline);
+
+  /** The client cancelled or went away. Any thread. */
+  void Cancel() {
+    bCancelled.store(true, std::memory_order_relaxed);
+  }
+
+  /** Whether the work should be dropped. Any thread. */
+  bool IsCancelled() const;
+
+  /** What a dropped call is answered with: CANCELLED, or DEADLINE_EXCEEDED past its deadline. */
+  grpc::Status GetStatus() const;
+
+  /** Whether Token, e.g. the one kept with a capture request, is set and cancelled. */
+  static bool IsCancelled(const TSharedPtr<FUESynthCancellation>& Token) {
+    return Token.IsValid() && Token->IsCancelled();
+  }
+
+  /** The token of the call whose work runs on this thread, or null. */
+  static TSharedPtr<FUESynthCancellation> GetActive();
+
+  /** Makes Token the active one on this thread until the scope ends; null for none. */
+  class FScope
+  {
+  public:
+    explicit FScope(FUESynthCancellation* Token);
+    explicit FScope(const TSharedPtr<FUESynthCancellation>& Token) : FScope(Token.Get()) {}
+    ~FScope();
+
+    FScope(const FScope&) = delete;
+    FScope& operator=(const FScope&) = delete;
+
+  private:
+    FUESynthCancellation* Previous;
+  };
+
+private:
+  std::atomic<bool> bCancelled{false};
+  /** In FPlatformTime::Seconds; zero for none. */
+  double DeadlineSeconds = 0.0;
+};
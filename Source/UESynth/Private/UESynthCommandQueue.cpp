@@ -0,0 +1,187 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthCommandQueue.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "UESynthServerStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending commands"), STAT_UESynthPendingCommands,
+                           STATGROUP_UESynth);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Held commands"), STAT_UESynthHeldCommands, STATGROUP_UESynth);
+
+FUESynthCommandQueue* FUESynthCommandQueue::Instance = nullptr;
+
+bool FUESynthCommandQueue::FLane::TakeNext(FQueuedCommand& Out, std::atomic<int32>& NumPending) {
+  if (NumReleasedRun < Released.Num()) {
+    Out = MoveTemp(Released[NumReleasedRun++]);
+    return true;
+  }
+  if (!Pending.Dequeue(Out)) {
+    return false;
+  }
+  --NumPending;
+  return true;
+}
+
+bool FUESynthCommandQueue::FLane::IsIdle() const {
+  return Pending.IsEmpty() && Held.IsEmpty() && NumReleasedRun == Released.Num();
+}
+
+FUESynthCommandQueue::FUESynthCommandQueue()
+    : DefaultLane(MakeShared<FLane>()),
+      CommandQueued(FPlatformProcess::GetSynchEventFromPool(/*bIsManualReset=*/false)) {
+  check(Instance == nullptr);
+  Instance = this;
+  Lanes.Add(DefaultLane);
+}
+
+FUESynthCommandQueue::~FUESynthCommandQueue() {
+  // Run whatever is left so nobody waiting on a command's promise is left hanging.
+  DrainBudgetSeconds = 0.0;
+  Drain(/*bNewFrame=*/true);
+  for (const TSharedRef<FLane>& Lane : Lanes) {
+    for (FQueuedCommand& Held : Lane->Held) {
+      Held.Command();
+    }
+    Lane->Held.Reset();
+  }
+  FPlatformProcess::ReturnSynchEventToPool(CommandQueued);
+
+  Instance = nullptr;
+}
+
+FUESynthCommandQueue& FUESynthCommandQueue::Get() {
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+bool FUESynthCommandQueue::IsAvailable() {
+  return Instance != nullptr;
+}
+
+void FUESynthCommandQueue::Enqueue(EUESynthCommandKind Kind, FCommand&& Command) {
+  Enqueue(*DefaultLane, Kind, MoveTemp(Command));
+}
+
+void FUESynthCommandQueue::Enqueue(FLane& Lane, EUESynthCommandKind Kind, FCommand&& Command) {
+  Lane.Pending.Enqueue(FQueuedCommand{Kind, MoveTemp(Command)});
+  const int32 Depth = ++NumPending;
+  int32 Peak = PeakPending.load();
+  while (Depth > Peak && !PeakPending.compare_exchange_weak(Peak, Depth)) {
+  }
+  if (bWaitingForCommands) {
+    CommandQueued->Trigger();
+  }
+}
+
+TSharedRef<FUESynthCommandQueue::FLane> FUESynthCommandQueue::CreateLane() {
+  TSharedRef<FLane> Lane = MakeShared<FLane>();
+  FScopeLock Lock(&LanesLock);
+  Lanes.Add(Lane);
+  return Lane;
+}
+
+bool FUESynthCommandQueue::WaitForCommands(uint32 TimeoutMs) {
+  bWaitingForCommands = true;
+  // Checked after raising the flag, so a command queued in between still triggers the event
+  bool bQueued = false;
+  {
+    FScopeLock Lock(&LanesLock);
+    for (const TSharedRef<FLane>& Lane : Lanes) {
+      bQueued |= !Lane->Pending.IsEmpty();
+    }
+  }
+  bQueued = bQueued || CommandQueued->Wait(TimeoutMs);
+  bWaitingForCommands = false;
+  return bQueued;
+}
+
+void FUESynthCommandQueue::Tick(float DeltaTime) {
+  if (!bDrainedExternally) {
+    Drain(/*bNewFrame=*/true);
+  }
+}
+
+TArray<TSharedRef<FUESynthCommandQueue::FLane>> FUESynthCommandQueue::GetLanes() {
+  FScopeLock Lock(&LanesLock);
+  // Only the queue holds such a lane, so nothing can be queued on it any more
+  Lanes.RemoveAll([this](const TSharedRef<FLane>& Lane) {
+    return Lane != DefaultLane && Lane.GetSharedReferenceCount() == 1 && Lane->IsIdle();
+  });
+  return Lanes;
+}
+
+void FUESynthCommandQueue::RunOrHold(FLane& Lane, FQueuedCommand& Queued, bool bHoldCaptures) {
+  // Once something is held, everything after it is held too so submission order is kept.
+  const bool bMustWaitForRender = Queued.Kind == EUESynthCommandKind::Capture && bHoldCaptures &&
+                                  Lane.bMutatedThisFrame;
+  if (Lane.Held.Num() > 0 || bMustWaitForRender) {
+    Lane.Held.Add(MoveTemp(Queued));
+    return;
+  }
+
+  if (Queued.Kind == EUESynthCommandKind::Mutation) {
+    Lane.bMutatedThisFrame = true;
+  }
+  Queued.Command();
+}
+
+void FUESynthCommandQueue::Drain(bool bNewFrame) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(FUESynthCommandQueue::Drain);
+  const bool bHoldCaptures = bHoldCapturesUntilRendered;
+  const double Deadline =
+      DrainBudgetSeconds > 0.0 ? FPlatformTime::Seconds() + DrainBudgetSeconds : 0.0;
+  bYieldRequested = false;
+
+  TArray<TSharedRef<FLane>> Turns = GetLanes();
+  if (bNewFrame) {
+    // Held commands come first: the mutations they waited for have been rendered by now. A
+    // further drain within the same frame keeps them held, and holds what comes after them.
+    for (const TSharedRef<FLane>& Lane : Turns) {
+      Lane->bMutatedThisFrame = false;
+      if (Lane->Held.Num() > 0) {
+        Lane->Released.RemoveAt(0, Lane->NumReleasedRun, /*bAllowShrinking=*/false);
+        Lane->NumReleasedRun = 0;
+        Lane->Held.Append(MoveTemp(Lane->Released));
+        Lane->Released = MoveTemp(Lane->Held);
+        Lane->Held.Reset();
+      }
+    }
+  }
+
+  // One command per lane and turn, until every lane has come up empty in a row. A yield or the
+  // budget leaves the rest where it is, as nothing waits on it
+  const int32 NumLanes = Turns.Num();
+  int32 Turn = FirstLane;
+  for (int32 EmptyInARow = 0; EmptyInARow < NumLanes && !bYieldRequested; ++Turn) {
+    if (Deadline > 0.0 && FPlatformTime::Seconds() >= Deadline) {
+      break;
+    }
+    FLane& Lane = *Turns[Turn % NumLanes];
+    FQueuedCommand Queued;
+    if (!Lane.TakeNext(Queued, NumPending)) {
+      ++EmptyInARow;
+      continue;
+    }
+    EmptyInARow = 0;
+    RunOrHold(Lane, Queued, bHoldCaptures);
+  }
+  FirstLane = Turn % NumLanes;
+
+  int32 HeldCount = 0;
+  for (const TSharedRef<FLane>& Lane : Turns) {
+    Lane->Released.RemoveAt(0, Lane->NumReleasedRun, /*bAllowShrinking=*/false);
+    Lane->NumReleasedRun = 0;
+    HeldCount += Lane->Held.Num() + Lane->Released.Num();
+  }
+  NumHeld = HeldCount;
+  SET_DWORD_STAT(STAT_UESynthPendingCommands, NumPending.load());
+  SET_DWORD_STAT(STAT_UESynthHeldCommands, HeldCount);
+}
+
+TStatId FUESynthCommandQueue::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(FUESynthCommandQueue, STATGROUP_Tickables);
+}
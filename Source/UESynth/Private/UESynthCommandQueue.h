@@ -0,0 +1,192 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/CriticalSection.h"
+#include "Tickable.h"
+#include <atomic>
+
+/** How a queued command interacts with the frame it runs in. */
+enum class EUESynthCommandKind : uint8
+{
+  /** Changes the scene (camera/object/light transforms, spawns, materials...). */
+  Mutation,
+  /** Reads scene state without changing it. */
+  Query,
+  /** Reads rendered pixels; may be held until earlier mutations have been rendered. */
+  Capture
+};
+
+/**
+ * Frame-synchronous command queue for work that must run on the game thread.
+ *
+ * Any thread may enqueue into a lock-free MPSC queue; the game thread drains everything that is
+ * pending once per frame from Tick, so fifty object moves cost one pass instead of fifty
+ * task-graph hops and always land in the same frame. When capture holding is enabled, a capture
+ * that follows a mutation in the same pass - and everything queued after it - waits for the next
+ * frame, so "move N things, then capture" always sees the moved scene. In lockstep the queue is
+ * drained between frames instead, while the engine waits for the next step.
+ *
+ * Commands go into lanes, one per client session plus the default one. Each lane keeps its own
+ * order and its own holding; a drain takes one command from each lane in turn, so a client with
+ * thousands of commands queued can't keep the others waiting behind it. With a drain budget,
+ * whatever is left once it runs out waits for the next frame, whose drain picks up the turns
+ * where this one stopped.
+ */
+class FUESynthCommandQueue final : public FTickableGameObject
+{
+public:
+  using FCommand = TUniqueFunction<void()>;
+
+  /** Commands of one session, run in the order they were queued; see CreateLane. */
+  class FLane;
+
+  FUESynthCommandQueue();
+  virtual ~FUESynthCommandQueue() override;
+
+  /** The module-owned queue. Only valid while the UESynth module is loaded. */
+  static FUESynthCommandQueue& Get();
+  static bool IsAvailable();
+
+  /** Queues a command for the next drain on the game thread. Safe to call from any thread. */
+  void Enqueue(EUESynthCommandKind Kind, FCommand&& Command);
+
+  /** Queues a command on Lane instead of the default lane. Safe to call from any thread. */
+  void Enqueue(FLane& Lane, EUESynthCommandKind Kind, FCommand&& Command);
+
+  /**
+   * A new lane, drained from the next drain on. The queue lets go of it once nobody else holds it
+   * and it has nothing left to run. Safe to call from any thread.
+   */
+  TSharedRef<FLane> CreateLane();
+
+  /**
+   * Runs the commands queued so far. A new frame first releases the commands held for it; a
+   * further drain within the same frame keeps them held, and holds whatever comes after them.
+   */
+  void Drain(bool bNewFrame);
+
+  /** Ends the running drain after the current command; the rest wait for the next frame. */
+  void YieldFrame() {
+    bYieldRequested = true;
+  }
+
+  /** Commands queued and not yet taken by a drain, over every lane. Any thread. */
+  int32 GetNumPending() const {
+    return NumPending.load();
+  }
+  /** The most commands that have been pending at once since the last ResetPeakPending. */
+  int32 GetPeakPending() const {
+    return PeakPending.load();
+  }
+  void ResetPeakPending() {
+    PeakPending = NumPending.load();
+  }
+  /** Commands held for the next frame, as of the last drain. Any thread. */
+  int32 GetNumHeld() const {
+    return NumHeld.load();
+  }
+
+  /** Blocks the game thread until a command is queued or TimeoutMs pass; true if one was. */
+  bool WaitForCommands(uint32 TimeoutMs);
+
+  /** While set, Tick leaves the queue alone and its owner drains it through Drain instead. */
+  void SetDrainedExternally(bool bExternally) {
+    bDrainedExternally = bExternally;
+  }
+
+  void SetHoldCapturesUntilRendered(bool bHold) {
+    bHoldCapturesUntilRendered = bHold;
+  }
+  bool GetHoldCapturesUntilRendered() const {
+    return bHoldCapturesUntilRendered;
+  }
+
+  /** Caps the time one drain spends running commands; 0 runs everything pending. */
+  void SetDrainBudget(double Seconds) {
+    DrainBudgetSeconds = FMath::Max(Seconds, 0.0);
+  }
+  double GetDrainBudget() const {
+    return DrainBudgetSeconds;
+  }
+
+  //~ Begin FTickableGameObject interface
+  virtual void Tick(float DeltaTime) override;
+  virtual ETickableTickType GetTickableTickType() const override {
+    return ETickableTickType::Always;
+  }
+  virtual bool IsTickableWhenPaused() const override {
+    return true;
+  }
+  virtual bool IsTickableInEditor() const override {
+    return true;
+  }
+  virtual TStatId GetStatId() const override;
+  //~ End FTickableGameObject interface
+
+private:
+  struct FQueuedCommand
+  {
+    EUESynthCommandKind Kind = EUESynthCommandKind::Query;
+    FCommand Command;
+  };
+
+  /** Runs Queued, or holds it on Lane for the next frame if it has to wait for a render. */
+  void RunOrHold(FLane& Lane, FQueuedCommand& Queued, bool bHoldCaptures);
+
+  /** Drops the lanes nobody holds any more and returns the rest. Game thread only. */
+  TArray<TSharedRef<FLane>> GetLanes();
+
+  TSharedRef<FLane> DefaultLane;
+
+  // Every lane, the default one first; guarded since lanes are created on any thread.
+  FCriticalSection LanesLock;
+  TArray<TSharedRef<FLane>> Lanes;
+
+  // The lane the next drain starts with. Game thread only.
+  int32 FirstLane = 0;
+
+  std::atomic<bool> bHoldCapturesUntilRendered{true};
+  double DrainBudgetSeconds = 0.0;
+
+  // Gauges for the server's stats; NumPending counts what Enqueue added and TakeNext hasn't taken
+  std::atomic<int32> NumPending{0};
+  std::atomic<int32> PeakPending{0};
+  std::atomic<int32> NumHeld{0};
+
+  bool bYieldRequested = false;
+  bool bDrainedExternally = false;
+
+  // Wakes WaitForCommands; only triggered while someone waits.
+  FEvent* CommandQueued;
+  std::atomic<bool> bWaitingForCommands{false};
+
+  static FUESynthCommandQueue* Instance;
+};
+
+class FUESynthCommandQueue::FLane
+{
+private:
+  friend class FUESynthCommandQueue;
+
+  /**
+   * The next command to run, from what a new frame released and then from the queue, whose
+   * commands are taken off NumPending.
+   */
+  bool TakeNext(FQueuedCommand& Out, std::atomic<int32>& NumPending);
+  bool IsIdle() const;
+
+  TQueue<FQueuedCommand, EQueueMode::Mpsc> Pending;
+
+  // Game thread only. Commands waiting for the next rendered frame, in submission order; and
+  // the ones a new frame released, ahead of Pending, from index NumReleasedRun on.
+  TArray<FQueuedCommand> Held;
+  TArray<FQueuedCommand> Released;
+  int32 NumReleasedRun = 0;
+
+  // Whether a mutation ran since the frame started, i.e. a capture must wait. Game thread only.
+  bool bMutatedThisFrame = false;
+};
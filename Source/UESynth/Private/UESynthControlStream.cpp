@@ -0,0 +1,240 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthControlStream.h"
+#include "UESynthCancellation.h"
+#include "UESynthCommandQueue.h"
+#include "UESynthMessageArena.h"
+#include "UESynthServerStats.h"
+#include "UESynthServiceImpl.h"
+#include "UESynthSessions.h"
+#include "UESynthSharedMemory.h"
+#include <string>
+#include <thread>
+
+FUESynthControlStream::FUESynthControlStream(UESynthServiceImpl& InService,
+                                             grpc::ServerContext* InContext, FStream* InStream,
+                                             int32 InMaxInFlight, FUESynthWriteQueue&& InOutbound,
+                                             const TSharedPtr<FUESynthSession>& InSession)
+    : Service(InService), Context(InContext), Stream(InStream),
+      MaxInFlight(FMath::Clamp(InMaxInFlight, 1, MaxAllowedInFlight)),
+      Link(MakeShared<FUESynthStreamLink>(this)), Session(InSession),
+      Cancellation(FUESynthCancellation::Create(InContext)), Outbound(MoveTemp(InOutbound)) {}
+
+int32 FUESynthControlStream::GetRequestedMaxInFlight(const grpc::ServerContext* Context) {
+  if (!Context) {
+    return DefaultMaxInFlight;
+  }
+
+  const auto& Metadata = Context->client_metadata();
+  const auto It = Metadata.find(MaxInFlightMetadataKey);
+  if (It == Metadata.end()) {
+    return DefaultMaxInFlight;
+  }
+
+  const std::string Value(It->second.data(), It->second.length());
+  const int32 Requested = FCString::Atoi(UTF8_TO_TCHAR(Value.c_str()));
+  return FMath::Clamp(Requested, 1, MaxAllowedInFlight);
+}
+
+grpc::Status FUESynthControlStream::Run() {
+  FUESynthServerStats::Get().OnStreamOpened();
+  std::thread Writer([this]() { WriterLoop(); });
+
+  // Keep reading while the window and the outbound queue have room; the game thread and the
+  // writer drain them. Every action gets an arena of its own to be parsed into.
+  for (;;) {
+    FUESynthMessageArena Arena = FUESynthMessageArena::Acquire();
+    uesynth::ActionRequest* Request = Arena.Create<uesynth::ActionRequest>();
+    if (!Stream->Read(Request)) {
+      break;
+    }
+    {
+      std::unique_lock<std::mutex> Lock(Mutex);
+      StateChanged.wait(Lock, [this]() {
+        return (InFlight < MaxInFlight && !Outbound.ShouldThrottleReads()) || bWriteFailed;
+      });
+      if (bWriteFailed) {
+        break;
+      }
+      ++InFlight;
+    }
+
+    Dispatch(MoveTemp(Arena), Request);
+  }
+
+  // The client is done, so are its subscriptions; nothing is pushed past this point.
+  Link->Detach();
+
+  // A client that went away, rather than half-closed, takes the work still in flight with it
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (bWriteFailed || (Context && Context->IsCancelled())) {
+      Cancellation->Cancel();
+    }
+  }
+
+  // Every dispatched action captures this object, so wait for all of them before returning.
+  {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    StateChanged.wait(Lock, [this]() { return InFlight == 0; });
+    bReadsFinished = true;
+  }
+  StateChanged.notify_all();
+  Writer.join();
+
+  FUESynthServerStats::Get().OnStreamClosed();
+  return grpc::Status::OK;
+}
+
+void FUESynthControlStream::Dispatch(FUESynthMessageArena&& Arena,
+                                     const uesynth::ActionRequest* Request) {
+  const EUESynthCommandKind Kind = UESynthServiceImpl::GetActionKind(*Request);
+  FUESynthCallTimer Timer(FUESynthServerStats::GetActionName(*Request));
+  // The request's arena goes once the game thread is done with the call
+  FUESynthSessions::Enqueue(Session, Kind, [this, Arena = MoveTemp(Arena), Request,
+                                            Timer = MoveTemp(Timer)]() mutable {
+    if (Cancellation->IsCancelled()) {
+      FUESynthServerStats::Get().OnWorkDropped();
+      const grpc::Status Status = Cancellation->GetStatus();
+      Timer.OnFinished(Status);
+      OnActionCompleted(FUESynthQueuedResponse(), Status);
+      return;
+    }
+    Timer.OnStarted();
+    FUESynthStageScope GameThread(EUESynthStage::GameThread);
+    FUESynthCancellation::FScope CancellationScope(&Cancellation.Get());
+    if (UESynthServiceImpl::IsStreamedAction(*Request)) {
+      // Each response takes a slot of its own; the action's slot is released with OnDone.
+      Service.StreamActionOnGameThread(
+          *Request,
+          [this](uesynth::FrameResponse&& Response) { OnStreamedResponse(MoveTemp(Response)); },
+          [this, Timer = MoveTemp(Timer)](const grpc::Status& Status) mutable {
+            Timer.OnFinished(Status);
+            OnActionCompleted(FUESynthQueuedResponse(), Status);
+          });
+      return;
+    }
+
+    // Captures finish on a background thread, so the response and its arena live with the
+    // callback, then with the queue until written.
+    FUESynthMessageArena ResponseArena = FUESynthMessageArena::Acquire();
+    uesynth::FrameResponse* Response = ResponseArena.Create<uesynth::FrameResponse>();
+    Service.ProcessActionOnGameThread(
+        *Request, Response,
+        [this, ResponseArena = MoveTemp(ResponseArena), Response,
+         Timer = MoveTemp(Timer)](const grpc::Status& Status) mutable {
+          Timer.OnFinished(Status);
+          OnActionCompleted(FUESynthQueuedResponse(MoveTemp(ResponseArena), Response), Status);
+        },
+        Link);
+  });
+}
+
+void FUESynthControlStream::OnActionCompleted(FUESynthQueuedResponse&& Response,
+                                              const grpc::Status& Status) {
+  if (!Status.ok() && Cancellation->IsCancelled()) {
+    // Dropped; nobody is waiting to hear why
+    ReleaseSlot();
+    return;
+  }
+  if (!Status.ok()) {
+    // Log error and continue processing other requests
+    UE_LOG(LogTemp, Error, TEXT("Error processing action: %s"),
+           *FString(Status.error_message().c_str()));
+    ReleaseSlot();
+    return;
+  }
+
+  // Only send a response back to the client if there's data to send
+  if (Response.Get().response_case() == uesynth::FrameResponse::RESPONSE_NOT_SET) {
+    ReleaseSlot();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    EnqueueLocked(MoveTemp(Response));
+  }
+  StateChanged.notify_all();
+}
+
+void FUESynthControlStream::OnStreamedResponse(uesynth::FrameResponse&& Response) {
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    ++InFlight;
+    EnqueueLocked(MoveTemp(Response));
+  }
+  StateChanged.notify_all();
+}
+
+void FUESynthControlStream::EnqueueLocked(FUESynthQueuedResponse&& Response) {
+  InFlight -= Outbound.Push(MoveTemp(Response));
+}
+
+int32 FUESynthControlStream::GetNumQueued() const {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  return Outbound.Num();
+}
+
+FUESynthWriteQueueStats FUESynthControlStream::GetWriteQueueStats() const {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  return Outbound.GetStats();
+}
+
+bool FUESynthControlStream::Push(uesynth::FrameResponse&& Response) {
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (bWriteFailed) {
+      return false;
+    }
+    ++InFlight;
+    EnqueueLocked(MoveTemp(Response));
+  }
+  StateChanged.notify_all();
+  return true;
+}
+
+void FUESynthControlStream::ReleaseSlot() {
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    --InFlight;
+  }
+  StateChanged.notify_all();
+}
+
+void FUESynthControlStream::WriterLoop() {
+  for (;;) {
+    FUESynthQueuedResponse Response;
+    bool bSkipWrite = false;
+    {
+      std::unique_lock<std::mutex> Lock(Mutex);
+      StateChanged.wait(Lock, [this]() { return !Outbound.IsEmpty() || bReadsFinished; });
+      if (!Outbound.Pop(&Response)) {
+        return;
+      }
+      bSkipWrite = bWriteFailed;
+    }
+
+    // Packed in write order, outside the lock, so slots are reused in the order the client reads
+    if (const TSharedPtr<FUESynthSharedMemory> SharedMemory = Link->GetSharedMemory()) {
+      SharedMemory->Pack(&Response.Get());
+    }
+
+    // A slot is only released once its response has left the server, which bounds memory too.
+    if (!bSkipWrite) {
+      FUESynthStageScope Write(EUESynthStage::Write);
+      if (!Stream->Write(Response.Get())) {
+        // Client disconnected or write failed
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write response to client stream"));
+        std::lock_guard<std::mutex> Lock(Mutex);
+        bWriteFailed = true;
+      }
+    }
+    // Serialized by now; the payloads are free for the next frames and the arena for the next
+    // action
+    UESynthImageBuffers::Reclaim(&Response.Get());
+    Response = FUESynthQueuedResponse();
+    ReleaseSlot();
+  }
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UESynthSubscriptions.h"
+#include "UESynthWriteQueue.h"
+#include "pb/uesynth.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <condition_variable>
+#include <mutex>
+
+class FUESynthCancellation;
+class FUESynthSession;
+class UESynthServiceImpl;
+
+/**
+ * Pipelined driver for a single ControlStream call.
+ *
+ * The handler thread keeps reading ActionRequests and dispatches each one to the game thread as
+ * soon as a slot in the in-flight window is free. A dedicated writer thread sends every
+ * FrameResponse as soon as its action has finished, so responses may come back out of order and
+ * are matched to their requests through request_id. A window of 1 reproduces the old strictly
+ * sequential behaviour. Streamed actions such as capture_cameras answer with several responses,
+ * which may briefly push the window past its size. So do subscriptions, whose frames
+ * are pushed into the stream as the sink of its FUESynthStreamLink.
+ *
+ * Responses wait for the writer in a bounded FUESynthWriteQueue, so a client that reads slowly
+ * holds back new actions or loses stale frames, depending on the policy it asked for, instead of
+ * growing the queue without limit.
+ *
+ * A stream that names a session in its metadata runs every action in that session's world, see
+ * FUESynthSessions. Once the client cancels the stream, or its deadline passes, the actions still
+ * queued or capturing are dropped, see FUESynthCancellation.
+ */
+class FUESynthControlStream final : public IUESynthFrameSink
+{
+public:
+  using FStream = grpc::ServerReaderWriter<uesynth::FrameResponse, uesynth::ActionRequest>;
+
+  /** Client metadata key used to request the in-flight window for a stream. */
+  static constexpr const char* MaxInFlightMetadataKey = "uesynth-max-in-flight";
+  static constexpr int32 DefaultMaxInFlight = 1;
+  static constexpr int32 MaxAllowedInFlight = 256;
+
+  FUESynthControlStream(UESynthServiceImpl& InService, grpc::ServerContext* InContext,
+                        FStream* InStream, int32 InMaxInFlight, FUESynthWriteQueue&& InOutbound,
+                        const TSharedPtr<FUESynthSession>& InSession);
+
+  /** Runs the stream until the client half-closes and every in-flight action has been answered. */
+  grpc::Status Run();
+
+  /** Reads the in-flight window requested by the client, clamped to [1, MaxAllowedInFlight]. */
+  static int32 GetRequestedMaxInFlight(const grpc::ServerContext* Context);
+
+  //~ Begin IUESynthFrameSink interface
+  virtual int32 GetNumQueued() const override;
+  virtual bool Push(uesynth::FrameResponse&& Response) override;
+  virtual FUESynthWriteQueueStats GetWriteQueueStats() const override;
+  //~ End IUESynthFrameSink interface
+
+private:
+  /** Runs Request, which lives on Arena, on the game thread. */
+  void Dispatch(FUESynthMessageArena&& Arena, const uesynth::ActionRequest* Request);
+  void OnActionCompleted(FUESynthQueuedResponse&& Response, const grpc::Status& Status);
+  void OnStreamedResponse(uesynth::FrameResponse&& Response);
+  /** Queues a response holding a slot; a response the queue drops gives its slot back. */
+  void EnqueueLocked(FUESynthQueuedResponse&& Response);
+  void ReleaseSlot();
+  void WriterLoop();
+
+  UESynthServiceImpl& Service;
+  grpc::ServerContext* Context;
+  FStream* Stream;
+  const int32 MaxInFlight;
+  TSharedRef<FUESynthStreamLink> Link;
+  const TSharedPtr<FUESynthSession> Session;
+  /** Shared by every action of the stream. */
+  const TSharedRef<FUESynthCancellation> Cancellation;
+
+  mutable std::mutex Mutex;
+  std::condition_variable StateChanged;
+  FUESynthWriteQueue Outbound;
+  int32 InFlight = 0;
+  bool bReadsFinished = false;
+  bool bWriteFailed = false;
+};
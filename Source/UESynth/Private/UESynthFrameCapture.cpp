@@ -0,0 +1,641 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthFrameCapture.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "GlobalShader.h"
+#include "PixelShaderUtils.h"
+#include "PostProcess/PostProcessMaterialInputs.h"
+#include "RHIGPUReadback.h"
+#include "RHIStaticStates.h"
+#include "RenderGraphUtils.h"
+#include "RenderTargetPool.h"
+#include "RenderingThread.h"
+#include "SceneRenderTargetParameters.h"
+#include "SceneView.h"
+#include "ScreenPass.h"
+#include "ShaderParameterStruct.h"
+#include "TextureResource.h"
+#include "UESynthCancellation.h"
+#include "UESynthServerStats.h"
+#include "UnrealClient.h"
+
+namespace {
+
+/** Scene depth to view-space depth in cm, at render resolution. */
+class FUESynthLinearDepthPS : public FGlobalShader
+{
+public:
+  DECLARE_GLOBAL_SHADER(FUESynthLinearDepthPS);
+  SHADER_USE_PARAMETER_STRUCT(FUESynthLinearDepthPS, FGlobalShader);
+
+  BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+  SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SceneDepthTexture)
+  SHADER_PARAMETER(FVector4f, InvDeviceZToWorldZTransform)
+  SHADER_PARAMETER(FIntPoint, SourceOffset)
+  RENDER_TARGET_BINDING_SLOTS()
+  END_SHADER_PARAMETER_STRUCT()
+
+  static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters) {
+    return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+  }
+};
+
+/** Custom-depth stencil to an R8_UINT texture of segmentation IDs, at render resolution. */
+class FUESynthSegmentationPS : public FGlobalShader
+{
+public:
+  DECLARE_GLOBAL_SHADER(FUESynthSegmentationPS);
+  SHADER_USE_PARAMETER_STRUCT(FUESynthSegmentationPS, FGlobalShader);
+
+  BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+  SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D<uint2>, CustomStencilTexture)
+  SHADER_PARAMETER(FIntPoint, SourceOffset)
+  RENDER_TARGET_BINDING_SLOTS()
+  END_SHADER_PARAMETER_STRUCT()
+
+  static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters) {
+    return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+  }
+};
+
+/** Velocity buffer and depth to per-pixel motion in output pixels, at output resolution. */
+class FUESynthOpticalFlowPS : public FGlobalShader
+{
+public:
+  DECLARE_GLOBAL_SHADER(FUESynthOpticalFlowPS);
+  SHADER_USE_PARAMETER_STRUCT(FUESynthOpticalFlowPS, FGlobalShader);
+
+  BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+  SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SceneDepthTexture)
+  SHADER_PARAMETER_RDG_TEXTURE(Texture2D, VelocityTexture)
+  SHADER_PARAMETER(FMatrix44f, ClipToPrevClip)
+  SHADER_PARAMETER(FIntPoint, SourceOffset)
+  SHADER_PARAMETER(FIntPoint, SourceSize)
+  SHADER_PARAMETER(FVector2f, OutputSize)
+  RENDER_TARGET_BINDING_SLOTS()
+  END_SHADER_PARAMETER_STRUCT()
+
+  static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters) {
+    return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+  }
+};
+
+/** Rect of a float texture scaled to the render target's size. */
+class FUESynthResamplePS : public FGlobalShader
+{
+public:
+  DECLARE_GLOBAL_SHADER(FUESynthResamplePS);
+  SHADER_USE_PARAMETER_STRUCT(FUESynthResamplePS, FGlobalShader);
+
+  /** Takes the nearest source pixel rather than averaging each output pixel's footprint. */
+  class FNearestDim : SHADER_PERMUTATION_BOOL("RESAMPLE_NEAREST");
+  using FPermutationDomain = TShaderPermutationDomain<FNearestDim>;
+
+  BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+  SHADER_PARAMETER_RDG_TEXTURE(Texture2D, ResampleTexture)
+  SHADER_PARAMETER_SAMPLER(SamplerState, ResampleSampler)
+  SHADER_PARAMETER(FVector2f, ResampleMin)
+  SHADER_PARAMETER(FVector2f, ResampleFootprint)
+  SHADER_PARAMETER(FVector2f, ResampleInvExtent)
+  SHADER_PARAMETER(FVector4f, ResampleValueScale)
+  RENDER_TARGET_BINDING_SLOTS()
+  END_SHADER_PARAMETER_STRUCT()
+
+  static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters) {
+    return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+  }
+};
+
+/** Rect of an R8_UINT texture of segmentation IDs scaled to the render target's size. */
+class FUESynthResampleIdsPS : public FGlobalShader
+{
+public:
+  DECLARE_GLOBAL_SHADER(FUESynthResampleIdsPS);
+  SHADER_USE_PARAMETER_STRUCT(FUESynthResampleIdsPS, FGlobalShader);
+
+  BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+  SHADER_PARAMETER_RDG_TEXTURE(Texture2D<uint>, ResampleIds)
+  SHADER_PARAMETER(FVector2f, ResampleMin)
+  SHADER_PARAMETER(FVector2f, ResampleFootprint)
+  RENDER_TARGET_BINDING_SLOTS()
+  END_SHADER_PARAMETER_STRUCT()
+
+  static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters) {
+    return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+  }
+};
+
+/** Maps Rect from the From rect's pixel grid onto To's, clipped to To. */
+FIntRect ScaleRect(const FIntRect& Rect, const FIntRect& From, const FIntRect& To) {
+  const double ScaleX = double(To.Width()) / FMath::Max(From.Width(), 1);
+  const double ScaleY = double(To.Height()) / FMath::Max(From.Height(), 1);
+  FIntRect Scaled(To.Min.X + FMath::FloorToInt32((Rect.Min.X - From.Min.X) * ScaleX),
+                  To.Min.Y + FMath::FloorToInt32((Rect.Min.Y - From.Min.Y) * ScaleY),
+                  To.Min.X + FMath::CeilToInt32((Rect.Max.X - From.Min.X) * ScaleX),
+                  To.Min.Y + FMath::CeilToInt32((Rect.Max.Y - From.Min.Y) * ScaleY));
+  Scaled.Clip(To);
+  return Scaled;
+}
+
+/** Linearizes RenderRect of SceneDepth into a new R32F texture whose origin is RenderRect.Min. */
+FRDGTexture* AddLinearDepthPass(FRDGBuilder& GraphBuilder, const FSceneView& View,
+                                FRDGTexture* SceneDepth, const FIntRect& RenderRect) {
+  FRDGTexture* LinearDepth = GraphBuilder.CreateTexture(
+      FRDGTextureDesc::Create2D(RenderRect.Size(), PF_R32_FLOAT, FClearValueBinding::Black,
+                                TexCreate_RenderTargetable | TexCreate_ShaderResource),
+      TEXT("UESynth.LinearDepth"));
+
+  FUESynthLinearDepthPS::FParameters* Parameters =
+      GraphBuilder.AllocParameters<FUESynthLinearDepthPS::FParameters>();
+  Parameters->SceneDepthTexture = SceneDepth;
+  Parameters->InvDeviceZToWorldZTransform = View.InvDeviceZToWorldZTransform;
+  Parameters->SourceOffset = RenderRect.Min;
+  Parameters->RenderTargets[0] =
+      FRenderTargetBinding(LinearDepth, ERenderTargetLoadAction::ENoAction);
+
+  FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+  TShaderMapRef<FUESynthLinearDepthPS> PixelShader(ShaderMap);
+  FPixelShaderUtils::AddFullscreenPass(
+      GraphBuilder, ShaderMap, RDG_EVENT_NAME("UESynthLinearDepth"), PixelShader, Parameters,
+      FIntRect(FIntPoint::ZeroValue, RenderRect.Size()));
+  return LinearDepth;
+}
+
+/** Copies RenderRect of the custom stencil into a new R8_UINT texture with its origin at Min. */
+FRDGTexture* AddSegmentationPass(FRDGBuilder& GraphBuilder, const FSceneView& View,
+                                 FRDGTextureSRV* CustomStencil, const FIntRect& RenderRect) {
+  FRDGTexture* Segmentation = GraphBuilder.CreateTexture(
+      FRDGTextureDesc::Create2D(RenderRect.Size(), PF_R8_UINT, FClearValueBinding::Black,
+                                TexCreate_RenderTargetable | TexCreate_ShaderResource),
+      TEXT("UESynth.Segmentation"));
+
+  FUESynthSegmentationPS::FParameters* Parameters =
+      GraphBuilder.AllocParameters<FUESynthSegmentationPS::FParameters>();
+  Parameters->CustomStencilTexture = CustomStencil;
+  Parameters->SourceOffset = RenderRect.Min;
+  Parameters->RenderTargets[0] =
+      FRenderTargetBinding(Segmentation, ERenderTargetLoadAction::ENoAction);
+
+  FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+  TShaderMapRef<FUESynthSegmentationPS> PixelShader(ShaderMap);
+  FPixelShaderUtils::AddFullscreenPass(
+      GraphBuilder, ShaderMap, RDG_EVENT_NAME("UESynthSegmentation"), PixelShader, Parameters,
+      FIntRect(FIntPoint::ZeroValue, RenderRect.Size()));
+  return Segmentation;
+}
+
+/**
+ * Turns RenderRect of the velocity buffer into a new G16R16F texture of OutputSize holding each
+ * pixel's motion since the previous frame, in output pixels.
+ */
+FRDGTexture* AddOpticalFlowPass(FRDGBuilder& GraphBuilder, const FSceneView& View,
+                                FRDGTexture* SceneDepth, FRDGTexture* Velocity,
+                                const FIntRect& RenderRect, FIntPoint OutputSize) {
+  FRDGTexture* Flow = GraphBuilder.CreateTexture(
+      FRDGTextureDesc::Create2D(OutputSize, PF_G16R16F, FClearValueBinding::Black,
+                                TexCreate_RenderTargetable | TexCreate_ShaderResource),
+      TEXT("UESynth.OpticalFlow"));
+
+  FUESynthOpticalFlowPS::FParameters* Parameters =
+      GraphBuilder.AllocParameters<FUESynthOpticalFlowPS::FParameters>();
+  Parameters->SceneDepthTexture = SceneDepth;
+  Parameters->VelocityTexture = Velocity;
+  Parameters->ClipToPrevClip = View.CachedViewUniformShaderParameters->ClipToPrevClip;
+  Parameters->SourceOffset = RenderRect.Min;
+  Parameters->SourceSize = RenderRect.Size();
+  Parameters->OutputSize = FVector2f(OutputSize);
+  Parameters->RenderTargets[0] = FRenderTargetBinding(Flow, ERenderTargetLoadAction::ENoAction);
+
+  FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+  TShaderMapRef<FUESynthOpticalFlowPS> PixelShader(ShaderMap);
+  FPixelShaderUtils::AddFullscreenPass(
+      GraphBuilder, ShaderMap, RDG_EVENT_NAME("UESynthOpticalFlow"), PixelShader, Parameters,
+      FIntRect(FIntPoint::ZeroValue, OutputSize));
+  return Flow;
+}
+
+/**
+ * Scales Rect of Texture into a new texture of OutputSize in the same format. Rgb is box filtered
+ * over each output pixel's footprint; every other modality takes the nearest source pixel, and
+ * optical flow is rescaled into output pixels.
+ */
+FRDGTexture* AddResamplePass(FRDGBuilder& GraphBuilder, EUESynthCaptureModality Modality,
+                             FRDGTexture* Texture, const FIntRect& Rect, FIntPoint OutputSize) {
+  FRDGTexture* Resampled = GraphBuilder.CreateTexture(
+      FRDGTextureDesc::Create2D(OutputSize, Texture->Desc.Format, FClearValueBinding::Black,
+                                TexCreate_RenderTargetable | TexCreate_ShaderResource),
+      TEXT("UESynth.Resampled"));
+  const FVector2f Footprint = FVector2f(Rect.Size()) / FVector2f(OutputSize);
+  const FIntRect OutputRect(FIntPoint::ZeroValue, OutputSize);
+  FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+
+  if (Modality == EUESynthCaptureModality::Segmentation) {
+    FUESynthResampleIdsPS::FParameters* Parameters =
+        GraphBuilder.AllocParameters<FUESynthResampleIdsPS::FParameters>();
+    Parameters->ResampleIds = Texture;
+    Parameters->ResampleMin = FVector2f(Rect.Min);
+    Parameters->ResampleFootprint = Footprint;
+    Parameters->RenderTargets[0] =
+        FRenderTargetBinding(Resampled, ERenderTargetLoadAction::ENoAction);
+
+    TShaderMapRef<FUESynthResampleIdsPS> PixelShader(ShaderMap);
+    FPixelShaderUtils::AddFullscreenPass(GraphBuilder, ShaderMap,
+                                         RDG_EVENT_NAME("UESynthResampleIds"), PixelShader,
+                                         Parameters, OutputRect);
+    return Resampled;
+  }
+
+  FUESynthResamplePS::FParameters* Parameters =
+      GraphBuilder.AllocParameters<FUESynthResamplePS::FParameters>();
+  Parameters->ResampleTexture = Texture;
+  Parameters->ResampleSampler = TStaticSamplerState<SF_Bilinear>::GetRHI();
+  Parameters->ResampleMin = FVector2f(Rect.Min);
+  Parameters->ResampleFootprint = Footprint;
+  Parameters->ResampleInvExtent = FVector2f(1.0f) / FVector2f(Texture->Desc.Extent);
+  // Flow is measured in pixels, so it shrinks and grows with them
+  Parameters->ResampleValueScale =
+      Modality == EUESynthCaptureModality::OpticalFlow
+          ? FVector4f(1.0f / Footprint.X, 1.0f / Footprint.Y, 1.0f, 1.0f)
+          : FVector4f(1.0f, 1.0f, 1.0f, 1.0f);
+  Parameters->RenderTargets[0] =
+      FRenderTargetBinding(Resampled, ERenderTargetLoadAction::ENoAction);
+
+  FUESynthResamplePS::FPermutationDomain Permutation;
+  Permutation.Set<FUESynthResamplePS::FNearestDim>(Modality != EUESynthCaptureModality::Rgb);
+  TShaderMapRef<FUESynthResamplePS> PixelShader(ShaderMap, Permutation);
+  FPixelShaderUtils::AddFullscreenPass(GraphBuilder, ShaderMap,
+                                       RDG_EVENT_NAME("UESynthResample"), PixelShader, Parameters,
+                                       OutputRect);
+  return Resampled;
+}
+
+} // namespace
+
+IMPLEMENT_GLOBAL_SHADER(FUESynthLinearDepthPS, "/Plugin/UESynth/Private/UESynthCapture.usf",
+                        "LinearDepthPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FUESynthSegmentationPS, "/Plugin/UESynth/Private/UESynthCapture.usf",
+                        "SegmentationPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FUESynthOpticalFlowPS, "/Plugin/UESynth/Private/UESynthCapture.usf",
+                        "OpticalFlowPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FUESynthResamplePS, "/Plugin/UESynth/Private/UESynthCapture.usf",
+                        "ResamplePS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FUESynthResampleIdsPS, "/Plugin/UESynth/Private/UESynthCapture.usf",
+                        "ResampleIdsPS", SF_Pixel);
+
+FUESynthFrameCapture* FUESynthFrameCapture::Instance = nullptr;
+
+FUESynthFrameCapture::FUESynthFrameCapture(const FAutoRegister& AutoRegister)
+    : FSceneViewExtensionBase(AutoRegister) {
+  check(Instance == nullptr);
+  Instance = this;
+}
+
+FUESynthFrameCapture::~FUESynthFrameCapture() {
+  Instance = nullptr;
+
+  // Complete whatever is in flight so nobody waiting on a reply is left hanging, and let the
+  // render thread drop the staging buffers.
+  ENQUEUE_RENDER_COMMAND(UESynthReleaseCaptures)
+  ([this](FRHICommandListImmediate& RHICmdList) {
+    FailWaiting_RenderThread();
+    RHICmdList.BlockUntilGPUIdle();
+    Poll_RenderThread(/*bWait=*/true);
+    FreeReadbacks.Empty();
+  });
+  FlushRenderingCommands();
+
+  while (NumOutstanding.load() > 0) {
+    FPlatformProcess::SleepNoStats(0.0f);
+  }
+}
+
+FUESynthFrameCapture* FUESynthFrameCapture::Get() {
+  return Instance;
+}
+
+void FUESynthFrameCapture::Request(EUESynthCaptureModality Modalities, const FIntRect& Rect,
+                                   FIntPoint OutputSize, FOnTextureMapped&& OnTextureMapped,
+                                   FOnCaptureComplete&& OnComplete) {
+  check(IsInGameThread());
+  ++NumOutstanding;
+
+  FScopeLock Lock(&WaitingLock);
+  Waiting.Add(FRequest{Modalities & SupportedModalities, Rect, OutputSize,
+                       MoveTemp(OnTextureMapped), MoveTemp(OnComplete),
+                       FPlatformTime::Seconds(), FUESynthCancellation::GetActive()});
+}
+
+void FUESynthFrameCapture::RequestTargets(TArrayView<const FUESynthCaptureTarget> Targets,
+                                          const FIntRect& Rect, FIntPoint OutputSize,
+                                          FOnTextureMapped&& OnTextureMapped,
+                                          FOnCaptureComplete&& OnComplete) {
+  check(IsInGameThread());
+  ++NumOutstanding;
+
+  FRequest Request{EUESynthCaptureModality::None, Rect, OutputSize, MoveTemp(OnTextureMapped),
+                   MoveTemp(OnComplete), FPlatformTime::Seconds(),
+                   FUESynthCancellation::GetActive()};
+  ENQUEUE_RENDER_COMMAND(UESynthCaptureTargets)
+  ([this, Targets = TArray<FUESynthCaptureTarget>(Targets),
+    Request = MoveTemp(Request)](FRHICommandListImmediate& RHICmdList) mutable {
+    TRACE_CPUPROFILER_EVENT_SCOPE(FUESynthFrameCapture::RequestTargets_RenderThread);
+    if (FUESynthCancellation::IsCancelled(Request.Cancellation)) {
+      FUESynthServerStats::Get().OnWorkDropped();
+      Complete_RenderThread(MoveTemp(Request), EUESynthCaptureModality::None);
+      return;
+    }
+    FInFlight& Capture = InFlight.AddDefaulted_GetRef();
+    Capture.Request = MoveTemp(Request);
+
+    FRDGBuilder GraphBuilder(RHICmdList);
+    for (const FUESynthCaptureTarget& Target : Targets) {
+      FRHITexture* Texture = Target.Resource ? Target.Resource->GetRenderTargetTexture() : nullptr;
+      if (!Texture) {
+        continue;
+      }
+      FIntRect TargetRect = Capture.Request.Rect;
+      TargetRect.Clip(FIntRect(FIntPoint::ZeroValue, Texture->GetSizeXY()));
+      Capture.Request.Modalities |= Target.Modality;
+      EnqueueCopy_RenderThread(
+          GraphBuilder, Capture, Target.Modality,
+          GraphBuilder.RegisterExternalTexture(CreateRenderTarget(Texture, TEXT("UESynth.Target"))),
+          TargetRect);
+    }
+    GraphBuilder.Execute();
+
+    if (Capture.Copies.Num() == 0) {
+      Complete_RenderThread(MoveTemp(Capture.Request), EUESynthCaptureModality::None);
+      InFlight.Pop();
+    }
+  });
+}
+
+void FUESynthFrameCapture::Flush() {
+  check(IsInGameThread());
+  if (NumOutstanding.load() == 0) {
+    return;
+  }
+
+  bool bHasWaiting = false;
+  {
+    FScopeLock Lock(&WaitingLock);
+    bHasWaiting = Waiting.Num() > 0;
+  }
+
+  // Waiting requests need a frame; render one without presenting it.
+  FViewport* Viewport =
+      GEngine && GEngine->GameViewport ? GEngine->GameViewport->Viewport : nullptr;
+  if (bHasWaiting && Viewport) {
+    Viewport->Draw(/*bShouldPresent=*/false);
+  }
+
+  ENQUEUE_RENDER_COMMAND(UESynthFlushCaptures)
+  ([this](FRHICommandListImmediate& RHICmdList) {
+    FailWaiting_RenderThread();
+    RHICmdList.BlockUntilGPUIdle();
+    Poll_RenderThread(/*bWait=*/true);
+  });
+  FlushRenderingCommands();
+
+  // Every capture has been handed off by now; wait for the callbacks themselves.
+  while (NumOutstanding.load() > 0) {
+    FPlatformProcess::SleepNoStats(0.0f);
+  }
+}
+
+void FUESynthFrameCapture::SubscribeToPostProcessingPass(
+    EPostProcessingPass Pass, FAfterPassCallbackDelegateArray& InOutPassCallbacks,
+    bool bIsPassEnabled) {
+  if (Pass == EPostProcessingPass::Tonemap && bIsPassEnabled) {
+    InOutPassCallbacks.Add(FAfterPassCallbackDelegate::CreateRaw(
+        this, &FUESynthFrameCapture::PostTonemap_RenderThread));
+  }
+}
+
+void FUESynthFrameCapture::Tick(float DeltaTime) {
+  if (NumOutstanding.load() > 0) {
+    ENQUEUE_RENDER_COMMAND(UESynthPollCaptures)
+    ([this](FRHICommandListImmediate& RHICmdList) { Poll_RenderThread(/*bWait=*/false); });
+  }
+}
+
+TStatId FUESynthFrameCapture::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(FUESynthFrameCapture, STATGROUP_Tickables);
+}
+
+bool FUESynthFrameCapture::IsActiveThisFrame_Internal(
+    const FSceneViewExtensionContext& Context) const {
+  // Only the game viewport, and only while someone is waiting for it.
+  return NumOutstanding.load() > 0 && GEngine && GEngine->GameViewport &&
+         Context.Viewport == GEngine->GameViewport->Viewport;
+}
+
+FScreenPassTexture FUESynthFrameCapture::PostTonemap_RenderThread(
+    FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessMaterialInputs& Inputs) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(FUESynthFrameCapture::PostTonemap_RenderThread);
+  if (View.bIsSceneCapture || View.bIsReflectionCapture || View.bIsPlanarReflection) {
+    return Inputs.ReturnUntouchedSceneColorForPostProcessing(GraphBuilder);
+  }
+
+  TArray<FRequest> Requests;
+  {
+    FScopeLock Lock(&WaitingLock);
+    Requests = MoveTemp(Waiting);
+  }
+  if (Requests.Num() == 0) {
+    return Inputs.ReturnUntouchedSceneColorForPostProcessing(GraphBuilder);
+  }
+
+  // Request rects are in viewport pixels; every source texture has its own view rect within it.
+  const FIntRect OutputRect = View.UnscaledViewRect;
+  const FScreenPassTexture SceneColor = Inputs.GetInput(EPostProcessMaterialInput::SceneColor);
+  const FSceneTextureUniformParameters* SceneTextures =
+      Inputs.SceneTextures.SceneTextures ? Inputs.SceneTextures.SceneTextures->GetParameters()
+                                         : nullptr;
+  const FViewUniformShaderParameters& ViewParameters = *View.CachedViewUniformShaderParameters;
+  const FIntPoint RenderMin(FMath::RoundToInt32(ViewParameters.ViewRectMin.X),
+                            FMath::RoundToInt32(ViewParameters.ViewRectMin.Y));
+  const FIntPoint RenderSize(FMath::RoundToInt32(ViewParameters.ViewSizeAndInvSize.X),
+                             FMath::RoundToInt32(ViewParameters.ViewSizeAndInvSize.Y));
+  const FIntRect RenderRect(RenderMin, RenderMin + RenderSize);
+
+  // Shared by every request of this frame that wants them.
+  FRDGTexture* LinearDepth = nullptr;
+  FRDGTexture* Segmentation = nullptr;
+  FRDGTexture* OpticalFlow = nullptr;
+
+  for (FRequest& Request : Requests) {
+    if (FUESynthCancellation::IsCancelled(Request.Cancellation)) {
+      FUESynthServerStats::Get().OnWorkDropped();
+      Complete_RenderThread(MoveTemp(Request), EUESynthCaptureModality::None);
+      continue;
+    }
+    FInFlight& Capture = InFlight.AddDefaulted_GetRef();
+    Capture.Request = MoveTemp(Request);
+    const EUESynthCaptureModality Wanted = Capture.Request.Modalities;
+    const FIntRect& Rect = Capture.Request.Rect;
+
+    if (EnumHasAnyFlags(Wanted, EUESynthCaptureModality::Rgb) && SceneColor.IsValid()) {
+      EnqueueCopy_RenderThread(GraphBuilder, Capture, EUESynthCaptureModality::Rgb,
+                               SceneColor.Texture,
+                               ScaleRect(Rect, OutputRect, SceneColor.ViewRect));
+    }
+    if (EnumHasAnyFlags(Wanted, EUESynthCaptureModality::Depth) && SceneTextures &&
+        SceneTextures->SceneDepthTexture) {
+      if (!LinearDepth) {
+        LinearDepth =
+            AddLinearDepthPass(GraphBuilder, View, SceneTextures->SceneDepthTexture, RenderRect);
+      }
+      EnqueueCopy_RenderThread(
+          GraphBuilder, Capture, EUESynthCaptureModality::Depth, LinearDepth,
+          ScaleRect(Rect, OutputRect, FIntRect(FIntPoint::ZeroValue, RenderRect.Size())));
+    }
+    if (EnumHasAnyFlags(Wanted, EUESynthCaptureModality::Segmentation) && SceneTextures &&
+        SceneTextures->CustomStencilTexture) {
+      if (!Segmentation) {
+        Segmentation = AddSegmentationPass(GraphBuilder, View, SceneTextures->CustomStencilTexture,
+                                           RenderRect);
+      }
+      EnqueueCopy_RenderThread(
+          GraphBuilder, Capture, EUESynthCaptureModality::Segmentation, Segmentation,
+          ScaleRect(Rect, OutputRect, FIntRect(FIntPoint::ZeroValue, RenderRect.Size())));
+    }
+    if (EnumHasAnyFlags(Wanted, EUESynthCaptureModality::Normals) && SceneTextures &&
+        SceneTextures->GBufferATexture) {
+      EnqueueCopy_RenderThread(GraphBuilder, Capture, EUESynthCaptureModality::Normals,
+                               SceneTextures->GBufferATexture,
+                               ScaleRect(Rect, OutputRect, RenderRect));
+    }
+    if (EnumHasAnyFlags(Wanted, EUESynthCaptureModality::OpticalFlow) && SceneTextures &&
+        SceneTextures->SceneDepthTexture && SceneTextures->GBufferVelocityTexture) {
+      if (!OpticalFlow) {
+        OpticalFlow = AddOpticalFlowPass(GraphBuilder, View, SceneTextures->SceneDepthTexture,
+                                         SceneTextures->GBufferVelocityTexture, RenderRect,
+                                         OutputRect.Size());
+      }
+      EnqueueCopy_RenderThread(
+          GraphBuilder, Capture, EUESynthCaptureModality::OpticalFlow, OpticalFlow,
+          ScaleRect(Rect, OutputRect, FIntRect(FIntPoint::ZeroValue, OutputRect.Size())));
+    }
+
+    if (Capture.Copies.Num() == 0) {
+      Complete_RenderThread(MoveTemp(Capture.Request), EUESynthCaptureModality::None);
+      InFlight.Pop();
+    }
+  }
+
+  return Inputs.ReturnUntouchedSceneColorForPostProcessing(GraphBuilder);
+}
+
+void FUESynthFrameCapture::EnqueueCopy_RenderThread(FRDGBuilder& GraphBuilder,
+                                                    FInFlight& Capture,
+                                                    EUESynthCaptureModality Modality,
+                                                    FRDGTexture* Texture, const FIntRect& Rect) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(FUESynthFrameCapture::EnqueueCopy_RenderThread);
+  if (!Texture || Rect.Area() <= 0) {
+    return;
+  }
+
+  // Scaled first, so the copy and everything after it only touch the pixels asked for
+  FIntRect CopyRect = Rect;
+  const FIntPoint OutputSize = Capture.Request.OutputSize;
+  if (OutputSize.X > 0 && OutputSize.Y > 0 && OutputSize != Rect.Size()) {
+    Texture = AddResamplePass(GraphBuilder, Modality, Texture, Rect, OutputSize);
+    CopyRect = FIntRect(FIntPoint::ZeroValue, OutputSize);
+  }
+
+  FTextureCopy& Copy = Capture.Copies.AddDefaulted_GetRef();
+  Copy.Modality = Modality;
+  Copy.Readback = FreeReadbacks.Num() > 0
+                      ? FreeReadbacks.Pop(/*bAllowShrinking=*/false)
+                      : MakeUnique<FRHIGPUTextureReadback>(TEXT("UESynthCapture"));
+  Copy.Size = CopyRect.Size();
+  Copy.Format = Texture->Desc.Format;
+
+  // Lands in the staging buffer whenever the GPU gets to it; nothing waits here.
+  AddEnqueueCopyPass(GraphBuilder, Copy.Readback.Get(), Texture, FResolveRect(CopyRect));
+}
+
+void FUESynthFrameCapture::Poll_RenderThread(bool bWait) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(FUESynthFrameCapture::Poll_RenderThread);
+  FUESynthServerStats& Stats = FUESynthServerStats::Get();
+  for (int32 Index = 0; Index < InFlight.Num();) {
+    FInFlight& Capture = InFlight[Index];
+
+    bool bReady = true;
+    for (const FTextureCopy& Copy : Capture.Copies) {
+      bReady &= bWait || Copy.Readback->IsReady();
+    }
+    if (!bReady) {
+      ++Index;
+      continue;
+    }
+
+    // A cancelled capture's pixels are never converted; its staging buffers are reused as is
+    const bool bDropped = FUESynthCancellation::IsCancelled(Capture.Request.Cancellation);
+    if (bDropped) {
+      Stats.OnWorkDropped();
+    } else {
+      Stats.RecordStage(EUESynthStage::Readback,
+                        FPlatformTime::Seconds() - Capture.Request.RequestSeconds);
+    }
+
+    EUESynthCaptureModality Captured = EUESynthCaptureModality::None;
+    for (FTextureCopy& Copy : Capture.Copies) {
+      int32 RowPitchInPixels = 0;
+      const uint8* Data =
+          bDropped ? nullptr : static_cast<const uint8*>(Copy.Readback->Lock(RowPitchInPixels));
+      if (Data) {
+        FUESynthCapturedTexture Texture;
+        Texture.Modality = Copy.Modality;
+        Texture.Frame.Data = Data;
+        Texture.Frame.RowPitch =
+            FMath::Max(RowPitchInPixels, Copy.Size.X) * GPixelFormats[Copy.Format].BlockBytes;
+        Texture.Frame.Size = Copy.Size;
+        Texture.Frame.Format = Copy.Format;
+        {
+          FUESynthStageScope ConvertScope(EUESynthStage::PixelConvert);
+          if (Capture.Request.OnTextureMapped(Texture)) {
+            Captured |= Copy.Modality;
+          }
+        }
+        Copy.Readback->Unlock();
+      }
+      FreeReadbacks.Add(MoveTemp(Copy.Readback));
+    }
+
+    Complete_RenderThread(MoveTemp(Capture.Request), Captured);
+    InFlight.RemoveAt(Index);
+  }
+}
+
+void FUESynthFrameCapture::FailWaiting_RenderThread() {
+  TArray<FRequest> Requests;
+  {
+    FScopeLock Lock(&WaitingLock);
+    Requests = MoveTemp(Waiting);
+  }
+  for (FRequest& Request : Requests) {
+    Complete_RenderThread(MoveTemp(Request), EUESynthCaptureModality::None);
+  }
+}
+
+void FUESynthFrameCapture::Complete_RenderThread(FRequest&& Request,
+                                                 EUESynthCaptureModality Captured) {
+  Request.OnTextureMapped = nullptr;
+
+  // Whatever the consumer does on completion stays off the render thread. The capture only
+  // stops counting as outstanding once the callback has returned, so Flush covers it too.
+  AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+            [this, OnComplete = MoveTemp(Request.OnComplete),
+             Cancellation = MoveTemp(Request.Cancellation), Captured]() mutable {
+              {
+                FUESynthCancellation::FScope CancellationScope(Cancellation);
+                OnComplete(Captured);
+              }
+              --NumOutstanding;
+            });
+}
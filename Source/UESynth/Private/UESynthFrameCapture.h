@@ -0,0 +1,196 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SceneViewExtension.h"
+#include "Tickable.h"
+#include "UESynthFrameReadback.h"
+#include <atomic>
+
+class FRDGBuilder;
+class FRHIGPUTextureReadback;
+class FTextureRenderTargetResource;
+class FUESynthCancellation;
+struct FPostProcessMaterialInputs;
+struct FScreenPassTexture;
+
+/** What a multi-modal capture can read back; the values match uesynth::CaptureModality. */
+enum class EUESynthCaptureModality : uint32
+{
+  None = 0,
+  Rgb = 1 << 0,
+  Depth = 1 << 1,
+  Segmentation = 1 << 2,
+  Normals = 1 << 3,
+  OpticalFlow = 1 << 4,
+};
+ENUM_CLASS_FLAGS(EUESynthCaptureModality);
+
+/** One read-back scene texture, mapped for the duration of the OnMapped call. */
+struct FUESynthCapturedTexture
+{
+  EUESynthCaptureModality Modality = EUESynthCaptureModality::None;
+  FUESynthMappedFrame Frame;
+};
+
+/** A render target that already holds one modality, e.g. a pooled camera's scene capture. */
+struct FUESynthCaptureTarget
+{
+  EUESynthCaptureModality Modality = EUESynthCaptureModality::None;
+  FTextureRenderTargetResource* Resource = nullptr;
+};
+
+/**
+ * Reads several outputs of one rendered frame back in a single pass.
+ *
+ * Separate capture RPCs would each need their own frame. This scene view extension instead hooks
+ * the game view's post-processing right after tonemapping, where the final color and the scene
+ * textures of the same frame are all still alive, and enqueues GPU copies of just the requested
+ * components:
+ * - Rgb: the tonemapped scene color, the same pixels the viewport shows.
+ * - Depth: view-space depth in cm as float32, linearized on the GPU by a small pixel shader.
+ * - Segmentation: the custom-depth stencil, where registered actors write their segmentation ID.
+ * - Normals: GBufferA, world-space normals encoded as N * 0.5 + 0.5.
+ * - OpticalFlow: the velocity buffer as per-pixel motion since the previous frame, in viewport
+ *   pixels as half floats. Pixels nothing moving drew to get the camera's motion from depth.
+ * Scene textures are read at render resolution, so with a screen percentage below 100 they come
+ * back smaller than Rgb. Optical flow is resampled to viewport pixels, so it lines up with Rgb
+ * pixel for pixel. A request can also ask for a fixed output size: every modality is then scaled
+ * to exactly that size on the GPU before its copy, so only those pixels are read back and they
+ * line up across modalities. Color is box filtered; depth, IDs, normals and flow take the nearest
+ * source pixel, so no value is blended across an edge. Copies are polled every tick like
+ * FUESynthFrameReadback's.
+ */
+class FUESynthFrameCapture final : public FSceneViewExtensionBase, public FTickableGameObject
+{
+public:
+  /** Modalities this build knows how to read back. */
+  static constexpr EUESynthCaptureModality SupportedModalities =
+      EUESynthCaptureModality::Rgb | EUESynthCaptureModality::Depth |
+      EUESynthCaptureModality::Segmentation | EUESynthCaptureModality::Normals |
+      EUESynthCaptureModality::OpticalFlow;
+
+  /** Render thread, once per captured modality while it is mapped; returns whether it was used. */
+  using FOnTextureMapped = TUniqueFunction<bool(const FUESynthCapturedTexture&)>;
+  /** Background thread: the modalities whose OnTextureMapped returned true. */
+  using FOnCaptureComplete = TUniqueFunction<void(EUESynthCaptureModality Captured)>;
+
+  explicit FUESynthFrameCapture(const FAutoRegister& AutoRegister);
+  virtual ~FUESynthFrameCapture() override;
+
+  /** The module-owned extension, or null until the engine has finished initializing. */
+  static FUESynthFrameCapture* Get();
+
+  /**
+   * Captures Modalities from the next rendered game view. Rect crops the output in viewport
+   * pixels; scene textures get the matching render-resolution rect. A non-zero OutputSize scales
+   * every modality's crop to that size before it is read back. Modalities outside
+   * SupportedModalities are ignored. The capture belongs to the call active on the game thread
+   * (see FUESynthCancellation); once that is cancelled it is dropped at its next stage and
+   * completes with nothing captured. Game thread only.
+   */
+  void Request(EUESynthCaptureModality Modalities, const FIntRect& Rect, FIntPoint OutputSize,
+               FOnTextureMapped&& OnTextureMapped, FOnCaptureComplete&& OnComplete);
+
+  /**
+   * Reads Rect of each of Targets back, scaled to OutputSize unless that is zero. The copies are
+   * enqueued on the render thread behind whatever was enqueued before, so a scene capture made
+   * just before this call is what gets read. The resources must stay alive until the render thread
+   * has run that far. Game thread only.
+   */
+  void RequestTargets(TArrayView<const FUESynthCaptureTarget> Targets, const FIntRect& Rect,
+                      FIntPoint OutputSize, FOnTextureMapped&& OnTextureMapped,
+                      FOnCaptureComplete&& OnComplete);
+
+  /**
+   * Renders the game viewport if a request is still waiting for a frame, then blocks until every
+   * request has completed. For game-thread callers that have to wait for a result.
+   */
+  void Flush();
+
+  //~ Begin ISceneViewExtension interface
+  virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+  virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+  virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+  virtual void SubscribeToPostProcessingPass(EPostProcessingPass Pass,
+                                             FAfterPassCallbackDelegateArray& InOutPassCallbacks,
+                                             bool bIsPassEnabled) override;
+  //~ End ISceneViewExtension interface
+
+  //~ Begin FTickableGameObject interface
+  virtual void Tick(float DeltaTime) override;
+  virtual ETickableTickType GetTickableTickType() const override {
+    return ETickableTickType::Always;
+  }
+  virtual bool IsTickableWhenPaused() const override {
+    return true;
+  }
+  virtual bool IsTickableInEditor() const override {
+    return true;
+  }
+  virtual TStatId GetStatId() const override;
+  //~ End FTickableGameObject interface
+
+protected:
+  virtual bool IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const override;
+
+private:
+  struct FRequest
+  {
+    EUESynthCaptureModality Modalities = EUESynthCaptureModality::None;
+    FIntRect Rect;
+    /** What each copy is scaled to, or zero to copy it as is. */
+    FIntPoint OutputSize = FIntPoint::ZeroValue;
+    FOnTextureMapped OnTextureMapped;
+    FOnCaptureComplete OnComplete;
+    /** When the game thread asked for it, for the readback stage's timing. */
+    double RequestSeconds = 0.0;
+    /** The call the capture is for; dropped, and completed as failed, once it is cancelled. */
+    TSharedPtr<FUESynthCancellation> Cancellation;
+  };
+
+  struct FTextureCopy
+  {
+    EUESynthCaptureModality Modality = EUESynthCaptureModality::None;
+    TUniquePtr<FRHIGPUTextureReadback> Readback;
+    FIntPoint Size = FIntPoint::ZeroValue;
+    EPixelFormat Format = PF_Unknown;
+  };
+
+  /** A request whose copies have been enqueued. Render thread only. */
+  struct FInFlight
+  {
+    FRequest Request;
+    TArray<FTextureCopy> Copies;
+  };
+
+  FScreenPassTexture PostTonemap_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View,
+                                              const FPostProcessMaterialInputs& Inputs);
+
+  void EnqueueCopy_RenderThread(FRDGBuilder& GraphBuilder, FInFlight& Capture,
+                                EUESynthCaptureModality Modality, FRDGTexture* Texture,
+                                const FIntRect& Rect);
+
+  /** Render thread: completes captures whose copies are all ready; with bWait, every capture. */
+  void Poll_RenderThread(bool bWait);
+
+  /** Render thread: completes requests that no rendered view picked up. */
+  void FailWaiting_RenderThread();
+
+  void Complete_RenderThread(FRequest&& Request, EUESynthCaptureModality Captured);
+
+  /** Game thread hands requests to the render thread through here. */
+  FCriticalSection WaitingLock;
+  TArray<FRequest> Waiting;
+
+  /** Render thread only. */
+  TArray<FInFlight> InFlight;
+  TArray<TUniquePtr<FRHIGPUTextureReadback>> FreeReadbacks;
+
+  /** Requests made but not completed yet, callbacks included. */
+  std::atomic<int32> NumOutstanding{0};
+
+  static FUESynthFrameCapture* Instance;
+};
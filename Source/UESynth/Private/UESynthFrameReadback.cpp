@@ -0,0 +1,209 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthFrameReadback.h"
+#include "Async/Async.h"
+#include "RHIGPUReadback.h"
+#include "RenderingThread.h"
+#include "UESynthCancellation.h"
+#include "UESynthServerStats.h"
+#include "UnrealClient.h"
+
+FUESynthFrameReadback* FUESynthFrameReadback::Instance = nullptr;
+
+FUESynthFrameReadback::FUESynthFrameReadback() {
+  check(Instance == nullptr);
+  Instance = this;
+
+  for (int32 Index = 0; Index < RingSize; ++Index) {
+    Slots[Index].Readback =
+        MakeUnique<FRHIGPUTextureReadback>(*FString::Printf(TEXT("UESynthReadback%d"), Index));
+  }
+}
+
+FUESynthFrameReadback::~FUESynthFrameReadback() {
+  // Complete whatever is in flight so nobody waiting on a reply is left hanging.
+  Flush();
+
+  // The staging buffers are render resources; let the render thread drop them.
+  for (FSlot& Slot : Slots) {
+    ENQUEUE_RENDER_COMMAND(UESynthReleaseReadback)
+    ([Readback = MoveTemp(Slot.Readback)](FRHICommandListImmediate& RHICmdList) {});
+  }
+  FlushRenderingCommands();
+
+  Instance = nullptr;
+}
+
+FUESynthFrameReadback& FUESynthFrameReadback::Get() {
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+void FUESynthFrameReadback::Request(FRenderTarget* Target, const FIntRect& Rect,
+                                    FOnReadbackMapped&& OnMapped,
+                                    FOnReadbackComplete&& OnComplete) {
+  check(IsInGameThread());
+  Waiting.Add(FWaitingRequest{Target, Rect, MoveTemp(OnMapped), MoveTemp(OnComplete),
+                              FPlatformTime::Seconds(), FUESynthCancellation::GetActive()});
+  IssueWaiting();
+}
+
+void FUESynthFrameReadback::Flush() {
+  check(IsInGameThread());
+
+  // Requests waiting for a slot go out in rounds of at most RingSize.
+  while (Waiting.Num() > 0 || HasSlotsInUse()) {
+    IssueWaiting();
+    ENQUEUE_RENDER_COMMAND(UESynthFlushReadbacks)
+    ([this](FRHICommandListImmediate& RHICmdList) {
+      RHICmdList.BlockUntilGPUIdle();
+      PollSlots_RenderThread(/*bWait=*/true);
+    });
+    FlushRenderingCommands();
+
+    // Every slot in use has been handed off by now; wait for the callbacks themselves.
+    ReleaseCompletedSlots();
+    while (HasSlotsInUse()) {
+      FPlatformProcess::SleepNoStats(0.0f);
+      ReleaseCompletedSlots();
+    }
+  }
+}
+
+void FUESynthFrameReadback::Tick(float DeltaTime) {
+  ReleaseCompletedSlots();
+  IssueWaiting();
+
+  if (HasSlotsInUse()) {
+    ENQUEUE_RENDER_COMMAND(UESynthPollReadbacks)
+    ([this](FRHICommandListImmediate& RHICmdList) { PollSlots_RenderThread(/*bWait=*/false); });
+  }
+}
+
+TStatId FUESynthFrameReadback::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(FUESynthFrameReadback, STATGROUP_Tickables);
+}
+
+void FUESynthFrameReadback::IssueWaiting() {
+  int32 NumIssued = 0;
+  for (FSlot& Slot : Slots) {
+    if (NumIssued == Waiting.Num()) {
+      break;
+    }
+    if (Slot.bInUse) {
+      continue;
+    }
+
+    FWaitingRequest& Next = Waiting[NumIssued++];
+    Slot.bInUse = true;
+    ENQUEUE_RENDER_COMMAND(UESynthEnqueueReadback)
+    ([&Slot, Target = Next.Target, Rect = Next.Rect, RequestSeconds = Next.RequestSeconds,
+      Cancellation = MoveTemp(Next.Cancellation), OnMapped = MoveTemp(Next.OnMapped),
+      OnComplete = MoveTemp(Next.OnComplete)](FRHICommandListImmediate& RHICmdList) mutable {
+      TRACE_CPUPROFILER_EVENT_SCOPE(FUESynthFrameReadback::EnqueueCopy_RenderThread);
+      Slot.OnMapped = MoveTemp(OnMapped);
+      Slot.OnComplete = MoveTemp(OnComplete);
+      Slot.RequestSeconds = RequestSeconds;
+      Slot.Cancellation = MoveTemp(Cancellation);
+      if (FUESynthCancellation::IsCancelled(Slot.Cancellation)) {
+        FUESynthServerStats::Get().OnWorkDropped();
+        Complete_RenderThread(Slot, /*bSuccess=*/false);
+        return;
+      }
+
+      FRHITexture* Texture = Target ? Target->GetRenderTargetTexture().GetReference() : nullptr;
+      FIntRect SourceRect = Rect;
+      if (Texture) {
+        SourceRect.Clip(FIntRect(FIntPoint::ZeroValue, Texture->GetSizeXY()));
+      }
+      if (!Texture || SourceRect.Area() <= 0) {
+        Complete_RenderThread(Slot, /*bSuccess=*/false);
+        return;
+      }
+
+      Slot.Size = SourceRect.Size();
+      Slot.Format = Texture->GetFormat();
+      Slot.bPending = true;
+
+      // The copy lands in the staging buffer whenever the GPU gets to it; nothing waits here.
+      const bool bPresentable = EnumHasAnyFlags(Texture->GetFlags(), TexCreate_Presentable);
+      RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::Unknown, ERHIAccess::CopySrc));
+      Slot.Readback->EnqueueCopy(RHICmdList, Texture,
+                                 FIntVector(SourceRect.Min.X, SourceRect.Min.Y, 0), 0,
+                                 FIntVector(Slot.Size.X, Slot.Size.Y, 1));
+      RHICmdList.Transition(FRHITransitionInfo(
+          Texture, ERHIAccess::CopySrc, bPresentable ? ERHIAccess::Present : ERHIAccess::SRVMask));
+    });
+  }
+  Waiting.RemoveAt(0, NumIssued);
+}
+
+void FUESynthFrameReadback::ReleaseCompletedSlots() {
+  for (FSlot& Slot : Slots) {
+    if (Slot.bInUse && Slot.bCompleted.load()) {
+      Slot.bCompleted = false;
+      Slot.bInUse = false;
+    }
+  }
+}
+
+bool FUESynthFrameReadback::HasSlotsInUse() const {
+  for (const FSlot& Slot : Slots) {
+    if (Slot.bInUse) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void FUESynthFrameReadback::PollSlots_RenderThread(bool bWait) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(FUESynthFrameReadback::PollSlots_RenderThread);
+  FUESynthServerStats& Stats = FUESynthServerStats::Get();
+  for (FSlot& Slot : Slots) {
+    if (!Slot.bPending || (!bWait && !Slot.Readback->IsReady())) {
+      continue;
+    }
+    if (FUESynthCancellation::IsCancelled(Slot.Cancellation)) {
+      Stats.OnWorkDropped();
+      Complete_RenderThread(Slot, /*bSuccess=*/false);
+      continue;
+    }
+    Stats.RecordStage(EUESynthStage::Readback, FPlatformTime::Seconds() - Slot.RequestSeconds);
+
+    bool bSuccess = false;
+    int32 RowPitchInPixels = 0;
+    const uint8* Data = static_cast<const uint8*>(Slot.Readback->Lock(RowPitchInPixels));
+    if (Data) {
+      FUESynthMappedFrame Frame;
+      Frame.Data = Data;
+      Frame.RowPitch =
+          FMath::Max(RowPitchInPixels, Slot.Size.X) * GPixelFormats[Slot.Format].BlockBytes;
+      Frame.Size = Slot.Size;
+      Frame.Format = Slot.Format;
+      FUESynthStageScope ConvertScope(EUESynthStage::PixelConvert);
+      bSuccess = Slot.OnMapped(Frame);
+      Slot.Readback->Unlock();
+    }
+
+    Complete_RenderThread(Slot, bSuccess);
+  }
+}
+
+void FUESynthFrameReadback::Complete_RenderThread(FSlot& Slot, bool bSuccess) {
+  Slot.bPending = false;
+  Slot.OnMapped = nullptr;
+
+  // Whatever the consumer does on completion (replies, encoding) stays off the render thread.
+  // The slot is only released once the callback has returned, so Flush covers the consumer too.
+  AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+            [&Slot, OnComplete = MoveTemp(Slot.OnComplete),
+             Cancellation = MoveTemp(Slot.Cancellation), bSuccess]() mutable {
+              {
+                FUESynthCancellation::FScope CancellationScope(Cancellation);
+                OnComplete(bSuccess);
+              }
+              Slot.bCompleted = true;
+            });
+  Slot.OnComplete = nullptr;
+}
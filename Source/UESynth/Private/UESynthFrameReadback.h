@@ -0,0 +1,130 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+#include "Tickable.h"
+#include <atomic>
+
+class FRenderTarget;
+class FRHIGPUTextureReadback;
+class FUESynthCancellation;
+
+/** A staging buffer mapped for reading. Rows are RowPitch bytes apart and may be padded. */
+struct FUESynthMappedFrame
+{
+  const uint8* Data = nullptr;
+  int32 RowPitch = 0;
+  FIntPoint Size = FIntPoint::ZeroValue;
+  EPixelFormat Format = PF_Unknown;
+
+  bool IsValid() const {
+    return Data != nullptr && Size.X > 0 && Size.Y > 0;
+  }
+};
+
+/**
+ * Asynchronous GPU readback over a small ring of staging buffers.
+ *
+ * FViewport::ReadPixels flushes the rendering commands and stalls the game thread until the GPU
+ * has finished the frame. Here a request instead enqueues a copy into an FRHIGPUTextureReadback on
+ * the render thread, and every tick the render thread polls the in-flight copies. A finished copy
+ * is handed to its consumer while still mapped, so pixels go from the staging buffer to their
+ * final destination in one pass, and completion is reported from a background task. The game
+ * thread keeps ticking while frames are in flight. When every slot is busy, new requests wait on
+ * the game thread for one to free up.
+ */
+class FUESynthFrameReadback final : public FTickableGameObject
+{
+public:
+  /** Render thread, while mapped: copy the pixels out and return whether that worked. */
+  using FOnReadbackMapped = TUniqueFunction<bool(const FUESynthMappedFrame&)>;
+  /** Background thread, once the slot is done with: whether OnMapped succeeded. */
+  using FOnReadbackComplete = TUniqueFunction<void(bool bSuccess)>;
+
+  /** Staging buffers in the ring; more only adds latency once the GPU is the bottleneck. */
+  static constexpr int32 RingSize = 3;
+
+  FUESynthFrameReadback();
+  virtual ~FUESynthFrameReadback() override;
+
+  /** The module-owned readback ring. Only valid while the UESynth module is loaded. */
+  static FUESynthFrameReadback& Get();
+
+  /**
+   * Copies Rect of Target's render target texture back to the CPU. OnMapped is skipped, and
+   * OnComplete gets false, if the copy could not be made. OnMapped holds up the render thread, so
+   * it should do nothing but a single pass over the pixels. Target must stay alive until the
+   * request has been issued. A request of a call that has been cancelled (see
+   * FUESynthCancellation) skips its copy or OnMapped and completes with false. Game thread only.
+   */
+  void Request(FRenderTarget* Target, const FIntRect& Rect, FOnReadbackMapped&& OnMapped,
+               FOnReadbackComplete&& OnComplete);
+
+  /**
+   * Blocks until every request made so far has completed and its callback has returned. Only for
+   * callers on the game thread that have to wait for a result, since nothing else ticks the ring
+   * while they wait.
+   */
+  void Flush();
+
+  //~ Begin FTickableGameObject interface
+  virtual void Tick(float DeltaTime) override;
+  virtual ETickableTickType GetTickableTickType() const override {
+    return ETickableTickType::Always;
+  }
+  virtual bool IsTickableWhenPaused() const override {
+    return true;
+  }
+  virtual bool IsTickableInEditor() const override {
+    return true;
+  }
+  virtual TStatId GetStatId() const override;
+  //~ End FTickableGameObject interface
+
+private:
+  struct FWaitingRequest
+  {
+    FRenderTarget* Target = nullptr;
+    FIntRect Rect;
+    FOnReadbackMapped OnMapped;
+    FOnReadbackComplete OnComplete;
+    /** When the game thread asked for it, for the readback stage's timing. */
+    double RequestSeconds = 0.0;
+    TSharedPtr<FUESynthCancellation> Cancellation;
+  };
+
+  struct FSlot
+  {
+    TUniquePtr<FRHIGPUTextureReadback> Readback;
+
+    /** Game thread: the slot has been handed a request that hasn't been released yet. */
+    bool bInUse = false;
+    /** Set once the request's callback has returned, cleared by the game thread. */
+    std::atomic<bool> bCompleted{false};
+
+    // Render thread only
+    bool bPending = false;
+    FIntPoint Size = FIntPoint::ZeroValue;
+    EPixelFormat Format = PF_Unknown;
+    double RequestSeconds = 0.0;
+    TSharedPtr<FUESynthCancellation> Cancellation;
+    FOnReadbackMapped OnMapped;
+    FOnReadbackComplete OnComplete;
+  };
+
+  void IssueWaiting();
+  void ReleaseCompletedSlots();
+  bool HasSlotsInUse() const;
+
+  /** Render thread: completes ready copies; with bWait, completes every pending copy. */
+  void PollSlots_RenderThread(bool bWait);
+  static void Complete_RenderThread(FSlot& Slot, bool bSuccess);
+
+  FSlot Slots[RingSize];
+  TArray<FWaitingRequest> Waiting;
+
+  static FUESynthFrameReadback* Instance;
+};
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthHealth.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "UESynthCommandQueue.h"
+#include "UESynthFrameCapture.h"
+#include "UESynthLockstep.h"
+#include "UESynthSceneContext.h"
+#include "UESynthServerStats.h"
+#include "UnrealEngine.h"
+
+FUESynthHealth* FUESynthHealth::Instance = nullptr;
+
+FUESynthHealth::FUESynthHealth() {
+  check(Instance == nullptr);
+  Instance = this;
+}
+
+FUESynthHealth::~FUESynthHealth() {
+  Instance = nullptr;
+}
+
+FUESynthHealth& FUESynthHealth::Get() {
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+void FUESynthHealth::SetListenAddress(const FString& Address) {
+  FScopeLock ScopeLock(&Lock);
+  ListenAddress = Address;
+}
+
+void FUESynthHealth::Fill(uesynth::HealthStatus* Out) const {
+  const double Now = FPlatformTime::Seconds();
+  {
+    FScopeLock ScopeLock(&Lock);
+    const double SinceTick = LastTickSeconds > 0.0 ? Now - LastTickSeconds : 0.0;
+    FString Reason;
+    if (LastTickSeconds == 0.0) {
+      Reason = TEXT("The engine has not run a frame yet");
+    } else if (!bHasWorld) {
+      Reason = TEXT("No world is loaded");
+    } else if (!bCanCapture) {
+      Reason = TEXT("The frame capture has not been created yet");
+    } else if (!bLockstep && SinceTick > StallSeconds) {
+      // In lockstep a frame only runs per step, however long the client takes between them
+      Reason = FString::Printf(TEXT("The game thread has not run a frame for %.1f s"), SinceTick);
+    }
+    Out->set_ready(Reason.IsEmpty());
+    Out->set_not_ready_reason(TCHAR_TO_UTF8(*Reason));
+    Out->set_listen_address(TCHAR_TO_UTF8(*ListenAddress));
+    Out->set_world_name(TCHAR_TO_UTF8(*WorldName));
+    Out->set_lockstep(bLockstep);
+    Out->set_fps(Fps);
+    Out->set_frame_number(FrameNumber);
+    Out->set_seconds_since_frame(SinceTick);
+  }
+
+  if (FUESynthCommandQueue::IsAvailable()) {
+    Out->set_command_queue_depth(FUESynthCommandQueue::Get().GetNumPending());
+  }
+  const FUESynthServerStats& Stats = FUESynthServerStats::Get();
+  Out->set_calls_in_flight(Stats.GetCallsInFlight());
+  Out->set_open_streams(Stats.GetOpenStreams());
+}
+
+void FUESynthHealth::Tick(float DeltaTime) {
+  const UWorld* World = FUESynthSceneContext::Get().GetWorld();
+  const bool bInLockstep = FUESynthLockstep::IsAvailable() && FUESynthLockstep::Get().IsEnabled();
+
+  FScopeLock ScopeLock(&Lock);
+  bHasWorld = World != nullptr;
+  WorldName = World ? World->GetMapName() : FString();
+  bCanCapture = FUESynthFrameCapture::Get() != nullptr;
+  bLockstep = bInLockstep;
+  Fps = GAverageFPS;
+  FrameNumber = GFrameCounter;
+  LastTickSeconds = FPlatformTime::Seconds();
+}
+
+TStatId FUESynthHealth::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(FUESynthHealth, STATGROUP_Tickables);
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "pb/uesynth.pb.h"
+
+/**
+ * Whether this instance can take work, for GetHealth.
+ *
+ * A fleet's clients and launchers poll every instance, so the answer must not wait for the game
+ * thread the way a query does. The game thread notes what only it can look at once per frame; the
+ * rest is read when asked, on the calling thread, so an engine that stalls still answers, as not
+ * ready.
+ */
+class FUESynthHealth final : public FTickableGameObject
+{
+public:
+  /** Seconds without a frame after which an instance that isn't in lockstep counts as stalled. */
+  static constexpr double StallSeconds = 5.0;
+
+  FUESynthHealth();
+  virtual ~FUESynthHealth() override;
+
+  FUESynthHealth(const FUESynthHealth&) = delete;
+  FUESynthHealth& operator=(const FUESynthHealth&) = delete;
+
+  /** The module-owned health. Only valid while the UESynth module is loaded. */
+  static FUESynthHealth& Get();
+
+  /** The host:port the server bound, once it has. Any thread. */
+  void SetListenAddress(const FString& Address);
+
+  /** What the last frame saw and the server's gauges now. Any thread. */
+  void Fill(uesynth::HealthStatus* Out) const;
+
+  //~ Begin FTickableGameObject interface
+  virtual void Tick(float DeltaTime) override;
+  virtual ETickableTickType GetTickableTickType() const override {
+    return ETickableTickType::Always;
+  }
+  virtual bool IsTickableWhenPaused() const override {
+    return true;
+  }
+  virtual bool IsTickableInEditor() const override {
+    return true;
+  }
+  virtual TStatId GetStatId() const override;
+  //~ End FTickableGameObject interface
+
+private:
+  mutable FCriticalSection Lock;
+
+  /** Guarded by Lock. */
+  FString ListenAddress;
+  FString WorldName;
+  bool bHasWorld = false;
+  bool bCanCapture = false;
+  bool bLockstep = false;
+  float Fps = 0.0f;
+  uint64 FrameNumber = 0;
+  /** FPlatformTime::Seconds() of the last tick; 0 before the first. */
+  double LastTickSeconds = 0.0;
+
+  static FUESynthHealth* Instance;
+};
@@ -0,0 +1,207 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthImageEncoder.h"
+#include "UESynthCancellation.h"
+#include "UESynthMessageArena.h"
+#include "UESynthServerStats.h"
+#include "Async/Async.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/Compression.h"
+#include "Modules/ModuleManager.h"
+#include <atomic>
+#include <string>
+
+namespace UESynthImageEncoder
+{
+namespace
+{
+
+uesynth::ImageCodec ToWireCodec(EUESynthImageCodec Codec) {
+  switch (Codec) {
+  case EUESynthImageCodec::Jpeg:
+    return uesynth::IMAGE_CODEC_JPEG;
+  case EUESynthImageCodec::Png:
+    return uesynth::IMAGE_CODEC_PNG;
+  case EUESynthImageCodec::Lz4:
+    return uesynth::IMAGE_CODEC_LZ4;
+  case EUESynthImageCodec::Zlib:
+    return uesynth::IMAGE_CODEC_ZLIB;
+  default:
+    return uesynth::IMAGE_CODEC_RAW;
+  }
+}
+
+/** Packs Raw with one of FCompression's formats into Out. */
+bool CompressBuffer(FName Format, const std::string& Raw, std::string* Out) {
+  if (Raw.empty() || Raw.size() > size_t(MAX_int32)) {
+    return false;
+  }
+  const int32 RawSize = int32(Raw.size());
+  int32 CompressedSize = FCompression::CompressMemoryBound(Format, RawSize);
+  Out->resize(size_t(CompressedSize));
+  if (!FCompression::CompressMemory(Format, &(*Out)[0], CompressedSize, Raw.data(), RawSize)) {
+    return false;
+  }
+  Out->resize(size_t(CompressedSize));
+  return true;
+}
+
+/** Encodes Job's 8-bit pixels as a JPEG or PNG file into Out. */
+bool CompressImage(EImageFormat Format, const FUESynthEncodeJob& Job, std::string* Out) {
+  // Loaded on the game thread at startup; looking it up is safe from any thread
+  IImageWrapperModule* Module =
+      FModuleManager::GetModulePtr<IImageWrapperModule>(TEXT("ImageWrapper"));
+  const TSharedPtr<IImageWrapper> Wrapper = Module ? Module->CreateImageWrapper(Format) : nullptr;
+  const uesynth::ImageResponse& Image = *Job.Image;
+  const int32 Width = int32(Image.width());
+  const int32 Height = int32(Image.height());
+  const int64 NumPixels = int64(Width) * Height;
+  if (!Wrapper || NumPixels <= 0 ||
+      int64(Image.image_data().size()) != NumPixels * UESynthPixels::BytesPerPixel(Job.Layout)) {
+    return false;
+  }
+
+  const uint8* Pixels = reinterpret_cast<const uint8*>(Image.image_data().data());
+  ERGBFormat RawFormat = ERGBFormat::Gray;
+  int32 RawChannels = 1;
+  TArray64<uint8> Expanded;
+  switch (Job.Layout) {
+  case UESynthPixels::EFormat::RGBA8:
+    RawFormat = ERGBFormat::RGBA;
+    RawChannels = 4;
+    break;
+  case UESynthPixels::EFormat::RGB8:
+  case UESynthPixels::EFormat::BGR8:
+    // The wrappers only take four channels; the added alpha is opaque
+    RawFormat = Job.Layout == UESynthPixels::EFormat::RGB8 ? ERGBFormat::RGBA : ERGBFormat::BGRA;
+    RawChannels = 4;
+    Expanded.SetNumUninitialized(NumPixels * 4);
+    for (int64 Pixel = 0; Pixel < NumPixels; ++Pixel) {
+      Expanded[Pixel * 4 + 0] = Pixels[Pixel * 3 + 0];
+      Expanded[Pixel * 4 + 1] = Pixels[Pixel * 3 + 1];
+      Expanded[Pixel * 4 + 2] = Pixels[Pixel * 3 + 2];
+      Expanded[Pixel * 4 + 3] = 255;
+    }
+    Pixels = Expanded.GetData();
+    break;
+  default:
+    break;
+  }
+
+  if (!Wrapper->SetRaw(Pixels, NumPixels * RawChannels, Width, Height, RawFormat, 8)) {
+    return false;
+  }
+  const TArray64<uint8> Compressed =
+      Wrapper->GetCompressed(Format == EImageFormat::JPEG ? Job.Quality : 0);
+  if (Compressed.IsEmpty()) {
+    return false;
+  }
+  Out->assign(reinterpret_cast<const char*>(Compressed.GetData()), size_t(Compressed.Num()));
+  return true;
+}
+
+} // namespace
+
+bool FromWireCodec(uesynth::ImageCodec In, EUESynthImageCodec* Out) {
+  switch (In) {
+  case uesynth::IMAGE_CODEC_RAW:
+    *Out = EUESynthImageCodec::Raw;
+    return true;
+  case uesynth::IMAGE_CODEC_JPEG:
+    *Out = EUESynthImageCodec::Jpeg;
+    return true;
+  case uesynth::IMAGE_CODEC_PNG:
+    *Out = EUESynthImageCodec::Png;
+    return true;
+  case uesynth::IMAGE_CODEC_LZ4:
+    *Out = EUESynthImageCodec::Lz4;
+    return true;
+  case uesynth::IMAGE_CODEC_ZLIB:
+    *Out = EUESynthImageCodec::Zlib;
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool Encode(const FUESynthEncodeJob& Job) {
+  if (Job.Codec == EUESynthImageCodec::Raw) {
+    return true;
+  }
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthImageEncoder::Encode);
+  FUESynthStageScope EncodeScope(EUESynthStage::Encode);
+
+  const std::string& Raw = Job.Image->image_data();
+  std::string Encoded;
+  bool bEncoded = false;
+  switch (Job.Codec) {
+  case EUESynthImageCodec::Jpeg:
+    bEncoded = CompressImage(EImageFormat::JPEG, Job, &Encoded);
+    break;
+  case EUESynthImageCodec::Png:
+    bEncoded = CompressImage(EImageFormat::PNG, Job, &Encoded);
+    break;
+  case EUESynthImageCodec::Lz4:
+    bEncoded = CompressBuffer(NAME_LZ4, Raw, &Encoded);
+    break;
+  case EUESynthImageCodec::Zlib:
+    bEncoded = CompressBuffer(NAME_Zlib, Raw, &Encoded);
+    break;
+  default:
+    break;
+  }
+  if (!bEncoded) {
+    return false;
+  }
+
+  Job.Image->set_raw_size(Raw.size());
+  Job.Image->set_codec(ToWireCodec(Job.Codec));
+  Job.Image->mutable_image_data()->swap(Encoded);
+  // The raw frame's buffer serves the next capture of its size
+  UESynthImageBuffers::Release(&Encoded);
+  return true;
+}
+
+void EncodeAsync(TArray<FUESynthEncodeJob>&& Jobs, TUniqueFunction<void(bool bSuccess)>&& OnDone) {
+  Jobs.RemoveAll([](const FUESynthEncodeJob& Job) {
+    return Job.Codec == EUESynthImageCodec::Raw;
+  });
+  if (Jobs.IsEmpty()) {
+    OnDone(true);
+    return;
+  }
+
+  // Shared by the tasks; whichever finishes last reports for all of them
+  struct FBatch
+  {
+    TUniqueFunction<void(bool)> OnDone;
+    TSharedPtr<FUESynthCancellation> Cancellation;
+    std::atomic<int32> Remaining{0};
+    std::atomic<bool> bFailed{false};
+  };
+  TSharedRef<FBatch> Batch = MakeShared<FBatch>();
+  Batch->OnDone = MoveTemp(OnDone);
+  Batch->Cancellation = FUESynthCancellation::GetActive();
+  Batch->Remaining = Jobs.Num();
+
+  for (const FUESynthEncodeJob& Job : Jobs) {
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Batch, Job]() {
+      if (FUESynthCancellation::IsCancelled(Batch->Cancellation)) {
+        FUESynthServerStats::Get().OnWorkDropped();
+        Batch->bFailed = true;
+      } else if (!Encode(Job)) {
+        UE_LOG(LogTemp, Error, TEXT("UESynth: Failed to encode a %dx%d image"),
+               int32(Job.Image->width()), int32(Job.Image->height()));
+        Batch->bFailed = true;
+      }
+      if (--Batch->Remaining == 0) {
+        FUESynthCancellation::FScope CancellationScope(Batch->Cancellation);
+        Batch->OnDone(!Batch->bFailed);
+      }
+    });
+  }
+}
+
+} // namespace UESynthImageEncoder
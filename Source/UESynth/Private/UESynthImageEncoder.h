@@ -0,0 +1,70 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UESynthPixelConvert.h"
+#include "pb/uesynth.pb.h"
+
+/** How an image's bytes go over the wire, mirroring uesynth::ImageCodec. */
+enum class EUESynthImageCodec : uint8
+{
+  Raw,
+  Jpeg,
+  Png,
+  Lz4,
+  Zlib,
+};
+
+/** One image to compress in place. */
+struct FUESynthEncodeJob
+{
+  uesynth::ImageResponse* Image = nullptr;
+  EUESynthImageCodec Codec = EUESynthImageCodec::Raw;
+  /** The pixel layout of Image's raw bytes; only JPEG and PNG look at it. */
+  UESynthPixels::EFormat Layout = UESynthPixels::EFormat::RGBA8;
+  /** JPEG quality in [1, 100]. */
+  int32 Quality = 85;
+};
+
+/**
+ * Compression of captured images, off the game, render and gRPC threads.
+ *
+ * Raw frames from many cameras saturate the network long before the GPU runs out, so a request
+ * can ask for its images compressed once they are read back. Color images can go out as lossy
+ * JPEG or lossless PNG through the engine's ImageWrapper module; any image, depth and segmentation
+ * included, can be packed losslessly as an LZ4 block or a zlib stream of its raw bytes. Every
+ * image is its own background task, so the modalities and cameras of one capture compress in
+ * parallel. The ImageWrapper module has to be loaded on the game thread before JPEG or PNG is
+ * used; the UESynth module does that at startup.
+ */
+namespace UESynthImageEncoder
+{
+
+constexpr int32 DefaultJpegQuality = 85;
+
+/** Whether Codec needs to know the pixel layout, i.e. only works on color images. */
+inline bool IsImageCodec(EUESynthImageCodec Codec) {
+  return Codec == EUESynthImageCodec::Jpeg || Codec == EUESynthImageCodec::Png;
+}
+
+/** Reads a request's codec field; false for values this server doesn't know. */
+bool FromWireCodec(uesynth::ImageCodec In, EUESynthImageCodec* Out);
+
+/**
+ * Replaces Job.Image's raw bytes with their encoding and records the codec and raw size. Runs on
+ * the calling thread. Returns false, leaving the image as it was, if encoding failed.
+ */
+bool Encode(const FUESynthEncodeJob& Job);
+
+/**
+ * Encodes every job on background workers, one task each, then runs OnDone from the last of them
+ * with whether all succeeded. Raw jobs are skipped; with nothing left to encode, OnDone runs
+ * inline. Jobs of a call that is cancelled by the time a worker gets to them (the active
+ * FUESynthCancellation when this is called) are not encoded and count as failed. The images must
+ * stay alive until OnDone.
+ */
+void EncodeAsync(TArray<FUESynthEncodeJob>&& Jobs, TUniqueFunction<void(bool bSuccess)>&& OnDone);
+
+} // namespace UESynthImageEncoder
@@ -0,0 +1,33 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthLightRegistry.h"
+#include "Components/LightComponent.h"
+#include "GameFramework/Actor.h"
+
+ULightComponent* FUESynthLightRegistry::FindLight(AActor* Actor) {
+  check(IsInGameThread());
+  if (!IsValid(Actor)) {
+    return nullptr;
+  }
+
+  TWeakObjectPtr<ULightComponent>& Cached = Lights.FindOrAdd(Actor);
+  ULightComponent* Light = Cached.Get();
+  if (!Light || Light->GetOwner() != Actor) {
+    Light = Actor->FindComponentByClass<ULightComponent>();
+    if (!Light) {
+      Lights.Remove(Actor);
+      return nullptr;
+    }
+    Cached = Light;
+  }
+  return Light;
+}
+
+void FUESynthLightRegistry::RemoveActor(AActor* Actor) {
+  Lights.Remove(Actor);
+}
+
+void FUESynthLightRegistry::Reset() {
+  Lights.Reset();
+}
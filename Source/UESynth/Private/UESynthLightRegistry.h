@@ -0,0 +1,38 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class ULightComponent;
+
+/**
+ * The light component of each actor lighting updates have addressed, per actor.
+ *
+ * Lighting randomization changes tens of lights every frame, and finding an actor's light means
+ * walking its components. The actor registry already finds the actor by name or ID in one probe;
+ * this keeps the light it resolved to, so later updates of the same light skip the component walk.
+ * An actor's light is its first ULightComponent. Game thread only.
+ */
+class FUESynthLightRegistry
+{
+public:
+  /** The light of Actor, resolving and remembering it on first use; null if it has none. */
+  ULightComponent* FindLight(AActor* Actor);
+
+  /** Forgets an actor that was destroyed. */
+  void RemoveActor(AActor* Actor);
+
+  /** Forgets every actor. */
+  void Reset();
+
+  int32 Num() const {
+    return Lights.Num();
+  }
+
+private:
+  TMap<TWeakObjectPtr<AActor>, TWeakObjectPtr<ULightComponent>> Lights;
+};
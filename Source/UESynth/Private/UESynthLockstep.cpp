@@ -0,0 +1,206 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthLockstep.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformApplicationMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "UESynthCommandQueue.h"
+#include "UESynthFrameCapture.h"
+#include "UESynthFrameReadback.h"
+#include "UESynthSubscriptions.h"
+#if WITH_EDITOR
+#include "Editor/EditorPerformanceSettings.h"
+#endif
+
+namespace
+{
+
+/** Frame limits lifted while in lockstep, and the value they are set to. */
+const TCHAR* const UnthrottledConsoleVariables[][2] = {
+    {TEXT("r.VSync"), TEXT("0")},
+    {TEXT("r.VSyncEditor"), TEXT("0")},
+    {TEXT("t.MaxFPS"), TEXT("0")},
+};
+
+} // namespace
+
+FUESynthLockstep* FUESynthLockstep::Instance = nullptr;
+
+FUESynthLockstep::FUESynthLockstep() {
+  check(Instance == nullptr);
+  Instance = this;
+  EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FUESynthLockstep::OnEndFrame);
+}
+
+FUESynthLockstep::~FUESynthLockstep() {
+  FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+  if (bEnabled) {
+    Disable();
+  }
+  Instance = nullptr;
+}
+
+FUESynthLockstep& FUESynthLockstep::Get() {
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+bool FUESynthLockstep::IsAvailable() {
+  return Instance != nullptr;
+}
+
+bool FUESynthLockstep::Configure(const uesynth::SetLockstepRequest& Request,
+                                 const TSharedPtr<FUESynthStreamLink>& InOwner,
+                                 FString* OutError) {
+  const float Delta = Request.fixed_delta_seconds();
+  if (!FMath::IsFinite(Delta) || Delta < 0.0f) {
+    *OutError = TEXT("fixed_delta_seconds must be 0 or more");
+    return false;
+  }
+  if (!Request.enabled()) {
+    if (bEnabled) {
+      Disable();
+    }
+    return true;
+  }
+
+  FixedDeltaSeconds = Delta > 0.0f ? Delta : DefaultFixedDeltaSeconds;
+  IdleTimeoutMs = Request.idle_timeout_ms() > 0 ? Request.idle_timeout_ms() : DefaultIdleTimeoutMs;
+  // Whoever configured it last owns it
+  Owner = InOwner;
+  bOwned = InOwner.IsValid();
+  if (!bEnabled) {
+    Enable();
+  }
+  FApp::SetFixedDeltaTime(FixedDeltaSeconds);
+  return true;
+}
+
+void FUESynthLockstep::GetState(uesynth::LockstepState* Out) const {
+  Out->set_enabled(bEnabled);
+  Out->set_fixed_delta_seconds(FixedDeltaSeconds);
+  Out->set_idle_timeout_ms(IdleTimeoutMs);
+  Out->set_frames_stepped(FramesStepped);
+}
+
+void FUESynthLockstep::Advance(float DeltaSeconds) {
+  check(bEnabled);
+  FApp::SetFixedDeltaTime(DeltaSeconds > 0.0f ? DeltaSeconds : FixedDeltaSeconds);
+  bFramePending = true;
+  FUESynthCommandQueue::Get().YieldFrame();
+}
+
+void FUESynthLockstep::Enable() {
+  Saved = FSavedSettings();
+  Saved.bUseFixedTimeStep = FApp::UseFixedTimeStep();
+  Saved.FixedDeltaTime = FApp::GetFixedDeltaTime();
+  FApp::SetUseFixedTimeStep(true);
+
+  if (GEngine) {
+    Saved.bSmoothFrameRate = GEngine->bSmoothFrameRate;
+    Saved.bUseFixedFrameRate = GEngine->bUseFixedFrameRate;
+    GEngine->bSmoothFrameRate = false;
+    GEngine->bUseFixedFrameRate = false;
+  }
+  for (const auto& Setting : UnthrottledConsoleVariables) {
+    if (IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(Setting[0])) {
+      Saved.ConsoleVariables.Add(Setting[0], Variable->GetString());
+      Variable->Set(Setting[1], ECVF_SetByCode);
+    }
+  }
+#if WITH_EDITOR
+  UEditorPerformanceSettings* EditorSettings = GetMutableDefault<UEditorPerformanceSettings>();
+  Saved.bThrottleCPUWhenNotForeground = EditorSettings->bThrottleCPUWhenNotForeground;
+  EditorSettings->bThrottleCPUWhenNotForeground = false;
+#endif
+
+  FramesStepped = 0;
+  bFramePending = false;
+  bEnabled = true;
+  // Commands now run between frames, once the engine waits for a step
+  FUESynthCommandQueue::Get().SetDrainedExternally(true);
+  UE_LOG(LogTemp, Log, TEXT("UESynth: Lockstep enabled, %.4f s per frame"), FixedDeltaSeconds);
+}
+
+void FUESynthLockstep::Disable() {
+  bEnabled = false;
+  bFramePending = false;
+  Owner.Reset();
+  bOwned = false;
+  FUESynthCommandQueue::Get().SetDrainedExternally(false);
+
+  FApp::SetUseFixedTimeStep(Saved.bUseFixedTimeStep);
+  FApp::SetFixedDeltaTime(Saved.FixedDeltaTime);
+  if (GEngine) {
+    GEngine->bSmoothFrameRate = Saved.bSmoothFrameRate;
+    GEngine->bUseFixedFrameRate = Saved.bUseFixedFrameRate;
+  }
+  for (const TPair<FString, FString>& Setting : Saved.ConsoleVariables) {
+    if (IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(*Setting.Key)) {
+      Variable->Set(*Setting.Value, ECVF_SetByCode);
+    }
+  }
+#if WITH_EDITOR
+  GetMutableDefault<UEditorPerformanceSettings>()->bThrottleCPUWhenNotForeground =
+      Saved.bThrottleCPUWhenNotForeground;
+#endif
+  UE_LOG(LogTemp, Log, TEXT("UESynth: Lockstep disabled after %llu frames"), FramesStepped);
+}
+
+void FUESynthLockstep::OnEndFrame() {
+  if (!bEnabled) {
+    return;
+  }
+
+  // The frame just rendered released whatever was held for it; later drains until the next
+  // step belong to the same frame
+  FUESynthCommandQueue& Queue = FUESynthCommandQueue::Get();
+  const double WaitStarted = FPlatformTime::Seconds();
+  bool bNewFrame = true;
+  while (bEnabled && !bFramePending && !IsEngineExitRequested()) {
+    Queue.Drain(bNewFrame);
+    bNewFrame = false;
+    if (!bEnabled || bFramePending) {
+      break;
+    }
+    if (IsOwnerGone()) {
+      UE_LOG(LogTemp, Log, TEXT("UESynth: The stream that enabled lockstep closed, leaving it"));
+      Disable();
+      break;
+    }
+    if ((FPlatformTime::Seconds() - WaitStarted) * 1000.0 > IdleTimeoutMs) {
+      UE_LOG(LogTemp, Warning, TEXT("UESynth: No step for %u ms, leaving lockstep"),
+             IdleTimeoutMs);
+      Disable();
+      break;
+    }
+    PollCaptures();
+    // Keeps the window responsive to the OS while nothing renders
+    FPlatformApplicationMisc::PumpMessages(/*bFromMainLoop=*/true);
+    Queue.WaitForCommands(PollIntervalMs);
+  }
+
+  if (bFramePending) {
+    bFramePending = false;
+    ++FramesStepped;
+  }
+}
+
+bool FUESynthLockstep::IsOwnerGone() const {
+  if (!bOwned) {
+    return false;
+  }
+  const TSharedPtr<FUESynthStreamLink> Link = Owner.Pin();
+  return !Link.IsValid() || Link->IsDetached();
+}
+
+void FUESynthLockstep::PollCaptures() {
+  FUESynthFrameReadback::Get().Tick(0.0f);
+  if (FUESynthFrameCapture* FrameCapture = FUESynthFrameCapture::Get()) {
+    FrameCapture->Tick(0.0f);
+  }
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "pb/uesynth.pb.h"
+
+class FUESynthStreamLink;
+
+/**
+ * Lockstep simulation: the engine renders a frame only when a client steps it.
+ *
+ * Offline dataset generation has no use for wall-clock time, yet the editor still paces itself by
+ * vsync, t.MaxFPS and background throttling, so captures are capped at the display rate. While
+ * enabled, the engine uses a fixed time step, every frame limit is lifted, and at the end of each
+ * frame the game thread waits for the next StepRequest instead of starting another frame on its
+ * own. Commands keep running while it waits, so a client can set up the scene, step, and read back
+ * the frame the step rendered; the engine then renders exactly as fast as steps arrive and the GPU
+ * allows. Everything it changed is restored when it is disabled, which also happens once the
+ * stream that enabled it closes or no step has come for the idle timeout. Game thread only.
+ */
+class FUESynthLockstep
+{
+public:
+  /** World seconds per frame when the request leaves it at 0. */
+  static constexpr float DefaultFixedDeltaSeconds = 1.0f / 30.0f;
+  /** How long to wait for a step when the request leaves idle_timeout_ms at 0. */
+  static constexpr uint32 DefaultIdleTimeoutMs = 60000;
+  /** How often readbacks in flight are polled while waiting for a step. */
+  static constexpr uint32 PollIntervalMs = 2;
+
+  FUESynthLockstep();
+  ~FUESynthLockstep();
+
+  FUESynthLockstep(const FUESynthLockstep&) = delete;
+  FUESynthLockstep& operator=(const FUESynthLockstep&) = delete;
+
+  /** The module-owned lockstep. Only valid while the UESynth module is loaded. */
+  static FUESynthLockstep& Get();
+  static bool IsAvailable();
+
+  /**
+   * Enables, reconfigures or disables lockstep; on failure OutError says why. Owner is the stream
+   * that asked, if it came over one, and lockstep ends with it.
+   */
+  bool Configure(const uesynth::SetLockstepRequest& Request,
+                 const TSharedPtr<FUESynthStreamLink>& Owner, FString* OutError);
+
+  bool IsEnabled() const {
+    return bEnabled;
+  }
+
+  void GetState(uesynth::LockstepState* Out) const;
+
+  /**
+   * Lets the engine render one more frame, DeltaSeconds long, or the fixed delta for 0. Only
+   * one frame is let through per wait; the command queue yields so later steps see it rendered.
+   */
+  void Advance(float DeltaSeconds);
+
+private:
+  void Enable();
+  void Disable();
+  void OnEndFrame();
+
+  /** Whether lockstep was enabled over a stream that has closed since. */
+  bool IsOwnerGone() const;
+
+  /** Readbacks of earlier steps still land while the engine waits. */
+  static void PollCaptures();
+
+  /** What Enable changed, to put back on Disable. */
+  struct FSavedSettings
+  {
+    bool bUseFixedTimeStep = false;
+    double FixedDeltaTime = 0.0;
+    bool bSmoothFrameRate = false;
+    bool bUseFixedFrameRate = false;
+    TMap<FString, FString> ConsoleVariables;
+    bool bThrottleCPUWhenNotForeground = false;
+  };
+
+  bool bEnabled = false;
+  bool bFramePending = false;
+  float FixedDeltaSeconds = DefaultFixedDeltaSeconds;
+  uint32 IdleTimeoutMs = DefaultIdleTimeoutMs;
+  TWeakPtr<FUESynthStreamLink> Owner;
+  bool bOwned = false;
+  uint64 FramesStepped = 0;
+  FSavedSettings Saved;
+  FDelegateHandle EndFrameHandle;
+
+  static FUESynthLockstep* Instance;
+};
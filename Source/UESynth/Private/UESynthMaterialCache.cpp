@@ -0,0 +1,94 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthMaterialCache.h"
+#include "Components/MeshComponent.h"
+#include "Engine/Texture.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+TArray<FMaterialParameterInfo> FUESynthMaterialCache::Parameters;
+TMap<FName, uint32> FUESynthMaterialCache::ParameterIds;
+
+uint32 FUESynthMaterialCache::ResolveParameter(FName Name) {
+  check(IsInGameThread());
+  if (const uint32* Id = ParameterIds.Find(Name)) {
+    return *Id;
+  }
+  Parameters.Emplace(Name);
+  return ParameterIds.Add(Name, uint32(Parameters.Num()));
+}
+
+const FMaterialParameterInfo* FUESynthMaterialCache::FindParameter(uint32 Id) {
+  check(IsInGameThread());
+  return Id > 0 && Id <= uint32(Parameters.Num()) ? &Parameters[Id - 1] : nullptr;
+}
+
+bool FUESynthMaterialCache::Apply(AActor* Actor, TConstArrayView<FUESynthMaterialValue> Values) {
+  check(IsInGameThread());
+  if (!IsValid(Actor)) {
+    return false;
+  }
+
+  TArray<FSlot>& ActorSlots = Slots.FindOrAdd(Actor);
+  if (ActorSlots.IsEmpty() || !IsCurrent(ActorSlots)) {
+    BuildSlots(Actor, ActorSlots);
+  }
+  if (ActorSlots.IsEmpty()) {
+    Slots.Remove(Actor);
+    return false;
+  }
+
+  for (const FSlot& Slot : ActorSlots) {
+    UMaterialInstanceDynamic* Instance = Slot.Instance.Get();
+    for (const FUESynthMaterialValue& Value : Values) {
+      switch (Value.Type) {
+      case FUESynthMaterialValue::EType::Scalar:
+        Instance->SetScalarParameterValueByInfo(Value.Parameter, Value.Scalar);
+        break;
+      case FUESynthMaterialValue::EType::Vector:
+        Instance->SetVectorParameterValueByInfo(Value.Parameter, Value.Vector);
+        break;
+      case FUESynthMaterialValue::EType::Texture:
+        Instance->SetTextureParameterValueByInfo(Value.Parameter, Value.Texture);
+        break;
+      }
+    }
+  }
+  return true;
+}
+
+void FUESynthMaterialCache::RemoveActor(AActor* Actor) {
+  Slots.Remove(Actor);
+}
+
+void FUESynthMaterialCache::Reset() {
+  Slots.Reset();
+}
+
+bool FUESynthMaterialCache::IsCurrent(const TArray<FSlot>& ActorSlots) {
+  for (const FSlot& Slot : ActorSlots) {
+    const UMeshComponent* Mesh = Slot.Mesh.Get();
+    const UMaterialInstanceDynamic* Instance = Slot.Instance.Get();
+    if (!Mesh || !Instance || Mesh->GetMaterial(Slot.Index) != Instance) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void FUESynthMaterialCache::BuildSlots(AActor* Actor, TArray<FSlot>& OutSlots) {
+  OutSlots.Reset();
+  TInlineComponentArray<UMeshComponent*> Meshes(Actor);
+  for (UMeshComponent* Mesh : Meshes) {
+    for (int32 Index = 0; Index < Mesh->GetNumMaterials(); ++Index) {
+      // Keeps a slot's MID if it has one already, else parents a new one to its material
+      if (!Mesh->GetMaterial(Index)) {
+        continue;
+      }
+      if (UMaterialInstanceDynamic* Instance = Mesh->CreateDynamicMaterialInstance(Index)) {
+        OutSlots.Add({Mesh, Index, Instance});
+      }
+    }
+  }
+}
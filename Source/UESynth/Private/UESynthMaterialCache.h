@@ -0,0 +1,82 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MaterialTypes.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UMaterialInstanceDynamic;
+class UMeshComponent;
+class UTexture;
+
+/** One material parameter write, resolved from its wire form. */
+struct FUESynthMaterialValue
+{
+  enum class EType : uint8
+  {
+    Scalar,
+    Vector,
+    Texture
+  };
+
+  FMaterialParameterInfo Parameter;
+  EType Type = EType::Scalar;
+  float Scalar = 0.0f;
+  FLinearColor Vector = FLinearColor::Black;
+  UTexture* Texture = nullptr;
+};
+
+/**
+ * The dynamic material instances material updates write into, per actor.
+ *
+ * Randomizing colors and textures over thousands of objects per frame can't afford to walk each
+ * actor's components and create a UMaterialInstanceDynamic on every call. The first update of an
+ * actor turns every material slot of its mesh components into a MID, once, and the cache keeps
+ * those slots; later updates only write parameters. A slot whose material was swapped since, for
+ * instance by a pooled spawn restoring the asset's materials, is rebuilt on its next update.
+ *
+ * Parameter names are interned server-wide into IDs clients can send instead of the name, so a
+ * hot update loop never converts strings. Game thread only.
+ */
+class FUESynthMaterialCache
+{
+public:
+  /** The ID of a parameter name, interning it on first use; IDs start at 1. */
+  static uint32 ResolveParameter(FName Name);
+
+  /** The parameter an ID stands for, or null for an ID never handed out. */
+  static const FMaterialParameterInfo* FindParameter(uint32 Id);
+
+  /** Writes Values into every material slot of Actor's meshes. False if it has none. */
+  bool Apply(AActor* Actor, TConstArrayView<FUESynthMaterialValue> Values);
+
+  /** Forgets an actor that was destroyed. */
+  void RemoveActor(AActor* Actor);
+
+  /** Forgets every actor; their MIDs stay on their meshes. */
+  void Reset();
+
+  int32 Num() const {
+    return Slots.Num();
+  }
+
+private:
+  struct FSlot
+  {
+    TWeakObjectPtr<UMeshComponent> Mesh;
+    int32 Index = 0;
+    TWeakObjectPtr<UMaterialInstanceDynamic> Instance;
+  };
+
+  /** Whether every slot still holds the MID it was given. */
+  static bool IsCurrent(const TArray<FSlot>& ActorSlots);
+  static void BuildSlots(AActor* Actor, TArray<FSlot>& OutSlots);
+
+  TMap<TWeakObjectPtr<AActor>, TArray<FSlot>> Slots;
+
+  static TArray<FMaterialParameterInfo> Parameters;
+  static TMap<FName, uint32> ParameterIds;
+};
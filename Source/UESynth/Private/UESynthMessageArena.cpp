@@ -0,0 +1,178 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthMessageArena.h"
+#include "Misc/ScopeLock.h"
+
+struct FUESynthMessageArena::FPooled
+{
+  alignas(16) char Block[InitialBlockSize];
+  google::protobuf::Arena Arena;
+
+  FPooled() : Arena(MakeOptions(Block)) {}
+
+  static google::protobuf::ArenaOptions MakeOptions(char* InBlock) {
+    google::protobuf::ArenaOptions Options;
+    Options.initial_block = InBlock;
+    Options.initial_block_size = InitialBlockSize;
+    return Options;
+  }
+};
+
+namespace
+{
+
+/** Idle arenas, shared by every stream; taken on reading threads, returned on writing ones. */
+struct FArenaPool
+{
+  FCriticalSection Lock;
+  TArray<FUESynthMessageArena::FPooled*> Idle;
+
+  ~FArenaPool() {
+    for (FUESynthMessageArena::FPooled* Pooled : Idle) {
+      delete Pooled;
+    }
+  }
+};
+
+FArenaPool& GetArenaPool() {
+  static FArenaPool Pool;
+  return Pool;
+}
+
+/** Released payloads by size, and their total. */
+struct FBufferPool
+{
+  FCriticalSection Lock;
+  TMap<uint64, TArray<std::string>> BySize;
+  uint64 Bytes = 0;
+};
+
+FBufferPool& GetBufferPool() {
+  static FBufferPool Pool;
+  return Pool;
+}
+
+void ReclaimImages(uesynth::MultiImageResponse* Images) {
+  if (Images->has_rgb()) {
+    UESynthImageBuffers::Release(Images->mutable_rgb()->mutable_image_data());
+  }
+  if (Images->has_depth()) {
+    UESynthImageBuffers::Release(Images->mutable_depth()->mutable_image_data());
+  }
+  if (Images->has_segmentation()) {
+    UESynthImageBuffers::Release(Images->mutable_segmentation()->mutable_image_data());
+  }
+  if (Images->has_normals()) {
+    UESynthImageBuffers::Release(Images->mutable_normals()->mutable_image_data());
+  }
+  if (Images->has_optical_flow()) {
+    UESynthImageBuffers::Release(Images->mutable_optical_flow()->mutable_image_data());
+  }
+}
+
+} // namespace
+
+FUESynthMessageArena FUESynthMessageArena::Acquire() {
+  FArenaPool& Pool = GetArenaPool();
+  {
+    FScopeLock Lock(&Pool.Lock);
+    if (!Pool.Idle.IsEmpty()) {
+      return FUESynthMessageArena(Pool.Idle.Pop(/*bAllowShrinking=*/false));
+    }
+  }
+  return FUESynthMessageArena(new FPooled());
+}
+
+FUESynthMessageArena& FUESynthMessageArena::operator=(FUESynthMessageArena&& Other) {
+  if (this != &Other) {
+    Release();
+    Pooled = Other.Pooled;
+    Other.Pooled = nullptr;
+  }
+  return *this;
+}
+
+google::protobuf::Arena* FUESynthMessageArena::Get() const {
+  check(Pooled);
+  return &Pooled->Arena;
+}
+
+void FUESynthMessageArena::Release() {
+  FPooled* Released = Pooled;
+  Pooled = nullptr;
+  if (!Released) {
+    return;
+  }
+  // Outside the lock: destroying what was on the arena can take a while
+  Released->Arena.Reset();
+  FArenaPool& Pool = GetArenaPool();
+  {
+    FScopeLock Lock(&Pool.Lock);
+    if (Pool.Idle.Num() < MaxPooled) {
+      Pool.Idle.Add(Released);
+      return;
+    }
+  }
+  delete Released;
+}
+
+namespace UESynthImageBuffers
+{
+
+void Acquire(size_t Size, std::string* Out) {
+  if (Out->size() == Size) {
+    return;
+  }
+  FBufferPool& Pool = GetBufferPool();
+  {
+    FScopeLock Lock(&Pool.Lock);
+    TArray<std::string>* Buffers = Pool.BySize.Find(uint64(Size));
+    if (Buffers && !Buffers->IsEmpty()) {
+      Out->swap(Buffers->Last());
+      Buffers->Pop(/*bAllowShrinking=*/false);
+      Pool.Bytes -= Size;
+      return;
+    }
+  }
+  Out->resize(Size);
+}
+
+void Release(std::string* Buffer) {
+  const size_t Size = Buffer->size();
+  if (Size == 0) {
+    return;
+  }
+  FBufferPool& Pool = GetBufferPool();
+  {
+    FScopeLock Lock(&Pool.Lock);
+    TArray<std::string>& Buffers = Pool.BySize.FindOrAdd(uint64(Size));
+    if (Buffers.Num() < MaxPerSize && Pool.Bytes + Size <= MaxPooledBytes) {
+      Buffers.AddDefaulted_GetRef().swap(*Buffer);
+      Pool.Bytes += Size;
+      return;
+    }
+  }
+  std::string().swap(*Buffer);
+}
+
+void Reclaim(uesynth::FrameResponse* Response) {
+  switch (Response->response_case()) {
+  case uesynth::FrameResponse::kImageResponse:
+    Release(Response->mutable_image_response()->mutable_image_data());
+    return;
+  case uesynth::FrameResponse::kMultiImageResponse:
+    ReclaimImages(Response->mutable_multi_image_response());
+    return;
+  case uesynth::FrameResponse::kSubscriptionFrame:
+    ReclaimImages(Response->mutable_subscription_frame()->mutable_images());
+    return;
+  case uesynth::FrameResponse::kStepResponse:
+    ReclaimImages(Response->mutable_step_response()->mutable_images());
+    return;
+  default:
+    return;
+  }
+}
+
+} // namespace UESynthImageBuffers
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "pb/uesynth.pb.h"
+#include <google/protobuf/arena.h>
+#include <string>
+
+/**
+ * A pooled protobuf arena holding the messages of one in-flight ControlStream action.
+ *
+ * A transform action used to cost a dozen small heap allocations: the request's sub-messages as
+ * it was parsed, the response, its sub-response and their strings, all freed again once written.
+ * Each action now parses its request into an arena and builds its response on the same one. Once
+ * the response is written the handle goes away, the arena is reset and it returns to a shared
+ * pool with its first block kept, so a warmed-up stream of small actions allocates nothing per
+ * action. Handles are move-only and may be released on any thread.
+ *
+ * Messages on an arena must not be moved or swapped into heap messages, or the other way round:
+ * protobuf copies them then. Image payloads are not arena memory either; their bytes stay in the
+ * std::string's own buffer, recycled through UESynthImageBuffers.
+ */
+class FUESynthMessageArena
+{
+public:
+  /** Bytes every arena keeps across resets. */
+  static constexpr int32 InitialBlockSize = 16 << 10;
+  /** Idle arenas the pool holds on to; more are freed. */
+  static constexpr int32 MaxPooled = 64;
+
+  /** A handle without an arena. */
+  FUESynthMessageArena() = default;
+
+  /** An arena with its first block; defined with the pool. */
+  struct FPooled;
+
+  /** Takes an arena from the pool, or makes one. */
+  static FUESynthMessageArena Acquire();
+
+  FUESynthMessageArena(FUESynthMessageArena&& Other) : Pooled(Other.Pooled) {
+    Other.Pooled = nullptr;
+  }
+  FUESynthMessageArena& operator=(FUESynthMessageArena&& Other);
+
+  /** Destroys every message on the arena and gives the arena back. */
+  ~FUESynthMessageArena() { Release(); }
+
+  bool IsValid() const { return Pooled != nullptr; }
+  google::protobuf::Arena* Get() const;
+
+  /** A new message owned by the arena, valid until the handle goes away. */
+  template <typename MessageType>
+  MessageType* Create() const {
+    return google::protobuf::Arena::CreateMessage<MessageType>(Get());
+  }
+
+private:
+  explicit FUESynthMessageArena(FPooled* InPooled) : Pooled(InPooled) {}
+  void Release();
+
+  FPooled* Pooled = nullptr;
+};
+
+/**
+ * Reuse of image payload buffers across frames of the same size.
+ *
+ * A 4K RGBA frame is a 33 MB std::string; allocated fresh for every capture it is mapped, faulted
+ * in page by page and unmapped again once written. Captures take their buffer from here instead,
+ * and the stream's writer hands every payload back once the response has been serialized, so a
+ * camera streaming at a fixed resolution keeps cycling through the same few buffers. The pool is
+ * bounded in buffers per size and in total bytes; past that, buffers are simply freed.
+ */
+namespace UESynthImageBuffers
+{
+
+constexpr int32 MaxPerSize = 4;
+constexpr uint64 MaxPooledBytes = 512ull << 20;
+
+/** Resizes Out to Size bytes, swapping in a released buffer of that size if there is one. */
+void Acquire(size_t Size, std::string* Out);
+
+/** Keeps Buffer's memory for the next image of its size and leaves Buffer empty. */
+void Release(std::string* Buffer);
+
+/** Releases the payload of every image in Response, e.g. once it has been written. */
+void Reclaim(uesynth::FrameResponse* Response);
+
+} // namespace UESynthImageBuffers
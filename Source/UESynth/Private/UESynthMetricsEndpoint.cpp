@@ -0,0 +1,43 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthMetricsEndpoint.h"
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerResponse.h"
+#include "UESynthServerStats.h"
+
+FUESynthMetricsEndpoint::FUESynthMetricsEndpoint(int32 InPort) : Port(InPort) {}
+
+FUESynthMetricsEndpoint::~FUESynthMetricsEndpoint() {
+  // The listener is shared with other users of the port, so only the route goes.
+  if (Router && Route) {
+    Router->UnbindRoute(Route);
+  }
+}
+
+bool FUESynthMetricsEndpoint::Start() {
+  FHttpServerModule& HttpServer = FHttpServerModule::Get();
+  Router = HttpServer.GetHttpRouter(Port, /*bFailOnBindFailure=*/true);
+  if (!Router) {
+    return false;
+  }
+
+  Route = Router->BindRoute(
+      FHttpPath(TEXT("/metrics")), EHttpServerRequestVerbs::VERB_GET,
+      FHttpRequestHandler::CreateLambda(
+          [](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) {
+            uesynth::ServerStats Stats;
+            FUESynthServerStats::Get().Fill(&Stats);
+            const std::string Text = FUESynthServerStats::ToPrometheusText(Stats);
+            OnComplete(FHttpServerResponse::Create(UTF8_TO_TCHAR(Text.c_str()),
+                                                   TEXT("text/plain; version=0.0.4")));
+            return true;
+          }));
+  if (!Route) {
+    return false;
+  }
+
+  HttpServer.StartAllListeners();
+  return true;
+}
@@ -0,0 +1,27 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IHttpRouter.h"
+
+/**
+ * Serves the server stats at http://<host>:<MetricsPort>/metrics in the Prometheus text format,
+ * for scrapers that don't speak gRPC. Requests are answered on the game thread by the engine's
+ * HTTP server; GetServerStats keeps answering when the game thread is stuck.
+ */
+class FUESynthMetricsEndpoint
+{
+public:
+  explicit FUESynthMetricsEndpoint(int32 InPort);
+  ~FUESynthMetricsEndpoint();
+
+  /** Binds the route and starts listening; false if the port can't be bound. */
+  bool Start();
+
+private:
+  const int32 Port;
+  TSharedPtr<IHttpRouter> Router;
+  FHttpRouteHandle Route;
+};
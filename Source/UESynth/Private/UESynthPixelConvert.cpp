@@ -0,0 +1,346 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthPixelConvert.h"
+
+// One kernel family per build; AVX2 builds also get the SSSE3 kernels for the shorter tails.
+#if defined(PLATFORM_ALWAYS_HAS_AVX_2) && PLATFORM_ALWAYS_HAS_AVX_2
+#define UESYNTH_PIXELS_AVX2 1
+#define UESYNTH_PIXELS_SSSE3 1
+#include <immintrin.h>
+#elif defined(PLATFORM_ALWAYS_HAS_SSE4_1) && PLATFORM_ALWAYS_HAS_SSE4_1
+#define UESYNTH_PIXELS_SSSE3 1
+#include <tmmintrin.h>
+#elif defined(PLATFORM_ENABLE_VECTORINTRINSICS_NEON) && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#define UESYNTH_PIXELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace UESynthPixels
+{
+namespace
+{
+
+enum EChannel : uint8
+{
+  R,
+  G,
+  B,
+  A
+};
+
+/** Luma weights in 7-bit fixed point; they sum to 128 so opaque white stays 255. */
+constexpr uint8 LumaR = 38;
+constexpr uint8 LumaG = 75;
+constexpr uint8 LumaB = 15;
+
+inline uint8 Luma(uint8 Red, uint8 Green, uint8 Blue) {
+  return uint8((LumaR * Red + LumaG * Green + LumaB * Blue + 64) >> 7);
+}
+
+/** Byte offset of each channel within a source pixel, indexed by EChannel. */
+void GetSourceOffsets(EPixelFormat Source, uint8 (&Offsets)[4]) {
+  if (Source == PF_B8G8R8A8) {
+    Offsets[R] = 2, Offsets[G] = 1, Offsets[B] = 0, Offsets[A] = 3;
+  } else {
+    Offsets[R] = 0, Offsets[G] = 1, Offsets[B] = 2, Offsets[A] = 3;
+  }
+}
+
+/** Channels written per output pixel, in order; unused for gray. */
+int32 GetDestChannels(EFormat Dest, uint8 (&Channels)[4]) {
+  switch (Dest) {
+  case EFormat::RGBA8:
+    Channels[0] = R, Channels[1] = G, Channels[2] = B, Channels[3] = A;
+    return 4;
+  case EFormat::RGB8:
+    Channels[0] = R, Channels[1] = G, Channels[2] = B;
+    return 3;
+  case EFormat::BGR8:
+    Channels[0] = B, Channels[1] = G, Channels[2] = R;
+    return 3;
+  default:
+    return 0;
+  }
+}
+
+#if UESYNTH_PIXELS_AVX2 || UESYNTH_PIXELS_SSSE3 || UESYNTH_PIXELS_NEON
+/** Everything the SIMD kernels need for one Source/Dest pair, worked out once per row. */
+struct FKernel
+{
+  bool bGray = false;
+  int32 OutBytes = 4;
+  /** Source byte for each output channel. */
+  uint8 Picks[4] = {};
+  /** pshufb mask for four pixels; lanes past the output are zeroed (0x80). */
+  alignas(16) uint8 Shuffle[16] = {};
+  /** pmaddubsw weights for four pixels, laid out in source byte order. */
+  alignas(16) int8 Weights[16] = {};
+};
+
+FKernel MakeKernel(EPixelFormat Source, EFormat Dest) {
+  uint8 Offsets[4];
+  GetSourceOffsets(Source, Offsets);
+
+  FKernel Kernel;
+  Kernel.bGray = Dest == EFormat::Gray8;
+  Kernel.OutBytes = BytesPerPixel(Dest);
+
+  uint8 Channels[4];
+  const int32 NumChannels = GetDestChannels(Dest, Channels);
+  for (int32 Channel = 0; Channel < NumChannels; ++Channel) {
+    Kernel.Picks[Channel] = Offsets[Channels[Channel]];
+  }
+
+  FMemory::Memset(Kernel.Shuffle, 0x80, sizeof(Kernel.Shuffle));
+  for (int32 Pixel = 0; Pixel < 4; ++Pixel) {
+    for (int32 Channel = 0; Channel < NumChannels; ++Channel) {
+      Kernel.Shuffle[Pixel * NumChannels + Channel] = uint8(Pixel * 4 + Kernel.Picks[Channel]);
+    }
+    Kernel.Weights[Pixel * 4 + Offsets[R]] = LumaR;
+    Kernel.Weights[Pixel * 4 + Offsets[G]] = LumaG;
+    Kernel.Weights[Pixel * 4 + Offsets[B]] = LumaB;
+    Kernel.Weights[Pixel * 4 + Offsets[A]] = 0;
+  }
+  return Kernel;
+}
+#endif
+
+#if UESYNTH_PIXELS_AVX2
+int32 ConvertAVX2(const FKernel& Kernel, const uint8* Src, uint8* Dst, int32 X, int32 Width) {
+  if (Kernel.bGray) {
+    const __m256i Weights = _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(Kernel.Weights)));
+    const __m256i Round = _mm256_set1_epi16(64);
+    // hadd and packus work per 128-bit lane, which leaves the 4-pixel groups interleaved
+    const __m256i Order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (; X + 32 <= Width; X += 32) {
+      const __m256i* In = reinterpret_cast<const __m256i*>(Src + X * 4);
+      const __m256i Sum0 =
+          _mm256_hadd_epi16(_mm256_maddubs_epi16(_mm256_loadu_si256(In), Weights),
+                            _mm256_maddubs_epi16(_mm256_loadu_si256(In + 1), Weights));
+      const __m256i Sum1 =
+          _mm256_hadd_epi16(_mm256_maddubs_epi16(_mm256_loadu_si256(In + 2), Weights),
+                            _mm256_maddubs_epi16(_mm256_loadu_si256(In + 3), Weights));
+      const __m256i Luma0 = _mm256_srli_epi16(_mm256_add_epi16(Sum0, Round), 7);
+      const __m256i Luma1 = _mm256_srli_epi16(_mm256_add_epi16(Sum1, Round), 7);
+      const __m256i Packed =
+          _mm256_permutevar8x32_epi32(_mm256_packus_epi16(Luma0, Luma1), Order);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + X), Packed);
+    }
+    return X;
+  }
+
+  const __m256i Shuffle = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(Kernel.Shuffle)));
+  if (Kernel.OutBytes == 4) {
+    for (; X + 8 <= Width; X += 8) {
+      const __m256i In = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Src + X * 4));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + X * 4),
+                          _mm256_shuffle_epi8(In, Shuffle));
+    }
+    return X;
+  }
+
+  // Each lane packs 12 bytes at its bottom; pull them together, then store 32 bytes and keep 24.
+  // The 8 spare bytes land where the next block writes, so stop while they still fit in the row.
+  const __m256i Compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+  for (; X + 11 <= Width; X += 8) {
+    const __m256i In = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Src + X * 4));
+    const __m256i Out = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(In, Shuffle), Compact);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + X * 3), Out);
+  }
+  return X;
+}
+#endif
+
+#if UESYNTH_PIXELS_SSSE3
+int32 ConvertSSSE3(const FKernel& Kernel, const uint8* Src, uint8* Dst, int32 X, int32 Width) {
+  if (Kernel.bGray) {
+    const __m128i Weights = _mm_load_si128(reinterpret_cast<const __m128i*>(Kernel.Weights));
+    const __m128i Round = _mm_set1_epi16(64);
+    for (; X + 16 <= Width; X += 16) {
+      const __m128i* In = reinterpret_cast<const __m128i*>(Src + X * 4);
+      const __m128i Sum0 = _mm_hadd_epi16(_mm_maddubs_epi16(_mm_loadu_si128(In), Weights),
+                                          _mm_maddubs_epi16(_mm_loadu_si128(In + 1), Weights));
+      const __m128i Sum1 = _mm_hadd_epi16(_mm_maddubs_epi16(_mm_loadu_si128(In + 2), Weights),
+                                          _mm_maddubs_epi16(_mm_loadu_si128(In + 3), Weights));
+      const __m128i Luma0 = _mm_srli_epi16(_mm_add_epi16(Sum0, Round), 7);
+      const __m128i Luma1 = _mm_srli_epi16(_mm_add_epi16(Sum1, Round), 7);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + X), _mm_packus_epi16(Luma0, Luma1));
+    }
+    return X;
+  }
+
+  const __m128i Shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(Kernel.Shuffle));
+  if (Kernel.OutBytes == 4) {
+    for (; X + 4 <= Width; X += 4) {
+      const __m128i In = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + X * 4));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + X * 4), _mm_shuffle_epi8(In, Shuffle));
+    }
+    return X;
+  }
+
+  // Stores 16 bytes and keeps 12, so stop while the 4 spare bytes still fit in the row.
+  for (; X + 6 <= Width; X += 4) {
+    const __m128i In = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + X * 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + X * 3), _mm_shuffle_epi8(In, Shuffle));
+  }
+  return X;
+}
+#endif
+
+#if UESYNTH_PIXELS_NEON
+int32 ConvertNEON(const FKernel& Kernel, const uint8* Src, uint8* Dst, int32 X, int32 Width,
+                  const uint8 (&Offsets)[4]) {
+  for (; X + 16 <= Width; X += 16) {
+    // vld4 splits sixteen pixels into one register per source byte
+    const uint8x16x4_t In = vld4q_u8(Src + X * 4);
+
+    if (Kernel.bGray) {
+      const uint8x16_t Red = In.val[Offsets[R]];
+      const uint8x16_t Green = In.val[Offsets[G]];
+      const uint8x16_t Blue = In.val[Offsets[B]];
+      uint16x8_t Low = vmull_u8(vget_low_u8(Red), vdup_n_u8(LumaR));
+      Low = vmlal_u8(Low, vget_low_u8(Green), vdup_n_u8(LumaG));
+      Low = vmlal_u8(Low, vget_low_u8(Blue), vdup_n_u8(LumaB));
+      uint16x8_t High = vmull_u8(vget_high_u8(Red), vdup_n_u8(LumaR));
+      High = vmlal_u8(High, vget_high_u8(Green), vdup_n_u8(LumaG));
+      High = vmlal_u8(High, vget_high_u8(Blue), vdup_n_u8(LumaB));
+      // vrshrn rounds, i.e. (Sum + 64) >> 7, same as the scalar path
+      vst1q_u8(Dst + X, vcombine_u8(vrshrn_n_u16(Low, 7), vrshrn_n_u16(High, 7)));
+    } else if (Kernel.OutBytes == 4) {
+      uint8x16x4_t Out;
+      for (int32 Channel = 0; Channel < 4; ++Channel) {
+        Out.val[Channel] = In.val[Kernel.Picks[Channel]];
+      }
+      vst4q_u8(Dst + X * 4, Out);
+    } else {
+      uint8x16x3_t Out;
+      for (int32 Channel = 0; Channel < 3; ++Channel) {
+        Out.val[Channel] = In.val[Kernel.Picks[Channel]];
+      }
+      vst3q_u8(Dst + X * 3, Out);
+    }
+  }
+  return X;
+}
+#endif
+
+/** Reads one source pixel as R, G, B, A. */
+inline void DecodePixel(EPixelFormat Source, const uint8 (&Offsets)[4], const uint8* In,
+                        uint8 (&Out)[4]) {
+  if (Source == PF_A2B10G10R10) {
+    // 10-bit channels keep their top 8 bits; 2-bit alpha is stretched to 8
+    uint32 Packed;
+    FMemory::Memcpy(&Packed, In, 4);
+    Out[R] = uint8((Packed >> 2) & 0xFF);
+    Out[G] = uint8((Packed >> 12) & 0xFF);
+    Out[B] = uint8((Packed >> 22) & 0xFF);
+    Out[A] = uint8((Packed >> 30) * 85);
+    return;
+  }
+  Out[R] = In[Offsets[R]];
+  Out[G] = In[Offsets[G]];
+  Out[B] = In[Offsets[B]];
+  Out[A] = In[Offsets[A]];
+}
+
+void ConvertScalarFrom(EPixelFormat Source, EFormat Dest, const uint8* Src, uint8* Dst, int32 X,
+                       int32 Width) {
+  uint8 Offsets[4];
+  GetSourceOffsets(Source, Offsets);
+  uint8 Channels[4];
+  const int32 NumChannels = GetDestChannels(Dest, Channels);
+
+  for (; X < Width; ++X) {
+    uint8 Pixel[4];
+    DecodePixel(Source, Offsets, Src + X * 4, Pixel);
+    if (Dest == EFormat::Gray8) {
+      Dst[X] = Luma(Pixel[R], Pixel[G], Pixel[B]);
+      continue;
+    }
+    uint8* Out = Dst + X * NumChannels;
+    for (int32 Channel = 0; Channel < NumChannels; ++Channel) {
+      Out[Channel] = Pixel[Channels[Channel]];
+    }
+  }
+}
+
+} // namespace
+
+bool IsSupportedSource(EPixelFormat Source) {
+  return Source == PF_B8G8R8A8 || Source == PF_R8G8B8A8 || Source == PF_A2B10G10R10;
+}
+
+void ConvertRow(EPixelFormat Source, EFormat Dest, const uint8* Src, uint8* Dst, int32 Width) {
+  checkSlow(IsSupportedSource(Source));
+  int32 X = 0;
+
+#if UESYNTH_PIXELS_AVX2 || UESYNTH_PIXELS_SSSE3 || UESYNTH_PIXELS_NEON
+  if (Source != PF_A2B10G10R10) {
+    const FKernel Kernel = MakeKernel(Source, Dest);
+#if UESYNTH_PIXELS_AVX2
+    X = ConvertAVX2(Kernel, Src, Dst, X, Width);
+#endif
+#if UESYNTH_PIXELS_SSSE3
+    X = ConvertSSSE3(Kernel, Src, Dst, X, Width);
+#endif
+#if UESYNTH_PIXELS_NEON
+    uint8 Offsets[4];
+    GetSourceOffsets(Source, Offsets);
+    X = ConvertNEON(Kernel, Src, Dst, X, Width, Offsets);
+#endif
+  }
+#endif
+
+  ConvertScalarFrom(Source, Dest, Src, Dst, X, Width);
+}
+
+void ConvertRowScalar(EPixelFormat Source, EFormat Dest, const uint8* Src, uint8* Dst,
+                      int32 Width) {
+  checkSlow(IsSupportedSource(Source));
+  ConvertScalarFrom(Source, Dest, Src, Dst, 0, Width);
+}
+
+FString DepthFormatName(EDepthEncoding Encoding, float Near, float Far) {
+  switch (Encoding) {
+  case EDepthEncoding::Float32:
+    return TEXT("depth_f32");
+  case EDepthEncoding::Float16:
+    return TEXT("depth_f16");
+  default:
+    return FString::Printf(TEXT("depth_u16:near=%g,far=%g"), Near, Far);
+  }
+}
+
+void ConvertDepthRow(EDepthEncoding Encoding, const float* Src, uint8* Dst, int32 Width,
+                     float Near, float Far) {
+  switch (Encoding) {
+  case EDepthEncoding::Float32:
+    FMemory::Memcpy(Dst, Src, Width * sizeof(float));
+    return;
+
+  case EDepthEncoding::Float16:
+    // Half precision tops out at 65504 cm; farther depth (the sky) doesn't round-trip
+    for (int32 X = 0; X < Width; ++X) {
+      uint16 Half;
+      FPlatformMath::StoreHalf(&Half, Src[X]);
+      FMemory::Memcpy(Dst + X * 2, &Half, 2);
+    }
+    return;
+
+  case EDepthEncoding::UInt16: {
+    // Plain arithmetic, so the compiler is free to vectorize it
+    const float Scale = 65535.0f / (Far - Near);
+    for (int32 X = 0; X < Width; ++X) {
+      const float Scaled = FMath::Clamp((Src[X] - Near) * Scale, 0.0f, 65535.0f);
+      const uint16 Quantized = uint16(Scaled + 0.5f);
+      FMemory::Memcpy(Dst + X * 2, &Quantized, 2);
+    }
+    return;
+  }
+  }
+}
+
+} // namespace UESynthPixels
@@ -0,0 +1,98 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+
+/**
+ * Row conversion from read-back viewport pixels to the layouts clients ask for.
+ *
+ * Sources are the 4-byte formats a viewport back buffer comes in. The 8-bit ones go through SIMD
+ * kernels (AVX2 or SSSE3 on x64, NEON on arm64, whichever the build targets) that swizzle and drop
+ * channels in one pass; anything else, and every row tail, takes the scalar path, which produces
+ * the exact same bytes.
+ */
+namespace UESynthPixels
+{
+
+/** Output layouts, mirroring uesynth::PixelFormat. */
+enum class EFormat : uint8
+{
+  RGBA8,
+  RGB8,
+  BGR8,
+  Gray8,
+};
+
+inline int32 BytesPerPixel(EFormat Format) {
+  switch (Format) {
+  case EFormat::RGBA8:
+    return 4;
+  case EFormat::RGB8:
+  case EFormat::BGR8:
+    return 3;
+  default:
+    return 1;
+  }
+}
+
+/** The ImageResponse.format string clients see for Format. */
+inline const char* FormatName(EFormat Format) {
+  switch (Format) {
+  case EFormat::RGBA8:
+    return "rgba";
+  case EFormat::RGB8:
+    return "rgb";
+  case EFormat::BGR8:
+    return "bgr";
+  default:
+    return "gray";
+  }
+}
+
+/** Whether Source can be converted at all: B8G8R8A8, R8G8B8A8 or A2B10G10R10. */
+bool IsSupportedSource(EPixelFormat Source);
+
+/**
+ * Converts Width pixels of Source from Src into Dst, which must hold Width * BytesPerPixel(Dest)
+ * bytes. Gray is BT.601 luma in 7-bit fixed point: (38 R + 75 G + 15 B + 64) >> 7.
+ */
+void ConvertRow(EPixelFormat Source, EFormat Dest, const uint8* Src, uint8* Dst, int32 Width);
+
+/** The scalar path on its own, the reference the SIMD kernels are tested against. */
+void ConvertRowScalar(EPixelFormat Source, EFormat Dest, const uint8* Src, uint8* Dst,
+                      int32 Width);
+
+/** Depth layouts, mirroring uesynth::DepthEncoding. */
+enum class EDepthEncoding : uint8
+{
+  Float32,
+  Float16,
+  UInt16,
+};
+
+inline int32 BytesPerDepth(EDepthEncoding Encoding) {
+  return Encoding == EDepthEncoding::Float32 ? 4 : 2;
+}
+
+/** The range UInt16 depth covers when the request leaves it unset: 0 to 65535 mm, in cm. */
+constexpr float DefaultDepthNear = 0.0f;
+constexpr float DefaultDepthFar = 6553.5f;
+
+/**
+ * The ImageResponse.format for depth in Encoding: "depth_f32" or "depth_f16" for view-space depth
+ * in cm, or "depth_u16:near=<cm>,far=<cm>" for the quantized range.
+ */
+FString DepthFormatName(EDepthEncoding Encoding, float Near, float Far);
+
+/**
+ * Converts Width float32 depths in cm from Src into Dst as little-endian Encoding, which must hold
+ * Width * BytesPerDepth(Encoding) bytes. UInt16 maps [Near, Far] linearly onto [0, 65535],
+ * rounding to nearest and clamping outside the range.
+ */
+void ConvertDepthRow(EDepthEncoding Encoding, const float* Src, uint8* Dst, int32 Width,
+                     float Near, float Far);
+
+} // namespace UESynthPixels
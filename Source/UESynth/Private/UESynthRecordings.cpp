@@ -0,0 +1,632 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthRecordings.h"
+#include "Algo/Find.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "UESynthMessageArena.h"
+
+namespace {
+
+/** The modalities a recording stores, in file order, with their file name prefix. */
+struct FRecordedModality
+{
+  uesynth::CaptureModality Modality;
+  const TCHAR* Name;
+};
+
+constexpr FRecordedModality RecordedModalities[] = {
+    {uesynth::CAPTURE_MODALITY_RGB, TEXT("rgb")},
+    {uesynth::CAPTURE_MODALITY_DEPTH, TEXT("depth")},
+    {uesynth::CAPTURE_MODALITY_SEGMENTATION, TEXT("segmentation")},
+    {uesynth::CAPTURE_MODALITY_NORMALS, TEXT("normals")},
+    {uesynth::CAPTURE_MODALITY_OPTICAL_FLOW, TEXT("optical_flow")},
+};
+
+const uesynth::ImageResponse& GetImage(const uesynth::MultiImageResponse& Images,
+                                       uesynth::CaptureModality Modality) {
+  switch (Modality) {
+  case uesynth::CAPTURE_MODALITY_DEPTH:
+    return Images.depth();
+  case uesynth::CAPTURE_MODALITY_SEGMENTATION:
+    return Images.segmentation();
+  case uesynth::CAPTURE_MODALITY_NORMALS:
+    return Images.normals();
+  case uesynth::CAPTURE_MODALITY_OPTICAL_FLOW:
+    return Images.optical_flow();
+  default:
+    return Images.rgb();
+  }
+}
+
+/** The numpy type of one element of an image in Format, and its size in bytes. */
+const TCHAR* GetElementType(const std::string& Format, int32* OutSize) {
+  if (Format == "depth_f32") {
+    *OutSize = 4;
+    return TEXT("<f4");
+  }
+  if (Format == "depth_f16" || Format == "flow_f16") {
+    *OutSize = 2;
+    return TEXT("<f2");
+  }
+  if (Format.rfind("depth_u16", 0) == 0) {
+    *OutSize = 2;
+    return TEXT("<u2");
+  }
+  *OutSize = 1;
+  return TEXT("|u1");
+}
+
+/** One frame of a shard's index file, as documented on StartRecordingRequest. */
+struct FIndexRecord
+{
+  uint64 Sequence;
+  uint64 FrameNumber;
+  double WorldTimeSeconds;
+  float Location[3];
+  float Rotation[3];
+  uint32 Modalities;
+  uint32 SegmentationRevision;
+  uint64 DroppedFrames;
+};
+
+static_assert(sizeof(FIndexRecord) == FUESynthRecordings::IndexRecordSize,
+              "Index records are written as they are laid out in memory");
+static_assert(PLATFORM_LITTLE_ENDIAN, "Index records are little-endian on disk");
+
+/** FIndexRecord's fields for the manifest, so readers needn't hard-code the layout. */
+struct FIndexField
+{
+  const TCHAR* Name;
+  const TCHAR* Type;
+  int32 Count;
+};
+
+constexpr FIndexField IndexFields[] = {
+    {TEXT("sequence"), TEXT("<u8"), 1},
+    {TEXT("frame_number"), TEXT("<u8"), 1},
+    {TEXT("world_time_seconds"), TEXT("<f8"), 1},
+    {TEXT("location"), TEXT("<f4"), 3},
+    {TEXT("rotation"), TEXT("<f4"), 3},
+    {TEXT("modalities"), TEXT("<u4"), 1},
+    {TEXT("segmentation_revision"), TEXT("<u4"), 1},
+    {TEXT("dropped_frames"), TEXT("<u8"), 1},
+};
+
+using FJsonWriter = TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>;
+using FJsonWriterFactory = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>;
+
+/** Writes Json to Path through a temporary file, so readers never see half of it. */
+bool SaveJson(const FString& Json, const FString& Path) {
+  const FString TempPath = Path + TEXT(".tmp");
+  return FFileHelper::SaveStringToFile(Json, *TempPath,
+                                       FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM) &&
+         IFileManager::Get().Move(*Path, *TempPath, /*bReplace=*/true);
+}
+
+} // namespace
+
+FUESynthRecordings::FRecording::FRecording(FUESynthRecordings& InOwner, const std::string& InId,
+                                           const FString& InDirectory, uint32 InFramesPerShard,
+                                           int32 InMaxQueued)
+    : Id(InId), Directory(InDirectory), Link(MakeShared<FUESynthStreamLink>(this)),
+      Owner(InOwner), FramesPerShard(InFramesPerShard), MaxQueued(InMaxQueued) {}
+
+FUESynthRecordings::FRecording::~FRecording() {
+  Link->Detach();
+}
+
+int32 FUESynthRecordings::FRecording::GetNumQueued() const {
+  std::lock_guard<std::mutex> Lock(Owner.Mutex);
+  return int32(Queue.size());
+}
+
+bool FUESynthRecordings::FRecording::Push(uesynth::FrameResponse&& Response) {
+  {
+    std::lock_guard<std::mutex> Lock(Owner.Mutex);
+    if (!bStopping && Error.IsEmpty() && int32(Queue.size()) < MaxQueued) {
+      Queue.push_back(MoveTemp(Response));
+      PeakQueued = FMath::Max(PeakQueued, int32(Queue.size()));
+      Owner.StateChanged.notify_all();
+      return true;
+    }
+    ++Dropped;
+  }
+  // Dropped, not refused: a subscription would end on false
+  UESynthImageBuffers::Reclaim(&Response);
+  return true;
+}
+
+FUESynthWriteQueueStats FUESynthRecordings::FRecording::GetWriteQueueStats() const {
+  std::lock_guard<std::mutex> Lock(Owner.Mutex);
+  FUESynthWriteQueueStats Stats;
+  Stats.Policy = EUESynthWritePolicy::DropNewest;
+  Stats.Depth = int32(Queue.size());
+  Stats.Capacity = MaxQueued;
+  Stats.PeakDepth = PeakQueued;
+  Stats.Dropped = Dropped;
+  return Stats;
+}
+
+void FUESynthRecordings::FRecording::GetStatsLocked(uesynth::RecordingStats* Out) const {
+  Out->set_recording_id(Id);
+  Out->set_directory(TCHAR_TO_UTF8(*Directory));
+  Out->set_frames_written(Written);
+  Out->set_frames_dropped(Dropped + SkippedBySubscription);
+  Out->set_bytes_written(BytesWritten);
+  Out->set_shards(uint32(NumShards));
+  Out->set_queued_frames(uint32(Queue.size()));
+  Out->set_error(TCHAR_TO_UTF8(*Error));
+}
+
+bool FUESynthRecordings::FRecording::Write(const uesynth::FrameResponse& Response) {
+  const uesynth::SubscriptionFrame& Frame = Response.subscription_frame();
+  const uesynth::MultiImageResponse& Images = Frame.images();
+
+  // Only the writer sets Error, so it can read it without the lock
+  bool bWritable = Error.IsEmpty() && Images.modalities() != 0;
+  for (const FRecordedModality& Entry : RecordedModalities) {
+    if (Images.modalities() & Entry.Modality) {
+      const uesynth::ImageResponse& Image = GetImage(Images, Entry.Modality);
+      bWritable &= Image.codec() == uesynth::IMAGE_CODEC_RAW && !Image.has_delta() &&
+                   !Image.has_shared_memory() && !Image.image_data().empty();
+    }
+  }
+  if (!bWritable) {
+    return false;
+  }
+
+  if (!CanAppend(Images)) {
+    CloseShard();
+    if (!OpenShard(Images)) {
+      return false;
+    }
+  }
+
+  if ((Images.modalities() & uesynth::CAPTURE_MODALITY_SEGMENTATION) &&
+      Images.segmentation().segmentation_table_size() > 0 &&
+      Images.segmentation().segmentation_revision() != LastSegmentationRevision) {
+    if (!WriteSegmentationTable(Images.segmentation())) {
+      return false;
+    }
+    LastSegmentationRevision = Images.segmentation().segmentation_revision();
+  }
+
+  FShard& Shard = Shards.Last();
+  uint64 Bytes = 0;
+  for (FTensor& Tensor : Shard.Tensors) {
+    const std::string& Data = GetImage(Images, Tensor.Modality).image_data();
+    if (!Tensor.File->Write(reinterpret_cast<const uint8*>(Data.data()), int64(Data.size()))) {
+      Fail(FString::Printf(TEXT("Could not write to %s"), *Tensor.FileName));
+      return false;
+    }
+    Bytes += Data.size();
+  }
+
+  const uesynth::Transform& Camera = Frame.camera_transform();
+  FIndexRecord Record = {};
+  Record.Sequence = Frame.sequence();
+  Record.FrameNumber = Frame.frame_number();
+  Record.WorldTimeSeconds = Frame.world_time_seconds();
+  Record.Location[0] = Camera.location().x();
+  Record.Location[1] = Camera.location().y();
+  Record.Location[2] = Camera.location().z();
+  Record.Rotation[0] = Camera.rotation().pitch();
+  Record.Rotation[1] = Camera.rotation().yaw();
+  Record.Rotation[2] = Camera.rotation().roll();
+  Record.Modalities = Images.modalities();
+  Record.SegmentationRevision = Images.segmentation().segmentation_revision();
+  Record.DroppedFrames = Frame.dropped_frames();
+  if (!Shard.IndexFile->Write(reinterpret_cast<const uint8*>(&Record), sizeof(Record))) {
+    Fail(FString::Printf(TEXT("Could not write to %s"), *Shard.IndexFileName));
+    return false;
+  }
+  ++Shard.Frames;
+
+  std::lock_guard<std::mutex> Lock(Owner.Mutex);
+  ++Written;
+  BytesWritten += Bytes + sizeof(Record);
+  SkippedBySubscription = FMath::Max(SkippedBySubscription, Frame.dropped_frames());
+  return true;
+}
+
+void FUESynthRecordings::FRecording::Finish() {
+  CloseShard();
+  WriteManifest(/*bComplete=*/true);
+}
+
+bool FUESynthRecordings::FRecording::CanAppend(const uesynth::MultiImageResponse& Images) const {
+  if (!bShardOpen || Shards.Last().Frames >= FramesPerShard) {
+    return false;
+  }
+  const TArray<FTensor>& Tensors = Shards.Last().Tensors;
+  int32 Next = 0;
+  for (const FRecordedModality& Entry : RecordedModalities) {
+    if (!(Images.modalities() & Entry.Modality)) {
+      continue;
+    }
+    if (Next == Tensors.Num() || Tensors[Next].Modality != Entry.Modality) {
+      return false;
+    }
+    const FTensor& Tensor = Tensors[Next++];
+    const uesynth::ImageResponse& Image = GetImage(Images, Entry.Modality);
+    if (Image.format() != Tensor.Format || Image.width() != Tensor.Width ||
+        Image.height() != Tensor.Height || Image.image_data().size() != Tensor.Stride) {
+      return false;
+    }
+  }
+  return Next == Tensors.Num();
+}
+
+bool FUESynthRecordings::FRecording::OpenShard(const uesynth::MultiImageResponse& Images) {
+  IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+  FShard& Shard = Shards.AddDefaulted_GetRef();
+  Shard.Index = Shards.Num() - 1;
+  Shard.IndexFileName = FString::Printf(TEXT("index-%05d.bin"), Shard.Index);
+  Shard.IndexFile.Reset(PlatformFile.OpenWrite(*FPaths::Combine(Directory, Shard.IndexFileName)));
+  if (!Shard.IndexFile) {
+    Fail(FString::Printf(TEXT("Could not create %s"), *Shard.IndexFileName));
+    return false;
+  }
+
+  for (const FRecordedModality& Entry : RecordedModalities) {
+    if (!(Images.modalities() & Entry.Modality)) {
+      continue;
+    }
+    const uesynth::ImageResponse& Image = GetImage(Images, Entry.Modality);
+    FTensor& Tensor = Shard.Tensors.AddDefaulted_GetRef();
+    Tensor.Modality = Entry.Modality;
+    Tensor.Format = Image.format();
+    Tensor.Width = Image.width();
+    Tensor.Height = Image.height();
+    Tensor.Stride = Image.image_data().size();
+    Tensor.FileName = FString::Printf(TEXT("%s-%05d.bin"), Entry.Name, Shard.Index);
+    Tensor.File.Reset(PlatformFile.OpenWrite(*FPaths::Combine(Directory, Tensor.FileName)));
+    if (!Tensor.File) {
+      Fail(FString::Printf(TEXT("Could not create %s"), *Tensor.FileName));
+      return false;
+    }
+  }
+
+  bShardOpen = true;
+  {
+    std::lock_guard<std::mutex> Lock(Owner.Mutex);
+    NumShards = Shards.Num();
+  }
+  // Readers can map a shard as soon as its layout is in the manifest
+  return WriteManifest(/*bComplete=*/false);
+}
+
+void FUESynthRecordings::FRecording::CloseShard() {
+  if (!bShardOpen) {
+    return;
+  }
+  bShardOpen = false;
+  FShard& Shard = Shards.Last();
+  for (FTensor& Tensor : Shard.Tensors) {
+    Tensor.File->Flush();
+    Tensor.File.Reset();
+  }
+  Shard.IndexFile->Flush();
+  Shard.IndexFile.Reset();
+  WriteManifest(/*bComplete=*/false);
+}
+
+bool FUESynthRecordings::FRecording::WriteSegmentationTable(
+    const uesynth::ImageResponse& Segmentation) {
+  FString Json;
+  const TSharedRef<FJsonWriter> Writer = FJsonWriterFactory::Create(&Json);
+  Writer->WriteObjectStart();
+  Writer->WriteValue(TEXT("revision"), int64(Segmentation.segmentation_revision()));
+  Writer->WriteArrayStart(TEXT("entries"));
+  for (const uesynth::SegmentationEntry& Entry : Segmentation.segmentation_table()) {
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("segmentation_id"), int64(Entry.segmentation_id()));
+    Writer->WriteValue(TEXT("object_name"), FString(UTF8_TO_TCHAR(Entry.object_name().c_str())));
+    Writer->WriteValue(TEXT("object_id"), int64(Entry.object_id()));
+    Writer->WriteObjectEnd();
+  }
+  Writer->WriteArrayEnd();
+  Writer->WriteObjectEnd();
+  Writer->Close();
+
+  const FString FileName =
+      FString::Printf(TEXT("segmentation-%u.json"), Segmentation.segmentation_revision());
+  if (!SaveJson(Json, FPaths::Combine(Directory, FileName))) {
+    Fail(FString::Printf(TEXT("Could not write %s"), *FileName));
+    return false;
+  }
+  return true;
+}
+
+bool FUESynthRecordings::FRecording::WriteManifest(bool bComplete) {
+  FString Json;
+  const TSharedRef<FJsonWriter> Writer = FJsonWriterFactory::Create(&Json);
+  Writer->WriteObjectStart();
+  Writer->WriteValue(TEXT("recording_id"), FString(UTF8_TO_TCHAR(Id.c_str())));
+  Writer->WriteValue(TEXT("complete"), bComplete);
+  Writer->WriteValue(TEXT("frames_per_shard"), int64(FramesPerShard));
+  Writer->WriteValue(TEXT("index_record_size"), int64(IndexRecordSize));
+  Writer->WriteArrayStart(TEXT("index_fields"));
+  for (const FIndexField& Field : IndexFields) {
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("name"), FString(Field.Name));
+    Writer->WriteValue(TEXT("dtype"), FString(Field.Type));
+    Writer->WriteValue(TEXT("count"), int64(Field.Count));
+    Writer->WriteObjectEnd();
+  }
+  Writer->WriteArrayEnd();
+
+  Writer->WriteArrayStart(TEXT("shards"));
+  for (const FShard& Shard : Shards) {
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("index"), int64(Shard.Index));
+    // As of this write; a shard still open may have more frames on disk already
+    Writer->WriteValue(TEXT("frames"), int64(Shard.Frames));
+    Writer->WriteValue(TEXT("index_file"), Shard.IndexFileName);
+    Writer->WriteObjectStart(TEXT("tensors"));
+    for (const FTensor& Tensor : Shard.Tensors) {
+      int32 ElementSize = 1;
+      const TCHAR* ElementType = GetElementType(Tensor.Format, &ElementSize);
+      const uint64 Pixels = uint64(Tensor.Width) * Tensor.Height * ElementSize;
+      const int64 Channels = Pixels > 0 ? int64(Tensor.Stride / Pixels) : 0;
+
+      const FRecordedModality* Entry = Algo::FindBy(RecordedModalities, Tensor.Modality,
+                                                    &FRecordedModality::Modality);
+      Writer->WriteObjectStart(Entry->Name);
+      Writer->WriteValue(TEXT("file"), Tensor.FileName);
+      Writer->WriteValue(TEXT("format"), FString(UTF8_TO_TCHAR(Tensor.Format.c_str())));
+      Writer->WriteValue(TEXT("dtype"), FString(ElementType));
+      Writer->WriteArrayStart(TEXT("shape"));
+      Writer->WriteValue(int64(Tensor.Height));
+      Writer->WriteValue(int64(Tensor.Width));
+      Writer->WriteValue(Channels);
+      Writer->WriteArrayEnd();
+      Writer->WriteValue(TEXT("frame_bytes"), int64(Tensor.Stride));
+      Writer->WriteObjectEnd();
+    }
+    Writer->WriteObjectEnd();
+    Writer->WriteObjectEnd();
+  }
+  Writer->WriteArrayEnd();
+  Writer->WriteObjectEnd();
+  Writer->Close();
+
+  if (!SaveJson(Json, FPaths::Combine(Directory, ManifestName))) {
+    Fail(FString::Printf(TEXT("Could not write %s"), ManifestName));
+    return false;
+  }
+  return true;
+}
+
+void FUESynthRecordings::FRecording::Fail(const FString& Message) {
+  UE_LOG(LogTemp, Error, TEXT("UESynth: Recording '%s' failed: %s"), UTF8_TO_TCHAR(Id.c_str()),
+         *Message);
+  std::lock_guard<std::mutex> Lock(Owner.Mutex);
+  if (Error.IsEmpty()) {
+    Error = Message;
+  }
+}
+
+FUESynthRecordings* FUESynthRecordings::Instance = nullptr;
+
+FUESynthRecordings::FUESynthRecordings() {
+  check(Instance == nullptr);
+  Instance = this;
+}
+
+FUESynthRecordings::~FUESynthRecordings() {
+  Reset();
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    bShuttingDown = true;
+  }
+  StateChanged.notify_all();
+  if (Writer.joinable()) {
+    Writer.join();
+  }
+  Instance = nullptr;
+}
+
+FUESynthRecordings& FUESynthRecordings::Get() {
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+FString FUESynthRecordings::GetRoot() {
+  FString Root = FPaths::ConvertRelativePathToFull(
+      FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UESynth"), TEXT("Recordings")));
+  FPaths::NormalizeDirectoryName(Root);
+  return Root;
+}
+
+FString FUESynthRecordings::GetDirectory(const uesynth::StartRecordingRequest& Request) {
+  FString Directory = UTF8_TO_TCHAR(Request.directory().c_str());
+  if (Directory.IsEmpty()) {
+    Directory = UTF8_TO_TCHAR(Request.recording_id().c_str());
+  }
+  if (!FPaths::IsRelative(Directory)) {
+    return FString();
+  }
+  // Collapses any "..", so what is left can be checked against the root
+  const FString Root = GetRoot();
+  Directory = FPaths::ConvertRelativePathToFull(Root, Directory);
+  FPaths::NormalizeDirectoryName(Directory);
+  if (Directory == Root || !FPaths::IsUnderDirectory(Directory, Root)) {
+    return FString();
+  }
+  return Directory;
+}
+
+bool FUESynthRecordings::Start(UESynthServiceImpl& Service,
+                               const uesynth::StartRecordingRequest& Request,
+                               uesynth::RecordingStats* OutStats, FString* OutError) {
+  check(IsInGameThread());
+  const FString Key = UTF8_TO_TCHAR(Request.recording_id().c_str());
+  if (Recordings.Contains(Key)) {
+    *OutError = FString::Printf(TEXT("Recording '%s' is already running"), *Key);
+    return false;
+  }
+
+  const FString Directory = GetDirectory(Request);
+  if (Directory.IsEmpty()) {
+    *OutError = TEXT("Recordings must stay under Saved/UESynth/Recordings");
+    return false;
+  }
+  for (const TPair<FString, TSharedRef<FRecording>>& Pair : Recordings) {
+    if (Pair.Value->Directory == Directory) {
+      *OutError = FString::Printf(TEXT("Recording '%s' is already writing to %s"), *Pair.Key,
+                                  *Directory);
+      return false;
+    }
+  }
+  IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+  if (PlatformFile.FileExists(*FPaths::Combine(Directory, ManifestName))) {
+    *OutError = FString::Printf(TEXT("%s already holds a recording"), *Directory);
+    return false;
+  }
+  if (!PlatformFile.CreateDirectoryTree(*Directory)) {
+    *OutError = FString::Printf(TEXT("Could not create %s"), *Directory);
+    return false;
+  }
+
+  const uint32 FramesPerShard =
+      Request.frames_per_shard() > 0 ? Request.frames_per_shard() : DefaultFramesPerShard;
+  const uint32 RequestedQueue = Request.subscription().max_queued_frames();
+  const int32 MaxQueued =
+      RequestedQueue > 0 ? int32(FMath::Min<uint32>(RequestedQueue, MAX_int32))
+                         : DefaultMaxQueuedFrames;
+  const TSharedRef<FRecording> Recording = MakeShared<FRecording>(
+      *this, Request.recording_id(), Directory, FramesPerShard, MaxQueued);
+
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Writing.Add(Recording);
+  }
+  if (!Writer.joinable()) {
+    Writer = std::thread([this]() { WriterLoop(); });
+  }
+
+  if (Request.subscription().capture().modalities() != 0) {
+    // Skip due frames as soon as the writer's queue is full, as for a slow client
+    uesynth::SubscribeRequest Subscription = Request.subscription();
+    Subscription.set_max_queued_frames(uint32(MaxQueued));
+    FUESynthSubscriptions::Get().Subscribe(Service, Recording->Link, Request.recording_id(),
+                                           Subscription);
+  }
+  Recordings.Add(Key, Recording);
+
+  std::lock_guard<std::mutex> Lock(Mutex);
+  Recording->GetStatsLocked(OutStats);
+  return true;
+}
+
+bool FUESynthRecordings::Stop(const std::string& Id, FStoppedCallback&& OnStopped) {
+  check(IsInGameThread());
+  const FString Key = UTF8_TO_TCHAR(Id.c_str());
+  const TSharedRef<FRecording>* Found = Recordings.Find(Key);
+  if (!Found) {
+    return false;
+  }
+  const TSharedRef<FRecording> Recording = *Found;
+  Recordings.Remove(Key);
+
+  FUESynthSubscriptions::Get().Unsubscribe(*Recording->Link, Id);
+  // Captures still in flight find the link detached and drop their frames
+  Recording->Link->Detach();
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Recording->bStopping = true;
+    Recording->OnStopped = MoveTemp(OnStopped);
+  }
+  StateChanged.notify_all();
+  return true;
+}
+
+TSharedPtr<FUESynthStreamLink> FUESynthRecordings::FindLink(const std::string& Id) const {
+  check(IsInGameThread());
+  const TSharedRef<FRecording>* Found = Recordings.Find(UTF8_TO_TCHAR(Id.c_str()));
+  return Found ? TSharedPtr<FUESynthStreamLink>((*Found)->Link) : nullptr;
+}
+
+void FUESynthRecordings::Reset() {
+  check(IsInGameThread());
+  TArray<FString> Keys;
+  Recordings.GetKeys(Keys);
+  for (const FString& Key : Keys) {
+    Stop(TCHAR_TO_UTF8(*Key), nullptr);
+  }
+
+  std::unique_lock<std::mutex> Lock(Mutex);
+  StateChanged.wait(Lock, [this]() { return Writing.IsEmpty(); });
+}
+
+int32 FUESynthRecordings::FindWorkLocked(int32 Start) const {
+  for (int32 Offset = 0; Offset < Writing.Num(); ++Offset) {
+    const int32 Index = (Start + Offset) % Writing.Num();
+    if (!Writing[Index]->Queue.empty() || Writing[Index]->bStopping) {
+      return Index;
+    }
+  }
+  return INDEX_NONE;
+}
+
+void FUESynthRecordings::WriterLoop() {
+  // Round-robin, so one busy recording doesn't starve the others
+  int32 Start = 0;
+  for (;;) {
+    TSharedPtr<FRecording> Recording;
+    uesynth::FrameResponse Frame;
+    bool bHasFrame = false;
+    {
+      std::unique_lock<std::mutex> Lock(Mutex);
+      int32 Found = INDEX_NONE;
+      StateChanged.wait(Lock, [this, Start, &Found]() {
+        Found = FindWorkLocked(Start);
+        return Found != INDEX_NONE || bShuttingDown;
+      });
+      if (Found == INDEX_NONE) {
+        return;
+      }
+      Recording = Writing[Found];
+      Start = Found + 1;
+      if (!Recording->Queue.empty()) {
+        Frame = MoveTemp(Recording->Queue.front());
+        Recording->Queue.pop_front();
+        bHasFrame = true;
+      }
+    }
+
+    if (bHasFrame) {
+      const bool bWritten = Recording->Write(Frame);
+      UESynthImageBuffers::Reclaim(&Frame);
+      if (!bWritten) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        ++Recording->Dropped;
+      }
+      continue;
+    }
+
+    // Stopped and drained. This thread alone picks work, so nothing else finds it meanwhile.
+    Recording->Finish();
+    FStoppedCallback OnStopped;
+    uesynth::RecordingStats Stats;
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      Writing.Remove(Recording.ToSharedRef());
+      Recording->GetStatsLocked(&Stats);
+      OnStopped = MoveTemp(Recording->OnStopped);
+    }
+    StateChanged.notify_all();
+    if (OnStopped) {
+      OnStopped(Stats);
+    }
+  }
+}
@@ -0,0 +1,184 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UESynthSubscriptions.h"
+#include "pb/uesynth.pb.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class IFileHandle;
+class UESynthServiceImpl;
+
+/**
+ * Recordings: captures written to sharded files on the server instead of being sent.
+ *
+ * A recording is the frame sink of a subscription it makes, and of the steps that name it, so
+ * frames that are only going to be stored never cross the transport. Frames wait in a bounded
+ * queue per recording for the writer thread the recordings share. Once a queue is full its
+ * subscription skips due frames, as it would for a slow client, and steps drop theirs, so the game
+ * thread never waits for the disk. See StartRecordingRequest for the file layout.
+ *
+ * Game thread only, apart from pushing frames through a recording's link and the writer itself.
+ */
+class FUESynthRecordings
+{
+public:
+  static constexpr uint32 DefaultFramesPerShard = 1000;
+  /** Frames a recording's queue holds when its subscription doesn't say. */
+  static constexpr int32 DefaultMaxQueuedFrames = 8;
+  /** Bytes per frame in a shard's index file. */
+  static constexpr int32 IndexRecordSize = 64;
+  static constexpr const TCHAR* ManifestName = TEXT("recording.json");
+
+  /** Runs on the writer thread with the final stats, once a stopped recording is on disk. */
+  using FStoppedCallback = TUniqueFunction<void(const uesynth::RecordingStats&)>;
+
+  FUESynthRecordings();
+  ~FUESynthRecordings();
+
+  FUESynthRecordings(const FUESynthRecordings&) = delete;
+  FUESynthRecordings& operator=(const FUESynthRecordings&) = delete;
+
+  /** The module-owned recordings. */
+  static FUESynthRecordings& Get();
+
+  /**
+   * Opens Request's directory and starts recording, with a subscription through Service if the
+   * request captures anything. The request must have been checked. On failure OutError says why.
+   */
+  bool Start(UESynthServiceImpl& Service, const uesynth::StartRecordingRequest& Request,
+             uesynth::RecordingStats* OutStats, FString* OutError);
+
+  /**
+   * Stops recording Id: ends its subscription and takes no more frames. OnStopped runs once the
+   * frames already queued are written and the manifest is final. False if there is no such
+   * recording.
+   */
+  bool Stop(const std::string& Id, FStoppedCallback&& OnStopped);
+
+  /** The link frames of recording Id are pushed through from any thread, or null. */
+  TSharedPtr<FUESynthStreamLink> FindLink(const std::string& Id) const;
+
+  /** Stops every recording and waits until they are on disk. */
+  void Reset();
+
+  int32 Num() const {
+    return Recordings.Num();
+  }
+
+  /** Where every recording goes: the project's Saved/UESynth/Recordings, as a full path. */
+  static FString GetRoot();
+
+  /**
+   * The full path a request's directory refers to, under GetRoot(); empty if it is absolute or
+   * leads out of it, since clients name recordings rather than places on the server's disk.
+   */
+  static FString GetDirectory(const uesynth::StartRecordingRequest& Request);
+
+private:
+  /** One recording's files and queue. Its queue and counters are guarded by the owner's mutex. */
+  class FRecording final : public IUESynthFrameSink
+  {
+  public:
+    FRecording(FUESynthRecordings& InOwner, const std::string& InId, const FString& InDirectory,
+               uint32 InFramesPerShard, int32 InMaxQueued);
+    virtual ~FRecording() override;
+
+    //~ Begin IUESynthFrameSink interface
+    virtual int32 GetNumQueued() const override;
+    virtual bool Push(uesynth::FrameResponse&& Response) override;
+    virtual FUESynthWriteQueueStats GetWriteQueueStats() const override;
+    //~ End IUESynthFrameSink interface
+
+    /**
+     * Writes one frame to the current shard, starting a new one first if needed; false if the
+     * frame can't be stored. Writer only.
+     */
+    bool Write(const uesynth::FrameResponse& Response);
+
+    /** Closes the current shard and writes the final manifest. Writer only. */
+    void Finish();
+
+    /** Fills Out; the caller holds the owner's mutex. */
+    void GetStatsLocked(uesynth::RecordingStats* Out) const;
+
+    const std::string Id;
+    const FString Directory;
+    TSharedRef<FUESynthStreamLink> Link;
+
+    /** Guarded by the owner's mutex. */
+    std::deque<uesynth::FrameResponse> Queue;
+    FStoppedCallback OnStopped;
+    bool bStopping = false;
+    int32 PeakQueued = 0;
+    uint64 Written = 0;
+    uint64 Dropped = 0;
+    uint64 SkippedBySubscription = 0;
+    uint64 BytesWritten = 0;
+    int32 NumShards = 0;
+    FString Error;
+
+  private:
+    /** The raw images of one modality in a shard, every frame the same size. */
+    struct FTensor
+    {
+      uesynth::CaptureModality Modality = uesynth::CAPTURE_MODALITY_NONE;
+      std::string Format;
+      uint32 Width = 0;
+      uint32 Height = 0;
+      uint64 Stride = 0;
+      FString FileName;
+      TUniquePtr<IFileHandle> File;
+    };
+
+    struct FShard
+    {
+      int32 Index = 0;
+      uint64 Frames = 0;
+      FString IndexFileName;
+      TUniquePtr<IFileHandle> IndexFile;
+      TArray<FTensor> Tensors;
+    };
+
+    /** Whether the current shard has room for Images and the same layout. */
+    bool CanAppend(const uesynth::MultiImageResponse& Images) const;
+    bool OpenShard(const uesynth::MultiImageResponse& Images);
+    void CloseShard();
+    bool WriteSegmentationTable(const uesynth::ImageResponse& Segmentation);
+    /** Rewrites the manifest from the closed shards and the current one. */
+    bool WriteManifest(bool bComplete);
+    /** Records a write failure; queued and later frames are dropped. */
+    void Fail(const FString& Message);
+
+    FUESynthRecordings& Owner;
+    const uint32 FramesPerShard;
+    const int32 MaxQueued;
+
+    /** Writer only. Every shard so far; closed ones keep their layout for the manifest. */
+    TArray<FShard> Shards;
+    bool bShardOpen = false;
+    uint32 LastSegmentationRevision = 0;
+  };
+
+  void WriterLoop();
+  /** The first recording from Start on with frames queued or a stop due; the mutex is held. */
+  int32 FindWorkLocked(int32 Start) const;
+
+  /** Game thread only. */
+  TMap<FString, TSharedRef<FRecording>> Recordings;
+
+  std::mutex Mutex;
+  std::condition_variable StateChanged;
+  /** Every recording still writing, stopped ones included until they are finished. */
+  TArray<TSharedRef<FRecording>> Writing;
+  bool bShuttingDown = false;
+  std::thread Writer;
+
+  static FUESynthRecordings* Instance;
+};
@@ -0,0 +1,75 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthRegistration.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+FUESynthRegistration::FUESynthRegistration(const FString& Directory, const FString& ListenAddress,
+                                           int32 MetricsPort) {
+  const FString FullDirectory = GetDirectory(Directory);
+  const uint32 ProcessId = FPlatformProcess::GetCurrentProcessId();
+  if (!IFileManager::Get().MakeDirectory(*FullDirectory, /*Tree=*/true)) {
+    UE_LOG(LogTemp, Error, TEXT("Could not create the registration directory %s"), *FullDirectory);
+    return;
+  }
+
+  FString Json;
+  const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer =
+      TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+  Writer->WriteObjectStart();
+  Writer->WriteValue(TEXT("address"), GetConnectAddress(ListenAddress));
+  Writer->WriteValue(TEXT("listen_address"), ListenAddress);
+  Writer->WriteValue(TEXT("pid"), int64(ProcessId));
+  Writer->WriteValue(TEXT("hostname"), FString(FPlatformProcess::ComputerName()));
+  Writer->WriteValue(TEXT("project"), FString(FApp::GetProjectName()));
+  Writer->WriteValue(TEXT("metrics_port"), int64(MetricsPort));
+  Writer->WriteObjectEnd();
+  Writer->Close();
+
+  // Through a temporary file, so a client listing the directory never reads half of it
+  const FString FilePath =
+      FPaths::Combine(FullDirectory, FString::Printf(TEXT("uesynth-%u.json"), ProcessId));
+  const FString TempPath = FilePath + TEXT(".tmp");
+  if (!FFileHelper::SaveStringToFile(Json, *TempPath,
+                                     FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM) ||
+      !IFileManager::Get().Move(*FilePath, *TempPath, /*bReplace=*/true)) {
+    UE_LOG(LogTemp, Error, TEXT("Could not write the registration file %s"), *FilePath);
+    return;
+  }
+  Path = FilePath;
+  UE_LOG(LogTemp, Log, TEXT("Registered %s in %s"), *ListenAddress, *Path);
+}
+
+FUESynthRegistration::~FUESynthRegistration() {
+  if (!Path.IsEmpty()) {
+    IFileManager::Get().Delete(*Path, /*RequireExists=*/false, /*EvenReadOnly=*/true);
+  }
+}
+
+FString FUESynthRegistration::GetConnectAddress(const FString& ListenAddress) {
+  int32 Colon = INDEX_NONE;
+  if (!ListenAddress.FindLastChar(TEXT(':'), Colon)) {
+    return ListenAddress;
+  }
+  const FString Host = ListenAddress.Left(Colon);
+  if (Host == TEXT("0.0.0.0") || Host == TEXT("[::]") || Host.IsEmpty()) {
+    return TEXT("127.0.0.1") + ListenAddress.Mid(Colon);
+  }
+  return ListenAddress;
+}
+
+FString FUESynthRegistration::GetDirectory(const FString& Setting) {
+  FString Directory = Setting;
+  if (FPaths::IsRelative(Directory)) {
+    Directory = FPaths::Combine(FPaths::ProjectSavedDir(), Directory);
+  }
+  Directory = FPaths::ConvertRelativePathToFull(Directory);
+  FPaths::NormalizeDirectoryName(Directory);
+  return Directory;
+}
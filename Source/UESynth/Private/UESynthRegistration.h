@@ -0,0 +1,40 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * The file that announces a serving instance to the clients of a fleet.
+ *
+ * While it lives, <directory>/uesynth-<pid>.json says where the server listens, with an address
+ * other processes can connect to, the process id and the metrics port, so every instance started
+ * with the same RegistrationDir can be found without knowing which port each one took. The file is
+ * replaced whole, never seen half written, and removed again on destruction; one a crashed
+ * instance left behind names a process that no longer exists.
+ */
+class FUESynthRegistration
+{
+public:
+  /** Writes the file for a server bound to ListenAddress; logs why if it can't. */
+  FUESynthRegistration(const FString& Directory, const FString& ListenAddress, int32 MetricsPort);
+  ~FUESynthRegistration();
+
+  FUESynthRegistration(const FUESynthRegistration&) = delete;
+  FUESynthRegistration& operator=(const FUESynthRegistration&) = delete;
+
+  /** The file written, or empty if there is none. */
+  const FString& GetPath() const {
+    return Path;
+  }
+
+  /** The address clients connect to for ListenAddress: a wildcard host becomes 127.0.0.1. */
+  static FString GetConnectAddress(const FString& ListenAddress);
+
+  /** The full path a RegistrationDir setting refers to. */
+  static FString GetDirectory(const FString& Setting);
+
+private:
+  FString Path;
+};
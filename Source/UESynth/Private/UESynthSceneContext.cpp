@@ -0,0 +1,360 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthSceneContext.h"
+#include "Camera/CameraActor.h"
+#include "Camera/CameraComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+FUESynthSceneContext* FUESynthSceneContext::Instance = nullptr;
+FUESynthSceneContext* FUESynthSceneContext::Active = nullptr;
+
+FUESynthSceneContext::FUESynthSceneContext() {
+  check(Instance == nullptr);
+  Instance = this;
+  BindDelegates();
+}
+
+FUESynthSceneContext::FUESynthSceneContext(UWorld* InSessionWorld)
+    : SessionWorld(InSessionWorld), bIsSession(true) {
+  BindDelegates();
+}
+
+void FUESynthSceneContext::BindDelegates() {
+  PostWorldInitializationHandle = FWorldDelegates::OnPostWorldInitialization.AddRaw(
+      this, &FUESynthSceneContext::OnPostWorldInitialization);
+  WorldCleanupHandle =
+      FWorldDelegates::OnWorldCleanup.AddRaw(this, &FUESynthSceneContext::OnWorldCleanup);
+  LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(
+      this, &FUESynthSceneContext::OnLevelAddedToWorld);
+  LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(
+      this, &FUESynthSceneContext::OnLevelRemovedFromWorld);
+}
+
+FUESynthSceneContext::~FUESynthSceneContext() {
+  FWorldDelegates::OnPostWorldInitialization.Remove(PostWorldInitializationHandle);
+  FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+  FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+  FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+  UnbindWorld();
+
+  check(Active != this);
+  if (Instance == this) {
+    Instance = nullptr;
+  }
+}
+
+FUESynthSceneContext& FUESynthSceneContext::Get() {
+  if (Active) {
+    return *Active;
+  }
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+FUESynthSceneContext::FActiveScope::FActiveScope(FUESynthSceneContext* Context)
+    : Previous(Active) {
+  check(IsInGameThread());
+  Active = Context;
+}
+
+FUESynthSceneContext::FActiveScope::~FActiveScope() {
+  Active = Previous;
+}
+
+UWorld* FUESynthSceneContext::GetWorld() {
+  check(IsInGameThread());
+
+  if (UWorld* World = CachedWorld.Get()) {
+    return World;
+  }
+
+  UnbindWorld();
+  UWorld* World = ResolveWorld();
+  if (World) {
+    BindWorld(World);
+  }
+  return World;
+}
+
+UGameViewportClient* FUESynthSceneContext::GetViewportClient() {
+  UWorld* World = GetWorld();
+  // The game viewport renders the engine's world, not a session's
+  if (!World || bIsSession) {
+    return nullptr;
+  }
+
+  UGameViewportClient* ViewportClient = CachedViewportClient.Get();
+  if (!ViewportClient) {
+    ViewportClient = ResolveViewportClient(World);
+    CachedViewportClient = ViewportClient;
+  }
+  if (bHeadless) {
+    // Nobody looks at the game view; captures render it through GetHeadlessView
+    if (ViewportClient) {
+      ViewportClient->bDisableWorldRendering = true;
+    }
+    return nullptr;
+  }
+  return ViewportClient;
+}
+
+FName FUESynthSceneContext::GetHeadlessView() {
+  UWorld* World = GetWorld();
+  if (!World) {
+    return NAME_None;
+  }
+
+  const FName Name(FUESynthCameraPool::HeadlessViewName);
+  if (!Cameras.Contains(Name)) {
+    // The size a windowed game would have been started at
+    FIntPoint Resolution = FUESynthCameraPool::DefaultResolution;
+    FParse::Value(FCommandLine::Get(), TEXT("ResX="), Resolution.X);
+    FParse::Value(FCommandLine::Get(), TEXT("ResY="), Resolution.Y);
+    if (!FUESynthCameraPool::IsValidResolution(Resolution)) {
+      Resolution = FUESynthCameraPool::DefaultResolution;
+    }
+    if (!Cameras.CreateCamera(World, Name, FTransform::Identity, Resolution)) {
+      return NAME_None;
+    }
+  }
+
+  // Spawning it indexed it like any other camera; in a level without cameras it is the default
+  // one, which SetCameraTransform then moves directly.
+  ACameraActor* View = FindCamera(Name.ToString());
+  if (!View) {
+    return NAME_None;
+  }
+  APlayerController* Player = World->GetFirstPlayerController();
+  if (Player && Player->PlayerCameraManager) {
+    FVector Location;
+    FRotator Rotation;
+    Player->GetPlayerViewPoint(Location, Rotation);
+    View->SetActorLocationAndRotation(Location, Rotation);
+    View->GetCameraComponent()->SetFieldOfView(Player->PlayerCameraManager->GetFOVAngle());
+  } else if (ACameraActor* Default = FindCamera(FString()); Default && Default != View) {
+    View->SetActorTransform(Default->GetActorTransform());
+    View->GetCameraComponent()->SetFieldOfView(Default->GetCameraComponent()->FieldOfView);
+  }
+  return Name;
+}
+
+ACameraActor* FUESynthSceneContext::FindCamera(const FString& CameraName) {
+  if (!GetWorld()) {
+    return nullptr;
+  }
+
+  if (CameraName.IsEmpty()) {
+    if (ACameraActor* Camera = DefaultCamera.Get()) {
+      return Camera;
+    }
+    // The default camera went away; promote any remaining one.
+    for (auto It = NamedCameras.CreateIterator(); It; ++It) {
+      if (ACameraActor* Camera = It->Value.Get()) {
+        DefaultCamera = Camera;
+        return Camera;
+      }
+      It.RemoveCurrent();
+    }
+    return nullptr;
+  }
+
+  const TWeakObjectPtr<ACameraActor>* Found = NamedCameras.Find(FName(*CameraName));
+  return Found ? Found->Get() : nullptr;
+}
+
+FUESynthActorRegistry& FUESynthSceneContext::GetActors() {
+  // Resolving the world is what binds, and therefore builds, the registry.
+  GetWorld();
+  return Actors;
+}
+
+FUESynthCameraPool& FUESynthSceneContext::GetCameras() {
+  // Resolving the world first drops the cameras of a world that has gone away.
+  GetWorld();
+  return Cameras;
+}
+
+FUESynthActorPool& FUESynthSceneContext::GetActorPool() {
+  GetWorld();
+  return ActorPool;
+}
+
+FUESynthMaterialCache& FUESynthSceneContext::GetMaterials() {
+  GetWorld();
+  return Materials;
+}
+
+FUESynthLightRegistry& FUESynthSceneContext::GetLights() {
+  GetWorld();
+  return Lights;
+}
+
+void FUESynthSceneContext::Invalidate() {
+  UnbindWorld();
+}
+
+UWorld* FUESynthSceneContext::ResolveWorld() const {
+  if (bIsSession) {
+    return SessionWorld.Get();
+  }
+  if (!GEngine) {
+    return nullptr;
+  }
+
+  // Method 1: Try to get world from world contexts
+  for (const FWorldContext& WorldContext : GEngine->GetWorldContexts()) {
+    if (WorldContext.World() && WorldContext.WorldType == EWorldType::Game) {
+      return WorldContext.World();
+    }
+  }
+
+  // Method 2: Fallback to PIE world if in editor
+  if (UWorld* PlayWorld = GEngine->GetCurrentPlayWorld()) {
+    return PlayWorld;
+  }
+
+  // Method 3: Last resort - get any valid world
+  if (GEngine->GetWorldContexts().Num() > 0) {
+    return GEngine->GetWorldContexts()[0].World();
+  }
+  return nullptr;
+}
+
+UGameViewportClient* FUESynthSceneContext::ResolveViewportClient(UWorld* World) {
+  // Method 1: Try to get viewport from world
+  if (UGameViewportClient* ViewportClient = World->GetGameViewport()) {
+    return ViewportClient;
+  }
+
+  // Method 2: Try to get viewport from engine
+  if (GEngine && GEngine->GameViewport) {
+    return GEngine->GameViewport;
+  }
+
+  // Method 3: Try to get viewport from world contexts
+  if (GEngine) {
+    for (const FWorldContext& WorldContext : GEngine->GetWorldContexts()) {
+      if (WorldContext.GameViewport) {
+        return WorldContext.GameViewport;
+      }
+    }
+  }
+  return nullptr;
+}
+
+void FUESynthSceneContext::BindWorld(UWorld* World) {
+  CachedWorld = World;
+  ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+      FOnActorSpawned::FDelegate::CreateRaw(this, &FUESynthSceneContext::OnActorSpawned));
+  ActorDestroyedHandle = World->AddOnActorDestroyedHandler(
+      FOnActorDestroyed::FDelegate::CreateRaw(this, &FUESynthSceneContext::OnActorDestroyed));
+  IndexCameras(World);
+  Actors.Rebuild(World);
+}
+
+void FUESynthSceneContext::UnbindWorld() {
+  if (UWorld* World = CachedWorld.Get()) {
+    World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle); // (sic) engine API name
+  }
+  ActorSpawnedHandle.Reset();
+  ActorDestroyedHandle.Reset();
+
+  CachedWorld.Reset();
+  CachedViewportClient.Reset();
+  DefaultCamera.Reset();
+  NamedCameras.Reset();
+  Actors.Reset();
+  Cameras.Reset();
+  ActorPool.Reset();
+  Materials.Reset();
+  Lights.Reset();
+}
+
+void FUESynthSceneContext::IndexCameras(UWorld* World) {
+  // One class-filtered walk per world; spawn/destroy handlers keep the index current afterwards.
+  for (TActorIterator<ACameraActor> It(World); It; ++It) {
+    AddCamera(*It);
+  }
+}
+
+void FUESynthSceneContext::AddCamera(ACameraActor* Camera) {
+  NamedCameras.Add(Camera->GetFName(), Camera);
+#if WITH_EDITOR
+  const FString Label = Camera->GetActorLabel();
+  if (!Label.IsEmpty()) {
+    NamedCameras.Add(FName(*Label), Camera);
+  }
+#endif
+
+  if (!DefaultCamera.IsValid()) {
+    DefaultCamera = Camera;
+  }
+}
+
+void FUESynthSceneContext::OnPostWorldInitialization(UWorld* World,
+                                                     const UWorld::InitializationValues IVS) {
+  // A new Game or PIE world may take precedence over the cached one; resolve again lazily.
+  // Preview and inactive worlds never win, so they don't need to drop the cache.
+  if (!bIsSession && World &&
+      (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE ||
+       World->WorldType == EWorldType::Editor)) {
+    Invalidate();
+  }
+}
+
+void FUESynthSceneContext::OnWorldCleanup(UWorld* World, bool bSessionEnded,
+                                          bool bCleanupResources) {
+  if (World == CachedWorld.Get()) {
+    Invalidate();
+  }
+}
+
+void FUESynthSceneContext::OnActorSpawned(AActor* Actor) {
+  Actors.AddActor(Actor);
+  if (ACameraActor* Camera = Cast<ACameraActor>(Actor)) {
+    AddCamera(Camera);
+  }
+}
+
+void FUESynthSceneContext::OnActorDestroyed(AActor* Actor) {
+  Actors.RemoveActor(Actor);
+  ActorPool.RemoveActor(Actor);
+  Materials.RemoveActor(Actor);
+  Lights.RemoveActor(Actor);
+
+  ACameraActor* Camera = Cast<ACameraActor>(Actor);
+  if (!Camera) {
+    return;
+  }
+
+  for (auto It = NamedCameras.CreateIterator(); It; ++It) {
+    if (It->Value.Get() == Camera) {
+      It.RemoveCurrent();
+    }
+  }
+  if (DefaultCamera.Get() == Camera) {
+    DefaultCamera.Reset();
+  }
+  Cameras.RemoveActor(Camera);
+}
+
+void FUESynthSceneContext::OnLevelAddedToWorld(ULevel* Level, UWorld* World) {
+  // Streamed-in actors don't go through the spawn handler.
+  if (World && World == CachedWorld.Get()) {
+    Actors.AddLevel(Level);
+  }
+}
+
+void FUESynthSceneContext::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World) {
+  if (World && World == CachedWorld.Get()) {
+    Actors.RemoveLevel(Level);
+  }
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UESynthActorPool.h"
+#include "UESynthActorRegistry.h"
+#include "UESynthCameraPool.h"
+#include "UESynthLightRegistry.h"
+#include "UESynthMaterialCache.h"
+#include "Engine/World.h"
+#include "UObject/WeakObjectPtr.h"
+
+class ACameraActor;
+class AActor;
+class ULevel;
+class UGameViewportClient;
+
+/**
+ * Cached resolution of the world, viewport client and cameras that the handlers operate on.
+ *
+ * Resolving the target world means scanning every world context, and finding a camera used to walk
+ * every actor in the level on every call. Both are now resolved once and kept as weak pointers. The
+ * cache is invalidated from the world init/cleanup delegates and kept current by the world's
+ * actor spawn/destroy handlers and level streaming, so hot-path lookups are O(1). Game thread only.
+ *
+ * A client session has a context of its own, bound to the session's world, with its own cameras
+ * and actor IDs; Get() returns it while one of the session's commands runs, see FActiveScope.
+ */
+class FUESynthSceneContext
+{
+public:
+  /** The module's context, which follows the engine's Game, PIE or editor world. */
+  FUESynthSceneContext();
+  /** A context that only ever acts on SessionWorld, which is not rendered by any viewport. */
+  explicit FUESynthSceneContext(UWorld* SessionWorld);
+  ~FUESynthSceneContext();
+
+  FUESynthSceneContext(const FUESynthSceneContext&) = delete;
+  FUESynthSceneContext& operator=(const FUESynthSceneContext&) = delete;
+
+  /**
+   * The context handlers act on: the active session's, or else the module-owned one. Only valid
+   * while the UESynth module is loaded.
+   */
+  static FUESynthSceneContext& Get();
+
+  /** Makes a context what Get() returns until the scope ends; null keeps the module's. */
+  class FActiveScope
+  {
+  public:
+    explicit FActiveScope(FUESynthSceneContext* Context);
+    ~FActiveScope();
+
+  private:
+    FUESynthSceneContext* Previous;
+  };
+
+  /**
+   * The world handlers act on: the session's world, or else the first Game world, then the PIE
+   * world, then any world.
+   */
+  UWorld* GetWorld();
+
+  /**
+   * The game viewport client that renders GetWorld(), if there is one; never for a session or
+   * while headless.
+   */
+  UGameViewportClient* GetViewportClient();
+
+  /**
+   * Headless, the game viewport stops drawing the world and captures of the game view are
+   * rendered by GetHeadlessView instead, so an instance only spends GPU time on the frames that
+   * are read back.
+   */
+  void SetHeadless(bool bInHeadless) {
+    bHeadless = bInHeadless;
+  }
+
+  /**
+   * The pooled camera that renders the game view where no viewport does: a server without a game
+   * viewport or a headless one, and a session. It is created on first use, at the -ResX/-ResY
+   * size of the command line or else DefaultResolution, and moved to the first player's view
+   * point (or the default camera's without one) each time it is asked for. None without a world.
+   */
+  FName GetHeadlessView();
+
+  /** Finds a camera by actor name (or editor label); an empty name returns the default camera. */
+  ACameraActor* FindCamera(const FString& CameraName);
+
+  /** The name index of every actor in GetWorld(); empty when there is no world. */
+  FUESynthActorRegistry& GetActors();
+
+  /** The cameras created through CreateCamera in GetWorld(); emptied when the world goes away. */
+  FUESynthCameraPool& GetCameras();
+
+  /** Actors parked by DestroyObject for pooled spawns in GetWorld(); emptied with the cameras. */
+  FUESynthActorPool& GetActorPool();
+
+  /** The MIDs material updates write into, per actor of GetWorld(). */
+  FUESynthMaterialCache& GetMaterials();
+
+  /** The light components lighting updates resolved, per actor of GetWorld(). */
+  FUESynthLightRegistry& GetLights();
+
+  /** Drops every cached pointer; the next lookup resolves from scratch. */
+  void Invalidate();
+
+private:
+  UWorld* ResolveWorld() const;
+  static UGameViewportClient* ResolveViewportClient(UWorld* World);
+
+  void BindWorld(UWorld* World);
+  void UnbindWorld();
+  void IndexCameras(UWorld* World);
+  void AddCamera(ACameraActor* Camera);
+
+  void OnPostWorldInitialization(UWorld* World, const UWorld::InitializationValues IVS);
+  void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+  void OnActorSpawned(AActor* Actor);
+  void OnActorDestroyed(AActor* Actor);
+  void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+  void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+  void BindDelegates();
+
+  // Set for a session context, which never resolves any other world.
+  TWeakObjectPtr<UWorld> SessionWorld;
+  bool bIsSession = false;
+  bool bHeadless = false;
+
+  TWeakObjectPtr<UWorld> CachedWorld;
+  TWeakObjectPtr<UGameViewportClient> CachedViewportClient;
+  TWeakObjectPtr<ACameraActor> DefaultCamera;
+  TMap<FName, TWeakObjectPtr<ACameraActor>> NamedCameras;
+  FUESynthActorRegistry Actors;
+  FUESynthCameraPool Cameras;
+  FUESynthActorPool ActorPool;
+  FUESynthMaterialCache Materials;
+  FUESynthLightRegistry Lights;
+
+  FDelegateHandle PostWorldInitializationHandle;
+  FDelegateHandle WorldCleanupHandle;
+  FDelegateHandle LevelAddedHandle;
+  FDelegateHandle LevelRemovedHandle;
+  FDelegateHandle ActorSpawnedHandle;
+  FDelegateHandle ActorDestroyedHandle;
+
+  static FUESynthSceneContext* Instance;
+  static FUESynthSceneContext* Active;
+};
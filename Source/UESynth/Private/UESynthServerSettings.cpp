@@ -0,0 +1,204 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthServerSettings.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Parse.h"
+#include <grpcpp/resource_quota.h>
+
+namespace
+{
+
+/** The integer settings, by the key they go by in the ini and on the command line. */
+struct FIntSetting
+{
+  const TCHAR* Key;
+  int32 FUESynthServerSettings::*Value;
+};
+
+const FIntSetting IntSettings[] = {
+    {TEXT("CompletionQueueThreads"), &FUESynthServerSettings::CompletionQueueThreads},
+    {TEXT("SyncServerMaxThreads"), &FUESynthServerSettings::SyncServerMaxThreads},
+    {TEXT("MaxReceiveMessageSize"), &FUESynthServerSettings::MaxReceiveMessageSize},
+    {TEXT("MaxSendMessageSize"), &FUESynthServerSettings::MaxSendMessageSize},
+    {TEXT("Http2StreamWindowSize"), &FUESynthServerSettings::Http2StreamWindowSize},
+    {TEXT("Http2MaxFrameSize"), &FUESynthServerSettings::Http2MaxFrameSize},
+    {TEXT("KeepaliveTimeMs"), &FUESynthServerSettings::KeepaliveTimeMs},
+    {TEXT("KeepaliveTimeoutMs"), &FUESynthServerSettings::KeepaliveTimeoutMs},
+    {TEXT("MinClientPingIntervalMs"), &FUESynthServerSettings::MinClientPingIntervalMs},
+    {TEXT("MetricsPort"), &FUESynthServerSettings::MetricsPort},
+    {TEXT("PortRangeSize"), &FUESynthServerSettings::PortRangeSize},
+};
+
+bool ParseCompression(const FString& Name, grpc_compression_algorithm* Out) {
+  if (Name.Equals(TEXT("none"), ESearchCase::IgnoreCase)) {
+    *Out = GRPC_COMPRESS_NONE;
+  } else if (Name.Equals(TEXT("deflate"), ESearchCase::IgnoreCase)) {
+    *Out = GRPC_COMPRESS_DEFLATE;
+  } else if (Name.Equals(TEXT("gzip"), ESearchCase::IgnoreCase)) {
+    *Out = GRPC_COMPRESS_GZIP;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/** The host of a host:port address. */
+FString GetHost(const FString& Address) {
+  int32 Colon = INDEX_NONE;
+  return Address.FindLastChar(TEXT(':'), Colon) ? Address.Left(Colon) : Address;
+}
+
+} // namespace
+
+FUESynthServerSettings FUESynthServerSettings::Load() {
+  FUESynthServerSettings Settings;
+  Settings.LoadConfig(GEngineIni);
+  Settings.ParseCommandLine(FCommandLine::Get());
+  return Settings;
+}
+
+void FUESynthServerSettings::LoadConfig(const FString& IniFile) {
+  if (!GConfig) {
+    return;
+  }
+  GConfig->GetString(ConfigSection, TEXT("ListenAddress"), ListenAddress, IniFile);
+  GConfig->GetBool(ConfigSection, TEXT("bSyncServer"), bSyncServer, IniFile);
+  GConfig->GetString(ConfigSection, TEXT("Compression"), Compression, IniFile);
+  GConfig->GetString(ConfigSection, TEXT("RegistrationDir"), RegistrationDir, IniFile);
+  int32 Port = 0;
+  if (GConfig->GetInt(ConfigSection, TEXT("Port"), Port, IniFile)) {
+    SetPort(Port);
+  }
+  for (const FIntSetting& Setting : IntSettings) {
+    GConfig->GetInt(ConfigSection, Setting.Key, this->*Setting.Value, IniFile);
+  }
+}
+
+void FUESynthServerSettings::ParseCommandLine(const TCHAR* CommandLine) {
+  FParse::Value(CommandLine, TEXT("UESynthListenAddress="), ListenAddress);
+  FParse::Value(CommandLine, TEXT("UESynthCompression="), Compression);
+  FParse::Value(CommandLine, TEXT("UESynthRegistrationDir="), RegistrationDir);
+  int32 Port = 0;
+  if (FParse::Value(CommandLine, TEXT("UESynthPort="), Port)) {
+    SetPort(Port);
+  }
+  if (FParse::Param(CommandLine, TEXT("UESynthSyncServer"))) {
+    bSyncServer = true;
+  }
+  // Kept from before the settings existed
+  FParse::Value(CommandLine, TEXT("UESynthCQThreads="), CompletionQueueThreads);
+  for (const FIntSetting& Setting : IntSettings) {
+    FParse::Value(CommandLine, *FString::Printf(TEXT("UESynth%s="), Setting.Key),
+                  this->*Setting.Value);
+  }
+}
+
+bool FUESynthServerSettings::Validate(FString* OutError) const {
+  grpc_compression_algorithm Algorithm;
+  const int32 Port = GetPort();
+  if (ListenAddress.IsEmpty() || !ListenAddress.Contains(TEXT(":"))) {
+    *OutError = FString::Printf(TEXT("ListenAddress '%s' is not host:port"), *ListenAddress);
+  } else if (PortRangeSize < 1 ||
+             (PortRangeSize > 1 && (Port < 0 || Port + PortRangeSize - 1 > 65535))) {
+    *OutError = FString::Printf(TEXT("PortRangeSize %d from port %d goes past 65535"),
+                                PortRangeSize, Port);
+  } else if (CompletionQueueThreads < 1 || SyncServerMaxThreads < 0) {
+    *OutError = TEXT("thread counts must be positive");
+  } else if (MaxReceiveMessageSize == 0 || MaxReceiveMessageSize < -1 ||
+             MaxSendMessageSize == 0 || MaxSendMessageSize < -1) {
+    *OutError = TEXT("message sizes must be positive, or -1 for no limit");
+  } else if (Http2StreamWindowSize < 0 || Http2MaxFrameSize < 0 || KeepaliveTimeMs < 0 ||
+             KeepaliveTimeoutMs < 0 || MinClientPingIntervalMs < 0) {
+    *OutError = TEXT("HTTP/2 and keepalive settings can't be negative");
+  } else if (MetricsPort < 0 || MetricsPort > 65535) {
+    *OutError = FString::Printf(TEXT("MetricsPort %d is not a port"), MetricsPort);
+  } else if (!ParseCompression(Compression, &Algorithm)) {
+    *OutError = FString::Printf(TEXT("unknown Compression '%s'"), *Compression);
+  } else {
+    return true;
+  }
+  return false;
+}
+
+void FUESynthServerSettings::Apply(grpc::ServerBuilder& Builder, int32 PortOffset,
+                                   int* OutSelectedPort) const {
+  // Port 0 lets the system pick one, so there is nothing to offset
+  const int32 Port = GetPort();
+  const FString Address =
+      Port > 0 ? FString::Printf(TEXT("%s:%d"), *GetHost(ListenAddress), Port + PortOffset)
+               : ListenAddress;
+  Builder.AddListeningPort(TCHAR_TO_UTF8(*Address), grpc::InsecureServerCredentials(),
+                           OutSelectedPort);
+  if (PortRangeSize > 1) {
+    // Otherwise Linux lets a second instance bind a port the first one holds and splits the
+    // connections between them
+    Builder.AddChannelArgument(GRPC_ARG_ALLOW_REUSEPORT, 0);
+  }
+  Builder.SetMaxReceiveMessageSize(MaxReceiveMessageSize);
+  Builder.SetMaxSendMessageSize(MaxSendMessageSize);
+
+  if (Http2StreamWindowSize > 0) {
+    Builder.AddChannelArgument(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES, Http2StreamWindowSize);
+    Builder.AddChannelArgument(GRPC_ARG_HTTP2_BDP_PROBE, 0);
+  }
+  if (Http2MaxFrameSize > 0) {
+    Builder.AddChannelArgument(GRPC_ARG_HTTP2_MAX_FRAME_SIZE, Http2MaxFrameSize);
+  }
+  if (KeepaliveTimeMs > 0) {
+    Builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIME_MS, KeepaliveTimeMs);
+    Builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+  }
+  if (KeepaliveTimeoutMs > 0) {
+    Builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, KeepaliveTimeoutMs);
+  }
+  if (MinClientPingIntervalMs > 0) {
+    Builder.AddChannelArgument(GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS,
+                               MinClientPingIntervalMs);
+  }
+  if (bSyncServer && SyncServerMaxThreads > 0) {
+    grpc::ResourceQuota Quota("uesynth_sync_server");
+    Quota.SetMaxThreads(SyncServerMaxThreads);
+    Builder.SetResourceQuota(Quota);
+  }
+
+  grpc_compression_algorithm Algorithm = GRPC_COMPRESS_NONE;
+  ParseCompression(Compression, &Algorithm);
+  if (Algorithm != GRPC_COMPRESS_NONE) {
+    Builder.SetDefaultCompressionAlgorithm(Algorithm);
+  }
+}
+
+std::unique_ptr<grpc::Server>
+FUESynthServerSettings::BuildAndStart(TFunctionRef<void(grpc::ServerBuilder&)> Setup,
+                                      FString* OutAddress) const {
+  const int32 NumTries = GetPort() > 0 ? PortRangeSize : 1;
+  for (int32 Offset = 0; Offset < NumTries; ++Offset) {
+    grpc::ServerBuilder Builder;
+    int SelectedPort = 0;
+    Apply(Builder, Offset, &SelectedPort);
+    Setup(Builder);
+    std::unique_ptr<grpc::Server> Server = Builder.BuildAndStart();
+    if (Server) {
+      *OutAddress = GetPort() >= 0 ? FString::Printf(TEXT("%s:%d"), *GetHost(ListenAddress),
+                                                     SelectedPort)
+                                   : ListenAddress;
+      return Server;
+    }
+  }
+  return nullptr;
+}
+
+int32 FUESynthServerSettings::GetPort() const {
+  int32 Colon = INDEX_NONE;
+  if (!ListenAddress.FindLastChar(TEXT(':'), Colon)) {
+    return -1;
+  }
+  const FString Port = ListenAddress.Mid(Colon + 1);
+  return Port.IsNumeric() ? FCString::Atoi(*Port) : -1;
+}
+
+void FUESynthServerSettings::SetPort(int32 Port) {
+  ListenAddress = FString::Printf(TEXT("%s:%d"), *GetHost(ListenAddress), Port);
+}
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <grpcpp/grpcpp.h>
+#include <memory>
+
+/**
+ * How the gRPC server listens and what it lets through.
+ *
+ * Every value comes from the [UESynth.Server] section of the engine ini, e.g. the project's
+ * DefaultEngine.ini, and can be overridden on the command line as -UESynth<Key>=<Value>, e.g.
+ * -UESynthListenAddress=127.0.0.1:50052 or -UESynthMaxSendMessageSize=-1. -UESynthPort=N only
+ * replaces the port of the listen address, so several editors can share a host, and with
+ * -UESynthPortRangeSize=N instances started alike each take the first free port of a range instead.
+ * Everything here ends up on the grpc::ServerBuilder through Apply; zero leaves gRPC's own default.
+ */
+struct FUESynthServerSettings
+{
+  static constexpr const TCHAR* ConfigSection = TEXT("UESynth.Server");
+  static constexpr int32 DefaultCompletionQueueThreads = 2;
+  /** Room for a 4K float capture request or a large batch, well above gRPC's 4 MB. */
+  static constexpr int32 DefaultMaxReceiveMessageSize = 64 << 20;
+
+  /** host:port the server binds. */
+  FString ListenAddress = TEXT("0.0.0.0:50051");
+
+  /**
+   * Ports tried from ListenAddress's on until one is free, so a fleet of instances can share one
+   * set of settings; 1 only tries ListenAddress.
+   */
+  int32 PortRangeSize = 1;
+
+  /**
+   * Where each instance writes uesynth-<pid>.json, with the address it bound, while it serves;
+   * relative paths are under the project's Saved directory. Empty writes nothing.
+   */
+  FString RegistrationDir;
+
+  /** Run the legacy thread-per-call server instead of the completion-queue one. */
+  bool bSyncServer = false;
+
+  /** Polling threads of the async server, one completion queue each. */
+  int32 CompletionQueueThreads = DefaultCompletionQueueThreads;
+
+  /** Most threads the sync server's pool may grow to; 0 for no cap. */
+  int32 SyncServerMaxThreads = 0;
+
+  /** Largest message accepted or sent, in bytes; -1 for no limit. */
+  int32 MaxReceiveMessageSize = DefaultMaxReceiveMessageSize;
+  int32 MaxSendMessageSize = -1;
+
+  /** HTTP/2 flow-control window per stream, in bytes; a fixed window turns off BDP probing. */
+  int32 Http2StreamWindowSize = 0;
+  int32 Http2MaxFrameSize = 0;
+
+  /** Milliseconds between keepalive pings to idle clients, and how long to wait for the ack. */
+  int32 KeepaliveTimeMs = 0;
+  int32 KeepaliveTimeoutMs = 0;
+
+  /** Shortest interval between the pings of a client without calls before it is cut off. */
+  int32 MinClientPingIntervalMs = 0;
+
+  /** Port of the Prometheus /metrics endpoint; 0 leaves it off. */
+  int32 MetricsPort = 0;
+
+  /** Compression of responses, unless a call asks otherwise: none, deflate or gzip. */
+  FString Compression = TEXT("none");
+
+  /** The settings of this process: defaults, then the engine ini, then the command line. */
+  static FUESynthServerSettings Load();
+
+  /** Reads the keys present in ConfigSection of IniFile. */
+  void LoadConfig(const FString& IniFile);
+
+  /** Reads the -UESynth<Key>=<Value> overrides in CommandLine. */
+  void ParseCommandLine(const TCHAR* CommandLine);
+
+  /** Whether every value is usable; otherwise OutError says which is not. */
+  bool Validate(FString* OutError) const;
+
+  /**
+   * Adds the listening port, PortOffset ports past ListenAddress's, and every option to Builder.
+   * OutSelectedPort is set to the port bound once the server is built. Only call on valid
+   * settings.
+   */
+  void Apply(grpc::ServerBuilder& Builder, int32 PortOffset = 0,
+             int* OutSelectedPort = nullptr) const;
+
+  /**
+   * Builds and starts a server on the first free port of the range. gRPC only reports a taken
+   * port by failing to build, so each try starts from a fresh builder that Setup registers the
+   * services and completion queues on. OutAddress is set to the host:port bound.
+   */
+  std::unique_ptr<grpc::Server> BuildAndStart(TFunctionRef<void(grpc::ServerBuilder&)> Setup,
+                                              FString* OutAddress) const;
+
+  /** The port of ListenAddress, or -1 if it has none. */
+  int32 GetPort() const;
+
+private:
+  void SetPort(int32 Port);
+};
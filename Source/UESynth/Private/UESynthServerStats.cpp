@@ -0,0 +1,311 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthServerStats.h"
+#include "UESynthCommandQueue.h"
+#include <cstdio>
+
+namespace
+{
+
+void AppendNumber(std::string& Out, double Value) {
+  char Buffer[32];
+  std::snprintf(Buffer, sizeof(Buffer), "%.9g", Value);
+  Out += Buffer;
+}
+
+/** Label values are method and stage names, but quotes and backslashes would break a line. */
+void AppendLabel(std::string& Out, const char* Label, const std::string& Value) {
+  Out += Label;
+  Out += "=\"";
+  for (const char Char : Value) {
+    if (Char == '"' || Char == '\\') {
+      Out += '\\';
+    }
+    Out += Char == '\n' ? ' ' : Char;
+  }
+  Out += '"';
+}
+
+void AppendHistograms(std::string& Out, const char* Metric, const char* Label, const char* Help,
+                      const google::protobuf::RepeatedPtrField<uesynth::LatencyHistogram>& All) {
+  Out += std::string("# HELP ") + Metric + " " + Help + "\n";
+  Out += std::string("# TYPE ") + Metric + " histogram\n";
+  for (const uesynth::LatencyHistogram& Histogram : All) {
+    for (int32 Index = 0; Index < Histogram.buckets_size(); ++Index) {
+      Out += Metric;
+      Out += "_bucket{";
+      AppendLabel(Out, Label, Histogram.name());
+      Out += ",le=\"";
+      if (Index < FUESynthServerStats::NumBucketBounds) {
+        AppendNumber(Out, FUESynthServerStats::BucketBounds[Index]);
+      } else {
+        Out += "+Inf";
+      }
+      Out += "\"} " + std::to_string(Histogram.buckets(Index)) + "\n";
+    }
+    Out += Metric;
+    Out += "_sum{";
+    AppendLabel(Out, Label, Histogram.name());
+    Out += "} ";
+    AppendNumber(Out, Histogram.sum_seconds());
+    Out += "\n";
+    Out += Metric;
+    Out += "_count{";
+    AppendLabel(Out, Label, Histogram.name());
+    Out += "} " + std::to_string(Histogram.count()) + "\n";
+  }
+}
+
+void AppendGauge(std::string& Out, const char* Metric, const char* Help, double Value) {
+  Out += std::string("# HELP ") + Metric + " " + Help + "\n";
+  Out += std::string("# TYPE ") + Metric + " gauge\n";
+  Out += Metric;
+  Out += " ";
+  AppendNumber(Out, Value);
+  Out += "\n";
+}
+
+} // namespace
+
+const double FUESynthServerStats::BucketBounds[NumBucketBounds] = {
+    0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025,
+    0.05,   0.1,     0.25,   0.5,   1.0,    2.5,   5.0,  10.0};
+
+void FUESynthServerStats::FHistogram::Record(double Seconds, bool bFailed) {
+  int32 Bucket = 0;
+  while (Bucket < NumBucketBounds && Seconds > BucketBounds[Bucket]) {
+    ++Bucket;
+  }
+  Buckets[Bucket].fetch_add(1, std::memory_order_relaxed);
+  SumNanoseconds.fetch_add(uint64(FMath::Max(Seconds, 0.0) * 1e9), std::memory_order_relaxed);
+  if (bFailed) {
+    Errors.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void FUESynthServerStats::FHistogram::Fill(uesynth::LatencyHistogram* Out) const {
+  // Cumulative, as Prometheus has them; the last bucket doubles as the count, so the two agree
+  // even while calls are being recorded
+  uint64 Cumulative = 0;
+  for (const std::atomic<uint64>& Bucket : Buckets) {
+    Cumulative += Bucket.load(std::memory_order_relaxed);
+    Out->add_buckets(Cumulative);
+  }
+  Out->set_count(Cumulative);
+  Out->set_sum_seconds(double(SumNanoseconds.load(std::memory_order_relaxed)) / 1e9);
+  Out->set_errors(Errors.load(std::memory_order_relaxed));
+  Out->set_p50_seconds(EstimateQuantile(*Out, 0.5));
+  Out->set_p99_seconds(EstimateQuantile(*Out, 0.99));
+}
+
+void FUESynthServerStats::FHistogram::Reset() {
+  for (std::atomic<uint64>& Bucket : Buckets) {
+    Bucket = 0;
+  }
+  SumNanoseconds = 0;
+  Errors = 0;
+}
+
+FUESynthServerStats::FUESynthServerStats() : StartSeconds(FPlatformTime::Seconds()) {}
+
+FUESynthServerStats& FUESynthServerStats::Get() {
+  static FUESynthServerStats Stats;
+  return Stats;
+}
+
+void FUESynthServerStats::RecordCall(FName Rpc, double Seconds, bool bFailed) {
+  FHistogram* Histogram = nullptr;
+  {
+    FReadScopeLock Lock(RpcsLock);
+    if (const TUniquePtr<FHistogram>* Found = Rpcs.Find(Rpc)) {
+      Histogram = Found->Get();
+    }
+  }
+  if (!Histogram) {
+    FWriteScopeLock Lock(RpcsLock);
+    TUniquePtr<FHistogram>& Added = Rpcs.FindOrAdd(Rpc);
+    if (!Added) {
+      Added = MakeUnique<FHistogram>();
+    }
+    Histogram = Added.Get();
+  }
+  Histogram->Record(Seconds, bFailed);
+}
+
+void FUESynthServerStats::Fill(uesynth::ServerStats* Out) const {
+  for (const double Bound : BucketBounds) {
+    Out->add_bucket_bounds_seconds(Bound);
+  }
+
+  TArray<TPair<FString, const FHistogram*>> Sorted;
+  {
+    FReadScopeLock Lock(RpcsLock);
+    Sorted.Reserve(Rpcs.Num());
+    for (const TPair<FName, TUniquePtr<FHistogram>>& Pair : Rpcs) {
+      Sorted.Emplace(Pair.Key.ToString(), Pair.Value.Get());
+    }
+  }
+  Sorted.Sort([](const TPair<FString, const FHistogram*>& A,
+                 const TPair<FString, const FHistogram*>& B) { return A.Key < B.Key; });
+  for (const TPair<FString, const FHistogram*>& Pair : Sorted) {
+    uesynth::LatencyHistogram* Histogram = Out->add_rpcs();
+    Histogram->set_name(TCHAR_TO_UTF8(*Pair.Key));
+    Pair.Value->Fill(Histogram);
+  }
+  for (int32 Stage = 0; Stage < int32(EUESynthStage::Num); ++Stage) {
+    uesynth::LatencyHistogram* Histogram = Out->add_stages();
+    Histogram->set_name(GetStageName(EUESynthStage(Stage)));
+    Stages[Stage].Fill(Histogram);
+  }
+
+  if (FUESynthCommandQueue::IsAvailable()) {
+    const FUESynthCommandQueue& Queue = FUESynthCommandQueue::Get();
+    Out->set_command_queue_depth(Queue.GetNumPending());
+    Out->set_peak_command_queue_depth(Queue.GetPeakPending());
+    Out->set_held_commands(Queue.GetNumHeld());
+  }
+  Out->set_open_streams(GetOpenStreams());
+  Out->set_calls_in_flight(GetCallsInFlight());
+  Out->set_uptime_seconds(FPlatformTime::Seconds() - StartSeconds);
+  Out->set_dropped_work(DroppedWork.load(std::memory_order_relaxed));
+}
+
+void FUESynthServerStats::Reset() {
+  {
+    FReadScopeLock Lock(RpcsLock);
+    for (const TPair<FName, TUniquePtr<FHistogram>>& Pair : Rpcs) {
+      Pair.Value->Reset();
+    }
+  }
+  for (FHistogram& Stage : Stages) {
+    Stage.Reset();
+  }
+  DroppedWork = 0;
+  if (FUESynthCommandQueue::IsAvailable()) {
+    FUESynthCommandQueue::Get().ResetPeakPending();
+  }
+}
+
+FName FUESynthServerStats::GetActionName(const uesynth::ActionRequest& Request) {
+  // Built once, so timing an action costs a lookup rather than a string
+  static const TMap<int32, FName> Names = []() {
+    TMap<int32, FName> Out;
+    const google::protobuf::OneofDescriptor* Action =
+        uesynth::ActionRequest::descriptor()->FindOneofByName("action");
+    for (int32 Index = 0; Action && Index < Action->field_count(); ++Index) {
+      const google::protobuf::FieldDescriptor* Field = Action->field(Index);
+      Out.Add(Field->number(), FName(*FString::Printf(TEXT("ControlStream/%s"),
+                                                      UTF8_TO_TCHAR(Field->name().c_str()))));
+    }
+    return Out;
+  }();
+  const FName* Name = Names.Find(int32(Request.action_case()));
+  return Name ? *Name : FName(TEXT("ControlStream/none"));
+}
+
+std::string FUESynthServerStats::ToPrometheusText(const uesynth::ServerStats& Stats) {
+  std::string Out;
+  AppendHistograms(Out, "uesynth_rpc_duration_seconds", "rpc",
+                   "Time from a call's arrival until it was answered.", Stats.rpcs());
+  Out += "# HELP uesynth_rpc_errors_total Calls answered with a non-OK status.\n";
+  Out += "# TYPE uesynth_rpc_errors_total counter\n";
+  for (const uesynth::LatencyHistogram& Histogram : Stats.rpcs()) {
+    Out += "uesynth_rpc_errors_total{";
+    AppendLabel(Out, "rpc", Histogram.name());
+    Out += "} " + std::to_string(Histogram.errors()) + "\n";
+  }
+  Out += "# HELP uesynth_dropped_work_total Work skipped because its call was cancelled.\n";
+  Out += "# TYPE uesynth_dropped_work_total counter\n";
+  Out += "uesynth_dropped_work_total " + std::to_string(Stats.dropped_work()) + "\n";
+  AppendHistograms(Out, "uesynth_stage_duration_seconds", "stage",
+                   "Time spent in each stage of handling calls.", Stats.stages());
+
+  AppendGauge(Out, "uesynth_command_queue_depth", "Commands waiting for the game thread.",
+              Stats.command_queue_depth());
+  AppendGauge(Out, "uesynth_command_queue_peak_depth",
+              "Most commands that have waited for the game thread at once.",
+              Stats.peak_command_queue_depth());
+  AppendGauge(Out, "uesynth_held_commands", "Captures waiting for a render and what follows.",
+              Stats.held_commands());
+  AppendGauge(Out, "uesynth_open_streams", "Open ControlStream calls.", Stats.open_streams());
+  AppendGauge(Out, "uesynth_calls_in_flight", "Calls and stream actions not answered yet.",
+              Stats.calls_in_flight());
+  AppendGauge(Out, "uesynth_uptime_seconds", "Seconds since the server started.",
+              Stats.uptime_seconds());
+  return Out;
+}
+
+double FUESynthServerStats::EstimateQuantile(const uesynth::LatencyHistogram& Histogram,
+                                             double Quantile) {
+  const int32 NumBuckets = FMath::Min(Histogram.buckets_size(), NumBucketBounds + 1);
+  if (NumBuckets == 0 || Histogram.count() == 0) {
+    return 0.0;
+  }
+  const double Rank = Quantile * double(Histogram.count());
+  uint64 Below = 0;
+  for (int32 Index = 0; Index < NumBuckets; ++Index) {
+    const uint64 Cumulative = Histogram.buckets(Index);
+    if (double(Cumulative) >= Rank && Cumulative > Below) {
+      if (Index == NumBucketBounds) {
+        // Past the last bound there is nothing to interpolate towards
+        return BucketBounds[NumBucketBounds - 1];
+      }
+      const double Lower = Index > 0 ? BucketBounds[Index - 1] : 0.0;
+      const double Upper = BucketBounds[Index];
+      return Lower + (Upper - Lower) * (Rank - double(Below)) / double(Cumulative - Below);
+    }
+    Below = Cumulative;
+  }
+  return BucketBounds[NumBucketBounds - 1];
+}
+
+const char* FUESynthServerStats::GetStageName(EUESynthStage Stage) {
+  switch (Stage) {
+  case EUESynthStage::QueueWait:
+    return "queue_wait";
+  case EUESynthStage::GameThread:
+    return "game_thread";
+  case EUESynthStage::Readback:
+    return "readback";
+  case EUESynthStage::PixelConvert:
+    return "pixel_convert";
+  case EUESynthStage::Encode:
+    return "encode";
+  case EUESynthStage::Write:
+    return "write";
+  default:
+    return "unknown";
+  }
+}
+
+FUESynthCallTimer::FUESynthCallTimer(FName InRpc)
+    : Rpc(InRpc), ArrivedSeconds(FPlatformTime::Seconds()) {
+  FUESynthServerStats::Get().OnCallStarted();
+}
+
+FUESynthCallTimer::FUESynthCallTimer(FUESynthCallTimer&& Other)
+    : Rpc(Other.Rpc), ArrivedSeconds(Other.ArrivedSeconds), bActive(Other.bActive) {
+  Other.bActive = false;
+}
+
+FUESynthCallTimer::~FUESynthCallTimer() {
+  if (bActive) {
+    FUESynthServerStats::Get().OnCallFinished();
+  }
+}
+
+void FUESynthCallTimer::OnStarted() const {
+  FUESynthServerStats::Get().RecordStage(EUESynthStage::QueueWait,
+                                         FPlatformTime::Seconds() - ArrivedSeconds);
+}
+
+void FUESynthCallTimer::OnFinished(const grpc::Status& Status) {
+  if (!bActive) {
+    return;
+  }
+  bActive = false;
+  FUESynthServerStats& Stats = FUESynthServerStats::Get();
+  Stats.RecordCall(Rpc, FPlatformTime::Seconds() - ArrivedSeconds, !Status.ok());
+  Stats.OnCallFinished();
+}
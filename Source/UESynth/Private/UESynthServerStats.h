@@ -0,0 +1,176 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "pb/uesynth.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <string>
+
+DECLARE_STATS_GROUP(TEXT("UESynth"), STATGROUP_UESynth, STATCAT_Advanced);
+
+/** The stages a call's time is split into; see ServerStats.stages in the proto. */
+enum class EUESynthStage : uint8
+{
+  /** Queued until the game thread picked the command up. */
+  QueueWait,
+  /** Running a handler on the game thread. */
+  GameThread,
+  /** From a capture request until its pixels are mapped: the render, then the GPU copy. */
+  Readback,
+  /** Converting mapped pixels into a message, while they are mapped. */
+  PixelConvert,
+  /** JPEG, PNG or lossless compression of one image. */
+  Encode,
+  /** Serializing a message and handing it to the socket. */
+  Write,
+  Num
+};
+
+/**
+ * Server-wide latency histograms and queue gauges, for GetServerStats and the metrics endpoint.
+ *
+ * Every call is timed from arrival until it is answered, in a histogram per RPC method or stream
+ * action, and the hot paths record how long each stage took, so a slow capture shows whether it
+ * waited for the game thread, the GPU, pixel conversion or the socket. Recording takes no lock
+ * once a histogram exists and is safe from any thread; the trace scopes next to it show the same
+ * stages in Unreal Insights.
+ *
+ * Unlike the other server singletons this one outlives the module, as encoders and completion
+ * queues may still finish work while it shuts down.
+ */
+class FUESynthServerStats
+{
+public:
+  /** Upper bounds of the histogram buckets in seconds; one more bucket counts everything. */
+  static constexpr int32 NumBucketBounds = 16;
+  static const double BucketBounds[NumBucketBounds];
+
+  /** Durations of one RPC or stage; lock-free. */
+  class FHistogram
+  {
+  public:
+    void Record(double Seconds, bool bFailed = false);
+    void Fill(uesynth::LatencyHistogram* Out) const;
+    void Reset();
+
+  private:
+    std::atomic<uint64> Buckets[NumBucketBounds + 1] = {};
+    std::atomic<uint64> SumNanoseconds{0};
+    std::atomic<uint64> Errors{0};
+  };
+
+  static FUESynthServerStats& Get();
+
+  /** Records a call of Rpc that took Seconds from arrival to answer. */
+  void RecordCall(FName Rpc, double Seconds, bool bFailed);
+  void RecordStage(EUESynthStage Stage, double Seconds) {
+    Stages[int32(Stage)].Record(Seconds);
+  }
+
+  void OnCallStarted() {
+    ++CallsInFlight;
+  }
+  void OnCallFinished() {
+    --CallsInFlight;
+  }
+  void OnStreamOpened() {
+    ++OpenStreams;
+  }
+  void OnStreamClosed() {
+    --OpenStreams;
+  }
+  int32 GetCallsInFlight() const {
+    return FMath::Max(CallsInFlight.load(), 0);
+  }
+  int32 GetOpenStreams() const {
+    return FMath::Max(OpenStreams.load(), 0);
+  }
+  /** Some work was skipped because its call had been cancelled; see FUESynthCancellation. */
+  void OnWorkDropped() {
+    DroppedWork.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /** A snapshot of every histogram and gauge, the command queue's included. Any thread. */
+  void Fill(uesynth::ServerStats* Out) const;
+
+  /** Starts every histogram and counter over; the gauges stay. */
+  void Reset();
+
+  /** The histogram name of a stream action, "ControlStream/<action field>". */
+  static FName GetActionName(const uesynth::ActionRequest& Request);
+
+  /** Stats in the Prometheus text exposition format. */
+  static std::string ToPrometheusText(const uesynth::ServerStats& Stats);
+
+  /** The value below which Quantile of a histogram's observations lie, from its buckets. */
+  static double EstimateQuantile(const uesynth::LatencyHistogram& Histogram, double Quantile);
+
+  static const char* GetStageName(EUESynthStage Stage);
+
+private:
+  FUESynthServerStats();
+
+  const double StartSeconds;
+
+  // Histograms are only ever added, so one found under the lock can be recorded into without it
+  mutable FRWLock RpcsLock;
+  TMap<FName, TUniquePtr<FHistogram>> Rpcs;
+  FHistogram Stages[int32(EUESynthStage::Num)];
+
+  std::atomic<int32> CallsInFlight{0};
+  std::atomic<int32> OpenStreams{0};
+  std::atomic<uint64> DroppedWork{0};
+};
+
+/**
+ * Times one call of an RPC or stream action and counts it as in flight. Created when the call
+ * arrives, told when the game thread starts on it and when it was answered; a call dropped
+ * unanswered, e.g. by a shutdown, is only no longer counted.
+ */
+class FUESynthCallTimer
+{
+public:
+  explicit FUESynthCallTimer(FName InRpc);
+  FUESynthCallTimer(FUESynthCallTimer&& Other);
+  ~FUESynthCallTimer();
+
+  FUESynthCallTimer(const FUESynthCallTimer&) = delete;
+  FUESynthCallTimer& operator=(const FUESynthCallTimer&) = delete;
+  FUESynthCallTimer& operator=(FUESynthCallTimer&&) = delete;
+
+  /** Records the call's queue wait; call when its command starts running. */
+  void OnStarted() const;
+
+  /** Records the call's latency. Later calls are ignored. */
+  void OnFinished(const grpc::Status& Status);
+
+private:
+  FName Rpc;
+  double ArrivedSeconds;
+  bool bActive = true;
+};
+
+/** Records the time spent in its scope as Stage. */
+class FUESynthStageScope
+{
+public:
+  explicit FUESynthStageScope(EUESynthStage InStage)
+      : Stage(InStage), StartSeconds(FPlatformTime::Seconds()) {}
+  ~FUESynthStageScope() {
+    FUESynthServerStats::Get().RecordStage(Stage, FPlatformTime::Seconds() - StartSeconds);
+  }
+
+  FUESynthStageScope(const FUESynthStageScope&) = delete;
+  FUESynthStageScope& operator=(const FUESynthStageScope&) = delete;
+
+private:
+  EUESynthStage Stage;
+  double StartSeconds;
+};
@@ -6,217 +6,1399 @@
 #include "Async/TaskGraphInterfaces.h"
 #include "Camera/CameraActor.h"
 #include "Camera/CameraComponent.h"
+#include "Components/LightComponent.h"
 #include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Blueprint.h"
 #include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/Texture.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
-#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
 #include "UESynth.h" // For module access
-#include <future>
+#include "UESynthAssetCache.h"
+#include "UESynthCameraPool.h"
+#include "UESynthCancellation.h"
+#include "UESynthCommandQueue.h"
+#include "UESynthControlStream.h"
+#include "UESynthFrameCapture.h"
+#include "UESynthFrameReadback.h"
+#include "UESynthHealth.h"
+#include "UESynthImageEncoder.h"
+#include "UESynthLockstep.h"
+#include "UESynthMessageArena.h"
+#include "UESynthPixelConvert.h"
+#include "UESynthRecordings.h"
+#include "UESynthSceneContext.h"
+#include "UESynthServerStats.h"
+#include "UESynthSessions.h"
+#include "UESynthSharedMemory.h"
+#include "UESynthSubscriptions.h"
+#include "UESynthTileDelta.h"
+#include "UESynthTransformUtils.h"
+#include "UESynthWriteQueue.h"
+#include <atomic>
 #include <grpcpp/server_builder.h>
-#include <google/protobuf/empty.pb.h>
 
-// Helper to run on game thread
-#define RUN_ON_GAME_THREAD(Code)                                               \
-  AsyncTask(ENamedThreads::GameThread, [=]() { Code });
+namespace {
+
+// How often a handler thread waiting for the game thread looks at whether its
+// client has cancelled
+constexpr double CancellationPollSeconds = 0.01;
+
+// Waits for Future, cancelling Token as soon as the client of context cancels
+// so the game thread drops the call's work instead of finishing it
+grpc::Status WaitForGameThread(const grpc::ServerContext *context,
+                               FUESynthCancellation &Token,
+                               TFuture<grpc::Status> &Future) {
+  if (context) {
+    const FTimespan PollInterval =
+        FTimespan::FromSeconds(CancellationPollSeconds);
+    while (!Future.WaitFor(PollInterval)) {
+      if (context->IsCancelled()) {
+        Token.Cancel();
+      }
+    }
+  }
+  return Future.Get();
+}
 
-// New bidirectional streaming method implementation
-grpc::Status UESynthServiceImpl::ControlStream(
-    grpc::ServerContext *context,
-    grpc::ServerReaderWriter<uesynth::FrameResponse, uesynth::ActionRequest>
-        *stream) {
-  uesynth::ActionRequest request;
-  uesynth::FrameResponse response;
+// Records how long a command waited for the game thread; false, after
+// counting it as dropped, if its call no longer wants it
+bool StartCommand(const FUESynthCancellation &Token, double EnqueuedSeconds) {
+  FUESynthServerStats &Stats = FUESynthServerStats::Get();
+  if (Token.IsCancelled()) {
+    Stats.OnWorkDropped();
+    return false;
+  }
+  Stats.RecordStage(EUESynthStage::QueueWait,
+                    FPlatformTime::Seconds() - EnqueuedSeconds);
+  return true;
+}
 
-  // Continuously read requests from the client stream
-  while (stream->Read(&request)) {
-    // Process the action and generate response
-    grpc::Status status = ProcessAction(request, &response);
+// Helper to run a handler body in the next game-thread drain of the command
+// queue and wait for its status. The body is skipped if the call of context
+// is cancelled or past its deadline by the time the game thread gets to it.
+grpc::Status RunOnGameThread(const grpc::ServerContext *context,
+                             EUESynthCommandKind Kind,
+                             TUniqueFunction<grpc::Status()> Body) {
+  if (IsInGameThread()) {
+    return Body();
+  }
 
-    if (!status.ok()) {
-      // Log error and continue processing other requests
-      UE_LOG(LogTemp, Error, TEXT("Error processing action: %s"),
-             *FString(status.error_message().c_str()));
-      continue;
-    }
+  // Shared, and the body moved along, because the command may still be
+  // inside SetValue when the waiter wakes up and returns
+  TSharedRef<TPromise<grpc::Status>> Promise =
+      MakeShared<TPromise<grpc::Status>>();
+  TFuture<grpc::Status> Future = Promise->GetFuture();
+  const TSharedRef<FUESynthCancellation> Token =
+      FUESynthCancellation::Create(context);
+  const double EnqueuedSeconds = FPlatformTime::Seconds();
+  FUESynthCommandQueue::Get().Enqueue(
+      Kind, [Promise, Body = MoveTemp(Body), Token, EnqueuedSeconds]() mutable {
+        if (!StartCommand(*Token, EnqueuedSeconds)) {
+          Promise->SetValue(Token->GetStatus());
+          return;
+        }
+        FUESynthStageScope GameThreadScope(EUESynthStage::GameThread);
+        FUESynthCancellation::FScope CancellationScope(Token);
+        Promise->SetValue(Body());
+      });
+  return WaitForGameThread(context, *Token, Future);
+}
 
-    // Send response back to client if there's data to send
-    if (response.has_image_response() || response.has_command_response() ||
-        response.has_camera_transform() || response.has_object_transform() ||
-        response.has_objects_list()) {
+// Completes every capture in flight; for game-thread callers that can't wait
+// for the next ticks
+void FlushCaptures() {
+  FUESynthFrameReadback::Get().Flush();
+  if (FUESynthFrameCapture *FrameCapture = FUESynthFrameCapture::Get()) {
+    FrameCapture->Flush();
+  }
+}
 
-      if (!stream->Write(response)) {
-        // Client disconnected or write failed
-        UE_LOG(LogTemp, Warning,
-               TEXT("Failed to write response to client stream"));
-        break;
-      }
+// Same as RunOnGameThread for a body that reports its status through a
+// callback, possibly after the game thread has moved on. A caller that is
+// itself the game thread can't wait for the captures or asset loads to tick,
+// so it flushes them instead.
+grpc::Status RunDeferredOnGameThread(
+    const grpc::ServerContext *context, EUESynthCommandKind Kind,
+    TUniqueFunction<void(UESynthServiceImpl::FReplyCallback &&)> Body) {
+  // Shared, because the callback may still be inside SetValue when the
+  // waiter wakes up and returns
+  TSharedRef<TPromise<grpc::Status>> Promise =
+      MakeShared<TPromise<grpc::Status>>();
+  TFuture<grpc::Status> Future = Promise->GetFuture();
+  const TSharedRef<FUESynthCancellation> Token =
+      FUESynthCancellation::Create(context);
+  // Work dropped along the way fails; say why rather than which stage
+  UESynthServiceImpl::FReplyCallback OnDone =
+      [Promise, Token](const grpc::Status &Status) {
+        Promise->SetValue(!Status.ok() && Token->IsCancelled()
+                              ? Token->GetStatus()
+                              : Status);
+      };
+
+  if (IsInGameThread()) {
+    Body(MoveTemp(OnDone));
+    if (!Future.IsReady()) {
+      FlushAsyncLoading();
+      FlushCaptures();
     }
+    return Future.Get();
+  }
 
-    // Clear response for next iteration
-    response.Clear();
+  const double EnqueuedSeconds = FPlatformTime::Seconds();
+  FUESynthCommandQueue::Get().Enqueue(
+      Kind,
+      [Body = MoveTemp(Body), Token, EnqueuedSeconds,
+       OnDone = MoveTemp(OnDone)]() mutable {
+        if (!StartCommand(*Token, EnqueuedSeconds)) {
+          OnDone(Token->GetStatus());
+          return;
+        }
+        FUESynthStageScope GameThreadScope(EUESynthStage::GameThread);
+        FUESynthCancellation::FScope CancellationScope(Token);
+        Body(MoveTemp(OnDone));
+      });
+  return WaitForGameThread(context, *Token, Future);
+}
+
+// Maps the wire pixel format; false for values this server doesn't know
+bool ToPixelFormat(uesynth::PixelFormat In, UESynthPixels::EFormat *Out) {
+  switch (In) {
+  case uesynth::PIXEL_FORMAT_RGBA8:
+    *Out = UESynthPixels::EFormat::RGBA8;
+    return true;
+  case uesynth::PIXEL_FORMAT_RGB8:
+    *Out = UESynthPixels::EFormat::RGB8;
+    return true;
+  case uesynth::PIXEL_FORMAT_BGR8:
+    *Out = UESynthPixels::EFormat::BGR8;
+    return true;
+  case uesynth::PIXEL_FORMAT_GRAY8:
+    *Out = UESynthPixels::EFormat::Gray8;
+    return true;
+  default:
+    return false;
   }
+}
 
+// Writes mapped viewport pixels into Out in the requested layout, in a single
+// pass that also drops the staging row padding. Returns false for source
+// formats the viewport isn't expected to use.
+bool CopyPixels(const FUESynthMappedFrame &Frame, UESynthPixels::EFormat Format,
+                std::string *Out) {
+  const int32 Width = Frame.Size.X;
+  const int32 Height = Frame.Size.Y;
+  if (!Frame.IsValid() || !UESynthPixels::IsSupportedSource(Frame.Format) ||
+      Frame.RowPitch < Width * 4) {
+    return false;
+  }
+
+  // Sizing is the only fill, none for a recycled buffer; every byte after it
+  // is written exactly once
+  const int32 RowBytes = Width * UESynthPixels::BytesPerPixel(Format);
+  UESynthImageBuffers::Acquire(size_t(RowBytes) * Height, Out);
+  uint8 *Dst = reinterpret_cast<uint8 *>(&(*Out)[0]);
+
+  for (int32 Row = 0; Row < Height; ++Row) {
+    UESynthPixels::ConvertRow(Frame.Format, Format,
+                              Frame.Data + int64(Row) * Frame.RowPitch,
+                              Dst + int64(Row) * RowBytes, Width);
+  }
+  return true;
+}
+
+// Fills Image with Frame converted to Format, labelled FormatName
+bool CopyImage(const FUESynthMappedFrame &Frame, UESynthPixels::EFormat Format,
+               const char *FormatName, uesynth::ImageResponse *Image) {
+  if (!CopyPixels(Frame, Format, Image->mutable_image_data())) {
+    return false;
+  }
+  Image->set_width(Frame.Size.X);
+  Image->set_height(Frame.Size.Y);
+  Image->set_format(FormatName);
+  return true;
+}
+
+// How a request wants its depth sent
+struct FDepthOptions {
+  UESynthPixels::EDepthEncoding Encoding =
+      UESynthPixels::EDepthEncoding::Float32;
+  float Near = UESynthPixels::DefaultDepthNear;
+  float Far = UESynthPixels::DefaultDepthFar;
+};
+
+// Reads the depth fields shared by CaptureRequest and CaptureMultiRequest
+template <typename RequestType>
+grpc::Status GetDepthOptions(const RequestType &request,
+                             FDepthOptions *Options) {
+  switch (request.depth_encoding()) {
+  case uesynth::DEPTH_ENCODING_FLOAT32:
+    Options->Encoding = UESynthPixels::EDepthEncoding::Float32;
+    break;
+  case uesynth::DEPTH_ENCODING_FLOAT16:
+    Options->Encoding = UESynthPixels::EDepthEncoding::Float16;
+    break;
+  case uesynth::DEPTH_ENCODING_UINT16:
+    Options->Encoding = UESynthPixels::EDepthEncoding::UInt16;
+    break;
+  default:
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Unsupported depth_encoding");
+  }
+
+  if (request.depth_near() == 0.0f && request.depth_far() == 0.0f) {
+    return grpc::Status::OK;
+  }
+  if (!(request.depth_far() > request.depth_near())) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "depth_far must be greater than depth_near");
+  }
+  Options->Near = request.depth_near();
+  Options->Far = request.depth_far();
   return grpc::Status::OK;
 }
 
-// Helper method to process individual actions
-grpc::Status
-UESynthServiceImpl::ProcessAction(const uesynth::ActionRequest &request,
-                                  uesynth::FrameResponse *response) {
-  response->set_request_id(request.request_id());
+// Reads one codec field of a request; bColor says whether the images it
+// applies to have a pixel layout JPEG and PNG can take
+grpc::Status GetCodec(uesynth::ImageCodec In, bool bColor,
+                      EUESynthImageCodec *Out) {
+  if (!UESynthImageEncoder::FromWireCodec(In, Out)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Unsupported codec");
+  }
+  if (!bColor && UESynthImageEncoder::IsImageCodec(*Out)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "JPEG and PNG only apply to color images");
+  }
+  return grpc::Status::OK;
+}
 
-  // Handle different action types using switch on oneof case
-  switch (request.action_case()) {
-  case uesynth::ActionRequest::kSetCameraTransform: {
-    uesynth::CommandResponse cmd_response;
-    grpc::Status status = SetCameraTransform(
-        nullptr, &request.set_camera_transform(), &cmd_response);
-    if (status.ok()) {
-      response->mutable_command_response()->CopyFrom(cmd_response);
+int32 GetJpegQuality(uint32 Quality) {
+  return Quality == 0 ? UESynthImageEncoder::DefaultJpegQuality
+                      : int32(FMath::Min<uint32>(Quality, 100));
+}
+
+// How a multi-image request wants its images compressed
+struct FCodecOptions {
+  EUESynthImageCodec Color = EUESynthImageCodec::Raw;
+  EUESynthImageCodec Data = EUESynthImageCodec::Raw;
+  int32 JpegQuality = UESynthImageEncoder::DefaultJpegQuality;
+};
+
+// Reads the codec fields shared by CaptureMultiRequest and
+// CaptureCamerasRequest
+template <typename RequestType>
+grpc::Status GetCodecOptions(const RequestType &request,
+                             FCodecOptions *Options) {
+  grpc::Status Status = GetCodec(request.color_codec(), true, &Options->Color);
+  if (Status.ok()) {
+    Status = GetCodec(request.data_codec(), false, &Options->Data);
+  }
+  Options->JpegQuality = GetJpegQuality(request.jpeg_quality());
+  return Status;
+}
+
+// The encoding of each image a multi-image capture filled in
+TArray<FUESynthEncodeJob> GetEncodeJobs(const FCodecOptions &Options,
+                                        UESynthPixels::EFormat Format,
+                                        EUESynthCaptureModality Captured,
+                                        uesynth::MultiImageResponse *Reply) {
+  TArray<FUESynthEncodeJob> Jobs;
+  if (EnumHasAnyFlags(Captured, EUESynthCaptureModality::Rgb)) {
+    Jobs.Add(FUESynthEncodeJob{Reply->mutable_rgb(), Options.Color, Format,
+                               Options.JpegQuality});
+  }
+  if (EnumHasAnyFlags(Captured, EUESynthCaptureModality::Normals)) {
+    Jobs.Add(FUESynthEncodeJob{Reply->mutable_normals(), Options.Color,
+                               UESynthPixels::EFormat::RGB8,
+                               Options.JpegQuality});
+  }
+  if (EnumHasAnyFlags(Captured, EUESynthCaptureModality::Depth)) {
+    Jobs.Add(FUESynthEncodeJob{Reply->mutable_depth(), Options.Data});
+  }
+  if (EnumHasAnyFlags(Captured, EUESynthCaptureModality::Segmentation)) {
+    Jobs.Add(FUESynthEncodeJob{Reply->mutable_segmentation(), Options.Data});
+  }
+  if (EnumHasAnyFlags(Captured, EUESynthCaptureModality::OpticalFlow)) {
+    Jobs.Add(FUESynthEncodeJob{Reply->mutable_optical_flow(), Options.Data});
+  }
+  return Jobs;
+}
+
+// Compresses the images of a finished capture on background workers, then
+// completes its reply
+void EncodeThenReply(TArray<FUESynthEncodeJob> &&Jobs,
+                     UESynthServiceImpl::FReplyCallback &&OnDone) {
+  UESynthImageEncoder::EncodeAsync(
+      MoveTemp(Jobs), [OnDone = MoveTemp(OnDone)](bool bSuccess) mutable {
+        OnDone(bSuccess ? grpc::Status::OK
+                        : grpc::Status(grpc::StatusCode::INTERNAL,
+                                       "Failed to encode image"));
+      });
+}
+
+// Fills Image with a mapped float32 depth frame in the requested encoding,
+// rows packed tightly
+bool CopyDepth(const FUESynthMappedFrame &Frame, const FDepthOptions &Options,
+               uesynth::ImageResponse *Image) {
+  const int32 Width = Frame.Size.X;
+  if (!Frame.IsValid() || Frame.Format != PF_R32_FLOAT ||
+      Frame.RowPitch < Width * int32(sizeof(float))) {
+    return false;
+  }
+
+  const int32 RowBytes = Width * UESynthPixels::BytesPerDepth(Options.Encoding);
+  std::string *Out = Image->mutable_image_data();
+  UESynthImageBuffers::Acquire(size_t(RowBytes) * Frame.Size.Y, Out);
+  uint8 *Dst = reinterpret_cast<uint8 *>(&(*Out)[0]);
+  for (int32 Row = 0; Row < Frame.Size.Y; ++Row) {
+    const uint8 *Src = Frame.Data + int64(Row) * Frame.RowPitch;
+    UESynthPixels::ConvertDepthRow(
+        Options.Encoding, reinterpret_cast<const float *>(Src),
+        Dst + int64(Row) * RowBytes, Width, Options.Near, Options.Far);
+  }
+  Image->set_width(Width);
+  Image->set_height(Frame.Size.Y);
+  Image->set_format(TCHAR_TO_UTF8(*UESynthPixels::DepthFormatName(
+      Options.Encoding, Options.Near, Options.Far)));
+  return true;
+}
+
+// Fills Image with a mapped frame of 8-bit segmentation IDs, rows packed
+// tightly
+bool CopySegmentation(const FUESynthMappedFrame &Frame,
+                      uesynth::ImageResponse *Image) {
+  const int32 Width = Frame.Size.X;
+  if (!Frame.IsValid() || Frame.Format != PF_R8_UINT ||
+      Frame.RowPitch < Width) {
+    return false;
+  }
+
+  std::string *Out = Image->mutable_image_data();
+  UESynthImageBuffers::Acquire(size_t(Width) * Frame.Size.Y, Out);
+  uint8 *Dst = reinterpret_cast<uint8 *>(&(*Out)[0]);
+  for (int32 Row = 0; Row < Frame.Size.Y; ++Row) {
+    FMemory::Memcpy(Dst + int64(Row) * Width,
+                    Frame.Data + int64(Row) * Frame.RowPitch, Width);
+  }
+  Image->set_width(Width);
+  Image->set_height(Frame.Size.Y);
+  Image->set_format("instance_u8");
+  return true;
+}
+
+// Fills Image with a mapped frame of half-float (dx, dy) motion vectors, rows
+// packed tightly
+bool CopyOpticalFlow(const FUESynthMappedFrame &Frame,
+                     uesynth::ImageResponse *Image) {
+  constexpr int32 BytesPerPixel = 2 * sizeof(FFloat16);
+  const int32 RowBytes = Frame.Size.X * BytesPerPixel;
+  if (!Frame.IsValid() || Frame.Format != PF_G16R16F ||
+      Frame.RowPitch < RowBytes) {
+    return false;
+  }
+
+  std::string *Out = Image->mutable_image_data();
+  UESynthImageBuffers::Acquire(size_t(RowBytes) * Frame.Size.Y, Out);
+  uint8 *Dst = reinterpret_cast<uint8 *>(&(*Out)[0]);
+  for (int32 Row = 0; Row < Frame.Size.Y; ++Row) {
+    FMemory::Memcpy(Dst + int64(Row) * RowBytes,
+                    Frame.Data + int64(Row) * Frame.RowPitch, RowBytes);
+  }
+  Image->set_width(Frame.Size.X);
+  Image->set_height(Frame.Size.Y);
+  Image->set_format("flow_f16");
+  return true;
+}
+
+// Makes registered actors render their segmentation IDs into the custom
+// stencil, which the renderer only keeps with r.CustomDepth=3
+FUESynthActorRegistry &PrepareSegmentation() {
+  static IConsoleVariable *CustomDepth =
+      IConsoleManager::Get().FindConsoleVariable(TEXT("r.CustomDepth"));
+  if (CustomDepth && CustomDepth->GetInt() != 3) {
+    CustomDepth->Set(3, ECVF_SetByCode);
+  }
+
+  FUESynthActorRegistry &Actors = FUESynthSceneContext::Get().GetActors();
+  Actors.EnableSegmentation();
+  return Actors;
+}
+
+// Stamps Image with the current ID table revision, and adds the table itself
+// only when the client's copy is out of date, so steady-state frames carry
+// nothing but pixels
+void FillSegmentationTable(const FUESynthActorRegistry &Actors,
+                           uint32 KnownRevision,
+                           uesynth::ImageResponse *Image) {
+  const uint32 Revision = Actors.GetSegmentationRevision();
+  Image->set_segmentation_revision(Revision);
+  if (KnownRevision == Revision) {
+    return;
+  }
+  Actors.ForEachSegmentationId(
+      [Image](uint8 SegmentationId, const FString &Name, uint32 Id) {
+        uesynth::SegmentationEntry *Entry = Image->add_segmentation_table();
+        Entry->set_segmentation_id(SegmentationId);
+        Entry->set_object_name(TCHAR_TO_UTF8(*Name));
+        Entry->set_object_id(Id);
+      });
+}
+
+// The part of a FullSize image a capture of the requested size reads: the
+// top-left corner, where zero means all of it
+FIntRect GetCaptureRect(FIntPoint FullSize, uint32 Width, uint32 Height) {
+  const FIntPoint Size(
+      Width > 0 ? FMath::Min<int32>(Width, FullSize.X) : FullSize.X,
+      Height > 0 ? FMath::Min<int32>(Height, FullSize.Y) : FullSize.Y);
+  return FIntRect(FIntPoint::ZeroValue, Size);
+}
+
+// What a capture reads back: Rect of the view, scaled on the GPU to
+// OutputSize unless that is zero
+struct FCaptureRegion {
+  FIntRect Rect;
+  FIntPoint OutputSize = FIntPoint::ZeroValue;
+};
+
+// The region of a FullSize view a capture request reads: its roi clipped to
+// the view, else the corner GetCaptureRect picks, scaled to output_width x
+// output_height where either is set
+template <typename RequestType>
+grpc::Status GetCaptureRegion(const RequestType &request, FIntPoint FullSize,
+                              FCaptureRegion *Out) {
+  // Checked before narrowing, so a huge uint32 can't wrap into range
+  const uint32 MaxSize = FUESynthCameraPool::MaxResolution;
+  if (request.output_width() > MaxSize || request.output_height() > MaxSize) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "output_width and output_height must be 8192 or less");
+  }
+
+  if (request.has_roi()) {
+    const uesynth::CaptureRegion &Roi = request.roi();
+    const FIntPoint Min(int32(FMath::Min<uint32>(Roi.x(), FullSize.X)),
+                        int32(FMath::Min<uint32>(Roi.y(), FullSize.Y)));
+    const FIntPoint Left = FullSize - Min;
+    const FIntPoint Size(
+        Roi.width() > 0 ? int32(FMath::Min<uint32>(Roi.width(), Left.X))
+                        : Left.X,
+        Roi.height() > 0 ? int32(FMath::Min<uint32>(Roi.height(), Left.Y))
+                         : Left.Y);
+    Out->Rect = FIntRect(Min, Min + Size);
+  } else {
+    Out->Rect = GetCaptureRect(FullSize, request.width(), request.height());
+  }
+  if (Out->Rect.Area() <= 0) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "roi lies outside the view");
+  }
+
+  // One side alone keeps the region's aspect ratio
+  const FIntPoint Size = Out->Rect.Size();
+  int32 Width = int32(request.output_width());
+  int32 Height = int32(request.output_height());
+  if (Width > 0 && Height == 0) {
+    Height = FMath::Clamp(FMath::RoundToInt32(double(Width) * Size.Y / Size.X),
+                          1, int32(MaxSize));
+  } else if (Height > 0 && Width == 0) {
+    Width = FMath::Clamp(FMath::RoundToInt32(double(Height) * Size.X / Size.Y),
+                         1, int32(MaxSize));
+  }
+  const FIntPoint OutputSize(Width, Height);
+  Out->OutputSize = OutputSize == Size ? FIntPoint::ZeroValue : OutputSize;
+  return grpc::Status::OK;
+}
+
+// The pooled camera a request names, or NAME_None for the game view
+FName GetCameraName(const std::string &CameraName) {
+  return CameraName.empty() ? NAME_None
+                            : FName(UTF8_TO_TCHAR(CameraName.c_str()));
+}
+
+// A camera size from request dimensions, where zero keeps Fallback's; false
+// if the result is not a size a render target can have
+bool GetCameraResolution(uint32 Width, uint32 Height, FIntPoint Fallback,
+                         FIntPoint *Out) {
+  // Checked before narrowing, so a huge uint32 can't wrap into range
+  const uint32 Max = FUESynthCameraPool::MaxResolution;
+  if (Width > Max || Height > Max) {
+    return false;
+  }
+  *Out = FIntPoint(Width > 0 ? int32(Width) : Fallback.X,
+                   Height > 0 ? int32(Height) : Fallback.Y);
+  return FUESynthCameraPool::IsValidResolution(*Out);
+}
+
+// Whether a capture can be taken from the pooled camera Name
+grpc::Status CheckCamera(FName Name) {
+  if (!FUESynthFrameCapture::Get()) {
+    return grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                        "Engine is still starting up");
+  }
+  if (!FUESynthSceneContext::Get().GetCameras().Contains(Name)) {
+    const std::string CameraName = TCHAR_TO_UTF8(*Name.ToString());
+    return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                        "Camera '" + CameraName + "' not found");
+  }
+  return grpc::Status::OK;
+}
+
+// The size of the view a capture reads: the game viewport's, or without one
+// pooled camera CameraName's
+FIntPoint GetViewSize(const FViewport *Viewport, FName CameraName) {
+  return Viewport ? Viewport->GetSizeXY()
+                  : FUESynthSceneContext::Get().GetCameras().GetResolution(
+                        CameraName);
+}
+
+// Renders the Modalities of pooled camera Name right away, one scene capture
+// each with no tick in between, and reads Region of them back like a
+// game-view capture. Name must have passed CheckCamera.
+void CaptureCamera(FName Name, EUESynthCaptureModality Modalities,
+                   const FCaptureRegion &Region,
+                   FUESynthFrameCapture::FOnTextureMapped &&OnMapped,
+                   FUESynthFrameCapture::FOnCaptureComplete &&OnComplete) {
+  FUESynthCameraPool &Cameras = FUESynthSceneContext::Get().GetCameras();
+  TArray<FUESynthCaptureTarget, TInlineAllocator<2>> Targets;
+  for (EUESynthCaptureModality Modality :
+       {EUESynthCaptureModality::Rgb, EUESynthCaptureModality::Depth}) {
+    if (EnumHasAnyFlags(Modalities, Modality)) {
+      Targets.Add(
+          FUESynthCaptureTarget{Modality, Cameras.Capture(Name, Modality)});
     }
-    return status;
   }
 
-  case uesynth::ActionRequest::kGetCameraTransform: {
-    uesynth::GetCameraTransformResponse cam_response;
-    grpc::Status status = GetCameraTransform(
-        nullptr, &request.get_camera_transform(), &cam_response);
-    if (status.ok()) {
-      response->mutable_camera_transform()->CopyFrom(cam_response);
+  FUESynthFrameCapture::Get()->RequestTargets(
+      Targets, Region.Rect, Region.OutputSize, MoveTemp(OnMapped),
+      MoveTemp(OnComplete));
+}
+
+// The game viewport captures of modalities only the game view renders read
+// from, or null (and logged) without one
+FViewport *FindGameViewport() {
+  UGameViewportClient *ViewportClient =
+      FUESynthSceneContext::Get().GetViewportClient();
+  FViewport *Viewport = ViewportClient ? ViewportClient->Viewport : nullptr;
+  if (!Viewport) {
+    UE_LOG(LogTemp, Error,
+           TEXT("UESynth: No game viewport found for capture - make sure game "
+                "is running; offscreen servers only capture rgb and depth"));
+  }
+  return Viewport;
+}
+
+// Resolves what a capture of *CameraName reads: a pooled camera, or for the
+// game view the game viewport. Without a viewport, e.g. on a server started
+// with -RenderOffscreen, the game view is rendered by the headless view camera
+// instead, which *CameraName is then set to.
+grpc::Status FindCaptureView(FName *CameraName, FViewport **Viewport) {
+  *Viewport = nullptr;
+  if (!CameraName->IsNone()) {
+    return CheckCamera(*CameraName);
+  }
+
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  UGameViewportClient *ViewportClient = Scene.GetViewportClient();
+  *Viewport = ViewportClient ? ViewportClient->Viewport : nullptr;
+  if (*Viewport) {
+    return grpc::Status::OK;
+  }
+  *CameraName = Scene.GetHeadlessView();
+  if (CameraName->IsNone()) {
+    UE_LOG(LogTemp, Error,
+           TEXT("UESynth: No world found for capture - make sure game is "
+                "running"));
+    return grpc::Status(grpc::StatusCode::INTERNAL, "No world to capture");
+  }
+  return CheckCamera(*CameraName);
+}
+
+// Resolves the Index-th object of a batch by registry ID or, when the
+// request carries no IDs, by name
+template <typename RequestType>
+AActor *FindBatchActor(const FUESynthActorRegistry &Actors,
+                       const RequestType &request, int32 Index) {
+  if (request.object_ids_size() > 0) {
+    return Actors.FindActorById(request.object_ids(Index));
+  }
+  return Actors.FindActor(UTF8_TO_TCHAR(request.object_names(Index).c_str()));
+}
+
+template <typename RequestType>
+int32 GetBatchSize(const RequestType &request) {
+  return request.object_ids_size() > 0 ? request.object_ids_size()
+                                       : request.object_names_size();
+}
+
+// Resolves the tag and class filters of an object listing; false if no actor
+// can match them
+template <typename RequestType>
+bool ResolveActorFilter(const RequestType &request, FName *Tag,
+                        const UClass **Class) {
+  *Tag = NAME_None;
+  *Class = nullptr;
+  if (!request.tag().empty()) {
+    // A tag that was never interned can't be on any actor
+    *Tag = FName(UTF8_TO_TCHAR(request.tag().c_str()), FNAME_Find);
+    if (Tag->IsNone()) {
+      return false;
     }
-    return status;
   }
 
-  case uesynth::ActionRequest::kCaptureRgb: {
-    uesynth::ImageResponse img_response;
-    grpc::Status status =
-        CaptureRgbImage(nullptr, &request.capture_rgb(), &img_response);
-    if (status.ok()) {
-      response->mutable_image_response()->CopyFrom(img_response);
+  if (!request.class_name().empty()) {
+    const FString ClassName = UTF8_TO_TCHAR(request.class_name().c_str());
+    *Class = FUESynthActorRegistry::ResolveActorClass(ClassName);
+    if (!*Class) {
+      UE_LOG(LogTemp, Warning, TEXT("UESynth: Unknown actor class '%s'"),
+             *ClassName);
+      return false;
     }
-    return status;
   }
+  return true;
+}
+
+// Whether an action may be one of a step's: anything that completes inline
+// and doesn't belong to a stream
+bool CanRunInStep(const uesynth::ActionRequest &action) {
+  if (UESynthServiceImpl::GetActionKind(action) ==
+      EUESynthCommandKind::Capture) {
+    return false;
+  }
+  switch (action.action_case()) {
+  case uesynth::ActionRequest::kSubscribe:
+  case uesynth::ActionRequest::kUnsubscribe:
+  case uesynth::ActionRequest::kGetStreamStats:
+  case uesynth::ActionRequest::kOpenSharedMemory:
+  case uesynth::ActionRequest::kStep:
+  case uesynth::ActionRequest::kSetLockstep:
+  case uesynth::ActionRequest::kPreloadAssets:
+  case uesynth::ActionRequest::ACTION_NOT_SET:
+    return false;
+  default:
+    return true;
+  }
+}
 
-  case uesynth::ActionRequest::kCaptureDepth: {
-    uesynth::ImageResponse img_response;
-    grpc::Status status =
-        CaptureDepthMap(nullptr, &request.capture_depth(), &img_response);
-    if (status.ok()) {
-      response->mutable_image_response()->CopyFrom(img_response);
+// Whether TickWorld can tick World. The command queue drains outside of any
+// world's tick, but a world can't be ticked again from inside its own.
+grpc::Status CanTickWorld(const UWorld *World) {
+  if (!World) {
+    return grpc::Status(grpc::StatusCode::UNAVAILABLE, "No world to tick");
+  }
+  if (World->bInTick) {
+    return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                        "World is already ticking");
+  }
+  return grpc::Status::OK;
+}
+
+// Ticks World by exactly DeltaSeconds, as the engine would
+grpc::Status TickWorld(UWorld *World, float DeltaSeconds) {
+  const grpc::Status Status = CanTickWorld(World);
+  if (Status.ok()) {
+    World->Tick(LEVELTICK_All, DeltaSeconds);
+  }
+  return Status;
+}
+
+// Spawns the actor an asset stands for: a static mesh in a movable
+// StaticMeshActor, or an actor class or the Blueprint generating one. Null
+// for any other asset.
+AActor *SpawnAsset(UWorld *World, UObject *Asset, FName Name,
+                   const FTransform &Transform) {
+  FActorSpawnParameters Params;
+  Params.Name = Name;
+  Params.ObjectFlags |= RF_Transient;
+  Params.NameMode =
+      FActorSpawnParameters::ESpawnActorNameMode::Required_ReturnNull;
+  Params.SpawnCollisionHandlingOverride =
+      ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+  if (UStaticMesh *Mesh = Cast<UStaticMesh>(Asset)) {
+    AStaticMeshActor *Actor = World->SpawnActor<AStaticMeshActor>(
+        AStaticMeshActor::StaticClass(), Transform, Params);
+    if (Actor) {
+      UStaticMeshComponent *Component = Actor->GetStaticMeshComponent();
+      Component->SetMobility(EComponentMobility::Movable);
+      Component->SetStaticMesh(Mesh);
     }
-    return status;
+    return Actor;
   }
 
-  case uesynth::ActionRequest::kCaptureSegmentation: {
-    uesynth::ImageResponse img_response;
-    grpc::Status status = CaptureSegmentationMask(
-        nullptr, &request.capture_segmentation(), &img_response);
-    if (status.ok()) {
-      response->mutable_image_response()->CopyFrom(img_response);
+  UClass *Class = Cast<UClass>(Asset);
+  if (const UBlueprint *Blueprint = Cast<UBlueprint>(Asset)) {
+    Class = Blueprint->GeneratedClass;
+  }
+  if (!Class || !Class->IsChildOf(AActor::StaticClass()) ||
+      Class->HasAnyClassFlags(CLASS_Abstract)) {
+    return nullptr;
+  }
+  return World->SpawnActor<AActor>(Class, Transform, Params);
+}
+
+uesynth::AssetState ToAssetState(EUESynthAssetState State) {
+  switch (State) {
+  case EUESynthAssetState::Loading:
+    return uesynth::ASSET_STATE_LOADING;
+  case EUESynthAssetState::Resident:
+    return uesynth::ASSET_STATE_RESIDENT;
+  case EUESynthAssetState::Failed:
+    return uesynth::ASSET_STATE_FAILED;
+  default:
+    return uesynth::ASSET_STATE_NOT_LOADED;
+  }
+}
+
+// A PreloadAssets call waiting for its loads; game thread only
+struct FPendingPreload {
+  TArray<FSoftObjectPath> Paths;
+  uesynth::PreloadAssetsResponse *Reply = nullptr;
+  UESynthServiceImpl::FReplyCallback OnDone;
+  int32 Remaining = 0;
+};
+
+// Fills in the statuses PreloadAssetsOnGameThread added, one per path
+void FillPreloadResponse(const TArray<FSoftObjectPath> &Paths,
+                         uesynth::PreloadAssetsResponse *Reply) {
+  const FUESynthAssetCache &Cache = FUESynthAssetCache::Get();
+  for (int32 Index = 0; Index < Paths.Num(); ++Index) {
+    uesynth::AssetStatus *Status = Reply->mutable_assets(Index);
+    // A path that names no object is never loaded
+    Status->set_state(Paths[Index].IsValid()
+                          ? ToAssetState(Cache.GetState(Paths[Index]))
+                          : uesynth::ASSET_STATE_FAILED);
+    Status->set_resident_bytes(Cache.GetResidentBytes(Paths[Index]));
+  }
+  Reply->set_cache_bytes(Cache.GetTotalBytes());
+  Reply->set_cache_budget_bytes(Cache.GetBudget());
+  Reply->set_cache_entries(uint32(Cache.Num()));
+}
+
+void FinishPreload(FPendingPreload &Pending) {
+  if (--Pending.Remaining == 0) {
+    FillPreloadResponse(Pending.Paths, Pending.Reply);
+    Pending.OnDone(grpc::Status::OK);
+  }
+}
+
+// A loaded texture by object path, or null. Material updates run inline, so
+// they never start a load.
+UTexture *FindLoadedTexture(const std::string &TexturePath) {
+  const FSoftObjectPath Path(UTF8_TO_TCHAR(TexturePath.c_str()));
+  if (!Path.IsValid()) {
+    return nullptr;
+  }
+  UObject *Object = FUESynthAssetCache::Get().Find(Path);
+  return Cast<UTexture>(Object ? Object : Path.ResolveObject());
+}
+
+// Value of the deprecated single-parameter form: a number, else a color,
+// else a texture path
+grpc::Status ParseLegacyMaterialValue(const std::string &Value,
+                                      FUESynthMaterialValue &Out,
+                                      std::string *MissingTexture) {
+  const FString Text = UTF8_TO_TCHAR(Value.c_str());
+  if (Text.IsNumeric()) {
+    Out.Type = FUESynthMaterialValue::EType::Scalar;
+    Out.Scalar = FCString::Atof(*Text);
+    return grpc::Status::OK;
+  }
+  if (Out.Vector.InitFromString(Text)) {
+    Out.Type = FUESynthMaterialValue::EType::Vector;
+    return grpc::Status::OK;
+  }
+  if (Text.IsEmpty()) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "value is empty");
+  }
+  Out.Type = FUESynthMaterialValue::EType::Texture;
+  Out.Texture = FindLoadedTexture(Value);
+  if (!Out.Texture) {
+    *MissingTexture = Value;
+  }
+  return grpc::Status::OK;
+}
+
+// Resolves a material request's parameters for the material cache. Malformed
+// parameters fail the whole call; a texture that isn't loaded only fails the
+// object, and is named in MissingTexture.
+grpc::Status ToMaterialValues(const uesynth::SetMaterialRequest &request,
+                              TArray<FUESynthMaterialValue> &Values,
+                              std::string *MissingTexture) {
+  if (request.parameters_size() == 0) {
+    if (request.material_property().empty()) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Material updates need parameters");
     }
-    return status;
+    FUESynthMaterialValue &Value = Values.Emplace_GetRef();
+    Value.Parameter = FMaterialParameterInfo(
+        UTF8_TO_TCHAR(request.material_property().c_str()));
+    return ParseLegacyMaterialValue(request.value(), Value, MissingTexture);
   }
 
-  case uesynth::ActionRequest::kSetObjectTransform: {
-    uesynth::CommandResponse cmd_response;
-    grpc::Status status = SetObjectTransform(
-        nullptr, &request.set_object_transform(), &cmd_response);
-    if (status.ok()) {
-      response->mutable_command_response()->CopyFrom(cmd_response);
+  Values.Reserve(request.parameters_size());
+  for (const uesynth::MaterialParameter &Parameter : request.parameters()) {
+    FUESynthMaterialValue &Value = Values.Emplace_GetRef();
+    if (Parameter.has_id()) {
+      const FMaterialParameterInfo *Info =
+          FUESynthMaterialCache::FindParameter(Parameter.id());
+      if (!Info) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                            "Unknown material parameter id " +
+                                std::to_string(Parameter.id()));
+      }
+      Value.Parameter = *Info;
+    } else if (!Parameter.name().empty()) {
+      Value.Parameter =
+          FMaterialParameterInfo(UTF8_TO_TCHAR(Parameter.name().c_str()));
+    } else {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Material parameters need a name or an id");
+    }
+
+    switch (Parameter.value_case()) {
+    case uesynth::MaterialParameter::kScalar:
+      Value.Type = FUESynthMaterialValue::EType::Scalar;
+      Value.Scalar = Parameter.scalar();
+      break;
+    case uesynth::MaterialParameter::kVector: {
+      const uesynth::LinearColor &Color = Parameter.vector();
+      Value.Type = FUESynthMaterialValue::EType::Vector;
+      Value.Vector = FLinearColor(Color.r(), Color.g(), Color.b(), Color.a());
+      break;
+    }
+    case uesynth::MaterialParameter::kTexture:
+      Value.Type = FUESynthMaterialValue::EType::Texture;
+      Value.Texture = FindLoadedTexture(Parameter.texture());
+      if (!Value.Texture && MissingTexture->empty()) {
+        *MissingTexture = Parameter.texture();
+      }
+      break;
+    default:
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Material parameters need a value");
     }
-    return status;
   }
+  return grpc::Status::OK;
+}
 
-  case uesynth::ActionRequest::kGetObjectTransform: {
-    uesynth::GetObjectTransformResponse obj_response;
-    grpc::Status status = GetObjectTransform(
-        nullptr, &request.get_object_transform(), &obj_response);
-    if (status.ok()) {
-      response->mutable_object_transform()->CopyFrom(obj_response);
+// The actor a material request targets, by registry ID if it has one
+AActor *FindMaterialTarget(const FUESynthActorRegistry &Actors,
+                           const uesynth::SetMaterialRequest &request) {
+  if (request.object_id() != 0) {
+    return Actors.FindActorById(request.object_id());
+  }
+  return Actors.FindActor(UTF8_TO_TCHAR(request.object_name().c_str()));
+}
+
+// Writes a lighting update into its light without telling the renderer, so a
+// batch can push each light's color and brightness once. Returns the light,
+// or null if the update can't be applied; nothing is written then.
+ULightComponent *WriteLightUpdate(FUESynthSceneContext &Scene,
+                                  const uesynth::SetLightingRequest &request) {
+  const FUESynthActorRegistry &Actors = Scene.GetActors();
+  AActor *Actor =
+      request.object_id() != 0
+          ? Actors.FindActorById(request.object_id())
+          : Actors.FindActor(UTF8_TO_TCHAR(request.light_name().c_str()));
+  ULightComponent *Light = Scene.GetLights().FindLight(Actor);
+  // Static lights are baked; stationary ones can change but not move
+  if (!Light || !Light->AreDynamicDataChangesAllowed() ||
+      (request.has_transform() &&
+       Light->Mobility != EComponentMobility::Movable)) {
+    return nullptr;
+  }
+
+  if (request.has_intensity()) {
+    Light->Intensity = request.intensity();
+  }
+  if (request.has_color()) {
+    const uesynth::Vector3 &Color = request.color();
+    Light->LightColor =
+        FLinearColor(Color.x(), Color.y(), Color.z()).ToFColor(true);
+  }
+  if (request.has_transform()) {
+    // The move reaches the renderer with the world's end-of-frame updates
+    const uesynth::Transform &Transform = request.transform();
+    Light->SetWorldLocationAndRotation(
+        Transform.has_location()
+            ? UESynthTransform::ToVector(Transform.location())
+            : Light->GetComponentLocation(),
+        Transform.has_rotation()
+            ? UESynthTransform::ToRotator(Transform.rotation())
+            : Light->GetComponentRotation());
+  }
+  return Light;
+}
+
+bool ChangesLightColor(const uesynth::SetLightingRequest &request) {
+  return request.has_intensity() || request.has_color();
+}
+
+// Checks a subscription's schedule and capture, for subscriptions and the
+// recordings that make one
+grpc::Status CheckSubscribeRequest(const uesynth::SubscribeRequest &request) {
+  if (!(request.rate_hz() >= 0.0f) || !FMath::IsFinite(request.rate_hz())) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "rate_hz must be a non-negative number");
+  }
+  if (request.rate_hz() > 0.0f && request.every_n_frames() > 0) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Set either rate_hz or every_n_frames");
+  }
+
+  const uesynth::CaptureMultiRequest &capture = request.capture();
+  if (capture.modalities() == 0) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "No modalities requested");
+  }
+  UESynthPixels::EFormat Format;
+  if (!ToPixelFormat(capture.pixel_format(), &Format)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Unsupported pixel_format");
+  }
+  FDepthOptions DepthOptions;
+  const grpc::Status DepthStatus = GetDepthOptions(capture, &DepthOptions);
+  if (!DepthStatus.ok()) {
+    return DepthStatus;
+  }
+  FCodecOptions CodecOptions;
+  const grpc::Status CodecStatus = GetCodecOptions(capture, &CodecOptions);
+  if (!CodecStatus.ok()) {
+    return CodecStatus;
+  }
+  if (request.delta_tile_size() != 0) {
+    if (request.delta_tile_size() < FUESynthTileDelta::MinTileSize ||
+        request.delta_tile_size() > FUESynthTileDelta::MaxTileSize) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "delta_tile_size must be 0 or 8..256");
+    }
+    // Delta frames are tiles, not images, by the time they are compressed
+    if (UESynthImageEncoder::IsImageCodec(CodecOptions.Color)) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Delta frames can't be sent as JPEG or PNG");
+    }
+  }
+  const FName CameraName = GetCameraName(capture.camera_name());
+  if (!CameraName.IsNone()) {
+    const grpc::Status CameraStatus = CheckCamera(CameraName);
+    if (!CameraStatus.ok()) {
+      return CameraStatus;
     }
-    return status;
   }
+  return grpc::Status::OK;
+}
 
-  // Add more cases for other action types as needed
-  case uesynth::ActionRequest::kListObjects: {
-    uesynth::ListObjectsResponse list_response;
+// Recordings store frames as they are captured, so they can't be compressed
+grpc::Status CheckRecordedCapture(const uesynth::CaptureMultiRequest &capture) {
+  if (capture.color_codec() != uesynth::IMAGE_CODEC_RAW ||
+      capture.data_codec() != uesynth::IMAGE_CODEC_RAW) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Recorded captures must use the RAW codecs");
+  }
+  return grpc::Status::OK;
+}
+
+} // namespace
+
+// New bidirectional streaming method implementation
+grpc::Status UESynthServiceImpl::ControlStream(
+    grpc::ServerContext *context,
+    grpc::ServerReaderWriter<uesynth::FrameResponse, uesynth::ActionRequest>
+        *stream) {
+  TSharedPtr<FUESynthSession> Session;
+  const grpc::Status SessionStatus =
+      FUESynthSessions::Get().FromMetadata(context, &Session);
+  if (!SessionStatus.ok()) {
+    return SessionStatus;
+  }
+
+  // Reads, game-thread work and writes overlap inside the pipeline; the
+  // client picks how many actions may be in flight at once.
+  FUESynthControlStream Pipeline(
+      *this, context, stream,
+      FUESynthControlStream::GetRequestedMaxInFlight(context),
+      FUESynthWriteQueue::FromMetadata(context), Session);
+  return Pipeline.Run();
+}
+
+// Helper method to process individual actions
+grpc::Status
+UESynthServiceImpl::ProcessAction(const uesynth::ActionRequest &request,
+                                  uesynth::FrameResponse *response) {
+  return RunDeferredOnGameThread(
+      nullptr, GetActionKind(request),
+      [this, &request, response](FReplyCallback &&OnDone) {
+        ProcessActionOnGameThread(request, response, MoveTemp(OnDone));
+      });
+}
+
+EUESynthCommandKind
+UESynthServiceImpl::GetActionKind(const uesynth::ActionRequest &request) {
+  switch (request.action_case()) {
+  case uesynth::ActionRequest::kCaptureRgb:
+  case uesynth::ActionRequest::kCaptureDepth:
+  case uesynth::ActionRequest::kCaptureSegmentation:
+  case uesynth::ActionRequest::kCaptureNormals:
+  case uesynth::ActionRequest::kCaptureOpticalFlow:
+  case uesynth::ActionRequest::kCaptureMulti:
+  case uesynth::ActionRequest::kCaptureCameras:
+    return EUESynthCommandKind::Capture;
+
+  case uesynth::ActionRequest::kGetCameraTransform:
+  case uesynth::ActionRequest::kGetObjectTransform:
+  case uesynth::ActionRequest::kGetObjectTransformsBatch:
+  case uesynth::ActionRequest::kListObjects:
+  case uesynth::ActionRequest::kGetSceneSnapshot:
+  case uesynth::ActionRequest::kSubscribe:
+  case uesynth::ActionRequest::kUnsubscribe:
+  case uesynth::ActionRequest::kGetStreamStats:
+  case uesynth::ActionRequest::kOpenSharedMemory:
+  case uesynth::ActionRequest::kPreloadAssets:
+  case uesynth::ActionRequest::kResolveMaterialParameters:
+  case uesynth::ActionRequest::ACTION_NOT_SET:
+    return EUESynthCommandKind::Query;
+
+  default:
+    return EUESynthCommandKind::Mutation;
+  }
+}
+
+bool UESynthServiceImpl::IsStreamedAction(
+    const uesynth::ActionRequest &request) {
+  return request.action_case() == uesynth::ActionRequest::kCaptureCameras;
+}
+
+void UESynthServiceImpl::StreamActionOnGameThread(
+    const uesynth::ActionRequest &request, FResponseCallback &&OnResponse,
+    FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::StreamActionOnGameThread);
+  FResponseCallback OnStampedResponse =
+      [RequestId = request.request_id(),
+       OnResponse = MoveTemp(OnResponse)](uesynth::FrameResponse &&Response) {
+        Response.set_request_id(RequestId);
+        OnResponse(MoveTemp(Response));
+      };
+
+  switch (request.action_case()) {
+  case uesynth::ActionRequest::kCaptureCameras:
+    CaptureCamerasOnGameThread(request.capture_cameras(),
+                               MoveTemp(OnStampedResponse), MoveTemp(OnDone));
+    return;
+  default:
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Action has a single response"));
+    return;
+  }
+}
+
+grpc::Status UESynthServiceImpl::ProcessStreamedAction(
+    const uesynth::ActionRequest &request,
+    TArray<uesynth::FrameResponse> *responses) {
+  // Every response arrives before OnDone, so the lock can live on this stack
+  FCriticalSection ResponsesLock;
+  return RunDeferredOnGameThread(
+      nullptr, GetActionKind(request),
+      [this, &request, responses, &ResponsesLock](FReplyCallback &&OnDone) {
+        StreamActionOnGameThread(
+            request,
+            [responses, &ResponsesLock](uesynth::FrameResponse &&Response) {
+              FScopeLock Lock(&ResponsesLock);
+              responses->Add(MoveTemp(Response));
+            },
+            MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::ProcessActionOnGameThread(
+    const uesynth::ActionRequest &request, uesynth::FrameResponse *response,
+    FReplyCallback &&OnDone, const TSharedPtr<FUESynthStreamLink> &stream) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::ProcessActionOnGameThread);
+  response->set_request_id(request.request_id());
+
+  if (IsStreamedAction(request)) {
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Action streams its responses"));
+    return;
+  }
+
+  // Captures complete once their readback lands; the reply is written in
+  // place since the response outlives the callback
+  if (request.action_case() == uesynth::ActionRequest::kCaptureRgb) {
+    CaptureRgbImageOnGameThread(request.capture_rgb(),
+                                response->mutable_image_response(),
+                                MoveTemp(OnDone));
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kCaptureDepth) {
+    CaptureDepthMapOnGameThread(request.capture_depth(),
+                                response->mutable_image_response(),
+                                MoveTemp(OnDone));
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kCaptureSegmentation) {
+    CaptureSegmentationMaskOnGameThread(request.capture_segmentation(),
+                                        response->mutable_image_response(),
+                                        MoveTemp(OnDone));
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kCaptureNormals) {
+    CaptureNormalsOnGameThread(request.capture_normals(),
+                               response->mutable_image_response(),
+                               MoveTemp(OnDone));
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kCaptureOpticalFlow) {
+    CaptureOpticalFlowOnGameThread(request.capture_optical_flow(),
+                                   response->mutable_image_response(),
+                                   MoveTemp(OnDone));
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kCaptureMulti) {
+    CaptureMultiOnGameThread(request.capture_multi(),
+                             response->mutable_multi_image_response(),
+                             MoveTemp(OnDone));
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kStep) {
+    StepOnGameThread(request.step(), response->mutable_step_response(),
+                     MoveTemp(OnDone));
+    return;
+  }
+
+  // Both may wait for assets to stream in
+  if (request.action_case() == uesynth::ActionRequest::kSpawnObject) {
+    SpawnObjectOnGameThread(request.spawn_object(),
+                            response->mutable_command_response(),
+                            MoveTemp(OnDone));
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kPreloadAssets) {
+    PreloadAssetsOnGameThread(request.preload_assets(),
+                              response->mutable_preload_assets_response(),
+                              MoveTemp(OnDone));
+    return;
+  }
+
+  // Subscriptions belong to the stream they were made on
+  if (request.action_case() == uesynth::ActionRequest::kSubscribe ||
+      request.action_case() == uesynth::ActionRequest::kUnsubscribe) {
+    uesynth::CommandResponse *cmd_response =
+        response->mutable_command_response();
     grpc::Status status =
-        ListObjects(nullptr, &request.list_objects(), &list_response);
-    if (status.ok()) {
-      response->mutable_objects_list()->CopyFrom(list_response);
+        request.has_subscribe()
+            ? SubscribeOnGameThread(request.request_id(), request.subscribe(),
+                                    stream, cmd_response)
+            : UnsubscribeOnGameThread(request.unsubscribe(), stream,
+                                      cmd_response);
+    if (!status.ok()) {
+      response->clear_response();
+    }
+    OnDone(status);
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kGetStreamStats) {
+    grpc::Status status =
+        GetStreamStatsOnGameThread(stream, response->mutable_stream_stats());
+    if (!status.ok()) {
+      response->clear_response();
+    }
+    OnDone(status);
+    return;
+  }
+  if (request.action_case() == uesynth::ActionRequest::kOpenSharedMemory) {
+    grpc::Status status =
+        OpenSharedMemoryOnGameThread(request.open_shared_memory(), stream,
+                                     response->mutable_shared_memory());
+    if (!status.ok()) {
+      response->clear_response();
     }
-    return status;
+    OnDone(status);
+    return;
   }
+  // Lockstep enabled over a stream ends when the stream does
+  if (request.action_case() == uesynth::ActionRequest::kSetLockstep) {
+    grpc::Status status = SetLockstepOnGameThread(
+        request.set_lockstep(), response->mutable_lockstep_state(), stream);
+    if (!status.ok()) {
+      response->clear_response();
+    }
+    OnDone(status);
+    return;
+  }
+
+  OnDone(ProcessImmediateActionOnGameThread(request, response));
+}
+
+grpc::Status UESynthServiceImpl::ProcessImmediateActionOnGameThread(
+    const uesynth::ActionRequest &request, uesynth::FrameResponse *response) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::ProcessImmediateActionOnGameThread);
+  // Sub-responses are written in place, on the response's arena if it has
+  // one; a failure clears the oneof again
+  grpc::Status status;
+  switch (request.action_case()) {
+  case uesynth::ActionRequest::kSetCameraTransform:
+    status = SetCameraTransformOnGameThread(
+        request.set_camera_transform(), response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kGetCameraTransform:
+    status = GetCameraTransformOnGameThread(
+        request.get_camera_transform(), response->mutable_camera_transform());
+    break;
+
+  case uesynth::ActionRequest::kCreateCamera:
+    status = CreateCameraOnGameThread(
+        request.create_camera(), response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kDestroyCamera:
+    status = DestroyCameraOnGameThread(
+        request.destroy_camera(), response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kSetResolution:
+    status = SetResolutionOnGameThread(
+        request.set_resolution(), response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kSetObjectTransform:
+    status = SetObjectTransformOnGameThread(
+        request.set_object_transform(), response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kGetObjectTransform:
+    status = GetObjectTransformOnGameThread(
+        request.get_object_transform(), response->mutable_object_transform());
+    break;
+
+  case uesynth::ActionRequest::kSetObjectTransformsBatch:
+    status = SetObjectTransformsBatchOnGameThread(
+        request.set_object_transforms_batch(),
+        response->mutable_object_transforms_set());
+    break;
+
+  case uesynth::ActionRequest::kGetObjectTransformsBatch:
+    status = GetObjectTransformsBatchOnGameThread(
+        request.get_object_transforms_batch(),
+        response->mutable_object_transforms_batch());
+    break;
+
+  // Steps can't wait for a load, so a spawn in one needs its asset resident
+  case uesynth::ActionRequest::kSpawnObject:
+    status = SpawnResidentObjectOnGameThread(
+        request.spawn_object(), response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kDestroyObject:
+    status = DestroyObjectOnGameThread(
+        request.destroy_object(), response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kConfigureActorPool:
+    status = ConfigureActorPoolOnGameThread(
+        request.configure_actor_pool(), response->mutable_actor_pool_stats());
+    break;
+
+  case uesynth::ActionRequest::kSetMaterial:
+    status = SetMaterialOnGameThread(request.set_material(),
+                                     response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kSetMaterialsBatch:
+    status = SetMaterialsBatchOnGameThread(request.set_materials_batch(),
+                                           response->mutable_materials_set());
+    break;
+
+  case uesynth::ActionRequest::kResolveMaterialParameters:
+    status = ResolveMaterialParametersOnGameThread(
+        request.resolve_material_parameters(),
+        response->mutable_material_parameter_ids());
+    break;
+
+  case uesynth::ActionRequest::kSetLighting:
+    status = SetLightingOnGameThread(request.set_lighting(),
+                                     response->mutable_command_response());
+    break;
+
+  case uesynth::ActionRequest::kSetLightingBatch:
+    status = SetLightingBatchOnGameThread(request.set_lighting_batch(),
+                                          response->mutable_lighting_set());
+    break;
+
+  // Add more cases for other action types as needed
+  case uesynth::ActionRequest::kListObjects:
+    status = ListObjectsOnGameThread(
+        request.list_objects(), response->mutable_objects_list());
+    break;
+
+  case uesynth::ActionRequest::kGetSceneSnapshot:
+    status = GetSceneSnapshotOnGameThread(request.get_scene_snapshot(),
+                                          response->mutable_scene_snapshot());
+    break;
 
   default:
     return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
                         "Action not implemented");
   }
+
+  if (!status.ok()) {
+    response->clear_response();
+  }
+  return status;
 }
 
 grpc::Status UESynthServiceImpl::SetCameraTransform(
     grpc::ServerContext *context,
     const uesynth::SetCameraTransformRequest *request,
     uesynth::CommandResponse *reply) {
-  bool success = false;
-  std::string message;
-  auto future =
-      Async(EAsyncExecution::TaskGraphMainThread,
-            [request, &success, &message]() -> bool {
-              // Get world from game engine - try multiple approaches
-              UWorld *World = nullptr;
-
-              // Method 1: Try to get world from world contexts
-              if (GEngine && GEngine->GetWorldContexts().Num() > 0) {
-                for (const FWorldContext &WorldContext :
-                     GEngine->GetWorldContexts()) {
-                  if (WorldContext.World() &&
-                      WorldContext.WorldType == EWorldType::Game) {
-                    World = WorldContext.World();
-                    break;
-                  }
-                }
-              }
-
-              // Method 2: Fallback to PIE world if in editor
-              if (!World && GEngine) {
-                World = GEngine->GetCurrentPlayWorld();
-              }
-
-              // Method 3: Last resort - get any valid world
-              if (!World && GEngine && GEngine->GetWorldContexts().Num() > 0) {
-                World = GEngine->GetWorldContexts()[0].World();
-              }
-
-              if (World) {
-                AActor *Camera = UGameplayStatics::GetActorOfClass(
-                    World, ACameraActor::StaticClass()); // Placeholder
-                if (Camera) {
-                  // Convert protobuf types to Unreal Engine types
-                  FVector Location(request->transform().location().x(),
-                                   request->transform().location().y(),
-                                   request->transform().location().z());
-                  FRotator Rotation(request->transform().rotation().pitch(),
-                                    request->transform().rotation().yaw(),
-                                    request->transform().rotation().roll());
-
-                  Camera->SetActorLocationAndRotation(Location, Rotation);
-                  message = "Camera transform set successfully";
-                  success = true;
-                  return true;
-                } else {
-                  message = "No camera actor found in world";
-                }
-              } else {
-                message = "No valid world found - make sure game is running";
-              }
-              success = false;
-              return false;
-            });
-  future.Get();
-  reply->set_success(success);
-  reply->set_message(message);
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetCameraTransformOnGameThread(
+                               *request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetCameraTransformOnGameThread(
+    const uesynth::SetCameraTransformRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::SetCameraTransformOnGameThread);
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  UWorld *World = Scene.GetWorld();
+
+  if (!World) {
+    reply->set_success(false);
+    reply->set_message("No valid world found - make sure game is running");
+    return grpc::Status::OK;
+  }
+
+  ACameraActor *Camera = Scene.FindCamera(UTF8_TO_TCHAR(request.camera_name().c_str()));
+  if (!Camera) {
+    reply->set_success(false);
+    reply->set_message(request.camera_name().empty()
+                           ? "No camera actor found in world"
+                           : "Camera '" + request.camera_name() + "' not found");
+    return grpc::Status::OK;
+  }
+
+  // Convert protobuf types to Unreal Engine types
+  FVector Location(request.transform().location().x(),
+                   request.transform().location().y(),
+                   request.transform().location().z());
+  FRotator Rotation(request.transform().rotation().pitch(),
+                    request.transform().rotation().yaw(),
+                    request.transform().rotation().roll());
+
+  Camera->SetActorLocationAndRotation(Location, Rotation);
+  reply->set_success(true);
+  reply->set_message("Camera transform set successfully");
   return grpc::Status::OK;
 }
 
@@ -224,128 +1406,733 @@ grpc::Status
 UESynthServiceImpl::CaptureRgbImage(grpc::ServerContext *context,
                                     const uesynth::CaptureRequest *request,
                                     uesynth::ImageResponse *reply) {
-  std::promise<std::vector<uint8>> promise;
-  auto future = promise.get_future();
-  AsyncTask(ENamedThreads::GameThread, [&promise, request]() {
-    // Get world from game engine - try multiple approaches
-    UWorld *World = nullptr;
-
-    // Method 1: Try to get world from world contexts
-    if (GEngine && GEngine->GetWorldContexts().Num() > 0) {
-      for (const FWorldContext &WorldContext : GEngine->GetWorldContexts()) {
-        if (WorldContext.World() &&
-            WorldContext.WorldType == EWorldType::Game) {
-          World = WorldContext.World();
-          break;
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Capture,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        CaptureRgbImageOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::CaptureRgbImageOnGameThread(
+    const uesynth::CaptureRequest &request, uesynth::ImageResponse *reply,
+    FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::CaptureRgbImageOnGameThread);
+  const grpc::Status CaptureFailed(grpc::StatusCode::INTERNAL,
+                                   "Failed to capture image");
+
+  UESynthPixels::EFormat Format;
+  if (!ToPixelFormat(request.pixel_format(), &Format)) {
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Unsupported pixel_format"));
+    return;
+  }
+
+  EUESynthImageCodec Codec;
+  const grpc::Status CodecStatus = GetCodec(request.codec(), true, &Codec);
+  if (!CodecStatus.ok()) {
+    OnDone(CodecStatus);
+    return;
+  }
+  const FUESynthEncodeJob Encoding{reply, Codec, Format,
+                                   GetJpegQuality(request.jpeg_quality())};
+
+  // A pooled camera renders on demand rather than waiting for the game view
+  FName CameraName = GetCameraName(request.camera_name());
+  FViewport *Viewport = nullptr;
+  const grpc::Status ViewStatus = FindCaptureView(&CameraName, &Viewport);
+  if (!ViewStatus.ok()) {
+    OnDone(ViewStatus);
+    return;
+  }
+
+  FCaptureRegion Region;
+  const grpc::Status RegionStatus =
+      GetCaptureRegion(request, GetViewSize(Viewport, CameraName), &Region);
+  if (!RegionStatus.ok()) {
+    OnDone(RegionStatus);
+    return;
+  }
+
+  if (Viewport && Region.OutputSize == FIntPoint::ZeroValue) {
+    // The copy is queued on the GPU and the game thread moves on. Once it
+    // lands the staging buffer is converted straight into image_data, the
+    // only copy the pixels get, and the reply is encoded and completed on
+    // background threads. Only the requested channels go over the wire.
+    FUESynthFrameReadback::Get().Request(
+        Viewport, Region.Rect,
+        [reply, Format](const FUESynthMappedFrame &Frame) {
+          return CopyImage(Frame, Format, UESynthPixels::FormatName(Format),
+                           reply);
+        },
+        [CaptureFailed, Encoding,
+         OnDone = MoveTemp(OnDone)](bool bSuccess) mutable {
+          if (!bSuccess) {
+            UE_LOG(LogTemp, Error,
+                   TEXT("UESynth: Failed to read back viewport pixels"));
+            OnDone(CaptureFailed);
+            return;
+          }
+          EncodeThenReply({Encoding}, MoveTemp(OnDone));
+        });
+    return;
+  }
+
+  // A scaled game-view capture is scaled in the frame's post-processing,
+  // before the pixels reach a staging buffer, so the readback only moves the
+  // scaled image
+  FUESynthFrameCapture *FrameCapture = FUESynthFrameCapture::Get();
+  if (!FrameCapture) {
+    OnDone(grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                        "Engine is still starting up"));
+    return;
+  }
+  FUESynthFrameCapture::FOnTextureMapped OnMapped =
+      [reply, Format](const FUESynthCapturedTexture &Texture) {
+        return CopyImage(Texture.Frame, Format,
+                         UESynthPixels::FormatName(Format), reply);
+      };
+  FUESynthFrameCapture::FOnCaptureComplete OnComplete =
+      [CaptureFailed, Encoding,
+       OnDone = MoveTemp(OnDone)](EUESynthCaptureModality Captured) mutable {
+        if (Captured == EUESynthCaptureModality::None) {
+          OnDone(CaptureFailed);
+          return;
         }
-      }
-    }
+        EncodeThenReply({Encoding}, MoveTemp(OnDone));
+      };
+  if (Viewport) {
+    FrameCapture->Request(EUESynthCaptureModality::Rgb, Region.Rect,
+                          Region.OutputSize, MoveTemp(OnMapped),
+                          MoveTemp(OnComplete));
+  } else {
+    CaptureCamera(CameraName, EUESynthCaptureModality::Rgb, Region,
+                  MoveTemp(OnMapped), MoveTemp(OnComplete));
+  }
+}
 
-    // Method 2: Fallback to PIE world if in editor
-    if (!World && GEngine) {
-      World = GEngine->GetCurrentPlayWorld();
-    }
+grpc::Status
+UESynthServiceImpl::CaptureMulti(grpc::ServerContext *context,
+                                 const uesynth::CaptureMultiRequest *request,
+                                 uesynth::MultiImageResponse *reply) {
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Capture,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        CaptureMultiOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
 
-    // Method 3: Last resort - get any valid world
-    if (!World && GEngine && GEngine->GetWorldContexts().Num() > 0) {
-      World = GEngine->GetWorldContexts()[0].World();
-    }
+void UESynthServiceImpl::CaptureMultiOnGameThread(
+    const uesynth::CaptureMultiRequest &request,
+    uesynth::MultiImageResponse *reply, FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::CaptureMultiOnGameThread);
+  const grpc::Status CaptureFailed(grpc::StatusCode::INTERNAL,
+                                   "Failed to capture image");
+
+  if (request.modalities() == 0) {
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "No modalities requested"));
+    return;
+  }
+
+  // Modalities this server can't produce yet are left out of the reply mask
+  EUESynthCaptureModality Modalities =
+      EUESynthCaptureModality(request.modalities()) &
+      FUESynthFrameCapture::SupportedModalities;
+  if (Modalities == EUESynthCaptureModality::None) {
+    OnDone(grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "None of the requested modalities is supported"));
+    return;
+  }
+
+  UESynthPixels::EFormat Format;
+  if (!ToPixelFormat(request.pixel_format(), &Format)) {
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Unsupported pixel_format"));
+    return;
+  }
+
+  FDepthOptions DepthOptions;
+  const grpc::Status DepthStatus = GetDepthOptions(request, &DepthOptions);
+  if (!DepthStatus.ok()) {
+    OnDone(DepthStatus);
+    return;
+  }
 
-    if (!World) {
-      UE_LOG(LogTemp, Error,
-             TEXT("UESynth: No world found for capture - make sure game is "
-                  "running"));
-      std::vector<uint8> emptyData;
-      promise.set_value(emptyData);
+  FCodecOptions CodecOptions;
+  const grpc::Status CodecStatus = GetCodecOptions(request, &CodecOptions);
+  if (!CodecStatus.ok()) {
+    OnDone(CodecStatus);
+    return;
+  }
+
+  FUESynthFrameCapture *FrameCapture = FUESynthFrameCapture::Get();
+  if (!FrameCapture) {
+    OnDone(grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                        "Engine is still starting up"));
+    return;
+  }
+
+  FName CameraName = GetCameraName(request.camera_name());
+  FViewport *Viewport = nullptr;
+  const grpc::Status ViewStatus = FindCaptureView(&CameraName, &Viewport);
+  if (!ViewStatus.ok()) {
+    OnDone(ViewStatus);
+    return;
+  }
+  if (!Viewport) {
+    // A scene capture has no stencil or GBuffer of its own to read back
+    Modalities &= FUESynthCameraPool::SupportedModalities;
+    if (Modalities == EUESynthCaptureModality::None) {
+      OnDone(grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                          "Cameras only capture rgb and depth"));
       return;
     }
+  }
+
+  FCaptureRegion Region;
+  const grpc::Status RegionStatus =
+      GetCaptureRegion(request, GetViewSize(Viewport, CameraName), &Region);
+  if (!RegionStatus.ok()) {
+    OnDone(RegionStatus);
+    return;
+  }
+
+  if (EnumHasAnyFlags(Modalities, EUESynthCaptureModality::Segmentation)) {
+    FillSegmentationTable(PrepareSegmentation(),
+                          request.segmentation_revision(),
+                          reply->mutable_segmentation());
+  }
 
-    // Get the game viewport - try multiple approaches
-    UGameViewportClient *ViewportClient = nullptr;
-    
-    // Method 1: Try to get viewport from world
-    ViewportClient = World->GetGameViewport();
-    
-    // Method 2: Try to get viewport from engine
-    if (!ViewportClient && GEngine) {
-      ViewportClient = GEngine->GameViewport;
-    }
-    
-    // Method 3: Try to get viewport from world contexts
-    if (!ViewportClient && GEngine) {
-      for (const FWorldContext &WorldContext : GEngine->GetWorldContexts()) {
-        if (WorldContext.GameViewport) {
-          ViewportClient = WorldContext.GameViewport;
-          break;
+  // Every requested modality is copied out of the same rendered frame, and
+  // each lands straight in its own image of the reply
+  FUESynthFrameCapture::FOnTextureMapped OnMapped =
+      [reply, Format, DepthOptions](const FUESynthCapturedTexture &Texture) {
+        switch (Texture.Modality) {
+        case EUESynthCaptureModality::Rgb:
+          return CopyImage(Texture.Frame, Format,
+                           UESynthPixels::FormatName(Format),
+                           reply->mutable_rgb());
+        case EUESynthCaptureModality::Depth:
+          return CopyDepth(Texture.Frame, DepthOptions, reply->mutable_depth());
+        case EUESynthCaptureModality::Segmentation:
+          return CopySegmentation(Texture.Frame, reply->mutable_segmentation());
+        case EUESynthCaptureModality::Normals:
+          return CopyImage(Texture.Frame, UESynthPixels::EFormat::RGB8,
+                           "normal_rgb8", reply->mutable_normals());
+        case EUESynthCaptureModality::OpticalFlow:
+          return CopyOpticalFlow(Texture.Frame, reply->mutable_optical_flow());
+        default:
+          return false;
         }
-      }
+      };
+  // Each image is then compressed in a task of its own
+  FUESynthFrameCapture::FOnCaptureComplete OnComplete =
+      [reply, CaptureFailed, CodecOptions, Format,
+       OnDone = MoveTemp(OnDone)](EUESynthCaptureModality Captured) mutable {
+        if (Captured == EUESynthCaptureModality::None) {
+          UE_LOG(LogTemp, Error,
+                 TEXT("UESynth: Failed to read back any requested modality"));
+          OnDone(CaptureFailed);
+          return;
+        }
+        reply->set_modalities(uint32(Captured));
+        EncodeThenReply(GetEncodeJobs(CodecOptions, Format, Captured, reply),
+                        MoveTemp(OnDone));
+      };
+
+  if (Viewport) {
+    FrameCapture->Request(Modalities, Region.Rect, Region.OutputSize,
+                          MoveTemp(OnMapped), MoveTemp(OnComplete));
+  } else {
+    CaptureCamera(CameraName, Modalities, Region, MoveTemp(OnMapped),
+                  MoveTemp(OnComplete));
+  }
+}
+
+grpc::Status UESynthServiceImpl::Step(grpc::ServerContext *context,
+                                      const uesynth::StepRequest *request,
+                                      uesynth::StepResponse *reply) {
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Mutation,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        StepOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::StepOnGameThread(const uesynth::StepRequest &request,
+                                          uesynth::StepResponse *reply,
+                                          FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::StepOnGameThread);
+  // Checked before anything runs, so a step that can't run changes nothing
+  const float DeltaSeconds = request.delta_seconds();
+  if (!FMath::IsFinite(DeltaSeconds) || DeltaSeconds < 0.0f) {
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "delta_seconds must be 0 or more"));
+    return;
+  }
+  for (const uesynth::ActionRequest &action : request.actions()) {
+    if (!CanRunInStep(action)) {
+      OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Steps can't capture, subscribe, use the stream or "
+                          "nest; capture through StepRequest.capture"));
+      return;
+    }
+  }
+  // Resolved up front, so the capture still lands if the recording is stopped
+  // before its readback does; the recording then drops it
+  TSharedPtr<FUESynthStreamLink> Recording;
+  if (!request.recording_id().empty()) {
+    Recording = FUESynthRecordings::Get().FindLink(request.recording_id());
+    if (!Recording) {
+      OnDone(grpc::Status(grpc::StatusCode::NOT_FOUND,
+                          "No recording '" + request.recording_id() + "'"));
+      return;
+    }
+    if (request.capture().modalities() == 0) {
+      OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Steps that name a recording need a capture"));
+      return;
     }
-    
-    if (!ViewportClient) {
-      UE_LOG(LogTemp, Error, TEXT("UESynth: No viewport client found after trying multiple methods"));
-      UE_LOG(LogTemp, Error, TEXT("UESynth: World type: %d, World name: %s"), 
-             (int32)World->WorldType, *World->GetName());
-      std::vector<uint8> emptyData;
-      promise.set_value(emptyData);
+    const grpc::Status CaptureStatus = CheckRecordedCapture(request.capture());
+    if (!CaptureStatus.ok()) {
+      OnDone(CaptureStatus);
       return;
     }
+  }
 
-    // Get viewport size
-    FViewport *Viewport = ViewportClient->Viewport;
-    if (!Viewport) {
-      UE_LOG(LogTemp, Error, TEXT("UESynth: No viewport found"));
-      std::vector<uint8> emptyData;
-      promise.set_value(emptyData);
+  // In lockstep the engine renders the step's frame once this drain ends;
+  // otherwise the step ticks the world itself
+  UWorld *World = FUESynthSceneContext::Get().GetWorld();
+  const bool bLockstep =
+      FUESynthLockstep::IsAvailable() && FUESynthLockstep::Get().IsEnabled();
+  if (!bLockstep && DeltaSeconds > 0.0f) {
+    const grpc::Status TickStatus = CanTickWorld(World);
+    if (!TickStatus.ok()) {
+      OnDone(TickStatus);
       return;
     }
+  }
 
-    // Capture the viewport
-    TArray<FColor> ColorBuffer;
-    FIntVector Size(
-        request->width() > 0 ? request->width() : Viewport->GetSizeXY().X,
-        request->height() > 0 ? request->height() : Viewport->GetSizeXY().Y, 0);
+  reply->set_frame_number(GFrameCounter);
+  reply->mutable_results()->Reserve(request.actions_size());
 
-    // Read pixels from the viewport
-    bool bCaptureSuccess = Viewport->ReadPixels(
-        ColorBuffer, FReadSurfaceDataFlags(), FIntRect(0, 0, Size.X, Size.Y));
+  bool bFailed = false;
+  for (int32 Index = 0; Index < request.actions_size(); ++Index) {
+    const uesynth::ActionRequest &action = request.actions(Index);
+    uesynth::FrameResponse *result = reply->add_results();
+    result->set_request_id(action.request_id());
+    const grpc::Status status =
+        ProcessImmediateActionOnGameThread(action, result);
+    if (status.ok()) {
+      continue;
+    }
+    uesynth::StepError *error = reply->add_errors();
+    error->set_index(Index);
+    error->set_code(int32(status.error_code()));
+    error->set_message(status.error_message());
+    if (!request.continue_on_error()) {
+      bFailed = true;
+      break;
+    }
+  }
 
-    if (!bCaptureSuccess || ColorBuffer.Num() == 0) {
-      UE_LOG(LogTemp, Error,
-             TEXT("UESynth: Failed to capture viewport pixels"));
-      std::vector<uint8> emptyData;
-      promise.set_value(emptyData);
+  // Everything queued after a lockstep step waits for its frame
+  if (!bFailed && bLockstep) {
+    FUESynthLockstep::Get().Advance(DeltaSeconds);
+  } else if (!bFailed && DeltaSeconds > 0.0f) {
+    const grpc::Status TickStatus = TickWorld(World, DeltaSeconds);
+    if (!TickStatus.ok()) {
+      OnDone(TickStatus);
       return;
     }
+  }
+  if (World) {
+    reply->set_world_time_seconds(World->GetTimeSeconds());
+  }
+
+  if (bFailed || request.capture().modalities() == 0) {
+    OnDone(grpc::Status::OK);
+    return;
+  }
+  // Requested right away, so the frame it reads back is the one that renders
+  // everything above, and in lockstep the one the step lets through
+  if (!Recording) {
+    CaptureMultiOnGameThread(request.capture(), reply->mutable_images(),
+                             MoveTemp(OnDone));
+    return;
+  }
+
+  // Pushed through the recording as if its subscription had taken it, so the
+  // pixels never come back to the client
+  TSharedRef<uesynth::FrameResponse> Frame =
+      MakeShared<uesynth::FrameResponse>();
+  Frame->set_request_id(request.recording_id());
+  uesynth::SubscriptionFrame *Recorded = Frame->mutable_subscription_frame();
+  Recorded->set_frame_number(reply->frame_number());
+  FillFramePoseOnGameThread(request.capture().camera_name(), Recorded);
+  CaptureMultiOnGameThread(
+      request.capture(), Recorded->mutable_images(),
+      [Frame, Recording, OnDone = MoveTemp(OnDone)](
+          const grpc::Status &Status) mutable {
+        if (Status.ok()) {
+          Recording->Push(MoveTemp(*Frame));
+        }
+        OnDone(Status);
+      });
+}
+
+grpc::Status
+UESynthServiceImpl::SetLockstep(grpc::ServerContext *context,
+                                const uesynth::SetLockstepRequest *request,
+                                uesynth::LockstepState *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetLockstepOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetLockstepOnGameThread(
+    const uesynth::SetLockstepRequest &request, uesynth::LockstepState *reply,
+    const TSharedPtr<FUESynthStreamLink> &stream) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::SetLockstepOnGameThread);
+  FUESynthLockstep &Lockstep = FUESynthLockstep::Get();
+  FString Error;
+  if (!Lockstep.Configure(request, stream, &Error)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        TCHAR_TO_UTF8(*Error));
+  }
+  Lockstep.GetState(reply);
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::StartRecording(
+    grpc::ServerContext *context, const uesynth::StartRecordingRequest *request,
+    uesynth::RecordingStats *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return StartRecordingOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::StartRecordingOnGameThread(
+    const uesynth::StartRecordingRequest &request,
+    uesynth::RecordingStats *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::StartRecordingOnGameThread);
+  if (request.recording_id().empty()) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Recordings need a recording_id");
+  }
+  if (FUESynthRecordings::GetDirectory(request).IsEmpty()) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "directory must be a relative path that stays under "
+                        "Saved/UESynth/Recordings");
+  }
+  const uesynth::SubscribeRequest &subscription = request.subscription();
+  if (subscription.capture().modalities() != 0) {
+    const grpc::Status RequestStatus = CheckSubscribeRequest(subscription);
+    if (!RequestStatus.ok()) {
+      return RequestStatus;
+    }
+    const grpc::Status CaptureStatus =
+        CheckRecordedCapture(subscription.capture());
+    if (!CaptureStatus.ok()) {
+      return CaptureStatus;
+    }
+    if (subscription.delta_tile_size() != 0) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Recordings store whole frames; leave "
+                          "delta_tile_size at 0");
+    }
+  }
+
+  FString Error;
+  if (!FUESynthRecordings::Get().Start(*this, request, reply, &Error)) {
+    return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                        TCHAR_TO_UTF8(*Error));
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::StopRecording(
+    grpc::ServerContext *context, const uesynth::StopRecordingRequest *request,
+    uesynth::RecordingStats *reply) {
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Mutation,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        StopRecordingOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::StopRecordingOnGameThread(
+    const uesynth::StopRecordingRequest &request,
+    uesynth::RecordingStats *reply, FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::StopRecordingOnGameThread);
+  FUESynthRecordings &Recordings = FUESynthRecordings::Get();
+  if (!Recordings.FindLink(request.recording_id())) {
+    OnDone(grpc::Status(grpc::StatusCode::NOT_FOUND,
+                        "No recording '" + request.recording_id() + "'"));
+    return;
+  }
+  Recordings.Stop(request.recording_id(),
+                  [reply, OnDone = MoveTemp(OnDone)](
+                      const uesynth::RecordingStats &Stats) mutable {
+                    *reply = Stats;
+                    OnDone(grpc::Status::OK);
+                  });
+}
+
+void UESynthServiceImpl::CaptureCamerasOnGameThread(
+    const uesynth::CaptureCamerasRequest &request,
+    FResponseCallback &&OnResponse, FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::CaptureCamerasOnGameThread);
+  if (request.camera_names_size() == 0) {
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "No cameras requested"));
+    return;
+  }
+  if (request.modalities() == 0) {
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "No modalities requested"));
+    return;
+  }
 
-    // Convert FColor array to RGBA bytes
-    std::vector<uint8> imageData;
-    imageData.reserve(ColorBuffer.Num() * 4);
+  const EUESynthCaptureModality Modalities =
+      EUESynthCaptureModality(request.modalities()) &
+      FUESynthCameraPool::SupportedModalities;
+  if (Modalities == EUESynthCaptureModality::None) {
+    OnDone(grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "Cameras only capture rgb and depth"));
+    return;
+  }
+
+  UESynthPixels::EFormat Format;
+  if (!ToPixelFormat(request.pixel_format(), &Format)) {
+    OnDone(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Unsupported pixel_format"));
+    return;
+  }
+
+  FDepthOptions DepthOptions;
+  const grpc::Status DepthStatus = GetDepthOptions(request, &DepthOptions);
+  if (!DepthStatus.ok()) {
+    OnDone(DepthStatus);
+    return;
+  }
+
+  FCodecOptions CodecOptions;
+  const grpc::Status CodecStatus = GetCodecOptions(request, &CodecOptions);
+  if (!CodecStatus.ok()) {
+    OnDone(CodecStatus);
+    return;
+  }
 
-    for (const FColor &Color : ColorBuffer) {
-      imageData.push_back(Color.R);
-      imageData.push_back(Color.G);
-      imageData.push_back(Color.B);
-      imageData.push_back(Color.A);
+  // Every name is checked before anything renders, so a typo costs no frame
+  TArray<FName> Names;
+  Names.Reserve(request.camera_names_size());
+  for (const std::string &CameraName : request.camera_names()) {
+    const FName Name = GetCameraName(CameraName);
+    const grpc::Status CameraStatus =
+        Name.IsNone() ? grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                     "Empty camera name")
+                      : CheckCamera(Name);
+    if (!CameraStatus.ok()) {
+      OnDone(CameraStatus);
+      return;
     }
+    Names.Add(Name);
+  }
+
+  // Shared by the per-camera completions, which run on background threads
+  struct FBatch {
+    FResponseCallback OnResponse;
+    FReplyCallback OnDone;
+    std::atomic<int32> Remaining{0};
+  };
+  TSharedRef<FBatch> Batch = MakeShared<FBatch>();
+  Batch->OnResponse = MoveTemp(OnResponse);
+  Batch->OnDone = MoveTemp(OnDone);
+  Batch->Remaining = Names.Num();
+
+  // All cameras render in this one pass with no tick in between, each with
+  // its copies queued right behind it, so the readbacks are polled together.
+  // Each camera's images are then encoded in parallel with everyone else's.
+  // A camera that fails to read back or encode still answers, with no
+  // modalities.
+  for (const FName Name : Names) {
+    TUniquePtr<uesynth::FrameResponse> Response =
+        MakeUnique<uesynth::FrameResponse>();
+    uesynth::MultiImageResponse *Reply =
+        Response->mutable_multi_image_response();
+    Reply->set_camera_name(TCHAR_TO_UTF8(*Name.ToString()));
+
+    FUESynthFrameCapture::FOnTextureMapped OnMapped =
+        [Reply, Format, DepthOptions](const FUESynthCapturedTexture &Texture) {
+          switch (Texture.Modality) {
+          case EUESynthCaptureModality::Rgb:
+            return CopyImage(Texture.Frame, Format,
+                             UESynthPixels::FormatName(Format),
+                             Reply->mutable_rgb());
+          case EUESynthCaptureModality::Depth:
+            return CopyDepth(Texture.Frame, DepthOptions,
+                             Reply->mutable_depth());
+          default:
+            return false;
+          }
+        };
+    FUESynthFrameCapture::FOnCaptureComplete OnComplete =
+        [Batch, Name, Reply, CodecOptions, Format,
+         Response = MoveTemp(Response)](
+            EUESynthCaptureModality Captured) mutable {
+          if (Captured == EUESynthCaptureModality::None) {
+            UE_LOG(LogTemp, Error,
+                   TEXT("UESynth: Failed to read back camera '%s'"),
+                   *Name.ToString());
+          }
+          TArray<FUESynthEncodeJob> Jobs =
+              GetEncodeJobs(CodecOptions, Format, Captured, Reply);
+          UESynthImageEncoder::EncodeAsync(
+              MoveTemp(Jobs), [Batch, Captured, Response = MoveTemp(Response)](
+                                  bool bEncoded) mutable {
+                Response->mutable_multi_image_response()->set_modalities(
+                    bEncoded ? uint32(Captured) : 0);
+                Batch->OnResponse(MoveTemp(*Response));
+                if (--Batch->Remaining == 0) {
+                  Batch->OnDone(grpc::Status::OK);
+                }
+              });
+        };
+
+    const FCaptureRegion Region{
+        FIntRect(FIntPoint::ZeroValue, GetViewSize(nullptr, Name))};
+    CaptureCamera(Name, Modalities, Region, MoveTemp(OnMapped),
+                  MoveTemp(OnComplete));
+  }
+}
+
+grpc::Status UESynthServiceImpl::SubscribeOnGameThread(
+    const std::string &subscription_id,
+    const uesynth::SubscribeRequest &request,
+    const TSharedPtr<FUESynthStreamLink> &stream,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::SubscribeOnGameThread);
+  if (!stream) {
+    return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                        "Subscriptions are only available on ControlStream");
+  }
+  if (subscription_id.empty()) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Subscriptions need a request_id");
+  }
+  // Checked once here rather than failing again on every frame
+  const grpc::Status RequestStatus = CheckSubscribeRequest(request);
+  if (!RequestStatus.ok()) {
+    return RequestStatus;
+  }
+
+  if (!FUESynthSubscriptions::Get().Subscribe(*this, stream.ToSharedRef(),
+                                              subscription_id, request)) {
+    reply->set_success(false);
+    reply->set_message("Subscription '" + subscription_id +
+                       "' already exists");
+    return grpc::Status::OK;
+  }
+  reply->set_success(true);
+  reply->set_message("Subscribed");
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::UnsubscribeOnGameThread(
+    const uesynth::UnsubscribeRequest &request,
+    const TSharedPtr<FUESynthStreamLink> &stream,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::UnsubscribeOnGameThread);
+  if (!stream) {
+    return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                        "Subscriptions are only available on ControlStream");
+  }
+  if (!FUESynthSubscriptions::Get().Unsubscribe(*stream,
+                                                request.subscription_id())) {
+    reply->set_success(false);
+    reply->set_message("Subscription '" + request.subscription_id() +
+                       "' not found");
+    return grpc::Status::OK;
+  }
+  reply->set_success(true);
+  reply->set_message("Unsubscribed");
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::GetStreamStatsOnGameThread(
+    const TSharedPtr<FUESynthStreamLink> &stream, uesynth::StreamStats *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::GetStreamStatsOnGameThread);
+  if (!stream) {
+    return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                        "Stream stats are only available on ControlStream");
+  }
+  FUESynthWriteQueueStats Stats;
+  if (!stream->GetWriteQueueStats(&Stats)) {
+    return grpc::Status(grpc::StatusCode::CANCELLED, "Stream has ended");
+  }
+  reply->set_queue_depth(Stats.Depth);
+  reply->set_queue_capacity(Stats.Capacity);
+  reply->set_peak_queue_depth(Stats.PeakDepth);
+  reply->set_dropped_responses(Stats.Dropped);
+  reply->set_policy(FUESynthWriteQueue::PolicyName(Stats.Policy));
+  return grpc::Status::OK;
+}
 
-    UE_LOG(LogTemp, Log,
-           TEXT("UESynth: Successfully captured %dx%d image with %d pixels"),
-           Size.X, Size.Y, ColorBuffer.Num());
+grpc::Status UESynthServiceImpl::OpenSharedMemoryOnGameThread(
+    const uesynth::OpenSharedMemoryRequest &request,
+    const TSharedPtr<FUESynthStreamLink> &stream,
+    uesynth::SharedMemoryInfo *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::OpenSharedMemoryOnGameThread);
+  if (!stream) {
+    return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                        "Shared memory is only available on ControlStream");
+  }
+  if (stream->IsDetached()) {
+    return grpc::Status(grpc::StatusCode::CANCELLED, "Stream has ended");
+  }
 
-    promise.set_value(imageData);
-  });
+  // Asking again answers with the region already open
+  if (const TSharedPtr<FUESynthSharedMemory> Existing =
+          stream->GetSharedMemory()) {
+    Existing->GetInfo(reply);
+    return grpc::Status::OK;
+  }
 
-  auto data = future.get();
-  if (data.empty()) {
-    return grpc::Status(grpc::StatusCode::INTERNAL, "Failed to capture image");
+  const uint32 SlotCount = request.slot_count() == 0
+                               ? FUESynthSharedMemory::DefaultSlotCount
+                               : request.slot_count();
+  const uint64 SlotSize = request.slot_size() == 0
+                              ? FUESynthSharedMemory::DefaultSlotSize
+                              : request.slot_size();
+  if (SlotCount > FUESynthSharedMemory::MaxSlotCount) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "slot_count must be at most 64");
+  }
+  if (SlotSize <= FUESynthSharedMemory::HeaderSize ||
+      SlotSize > FUESynthSharedMemory::MaxSlotSize) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "slot_size must be over 64 bytes and at most 256 MiB");
+  }
+  if (SlotCount * SlotSize > FUESynthSharedMemory::MaxRegionSize) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "slot_count * slot_size must be at most 1 GiB");
   }
 
-  reply->set_image_data(data.data(), data.size());
-  reply->set_width(request->width() > 0 ? request->width()
-                                        : 1920); // Default fallback
-  reply->set_height(request->height() > 0 ? request->height()
-                                          : 1080); // Default fallback
-  reply->set_format("rgba");
+  const TSharedPtr<FUESynthSharedMemory> SharedMemory =
+      FUESynthSharedMemory::Create(SlotCount, SlotSize);
+  if (!SharedMemory) {
+    return grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                        "Could not create a shared memory region");
+  }
+  SharedMemory->GetInfo(reply);
+  stream->SetSharedMemory(SharedMemory);
   return grpc::Status::OK;
 }
 
@@ -353,45 +2140,29 @@ grpc::Status UESynthServiceImpl::GetCameraTransform(
     grpc::ServerContext *context,
     const uesynth::GetCameraTransformRequest *request,
     uesynth::GetCameraTransformResponse *reply) {
-  // Get camera transform using proper world access
-  auto future =
-      Async(EAsyncExecution::TaskGraphMainThread, [request]() -> FTransform {
-        // Get world from game engine - try multiple approaches
-        UWorld *World = nullptr;
-
-        // Method 1: Try to get world from world contexts
-        if (GEngine && GEngine->GetWorldContexts().Num() > 0) {
-          for (const FWorldContext &WorldContext :
-               GEngine->GetWorldContexts()) {
-            if (WorldContext.World() &&
-                WorldContext.WorldType == EWorldType::Game) {
-              World = WorldContext.World();
-              break;
-            }
-          }
-        }
-
-        // Method 2: Fallback to PIE world if in editor
-        if (!World && GEngine) {
-          World = GEngine->GetCurrentPlayWorld();
-        }
-
-        // Method 3: Last resort - get any valid world
-        if (!World && GEngine && GEngine->GetWorldContexts().Num() > 0) {
-          World = GEngine->GetWorldContexts()[0].World();
-        }
-
-        if (World) {
-          AActor *Camera = UGameplayStatics::GetActorOfClass(
-              World, ACameraActor::StaticClass());
-          if (Camera) {
-            return Camera->GetActorTransform();
-          }
-        }
-        return FTransform::Identity;
-      });
+  return RunOnGameThread(context, EUESynthCommandKind::Query,
+                         [this, request, reply]() {
+                           return GetCameraTransformOnGameThread(
+                               *request, reply);
+                         });
+}
 
-  FTransform CameraTransform = future.Get();
+grpc::Status UESynthServiceImpl::GetCameraTransformOnGameThread(
+    const uesynth::GetCameraTransformRequest &request,
+    uesynth::GetCameraTransformResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::GetCameraTransformOnGameThread);
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  UWorld *World = Scene.GetWorld();
+
+  FTransform CameraTransform = FTransform::Identity;
+  if (World) {
+    ACameraActor *Camera =
+        Scene.FindCamera(UTF8_TO_TCHAR(request.camera_name().c_str()));
+    if (Camera) {
+      CameraTransform = Camera->GetActorTransform();
+    }
+  }
 
   // Populate the reply with the transform data
   reply->mutable_transform()->mutable_location()->set_x(
@@ -409,38 +2180,217 @@ grpc::Status UESynthServiceImpl::GetCameraTransform(
   return grpc::Status::OK;
 }
 
+void UESynthServiceImpl::FillFramePoseOnGameThread(
+    const std::string &camera_name, uesynth::SubscriptionFrame *frame) {
+  uesynth::GetCameraTransformRequest Request;
+  Request.set_camera_name(camera_name);
+  uesynth::GetCameraTransformResponse Response;
+  GetCameraTransformOnGameThread(Request, &Response);
+  *frame->mutable_camera_transform() = Response.transform();
+  if (UWorld *World = FUESynthSceneContext::Get().GetWorld()) {
+    frame->set_world_time_seconds(World->GetTimeSeconds());
+  }
+}
+
 grpc::Status
 UESynthServiceImpl::CaptureDepthMap(grpc::ServerContext *context,
                                     const uesynth::CaptureRequest *request,
                                     uesynth::ImageResponse *reply) {
-  // Placeholder implementation
-  reply->set_width(request->width());
-  reply->set_height(request->height());
-  reply->set_format("png");
-  std::string dummyData(request->width() * request->height(), '\0');
-  reply->set_image_data(dummyData);
-  return grpc::Status::OK;
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Capture,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        CaptureDepthMapOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::CaptureDepthMapOnGameThread(
+    const uesynth::CaptureRequest &request, uesynth::ImageResponse *reply,
+    FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::CaptureDepthMapOnGameThread);
+  const grpc::Status CaptureFailed(grpc::StatusCode::INTERNAL,
+                                   "Failed to capture depth");
+
+  FDepthOptions DepthOptions;
+  const grpc::Status DepthStatus = GetDepthOptions(request, &DepthOptions);
+  if (!DepthStatus.ok()) {
+    OnDone(DepthStatus);
+    return;
+  }
+
+  EUESynthImageCodec Codec;
+  const grpc::Status CodecStatus = GetCodec(request.codec(), false, &Codec);
+  if (!CodecStatus.ok()) {
+    OnDone(CodecStatus);
+    return;
+  }
+
+  FUESynthFrameCapture *FrameCapture = FUESynthFrameCapture::Get();
+  if (!FrameCapture) {
+    OnDone(grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                        "Engine is still starting up"));
+    return;
+  }
+
+  FName CameraName = GetCameraName(request.camera_name());
+  FViewport *Viewport = nullptr;
+  const grpc::Status ViewStatus = FindCaptureView(&CameraName, &Viewport);
+  if (!ViewStatus.ok()) {
+    OnDone(ViewStatus);
+    return;
+  }
+
+  FCaptureRegion Region;
+  const grpc::Status RegionStatus =
+      GetCaptureRegion(request, GetViewSize(Viewport, CameraName), &Region);
+  if (!RegionStatus.ok()) {
+    OnDone(RegionStatus);
+    return;
+  }
+
+  // Scene depth, linearized on the GPU for the game view or rendered as such
+  // by a camera's scene capture, is converted straight into image_data and
+  // only then compressed, if the request asked for it
+  FUESynthFrameCapture::FOnTextureMapped OnMapped =
+      [reply, DepthOptions](const FUESynthCapturedTexture &Texture) {
+        return CopyDepth(Texture.Frame, DepthOptions, reply);
+      };
+  FUESynthFrameCapture::FOnCaptureComplete OnComplete =
+      [reply, Codec, CaptureFailed,
+       OnDone = MoveTemp(OnDone)](EUESynthCaptureModality Captured) mutable {
+        if (Captured == EUESynthCaptureModality::None) {
+          UE_LOG(LogTemp, Error, TEXT("UESynth: Failed to read back depth"));
+          OnDone(CaptureFailed);
+          return;
+        }
+        EncodeThenReply({FUESynthEncodeJob{reply, Codec}}, MoveTemp(OnDone));
+      };
+
+  if (Viewport) {
+    FrameCapture->Request(EUESynthCaptureModality::Depth, Region.Rect,
+                          Region.OutputSize, MoveTemp(OnMapped),
+                          MoveTemp(OnComplete));
+  } else {
+    CaptureCamera(CameraName, EUESynthCaptureModality::Depth, Region,
+                  MoveTemp(OnMapped), MoveTemp(OnComplete));
+  }
 }
 
 grpc::Status UESynthServiceImpl::CaptureSegmentationMask(
     grpc::ServerContext *context, const uesynth::CaptureRequest *request,
     uesynth::ImageResponse *reply) {
-  // Placeholder implementation
-  reply->set_width(request->width());
-  reply->set_height(request->height());
-  reply->set_format("png");
-  std::string dummyData(request->width() * request->height() * 3, '\0');
-  reply->set_image_data(dummyData);
-  return grpc::Status::OK;
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Capture,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        CaptureSegmentationMaskOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::CaptureSegmentationMaskOnGameThread(
+    const uesynth::CaptureRequest &request, uesynth::ImageResponse *reply,
+    FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::CaptureSegmentationMaskOnGameThread);
+  const grpc::Status CaptureFailed(grpc::StatusCode::INTERNAL,
+                                   "Failed to capture segmentation");
+
+  if (!request.camera_name().empty()) {
+    OnDone(grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "Segmentation is only captured from the game view"));
+    return;
+  }
+
+  EUESynthImageCodec Codec;
+  const grpc::Status CodecStatus = GetCodec(request.codec(), false, &Codec);
+  if (!CodecStatus.ok()) {
+    OnDone(CodecStatus);
+    return;
+  }
+
+  FUESynthFrameCapture *FrameCapture = FUESynthFrameCapture::Get();
+  if (!FrameCapture) {
+    OnDone(grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                        "Engine is still starting up"));
+    return;
+  }
+
+  FViewport *Viewport = FindGameViewport();
+  if (!Viewport) {
+    OnDone(CaptureFailed);
+    return;
+  }
+
+  FCaptureRegion Region;
+  const grpc::Status RegionStatus =
+      GetCaptureRegion(request, Viewport->GetSizeXY(), &Region);
+  if (!RegionStatus.ok()) {
+    OnDone(RegionStatus);
+    return;
+  }
+
+  // The table is taken now, on the game thread, from the same registry state
+  // the frame about to be rendered uses
+  FillSegmentationTable(PrepareSegmentation(), request.segmentation_revision(),
+                        reply);
+
+  FrameCapture->Request(
+      EUESynthCaptureModality::Segmentation, Region.Rect, Region.OutputSize,
+      [reply](const FUESynthCapturedTexture &Texture) {
+        return CopySegmentation(Texture.Frame, reply);
+      },
+      [reply, Codec, CaptureFailed,
+       OnDone = MoveTemp(OnDone)](EUESynthCaptureModality Captured) mutable {
+        if (Captured == EUESynthCaptureModality::None) {
+          UE_LOG(LogTemp, Error,
+                 TEXT("UESynth: Failed to read back segmentation"));
+          OnDone(CaptureFailed);
+          return;
+        }
+        EncodeThenReply({FUESynthEncodeJob{reply, Codec}}, MoveTemp(OnDone));
+      });
 }
 
 grpc::Status UESynthServiceImpl::SetObjectTransform(
     grpc::ServerContext *context,
     const uesynth::SetObjectTransformRequest *request,
     uesynth::CommandResponse *reply) {
-  // Placeholder implementation
-  reply->set_success(true);
-  reply->set_message("SetObjectTransform not yet implemented");
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetObjectTransformOnGameThread(
+                               *request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetObjectTransformOnGameThread(
+    const uesynth::SetObjectTransformRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::SetObjectTransformOnGameThread);
+  AActor *Actor = FUESynthSceneContext::Get().GetActors().FindActor(
+      UTF8_TO_TCHAR(request.object_name().c_str()));
+  if (!Actor) {
+    reply->set_success(false);
+    reply->set_message("Object '" + request.object_name() + "' not found");
+    return grpc::Status::OK;
+  }
+
+  // Teleport so simulated bodies follow instead of sweeping to the new pose
+  bool bMoved;
+  if (request.transform().has_scale()) {
+    bMoved = Actor->SetActorTransform(
+        UESynthTransform::ToTransform(request.transform()), false, nullptr,
+        ETeleportType::TeleportPhysics);
+  } else {
+    bMoved = Actor->SetActorLocationAndRotation(
+        UESynthTransform::ToVector(request.transform().location()),
+        UESynthTransform::ToRotator(request.transform().rotation()), false,
+        nullptr, ETeleportType::TeleportPhysics);
+  }
+
+  reply->set_success(bMoved);
+  reply->set_message(bMoved ? "Object transform set successfully"
+                            : "Object '" + request.object_name() +
+                                  "' has no root component to move");
   return grpc::Status::OK;
 }
 
@@ -448,13 +2398,109 @@ grpc::Status UESynthServiceImpl::GetObjectTransform(
     grpc::ServerContext *context,
     const uesynth::GetObjectTransformRequest *request,
     uesynth::GetObjectTransformResponse *reply) {
-  // Placeholder implementation
-  reply->mutable_transform()->mutable_location()->set_x(0.0f);
-  reply->mutable_transform()->mutable_location()->set_y(0.0f);
-  reply->mutable_transform()->mutable_location()->set_z(0.0f);
-  reply->mutable_transform()->mutable_rotation()->set_pitch(0.0f);
-  reply->mutable_transform()->mutable_rotation()->set_yaw(0.0f);
-  reply->mutable_transform()->mutable_rotation()->set_roll(0.0f);
+  return RunOnGameThread(context, EUESynthCommandKind::Query,
+                         [this, request, reply]() {
+                           return GetObjectTransformOnGameThread(
+                               *request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::GetObjectTransformOnGameThread(
+    const uesynth::GetObjectTransformRequest &request,
+    uesynth::GetObjectTransformResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::GetObjectTransformOnGameThread);
+  AActor *Actor = FUESynthSceneContext::Get().GetActors().FindActor(
+      UTF8_TO_TCHAR(request.object_name().c_str()));
+  if (!Actor) {
+    UESynthTransform::FromTransform(FTransform::Identity,
+                                    reply->mutable_transform());
+    reply->set_success(false);
+    reply->set_message("Object '" + request.object_name() + "' not found");
+    return grpc::Status::OK;
+  }
+
+  UESynthTransform::FromTransform(Actor->GetActorTransform(),
+                                  reply->mutable_transform());
+  reply->set_success(true);
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::SetObjectTransformsBatch(
+    grpc::ServerContext *context,
+    const uesynth::SetObjectTransformsBatchRequest *request,
+    uesynth::SetObjectTransformsBatchResponse *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetObjectTransformsBatchOnGameThread(
+                               *request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetObjectTransformsBatchOnGameThread(
+    const uesynth::SetObjectTransformsBatchRequest &request,
+    uesynth::SetObjectTransformsBatchResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::SetObjectTransformsBatchOnGameThread);
+  const int32 Count = GetBatchSize(request);
+  const std::string &Packed = request.packed_transforms();
+  if (Packed.size() != size_t(Count) * UESynthTransform::PackedBytes) {
+    reply->set_message("packed_transforms must hold 9 floats per object");
+    return grpc::Status::OK;
+  }
+
+  // The whole batch is applied in this one game-thread pass
+  const FUESynthActorRegistry &Actors = FUESynthSceneContext::Get().GetActors();
+  const uint8 *Cursor = reinterpret_cast<const uint8 *>(Packed.data());
+  uint32 Applied = 0;
+  for (int32 Index = 0; Index < Count;
+       ++Index, Cursor += UESynthTransform::PackedBytes) {
+    AActor *Actor = FindBatchActor(Actors, request, Index);
+    if (!Actor || !Actor->SetActorTransform(
+                      UESynthTransform::UnpackTransform(Cursor), false,
+                      nullptr, ETeleportType::TeleportPhysics)) {
+      reply->add_failed_indices(Index);
+      continue;
+    }
+    ++Applied;
+  }
+
+  reply->set_applied_count(Applied);
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::GetObjectTransformsBatch(
+    grpc::ServerContext *context,
+    const uesynth::GetObjectTransformsBatchRequest *request,
+    uesynth::GetObjectTransformsBatchResponse *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Query,
+                         [this, request, reply]() {
+                           return GetObjectTransformsBatchOnGameThread(
+                               *request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::GetObjectTransformsBatchOnGameThread(
+    const uesynth::GetObjectTransformsBatchRequest &request,
+    uesynth::GetObjectTransformsBatchResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::GetObjectTransformsBatchOnGameThread);
+  const int32 Count = GetBatchSize(request);
+  const FUESynthActorRegistry &Actors = FUESynthSceneContext::Get().GetActors();
+
+  // Size the output once and pack straight into it
+  std::string *Packed = reply->mutable_packed_transforms();
+  Packed->resize(size_t(Count) * UESynthTransform::PackedBytes);
+  uint8 *Cursor = reinterpret_cast<uint8 *>(&(*Packed)[0]);
+  for (int32 Index = 0; Index < Count;
+       ++Index, Cursor += UESynthTransform::PackedBytes) {
+    const AActor *Actor = FindBatchActor(Actors, request, Index);
+    if (!Actor) {
+      reply->add_missing_indices(Index);
+    }
+    UESynthTransform::PackTransform(
+        Actor ? Actor->GetActorTransform() : FTransform::Identity, Cursor);
+  }
   return grpc::Status::OK;
 }
 
@@ -462,9 +2508,52 @@ grpc::Status
 UESynthServiceImpl::CreateCamera(grpc::ServerContext *context,
                                  const uesynth::CreateCameraRequest *request,
                                  uesynth::CommandResponse *reply) {
-  // Placeholder implementation
-  reply->set_success(true);
-  reply->set_message("CreateCamera not yet implemented");
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return CreateCameraOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::CreateCameraOnGameThread(
+    const uesynth::CreateCameraRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::CreateCameraOnGameThread);
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  UWorld *World = Scene.GetWorld();
+  if (!World) {
+    reply->set_success(false);
+    reply->set_message("No valid world found - make sure game is running");
+    return grpc::Status::OK;
+  }
+
+  const FName CameraName = GetCameraName(request.camera_name());
+  if (CameraName.IsNone()) {
+    reply->set_success(false);
+    reply->set_message("Cameras need a camera_name");
+    return grpc::Status::OK;
+  }
+
+  // Unset dimensions follow the game view, so a camera frames like it
+  UGameViewportClient *ViewportClient = Scene.GetViewportClient();
+  const FIntPoint ViewportSize =
+      ViewportClient && ViewportClient->Viewport
+          ? ViewportClient->Viewport->GetSizeXY()
+          : FUESynthCameraPool::DefaultResolution;
+  FIntPoint Resolution;
+  if (!GetCameraResolution(request.width(), request.height(), ViewportSize,
+                           &Resolution)) {
+    reply->set_success(false);
+    reply->set_message("Camera resolution is out of range");
+    return grpc::Status::OK;
+  }
+
+  const bool bCreated = Scene.GetCameras().CreateCamera(
+      World, CameraName,
+      UESynthTransform::ToTransform(request.initial_transform()), Resolution);
+  reply->set_success(bCreated);
+  reply->set_message(bCreated ? "Camera created successfully"
+                              : "An actor named '" + request.camera_name() +
+                                    "' already exists");
   return grpc::Status::OK;
 }
 
@@ -472,9 +2561,24 @@ grpc::Status
 UESynthServiceImpl::DestroyCamera(grpc::ServerContext *context,
                                   const uesynth::DestroyCameraRequest *request,
                                   uesynth::CommandResponse *reply) {
-  // Placeholder implementation
-  reply->set_success(true);
-  reply->set_message("DestroyCamera not yet implemented");
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return DestroyCameraOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::DestroyCameraOnGameThread(
+    const uesynth::DestroyCameraRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::DestroyCameraOnGameThread);
+  // Its render targets go back to the pool for the next camera of that size
+  FUESynthCameraPool &Cameras = FUESynthSceneContext::Get().GetCameras();
+  const bool bDestroyed =
+      Cameras.DestroyCamera(GetCameraName(request.camera_name()));
+  reply->set_success(bDestroyed);
+  reply->set_message(bDestroyed ? "Camera destroyed successfully"
+                                : "Camera '" + request.camera_name() +
+                                      "' not found");
   return grpc::Status::OK;
 }
 
@@ -482,9 +2586,36 @@ grpc::Status
 UESynthServiceImpl::SetResolution(grpc::ServerContext *context,
                                   const uesynth::SetResolutionRequest *request,
                                   uesynth::CommandResponse *reply) {
-  // Placeholder implementation
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetResolutionOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetResolutionOnGameThread(
+    const uesynth::SetResolutionRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::SetResolutionOnGameThread);
+  FUESynthCameraPool &Cameras = FUESynthSceneContext::Get().GetCameras();
+  const FName CameraName = GetCameraName(request.camera_name());
+  if (!Cameras.Contains(CameraName)) {
+    reply->set_success(false);
+    reply->set_message("Camera '" + request.camera_name() + "' not found");
+    return grpc::Status::OK;
+  }
+
+  // Unset dimensions keep their current value
+  FIntPoint Resolution;
+  if (!GetCameraResolution(request.width(), request.height(),
+                           Cameras.GetResolution(CameraName), &Resolution)) {
+    reply->set_success(false);
+    reply->set_message("Camera resolution is out of range");
+    return grpc::Status::OK;
+  }
+
+  Cameras.SetResolution(CameraName, Resolution);
   reply->set_success(true);
-  reply->set_message("SetResolution not yet implemented");
+  reply->set_message("Resolution set successfully");
   return grpc::Status::OK;
 }
 
@@ -492,45 +2623,379 @@ grpc::Status
 UESynthServiceImpl::CaptureNormals(grpc::ServerContext *context,
                                    const uesynth::CaptureRequest *request,
                                    uesynth::ImageResponse *reply) {
-  // Placeholder implementation
-  reply->set_width(request->width());
-  reply->set_height(request->height());
-  reply->set_format("png");
-  std::string dummyData(request->width() * request->height() * 3, '\0');
-  reply->set_image_data(dummyData);
-  return grpc::Status::OK;
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Capture,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        CaptureNormalsOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::CaptureNormalsOnGameThread(
+    const uesynth::CaptureRequest &request, uesynth::ImageResponse *reply,
+    FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::CaptureNormalsOnGameThread);
+  const grpc::Status CaptureFailed(grpc::StatusCode::INTERNAL,
+                                   "Failed to capture normals");
+
+  if (!request.camera_name().empty()) {
+    OnDone(grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "Normals are only captured from the game view"));
+    return;
+  }
+
+  EUESynthImageCodec Codec;
+  const grpc::Status CodecStatus = GetCodec(request.codec(), true, &Codec);
+  if (!CodecStatus.ok()) {
+    OnDone(CodecStatus);
+    return;
+  }
+  const FUESynthEncodeJob Encoding{reply, Codec, UESynthPixels::EFormat::RGB8,
+                                   GetJpegQuality(request.jpeg_quality())};
+
+  FUESynthFrameCapture *FrameCapture = FUESynthFrameCapture::Get();
+  if (!FrameCapture) {
+    OnDone(grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                        "Engine is still starting up"));
+    return;
+  }
+
+  FViewport *Viewport = FindGameViewport();
+  if (!Viewport) {
+    OnDone(CaptureFailed);
+    return;
+  }
+
+  FCaptureRegion Region;
+  const grpc::Status RegionStatus =
+      GetCaptureRegion(request, Viewport->GetSizeXY(), &Region);
+  if (!RegionStatus.ok()) {
+    OnDone(RegionStatus);
+    return;
+  }
+
+  // Same GBuffer read and layout as the normals of a multi-image capture
+  FrameCapture->Request(
+      EUESynthCaptureModality::Normals, Region.Rect, Region.OutputSize,
+      [reply](const FUESynthCapturedTexture &Texture) {
+        return CopyImage(Texture.Frame, UESynthPixels::EFormat::RGB8,
+                         "normal_rgb8", reply);
+      },
+      [CaptureFailed, Encoding,
+       OnDone = MoveTemp(OnDone)](EUESynthCaptureModality Captured) mutable {
+        if (Captured == EUESynthCaptureModality::None) {
+          UE_LOG(LogTemp, Error, TEXT("UESynth: Failed to read back normals"));
+          OnDone(CaptureFailed);
+          return;
+        }
+        EncodeThenReply({Encoding}, MoveTemp(OnDone));
+      });
 }
 
 grpc::Status
 UESynthServiceImpl::CaptureOpticalFlow(grpc::ServerContext *context,
                                        const uesynth::CaptureRequest *request,
                                        uesynth::ImageResponse *reply) {
-  // Placeholder implementation
-  reply->set_width(request->width());
-  reply->set_height(request->height());
-  reply->set_format("png");
-  std::string dummyData(request->width() * request->height() * 2, '\0');
-  reply->set_image_data(dummyData);
-  return grpc::Status::OK;
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Capture,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        CaptureOpticalFlowOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::CaptureOpticalFlowOnGameThread(
+    const uesynth::CaptureRequest &request, uesynth::ImageResponse *reply,
+    FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::CaptureOpticalFlowOnGameThread);
+  const grpc::Status CaptureFailed(grpc::StatusCode::INTERNAL,
+                                   "Failed to capture optical flow");
+
+  if (!request.camera_name().empty()) {
+    OnDone(grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "Optical flow is only captured from the game view"));
+    return;
+  }
+
+  EUESynthImageCodec Codec;
+  const grpc::Status CodecStatus = GetCodec(request.codec(), false, &Codec);
+  if (!CodecStatus.ok()) {
+    OnDone(CodecStatus);
+    return;
+  }
+
+  FUESynthFrameCapture *FrameCapture = FUESynthFrameCapture::Get();
+  if (!FrameCapture) {
+    OnDone(grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                        "Engine is still starting up"));
+    return;
+  }
+
+  FViewport *Viewport = FindGameViewport();
+  if (!Viewport) {
+    OnDone(CaptureFailed);
+    return;
+  }
+
+  FCaptureRegion Region;
+  const grpc::Status RegionStatus =
+      GetCaptureRegion(request, Viewport->GetSizeXY(), &Region);
+  if (!RegionStatus.ok()) {
+    OnDone(RegionStatus);
+    return;
+  }
+
+  FrameCapture->Request(
+      EUESynthCaptureModality::OpticalFlow, Region.Rect, Region.OutputSize,
+      [reply](const FUESynthCapturedTexture &Texture) {
+        return CopyOpticalFlow(Texture.Frame, reply);
+      },
+      [reply, Codec, CaptureFailed,
+       OnDone = MoveTemp(OnDone)](EUESynthCaptureModality Captured) mutable {
+        if (Captured == EUESynthCaptureModality::None) {
+          UE_LOG(LogTemp, Error,
+                 TEXT("UESynth: Failed to read back optical flow"));
+          OnDone(CaptureFailed);
+          return;
+        }
+        EncodeThenReply({FUESynthEncodeJob{reply, Codec}}, MoveTemp(OnDone));
+      });
 }
 
 grpc::Status
 UESynthServiceImpl::SpawnObject(grpc::ServerContext *context,
                                 const uesynth::SpawnObjectRequest *request,
                                 uesynth::CommandResponse *reply) {
-  // Placeholder implementation
-  reply->set_success(true);
-  reply->set_message("SpawnObject not yet implemented");
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Mutation,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        SpawnObjectOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::SpawnObjectOnGameThread(
+    const uesynth::SpawnObjectRequest &request,
+    uesynth::CommandResponse *reply, FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::SpawnObjectOnGameThread);
+  const FSoftObjectPath Path(UTF8_TO_TCHAR(request.asset_path().c_str()));
+  if (request.if_not_resident() == uesynth::ASSET_MISS_POLICY_FAIL ||
+      !Path.IsValid() || FUESynthAssetCache::Get().Find(Path) ||
+      Path.ResolveObject()) {
+    OnDone(SpawnResidentObjectOnGameThread(request, reply));
+    return;
+  }
+
+  // The frames keep coming while the asset streams in. The request may be
+  // gone by then, and the spawn belongs to the session that asked for it.
+  TSharedPtr<FUESynthSession> Session;
+  if (FUESynthSession *Active = FUESynthSessions::GetActive()) {
+    Session = Active->AsShared();
+  }
+  FUESynthAssetCache::Get().Load(
+      Path, [this, Request = uesynth::SpawnObjectRequest(request), reply,
+             Session = MoveTemp(Session),
+             OnDone = MoveTemp(OnDone)](UObject *Asset) mutable {
+        if (!Asset) {
+          reply->set_success(false);
+          reply->set_message("Asset '" + Request.asset_path() +
+                             "' could not be loaded");
+          OnDone(grpc::Status::OK);
+          return;
+        }
+        FUESynthSessions::FScope Scope(Session.Get());
+        OnDone(SpawnResidentObjectOnGameThread(Request, reply));
+      });
+}
+
+grpc::Status UESynthServiceImpl::SpawnResidentObjectOnGameThread(
+    const uesynth::SpawnObjectRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::SpawnResidentObjectOnGameThread);
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  UWorld *World = Scene.GetWorld();
+  if (!World) {
+    reply->set_success(false);
+    reply->set_message("No valid world found - make sure game is running");
+    return grpc::Status::OK;
+  }
+
+  const FString Name = UTF8_TO_TCHAR(request.object_name().c_str());
+  if (Name.IsEmpty()) {
+    reply->set_success(false);
+    reply->set_message("Spawned objects need an object_name");
+    return grpc::Status::OK;
+  }
+  if (Scene.GetActors().FindActor(Name)) {
+    reply->set_success(false);
+    reply->set_message("An actor named '" + request.object_name() +
+                       "' already exists");
+    return grpc::Status::OK;
+  }
+
+  // Never loads: an asset already in memory but not cached is used as is
+  const FSoftObjectPath Path(UTF8_TO_TCHAR(request.asset_path().c_str()));
+  UObject *Asset = FUESynthAssetCache::Get().Find(Path);
+  if (!Asset && Path.IsValid()) {
+    Asset = Path.ResolveObject();
+  }
+  if (!Asset) {
+    reply->set_success(false);
+    reply->set_message("Asset '" + request.asset_path() +
+                       "' is not resident; preload it first");
+    return grpc::Status::OK;
+  }
+
+  const FTransform Transform =
+      UESynthTransform::ToTransform(request.initial_transform());
+  FUESynthActorPool &Pool = Scene.GetActorPool();
+  const FSoftObjectPath PoolKey(Asset);
+  if (request.pooled() &&
+      Pool.Take(PoolKey, FName(*Name), Transform, Scene.GetActors())) {
+    reply->set_success(true);
+    reply->set_message("Object taken from the pool");
+    return grpc::Status::OK;
+  }
+
+  AActor *Actor = SpawnAsset(World, Asset, FName(*Name), Transform);
+  if (Actor && request.pooled()) {
+    Pool.Track(Actor, PoolKey);
+  }
+  reply->set_success(Actor != nullptr);
+  reply->set_message(Actor ? "Object spawned successfully"
+                           : "Asset '" + request.asset_path() +
+                                 "' is not a static mesh or actor class");
   return grpc::Status::OK;
 }
 
+grpc::Status
+UESynthServiceImpl::PreloadAssets(grpc::ServerContext *context,
+                                  const uesynth::PreloadAssetsRequest *request,
+                                  uesynth::PreloadAssetsResponse *reply) {
+  return RunDeferredOnGameThread(
+      context, EUESynthCommandKind::Query,
+      [this, request, reply](FReplyCallback &&OnDone) {
+        PreloadAssetsOnGameThread(*request, reply, MoveTemp(OnDone));
+      });
+}
+
+void UESynthServiceImpl::PreloadAssetsOnGameThread(
+    const uesynth::PreloadAssetsRequest &request,
+    uesynth::PreloadAssetsResponse *reply, FReplyCallback &&OnDone) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::PreloadAssetsOnGameThread);
+  // The statuses are added now, while the request is still there, and filled
+  // in once the answer is due
+  TSharedRef<FPendingPreload> Pending = MakeShared<FPendingPreload>();
+  Pending->Paths.Reserve(request.asset_paths_size());
+  reply->mutable_assets()->Reserve(request.asset_paths_size());
+  for (const std::string &AssetPath : request.asset_paths()) {
+    Pending->Paths.Emplace(UTF8_TO_TCHAR(AssetPath.c_str()));
+    reply->add_assets()->set_asset_path(AssetPath);
+  }
+  Pending->Reply = reply;
+  Pending->OnDone = MoveTemp(OnDone);
+  // One more than the loads, so loads that complete inline can't answer early
+  Pending->Remaining = 1;
+
+  FUESynthAssetCache &Cache = FUESynthAssetCache::Get();
+  for (const FSoftObjectPath &Path : Pending->Paths) {
+    if (!Path.IsValid()) {
+      continue;
+    }
+    if (!request.wait()) {
+      Cache.Load(Path);
+      continue;
+    }
+    ++Pending->Remaining;
+    Cache.Load(Path, [Pending](UObject *) { FinishPreload(*Pending); });
+  }
+  FinishPreload(*Pending);
+}
+
 grpc::Status
 UESynthServiceImpl::DestroyObject(grpc::ServerContext *context,
                                   const uesynth::DestroyObjectRequest *request,
                                   uesynth::CommandResponse *reply) {
-  // Placeholder implementation
-  reply->set_success(true);
-  reply->set_message("DestroyObject not yet implemented");
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return DestroyObjectOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::DestroyObjectOnGameThread(
+    const uesynth::DestroyObjectRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::DestroyObjectOnGameThread);
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  AActor *Actor =
+      Scene.GetActors().FindActor(UTF8_TO_TCHAR(request.object_name().c_str()));
+  if (!Actor) {
+    reply->set_success(false);
+    reply->set_message("Object '" + request.object_name() + "' not found");
+    return grpc::Status::OK;
+  }
+
+  // A pooled object waits, parked, for the next pooled spawn of its asset
+  if (Scene.GetActorPool().Park(Actor, Scene.GetActors())) {
+    reply->set_success(true);
+    reply->set_message("Object returned to the pool");
+    return grpc::Status::OK;
+  }
+
+  // The world's destroy handler drops the actor from the registry
+  const bool bDestroyed = Actor->Destroy();
+  reply->set_success(bDestroyed);
+  reply->set_message(bDestroyed ? "Object destroyed successfully"
+                                : "Object '" + request.object_name() +
+                                      "' could not be destroyed");
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::ConfigureActorPool(
+    grpc::ServerContext *context,
+    const uesynth::ConfigureActorPoolRequest *request,
+    uesynth::ActorPoolStats *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return ConfigureActorPoolOnGameThread(
+                               *request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::ConfigureActorPoolOnGameThread(
+    const uesynth::ConfigureActorPoolRequest &request,
+    uesynth::ActorPoolStats *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::ConfigureActorPoolOnGameThread);
+  if (request.max_parked_per_asset() >
+      uint32(FUESynthActorPool::MaxParkedPerAssetLimit)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "max_parked_per_asset is out of range");
+  }
+
+  FUESynthActorPool &Pool = FUESynthSceneContext::Get().GetActorPool();
+  if (request.clear()) {
+    Pool.DestroyParked();
+  }
+  if (request.max_parked_per_asset() > 0) {
+    Pool.SetMaxParkedPerAsset(int32(request.max_parked_per_asset()));
+  }
+
+  uint64 Hits = 0;
+  uint64 Misses = 0;
+  for (const auto &Pair : Pool.GetStats()) {
+    uesynth::ActorPoolEntry *Entry = reply->add_pools();
+    Entry->set_asset_path(TCHAR_TO_UTF8(*Pair.Key.ToString()));
+    Entry->set_parked(uint32(Pair.Value.Parked));
+    Entry->set_hits(Pair.Value.Hits);
+    Entry->set_misses(Pair.Value.Misses);
+    Hits += Pair.Value.Hits;
+    Misses += Pair.Value.Misses;
+  }
+  reply->set_max_parked_per_asset(uint32(Pool.GetMaxParkedPerAsset()));
+  reply->set_parked(uint32(Pool.NumParked()));
+  reply->set_hits(Hits);
+  reply->set_misses(Misses);
+  reply->set_discarded(Pool.NumDiscarded());
   return grpc::Status::OK;
 }
 
@@ -538,19 +3003,245 @@ grpc::Status
 UESynthServiceImpl::SetMaterial(grpc::ServerContext *context,
                                 const uesynth::SetMaterialRequest *request,
                                 uesynth::CommandResponse *reply) {
-  // Placeholder implementation
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetMaterialOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetMaterialOnGameThread(
+    const uesynth::SetMaterialRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::SetMaterialOnGameThread);
+  TArray<FUESynthMaterialValue> Values;
+  std::string MissingTexture;
+  grpc::Status Status = ToMaterialValues(request, Values, &MissingTexture);
+  if (!Status.ok()) {
+    return Status;
+  }
+  if (!MissingTexture.empty()) {
+    reply->set_success(false);
+    reply->set_message("Texture '" + MissingTexture +
+                       "' is not loaded; preload it first");
+    return grpc::Status::OK;
+  }
+
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  AActor *Actor = FindMaterialTarget(Scene.GetActors(), request);
+  if (!Actor) {
+    reply->set_success(false);
+    reply->set_message("Object '" + request.object_name() + "' not found");
+    return grpc::Status::OK;
+  }
+  if (!Scene.GetMaterials().Apply(Actor, Values)) {
+    reply->set_success(false);
+    reply->set_message("Object '" + request.object_name() +
+                       "' has no mesh materials");
+    return grpc::Status::OK;
+  }
+
   reply->set_success(true);
-  reply->set_message("SetMaterial not yet implemented");
+  reply->set_message("Material parameters set successfully");
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::SetMaterialsBatch(
+    grpc::ServerContext *context,
+    const uesynth::SetMaterialsBatchRequest *request,
+    uesynth::SetMaterialsBatchResponse *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetMaterialsBatchOnGameThread(
+                               *request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetMaterialsBatchOnGameThread(
+    const uesynth::SetMaterialsBatchRequest &request,
+    uesynth::SetMaterialsBatchResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::SetMaterialsBatchOnGameThread);
+  // Every entry is checked before any is applied, so a malformed batch
+  // leaves the scene as it was
+  const int32 Count = request.objects_size();
+  TArray<TArray<FUESynthMaterialValue>> Values;
+  TBitArray<> Missing(false, Count);
+  Values.SetNum(Count);
+  for (int32 Index = 0; Index < Count; ++Index) {
+    std::string MissingTexture;
+    grpc::Status Status = ToMaterialValues(request.objects(Index),
+                                           Values[Index], &MissingTexture);
+    if (!Status.ok()) {
+      return grpc::Status(Status.error_code(),
+                          "objects[" + std::to_string(Index) +
+                              "]: " + Status.error_message());
+    }
+    Missing[Index] = !MissingTexture.empty();
+  }
+
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  const FUESynthActorRegistry &Actors = Scene.GetActors();
+  FUESynthMaterialCache &Materials = Scene.GetMaterials();
+  uint32 Applied = 0;
+  for (int32 Index = 0; Index < Count; ++Index) {
+    if (Missing[Index] ||
+        !Materials.Apply(FindMaterialTarget(Actors, request.objects(Index)),
+                         Values[Index])) {
+      reply->add_failed_indices(Index);
+      continue;
+    }
+    ++Applied;
+  }
+
+  reply->set_applied_count(Applied);
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::ResolveMaterialParameters(
+    grpc::ServerContext *context,
+    const uesynth::ResolveMaterialParametersRequest *request,
+    uesynth::MaterialParameterIds *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Query,
+                         [this, request, reply]() {
+                           return ResolveMaterialParametersOnGameThread(
+                               *request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::ResolveMaterialParametersOnGameThread(
+    const uesynth::ResolveMaterialParametersRequest &request,
+    uesynth::MaterialParameterIds *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::ResolveMaterialParametersOnGameThread);
+  for (const std::string &Name : request.names()) {
+    if (Name.empty()) {
+      reply->clear_ids();
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Material parameter names can't be empty");
+    }
+    reply->add_ids(
+        FUESynthMaterialCache::ResolveParameter(UTF8_TO_TCHAR(Name.c_str())));
+  }
   return grpc::Status::OK;
 }
 
 grpc::Status
 UESynthServiceImpl::ListObjects(grpc::ServerContext *context,
-                                const google::protobuf::Empty *request,
+                                const uesynth::ListObjectsRequest *request,
                                 uesynth::ListObjectsResponse *reply) {
-  // Placeholder implementation - add some dummy objects
-  reply->add_object_names("DummyObject1");
-  reply->add_object_names("DummyObject2");
+  return RunOnGameThread(context, EUESynthCommandKind::Query,
+                         [this, request, reply]() {
+                           return ListObjectsOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::ListObjectsOnGameThread(
+    const uesynth::ListObjectsRequest &request,
+    uesynth::ListObjectsResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::ListObjectsOnGameThread);
+  FName Tag;
+  const UClass *Class;
+  if (!ResolveActorFilter(request, &Tag, &Class)) {
+    // Nothing can match; answer with an empty list
+    return grpc::Status::OK;
+  }
+
+  TArray<FString> Names;
+  TArray<uint32> Ids;
+  FUESynthSceneContext::Get().GetActors().GetActorNames(Tag, Class, Names,
+                                                        &Ids);
+
+  reply->mutable_object_names()->Reserve(Names.Num());
+  for (const FString &Name : Names) {
+    reply->add_object_names(TCHAR_TO_UTF8(*Name));
+  }
+  reply->mutable_object_ids()->Add(Ids.GetData(), Ids.GetData() + Ids.Num());
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::GetSceneSnapshot(
+    grpc::ServerContext *context,
+    const uesynth::GetSceneSnapshotRequest *request,
+    uesynth::SceneSnapshot *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Query,
+                         [this, request, reply]() {
+                           return GetSceneSnapshotOnGameThread(*request,
+                                                               reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::GetSceneSnapshotOnGameThread(
+    const uesynth::GetSceneSnapshotRequest &request,
+    uesynth::SceneSnapshot *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::GetSceneSnapshotOnGameThread);
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  FUESynthActorRegistry &Actors = Scene.GetActors();
+  const bool bVelocities = request.include_velocities();
+  const bool bVisibility = request.include_visibility();
+  const int32 NumFields = UESynthTransform::PackedFloats +
+                          (bVelocities ? 3 : 0) + (bVisibility ? 1 : 0);
+  reply->set_num_fields(NumFields);
+  reply->set_frame_number(GFrameCounter);
+  if (const UWorld *World = Scene.GetWorld()) {
+    reply->set_world_time_seconds(World->GetTimeSeconds());
+  }
+
+  // A diff needs every change since the client's snapshot still on record
+  const uint64 Since = request.since_sequence();
+  const bool bFull = Since == 0 || !Actors.CanDiffSince(Since);
+  reply->set_full(bFull);
+
+  // One row of fields per object while visiting, transposed into planes below
+  TArray<float> Rows;
+  FName Tag;
+  const UClass *Class;
+  if (ResolveActorFilter(request, &Tag, &Class)) {
+    Actors.ForEachChangedActor(
+        bFull ? 0 : Since, bVelocities, bVisibility,
+        [&](AActor &Actor, uint32 Id, FName Name,
+            const FUESynthActorRegistry::FActorState &State) {
+          if ((!Tag.IsNone() && !Actor.ActorHasTag(Tag)) ||
+              (Class && !Actor.IsA(Class))) {
+            return;
+          }
+          reply->add_object_ids(Id);
+          if (request.include_names()) {
+            reply->add_object_names(TCHAR_TO_UTF8(*Name.ToString()));
+          }
+          float *Row = Rows.GetData() + Rows.AddUninitialized(NumFields);
+          UESynthTransform::ToPackedFloats(Actor.GetActorTransform(), Row);
+          Row += UESynthTransform::PackedFloats;
+          if (bVelocities) {
+            *Row++ = float(State.Velocity.X);
+            *Row++ = float(State.Velocity.Y);
+            *Row++ = float(State.Velocity.Z);
+          }
+          if (bVisibility) {
+            *Row = State.bVisible ? 1.f : 0.f;
+          }
+        });
+  }
+  if (!bFull) {
+    TArray<uint32> Removed;
+    Actors.GetRemovedSince(Since, Removed);
+    reply->mutable_removed_ids()->Add(Removed.GetData(),
+                                      Removed.GetData() + Removed.Num());
+  }
+  // Read after visiting, which stamps actors whose velocity or visibility
+  // changed
+  reply->set_sequence(Actors.GetChangeSequence());
+
+  // Planes, so each field reads back as one contiguous array
+  const int32 Count = reply->object_ids_size();
+  std::string *Packed = reply->mutable_packed_state();
+  Packed->resize(size_t(Count) * NumFields * sizeof(float));
+  uint8 *Cursor = reinterpret_cast<uint8 *>(&(*Packed)[0]);
+  for (int32 Field = 0; Field < NumFields; ++Field) {
+    for (int32 Index = 0; Index < Count; ++Index, Cursor += sizeof(float)) {
+      FMemory::Memcpy(Cursor, &Rows[Index * NumFields + Field], sizeof(float));
+    }
+  }
   return grpc::Status::OK;
 }
 
@@ -558,8 +3249,92 @@ grpc::Status
 UESynthServiceImpl::SetLighting(grpc::ServerContext *context,
                                 const uesynth::SetLightingRequest *request,
                                 uesynth::CommandResponse *reply) {
-  // Placeholder implementation
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetLightingOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetLightingOnGameThread(
+    const uesynth::SetLightingRequest &request,
+    uesynth::CommandResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(UESynthServiceImpl::SetLightingOnGameThread);
+  ULightComponent *Light =
+      WriteLightUpdate(FUESynthSceneContext::Get(), request);
+  if (!Light) {
+    reply->set_success(false);
+    reply->set_message("Light '" + request.light_name() +
+                       "' not found, or not movable or stationary");
+    return grpc::Status::OK;
+  }
+  if (ChangesLightColor(request)) {
+    Light->UpdateColorAndBrightness();
+  }
+
   reply->set_success(true);
-  reply->set_message("SetLighting not yet implemented");
+  reply->set_message("Lighting set successfully");
+  return grpc::Status::OK;
+}
+
+grpc::Status UESynthServiceImpl::SetLightingBatch(
+    grpc::ServerContext *context,
+    const uesynth::SetLightingBatchRequest *request,
+    uesynth::SetLightingBatchResponse *reply) {
+  return RunOnGameThread(context, EUESynthCommandKind::Mutation,
+                         [this, request, reply]() {
+                           return SetLightingBatchOnGameThread(*request, reply);
+                         });
+}
+
+grpc::Status UESynthServiceImpl::SetLightingBatchOnGameThread(
+    const uesynth::SetLightingBatchRequest &request,
+    uesynth::SetLightingBatchResponse *reply) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(
+      UESynthServiceImpl::SetLightingBatchOnGameThread);
+  // Every update is written first; then each light whose color or brightness
+  // changed, however often the batch names it, is pushed to the renderer once
+  FUESynthSceneContext &Scene = FUESynthSceneContext::Get();
+  TArray<ULightComponent *, TInlineAllocator<64>> Recolored;
+  uint32 Applied = 0;
+  for (int32 Index = 0; Index < request.lights_size(); ++Index) {
+    const uesynth::SetLightingRequest &Update = request.lights(Index);
+    ULightComponent *Light = WriteLightUpdate(Scene, Update);
+    if (!Light) {
+      reply->add_failed_indices(Index);
+      continue;
+    }
+    if (ChangesLightColor(Update)) {
+      Recolored.AddUnique(Light);
+    }
+    ++Applied;
+  }
+  for (ULightComponent *Light : Recolored) {
+    Light->UpdateColorAndBrightness();
+  }
+
+  reply->set_applied_count(Applied);
+  return grpc::Status::OK;
+}
+
+// Answered on the calling thread, so a game thread that stalls can still be
+// looked at
+grpc::Status
+UESynthServiceImpl::GetServerStats(grpc::ServerContext *context,
+                                   const uesynth::GetServerStatsRequest *request,
+                                   uesynth::ServerStats *reply) {
+  FUESynthServerStats &Stats = FUESynthServerStats::Get();
+  Stats.Fill(reply);
+  if (request->reset()) {
+    Stats.Reset();
+  }
+  return grpc::Status::OK;
+}
+
+// Also answered on the calling thread, from what the game thread saw on its last
+// frame, so a fleet can poll it without queueing behind the work it balances
+grpc::Status UESynthServiceImpl::GetHealth(grpc::ServerContext *context,
+                                           const uesynth::HealthRequest *request,
+                                           uesynth::HealthStatus *reply) {
+  FUESynthHealth::Get().Fill(reply);
   return grpc::Status::OK;
 }
\ No newline at end of file
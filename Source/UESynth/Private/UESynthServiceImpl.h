@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include "UESynthCommandQueue.h"
 #include "pb/uesynth.grpc.pb.h"
 #include "pb/uesynth.pb.h"
 #include <grpcpp/grpcpp.h>
-#include <google/protobuf/empty.pb.h>
+
+class FUESynthStreamLink;
 
 class UESynthServiceImpl final : public uesynth::UESynthService::Service {
 public:
@@ -18,18 +20,111 @@ public:
     grpc::Status CaptureSegmentationMask(grpc::ServerContext* context, const uesynth::CaptureRequest* request, uesynth::ImageResponse* reply) override;
     grpc::Status SetObjectTransform(grpc::ServerContext* context, const uesynth::SetObjectTransformRequest* request, uesynth::CommandResponse* reply) override;
     grpc::Status GetObjectTransform(grpc::ServerContext* context, const uesynth::GetObjectTransformRequest* request, uesynth::GetObjectTransformResponse* reply) override;
+    grpc::Status SetObjectTransformsBatch(grpc::ServerContext* context, const uesynth::SetObjectTransformsBatchRequest* request, uesynth::SetObjectTransformsBatchResponse* reply) override;
+    grpc::Status GetObjectTransformsBatch(grpc::ServerContext* context, const uesynth::GetObjectTransformsBatchRequest* request, uesynth::GetObjectTransformsBatchResponse* reply) override;
     grpc::Status CreateCamera(grpc::ServerContext* context, const uesynth::CreateCameraRequest* request, uesynth::CommandResponse* reply) override;
     grpc::Status DestroyCamera(grpc::ServerContext* context, const uesynth::DestroyCameraRequest* request, uesynth::CommandResponse* reply) override;
     grpc::Status SetResolution(grpc::ServerContext* context, const uesynth::SetResolutionRequest* request, uesynth::CommandResponse* reply) override;
     grpc::Status CaptureNormals(grpc::ServerContext* context, const uesynth::CaptureRequest* request, uesynth::ImageResponse* reply) override;
     grpc::Status CaptureOpticalFlow(grpc::ServerContext* context, const uesynth::CaptureRequest* request, uesynth::ImageResponse* reply) override;
     grpc::Status SpawnObject(grpc::ServerContext* context, const uesynth::SpawnObjectRequest* request, uesynth::CommandResponse* reply) override;
+    grpc::Status PreloadAssets(grpc::ServerContext* context, const uesynth::PreloadAssetsRequest* request, uesynth::PreloadAssetsResponse* reply) override;
     grpc::Status DestroyObject(grpc::ServerContext* context, const uesynth::DestroyObjectRequest* request, uesynth::CommandResponse* reply) override;
+    grpc::Status ConfigureActorPool(grpc::ServerContext* context, const uesynth::ConfigureActorPoolRequest* request, uesynth::ActorPoolStats* reply) override;
     grpc::Status SetMaterial(grpc::ServerContext* context, const uesynth::SetMaterialRequest* request, uesynth::CommandResponse* reply) override;
-    grpc::Status ListObjects(grpc::ServerContext* context, const google::protobuf::Empty* request, uesynth::ListObjectsResponse* reply) override;
+    grpc::Status SetMaterialsBatch(grpc::ServerContext* context, const uesynth::SetMaterialsBatchRequest* request, uesynth::SetMaterialsBatchResponse* reply) override;
+    grpc::Status ResolveMaterialParameters(grpc::ServerContext* context, const uesynth::ResolveMaterialParametersRequest* request, uesynth::MaterialParameterIds* reply) override;
+    grpc::Status ListObjects(grpc::ServerContext* context, const uesynth::ListObjectsRequest* request, uesynth::ListObjectsResponse* reply) override;
+    grpc::Status GetSceneSnapshot(grpc::ServerContext* context, const uesynth::GetSceneSnapshotRequest* request, uesynth::SceneSnapshot* reply) override;
     grpc::Status SetLighting(grpc::ServerContext* context, const uesynth::SetLightingRequest* request, uesynth::CommandResponse* reply) override;
+    grpc::Status SetLightingBatch(grpc::ServerContext* context, const uesynth::SetLightingBatchRequest* request, uesynth::SetLightingBatchResponse* reply) override;
+    grpc::Status CaptureMulti(grpc::ServerContext* context, const uesynth::CaptureMultiRequest* request, uesynth::MultiImageResponse* reply) override;
+    grpc::Status Step(grpc::ServerContext* context, const uesynth::StepRequest* request, uesynth::StepResponse* reply) override;
+    grpc::Status SetLockstep(grpc::ServerContext* context, const uesynth::SetLockstepRequest* request, uesynth::LockstepState* reply) override;
+    grpc::Status StartRecording(grpc::ServerContext* context, const uesynth::StartRecordingRequest* request, uesynth::RecordingStats* reply) override;
+    grpc::Status StopRecording(grpc::ServerContext* context, const uesynth::StopRecordingRequest* request, uesynth::RecordingStats* reply) override;
+    grpc::Status GetServerStats(grpc::ServerContext* context, const uesynth::GetServerStatsRequest* request, uesynth::ServerStats* reply) override;
+    grpc::Status GetHealth(grpc::ServerContext* context, const uesynth::HealthRequest* request, uesynth::HealthStatus* reply) override;
 
 public:
-    // Helper method to process individual actions (public for testing)
+    // Completion for handlers that may finish after the game thread has moved on
+    using FReplyCallback = TUniqueFunction<void(const grpc::Status&)>;
+
+    // Receives each response of an action that answers with more than one
+    using FResponseCallback = TUniqueFunction<void(uesynth::FrameResponse&&)>;
+
+    // Helper method to process individual actions (public for testing).
+    // Blocks the calling thread until the action has completed.
     grpc::Status ProcessAction(const uesynth::ActionRequest& request, uesynth::FrameResponse* response);
-}; 
\ No newline at end of file
+
+    // Same dispatch as ProcessAction, but must be called on the game thread and never blocks on it.
+    // OnDone runs inline for most actions; captures call it from a background thread once their
+    // GPU readback lands. request only has to outlive the call, response has to outlive OnDone.
+    // stream is the ControlStream call the action came in on, which subscriptions push frames to.
+    void ProcessActionOnGameThread(const uesynth::ActionRequest& request, uesynth::FrameResponse* response, FReplyCallback&& OnDone, const TSharedPtr<FUESynthStreamLink>& stream = nullptr);
+
+    // Whether an action answers through StreamActionOnGameThread rather than ProcessActionOnGameThread
+    static bool IsStreamedAction(const uesynth::ActionRequest& request);
+
+    // ProcessActionOnGameThread for streamed actions. OnResponse runs once per response, each stamped
+    // with the request's request_id, and may run on several background threads at once; OnDone runs
+    // after the last of them. request only has to outlive the call.
+    void StreamActionOnGameThread(const uesynth::ActionRequest& request, FResponseCallback&& OnResponse, FReplyCallback&& OnDone);
+
+    // Blocking form of StreamActionOnGameThread that collects the responses (public for testing)
+    grpc::Status ProcessStreamedAction(const uesynth::ActionRequest& request, TArray<uesynth::FrameResponse>* responses);
+
+    // Whether an action mutates the scene, queries it or captures it
+    static EUESynthCommandKind GetActionKind(const uesynth::ActionRequest& request);
+
+    // Game-thread bodies of the handlers that touch the world
+    grpc::Status SetCameraTransformOnGameThread(const uesynth::SetCameraTransformRequest& request, uesynth::CommandResponse* reply);
+    grpc::Status GetCameraTransformOnGameThread(const uesynth::GetCameraTransformRequest& request, uesynth::GetCameraTransformResponse* reply);
+    void CaptureRgbImageOnGameThread(const uesynth::CaptureRequest& request, uesynth::ImageResponse* reply, FReplyCallback&& OnDone);
+    void CaptureDepthMapOnGameThread(const uesynth::CaptureRequest& request, uesynth::ImageResponse* reply, FReplyCallback&& OnDone);
+    void CaptureSegmentationMaskOnGameThread(const uesynth::CaptureRequest& request, uesynth::ImageResponse* reply, FReplyCallback&& OnDone);
+    void CaptureNormalsOnGameThread(const uesynth::CaptureRequest& request, uesynth::ImageResponse* reply, FReplyCallback&& OnDone);
+    void CaptureOpticalFlowOnGameThread(const uesynth::CaptureRequest& request, uesynth::ImageResponse* reply, FReplyCallback&& OnDone);
+    void CaptureMultiOnGameThread(const uesynth::CaptureMultiRequest& request, uesynth::MultiImageResponse* reply, FReplyCallback&& OnDone);
+    void CaptureCamerasOnGameThread(const uesynth::CaptureCamerasRequest& request, FResponseCallback&& OnResponse, FReplyCallback&& OnDone);
+    grpc::Status SetObjectTransformOnGameThread(const uesynth::SetObjectTransformRequest& request, uesynth::CommandResponse* reply);
+    grpc::Status GetObjectTransformOnGameThread(const uesynth::GetObjectTransformRequest& request, uesynth::GetObjectTransformResponse* reply);
+    grpc::Status SetObjectTransformsBatchOnGameThread(const uesynth::SetObjectTransformsBatchRequest& request, uesynth::SetObjectTransformsBatchResponse* reply);
+    grpc::Status GetObjectTransformsBatchOnGameThread(const uesynth::GetObjectTransformsBatchRequest& request, uesynth::GetObjectTransformsBatchResponse* reply);
+    grpc::Status CreateCameraOnGameThread(const uesynth::CreateCameraRequest& request, uesynth::CommandResponse* reply);
+    grpc::Status DestroyCameraOnGameThread(const uesynth::DestroyCameraRequest& request, uesynth::CommandResponse* reply);
+    grpc::Status SetResolutionOnGameThread(const uesynth::SetResolutionRequest& request, uesynth::CommandResponse* reply);
+    // Spawns once the asset is resident, streaming it in first unless the request says to fail.
+    // request only has to outlive the call, reply has to outlive OnDone.
+    void SpawnObjectOnGameThread(const uesynth::SpawnObjectRequest& request, uesynth::CommandResponse* reply, FReplyCallback&& OnDone);
+    // SpawnObjectOnGameThread for an asset that must be resident already; never loads anything
+    grpc::Status SpawnResidentObjectOnGameThread(const uesynth::SpawnObjectRequest& request, uesynth::CommandResponse* reply);
+    void PreloadAssetsOnGameThread(const uesynth::PreloadAssetsRequest& request, uesynth::PreloadAssetsResponse* reply, FReplyCallback&& OnDone);
+    grpc::Status DestroyObjectOnGameThread(const uesynth::DestroyObjectRequest& request, uesynth::CommandResponse* reply);
+    grpc::Status ConfigureActorPoolOnGameThread(const uesynth::ConfigureActorPoolRequest& request, uesynth::ActorPoolStats* reply);
+    grpc::Status SetMaterialOnGameThread(const uesynth::SetMaterialRequest& request, uesynth::CommandResponse* reply);
+    grpc::Status SetMaterialsBatchOnGameThread(const uesynth::SetMaterialsBatchRequest& request, uesynth::SetMaterialsBatchResponse* reply);
+    grpc::Status ResolveMaterialParametersOnGameThread(const uesynth::ResolveMaterialParametersRequest& request, uesynth::MaterialParameterIds* reply);
+    grpc::Status SetLightingOnGameThread(const uesynth::SetLightingRequest& request, uesynth::CommandResponse* reply);
+    grpc::Status SetLightingBatchOnGameThread(const uesynth::SetLightingBatchRequest& request, uesynth::SetLightingBatchResponse* reply);
+    grpc::Status ListObjectsOnGameThread(const uesynth::ListObjectsRequest& request, uesynth::ListObjectsResponse* reply);
+    grpc::Status GetSceneSnapshotOnGameThread(const uesynth::GetSceneSnapshotRequest& request, uesynth::SceneSnapshot* reply);
+    grpc::Status SubscribeOnGameThread(const std::string& subscription_id, const uesynth::SubscribeRequest& request, const TSharedPtr<FUESynthStreamLink>& stream, uesynth::CommandResponse* reply);
+    grpc::Status UnsubscribeOnGameThread(const uesynth::UnsubscribeRequest& request, const TSharedPtr<FUESynthStreamLink>& stream, uesynth::CommandResponse* reply);
+    grpc::Status GetStreamStatsOnGameThread(const TSharedPtr<FUESynthStreamLink>& stream, uesynth::StreamStats* reply);
+    grpc::Status OpenSharedMemoryOnGameThread(const uesynth::OpenSharedMemoryRequest& request, const TSharedPtr<FUESynthStreamLink>& stream, uesynth::SharedMemoryInfo* reply);
+    // Runs the step's actions through the same dispatch as ProcessActionOnGameThread, then ticks
+    // and captures; OnDone comes from the capture's readback when there is one
+    void StepOnGameThread(const uesynth::StepRequest& request, uesynth::StepResponse* reply, FReplyCallback&& OnDone);
+    grpc::Status SetLockstepOnGameThread(const uesynth::SetLockstepRequest& request, uesynth::LockstepState* reply, const TSharedPtr<FUESynthStreamLink>& stream = nullptr);
+    grpc::Status StartRecordingOnGameThread(const uesynth::StartRecordingRequest& request, uesynth::RecordingStats* reply);
+    // OnDone runs on the recording's writer thread once everything it queued is on disk
+    void StopRecordingOnGameThread(const uesynth::StopRecordingRequest& request, uesynth::RecordingStats* reply, FReplyCallback&& OnDone);
+
+    // Sets a frame's camera_transform and world_time_seconds from the camera it is about to capture
+    void FillFramePoseOnGameThread(const std::string& camera_name, uesynth::SubscriptionFrame* frame);
+
+private:
+    // The actions ProcessActionOnGameThread completes inline
+    grpc::Status ProcessImmediateActionOnGameThread(const uesynth::ActionRequest& request, uesynth::FrameResponse* response);
+};
\ No newline at end of file
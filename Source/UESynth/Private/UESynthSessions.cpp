@@ -0,0 +1,227 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthSessions.h"
+#include "Engine/Engine.h"
+#include "Engine/LevelStreamingDynamic.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeLock.h"
+#include <string>
+
+namespace
+{
+
+/** The value of metadata Key sent by the client, or an empty string. */
+FString GetMetadata(const grpc::ServerContext* Context, const char* Key) {
+  if (!Context) {
+    return FString();
+  }
+  const auto& Metadata = Context->client_metadata();
+  const auto It = Metadata.find(Key);
+  if (It == Metadata.end()) {
+    return FString();
+  }
+  const std::string Value(It->second.data(), It->second.length());
+  return UTF8_TO_TCHAR(Value.c_str());
+}
+
+/** Session IDs end up in object names and logs, so they stay short and plain. */
+bool IsValidSessionId(const FString& Id) {
+  if (Id.Len() > FUESynthSessions::MaxSessionIdLength) {
+    return false;
+  }
+  for (const TCHAR Char : Id) {
+    if (!FChar::IsAlnum(Char) && Char != TEXT('-') && Char != TEXT('_') && Char != TEXT('.')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+FUESynthSession::FUESynthSession(const FString& InId, const FString& InLevel)
+    : Id(InId), Level(InLevel), Lane(FUESynthCommandQueue::Get().CreateLane()) {}
+
+// Closed by FUESynthSessions on the game thread before the last reference goes
+FUESynthSession::~FUESynthSession() {
+  check(World == nullptr);
+}
+
+FUESynthSceneContext* FUESynthSession::GetContext() {
+  check(IsInGameThread());
+  if (!Context) {
+    if (!bClosed) {
+      CreateWorld();
+    }
+    // Without a world the session's commands fail instead of acting on the engine's
+    Context = MakeUnique<FUESynthSceneContext>(World);
+  }
+  return Context.Get();
+}
+
+void FUESynthSession::Enqueue(EUESynthCommandKind Kind, FUESynthCommandQueue::FCommand&& Command) {
+  FUESynthCommandQueue::Get().Enqueue(
+      *Lane, Kind, [Session = AsShared(), Command = MoveTemp(Command)]() mutable {
+        FUESynthSessions::FScope Scope(&Session.Get());
+        Command();
+      });
+}
+
+void FUESynthSession::Tick(float DeltaSeconds) {
+  if (World && !World->bInTick) {
+    World->Tick(LEVELTICK_All, DeltaSeconds);
+  }
+}
+
+void FUESynthSession::CreateWorld() {
+  // Not known to the engine, so nothing else ticks it or shows it; see Tick
+  const FName WorldName = MakeUniqueObjectName(
+      GetTransientPackage(), UWorld::StaticClass(), FName(*(TEXT("UESynthSession_") + Id)));
+  World = UWorld::CreateWorld(EWorldType::GamePreview, /*bInformEngineOfWorld=*/false, WorldName);
+  if (!World) {
+    UE_LOG(LogTemp, Error, TEXT("UESynth: Could not create a world for session '%s'"), *Id);
+    return;
+  }
+
+  if (!Level.IsEmpty()) {
+    bool bLoaded = false;
+    ULevelStreamingDynamic::LoadLevelInstance(World, Level, FVector::ZeroVector,
+                                              FRotator::ZeroRotator, bLoaded);
+    if (!bLoaded) {
+      UE_LOG(LogTemp, Error, TEXT("UESynth: Session '%s' could not load level '%s'"), *Id,
+             *Level);
+    }
+  }
+  World->InitializeActorsForPlay(FURL());
+  World->BeginPlay();
+  // The session's first command already sees the level's actors
+  if (!Level.IsEmpty() && GEngine) {
+    GEngine->BlockTillLevelStreamingCompleted(World);
+  }
+  UE_LOG(LogTemp, Log, TEXT("UESynth: Opened session '%s'"), *Id);
+}
+
+void FUESynthSession::Close() {
+  check(IsInGameThread());
+  bClosed = true;
+  if (Context) {
+    Context->Invalidate();
+  }
+  if (World) {
+    World->DestroyWorld(/*bInformEngineOfWorld=*/false);
+    World->RemoveFromRoot();
+    World = nullptr;
+    UE_LOG(LogTemp, Log, TEXT("UESynth: Closed session '%s'"), *Id);
+  }
+}
+
+FUESynthSession* FUESynthSessions::Active = nullptr;
+FUESynthSessions* FUESynthSessions::Instance = nullptr;
+
+FUESynthSessions::FUESynthSessions() {
+  check(Instance == nullptr);
+  Instance = this;
+}
+
+FUESynthSessions::~FUESynthSessions() {
+  // Commands still queued for a session find it closed, with no world to act on.
+  for (const auto& Pair : Sessions) {
+    Pair.Value->Close();
+  }
+  Sessions.Reset();
+  Instance = nullptr;
+}
+
+FUESynthSessions& FUESynthSessions::Get() {
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+bool FUESynthSessions::IsAvailable() {
+  return Instance != nullptr;
+}
+
+grpc::Status FUESynthSessions::FromMetadata(const grpc::ServerContext* Context,
+                                            TSharedPtr<FUESynthSession>* Out) {
+  Out->Reset();
+  const FString Id = GetMetadata(Context, SessionMetadataKey);
+  if (Id.IsEmpty()) {
+    return grpc::Status::OK;
+  }
+  if (!IsValidSessionId(Id)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Session IDs are up to 64 letters, digits, '-', '_' or '.'");
+  }
+  const FString Level = GetMetadata(Context, LevelMetadataKey);
+  if (!Level.IsEmpty() && !FPackageName::IsValidLongPackageName(Level)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                        "Session levels are long package names, e.g. /Game/Maps/Lab");
+  }
+
+  FScopeLock ScopeLock(&Lock);
+  if (const TSharedRef<FUESynthSession>* Found = Sessions.Find(Id)) {
+    // Its world exists already; a level asked for now can't change it
+    *Out = *Found;
+    return grpc::Status::OK;
+  }
+  if (Sessions.Num() >= MaxSessions) {
+    return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "Too many open sessions");
+  }
+  *Out = Sessions.Add(Id, MakeShared<FUESynthSession>(Id, Level));
+  return grpc::Status::OK;
+}
+
+void FUESynthSessions::Enqueue(const TSharedPtr<FUESynthSession>& Session,
+                               EUESynthCommandKind Kind,
+                               FUESynthCommandQueue::FCommand&& Command) {
+  if (Session) {
+    Session->Enqueue(Kind, MoveTemp(Command));
+  } else {
+    FUESynthCommandQueue::Get().Enqueue(Kind, MoveTemp(Command));
+  }
+}
+
+FUESynthSessions::FScope::FScope(FUESynthSession* Session)
+    : Previous(Active), ContextScope(Session ? Session->GetContext() : nullptr) {
+  Active = Session;
+}
+
+FUESynthSessions::FScope::~FScope() {
+  Active = Previous;
+}
+
+int32 FUESynthSessions::Num() const {
+  FScopeLock ScopeLock(&Lock);
+  return Sessions.Num();
+}
+
+void FUESynthSessions::Tick(float DeltaTime) {
+  TArray<TSharedRef<FUESynthSession>> Open;
+  TArray<TSharedRef<FUESynthSession>> Ended;
+  {
+    // Only the map holds a session whose calls and commands are all gone, and under the lock
+    // nobody can find it any more
+    FScopeLock ScopeLock(&Lock);
+    for (auto It = Sessions.CreateIterator(); It; ++It) {
+      if (It->Value.GetSharedReferenceCount() == 1) {
+        Ended.Add(It->Value);
+        It.RemoveCurrent();
+      } else {
+        Open.Add(It->Value);
+      }
+    }
+  }
+
+  for (const TSharedRef<FUESynthSession>& Session : Ended) {
+    Session->Close();
+  }
+  for (const TSharedRef<FUESynthSession>& Session : Open) {
+    Session->Tick(DeltaTime);
+  }
+}
+
+TStatId FUESynthSessions::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(FUESynthSessions, STATGROUP_Tickables);
+}
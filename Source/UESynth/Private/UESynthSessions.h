@@ -0,0 +1,135 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Tickable.h"
+#include "UESynthCommandQueue.h"
+#include "UESynthSceneContext.h"
+#include <grpcpp/grpcpp.h>
+
+class UWorld;
+
+/**
+ * One client session: a world of its own inside the editor process, with its own cameras, actor
+ * IDs and command lane.
+ *
+ * The world is created on the game thread when the session's first command runs, empty or with
+ * the session's level streamed in, and is ticked by FUESynthSessions every frame. It isn't shown
+ * in any viewport, so a session captures through the cameras it creates. Commands of the session
+ * run with its scene context active, so every handler acts on the session's world.
+ */
+class FUESynthSession final : public TSharedFromThis<FUESynthSession>
+{
+public:
+  FUESynthSession(const FString& InId, const FString& InLevel);
+  ~FUESynthSession();
+
+  FUESynthSession(const FUESynthSession&) = delete;
+  FUESynthSession& operator=(const FUESynthSession&) = delete;
+
+  const FString& GetId() const {
+    return Id;
+  }
+
+  /** The session's scene context, creating its world first if need be. Game thread only. */
+  FUESynthSceneContext* GetContext();
+
+  /** Queues a command on the session's lane, to run with its context active. Any thread. */
+  void Enqueue(EUESynthCommandKind Kind, FUESynthCommandQueue::FCommand&& Command);
+
+  /** Advances the world by DeltaSeconds unless it is ticking already. Game thread only. */
+  void Tick(float DeltaSeconds);
+
+  /** Destroys the world; the context stays, with no world. Game thread only. */
+  void Close();
+
+private:
+  void CreateWorld();
+
+  const FString Id;
+  const FString Level;
+  TSharedRef<FUESynthCommandQueue::FLane> Lane;
+
+  // Rooted by CreateWorld until Close destroys it.
+  UWorld* World = nullptr;
+  TUniquePtr<FUESynthSceneContext> Context;
+  bool bClosed = false;
+};
+
+/**
+ * The sessions of the ControlStream calls that asked for one, by session ID.
+ *
+ * A call names its session in its metadata, and every call naming the same one shares it; a call
+ * without one acts on the engine's own world as before. A session is closed, and its world
+ * destroyed, on the first tick after its last call has ended.
+ */
+class FUESynthSessions final : public FTickableGameObject
+{
+public:
+  /** Client metadata key naming the session of a ControlStream call. */
+  static constexpr const char* SessionMetadataKey = "uesynth-session";
+  /** Client metadata key naming the level a new session streams in, e.g. "/Game/Maps/Lab". */
+  static constexpr const char* LevelMetadataKey = "uesynth-session-level";
+  static constexpr int32 MaxSessionIdLength = 64;
+  static constexpr int32 MaxSessions = 16;
+
+  FUESynthSessions();
+  virtual ~FUESynthSessions() override;
+
+  /** The module-owned sessions. Only valid while the UESynth module is loaded. */
+  static FUESynthSessions& Get();
+  static bool IsAvailable();
+
+  /**
+   * Finds or opens the session Context's metadata names; Out stays null when it names none.
+   * Fails for a malformed ID or when MaxSessions are open already. Safe to call from any thread.
+   */
+  grpc::Status FromMetadata(const grpc::ServerContext* Context, TSharedPtr<FUESynthSession>* Out);
+
+  /** Queues Command on Session's lane, or on the default lane without a session. Any thread. */
+  static void Enqueue(const TSharedPtr<FUESynthSession>& Session,
+                      EUESynthCommandKind Kind, FUESynthCommandQueue::FCommand&& Command);
+
+  /** The session whose command is running, or null. Game thread only. */
+  static FUESynthSession* GetActive() {
+    return Active;
+  }
+
+  /** Makes Session, and its scene context, the active ones until the scope ends; null for none. */
+  class FScope
+  {
+  public:
+    explicit FScope(FUESynthSession* Session);
+    ~FScope();
+
+  private:
+    FUESynthSession* Previous;
+    FUESynthSceneContext::FActiveScope ContextScope;
+  };
+
+  int32 Num() const;
+
+  //~ Begin FTickableGameObject interface
+  virtual void Tick(float DeltaTime) override;
+  virtual ETickableTickType GetTickableTickType() const override {
+    return ETickableTickType::Always;
+  }
+  virtual bool IsTickableWhenPaused() const override {
+    return true;
+  }
+  virtual bool IsTickableInEditor() const override {
+    return true;
+  }
+  virtual TStatId GetStatId() const override;
+  //~ End FTickableGameObject interface
+
+private:
+  mutable FCriticalSection Lock;
+  TMap<FString, TSharedRef<FUESynthSession>> Sessions;
+
+  static FUESynthSession* Active;
+  static FUESynthSessions* Instance;
+};
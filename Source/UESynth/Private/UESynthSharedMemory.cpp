@@ -0,0 +1,119 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthSharedMemory.h"
+#include "HAL/PlatformAtomics.h"
+#include "Misc/Guid.h"
+#include "UESynthMessageArena.h"
+
+TSharedPtr<FUESynthSharedMemory> FUESynthSharedMemory::Create(uint32 SlotCount, uint64 SlotSize) {
+  if (SlotCount == 0 || SlotCount > MaxSlotCount || SlotSize <= HeaderSize ||
+      SlotSize > MaxSlotSize || SlotCount * SlotSize > MaxRegionSize) {
+    return nullptr;
+  }
+
+  // Unguessable, so only a client told over its stream finds the region
+  const FString Name = TEXT("uesynth_") + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+  const uint32 Access = uint32(FPlatformMemory::ESharedMemoryAccess::Read) |
+                       uint32(FPlatformMemory::ESharedMemoryAccess::Write);
+  FPlatformMemory::FSharedMemoryRegion* Region = FPlatformMemory::MapNamedSharedMemoryRegion(
+      Name, true, Access, SIZE_T(SlotCount) * SlotSize);
+  if (!Region) {
+    UE_LOG(LogTemp, Warning, TEXT("UESynth: Failed to create shared memory region %s"), *Name);
+    return nullptr;
+  }
+  // A new mapping is zero-filled already; clearing the headers alone keeps its pages untouched
+  // until images land in them, rather than faulting in the whole region here.
+  uint8* Base = static_cast<uint8*>(Region->GetAddress());
+  for (uint32 Slot = 0; Slot < SlotCount; ++Slot) {
+    FMemory::Memzero(Base + Slot * SlotSize, HeaderSize);
+  }
+  return TSharedPtr<FUESynthSharedMemory>(
+      new FUESynthSharedMemory(Region, Name, SlotCount, SlotSize));
+}
+
+FUESynthSharedMemory::FUESynthSharedMemory(FPlatformMemory::FSharedMemoryRegion* InRegion,
+                                           const FString& InName, uint32 InSlotCount,
+                                           uint64 InSlotSize)
+    : Region(InRegion), Name(InName), SlotCount(InSlotCount), SlotSize(InSlotSize) {}
+
+FUESynthSharedMemory::~FUESynthSharedMemory() {
+  FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+}
+
+void FUESynthSharedMemory::GetInfo(uesynth::SharedMemoryInfo* Out) const {
+  Out->set_name(TCHAR_TO_UTF8(*Name));
+  Out->set_slot_count(SlotCount);
+  Out->set_slot_size(SlotSize);
+  Out->set_header_size(HeaderSize);
+}
+
+void FUESynthSharedMemory::Pack(uesynth::FrameResponse* Response) {
+  uesynth::MultiImageResponse* Images = nullptr;
+  switch (Response->response_case()) {
+  case uesynth::FrameResponse::kSharedMemory:
+    bAnnounced = true;
+    return;
+  case uesynth::FrameResponse::kImageResponse:
+    if (bAnnounced) {
+      PackImage(Response->mutable_image_response());
+    }
+    return;
+  case uesynth::FrameResponse::kMultiImageResponse:
+    Images = Response->mutable_multi_image_response();
+    break;
+  case uesynth::FrameResponse::kSubscriptionFrame:
+    Images = Response->mutable_subscription_frame()->mutable_images();
+    break;
+  case uesynth::FrameResponse::kStepResponse:
+    if (!Response->step_response().has_images()) {
+      return;
+    }
+    Images = Response->mutable_step_response()->mutable_images();
+    break;
+  default:
+    return;
+  }
+
+  if (!bAnnounced) {
+    return;
+  }
+  if (Images->has_rgb()) {
+    PackImage(Images->mutable_rgb());
+  }
+  if (Images->has_depth()) {
+    PackImage(Images->mutable_depth());
+  }
+  if (Images->has_segmentation()) {
+    PackImage(Images->mutable_segmentation());
+  }
+  if (Images->has_normals()) {
+    PackImage(Images->mutable_normals());
+  }
+  if (Images->has_optical_flow()) {
+    PackImage(Images->mutable_optical_flow());
+  }
+}
+
+void FUESynthSharedMemory::PackImage(uesynth::ImageResponse* Image) {
+  const std::string& Data = Image->image_data();
+  if (Data.empty() || Data.size() > SlotSize - HeaderSize) {
+    return;
+  }
+
+  uint8* Slot = static_cast<uint8*>(Region->GetAddress()) + uint64(NextSlot) * SlotSize;
+  volatile int64* Header = reinterpret_cast<volatile int64*>(Slot);
+  const int64 Sequence = NextSequence++;
+  // A reader that finds sequence 0, or one other than it expects, knows not to trust the data
+  FPlatformAtomics::AtomicStore(&Header[0], int64(0));
+  FMemory::Memcpy(Slot + HeaderSize, Data.data(), Data.size());
+  FPlatformAtomics::AtomicStore(&Header[1], int64(Data.size()));
+  FPlatformAtomics::AtomicStore(&Header[0], Sequence);
+
+  uesynth::SharedMemorySlot* Ref = Image->mutable_shared_memory();
+  Ref->set_slot(NextSlot);
+  Ref->set_sequence(uint64(Sequence));
+  Ref->set_size(Data.size());
+  UESynthImageBuffers::Release(Image->mutable_image_data());
+  NextSlot = (NextSlot + 1) % SlotCount;
+}
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformMemory.h"
+#include "pb/uesynth.pb.h"
+
+/**
+ * A ring of shared-memory slots that one ControlStream call writes its images into.
+ *
+ * A client on the same host maps the region by name and reads images straight out of it, so an
+ * 8 MB frame skips protobuf, HTTP/2 framing and the loopback socket. The writer of the call moves
+ * each image's payload into the next slot, in the order responses are written, and leaves only a
+ * SharedMemorySlot reference in the response. Slots are reused round-robin without waiting for the
+ * client: a slot's data stays valid until SlotCount more images have been written, and every slot
+ * starts with a header holding the sequence of the image in it, 0 while it is being rewritten, so
+ * a client can tell when it held on too long. Images larger than a slot are sent inline as before.
+ *
+ * The region is a POSIX shm object or a Windows file mapping, through the engine's named shared
+ * memory regions, and goes away with the ring. Not thread-safe; only the call's writer packs.
+ */
+class FUESynthSharedMemory
+{
+public:
+  /** Bytes before each slot's data: int64 sequence, int64 size, then reserved. */
+  static constexpr uint32 HeaderSize = 64;
+  static constexpr uint32 DefaultSlotCount = 8;
+  static constexpr uint32 MaxSlotCount = 64;
+  static constexpr uint64 DefaultSlotSize = 16ull << 20;
+  static constexpr uint64 MaxSlotSize = 256ull << 20;
+  /** Largest region a client may ask for, slots and headers together. */
+  static constexpr uint64 MaxRegionSize = 1ull << 30;
+
+  /**
+   * Maps a new region of SlotCount slots of SlotSize bytes each; null if out of range or the OS
+   * refused.
+   */
+  static TSharedPtr<FUESynthSharedMemory> Create(uint32 SlotCount, uint64 SlotSize);
+
+  /** Unmaps the region and removes its name; clients that still map it keep their view. */
+  ~FUESynthSharedMemory();
+
+  FUESynthSharedMemory(const FUESynthSharedMemory&) = delete;
+  FUESynthSharedMemory& operator=(const FUESynthSharedMemory&) = delete;
+
+  /** What a client needs to map the region. */
+  void GetInfo(uesynth::SharedMemoryInfo* Out) const;
+
+  /**
+   * Moves the payloads of Response's images into slots. Nothing is moved until the response
+   * announcing the region has been packed, so the client always learns of it first.
+   */
+  void Pack(uesynth::FrameResponse* Response);
+
+private:
+  FUESynthSharedMemory(FPlatformMemory::FSharedMemoryRegion* InRegion, const FString& InName,
+                       uint32 InSlotCount, uint64 InSlotSize);
+
+  void PackImage(uesynth::ImageResponse* Image);
+
+  FPlatformMemory::FSharedMemoryRegion* Region;
+  FString Name;
+  uint32 SlotCount;
+  uint64 SlotSize;
+  uint32 NextSlot = 0;
+  int64 NextSequence = 1;
+  bool bAnnounced = false;
+};
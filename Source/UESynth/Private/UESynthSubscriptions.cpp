@@ -0,0 +1,295 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthSubscriptions.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "UESynthServiceImpl.h"
+#include "UESynthSessions.h"
+#include "UESynthSharedMemory.h"
+
+namespace {
+
+/** The images a delta frame diffs, each with its own FUESynthTileDelta slot. */
+constexpr uesynth::CaptureModality DeltaModalities[] = {
+    uesynth::CAPTURE_MODALITY_RGB,
+    uesynth::CAPTURE_MODALITY_DEPTH,
+    uesynth::CAPTURE_MODALITY_SEGMENTATION,
+    uesynth::CAPTURE_MODALITY_NORMALS,
+    uesynth::CAPTURE_MODALITY_OPTICAL_FLOW,
+};
+
+uesynth::ImageResponse* GetImage(uesynth::MultiImageResponse* Images,
+                                 uesynth::CaptureModality Modality) {
+  switch (Modality) {
+  case uesynth::CAPTURE_MODALITY_DEPTH:
+    return Images->mutable_depth();
+  case uesynth::CAPTURE_MODALITY_SEGMENTATION:
+    return Images->mutable_segmentation();
+  case uesynth::CAPTURE_MODALITY_NORMALS:
+    return Images->mutable_normals();
+  case uesynth::CAPTURE_MODALITY_OPTICAL_FLOW:
+    return Images->mutable_optical_flow();
+  default:
+    return Images->mutable_rgb();
+  }
+}
+
+} // namespace
+
+int32 FUESynthStreamLink::GetNumQueued() const {
+  FScopeLock ScopeLock(&Lock);
+  return Sink ? Sink->GetNumQueued() : 0;
+}
+
+bool FUESynthStreamLink::Push(uesynth::FrameResponse&& Response) {
+  FScopeLock ScopeLock(&Lock);
+  return Sink && Sink->Push(MoveTemp(Response));
+}
+
+bool FUESynthStreamLink::GetWriteQueueStats(FUESynthWriteQueueStats* Out) const {
+  FScopeLock ScopeLock(&Lock);
+  if (!Sink) {
+    return false;
+  }
+  *Out = Sink->GetWriteQueueStats();
+  return true;
+}
+
+void FUESynthStreamLink::SetSharedMemory(
+    const TSharedPtr<FUESynthSharedMemory>& InSharedMemory) {
+  FScopeLock ScopeLock(&Lock);
+  SharedMemory = InSharedMemory;
+}
+
+TSharedPtr<FUESynthSharedMemory> FUESynthStreamLink::GetSharedMemory() const {
+  FScopeLock ScopeLock(&Lock);
+  return SharedMemory;
+}
+
+void FUESynthStreamLink::Detach() {
+  FScopeLock ScopeLock(&Lock);
+  Sink = nullptr;
+}
+
+bool FUESynthStreamLink::IsDetached() const {
+  FScopeLock ScopeLock(&Lock);
+  return Sink == nullptr;
+}
+
+FUESynthSubscriptions* FUESynthSubscriptions::Instance = nullptr;
+
+FUESynthSubscriptions::FUESynthSubscriptions() {
+  check(Instance == nullptr);
+  Instance = this;
+}
+
+FUESynthSubscriptions::~FUESynthSubscriptions() {
+  Reset();
+  Instance = nullptr;
+}
+
+FUESynthSubscriptions& FUESynthSubscriptions::Get() {
+  check(Instance != nullptr);
+  return *Instance;
+}
+
+bool FUESynthSubscriptions::Subscribe(UESynthServiceImpl& Service,
+                                      const TSharedRef<FUESynthStreamLink>& Stream,
+                                      const std::string& Id,
+                                      const uesynth::SubscribeRequest& Request) {
+  check(IsInGameThread());
+  for (const TSharedRef<FSubscription>& Subscription : Subscriptions) {
+    if (Subscription->Stream.Get() == &Stream.Get() && Subscription->Id == Id &&
+        !Subscription->bEnded) {
+      return false;
+    }
+  }
+
+  TSharedRef<FSubscription> Subscription = MakeShared<FSubscription>();
+  Subscription->Service = &Service;
+  Subscription->Stream = Stream;
+  if (FUESynthSession* Session = FUESynthSessions::GetActive()) {
+    Subscription->Session = Session->AsShared();
+  }
+  Subscription->Id = Id;
+  Subscription->Capture = Request.capture();
+  Subscription->EveryNFrames = FMath::Max<uint32>(Request.every_n_frames(), 1);
+  Subscription->Interval = Request.rate_hz() > 0.0f ? 1.0 / Request.rate_hz() : 0.0;
+  Subscription->MaxQueued = int32(FMath::Clamp<uint32>(Request.max_queued_frames(), 1, MAX_int32));
+  Subscription->SegmentationRevision = Request.capture().segmentation_revision();
+  if (Request.delta_tile_size() != 0) {
+    Subscription->Delta =
+        MakeUnique<FUESynthTileDelta>(Request.delta_tile_size(), Request.keyframe_interval());
+    UESynthImageEncoder::FromWireCodec(Request.capture().color_codec(), &Subscription->ColorCodec);
+    UESynthImageEncoder::FromWireCodec(Request.capture().data_codec(), &Subscription->DataCodec);
+    Subscription->Capture.set_color_codec(uesynth::IMAGE_CODEC_RAW);
+    Subscription->Capture.set_data_codec(uesynth::IMAGE_CODEC_RAW);
+  }
+  Subscriptions.Add(MoveTemp(Subscription));
+  return true;
+}
+
+bool FUESynthSubscriptions::Unsubscribe(const FUESynthStreamLink& Stream, const std::string& Id) {
+  check(IsInGameThread());
+  const int32 Index = Subscriptions.IndexOfByPredicate([&Stream, &Id](const auto& Subscription) {
+    return Subscription->Stream.Get() == &Stream && Subscription->Id == Id &&
+           !Subscription->bEnded;
+  });
+  if (Index == INDEX_NONE) {
+    return false;
+  }
+  // Captures still in flight complete into a subscription nobody holds but them.
+  Subscriptions[Index]->bEnded = true;
+  Subscriptions.RemoveAt(Index);
+  return true;
+}
+
+void FUESynthSubscriptions::Reset() {
+  for (const TSharedRef<FSubscription>& Subscription : Subscriptions) {
+    Subscription->bEnded = true;
+  }
+  Subscriptions.Reset();
+}
+
+void FUESynthSubscriptions::Tick(float DeltaTime) {
+  Subscriptions.RemoveAll([](const TSharedRef<FSubscription>& Subscription) {
+    return Subscription->bEnded || Subscription->Stream->IsDetached();
+  });
+
+  const uint64 Frame = GFrameCounter;
+  const double Now = FPlatformTime::Seconds();
+  for (const TSharedRef<FSubscription>& Subscription : Subscriptions) {
+    if (!IsDue(*Subscription, Frame, Now)) {
+      continue;
+    }
+
+    // A frame taken now would only wait behind older ones; skipping it keeps the stream current.
+    if (Subscription->CapturesInFlight.load() >= MaxCapturesInFlight ||
+        Subscription->Stream->GetNumQueued() >= Subscription->MaxQueued) {
+      ++Subscription->Dropped;
+      continue;
+    }
+    Capture(Subscription, Frame);
+  }
+}
+
+TStatId FUESynthSubscriptions::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(FUESynthSubscriptions, STATGROUP_Tickables);
+}
+
+bool FUESynthSubscriptions::IsDue(FSubscription& Subscription, uint64 Frame, double Now) {
+  if (Subscription.Interval > 0.0) {
+    if (Now < Subscription.NextTime) {
+      return false;
+    }
+    // After a stall the schedule restarts from now instead of bursting to catch up.
+    Subscription.NextTime += Subscription.Interval;
+    if (Subscription.NextTime <= Now) {
+      Subscription.NextTime = Now + Subscription.Interval;
+    }
+    return true;
+  }
+
+  if (Frame - Subscription.LastFrame < Subscription.EveryNFrames) {
+    return false;
+  }
+  Subscription.LastFrame = Frame;
+  return true;
+}
+
+void FUESynthSubscriptions::Capture(const TSharedRef<FSubscription>& Subscription, uint64 Frame) {
+  // The response lives with the callback, since captures finish on a background thread.
+  TUniquePtr<uesynth::FrameResponse> Response = MakeUnique<uesynth::FrameResponse>();
+  Response->set_request_id(Subscription->Id);
+  uesynth::SubscriptionFrame* Pushed = Response->mutable_subscription_frame();
+  Pushed->set_sequence(++Subscription->Sequence);
+  Pushed->set_frame_number(Frame);
+  uesynth::MultiImageResponse* Images = Pushed->mutable_images();
+
+  // Only resend the segmentation table when it changed since the last frame that carried one.
+  // A dropped response may have been that frame, so after any drop the table is sent again.
+  FUESynthWriteQueueStats Stats;
+  if (Subscription->Stream->GetWriteQueueStats(&Stats) &&
+      Stats.Dropped != Subscription->SegmentationDropped) {
+    Subscription->SegmentationDropped = Stats.Dropped;
+    Subscription->SegmentationRevision = 0;
+  }
+  uesynth::CaptureMultiRequest Request = Subscription->Capture;
+  const uint32 KnownRevision = Subscription->SegmentationRevision.load();
+  Request.set_segmentation_revision(KnownRevision);
+
+  ++Subscription->CapturesInFlight;
+  FUESynthSessions::FScope Scope(Subscription->Session.Get());
+  Subscription->Service->FillFramePoseOnGameThread(Request.camera_name(), Pushed);
+  Subscription->Service->CaptureMultiOnGameThread(
+      Request, Images,
+      [Subscription, KnownRevision,
+       Response = MoveTemp(Response)](const grpc::Status& Status) mutable {
+        uesynth::SubscriptionFrame* SentFrame = Response->mutable_subscription_frame();
+        if (!Status.ok()) {
+          ++Subscription->Dropped;
+          // A transient failure only costs this frame; a request that can never succeed again,
+          // e.g. for a camera that was destroyed, ends the subscription.
+          const grpc::StatusCode Code = Status.error_code();
+          if (Code == grpc::StatusCode::NOT_FOUND || Code == grpc::StatusCode::INVALID_ARGUMENT ||
+              Code == grpc::StatusCode::UNIMPLEMENTED) {
+            UE_LOG(LogTemp, Warning, TEXT("UESynth: Ending subscription %s: %s"),
+                   UTF8_TO_TCHAR(Subscription->Id.c_str()),
+                   UTF8_TO_TCHAR(Status.error_message().c_str()));
+            Subscription->bEnded = true;
+          }
+        } else if (!Subscription->bEnded) {
+          // The table went out with this frame only if its revision is news to the client,
+          // and the client only has it once the frame is queued
+          const uint32 Revision = SentFrame->images().segmentation().segmentation_revision();
+          SentFrame->set_dropped_frames(Subscription->Dropped.load());
+          const bool bPushed = Subscription->Delta
+                                   ? PushDelta(*Subscription, MoveTemp(*Response))
+                                   : Subscription->Stream->Push(MoveTemp(*Response));
+          if (!bPushed) {
+            Subscription->bEnded = true;
+          } else if (Revision != 0 && Revision != KnownRevision) {
+            Subscription->SegmentationRevision = Revision;
+          }
+        }
+        --Subscription->CapturesInFlight;
+      });
+}
+
+bool FUESynthSubscriptions::PushDelta(FSubscription& Subscription,
+                                      uesynth::FrameResponse&& Response) {
+  FScopeLock ScopeLock(&Subscription.DeltaLock);
+
+  // A dropped response may have been one of these frames, and tiles can't be applied to a frame
+  // the client never saw.
+  FUESynthWriteQueueStats Stats;
+  bool bMissed = false;
+  if (Subscription.Stream->GetWriteQueueStats(&Stats)) {
+    bMissed = Stats.Dropped != Subscription.LastDropped;
+    Subscription.LastDropped = Stats.Dropped;
+  }
+
+  uesynth::SubscriptionFrame* Frame = Response.mutable_subscription_frame();
+  uesynth::MultiImageResponse* Images = Frame->mutable_images();
+  Subscription.Delta->BeginFrame(Frame->sequence(), bMissed);
+  for (int32 Slot = 0; Slot < int32(UE_ARRAY_COUNT(DeltaModalities)); ++Slot) {
+    const uesynth::CaptureModality Modality = DeltaModalities[Slot];
+    if (!(Images->modalities() & Modality)) {
+      continue;
+    }
+    uesynth::ImageResponse* Image = GetImage(Images, Modality);
+    Subscription.Delta->Encode(Slot, Image);
+    const EUESynthImageCodec Codec = Modality == uesynth::CAPTURE_MODALITY_RGB ||
+                                             Modality == uesynth::CAPTURE_MODALITY_NORMALS
+                                         ? Subscription.ColorCodec
+                                         : Subscription.DataCodec;
+    // A failure leaves the tiles raw, which the client reads just as well
+    if (Modality != uesynth::CAPTURE_MODALITY_OPTICAL_FLOW &&
+        !UESynthImageEncoder::Encode({Image, Codec})) {
+      UE_LOG(LogTemp, Warning, TEXT("UESynth: Sending subscription %s frame uncompressed"),
+             UTF8_TO_TCHAR(Subscription.Id.c_str()));
+    }
+  }
+  return Subscription.Stream->Push(MoveTemp(Response));
+}
@@ -0,0 +1,166 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Tickable.h"
+#include "UESynthImageEncoder.h"
+#include "UESynthTileDelta.h"
+#include "UESynthWriteQueue.h"
+#include "pb/uesynth.pb.h"
+#include <atomic>
+#include <string>
+
+class FUESynthSession;
+class FUESynthSharedMemory;
+class UESynthServiceImpl;
+
+/** The writing side of one ControlStream call, as subscriptions see it. Any thread. */
+class IUESynthFrameSink
+{
+public:
+  virtual ~IUESynthFrameSink() = default;
+
+  /** Responses queued on the call but not written to the client yet. */
+  virtual int32 GetNumQueued() const = 0;
+
+  /** Queues Response for writing; false once the call is winding down. */
+  virtual bool Push(uesynth::FrameResponse&& Response) = 0;
+
+  /** The state of the call's outbound queue. */
+  virtual FUESynthWriteQueueStats GetWriteQueueStats() const = 0;
+};
+
+/**
+ * Shared handle to a ControlStream call's sink. Subscriptions and their in-flight captures keep
+ * this handle, not the call, so the call can go away at any time: it detaches the sink first, and
+ * everything after that is dropped.
+ */
+class FUESynthStreamLink
+{
+public:
+  explicit FUESynthStreamLink(IUESynthFrameSink* InSink) : Sink(InSink) {}
+
+  int32 GetNumQueued() const;
+  bool Push(uesynth::FrameResponse&& Response);
+
+  /** Fills Out from the sink; false once it is detached. */
+  bool GetWriteQueueStats(FUESynthWriteQueueStats* Out) const;
+
+  /** The shared-memory ring the call writes its images into from now on, if it has one. */
+  void SetSharedMemory(const TSharedPtr<FUESynthSharedMemory>& InSharedMemory);
+  TSharedPtr<FUESynthSharedMemory> GetSharedMemory() const;
+
+  /** Called by the call before it is destroyed; blocks while a push is inside the sink. */
+  void Detach();
+  bool IsDetached() const;
+
+private:
+  mutable FCriticalSection Lock;
+  IUESynthFrameSink* Sink;
+  TSharedPtr<FUESynthSharedMemory> SharedMemory;
+};
+
+/**
+ * Continuous captures that push themselves to the client.
+ *
+ * A subscription repeats one CaptureMulti from the render loop, every frame, every N frames or at
+ * a fixed rate, and writes each result to the ControlStream call it was made on. A frame is only
+ * taken when the call has room for it: when the client falls behind, due frames are skipped and
+ * counted, and the next frame sent is the newest one. A delta subscription sends only the tiles of
+ * each image that changed since its previous frame, see FUESynthTileDelta. A subscription made in
+ * a session captures that session's world. Subscriptions last until they are cancelled or their
+ * call ends. Game thread only, apart from the capture completions.
+ */
+class FUESynthSubscriptions final : public FTickableGameObject
+{
+public:
+  /** Captures of one subscription that may be in flight at once. */
+  static constexpr int32 MaxCapturesInFlight = 3;
+
+  FUESynthSubscriptions();
+  virtual ~FUESynthSubscriptions() override;
+
+  /** The module-owned subscriptions. */
+  static FUESynthSubscriptions& Get();
+
+  /**
+   * Starts pushing Request's frames to Stream, tagged with Id. Service runs the captures and must
+   * outlive the subscription. Returns false if Stream already has a subscription called Id.
+   */
+  bool Subscribe(UESynthServiceImpl& Service, const TSharedRef<FUESynthStreamLink>& Stream,
+                 const std::string& Id, const uesynth::SubscribeRequest& Request);
+
+  /** Cancels Stream's subscription Id; false if there is none. */
+  bool Unsubscribe(const FUESynthStreamLink& Stream, const std::string& Id);
+
+  /** Cancels every subscription. */
+  void Reset();
+
+  int32 Num() const { return Subscriptions.Num(); }
+
+  //~ Begin FTickableGameObject interface
+  virtual void Tick(float DeltaTime) override;
+  virtual ETickableTickType GetTickableTickType() const override {
+    return ETickableTickType::Always;
+  }
+  virtual bool IsTickableWhenPaused() const override {
+    return true;
+  }
+  virtual bool IsTickableInEditor() const override {
+    return true;
+  }
+  virtual TStatId GetStatId() const override;
+  //~ End FTickableGameObject interface
+
+private:
+  /** Shared with the subscription's in-flight captures, which complete on other threads. */
+  struct FSubscription
+  {
+    UESynthServiceImpl* Service = nullptr;
+    TSharedPtr<FUESynthStreamLink> Stream;
+    /** The session it was made in, if any, whose world it captures. */
+    TSharedPtr<FUESynthSession> Session;
+    std::string Id;
+    uesynth::CaptureMultiRequest Capture;
+    uint32 EveryNFrames = 1;
+    double Interval = 0.0;
+    int32 MaxQueued = 1;
+
+    /** Game thread only. */
+    uint64 LastFrame = 0;
+    double NextTime = 0.0;
+    uint64 Sequence = 0;
+    /** The stream's write-queue drop count as of the last segmentation revision check. */
+    uint64 SegmentationDropped = 0;
+
+    std::atomic<uint64> Dropped{0};
+    std::atomic<int32> CapturesInFlight{0};
+    std::atomic<uint32> SegmentationRevision{0};
+    /** Set from any thread once the subscription can't continue; removed on the next tick. */
+    std::atomic<bool> bEnded{false};
+
+    /** Delta subscriptions only, which capture raw and compress after diffing. */
+    TUniquePtr<FUESynthTileDelta> Delta;
+    EUESynthImageCodec ColorCodec = EUESynthImageCodec::Raw;
+    EUESynthImageCodec DataCodec = EUESynthImageCodec::Raw;
+    /** Guards Delta and LastDropped, and keeps frames in the order they were diffed. */
+    FCriticalSection DeltaLock;
+    /** The stream's write-queue drop count as of the last delta frame. */
+    uint64 LastDropped = 0;
+  };
+
+  /** Whether Subscription has a frame due now; advances its schedule if so. */
+  static bool IsDue(FSubscription& Subscription, uint64 Frame, double Now);
+
+  void Capture(const TSharedRef<FSubscription>& Subscription, uint64 Frame);
+
+  /** Diffs and compresses a delta subscription's captured frame, then pushes it. Any thread. */
+  static bool PushDelta(FSubscription& Subscription, uesynth::FrameResponse&& Response);
+
+  TArray<TSharedRef<FSubscription>> Subscriptions;
+
+  static FUESynthSubscriptions* Instance;
+};
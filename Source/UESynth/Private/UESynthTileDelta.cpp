@@ -0,0 +1,81 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthTileDelta.h"
+
+FUESynthTileDelta::FUESynthTileDelta(uint32 InTileSize, uint32 InKeyframeInterval)
+    : TileSize(FMath::Clamp<uint32>(InTileSize, MinTileSize, MaxTileSize)),
+      KeyframeInterval(InKeyframeInterval > 0 ? InKeyframeInterval : DefaultKeyframeInterval),
+      FramesSinceKeyframe(KeyframeInterval) {}
+
+bool FUESynthTileDelta::BeginFrame(uint64 InSequence, bool bForceKeyframe) {
+  Sequence = InSequence;
+  bKeyframe = bForceKeyframe || FramesSinceKeyframe >= KeyframeInterval;
+  FramesSinceKeyframe = bKeyframe ? 1 : FramesSinceKeyframe + 1;
+  return bKeyframe;
+}
+
+bool FUESynthTileDelta::Encode(int32 Slot, uesynth::ImageResponse* Image) {
+  check(Slot >= 0 && Slot < MaxSlots);
+  FPrevious& Last = Previous[Slot];
+  std::string* Data = Image->mutable_image_data();
+  const uint32 Width = Image->width();
+  const uint32 Height = Image->height();
+  const uint64 NumPixels = uint64(Width) * Height;
+
+  const bool bComparable = !bKeyframe && Last.Sequence != 0 && Last.Width == Width &&
+                           Last.Height == Height && Last.Format == Image->format() &&
+                           Last.Data.size() == Data->size() && NumPixels > 0 &&
+                           Data->size() % NumPixels == 0;
+  if (bComparable) {
+    const size_t BytesPerPixel = Data->size() / NumPixels;
+    const size_t RowPitch = Width * BytesPerPixel;
+    const uint32 TilesX = FMath::DivideAndRoundUp<uint32>(Width, TileSize);
+    const uint32 TilesY = FMath::DivideAndRoundUp<uint32>(Height, TileSize);
+    const char* Current = Data->data();
+    const char* Before = Last.Data.data();
+
+    uesynth::TileDelta Delta;
+    std::string Tiles;
+    for (uint32 TileY = 0; TileY < TilesY; ++TileY) {
+      const uint32 Y0 = TileY * TileSize;
+      const uint32 TileHeight = FMath::Min<uint32>(TileSize, Height - Y0);
+      for (uint32 TileX = 0; TileX < TilesX; ++TileX) {
+        const uint32 X0 = TileX * TileSize;
+        const size_t RowBytes = FMath::Min<uint32>(TileSize, Width - X0) * BytesPerPixel;
+        const size_t Start = Y0 * RowPitch + X0 * BytesPerPixel;
+
+        bool bChanged = false;
+        for (uint32 Row = 0; Row < TileHeight && !bChanged; ++Row) {
+          const size_t Offset = Start + Row * RowPitch;
+          bChanged = FMemory::Memcmp(Current + Offset, Before + Offset, RowBytes) != 0;
+        }
+        if (!bChanged) {
+          continue;
+        }
+        Delta.add_changed_tiles(TileY * TilesX + TileX);
+        for (uint32 Row = 0; Row < TileHeight; ++Row) {
+          Tiles.append(Current + Start + Row * RowPitch, RowBytes);
+        }
+      }
+    }
+
+    // A frame where everything moved is no smaller as tiles, and simpler to apply whole
+    if (Tiles.size() < Data->size()) {
+      Delta.set_tile_size(TileSize);
+      Delta.set_base_sequence(Last.Sequence);
+      *Image->mutable_delta() = MoveTemp(Delta);
+      Last.Data.swap(*Data);
+      Data->swap(Tiles);
+      Last.Sequence = Sequence;
+      return true;
+    }
+  }
+
+  Last.Data = *Data;
+  Last.Width = Width;
+  Last.Height = Height;
+  Last.Format = Image->format();
+  Last.Sequence = Sequence;
+  return false;
+}
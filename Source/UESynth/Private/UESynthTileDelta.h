@@ -0,0 +1,62 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "pb/uesynth.pb.h"
+#include <string>
+
+/**
+ * The changed-tile encoding of one delta subscription's images.
+ *
+ * A camera that holds still while a few objects move renders nearly the same frame over and over.
+ * Each image is cut into square tiles and compared, row by row, with the same image of the frame
+ * sent before it; only the tiles that differ go out, with their indices in ImageResponse.delta.
+ * Keyframes carry the whole image: the first frame, every KeyframeInterval frames after it, any
+ * frame whose size or format changed and any frame the caller forces, e.g. once the client may
+ * have missed one. Not thread-safe; the owning subscription guards it with its own lock.
+ */
+class FUESynthTileDelta
+{
+public:
+  static constexpr uint32 MinTileSize = 8;
+  static constexpr uint32 MaxTileSize = 256;
+  static constexpr uint32 DefaultKeyframeInterval = 30;
+
+  /** Slots are indices the caller picks per image of a frame, below MaxSlots. */
+  static constexpr int32 MaxSlots = 8;
+
+  /** A KeyframeInterval of 0 selects DefaultKeyframeInterval. */
+  FUESynthTileDelta(uint32 InTileSize, uint32 InKeyframeInterval);
+
+  /** Starts the frame numbered Sequence; returns whether it is a keyframe. */
+  bool BeginFrame(uint64 Sequence, bool bForceKeyframe);
+
+  /**
+   * Replaces Image's raw bytes with the tiles that changed since the image last passed for Slot,
+   * and keeps its raw bytes for the next frame. On a keyframe, or when every tile changed, the
+   * image stays whole. Returns true if Image became a delta.
+   */
+  bool Encode(int32 Slot, uesynth::ImageResponse* Image);
+
+  uint32 GetTileSize() const { return TileSize; }
+
+private:
+  struct FPrevious
+  {
+    std::string Data;
+    uint32 Width = 0;
+    uint32 Height = 0;
+    std::string Format;
+    /** The frame Data came from; 0 for none yet. */
+    uint64 Sequence = 0;
+  };
+
+  FPrevious Previous[MaxSlots];
+  uint32 TileSize;
+  uint32 KeyframeInterval;
+  uint32 FramesSinceKeyframe = 0;
+  uint64 Sequence = 0;
+  bool bKeyframe = true;
+};
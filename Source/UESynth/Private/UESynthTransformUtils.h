@@ -0,0 +1,78 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "pb/uesynth.pb.h"
+
+/** Conversions between the wire transform messages and engine math types. */
+namespace UESynthTransform
+{
+
+inline FVector ToVector(const uesynth::Vector3& In) { return FVector(In.x(), In.y(), In.z()); }
+
+inline FRotator ToRotator(const uesynth::Rotator& In) {
+  return FRotator(In.pitch(), In.yaw(), In.roll());
+}
+
+/** An unset scale means "unit scale", not zero, so a location/rotation-only message stays sane. */
+inline FTransform ToTransform(const uesynth::Transform& In) {
+  return FTransform(ToRotator(In.rotation()), ToVector(In.location()),
+                    In.has_scale() ? ToVector(In.scale()) : FVector::OneVector);
+}
+
+inline void FromVector(const FVector& In, uesynth::Vector3* Out) {
+  Out->set_x(In.X);
+  Out->set_y(In.Y);
+  Out->set_z(In.Z);
+}
+
+inline void FromTransform(const FTransform& In, uesynth::Transform* Out) {
+  FromVector(In.GetLocation(), Out->mutable_location());
+
+  const FRotator Rotation = In.Rotator();
+  uesynth::Rotator* OutRotation = Out->mutable_rotation();
+  OutRotation->set_pitch(Rotation.Pitch);
+  OutRotation->set_yaw(Rotation.Yaw);
+  OutRotation->set_roll(Rotation.Roll);
+
+  FromVector(In.GetScale3D(), Out->mutable_scale());
+}
+
+/** Floats per transform in the batched wire format: location, rotation (pitch/yaw/roll), scale. */
+constexpr int32 PackedFloats = 9;
+constexpr int32 PackedBytes = PackedFloats * sizeof(float);
+
+/** Reads one packed transform; In may be unaligned, as it points into a protobuf bytes field. */
+inline FTransform UnpackTransform(const uint8* In) {
+  float F[PackedFloats];
+  FMemory::Memcpy(F, In, PackedBytes);
+  return FTransform(FRotator(F[3], F[4], F[5]), FVector(F[0], F[1], F[2]),
+                    FVector(F[6], F[7], F[8]));
+}
+
+/** The PackedFloats values of one transform, in wire order. */
+inline void ToPackedFloats(const FTransform& In, float* Out) {
+  const FVector Location = In.GetLocation();
+  const FRotator Rotation = In.Rotator();
+  const FVector Scale = In.GetScale3D();
+  Out[0] = float(Location.X);
+  Out[1] = float(Location.Y);
+  Out[2] = float(Location.Z);
+  Out[3] = float(Rotation.Pitch);
+  Out[4] = float(Rotation.Yaw);
+  Out[5] = float(Rotation.Roll);
+  Out[6] = float(Scale.X);
+  Out[7] = float(Scale.Y);
+  Out[8] = float(Scale.Z);
+}
+
+/** Writes one packed transform; Out may be unaligned. */
+inline void PackTransform(const FTransform& In, uint8* Out) {
+  float F[PackedFloats];
+  ToPackedFloats(In, F);
+  FMemory::Memcpy(Out, F, PackedBytes);
+}
+
+} // namespace UESynthTransform
@@ -0,0 +1,130 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#include "UESynthWriteQueue.h"
+#include <string>
+
+namespace {
+
+/** The value of metadata Key sent by the client, or an empty string. */
+std::string GetMetadata(const grpc::ServerContext* Context, const char* Key) {
+  if (!Context) {
+    return std::string();
+  }
+  const auto& Metadata = Context->client_metadata();
+  const auto It = Metadata.find(Key);
+  return It == Metadata.end() ? std::string()
+                              : std::string(It->second.data(), It->second.length());
+}
+
+} // namespace
+
+FUESynthQueuedResponse::FUESynthQueuedResponse(FUESynthQueuedResponse&& Other)
+    : Arena(MoveTemp(Other.Arena)), OnArena(Other.OnArena), Owned(MoveTemp(Other.Owned)) {
+  Other.OnArena = nullptr;
+}
+
+FUESynthQueuedResponse& FUESynthQueuedResponse::operator=(FUESynthQueuedResponse&& Other) {
+  if (this != &Other) {
+    // The old message goes before the arena it may live on
+    OnArena = nullptr;
+    Arena = MoveTemp(Other.Arena);
+    OnArena = Other.OnArena;
+    Other.OnArena = nullptr;
+    Owned = MoveTemp(Other.Owned);
+  }
+  return *this;
+}
+
+FUESynthWriteQueue::FUESynthWriteQueue(int32 InCapacity, EUESynthWritePolicy InPolicy)
+    : Capacity(FMath::Clamp(InCapacity, 1, MaxCapacity)), Policy(InPolicy) {}
+
+FUESynthWriteQueue FUESynthWriteQueue::FromMetadata(const grpc::ServerContext* Context) {
+  int32 Capacity = DefaultCapacity;
+  const std::string Depth = GetMetadata(Context, DepthMetadataKey);
+  if (!Depth.empty()) {
+    Capacity = FCString::Atoi(UTF8_TO_TCHAR(Depth.c_str()));
+  }
+
+  EUESynthWritePolicy Policy = EUESynthWritePolicy::Block;
+  const std::string Name = GetMetadata(Context, PolicyMetadataKey);
+  for (EUESynthWritePolicy Candidate : {EUESynthWritePolicy::DropOldest,
+                                        EUESynthWritePolicy::DropNewest}) {
+    if (Name == PolicyName(Candidate)) {
+      Policy = Candidate;
+    }
+  }
+  return FUESynthWriteQueue(Capacity, Policy);
+}
+
+int32 FUESynthWriteQueue::Push(FUESynthQueuedResponse&& Response) {
+  int32 NumDropped = 0;
+  if (Num() >= Capacity && IsDroppable(Response.Get())) {
+    if (Policy == EUESynthWritePolicy::DropNewest) {
+      UESynthImageBuffers::Reclaim(&Response.Get());
+      ++Dropped;
+      return 1;
+    }
+    if (Policy == EUESynthWritePolicy::DropOldest) {
+      // Replies stay where they are; the oldest subscription frame makes room.
+      for (auto It = Responses.begin(); It != Responses.end(); ++It) {
+        if (IsDroppable(It->Get())) {
+          UESynthImageBuffers::Reclaim(&It->Get());
+          Responses.erase(It);
+          ++Dropped;
+          NumDropped = 1;
+          break;
+        }
+      }
+    }
+  }
+
+  Responses.push_back(MoveTemp(Response));
+  PeakDepth = FMath::Max(PeakDepth, Num());
+  return NumDropped;
+}
+
+bool FUESynthWriteQueue::Pop(FUESynthQueuedResponse* Out) {
+  if (Responses.empty()) {
+    return false;
+  }
+  *Out = MoveTemp(Responses.front());
+  Responses.pop_front();
+  return true;
+}
+
+bool FUESynthWriteQueue::ShouldThrottleReads() const {
+  return Policy == EUESynthWritePolicy::Block && Num() >= Capacity;
+}
+
+int32 FUESynthWriteQueue::Reset() {
+  const int32 NumDropped = Num();
+  Responses.clear();
+  return NumDropped;
+}
+
+FUESynthWriteQueueStats FUESynthWriteQueue::GetStats() const {
+  FUESynthWriteQueueStats Stats;
+  Stats.Policy = Policy;
+  Stats.Depth = Num();
+  Stats.Capacity = Capacity;
+  Stats.PeakDepth = PeakDepth;
+  Stats.Dropped = Dropped;
+  return Stats;
+}
+
+bool FUESynthWriteQueue::IsDroppable(const uesynth::FrameResponse& Response) {
+  // Capture replies carry images too, but a client is waiting on their request ID
+  return Response.response_case() == uesynth::FrameResponse::kSubscriptionFrame;
+}
+
+const char* FUESynthWriteQueue::PolicyName(EUESynthWritePolicy Policy) {
+  switch (Policy) {
+  case EUESynthWritePolicy::DropOldest:
+    return "drop_oldest";
+  case EUESynthWritePolicy::DropNewest:
+    return "drop_newest";
+  default:
+    return "block";
+  }
+}
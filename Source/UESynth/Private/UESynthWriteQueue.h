@@ -0,0 +1,119 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UESynthMessageArena.h"
+#include "pb/uesynth.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <deque>
+
+/** What a ControlStream call does with subscription frames once its outbound queue is full. */
+enum class EUESynthWritePolicy : uint8
+{
+  /** Keep everything and stop taking new actions until the client catches up. */
+  Block,
+  /** Discard the oldest queued subscription frame to make room. */
+  DropOldest,
+  /** Discard the subscription frame that doesn't fit. */
+  DropNewest,
+};
+
+/** A snapshot of one outbound queue. */
+struct FUESynthWriteQueueStats
+{
+  EUESynthWritePolicy Policy = EUESynthWritePolicy::Block;
+  int32 Depth = 0;
+  int32 Capacity = 0;
+  int32 PeakDepth = 0;
+  uint64 Dropped = 0;
+};
+
+/**
+ * A response waiting to be written: either a message of its own or one living on the arena of
+ * the action that built it, which is reset once this goes away.
+ */
+class FUESynthQueuedResponse
+{
+public:
+  FUESynthQueuedResponse() = default;
+
+  /** Implicit, so heap responses such as subscription frames queue as they are, without copies. */
+  FUESynthQueuedResponse(uesynth::FrameResponse&& InResponse) : Owned(MoveTemp(InResponse)) {}
+
+  /** A response owned by Arena. */
+  FUESynthQueuedResponse(FUESynthMessageArena&& InArena, uesynth::FrameResponse* InResponse)
+      : Arena(MoveTemp(InArena)), OnArena(InResponse) {}
+
+  FUESynthQueuedResponse(FUESynthQueuedResponse&& Other);
+  FUESynthQueuedResponse& operator=(FUESynthQueuedResponse&& Other);
+
+  uesynth::FrameResponse& Get() { return OnArena ? *OnArena : Owned; }
+  const uesynth::FrameResponse& Get() const { return OnArena ? *OnArena : Owned; }
+
+private:
+  FUESynthMessageArena Arena;
+  uesynth::FrameResponse* OnArena = nullptr;
+  uesynth::FrameResponse Owned;
+};
+
+/**
+ * Bounded queue of the responses one ControlStream call has yet to write.
+ *
+ * A client reading slower than the server answers would otherwise pile responses up, each with
+ * an image in it, for as long as it lags. Only subscription frames count as droppable: nobody
+ * waits on an unsolicited frame and a stale one is worth nothing, but every reply to an action,
+ * captures included, is queued whatever the depth, so a client never loses one it is waiting
+ * for. Not thread-safe; the owning call guards it with its own lock.
+ */
+class FUESynthWriteQueue
+{
+public:
+  /** Client metadata keys a stream's queue is configured with. */
+  static constexpr const char* DepthMetadataKey = "uesynth-write-queue-depth";
+  static constexpr const char* PolicyMetadataKey = "uesynth-write-queue-policy";
+  static constexpr int32 DefaultCapacity = 16;
+  static constexpr int32 MaxCapacity = 1024;
+
+  FUESynthWriteQueue(int32 InCapacity, EUESynthWritePolicy InPolicy);
+
+  /**
+   * A queue configured from Context's metadata: a depth clamped to [1, MaxCapacity] and one of
+   * "block", "drop_oldest" or "drop_newest". Missing or unknown values keep the defaults.
+   */
+  static FUESynthWriteQueue FromMetadata(const grpc::ServerContext* Context);
+
+  /**
+   * Queues Response and returns how many responses were dropped to keep the bound, 0 or 1. The
+   * images of a dropped response go back to UESynthImageBuffers.
+   */
+  int32 Push(FUESynthQueuedResponse&& Response);
+
+  /** Takes the oldest response; false if there is none. */
+  bool Pop(FUESynthQueuedResponse* Out);
+
+  int32 Num() const { return static_cast<int32>(Responses.size()); }
+  bool IsEmpty() const { return Responses.empty(); }
+
+  /** Under the block policy, whether the call should stop reading actions for now. */
+  bool ShouldThrottleReads() const;
+
+  /** Drops everything still queued, e.g. after a write failed; returns how many that was. */
+  int32 Reset();
+
+  FUESynthWriteQueueStats GetStats() const;
+
+  /** Whether policy may drop Response: true for subscription frames only. */
+  static bool IsDroppable(const uesynth::FrameResponse& Response);
+
+  /** The name the metadata and StreamStats use for Policy. */
+  static const char* PolicyName(EUESynthWritePolicy Policy);
+
+private:
+  std::deque<FUESynthQueuedResponse> Responses;
+  int32 Capacity;
+  EUESynthWritePolicy Policy;
+  int32 PeakDepth = 0;
+  uint64 Dropped = 0;
+};
@@ -9,15 +9,79 @@
 #include <thread>
 #include <memory>
 
+class FUESynthAssetCache;
+class FUESynthAsyncServer;
+class FUESynthCommandQueue;
+class FUESynthFrameCapture;
+class FUESynthFrameReadback;
+class FUESynthHealth;
+class FUESynthLockstep;
+class FUESynthMetricsEndpoint;
+class FUESynthRecordings;
+class FUESynthRegistration;
+class FUESynthSceneContext;
+struct FUESynthServerSettings;
+class FUESynthSessions;
+class FUESynthSubscriptions;
+
 class FUESynthModule : public IModuleInterface
 {
 public:
+	FUESynthModule();
+	virtual ~FUESynthModule() override; // Out of line so TUniquePtr sees the complete types
 
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 
 private:
+	/** Legacy thread-per-call server, selected with -UESynthSyncServer */
+	void StartSyncServer(const FUESynthServerSettings& Settings);
+
+	/** Scene view extensions can only be registered once the engine exists */
+	void CreateFrameCapture();
+
+	// Game-thread work from every RPC is drained here once per frame
+	TUniquePtr<FUESynthCommandQueue> CommandQueue;
+
+	// Ring of GPU staging buffers captures are read back through
+	TUniquePtr<FUESynthFrameReadback> FrameReadback;
+
+	// Multi-modal captures read straight out of the game view's post-processing
+	TSharedPtr<FUESynthFrameCapture, ESPMode::ThreadSafe> FrameCapture;
+	FDelegateHandle PostEngineInitHandle;
+
+	// Cached world, viewport and camera lookups shared by the handlers
+	TUniquePtr<FUESynthSceneContext> SceneContext;
+
+	// Client sessions, each with a world and a command lane of its own
+	TUniquePtr<FUESynthSessions> Sessions;
+
+	// Continuous captures pushed to ControlStream clients
+	TUniquePtr<FUESynthSubscriptions> Subscriptions;
+
+	// Frames written to disk on the server by a thread of their own
+	TUniquePtr<FUESynthRecordings> Recordings;
+
+	// Frames paced by client steps instead of the display, off until a client asks
+	TUniquePtr<FUESynthLockstep> Lockstep;
+
+	// Assets streamed in ahead of the spawns that use them
+	TUniquePtr<FUESynthAssetCache> AssetCache;
+
+	// Prometheus text endpoint over the server stats, off unless MetricsPort is set
+	TUniquePtr<FUESynthMetricsEndpoint> MetricsEndpoint;
+
+	// What GetHealth reports, noted by the game thread every frame
+	TUniquePtr<FUESynthHealth> Health;
+
+	// The async server's file in RegistrationDir, for fleet clients to find it
+	TUniquePtr<FUESynthRegistration> Registration;
+
+	// Completion-queue based server (default)
+	TUniquePtr<FUESynthAsyncServer> AsyncServer;
+
+	// Synchronous server
 	std::unique_ptr<grpc::Server> GRPCServer;
 	std::thread GRPCServerThread;
 };
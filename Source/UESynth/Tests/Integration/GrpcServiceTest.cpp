@@ -739,7 +739,7 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceEndToEndTest,
   // Test object manipulation workflow
   {
     // Step 1: List existing objects
-    google::protobuf::Empty ListRequest;
+    uesynth::ListObjectsRequest ListRequest;
     uesynth::ListObjectsResponse ListResponse;
 
     grpc::Status ListStatus = ServiceImpl->ListObjects(
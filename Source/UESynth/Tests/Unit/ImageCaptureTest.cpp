@@ -3,6 +3,12 @@
 
 #include "../UESynthTestBase.h"
 #include "pb/uesynth.grpc.pb.h"
+#include "UESynthImageEncoder.h"
+#include "UESynthPixelConvert.h"
+#include "UESynthSceneContext.h"
+#include "UESynthTileDelta.h"
+#include "Misc/Compression.h"
+#include "Misc/ScopeExit.h"
 
 /**
  * Unit tests for image capture functionality
@@ -123,7 +129,7 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureDepthTest,
     "UESynth.Unit.ImageCapture.Depth",
     EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 {
-    // Test depth map capture (placeholder implementation)
+    // Test depth map capture, raw float32 by default
     {
         uesynth::CaptureRequest Request;
         uesynth::ImageResponse Response;
@@ -137,20 +143,22 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureDepthTest,
         AssertGrpcStatusOk(Status, TEXT("Depth map capture"));
         UESYNTH_TEST_EQUAL(Response.width(), 640, "Depth width should match request");
         UESYNTH_TEST_EQUAL(Response.height(), 480, "Depth height should match request");
-        UESYNTH_TEST_TRUE(Response.format() == "png", "Depth format should be PNG");
+        UESYNTH_TEST_TRUE(Response.format() == "depth_f32", "Depth format should be raw float32");
         
-        // Current implementation returns dummy data
-        size_t ExpectedSize = 640 * 480; // 1 byte per pixel for depth
+        size_t ExpectedSize = 640 * 480 * 4; // One float per pixel
         UESYNTH_TEST_EQUAL(Response.image_data().size(), ExpectedSize, "Depth data size should match");
     }
 
-    // Test different depth resolutions
+    // Test quantized depth at a different resolution
     {
         uesynth::CaptureRequest Request;
         uesynth::ImageResponse Response;
         
         Request.set_width(320);
         Request.set_height(240);
+        Request.set_depth_encoding(uesynth::DEPTH_ENCODING_UINT16);
+        Request.set_depth_near(10.0f);
+        Request.set_depth_far(5000.0f);
 
         grpc::Status Status = ServiceImpl->CaptureDepthMap(
             MockContext->GetServerContext(), &Request, &Response);
@@ -158,11 +166,91 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureDepthTest,
         AssertGrpcStatusOk(Status, TEXT("Depth map different resolution"));
         UESYNTH_TEST_EQUAL(Response.width(), 320, "Different depth width");
         UESYNTH_TEST_EQUAL(Response.height(), 240, "Different depth height");
+        UESYNTH_TEST_TRUE(Response.format() == "depth_u16:near=10,far=5000", "Format should carry the quantization range");
+        UESYNTH_TEST_EQUAL(Response.image_data().size(), (size_t)(320 * 240 * 2), "UINT16 should halve the float32 size");
+    }
+
+    // Test an empty depth range
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+
+        Request.set_depth_encoding(uesynth::DEPTH_ENCODING_UINT16);
+        Request.set_depth_near(100.0f);
+        Request.set_depth_far(100.0f);
+
+        grpc::Status Status = ServiceImpl->CaptureDepthMap(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "Empty depth range should be rejected");
     }
 
     return true;
 }
 
+// Test depth encoding conversion
+class FUESynthImageCaptureDepthEncodingTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthImageCaptureDepthEncodingTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureDepthEncodingTest,
+    "UESynth.Unit.ImageCapture.DepthEncoding",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    using UESynthPixels::EDepthEncoding;
+    const float Depths[] = {0.0f, 10.0f, 100.0f, 1008.0f, 5000.0f, 1.0e6f};
+    const int32 Width = UE_ARRAY_COUNT(Depths);
+
+    // Float32 is passed through untouched
+    {
+        float Out[Width] = {};
+        UESynthPixels::ConvertDepthRow(EDepthEncoding::Float32, Depths, reinterpret_cast<uint8*>(Out), Width, 0.0f, 0.0f);
+        UESYNTH_TEST_TRUE(FMemory::Memcmp(Out, Depths, sizeof(Depths)) == 0, "Float32 should be a plain copy");
+    }
+
+    // Float16 keeps small depths exactly and saturates past half precision
+    {
+        uint16 Out[Width] = {};
+        UESynthPixels::ConvertDepthRow(EDepthEncoding::Float16, Depths, reinterpret_cast<uint8*>(Out), Width, 0.0f, 0.0f);
+        UESYNTH_TEST_EQUAL(FPlatformMath::LoadHalf(&Out[2]), 100.0f, "100 cm should survive float16");
+        UESYNTH_TEST_TRUE(FPlatformMath::LoadHalf(&Out[5]) >= 65504.0f, "Far depth should saturate");
+    }
+
+    // UInt16 maps near..far onto the full range and clamps outside it
+    {
+        uint16 Out[Width] = {};
+        UESynthPixels::ConvertDepthRow(EDepthEncoding::UInt16, Depths, reinterpret_cast<uint8*>(Out), Width, 10.0f, 5000.0f);
+        UESYNTH_TEST_EQUAL((int32)Out[0], 0, "Closer than near should clamp to 0");
+        UESYNTH_TEST_EQUAL((int32)Out[1], 0, "Near should map to 0");
+        UESYNTH_TEST_EQUAL((int32)Out[3], 13107, "A fifth of the range should map to a fifth of 65535");
+        UESYNTH_TEST_EQUAL((int32)Out[4], 65535, "Far should map to 65535");
+        UESYNTH_TEST_EQUAL((int32)Out[5], 65535, "Farther than far should clamp to 65535");
+    }
+
+    // The default range steps in millimetres
+    {
+        const float Depth = 123.4f;
+        uint16 Out = 0;
+        UESynthPixels::ConvertDepthRow(EDepthEncoding::UInt16, &Depth, reinterpret_cast<uint8*>(&Out), 1,
+            UESynthPixels::DefaultDepthNear, UESynthPixels::DefaultDepthFar);
+        UESYNTH_TEST_EQUAL((int32)Out, 1234, "Default quantization should be 1 mm per step");
+    }
+
+    UESYNTH_TEST_TRUE(UESynthPixels::DepthFormatName(EDepthEncoding::Float16, 0.0f, 0.0f) == TEXT("depth_f16"), "Float16 format name");
+    UESYNTH_TEST_EQUAL(UESynthPixels::BytesPerDepth(EDepthEncoding::UInt16), 2, "UInt16 should be 2 bytes per pixel");
+
+    return true;
+}
+
 // Test segmentation mask capture
 class FUESynthImageCaptureSegmentationTest : public FAutomationTestBase, public UESynthTestBase
 {
@@ -181,7 +269,8 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureSegmentationTest,
     "UESynth.Unit.ImageCapture.Segmentation",
     EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 {
-    // Test segmentation mask capture (placeholder implementation)
+    // Test segmentation mask capture: one instance ID byte per pixel
+    uint32 Revision = 0;
     {
         uesynth::CaptureRequest Request;
         uesynth::ImageResponse Response;
@@ -195,11 +284,35 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureSegmentationTest,
         AssertGrpcStatusOk(Status, TEXT("Segmentation mask capture"));
         UESYNTH_TEST_EQUAL(Response.width(), 800, "Segmentation width should match request");
         UESYNTH_TEST_EQUAL(Response.height(), 600, "Segmentation height should match request");
-        UESYNTH_TEST_TRUE(Response.format() == "png", "Segmentation format should be PNG");
+        UESYNTH_TEST_TRUE(Response.format() == "instance_u8", "Segmentation format should be instance_u8");
         
-        // Current implementation returns dummy data (RGB = 3 bytes per pixel)
-        size_t ExpectedSize = 800 * 600 * 3;
+        size_t ExpectedSize = 800 * 600;
         UESYNTH_TEST_EQUAL(Response.image_data().size(), ExpectedSize, "Segmentation data size should match");
+        UESYNTH_TEST_TRUE(Response.segmentation_revision() != 0, "Segmentation revision should be set");
+
+        for (const uesynth::SegmentationEntry& Entry : Response.segmentation_table())
+        {
+            UESYNTH_TEST_TRUE(Entry.segmentation_id() != 0, "Segmentation IDs should be nonzero");
+            UESYNTH_TEST_TRUE(!Entry.object_name().empty(), "Segmentation entries should be named");
+        }
+        Revision = Response.segmentation_revision();
+    }
+
+    // Test the ID table is left out once the client already has it
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        
+        Request.set_width(800);
+        Request.set_height(600);
+        Request.set_segmentation_revision(Revision);
+
+        grpc::Status Status = ServiceImpl->CaptureSegmentationMask(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("Segmentation mask capture with known revision"));
+        UESYNTH_TEST_EQUAL(Response.segmentation_revision(), Revision, "Segmentation revision should be unchanged");
+        UESYNTH_TEST_EQUAL(Response.segmentation_table_size(), 0, "Known segmentation table should not be resent");
     }
 
     return true;
@@ -223,7 +336,7 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureNormalsTest,
     "UESynth.Unit.ImageCapture.Normals",
     EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 {
-    // Test normals capture (placeholder implementation)
+    // Test normals capture
     {
         uesynth::CaptureRequest Request;
         uesynth::ImageResponse Response;
@@ -237,13 +350,24 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureNormalsTest,
         AssertGrpcStatusOk(Status, TEXT("Normals capture"));
         UESYNTH_TEST_EQUAL(Response.width(), 512, "Normals width should match request");
         UESYNTH_TEST_EQUAL(Response.height(), 512, "Normals height should match request");
-        UESYNTH_TEST_TRUE(Response.format() == "png", "Normals format should be PNG");
+        UESYNTH_TEST_TRUE(Response.format() == "normal_rgb8", "Normals format should be normal_rgb8");
         
-        // Current implementation returns dummy data (RGB = 3 bytes per pixel)
+        // RGB = 3 bytes per pixel
         size_t ExpectedSize = 512 * 512 * 3;
         UESYNTH_TEST_EQUAL(Response.image_data().size(), ExpectedSize, "Normals data size should match");
     }
 
+    // Test pooled cameras have no GBuffer to read
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        Request.set_camera_name("UESynthTest_Camera");
+
+        grpc::Status Status = ServiceImpl->CaptureNormals(
+            MockContext->GetServerContext(), &Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::UNIMPLEMENTED, "Camera normals should be unimplemented");
+    }
+
     return true;
 }
 
@@ -265,7 +389,7 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureOpticalFlowTest,
     "UESynth.Unit.ImageCapture.OpticalFlow",
     EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
 {
-    // Test optical flow capture (placeholder implementation)
+    // Test optical flow capture
     {
         uesynth::CaptureRequest Request;
         uesynth::ImageResponse Response;
@@ -279,13 +403,24 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureOpticalFlowTest,
         AssertGrpcStatusOk(Status, TEXT("Optical flow capture"));
         UESYNTH_TEST_EQUAL(Response.width(), 1024, "Optical flow width should match request");
         UESYNTH_TEST_EQUAL(Response.height(), 768, "Optical flow height should match request");
-        UESYNTH_TEST_TRUE(Response.format() == "png", "Optical flow format should be PNG");
+        UESYNTH_TEST_TRUE(Response.format() == "flow_f16", "Optical flow format should be flow_f16");
         
-        // Current implementation returns dummy data (2 channels = 2 bytes per pixel)
-        size_t ExpectedSize = 1024 * 768 * 2;
+        // Two half floats per pixel
+        size_t ExpectedSize = 1024 * 768 * 4;
         UESYNTH_TEST_EQUAL(Response.image_data().size(), ExpectedSize, "Optical flow data size should match");
     }
 
+    // Test pooled cameras have no velocity buffer to read
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        Request.set_camera_name("UESynthTest_Camera");
+
+        grpc::Status Status = ServiceImpl->CaptureOpticalFlow(
+            MockContext->GetServerContext(), &Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::UNIMPLEMENTED, "Camera optical flow should be unimplemented");
+    }
+
     return true;
 }
 
@@ -355,5 +490,445 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureErrorTest,
         }
     }
 
+    return true;
+}
+
+// Test the capture pixel format kernels against the scalar path
+class FUESynthImageCapturePixelFormatTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthImageCapturePixelFormatTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCapturePixelFormatTest,
+    "UESynth.Unit.ImageCapture.PixelFormats",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    using UESynthPixels::EFormat;
+    const EFormat Formats[] = {EFormat::RGBA8, EFormat::RGB8, EFormat::BGR8, EFormat::Gray8};
+
+    // Same pattern as the standard resolution RGB capture, one 1920 pixel row at a time
+    TArray<FColor> TestPixels;
+    for (int32 i = 0; i < 1920 * 4; ++i)
+    {
+        TestPixels.Add(FColor(i % 256, (i / 256) % 256, 128, 255));
+    }
+
+    // FColor is laid out as B8G8R8A8; also read the same bytes as R8G8B8A8
+    const uint8* Source = reinterpret_cast<const uint8*>(TestPixels.GetData());
+    for (EPixelFormat SourceFormat : {PF_B8G8R8A8, PF_R8G8B8A8, PF_A2B10G10R10})
+    {
+        for (EFormat Format : Formats)
+        {
+            const int32 Bytes = UESynthPixels::BytesPerPixel(Format);
+
+            // Widths that leave every kind of SIMD tail, up to a full row
+            for (int32 Width : {1, 3, 5, 7, 11, 15, 17, 31, 33, 64, 1920})
+            {
+                TArray<uint8> Simd, Scalar;
+                Simd.Init(0xCD, Width * Bytes + 16);
+                Scalar.Init(0xCD, Width * Bytes + 16);
+
+                UESynthPixels::ConvertRow(SourceFormat, Format, Source, Simd.GetData(), Width);
+                UESynthPixels::ConvertRowScalar(SourceFormat, Format, Source, Scalar.GetData(), Width);
+                UESYNTH_TEST_TRUE(Simd == Scalar, "SIMD conversion should match the scalar path, tail included");
+            }
+        }
+    }
+
+    // Channel order and dropped alpha
+    {
+        const FColor Pixel(10, 20, 30, 40);
+        uint8 Out[4] = {};
+
+        UESynthPixels::ConvertRow(PF_B8G8R8A8, EFormat::RGBA8, reinterpret_cast<const uint8*>(&Pixel), Out, 1);
+        UESYNTH_TEST_TRUE(Out[0] == 10 && Out[1] == 20 && Out[2] == 30 && Out[3] == 40, "RGBA should keep alpha");
+
+        UESynthPixels::ConvertRow(PF_B8G8R8A8, EFormat::RGB8, reinterpret_cast<const uint8*>(&Pixel), Out, 1);
+        UESYNTH_TEST_TRUE(Out[0] == 10 && Out[1] == 20 && Out[2] == 30, "RGB should be red first");
+
+        UESynthPixels::ConvertRow(PF_B8G8R8A8, EFormat::BGR8, reinterpret_cast<const uint8*>(&Pixel), Out, 1);
+        UESYNTH_TEST_TRUE(Out[0] == 30 && Out[1] == 20 && Out[2] == 10, "BGR should be blue first");
+    }
+
+    // Gray of the small resolution case's red pixels, and of white
+    {
+        TArray<FColor> RedPixels;
+        RedPixels.Init(FColor(255, 0, 0, 255), 64 * 64);
+        TArray<uint8> Gray;
+        Gray.SetNumZeroed(64 * 64);
+        UESynthPixels::ConvertRow(PF_B8G8R8A8, EFormat::Gray8,
+            reinterpret_cast<const uint8*>(RedPixels.GetData()), Gray.GetData(), 64 * 64);
+        UESYNTH_TEST_EQUAL((int32)Gray[0], 76, "Red should map to BT.601 luma");
+        UESYNTH_TEST_EQUAL((int32)Gray.Last(), 76, "Every red pixel should match");
+
+        const FColor White = FColor::White;
+        uint8 Out = 0;
+        UESynthPixels::ConvertRow(PF_B8G8R8A8, EFormat::Gray8, reinterpret_cast<const uint8*>(&White), &Out, 1);
+        UESYNTH_TEST_EQUAL((int32)Out, 255, "White should stay white");
+    }
+
+    // Only the requested channels go over the wire
+    UESYNTH_TEST_EQUAL(UESynthPixels::BytesPerPixel(EFormat::RGB8), 3, "RGB should be 3 bytes per pixel");
+    UESYNTH_TEST_EQUAL(UESynthPixels::BytesPerPixel(EFormat::Gray8), 1, "Gray should be 1 byte per pixel");
+
+    return true;
+}
+
+// Test captured images are compressed with the codec the request picked
+class FUESynthImageCaptureEncodingTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthImageCaptureEncodingTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureEncodingTest,
+    "UESynth.Unit.ImageCapture.Encoding",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // A smooth 64x32 RGB gradient, which every codec shrinks
+    constexpr int32 Width = 64;
+    constexpr int32 Height = 32;
+    auto MakeImage = [Width, Height]()
+    {
+        uesynth::ImageResponse Image;
+        Image.set_width(Width);
+        Image.set_height(Height);
+        Image.set_format("rgb");
+        std::string* Data = Image.mutable_image_data();
+        Data->resize(Width * Height * 3);
+        for (int32 Index = 0; Index < Width * Height; ++Index)
+        {
+            (*Data)[Index * 3 + 0] = char(Index % Width * 4);
+            (*Data)[Index * 3 + 1] = char(Index / Width * 8);
+            (*Data)[Index * 3 + 2] = char(128);
+        }
+        return Image;
+    };
+    const std::string Raw = MakeImage().image_data();
+
+    // Test the lossless codecs unpack to the exact raw bytes
+    for (const EUESynthImageCodec Codec : {EUESynthImageCodec::Lz4, EUESynthImageCodec::Zlib})
+    {
+        uesynth::ImageResponse Image = MakeImage();
+        UESYNTH_TEST_TRUE(UESynthImageEncoder::Encode({&Image, Codec}), "Lossless encoding should succeed");
+        UESYNTH_TEST_EQUAL(Image.raw_size(), uint64(Raw.size()), "raw_size should be the unpacked size");
+        UESYNTH_TEST_TRUE(Image.image_data().size() < Raw.size(), "A gradient should compress");
+
+        std::string Unpacked(Raw.size(), '\0');
+        const bool bUnpacked = FCompression::UncompressMemory(
+            Codec == EUESynthImageCodec::Lz4 ? NAME_LZ4 : NAME_Zlib, &Unpacked[0], int32(Unpacked.size()),
+            Image.image_data().data(), int32(Image.image_data().size()));
+        UESYNTH_TEST_TRUE(bUnpacked && Unpacked == Raw, "Unpacking should give back the raw bytes");
+        UESYNTH_TEST_TRUE(Image.format() == "rgb", "format should still name the raw layout");
+    }
+
+    // Test JPEG and PNG produce files of their kind
+    {
+        uesynth::ImageResponse Image = MakeImage();
+        UESYNTH_TEST_TRUE(UESynthImageEncoder::Encode({&Image, EUESynthImageCodec::Jpeg, UESynthPixels::EFormat::RGB8, 90}),
+            "JPEG encoding should succeed");
+        UESYNTH_TEST_TRUE(Image.codec() == uesynth::IMAGE_CODEC_JPEG, "codec should be recorded");
+        UESYNTH_TEST_TRUE(Image.image_data().compare(0, 2, "\xFF\xD8") == 0, "Data should be a JPEG file");
+
+        Image = MakeImage();
+        UESYNTH_TEST_TRUE(UESynthImageEncoder::Encode({&Image, EUESynthImageCodec::Png, UESynthPixels::EFormat::RGB8}),
+            "PNG encoding should succeed");
+        UESYNTH_TEST_TRUE(Image.image_data().compare(0, 4, "\x89PNG") == 0, "Data should be a PNG file");
+    }
+
+    // Test an image whose size doesn't match its layout is left alone
+    {
+        uesynth::ImageResponse Image = MakeImage();
+        UESYNTH_TEST_FALSE(UESynthImageEncoder::Encode({&Image, EUESynthImageCodec::Png, UESynthPixels::EFormat::RGBA8}),
+            "PNG of a mislabelled layout should fail");
+        UESYNTH_TEST_TRUE(Image.image_data() == Raw && Image.codec() == uesynth::IMAGE_CODEC_RAW,
+            "A failed encoding should leave the image raw");
+    }
+
+    // Test lossy codecs are refused for depth
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        Request.set_codec(uesynth::IMAGE_CODEC_JPEG);
+        grpc::Status Status = ServiceImpl->CaptureDepthMap(
+            MockContext->GetServerContext(), &Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "JPEG depth should be INVALID_ARGUMENT");
+    }
+
+    return true;
+}
+
+// Test delta frames only carry the tiles that changed
+class FUESynthImageCaptureTileDeltaTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthImageCaptureTileDeltaTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureTileDeltaTest,
+    "UESynth.Unit.ImageCapture.TileDelta",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // 40x24 gray in 16 pixel tiles: 3x2 tiles, the right and bottom ones clipped to 8
+    constexpr int32 Width = 40;
+    constexpr int32 Height = 24;
+    std::string Pixels(Width * Height, char(10));
+    auto MakeImage = [&Pixels, Width, Height]()
+    {
+        uesynth::ImageResponse Image;
+        Image.set_width(Width);
+        Image.set_height(Height);
+        Image.set_format("gray");
+        Image.set_image_data(Pixels);
+        return Image;
+    };
+
+    FUESynthTileDelta Delta(16, 0);
+
+    // Test the first frame is sent whole
+    {
+        UESYNTH_TEST_TRUE(Delta.BeginFrame(1, false), "The first frame should be a keyframe");
+        uesynth::ImageResponse Image = MakeImage();
+        UESYNTH_TEST_FALSE(Delta.Encode(0, &Image), "A keyframe should stay whole");
+        UESYNTH_TEST_TRUE(Image.image_data() == Pixels && !Image.has_delta(), "A keyframe should carry every pixel");
+    }
+
+    // Test one changed pixel sends only its clipped tile
+    {
+        Pixels[20 * Width + 35] = char(200);
+        UESYNTH_TEST_FALSE(Delta.BeginFrame(2, false), "The second frame should be a delta");
+        uesynth::ImageResponse Image = MakeImage();
+        UESYNTH_TEST_TRUE(Delta.Encode(0, &Image), "A mostly unchanged frame should become a delta");
+        UESYNTH_TEST_EQUAL(Image.delta().changed_tiles_size(), 1, "Only one tile should have changed");
+        UESYNTH_TEST_EQUAL(Image.delta().changed_tiles(0), 5u, "The bottom right tile should have changed");
+        UESYNTH_TEST_EQUAL(Image.delta().base_sequence(), uint64(1), "The delta should apply to frame 1");
+        UESYNTH_TEST_EQUAL(Image.delta().tile_size(), 16u, "The tile size should be sent");
+
+        std::string Tile;
+        for (int32 Row = 16; Row < Height; ++Row)
+        {
+            Tile.append(Pixels, Row * Width + 32, 8);
+        }
+        UESYNTH_TEST_TRUE(Image.image_data() == Tile, "The data should be the clipped tile's rows");
+    }
+
+    // Test an unchanged frame carries no tiles, and applies to the frame before it
+    {
+        Delta.BeginFrame(3, false);
+        uesynth::ImageResponse Image = MakeImage();
+        UESYNTH_TEST_TRUE(Delta.Encode(0, &Image), "An unchanged frame should be a delta");
+        UESYNTH_TEST_EQUAL(Image.delta().changed_tiles_size(), 0, "No tiles should have changed");
+        UESYNTH_TEST_EQUAL(Image.delta().base_sequence(), uint64(2), "The delta should apply to frame 2");
+        UESYNTH_TEST_TRUE(Image.image_data().empty(), "An unchanged frame should carry no pixels");
+    }
+
+    // Test forced keyframes, resized images and frames where everything changed go whole
+    {
+        UESYNTH_TEST_TRUE(Delta.BeginFrame(4, true), "A forced frame should be a keyframe");
+        uesynth::ImageResponse Image = MakeImage();
+        UESYNTH_TEST_FALSE(Delta.Encode(0, &Image), "A forced keyframe should stay whole");
+
+        Delta.BeginFrame(5, false);
+        Image = MakeImage();
+        Image.set_width(Width / 2);
+        Image.set_height(Height * 2);
+        UESYNTH_TEST_FALSE(Delta.Encode(0, &Image), "A resized image should stay whole");
+
+        Delta.BeginFrame(6, false);
+        Image = MakeImage();
+        Image.set_width(Width / 2);
+        Image.set_height(Height * 2);
+        Image.mutable_image_data()->assign(Pixels.size(), char(99));
+        UESYNTH_TEST_FALSE(Delta.Encode(0, &Image), "A wholly changed image should stay whole");
+        UESYNTH_TEST_EQUAL(Image.image_data().size(), Pixels.size(), "It should carry every pixel");
+    }
+
+    // Test keyframes come around again after the interval
+    {
+        FUESynthTileDelta Periodic(16, 3);
+        UESYNTH_TEST_TRUE(Periodic.BeginFrame(1, false), "Frame 1 should be a keyframe");
+        UESYNTH_TEST_FALSE(Periodic.BeginFrame(2, false), "Frame 2 should be a delta");
+        UESYNTH_TEST_FALSE(Periodic.BeginFrame(3, false), "Frame 3 should be a delta");
+        UESYNTH_TEST_TRUE(Periodic.BeginFrame(4, false), "Frame 4 should be a keyframe");
+    }
+
+    return true;
+}
+
+// Test a region of the view scaled on the GPU comes back at exactly the requested size
+class FUESynthImageCaptureRegionTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthImageCaptureRegionTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureRegionTest,
+    "UESynth.Unit.ImageCapture.Region",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // A 448 pixel square scaled to a model's 224x224 input
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        Request.mutable_roi()->set_x(100);
+        Request.mutable_roi()->set_y(50);
+        Request.mutable_roi()->set_width(448);
+        Request.mutable_roi()->set_height(448);
+        Request.set_output_width(224);
+        Request.set_output_height(224);
+
+        grpc::Status Status = ServiceImpl->CaptureRgbImage(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("Scaled region capture"));
+        UESYNTH_TEST_EQUAL(Response.width(), 224, "Width should be the output width");
+        UESYNTH_TEST_EQUAL(Response.height(), 224, "Height should be the output height");
+        UESYNTH_TEST_EQUAL(Response.image_data().size(), size_t(224 * 224 * 4), "Only the scaled pixels should be sent");
+    }
+
+    // One side alone keeps the region's aspect ratio
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        Request.mutable_roi()->set_width(800);
+        Request.mutable_roi()->set_height(400);
+        Request.set_output_width(512);
+
+        grpc::Status Status = ServiceImpl->CaptureRgbImage(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("Aspect-preserving scale"));
+        UESYNTH_TEST_EQUAL(Response.width(), 512, "Width should be the output width");
+        UESYNTH_TEST_EQUAL(Response.height(), 256, "Height should follow the region's aspect ratio");
+    }
+
+    // Every modality of a multi capture is scaled to the same size
+    {
+        uesynth::CaptureMultiRequest Request;
+        uesynth::MultiImageResponse Response;
+        Request.set_modalities(uesynth::CAPTURE_MODALITY_RGB | uesynth::CAPTURE_MODALITY_DEPTH);
+        Request.mutable_roi()->set_width(1024);
+        Request.mutable_roi()->set_height(1024);
+        Request.set_output_width(512);
+        Request.set_output_height(512);
+
+        grpc::Status Status = ServiceImpl->CaptureMulti(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("Scaled multi capture"));
+        UESYNTH_TEST_EQUAL(Response.rgb().width(), 512, "RGB should be at the output size");
+        UESYNTH_TEST_EQUAL(Response.depth().width(), 512, "Depth should be at the output size too");
+        UESYNTH_TEST_EQUAL(Response.depth().height(), 512, "Depth should line up with RGB");
+    }
+
+    // Regions outside the view and oversized outputs are rejected
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        Request.mutable_roi()->set_x(100000);
+
+        grpc::Status Status = ServiceImpl->CaptureRgbImage(
+            MockContext->GetServerContext(), &Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "A roi outside the view should be rejected");
+
+        Request.clear_roi();
+        Request.set_output_width(100000);
+        Status = ServiceImpl->CaptureRgbImage(MockContext->GetServerContext(), &Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "An oversized output should be rejected");
+    }
+
+    return true;
+}
+
+// Test game-view captures of a headless server render through the headless view camera
+class FUESynthImageCaptureHeadlessTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthImageCaptureHeadlessTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthImageCaptureHeadlessTest,
+    "UESynth.Unit.ImageCapture.Headless",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    FUESynthSceneContext& Scene = FUESynthSceneContext::Get();
+    if (!Scene.GetWorld())
+    {
+        AddInfo(TEXT("No world to capture; skipping headless captures"));
+        return true;
+    }
+
+    const FName HeadlessView(FUESynthCameraPool::HeadlessViewName);
+    Scene.SetHeadless(true);
+    // Failed checks return early; the next test still gets its viewport and no stray camera
+    ON_SCOPE_EXIT
+    {
+        Scene.SetHeadless(false);
+        Scene.GetCameras().DestroyCamera(HeadlessView);
+    };
+    UESYNTH_TEST_TRUE(Scene.GetViewportClient() == nullptr, "A headless server should have no viewport to capture");
+
+    // The game view comes from the headless view camera, at its size
+    {
+        uesynth::CaptureMultiRequest Request;
+        uesynth::MultiImageResponse Response;
+        Request.set_modalities(uesynth::CAPTURE_MODALITY_RGB | uesynth::CAPTURE_MODALITY_SEGMENTATION);
+
+        grpc::Status Status = ServiceImpl->CaptureMulti(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        const FIntPoint Size = Scene.GetCameras().GetResolution(HeadlessView);
+        AssertGrpcStatusOk(Status, TEXT("Headless capture"));
+        UESYNTH_TEST_TRUE(Scene.GetCameras().Contains(HeadlessView), "The headless view camera should have been created");
+        UESYNTH_TEST_EQUAL(Response.modalities(), uint32(uesynth::CAPTURE_MODALITY_RGB), "Only what a camera renders should be captured");
+        UESYNTH_TEST_EQUAL(Response.rgb().width(), Size.X, "The capture should be at the headless view's size");
+        UESYNTH_TEST_EQUAL(Response.rgb().height(), Size.Y, "The capture should be at the headless view's size");
+    }
+
+    // So is the game view of a single-modality capture
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        grpc::Status Status = ServiceImpl->CaptureDepthMap(
+            MockContext->GetServerContext(), &Request, &Response);
+        AssertGrpcStatusOk(Status, TEXT("Headless depth capture"));
+    }
+
     return true;
 }
\ No newline at end of file
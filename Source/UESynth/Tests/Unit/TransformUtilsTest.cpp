@@ -3,6 +3,7 @@
 
 #include "../UESynthTestBase.h"
 #include "pb/uesynth.grpc.pb.h"
+#include "UESynthTransformUtils.h"
 
 /**
  * Unit tests for transform utility functions
@@ -209,4 +210,70 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthTransformEdgeCasesTest,
     }
 
     return true;
-}
\ No newline at end of file
+}
+
+// Test the packed 9-float format used by the batched transform RPCs
+class FUESynthPackedTransformTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthPackedTransformTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthPackedTransformTest,
+    "UESynth.Unit.TransformUtils.Packed",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test wire layout: location, rotation (pitch, yaw, roll), scale
+    {
+        const FTransform Transform(FRotator(10.0f, 20.0f, 30.0f), FVector(1.0f, 2.0f, 3.0f),
+            FVector(0.5f, 1.5f, 2.5f));
+
+        uint8 Buffer[UESynthTransform::PackedBytes];
+        UESynthTransform::PackTransform(Transform, Buffer);
+
+        float Floats[UESynthTransform::PackedFloats];
+        FMemory::Memcpy(Floats, Buffer, sizeof(Floats));
+        UESYNTH_TEST_TRUE(FMath::IsNearlyEqual(Floats[0], 1.0f, 0.001f), "Location X first");
+        UESYNTH_TEST_TRUE(FMath::IsNearlyEqual(Floats[2], 3.0f, 0.001f), "Location Z third");
+        UESYNTH_TEST_TRUE(FMath::IsNearlyEqual(Floats[3], 10.0f, 0.01f), "Pitch fourth");
+        UESYNTH_TEST_TRUE(FMath::IsNearlyEqual(Floats[4], 20.0f, 0.01f), "Yaw fifth");
+        UESYNTH_TEST_TRUE(FMath::IsNearlyEqual(Floats[5], 30.0f, 0.01f), "Roll sixth");
+        UESYNTH_TEST_TRUE(FMath::IsNearlyEqual(Floats[8], 2.5f, 0.001f), "Scale Z last");
+    }
+
+    // Test round trip through an unaligned buffer, as protobuf bytes fields may be
+    {
+        const FTransform Transform(FRotator(-45.0f, 90.0f, 0.0f), FVector(-100.0f, 250.0f, 75.0f),
+            FVector(2.0f, 2.0f, 2.0f));
+
+        uint8 Buffer[UESynthTransform::PackedBytes + 1];
+        UESynthTransform::PackTransform(Transform, Buffer + 1);
+        const FTransform RoundTrip = UESynthTransform::UnpackTransform(Buffer + 1);
+
+        UESYNTH_TEST_TRUE(RoundTrip.GetLocation().Equals(Transform.GetLocation(), 0.001f),
+            "Location should survive packing");
+        UESYNTH_TEST_TRUE(RoundTrip.Rotator().Equals(Transform.Rotator(), 0.01f),
+            "Rotation should survive packing");
+        UESYNTH_TEST_TRUE(RoundTrip.GetScale3D().Equals(Transform.GetScale3D(), 0.001f),
+            "Scale should survive packing");
+    }
+
+    // Test that an unset wire scale reads as unit scale
+    {
+        uesynth::Transform ProtoTransform;
+        ProtoTransform.mutable_location()->set_x(5.0f);
+
+        const FTransform Transform = UESynthTransform::ToTransform(ProtoTransform);
+        UESYNTH_TEST_TRUE(Transform.GetScale3D().Equals(FVector::OneVector),
+            "Missing scale should mean unit scale");
+    }
+
+    return true;
+}
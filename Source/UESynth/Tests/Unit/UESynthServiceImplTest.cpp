@@ -2,7 +2,32 @@
 // SPDX-License-Identifier: MIT
 
 #include "../UESynthTestBase.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
 #include "pb/uesynth.grpc.pb.h"
+#include "UESynthActorPool.h"
+#include "UESynthAssetCache.h"
+#include "UESynthCancellation.h"
+#include "UESynthCommandQueue.h"
+#include "UESynthFrameCapture.h"
+#include "UESynthHealth.h"
+#include "UESynthImageEncoder.h"
+#include "UESynthLightRegistry.h"
+#include "UESynthLockstep.h"
+#include "UESynthMaterialCache.h"
+#include "UESynthMessageArena.h"
+#include "UESynthRecordings.h"
+#include "UESynthRegistration.h"
+#include "UESynthSceneContext.h"
+#include "UESynthServerSettings.h"
+#include "UESynthServerStats.h"
+#include "UESynthSessions.h"
+#include "UESynthSharedMemory.h"
+#include "UESynthSubscriptions.h"
+#include "UESynthWriteQueue.h"
 
 /**
  * Unit tests for UESynthServiceImpl class methods
@@ -232,6 +257,41 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceProcessActionTest,
 
         UESYNTH_TEST_EQUAL(Request.action_case(), uesynth::ActionRequest::ACTION_NOT_SET, 
             "Empty request should have ACTION_NOT_SET");
+
+        // Actions that don't wait on a readback complete before the call returns
+        uesynth::FrameResponse Response;
+        int32 NumCompletions = 0;
+        grpc::StatusCode Code = grpc::StatusCode::OK;
+        ServiceImpl->ProcessActionOnGameThread(Request, &Response,
+            [&NumCompletions, &Code](const grpc::Status& Status)
+            {
+                ++NumCompletions;
+                Code = Status.error_code();
+            });
+        UESYNTH_TEST_EQUAL(NumCompletions, 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::UNIMPLEMENTED, "Empty action should be unimplemented");
+        UESYNTH_TEST_EQUAL(Response.request_id(), "unknown-789", "Request ID should be echoed");
+    }
+
+    // Test CaptureMulti action without modalities
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("multi-000");
+        Request.mutable_capture_multi()->set_modalities(0);
+
+        // Rejected before anything is read back, so this also completes inline
+        uesynth::FrameResponse Response;
+        int32 NumCompletions = 0;
+        grpc::StatusCode Code = grpc::StatusCode::OK;
+        ServiceImpl->ProcessActionOnGameThread(Request, &Response,
+            [&NumCompletions, &Code](const grpc::Status& Status)
+            {
+                ++NumCompletions;
+                Code = Status.error_code();
+            });
+        UESYNTH_TEST_EQUAL(NumCompletions, 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::INVALID_ARGUMENT, "Empty modality mask should be rejected");
+        UESYNTH_TEST_EQUAL(Response.multi_image_response().modalities(), 0u, "No modality should be reported");
     }
 
     return true;
@@ -257,7 +317,7 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceListObjectsTest,
 {
     // Test listing objects
     {
-        google::protobuf::Empty Request;
+        uesynth::ListObjectsRequest Request;
         uesynth::ListObjectsResponse Response;
 
         grpc::Status Status = ServiceImpl->ListObjects(
@@ -266,13 +326,148 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceListObjectsTest,
         AssertGrpcStatusOk(Status, TEXT("ListObjects"));
         UESYNTH_TEST_TRUE(Response.object_names_size() >= 0, "Should have object names array");
         
-        // Current implementation returns dummy objects
+        // Names come from the actor registry of whatever world is loaded
         if (Response.object_names_size() > 0)
         {
             UESYNTH_TEST_TRUE(Response.object_names(0).length() > 0, "Object names should not be empty");
         }
     }
 
+    // Test class filter that matches nothing
+    {
+        uesynth::ListObjectsRequest Request;
+        uesynth::ListObjectsResponse Response;
+        Request.set_class_name("NoSuchActorClass_UESynthTest");
+
+        grpc::Status Status = ServiceImpl->ListObjects(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("ListObjects with unknown class"));
+        UESYNTH_TEST_EQUAL(Response.object_names_size(), 0, "Unknown class should match no objects");
+    }
+
+    // Test tag filter that matches nothing
+    {
+        uesynth::ListObjectsRequest Request;
+        uesynth::ListObjectsResponse Response;
+        Request.set_tag("NoSuchTag_UESynthTest");
+
+        grpc::Status Status = ServiceImpl->ListObjects(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("ListObjects with unknown tag"));
+        UESYNTH_TEST_EQUAL(Response.object_names_size(), 0, "Unknown tag should match no objects");
+    }
+
+    return true;
+}
+
+// Test scene snapshots, full and as diffs
+class FUESynthServiceSceneSnapshotTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceSceneSnapshotTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceSceneSnapshotTest,
+    "UESynth.Unit.ServiceImpl.SceneSnapshot",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test a first snapshot lists every object with its transform planes
+    uint64 Sequence = 0;
+    {
+        uesynth::GetSceneSnapshotRequest Request;
+        uesynth::SceneSnapshot Snapshot;
+
+        grpc::Status Status = ServiceImpl->GetSceneSnapshot(
+            MockContext->GetServerContext(), &Request, &Snapshot);
+
+        AssertGrpcStatusOk(Status, TEXT("GetSceneSnapshot"));
+        UESYNTH_TEST_TRUE(Snapshot.full(), "A first snapshot should be full");
+        UESYNTH_TEST_EQUAL(Snapshot.num_fields(), 9u, "Transforms alone should be nine planes");
+        UESYNTH_TEST_TRUE(Snapshot.object_ids_size() <= FUESynthSceneContext::Get().GetActors().Num(), "Only registered objects should be listed");
+        UESYNTH_TEST_EQUAL(Snapshot.packed_state().size(), size_t(Snapshot.object_ids_size()) * 9 * sizeof(float), "Every plane should hold a value per object");
+        UESYNTH_TEST_EQUAL(Snapshot.object_names_size(), 0, "Names should only be sent when asked for");
+        UESYNTH_TEST_EQUAL(Snapshot.removed_ids_size(), 0, "A full snapshot should have no removals");
+        Sequence = Snapshot.sequence();
+    }
+
+    // Test velocities, visibility and names are added when asked for
+    {
+        uesynth::GetSceneSnapshotRequest Request;
+        Request.set_include_velocities(true);
+        Request.set_include_visibility(true);
+        Request.set_include_names(true);
+        uesynth::SceneSnapshot Snapshot;
+
+        grpc::Status Status = ServiceImpl->GetSceneSnapshot(
+            MockContext->GetServerContext(), &Request, &Snapshot);
+
+        AssertGrpcStatusOk(Status, TEXT("GetSceneSnapshot with every field"));
+        UESYNTH_TEST_EQUAL(Snapshot.num_fields(), 13u, "Velocity and visibility should add four planes");
+        UESYNTH_TEST_EQUAL(Snapshot.packed_state().size(), size_t(Snapshot.object_ids_size()) * 13 * sizeof(float), "Every plane should hold a value per object");
+        UESYNTH_TEST_EQUAL(Snapshot.object_names_size(), Snapshot.object_ids_size(), "Names should be parallel to the IDs");
+        UESYNTH_TEST_TRUE(Snapshot.sequence() >= Sequence, "The sequence should never go back");
+        Sequence = Snapshot.sequence();
+    }
+
+    // Test a snapshot since one the client holds is a diff, and since an unknown one is full
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("snapshot-000");
+        Request.mutable_get_scene_snapshot()->set_since_sequence(Sequence);
+
+        uesynth::FrameResponse Response;
+        grpc::Status Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.ok(), "A streamed snapshot should succeed");
+        UESYNTH_TEST_TRUE(Response.has_scene_snapshot(), "It should be answered with scene_snapshot");
+        UESYNTH_TEST_FALSE(Response.scene_snapshot().full(), "A snapshot since a known sequence should be a diff");
+        UESYNTH_TEST_TRUE(Response.scene_snapshot().object_ids_size() <= FUESynthSceneContext::Get().GetActors().Num(), "A diff should list at most every object");
+
+        Request.mutable_get_scene_snapshot()->set_since_sequence(Response.scene_snapshot().sequence() + 1000);
+        Response.Clear();
+        Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.ok() && Response.scene_snapshot().full(), "A sequence the server never had should get a full snapshot");
+    }
+
+    // Test an unknown class filter matches nothing
+    {
+        uesynth::GetSceneSnapshotRequest Request;
+        Request.set_class_name("NoSuchActorClass_UESynthTest");
+        uesynth::SceneSnapshot Snapshot;
+
+        grpc::Status Status = ServiceImpl->GetSceneSnapshot(
+            MockContext->GetServerContext(), &Request, &Snapshot);
+
+        AssertGrpcStatusOk(Status, TEXT("GetSceneSnapshot with unknown class"));
+        UESYNTH_TEST_EQUAL(Snapshot.object_ids_size(), 0, "Unknown class should match no objects");
+        UESYNTH_TEST_TRUE(Snapshot.packed_state().empty(), "Nothing should be packed");
+    }
+
+    // Test resetting the registry ends the diffs against what came before
+    {
+        FUESynthActorRegistry Actors;
+        const uint64 Before = Actors.GetChangeSequence();
+        UESYNTH_TEST_TRUE(Actors.CanDiffSince(Before), "The current sequence should be diffable");
+        UESYNTH_TEST_FALSE(Actors.CanDiffSince(Before + 1), "A sequence not reached yet should not be");
+
+        Actors.Reset();
+        UESYNTH_TEST_TRUE(Actors.GetChangeSequence() > Before, "A reset should be a change");
+        UESYNTH_TEST_FALSE(Actors.CanDiffSince(Before), "IDs start over, so nothing from before should be diffable");
+        UESYNTH_TEST_TRUE(Actors.CanDiffSince(Actors.GetChangeSequence()), "The sequence after the reset should be");
+
+        TArray<uint32> Removed;
+        Actors.GetRemovedSince(Before, Removed);
+        UESYNTH_TEST_EQUAL(Removed.Num(), 0, "Nothing was removed");
+    }
+
     return true;
 }
 
@@ -309,32 +504,1606 @@ IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServicePlaceholderMethodsTest,
         UESYNTH_TEST_EQUAL(Response.height(), 100, "Height should match request");
     }
 
-    // Test SetObjectTransform
+    // Test SetObjectTransform on an unknown object
     {
         uesynth::SetObjectTransformRequest Request;
         uesynth::CommandResponse Response;
-        Request.set_object_name("TestObject");
+        Request.set_object_name("NoSuchObject_UESynthTest");
 
         grpc::Status Status = ServiceImpl->SetObjectTransform(
             MockContext->GetServerContext(), &Request, &Response);
 
         AssertGrpcStatusOk(Status, TEXT("SetObjectTransform"));
-        UESYNTH_TEST_TRUE(Response.success(), "Placeholder should return success");
+        UESYNTH_TEST_FALSE(Response.success(), "Unknown object should not be moved");
         UESYNTH_TEST_TRUE(Response.message().length() > 0, "Should have message");
     }
 
-    // Test CreateCamera
+    // Test DestroyObject on an unknown object
+    {
+        uesynth::DestroyObjectRequest Request;
+        uesynth::CommandResponse Response;
+        Request.set_object_name("NoSuchObject_UESynthTest");
+
+        grpc::Status Status = ServiceImpl->DestroyObject(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("DestroyObject"));
+        UESYNTH_TEST_FALSE(Response.success(), "Unknown object should not be destroyed");
+    }
+
+    return true;
+}
+
+// Test the pooled camera lifecycle and captures through a named camera
+class FUESynthServiceCameraPoolTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceCameraPoolTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceCameraPoolTest,
+    "UESynth.Unit.ServiceImpl.CameraPool",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test CreateCamera at an explicit resolution
     {
         uesynth::CreateCameraRequest Request;
         uesynth::CommandResponse Response;
-        Request.set_camera_name("TestCamera");
+        Request.set_camera_name("UESynthTestPoolCamera");
+        Request.set_width(64);
+        Request.set_height(48);
 
         grpc::Status Status = ServiceImpl->CreateCamera(
             MockContext->GetServerContext(), &Request, &Response);
 
         AssertGrpcStatusOk(Status, TEXT("CreateCamera"));
-        UESYNTH_TEST_TRUE(Response.success(), "Placeholder should return success");
+        UESYNTH_TEST_TRUE(Response.success(), "Camera should be created");
+
+        // A second camera of the same name is refused
+        Status = ServiceImpl->CreateCamera(
+            MockContext->GetServerContext(), &Request, &Response);
+        AssertGrpcStatusOk(Status, TEXT("CreateCamera duplicate"));
+        UESYNTH_TEST_FALSE(Response.success(), "Duplicate camera name should fail");
+    }
+
+    // Test RGB and depth captures come from the camera at its resolution
+    {
+        uesynth::CaptureRequest Request;
+        uesynth::ImageResponse Response;
+        Request.set_camera_name("UESynthTestPoolCamera");
+
+        grpc::Status Status = ServiceImpl->CaptureRgbImage(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("CaptureRgbImage from camera"));
+        UESYNTH_TEST_EQUAL(Response.width(), 64, "Camera capture width should match camera");
+        UESYNTH_TEST_EQUAL(Response.height(), 48, "Camera capture height should match camera");
+
+        uesynth::ImageResponse DepthResponse;
+        Status = ServiceImpl->CaptureDepthMap(
+            MockContext->GetServerContext(), &Request, &DepthResponse);
+
+        AssertGrpcStatusOk(Status, TEXT("CaptureDepthMap from camera"));
+        UESYNTH_TEST_TRUE(DepthResponse.format() == "depth_f32", "Camera depth should be float32");
+        UESYNTH_TEST_EQUAL(DepthResponse.image_data().size(), size_t(64 * 48 * 4), "Camera depth size should match camera");
+    }
+
+    // Test SetResolution resizes the camera's captures
+    {
+        uesynth::SetResolutionRequest Request;
+        uesynth::CommandResponse Response;
+        Request.set_camera_name("UESynthTestPoolCamera");
+        Request.set_width(32);
+        Request.set_height(32);
+
+        grpc::Status Status = ServiceImpl->SetResolution(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("SetResolution"));
+        UESYNTH_TEST_TRUE(Response.success(), "Resolution should be set");
+
+        uesynth::CaptureRequest CaptureRequest;
+        uesynth::ImageResponse CaptureResponse;
+        CaptureRequest.set_camera_name("UESynthTestPoolCamera");
+        Status = ServiceImpl->CaptureRgbImage(
+            MockContext->GetServerContext(), &CaptureRequest, &CaptureResponse);
+
+        AssertGrpcStatusOk(Status, TEXT("CaptureRgbImage after SetResolution"));
+        UESYNTH_TEST_EQUAL(CaptureResponse.width(), 32, "Capture width should follow SetResolution");
+    }
+
+    // Test capture_cameras answers once per camera, each at its own resolution
+    {
+        uesynth::CreateCameraRequest CreateRequest;
+        uesynth::CommandResponse CreateResponse;
+        CreateRequest.set_camera_name("UESynthTestPoolCamera2");
+        CreateRequest.set_width(16);
+        CreateRequest.set_height(8);
+        grpc::Status Status = ServiceImpl->CreateCamera(
+            MockContext->GetServerContext(), &CreateRequest, &CreateResponse);
+        AssertGrpcStatusOk(Status, TEXT("CreateCamera second camera"));
+
+        uesynth::ActionRequest Request;
+        Request.set_request_id("capture-cameras");
+        uesynth::CaptureCamerasRequest* Cameras = Request.mutable_capture_cameras();
+        Cameras->add_camera_names("UESynthTestPoolCamera");
+        Cameras->add_camera_names("UESynthTestPoolCamera2");
+        Cameras->set_modalities(uesynth::CAPTURE_MODALITY_RGB | uesynth::CAPTURE_MODALITY_DEPTH);
+
+        TArray<uesynth::FrameResponse> Responses;
+        Status = ServiceImpl->ProcessStreamedAction(Request, &Responses);
+
+        AssertGrpcStatusOk(Status, TEXT("ProcessStreamedAction capture_cameras"));
+        UESYNTH_TEST_EQUAL(Responses.Num(), 2, "Each camera should answer once");
+        for (const uesynth::FrameResponse& Response : Responses)
+        {
+            const uesynth::MultiImageResponse& Images = Response.multi_image_response();
+            const bool bFirst = Images.camera_name() == "UESynthTestPoolCamera";
+            UESYNTH_TEST_TRUE(Response.request_id() == "capture-cameras", "Responses should share the request_id");
+            UESYNTH_TEST_EQUAL(Images.modalities(), uint32(uesynth::CAPTURE_MODALITY_RGB | uesynth::CAPTURE_MODALITY_DEPTH), "Both modalities should be captured");
+            UESYNTH_TEST_EQUAL(Images.rgb().width(), bFirst ? 32u : 16u, "RGB width should match its camera");
+            UESYNTH_TEST_EQUAL(Images.depth().height(), bFirst ? 32u : 8u, "Depth height should match its camera");
+        }
+
+        // One unknown camera fails the whole batch before anything renders
+        Cameras->add_camera_names("UESynthTestMissingCamera");
+        Responses.Reset();
+        Status = ServiceImpl->ProcessStreamedAction(Request, &Responses);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::NOT_FOUND, "Unknown camera should be NOT_FOUND");
+        UESYNTH_TEST_EQUAL(Responses.Num(), 0, "A rejected batch should not answer");
+
+        // The single-response path refuses streamed actions
+        uesynth::FrameResponse Single;
+        Status = ServiceImpl->ProcessAction(Request, &Single);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "ProcessAction should refuse capture_cameras");
+
+        uesynth::DestroyCameraRequest DestroyRequest;
+        DestroyRequest.set_camera_name("UESynthTestPoolCamera2");
+        Status = ServiceImpl->DestroyCamera(
+            MockContext->GetServerContext(), &DestroyRequest, &CreateResponse);
+        AssertGrpcStatusOk(Status, TEXT("DestroyCamera second camera"));
+    }
+
+    // Test DestroyCamera, after which the name is unknown to captures
+    {
+        uesynth::DestroyCameraRequest Request;
+        uesynth::CommandResponse Response;
+        Request.set_camera_name("UESynthTestPoolCamera");
+
+        grpc::Status Status = ServiceImpl->DestroyCamera(
+            MockContext->GetServerContext(), &Request, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("DestroyCamera"));
+        UESYNTH_TEST_TRUE(Response.success(), "Camera should be destroyed");
+
+        Status = ServiceImpl->DestroyCamera(
+            MockContext->GetServerContext(), &Request, &Response);
+        AssertGrpcStatusOk(Status, TEXT("DestroyCamera twice"));
+        UESYNTH_TEST_FALSE(Response.success(), "Destroyed camera should not be found");
+
+        uesynth::CaptureRequest CaptureRequest;
+        uesynth::ImageResponse CaptureResponse;
+        CaptureRequest.set_camera_name("UESynthTestPoolCamera");
+        Status = ServiceImpl->CaptureRgbImage(
+            MockContext->GetServerContext(), &CaptureRequest, &CaptureResponse);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::NOT_FOUND, "Capture from unknown camera should be NOT_FOUND");
+    }
+
+    return true;
+}
+
+// Collects pushed frames in place of a ControlStream call
+class FUESynthTestFrameSink final : public IUESynthFrameSink
+{
+public:
+    virtual int32 GetNumQueued() const override
+    {
+        return NumQueued;
+    }
+
+    virtual bool Push(uesynth::FrameResponse&& Response) override
+    {
+        FScopeLock Lock(&FramesLock);
+        Frames.Add(MoveTemp(Response));
+        return true;
+    }
+
+    virtual FUESynthWriteQueueStats GetWriteQueueStats() const override
+    {
+        FUESynthWriteQueueStats Stats;
+        Stats.Policy = EUESynthWritePolicy::DropOldest;
+        Stats.Depth = NumQueued;
+        Stats.Capacity = 4;
+        return Stats;
+    }
+
+    int32 NumQueued = 0;
+    FCriticalSection FramesLock;
+    TArray<uesynth::FrameResponse> Frames;
+};
+
+// Test subscriptions push frames on their own and skip them while the client is behind
+class FUESynthServiceSubscriptionTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceSubscriptionTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceSubscriptionTest,
+    "UESynth.Unit.ServiceImpl.Subscription",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    FUESynthTestFrameSink Sink;
+    TSharedRef<FUESynthStreamLink> Link = MakeShared<FUESynthStreamLink>(&Sink);
+    FUESynthSubscriptions& Subscriptions = FUESynthSubscriptions::Get();
+
+    // Runs one due tick, rate_hz being high enough for every tick to be due
+    auto TickSubscriptions = [&Subscriptions]()
+    {
+        FPlatformProcess::Sleep(0.005f);
+        Subscriptions.Tick(0.0f);
+        if (FUESynthFrameCapture* FrameCapture = FUESynthFrameCapture::Get())
+        {
+            FrameCapture->Flush();
+        }
+    };
+
+    auto Process = [this, &Link](const uesynth::ActionRequest& Request, uesynth::FrameResponse* Response)
+    {
+        grpc::Status Result;
+        ServiceImpl->ProcessActionOnGameThread(
+            Request, Response, [&Result](const grpc::Status& Status) { Result = Status; }, Link);
+        return Result;
+    };
+
+    uesynth::ActionRequest Subscribe;
+    Subscribe.set_request_id("test-subscription");
+    Subscribe.mutable_subscribe()->mutable_capture()->set_modalities(uesynth::CAPTURE_MODALITY_RGB);
+    Subscribe.mutable_subscribe()->set_rate_hz(1000.0f);
+
+    // Test subscribing, after which frames arrive without further requests
+    {
+        uesynth::FrameResponse Response;
+        grpc::Status Status = Process(Subscribe, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("Subscribe"));
+        UESYNTH_TEST_TRUE(Response.command_response().success(), "Subscription should be created");
+
+        TickSubscriptions();
+        UESYNTH_TEST_EQUAL(Sink.Frames.Num(), 1, "A due tick should push one frame");
+        if (Sink.Frames.Num() == 1)
+        {
+            const uesynth::FrameResponse& Frame = Sink.Frames[0];
+            UESYNTH_TEST_TRUE(Frame.request_id() == "test-subscription", "Frames should carry the subscription's request_id");
+            UESYNTH_TEST_EQUAL(Frame.subscription_frame().sequence(), uint64(1), "First frame should be sequence 1");
+            UESYNTH_TEST_EQUAL(Frame.subscription_frame().images().modalities(), uint32(uesynth::CAPTURE_MODALITY_RGB), "Frame should hold rgb");
+        }
+
+        // A second subscription with the same ID on the same stream is refused
+        Status = Process(Subscribe, &Response);
+        AssertGrpcStatusOk(Status, TEXT("Subscribe duplicate"));
+        UESYNTH_TEST_FALSE(Response.command_response().success(), "Duplicate subscription should fail");
+    }
+
+    // Test frames are skipped while the client is behind, and counted
+    {
+        Sink.NumQueued = 1;
+        TickSubscriptions();
+        UESYNTH_TEST_EQUAL(Sink.Frames.Num(), 1, "No frame should be taken while the stream is backed up");
+
+        Sink.NumQueued = 0;
+        TickSubscriptions();
+        UESYNTH_TEST_EQUAL(Sink.Frames.Num(), 2, "Frames should resume once the stream drains");
+        if (Sink.Frames.Num() == 2)
+        {
+            UESYNTH_TEST_EQUAL(Sink.Frames[1].subscription_frame().dropped_frames(), uint64(1), "The skipped frame should be counted");
+        }
+    }
+
+    // Test unsubscribing stops the frames
+    {
+        uesynth::ActionRequest Unsubscribe;
+        Unsubscribe.mutable_unsubscribe()->set_subscription_id("test-subscription");
+        uesynth::FrameResponse Response;
+        grpc::Status Status = Process(Unsubscribe, &Response);
+
+        AssertGrpcStatusOk(Status, TEXT("Unsubscribe"));
+        UESYNTH_TEST_TRUE(Response.command_response().success(), "Subscription should be cancelled");
+
+        TickSubscriptions();
+        UESYNTH_TEST_EQUAL(Sink.Frames.Num(), 2, "A cancelled subscription should push nothing");
+
+        Status = Process(Unsubscribe, &Response);
+        AssertGrpcStatusOk(Status, TEXT("Unsubscribe twice"));
+        UESYNTH_TEST_FALSE(Response.command_response().success(), "Cancelled subscription should not be found");
+    }
+
+    // Test subscriptions need a stream to push to
+    {
+        uesynth::FrameResponse Response;
+        grpc::Status Status = ServiceImpl->ProcessAction(Subscribe, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::FAILED_PRECONDITION, "Unary subscribe should be FAILED_PRECONDITION");
+    }
+
+    Link->Detach();
+    return true;
+}
+
+// Test the outbound queue drops stale frames but never command responses
+class FUESynthServiceWriteQueueTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceWriteQueueTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceWriteQueueTest,
+    "UESynth.Unit.ServiceImpl.WriteQueue",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    auto MakeFrame = [](const char* RequestId)
+    {
+        uesynth::FrameResponse Response;
+        Response.set_request_id(RequestId);
+        Response.mutable_subscription_frame()->set_sequence(1);
+        return Response;
+    };
+    auto MakeCapture = [](const char* RequestId)
+    {
+        uesynth::FrameResponse Response;
+        Response.set_request_id(RequestId);
+        Response.mutable_image_response()->set_width(1);
+        return Response;
+    };
+    auto MakeCommand = [](const char* RequestId)
+    {
+        uesynth::FrameResponse Response;
+        Response.set_request_id(RequestId);
+        Response.mutable_command_response()->set_success(true);
+        return Response;
+    };
+
+    // Test drop-oldest makes room by discarding the oldest frame, never a command response
+    {
+        FUESynthWriteQueue Queue(2, EUESynthWritePolicy::DropOldest);
+        UESYNTH_TEST_EQUAL(Queue.Push(MakeFrame("frame-1")), 0, "A queue with room should keep the frame");
+        UESYNTH_TEST_EQUAL(Queue.Push(MakeCommand("command-1")), 0, "A queue with room should keep the command");
+        UESYNTH_TEST_EQUAL(Queue.Push(MakeFrame("frame-2")), 1, "A full queue should drop one frame");
+        UESYNTH_TEST_EQUAL(Queue.Push(MakeCommand("command-2")), 0, "Commands should never be dropped");
+        UESYNTH_TEST_FALSE(Queue.ShouldThrottleReads(), "Drop policies should not throttle reads");
+
+        const FUESynthWriteQueueStats Stats = Queue.GetStats();
+        UESYNTH_TEST_EQUAL(Stats.Depth, 3, "Commands may go past the capacity");
+        UESYNTH_TEST_EQUAL(Stats.PeakDepth, 3, "Peak depth should be tracked");
+        UESYNTH_TEST_EQUAL(Stats.Dropped, uint64(1), "Drops should be counted");
+
+        FUESynthQueuedResponse Response;
+        TArray<std::string> Order;
+        while (Queue.Pop(&Response))
+        {
+            Order.Add(Response.Get().request_id());
+        }
+        UESYNTH_TEST_EQUAL(Order.Num(), 3, "Three responses should be left");
+        if (Order.Num() == 3)
+        {
+            UESYNTH_TEST_TRUE(Order[0] == "command-1" && Order[1] == "frame-2" && Order[2] == "command-2",
+                "The oldest frame should be the one dropped, the rest kept in order");
+        }
+    }
+
+    // Test drop-newest discards the frame that does not fit
+    {
+        FUESynthWriteQueue Queue(1, EUESynthWritePolicy::DropNewest);
+        Queue.Push(MakeFrame("frame-1"));
+        UESYNTH_TEST_EQUAL(Queue.Push(MakeFrame("frame-2")), 1, "The new frame should be dropped");
+
+        FUESynthQueuedResponse Response;
+        UESYNTH_TEST_TRUE(Queue.Pop(&Response) && Response.Get().request_id() == "frame-1", "The queued frame should be kept");
+        UESYNTH_TEST_TRUE(Queue.IsEmpty(), "Nothing else should be queued");
+    }
+
+    // Test a capture reply is never dropped, since the client is waiting on its request ID
+    {
+        FUESynthWriteQueue Queue(1, EUESynthWritePolicy::DropNewest);
+        Queue.Push(MakeCapture("capture-1"));
+        UESYNTH_TEST_EQUAL(Queue.Push(MakeCapture("capture-2")), 0, "Capture replies should not be dropped");
+        UESYNTH_TEST_EQUAL(Queue.Push(MakeFrame("frame-1")), 1, "Only the subscription frame should be dropped");
+        UESYNTH_TEST_EQUAL(Queue.GetStats().Depth, 2, "Both capture replies should be left");
+    }
+
+    // Test block keeps every response and asks the stream to stop reading instead
+    {
+        FUESynthWriteQueue Queue(1, EUESynthWritePolicy::Block);
+        Queue.Push(MakeFrame("frame-1"));
+        UESYNTH_TEST_EQUAL(Queue.Push(MakeFrame("frame-2")), 0, "Block should never drop");
+        UESYNTH_TEST_TRUE(Queue.ShouldThrottleReads(), "A full blocking queue should throttle reads");
+        UESYNTH_TEST_EQUAL(Queue.Reset(), 2, "Reset should discard both frames");
+        UESYNTH_TEST_FALSE(Queue.ShouldThrottleReads(), "An empty queue should not throttle reads");
+    }
+
+    // Test responses built on an arena are queued as they are, and the arena is handed out again
+    {
+        FUESynthWriteQueue Queue(2, EUESynthWritePolicy::Block);
+        FUESynthMessageArena Arena = FUESynthMessageArena::Acquire();
+        const google::protobuf::Arena* Pooled = Arena.Get();
+        uesynth::FrameResponse* OnArena = Arena.Create<uesynth::FrameResponse>();
+        OnArena->set_request_id("on-arena");
+        OnArena->mutable_command_response()->set_success(true);
+        Queue.Push(FUESynthQueuedResponse(MoveTemp(Arena), OnArena));
+        UESYNTH_TEST_FALSE(Arena.IsValid(), "The queue should own the arena");
+
+        FUESynthQueuedResponse Response;
+        UESYNTH_TEST_TRUE(Queue.Pop(&Response) && &Response.Get() == OnArena, "The response should not be copied");
+        Response = FUESynthQueuedResponse();
+        const FUESynthMessageArena Reused = FUESynthMessageArena::Acquire();
+        UESYNTH_TEST_TRUE(Reused.Get() == Pooled, "A written response's arena should be reused");
+    }
+
+    // Test written payloads are recycled for the next image of their size
+    {
+        uesynth::FrameResponse Written = MakeCapture("capture-1");
+        std::string* Data = Written.mutable_image_response()->mutable_image_data();
+        UESynthImageBuffers::Acquire(4099, Data);
+        const char* Buffer = Data->data();
+        UESynthImageBuffers::Reclaim(&Written);
+        UESYNTH_TEST_TRUE(Written.image_response().image_data().empty(), "Reclaiming should take the payload");
+
+        std::string Next;
+        UESynthImageBuffers::Acquire(4099, &Next);
+        UESYNTH_TEST_TRUE(Next.data() == Buffer && Next.size() == 4099, "The next image of that size should get the buffer");
+        std::string Smaller;
+        UESynthImageBuffers::Acquire(100, &Smaller);
+        UESYNTH_TEST_EQUAL(int32(Smaller.size()), 100, "Other sizes should get a buffer of their own");
+    }
+
+    // Test the stream reports its queue, and unary calls have none
+    {
+        FUESynthTestFrameSink Sink;
+        Sink.NumQueued = 3;
+        TSharedRef<FUESynthStreamLink> Link = MakeShared<FUESynthStreamLink>(&Sink);
+
+        uesynth::ActionRequest Request;
+        Request.mutable_get_stream_stats();
+        uesynth::FrameResponse Response;
+        grpc::Status Result;
+        ServiceImpl->ProcessActionOnGameThread(
+            Request, &Response, [&Result](const grpc::Status& Status) { Result = Status; }, Link);
+
+        AssertGrpcStatusOk(Result, TEXT("GetStreamStats"));
+        UESYNTH_TEST_EQUAL(Response.stream_stats().queue_depth(), uint32(3), "Queue depth should come from the stream");
+        UESYNTH_TEST_EQUAL(Response.stream_stats().queue_capacity(), uint32(4), "Capacity should come from the stream");
+        UESYNTH_TEST_TRUE(Response.stream_stats().policy() == "drop_oldest", "Policy should be reported by name");
+
+        Link->Detach();
+        grpc::Status Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::FAILED_PRECONDITION, "Unary stream stats should be FAILED_PRECONDITION");
+    }
+
+    return true;
+}
+
+// Test images go through a stream's shared memory once the client has been told of it
+class FUESynthServiceSharedMemoryTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceSharedMemoryTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceSharedMemoryTest,
+    "UESynth.Unit.ServiceImpl.SharedMemory",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    constexpr uint64 SlotSize = 4096;
+    auto MakeImage = [](int32 Size, char Fill)
+    {
+        uesynth::FrameResponse Response;
+        Response.mutable_image_response()->set_image_data(std::string(Size, Fill));
+        return Response;
+    };
+
+    FUESynthTestFrameSink Sink;
+    TSharedRef<FUESynthStreamLink> Link = MakeShared<FUESynthStreamLink>(&Sink);
+    auto Open = [this, &Link](uint32 SlotCount, uesynth::FrameResponse* Response)
+    {
+        uesynth::ActionRequest Request;
+        Request.mutable_open_shared_memory()->set_slot_count(SlotCount);
+        Request.mutable_open_shared_memory()->set_slot_size(SlotSize);
+        grpc::Status Result;
+        ServiceImpl->ProcessActionOnGameThread(
+            Request, Response, [&Result](const grpc::Status& Status) { Result = Status; }, Link);
+        return Result;
+    };
+
+    // Test out-of-range rings are refused
+    {
+        uesynth::FrameResponse Response;
+        grpc::Status Status = Open(FUESynthSharedMemory::MaxSlotCount + 1, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "Too many slots should be INVALID_ARGUMENT");
+    }
+    {
+        uesynth::ActionRequest Request;
+        Request.mutable_open_shared_memory()->set_slot_count(FUESynthSharedMemory::MaxSlotCount);
+        Request.mutable_open_shared_memory()->set_slot_size(FUESynthSharedMemory::MaxSlotSize);
+        uesynth::FrameResponse Response;
+        grpc::Status Result;
+        ServiceImpl->ProcessActionOnGameThread(
+            Request, &Response, [&Result](const grpc::Status& Status) { Result = Status; }, Link);
+        UESYNTH_TEST_TRUE(Result.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "A ring over 1 GiB should be INVALID_ARGUMENT");
+        UESYNTH_TEST_FALSE(Link->GetSharedMemory().IsValid(), "No region should be mapped for it");
+    }
+
+    uesynth::FrameResponse Announcement;
+    AssertGrpcStatusOk(Open(2, &Announcement), TEXT("OpenSharedMemory"));
+    const uesynth::SharedMemoryInfo& Info = Announcement.shared_memory();
+    UESYNTH_TEST_TRUE(!Info.name().empty(), "The region should be named");
+    UESYNTH_TEST_EQUAL(Info.slot_count(), 2u, "The slot count should be kept");
+    UESYNTH_TEST_EQUAL(Info.header_size(), FUESynthSharedMemory::HeaderSize, "The header size should be sent");
+
+    const TSharedPtr<FUESynthSharedMemory> SharedMemory = Link->GetSharedMemory();
+    UESYNTH_TEST_TRUE(SharedMemory.IsValid(), "The stream should hold the region");
+    if (!SharedMemory.IsValid())
+    {
+        return false;
+    }
+
+    // Map it the way a client on this host would
+    FPlatformMemory::FSharedMemoryRegion* Client = FPlatformMemory::MapNamedSharedMemoryRegion(
+        UTF8_TO_TCHAR(Info.name().c_str()), false, uint32(FPlatformMemory::ESharedMemoryAccess::Read),
+        SIZE_T(2 * SlotSize));
+    UESYNTH_TEST_TRUE(Client != nullptr, "A client should be able to map the region");
+    if (!Client)
+    {
+        return false;
+    }
+    const uint8* Base = static_cast<const uint8*>(Client->GetAddress());
+    auto Header = [Base](uint32 Slot, int32 Field)
+    {
+        return reinterpret_cast<const int64*>(Base + Slot * SlotSize)[Field];
+    };
+
+    // Test images stay inline until the announcement has been written
+    uesynth::FrameResponse Early = MakeImage(100, 'a');
+    SharedMemory->Pack(&Early);
+    UESYNTH_TEST_EQUAL(Early.image_response().image_data().size(), size_t(100), "An image before the announcement should stay inline");
+    SharedMemory->Pack(&Announcement);
+
+    // Test an image's payload moves into the next slot
+    {
+        uesynth::FrameResponse Response = MakeImage(100, 'b');
+        SharedMemory->Pack(&Response);
+        const uesynth::ImageResponse& Image = Response.image_response();
+        UESYNTH_TEST_TRUE(Image.image_data().empty(), "The payload should leave the response");
+        UESYNTH_TEST_EQUAL(Image.shared_memory().slot(), 0u, "The first image should take slot 0");
+        UESYNTH_TEST_EQUAL(Image.shared_memory().sequence(), uint64(1), "Sequences should start at 1");
+        UESYNTH_TEST_EQUAL(Image.shared_memory().size(), uint64(100), "The size should be sent");
+        UESYNTH_TEST_EQUAL(Header(0, 0), int64(1), "The slot header should hold the sequence");
+        UESYNTH_TEST_EQUAL(Header(0, 1), int64(100), "The slot header should hold the size");
+        UESYNTH_TEST_TRUE(Base[FUESynthSharedMemory::HeaderSize] == 'b' && Base[FUESynthSharedMemory::HeaderSize + 99] == 'b',
+            "The data should follow the header");
+    }
+
+    // Test an image larger than a slot is sent inline
+    {
+        uesynth::FrameResponse Response = MakeImage(int32(SlotSize), 'c');
+        SharedMemory->Pack(&Response);
+        UESYNTH_TEST_FALSE(Response.image_response().has_shared_memory(), "An oversized image should stay inline");
+    }
+
+    // Test slots are reused round-robin, newest sequence in the header
+    {
+        uesynth::FrameResponse Second = MakeImage(10, 'd');
+        uesynth::FrameResponse Third = MakeImage(10, 'e');
+        SharedMemory->Pack(&Second);
+        SharedMemory->Pack(&Third);
+        UESYNTH_TEST_EQUAL(Second.image_response().shared_memory().slot(), 1u, "The second image should take slot 1");
+        UESYNTH_TEST_EQUAL(Third.image_response().shared_memory().slot(), 0u, "The third image should wrap to slot 0");
+        UESYNTH_TEST_EQUAL(Header(0, 0), int64(3), "A reused slot should hold the newer sequence");
+    }
+
+    // Test asking again answers with the same region
+    {
+        uesynth::FrameResponse Again;
+        AssertGrpcStatusOk(Open(4, &Again), TEXT("OpenSharedMemory again"));
+        UESYNTH_TEST_TRUE(Again.shared_memory().name() == Info.name(), "The open region should be reused");
+    }
+
+    FPlatformMemory::UnmapNamedSharedMemoryRegion(Client);
+    Link->Detach();
+    return true;
+}
+
+// Test server settings read command-line overrides and reject unusable values
+class FUESynthServiceServerSettingsTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceServerSettingsTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceServerSettingsTest,
+    "UESynth.Unit.ServiceImpl.ServerSettings",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    FString Error;
+
+    // Test the defaults are usable and lift gRPC's 4 MB receive limit
+    {
+        const FUESynthServerSettings Settings;
+        UESYNTH_TEST_TRUE(Settings.Validate(&Error), "The defaults should be valid");
+        UESYNTH_TEST_TRUE(Settings.ListenAddress == TEXT("0.0.0.0:50051"), "The default address should be unchanged");
+        UESYNTH_TEST_TRUE(Settings.MaxReceiveMessageSize > (4 << 20), "The receive limit should be above 4 MB");
+        UESYNTH_TEST_EQUAL(Settings.MaxSendMessageSize, -1, "Sends should be unlimited");
+    }
+
+    // Test command-line overrides, including the port shortcut and the old CQ thread flag
+    {
+        FUESynthServerSettings Settings;
+        Settings.ParseCommandLine(TEXT("-UESynthPort=50052 -UESynthCQThreads=6 -UESynthMaxReceiveMessageSize=1000 ")
+                                  TEXT("-UESynthKeepaliveTimeMs=30000 -UESynthCompression=gzip -UESynthSyncServer"));
+        UESYNTH_TEST_TRUE(Settings.ListenAddress == TEXT("0.0.0.0:50052"), "The port should replace the default one");
+        UESYNTH_TEST_EQUAL(Settings.CompletionQueueThreads, 6, "-UESynthCQThreads should still work");
+        UESYNTH_TEST_EQUAL(Settings.MaxReceiveMessageSize, 1000, "The receive limit should be overridden");
+        UESYNTH_TEST_EQUAL(Settings.KeepaliveTimeMs, 30000, "The keepalive time should be overridden");
+        UESYNTH_TEST_TRUE(Settings.Compression == TEXT("gzip"), "The compression should be overridden");
+        UESYNTH_TEST_TRUE(Settings.bSyncServer, "-UESynthSyncServer should select the sync server");
+        UESYNTH_TEST_TRUE(Settings.Validate(&Error), "The overridden settings should be valid");
+
+        Settings.ParseCommandLine(TEXT("-UESynthListenAddress=127.0.0.1:6000 -UESynthPort=6001"));
+        UESYNTH_TEST_TRUE(Settings.ListenAddress == TEXT("127.0.0.1:6001"), "The port should keep the given host");
+    }
+
+    // Test unusable values are reported instead of reaching gRPC
+    {
+        FUESynthServerSettings Settings;
+        Settings.ParseCommandLine(TEXT("-UESynthCompression=brotli"));
+        UESYNTH_TEST_FALSE(Settings.Validate(&Error), "An unknown compression should be rejected");
+        UESYNTH_TEST_TRUE(Error.Contains(TEXT("brotli")), "The error should name the value");
+
+        Settings = FUESynthServerSettings();
+        Settings.MaxSendMessageSize = 0;
+        UESYNTH_TEST_FALSE(Settings.Validate(&Error), "A zero message size should be rejected");
+
+        Settings = FUESynthServerSettings();
+        Settings.ListenAddress = TEXT("localhost");
+        UESYNTH_TEST_FALSE(Settings.Validate(&Error), "An address without a port should be rejected");
+
+        Settings = FUESynthServerSettings();
+        Settings.ParseCommandLine(TEXT("-UESynthMetricsPort=70000"));
+        UESYNTH_TEST_FALSE(Settings.Validate(&Error), "A metrics port out of range should be rejected");
+
+        Settings = FUESynthServerSettings();
+        Settings.ParseCommandLine(TEXT("-UESynthPort=65530 -UESynthPortRangeSize=10"));
+        UESYNTH_TEST_FALSE(Settings.Validate(&Error), "A port range past 65535 should be rejected");
+        Settings.PortRangeSize = 0;
+        UESYNTH_TEST_FALSE(Settings.Validate(&Error), "An empty port range should be rejected");
+    }
+
+    // Test the fleet settings: a port range and a registration directory
+    {
+        FUESynthServerSettings Settings;
+        UESYNTH_TEST_EQUAL(Settings.PortRangeSize, 1, "Only the configured port should be tried by default");
+        UESYNTH_TEST_TRUE(Settings.RegistrationDir.IsEmpty(), "Nothing should be registered by default");
+        Settings.ParseCommandLine(TEXT("-UESynthPort=50100 -UESynthPortRangeSize=16 -UESynthRegistrationDir=Fleet"));
+        UESYNTH_TEST_EQUAL(Settings.GetPort(), 50100, "The port should be read from the address");
+        UESYNTH_TEST_EQUAL(Settings.PortRangeSize, 16, "The range size should be overridden");
+        UESYNTH_TEST_TRUE(Settings.RegistrationDir == TEXT("Fleet"), "The registration directory should be overridden");
+        UESYNTH_TEST_TRUE(Settings.Validate(&Error), "A range within the port numbers should be valid");
+
+        UESYNTH_TEST_TRUE(FUESynthRegistration::GetConnectAddress(TEXT("0.0.0.0:50103")) == TEXT("127.0.0.1:50103"), "A wildcard host should be connected to locally");
+        UESYNTH_TEST_TRUE(FUESynthRegistration::GetConnectAddress(TEXT("10.0.0.5:50103")) == TEXT("10.0.0.5:50103"), "A given host should be kept");
+    }
+
+    return true;
+}
+
+// Test GetHealth answers from the last frame and instances register themselves
+class FUESynthServiceHealthTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceHealthTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceHealthTest,
+    "UESynth.Unit.ServiceImpl.Health",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test the health reflects the frame the game thread just ran
+    {
+        FUESynthHealth::Get().Tick(0.0f);
+
+        grpc::ServerContext Context;
+        uesynth::HealthRequest Request;
+        uesynth::HealthStatus Health;
+        grpc::Status Result = ServiceImpl->GetHealth(&Context, &Request, &Health);
+        AssertGrpcStatusOk(Result, TEXT("GetHealth"));
+        UESYNTH_TEST_EQUAL(Health.frame_number(), uint64(GFrameCounter), "The frame should be the one just ticked");
+        UESYNTH_TEST_TRUE(Health.seconds_since_frame() < FUESynthHealth::StallSeconds, "A frame just ticked shouldn't count as stalled");
+        UESYNTH_TEST_TRUE(Health.ready() == Health.not_ready_reason().empty(), "Only an instance that isn't ready should say why");
+        UESYNTH_TEST_TRUE(Health.ready() == (FUESynthSceneContext::Get().GetWorld() != nullptr && FUESynthFrameCapture::Get() != nullptr), "Ready should follow the world and the capture");
+    }
+
+    // Test the registration file exists exactly as long as its owner
+    {
+        const FString Directory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UESynthTest"), FGuid::NewGuid().ToString());
+        FString Path;
+        {
+            const FUESynthRegistration Registration(Directory, TEXT("0.0.0.0:50107"), 9100);
+            Path = Registration.GetPath();
+            UESYNTH_TEST_FALSE(Path.IsEmpty(), "The registration file should be written");
+
+            FString Json;
+            UESYNTH_TEST_TRUE(FFileHelper::LoadFileToString(Json, *Path), "The registration file should be readable");
+            UESYNTH_TEST_TRUE(Json.Contains(TEXT("\"127.0.0.1:50107\"")), "The file should say where to connect");
+            UESYNTH_TEST_TRUE(Json.Contains(TEXT("\"metrics_port\": 9100")), "The file should name the metrics port");
+        }
+        UESYNTH_TEST_FALSE(IFileManager::Get().FileExists(*Path), "The registration file should go with its owner");
+        IFileManager::Get().DeleteDirectory(*Directory, /*RequireExists=*/false, /*Tree=*/true);
+    }
+
+    return true;
+}
+
+// Test steps run their actions in order and reject what can't be part of one
+class FUESynthServiceStepTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceStepTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceStepTest,
+    "UESynth.Unit.ServiceImpl.Step",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Runs Request as a ControlStream action and counts its completions; nothing here waits on a readback
+    grpc::StatusCode Code = grpc::StatusCode::OK;
+    auto RunStep = [this, &Code](const uesynth::ActionRequest& Request, uesynth::FrameResponse* Response)
+    {
+        int32 NumCompletions = 0;
+        ServiceImpl->ProcessActionOnGameThread(Request, Response,
+            [&NumCompletions, &Code](const grpc::Status& Status)
+            {
+                ++NumCompletions;
+                Code = Status.error_code();
+            });
+        return NumCompletions;
+    };
+
+    // Test captures, nested steps and negative ticks are rejected before anything runs
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("step-000");
+        Request.mutable_step()->add_actions()->mutable_spawn_object();
+        Request.mutable_step()->add_actions()->mutable_capture_rgb();
+
+        uesynth::FrameResponse Response;
+        UESYNTH_TEST_EQUAL(RunStep(Request, &Response), 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::INVALID_ARGUMENT, "A capture action should be rejected");
+        UESYNTH_TEST_EQUAL(Response.step_response().results_size(), 0, "No action should have run");
+
+        Request.mutable_step()->mutable_actions(1)->mutable_step();
+        Response.Clear();
+        UESYNTH_TEST_EQUAL(RunStep(Request, &Response), 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::INVALID_ARGUMENT, "A nested step should be rejected");
+
+        Request.mutable_step()->mutable_actions()->RemoveLast();
+        Request.mutable_step()->set_delta_seconds(-1.0f);
+        Response.Clear();
+        UESYNTH_TEST_EQUAL(RunStep(Request, &Response), 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::INVALID_ARGUMENT, "A negative delta should be rejected");
+    }
+
+    // Test a failed action stops the step unless asked to go on, with every result in order
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("step-001");
+        for (const char* Id : {"first", "second"})
+        {
+            uesynth::ActionRequest* Action = Request.mutable_step()->add_actions();
+            Action->set_request_id(Id);
+            // A parameter without a value is malformed
+            Action->mutable_set_material()->add_parameters()->set_name("Tint");
+        }
+
+        uesynth::FrameResponse Response;
+        UESYNTH_TEST_EQUAL(RunStep(Request, &Response), 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::OK, "Failed actions should not fail the step");
+        UESYNTH_TEST_EQUAL(Response.request_id(), "step-001", "Request ID should be echoed");
+        const uesynth::StepResponse& Stopped = Response.step_response();
+        UESYNTH_TEST_EQUAL(Stopped.results_size(), 1, "The step should stop at the first failure");
+        UESYNTH_TEST_EQUAL(Stopped.errors_size(), 1, "The failure should be reported");
+        UESYNTH_TEST_EQUAL(Stopped.errors(0).index(), 0u, "The failure should name its action");
+        UESYNTH_TEST_EQUAL(Stopped.errors(0).code(), int32(grpc::StatusCode::INVALID_ARGUMENT), "The failure should keep its status");
+        UESYNTH_TEST_FALSE(Stopped.has_images(), "Nothing should be captured after a failure");
+
+        Request.mutable_step()->set_continue_on_error(true);
+        Response.Clear();
+        UESYNTH_TEST_EQUAL(RunStep(Request, &Response), 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::OK, "Failed actions should not fail the step");
+        const uesynth::StepResponse& Continued = Response.step_response();
+        UESYNTH_TEST_EQUAL(Continued.results_size(), 2, "Every action should run");
+        UESYNTH_TEST_EQUAL(Continued.results(1).request_id(), "second", "Results should keep their action's ID, in order");
+        UESYNTH_TEST_EQUAL(Continued.errors_size(), 2, "Both failures should be reported");
+        UESYNTH_TEST_EQUAL(Continued.errors(1).index(), 1u, "Failures should be in action order");
+    }
+
+    return true;
+}
+
+// Test lockstep switches the fixed time step on and off and lets steps through one frame at a time
+class FUESynthServiceLockstepTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceLockstepTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceLockstepTest,
+    "UESynth.Unit.ServiceImpl.Lockstep",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    const bool bUsedFixedTimeStep = FApp::UseFixedTimeStep();
+
+    // Test enabling, stepping and disabling again; no frame ends in between, so nothing waits
+    {
+        uesynth::SetLockstepRequest Request;
+        Request.set_enabled(true);
+        Request.set_fixed_delta_seconds(0.05f);
+        Request.set_idle_timeout_ms(1000);
+        uesynth::LockstepState State;
+        grpc::Status Status = ServiceImpl->SetLockstepOnGameThread(Request, &State);
+        UESYNTH_TEST_TRUE(Status.ok(), "Enabling lockstep should succeed");
+        UESYNTH_TEST_TRUE(State.enabled(), "Lockstep should be reported enabled");
+        UESYNTH_TEST_EQUAL(State.frames_stepped(), 0ull, "No frame should have been stepped yet");
+        UESYNTH_TEST_TRUE(FApp::UseFixedTimeStep(), "The engine should use a fixed time step");
+        UESYNTH_TEST_TRUE(FMath::IsNearlyEqual(FApp::GetFixedDeltaTime(), 0.05), "The time step should be the requested one");
+
+        // The step lets a frame of its own length through instead of ticking the world
+        uesynth::StepRequest Step;
+        Step.set_delta_seconds(0.1f);
+        uesynth::StepResponse StepResponse;
+        int32 NumCompletions = 0;
+        ServiceImpl->StepOnGameThread(Step, &StepResponse,
+            [&NumCompletions, &Status](const grpc::Status& InStatus)
+            {
+                ++NumCompletions;
+                Status = InStatus;
+            });
+        UESYNTH_TEST_EQUAL(NumCompletions, 1, "A step without capture should complete inline");
+        UESYNTH_TEST_TRUE(Status.ok(), "The step should succeed");
+        UESYNTH_TEST_TRUE(FMath::IsNearlyEqual(FApp::GetFixedDeltaTime(), 0.1), "The next frame should be the step's length");
+
+        Request.set_enabled(false);
+        Status = ServiceImpl->SetLockstepOnGameThread(Request, &State);
+        UESYNTH_TEST_TRUE(Status.ok(), "Disabling lockstep should succeed");
+        UESYNTH_TEST_FALSE(State.enabled(), "Lockstep should be reported disabled");
+        UESYNTH_TEST_TRUE(FApp::UseFixedTimeStep() == bUsedFixedTimeStep, "The time step mode should be restored");
+    }
+
+    // Test an unusable delta is rejected without enabling anything
+    {
+        uesynth::SetLockstepRequest Request;
+        Request.set_enabled(true);
+        Request.set_fixed_delta_seconds(-1.0f);
+        uesynth::LockstepState State;
+        const grpc::Status Status = ServiceImpl->SetLockstepOnGameThread(Request, &State);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "A negative delta should be rejected");
+        UESYNTH_TEST_FALSE(FUESynthLockstep::Get().IsEnabled(), "Lockstep should stay off");
+    }
+
+    // Test lockstep never waits forever: leaving the timeout at 0 picks the default one
+    {
+        uesynth::SetLockstepRequest Request;
+        Request.set_enabled(true);
+        uesynth::LockstepState State;
+        AssertGrpcStatusOk(ServiceImpl->SetLockstepOnGameThread(Request, &State), TEXT("SetLockstep"));
+        UESYNTH_TEST_EQUAL(State.idle_timeout_ms(), FUESynthLockstep::DefaultIdleTimeoutMs, "The default idle timeout should apply");
+
+        Request.set_enabled(false);
+        AssertGrpcStatusOk(ServiceImpl->SetLockstepOnGameThread(Request, &State), TEXT("SetLockstep"));
+    }
+
+    return true;
+}
+
+// Test sessions: their lanes take turns in a drain, and their scene contexts only act on their world
+class FUESynthServiceSessionsTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceSessionsTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceSessionsTest,
+    "UESynth.Unit.ServiceImpl.Sessions",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test a lane with a backlog doesn't keep another lane's command waiting behind it
+    {
+        FUESynthCommandQueue& Queue = FUESynthCommandQueue::Get();
+        TSharedRef<FUESynthCommandQueue::FLane> Greedy = Queue.CreateLane();
+        TSharedRef<FUESynthCommandQueue::FLane> Other = Queue.CreateLane();
+        TArray<FString> Order;
+        for (int32 Index = 0; Index < 8; ++Index)
+        {
+            Queue.Enqueue(*Greedy, EUESynthCommandKind::Query, [&Order, Index]() { Order.Add(FString::Printf(TEXT("Greedy%d"), Index)); });
+        }
+        Queue.Enqueue(*Other, EUESynthCommandKind::Query, [&Order]() { Order.Add(TEXT("Other")); });
+        Queue.Drain(/*bNewFrame=*/true);
+
+        UESYNTH_TEST_EQUAL(Order.Num(), 9, "Every queued command should run");
+        UESYNTH_TEST_TRUE(Order.IndexOfByKey(TEXT("Other")) <= 1, "The other lane should get its turn before the backlog");
+        UESYNTH_TEST_TRUE(Order.IndexOfByKey(TEXT("Greedy0")) < Order.IndexOfByKey(TEXT("Greedy7")), "A lane should keep its own order");
+    }
+
+    // Test a session context acts on its own world only, and only while it is active
+    {
+        FUESynthSceneContext& ModuleContext = FUESynthSceneContext::Get();
+        FUESynthSceneContext SessionContext(nullptr);
+        {
+            FUESynthSceneContext::FActiveScope Scope(&SessionContext);
+            UESYNTH_TEST_TRUE(&FUESynthSceneContext::Get() == &SessionContext, "The active context should be the session's");
+            UESYNTH_TEST_TRUE(FUESynthSceneContext::Get().GetWorld() == nullptr, "A session without a world should not fall back to the editor's");
+            UESYNTH_TEST_TRUE(FUESynthSceneContext::Get().GetViewportClient() == nullptr, "A session should have no viewport");
+        }
+        UESYNTH_TEST_TRUE(&FUESynthSceneContext::Get() == &ModuleContext, "The module's context should be back once the scope ends");
+    }
+
+    // Test a call that names no session stays on the default lane
+    {
+        TSharedPtr<FUESynthSession> Session;
+        const grpc::Status Status = FUESynthSessions::Get().FromMetadata(nullptr, &Session);
+        UESYNTH_TEST_TRUE(Status.ok(), "No session should not be an error");
+        UESYNTH_TEST_FALSE(Session.IsValid(), "No session should be opened");
+    }
+
+    return true;
+}
+
+// Test spawns never block on an asset load and preloads report the cache
+class FUESynthServiceAssetCacheTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceAssetCacheTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceAssetCacheTest,
+    "UESynth.Unit.ServiceImpl.AssetCache",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    const char* MissingAsset = "/Game/UESynthTest_Missing.UESynthTest_Missing";
+    int32 NumCompletions = 0;
+    grpc::StatusCode Code = grpc::StatusCode::UNKNOWN;
+    auto OnDone = [&NumCompletions, &Code](const grpc::Status& Status)
+    {
+        ++NumCompletions;
+        Code = Status.error_code();
+    };
+
+    // Test a spawn that may not wait answers inline without loading anything
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("spawn-000");
+        Request.mutable_spawn_object()->set_object_name("UESynthTest_Spawned");
+        Request.mutable_spawn_object()->set_asset_path(MissingAsset);
+        Request.mutable_spawn_object()->set_if_not_resident(uesynth::ASSET_MISS_POLICY_FAIL);
+
+        uesynth::FrameResponse Response;
+        ServiceImpl->ProcessActionOnGameThread(Request, &Response, OnDone);
+        UESYNTH_TEST_EQUAL(NumCompletions, 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::OK, "A missing asset is not a call failure");
+        UESYNTH_TEST_FALSE(Response.command_response().success(), "Nothing should be spawned");
+    }
+
+    // Test a spawn without a name is refused
+    {
+        uesynth::SpawnObjectRequest Request;
+        Request.set_asset_path("/Engine/BasicShapes/Cube.Cube");
+        uesynth::CommandResponse Reply;
+        ServiceImpl->SpawnResidentObjectOnGameThread(Request, &Reply);
+        UESYNTH_TEST_FALSE(Reply.success(), "A spawn needs an object_name");
+    }
+
+    // Test a preload that doesn't wait answers inline with one status per path
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("preload-000");
+        Request.mutable_preload_assets()->add_asset_paths(MissingAsset);
+        Request.mutable_preload_assets()->add_asset_paths("");
+
+        uesynth::FrameResponse Response;
+        NumCompletions = 0;
+        ServiceImpl->ProcessActionOnGameThread(Request, &Response, OnDone);
+        UESYNTH_TEST_EQUAL(NumCompletions, 1, "Completion should run exactly once, inline");
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::OK, "Preloading should succeed");
+        const uesynth::PreloadAssetsResponse& Preload = Response.preload_assets_response();
+        UESYNTH_TEST_EQUAL(Preload.assets_size(), 2, "Every path should have a status");
+        UESYNTH_TEST_EQUAL(Preload.assets(0).asset_path(), MissingAsset, "Statuses should be in request order");
+        UESYNTH_TEST_TRUE(Preload.assets(0).state() == uesynth::ASSET_STATE_LOADING || Preload.assets(0).state() == uesynth::ASSET_STATE_FAILED, "The asset should be on its way or failed");
+        UESYNTH_TEST_TRUE(Preload.assets(1).state() == uesynth::ASSET_STATE_FAILED, "An empty path should fail");
+        UESYNTH_TEST_EQUAL(Preload.cache_budget_bytes(), FUESynthAssetCache::Get().GetBudget(), "The budget should be reported");
+    }
+
+    return true;
+}
+
+// Test the actor pool's limits and stats
+class FUESynthServiceActorPoolTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceActorPoolTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceActorPoolTest,
+    "UESynth.Unit.ServiceImpl.ActorPool",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test an empty pool misses and an actor it never spawned isn't parked
+    {
+        FUESynthActorPool Pool;
+        FUESynthActorRegistry Actors;
+        const FSoftObjectPath Crate(TEXT("/Game/UESynthTest_Crate.UESynthTest_Crate"));
+        UESYNTH_TEST_TRUE(Pool.Take(Crate, TEXT("Crate_01"), FTransform::Identity, Actors) == nullptr, "An empty pool should have nothing to take");
+        UESYNTH_TEST_EQUAL(Pool.GetStats().FindChecked(Crate).Misses, 1ull, "The miss should be counted");
+        UESYNTH_TEST_FALSE(Pool.Park(nullptr, Actors), "Only pooled actors should be parked");
+        UESYNTH_TEST_EQUAL(Pool.NumParked(), 0, "Nothing should be parked");
+    }
+
+    // Test the limit is set and reported, and bounded
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("pool-000");
+        Request.mutable_configure_actor_pool()->set_max_parked_per_asset(4);
+
+        uesynth::FrameResponse Response;
+        grpc::Status Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.ok(), "Configuring the pool should succeed");
+        UESYNTH_TEST_EQUAL(Response.actor_pool_stats().max_parked_per_asset(), 4u, "The new limit should be reported");
+
+        Request.mutable_configure_actor_pool()->set_max_parked_per_asset(FUESynthActorPool::MaxParkedPerAssetLimit + 1);
+        Response.Clear();
+        Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "A limit past the maximum should be rejected");
+
+        // Back to the default for the tests after this one
+        Request.mutable_configure_actor_pool()->set_max_parked_per_asset(FUESynthActorPool::DefaultMaxParkedPerAsset);
+        Response.Clear();
+        UESYNTH_TEST_TRUE(ServiceImpl->ProcessAction(Request, &Response).ok(), "Restoring the limit should succeed");
+    }
+
+    return true;
+}
+
+// Test material parameter IDs and how malformed or misdirected updates fail
+class FUESynthServiceMaterialsTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceMaterialsTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceMaterialsTest,
+    "UESynth.Unit.ServiceImpl.Materials",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test names resolve to stable IDs that stand for the name
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("mat-000");
+        for (const char* Name : {"Tint", "Roughness", "Tint"})
+        {
+            Request.mutable_resolve_material_parameters()->add_names(Name);
+        }
+
+        uesynth::FrameResponse Response;
+        grpc::Status Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.ok(), "Resolving names should succeed");
+        const uesynth::MaterialParameterIds& Ids = Response.material_parameter_ids();
+        UESYNTH_TEST_EQUAL(Ids.ids_size(), 3, "Every name should get an ID");
+        UESYNTH_TEST_TRUE(Ids.ids(0) != 0 && Ids.ids(0) != Ids.ids(1), "Names should get distinct, non-zero IDs");
+        UESYNTH_TEST_EQUAL(Ids.ids(2), Ids.ids(0), "A name should keep its ID");
+        UESYNTH_TEST_EQUAL(FUESynthMaterialCache::ResolveParameter(TEXT("Tint")), Ids.ids(0), "IDs should be server-wide");
+        const FMaterialParameterInfo* Info = FUESynthMaterialCache::FindParameter(Ids.ids(1));
+        UESYNTH_TEST_TRUE(Info && Info->Name == FName(TEXT("Roughness")), "An ID should stand for its name");
+        UESYNTH_TEST_TRUE(FUESynthMaterialCache::FindParameter(0) == nullptr, "0 should never be an ID");
+    }
+
+    // Test unknown IDs and missing values are rejected before anything is applied
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("mat-001");
+        uesynth::SetMaterialRequest* Object = Request.mutable_set_materials_batch()->add_objects();
+        Object->set_object_name("UESynthTest_NoSuchObject");
+        uesynth::MaterialParameter* Parameter = Object->add_parameters();
+        Parameter->set_id(0xFFFFFFFFu);
+        Parameter->set_scalar(0.5f);
+
+        uesynth::FrameResponse Response;
+        grpc::Status Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "An unknown ID should be INVALID_ARGUMENT");
+
+        Parameter->set_name("Roughness");
+        Parameter->clear_scalar();
+        Response.Clear();
+        Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "A parameter without a value should be INVALID_ARGUMENT");
+    }
+
+    // Test a well-formed update of a missing object fails only that object
+    {
+        uesynth::ActionRequest Request;
+        Request.set_request_id("mat-002");
+        uesynth::SetMaterialRequest* Object = Request.mutable_set_materials_batch()->add_objects();
+        Object->set_object_name("UESynthTest_NoSuchObject");
+        uesynth::MaterialParameter* Parameter = Object->add_parameters();
+        Parameter->set_name("Tint");
+        Parameter->mutable_vector()->set_r(1.0f);
+
+        uesynth::FrameResponse Response;
+        grpc::Status Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.ok(), "A missing object should not fail the batch");
+        UESYNTH_TEST_EQUAL(Response.materials_set().applied_count(), 0u, "Nothing should be applied");
+        UESYNTH_TEST_EQUAL(Response.materials_set().failed_indices_size(), 1, "The missing object should be reported");
+
+        uesynth::ActionRequest Single;
+        Single.set_request_id("mat-003");
+        *Single.mutable_set_material() = *Object;
+        Response.Clear();
+        Status = ServiceImpl->ProcessAction(Single, &Response);
+        UESYNTH_TEST_TRUE(Status.ok(), "A missing object should not be an RPC error");
+        UESYNTH_TEST_FALSE(Response.command_response().success(), "Updating a missing object should fail");
+    }
+
+    return true;
+}
+
+// Test lighting updates of lights that don't exist fail without failing the call
+class FUESynthServiceLightingTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceLightingTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceLightingTest,
+    "UESynth.Unit.ServiceImpl.Lighting",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test an actor that isn't there has no light
+    {
+        FUESynthLightRegistry Lights;
+        UESYNTH_TEST_TRUE(Lights.FindLight(nullptr) == nullptr, "No actor should have no light");
+        UESYNTH_TEST_EQUAL(Lights.Num(), 0, "Nothing should be remembered");
+    }
+
+    // Test a missing light fails on its own, in a batch and alone
+    {
+        uesynth::SetLightingRequest Update;
+        Update.set_light_name("UESynthTest_NoSuchLight");
+        Update.set_intensity(5.0f);
+        Update.mutable_color()->set_x(1.0f);
+
+        uesynth::ActionRequest Request;
+        Request.set_request_id("light-000");
+        *Request.mutable_set_lighting_batch()->add_lights() = Update;
+        Request.mutable_set_lighting_batch()->add_lights()->set_object_id(0xFFFFFFFFu);
+
+        uesynth::FrameResponse Response;
+        grpc::Status Status = ServiceImpl->ProcessAction(Request, &Response);
+        UESYNTH_TEST_TRUE(Status.ok(), "Missing lights should not fail the batch");
+        UESYNTH_TEST_EQUAL(Response.lighting_set().applied_count(), 0u, "Nothing should be applied");
+        UESYNTH_TEST_EQUAL(Response.lighting_set().failed_indices_size(), 2, "Every missing light should be reported");
+        UESYNTH_TEST_EQUAL(Response.lighting_set().failed_indices(1), 1u, "Failures should be in request order");
+
+        uesynth::ActionRequest Single;
+        Single.set_request_id("light-001");
+        *Single.mutable_set_lighting() = Update;
+        Response.Clear();
+        Status = ServiceImpl->ProcessAction(Single, &Response);
+        UESYNTH_TEST_TRUE(Status.ok(), "A missing light should not be an RPC error");
+        UESYNTH_TEST_FALSE(Response.command_response().success(), "Updating a missing light should fail");
+    }
+
+    return true;
+}
+
+// Test server stats histograms, their quantiles and the Prometheus text
+class FUESynthServiceServerStatsTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceServerStatsTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceServerStatsTest,
+    "UESynth.Unit.ServiceImpl.ServerStats",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test buckets are cumulative and quantiles fall inside the bucket that holds them
+    {
+        FUESynthServerStats::FHistogram Histogram;
+        for (int32 Index = 0; Index < 99; ++Index)
+        {
+            Histogram.Record(0.003);
+        }
+        Histogram.Record(7.0, /*bFailed=*/true);
+
+        uesynth::LatencyHistogram Filled;
+        Histogram.Fill(&Filled);
+        UESYNTH_TEST_EQUAL(Filled.buckets_size(), FUESynthServerStats::NumBucketBounds + 1, "Every bucket and the overflow should be there");
+        UESYNTH_TEST_EQUAL(Filled.count(), 100ull, "Every observation should be counted");
+        UESYNTH_TEST_EQUAL(Filled.buckets(Filled.buckets_size() - 1), Filled.count(), "The last bucket should hold everything");
+        UESYNTH_TEST_EQUAL(Filled.errors(), 1ull, "The failed call should be counted");
+        UESYNTH_TEST_TRUE(Filled.p50_seconds() > 0.0025 && Filled.p50_seconds() <= 0.005, "The median should be in the 2.5-5 ms bucket");
+        UESYNTH_TEST_TRUE(Filled.p99_seconds() <= 0.005, "Only the slowest call should be past the 99th percentile");
+        UESYNTH_TEST_TRUE(FUESynthServerStats::EstimateQuantile(Filled, 1.0) > 5.0, "The maximum should be in the slow call's bucket");
+
+        Histogram.Reset();
+        uesynth::LatencyHistogram Empty;
+        Histogram.Fill(&Empty);
+        UESYNTH_TEST_EQUAL(Empty.count(), 0ull, "A reset should start over");
+        UESYNTH_TEST_TRUE(FUESynthServerStats::EstimateQuantile(Empty, 0.5) == 0.0, "An empty histogram should have no quantiles");
+    }
+
+    // Test a timed call shows up in GetServerStats and its Prometheus text
+    {
+        const FName Rpc(TEXT("UESynthTest/Timed"));
+        {
+            FUESynthCallTimer Timer(Rpc);
+            Timer.OnStarted();
+            Timer.OnFinished(grpc::Status::OK);
+            Timer.OnFinished(grpc::Status::CANCELLED);
+        }
+
+        grpc::ServerContext Context;
+        uesynth::GetServerStatsRequest Request;
+        uesynth::ServerStats Stats;
+        grpc::Status Result = ServiceImpl->GetServerStats(&Context, &Request, &Stats);
+        AssertGrpcStatusOk(Result, TEXT("GetServerStats"));
+        UESYNTH_TEST_EQUAL(Stats.bucket_bounds_seconds_size(), FUESynthServerStats::NumBucketBounds, "The bucket bounds should be reported");
+        UESYNTH_TEST_EQUAL(Stats.stages_size(), int32(EUESynthStage::Num), "Every stage should be reported");
+
+        const uesynth::LatencyHistogram* Timed = nullptr;
+        for (const uesynth::LatencyHistogram& Histogram : Stats.rpcs())
+        {
+            if (Histogram.name() == "UESynthTest/Timed")
+            {
+                Timed = &Histogram;
+            }
+        }
+        UESYNTH_TEST_TRUE(Timed != nullptr, "The timed call should have a histogram");
+        UESYNTH_TEST_TRUE(Timed->count() >= 1 && Timed->errors() == 0, "A call should only be recorded once");
+
+        const std::string Text = FUESynthServerStats::ToPrometheusText(Stats);
+        UESYNTH_TEST_TRUE(Text.find("uesynth_rpc_duration_seconds_bucket{rpc=\"UESynthTest/Timed\",le=\"+Inf\"}") != std::string::npos, "The call should have an overflow bucket");
+        UESYNTH_TEST_TRUE(Text.find("# TYPE uesynth_command_queue_depth gauge") != std::string::npos, "The queue depth should be a gauge");
+        UESYNTH_TEST_TRUE(Text.find("uesynth_stage_duration_seconds_count{stage=\"queue_wait\"}") != std::string::npos, "Stages should be labelled");
+    }
+
+    // Test an action is named after its oneof field
+    {
+        uesynth::ActionRequest Action;
+        Action.mutable_get_stream_stats();
+        UESYNTH_TEST_TRUE(FUESynthServerStats::GetActionName(Action) == FName(TEXT("ControlStream/get_stream_stats")), "Actions should be named after their field");
+    }
+
+    return true;
+}
+
+// Test cancellation tokens, their deadlines and work dropped for a cancelled call
+class FUESynthServiceCancellationTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceCancellationTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceCancellationTest,
+    "UESynth.Unit.ServiceImpl.Cancellation",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    // Test a token is only cancelled when told to, or once its deadline has passed
+    {
+        grpc::ServerContext Context;
+        TSharedRef<FUESynthCancellation> Token = FUESynthCancellation::Create(&Context);
+        UESYNTH_TEST_FALSE(Token->IsCancelled(), "A call without a deadline should not be cancelled by itself");
+        Token->Cancel();
+        UESYNTH_TEST_TRUE(Token->IsCancelled(), "A cancelled call should be cancelled");
+        UESYNTH_TEST_TRUE(Token->GetStatus().error_code() == grpc::StatusCode::CANCELLED, "A cancelled call should be answered CANCELLED");
+
+        TSharedRef<FUESynthCancellation> Late = FUESynthCancellation::Create();
+        Late->SetDeadline(std::chrono::system_clock::now() - std::chrono::seconds(1));
+        UESYNTH_TEST_TRUE(Late->IsCancelled(), "A call past its deadline should be cancelled");
+        UESYNTH_TEST_TRUE(Late->GetStatus().error_code() == grpc::StatusCode::DEADLINE_EXCEEDED, "A call past its deadline should be answered DEADLINE_EXCEEDED");
+
+        TSharedRef<FUESynthCancellation> Patient = FUESynthCancellation::Create();
+        Patient->SetDeadline(std::chrono::system_clock::now() + std::chrono::hours(1));
+        UESYNTH_TEST_FALSE(Patient->IsCancelled(), "A call before its deadline should not be cancelled");
+        UESYNTH_TEST_FALSE(FUESynthCancellation::IsCancelled(nullptr), "Work of no call should never be dropped");
+    }
+
+    // Test scopes nest and restore the token that was active before them
+    {
+        TSharedRef<FUESynthCancellation> Outer = FUESynthCancellation::Create();
+        TSharedRef<FUESynthCancellation> Inner = FUESynthCancellation::Create();
+        UESYNTH_TEST_FALSE(FUESynthCancellation::GetActive().IsValid(), "No token should be active outside a call");
+        {
+            FUESynthCancellation::FScope OuterScope(Outer);
+            {
+                FUESynthCancellation::FScope InnerScope(Inner);
+                UESYNTH_TEST_TRUE(FUESynthCancellation::GetActive().Get() == &Inner.Get(), "The innermost token should be active");
+            }
+            UESYNTH_TEST_TRUE(FUESynthCancellation::GetActive().Get() == &Outer.Get(), "Leaving a scope should restore the token before it");
+        }
+        UESYNTH_TEST_FALSE(FUESynthCancellation::GetActive().IsValid(), "No token should be left active");
+    }
+
+    // Test images of a cancelled call are not encoded
+    {
+        uesynth::ImageResponse Image;
+        Image.set_width(4);
+        Image.set_height(4);
+        Image.set_image_data(std::string(4 * 4 * 4, '\x7f'));
+        const uint64 DroppedBefore = [] {
+            uesynth::ServerStats Stats;
+            FUESynthServerStats::Get().Fill(&Stats);
+            return Stats.dropped_work();
+        }();
+
+        TSharedRef<FUESynthCancellation> Token = FUESynthCancellation::Create();
+        Token->Cancel();
+        std::atomic<int32> Result{-1};
+        {
+            FUESynthCancellation::FScope Scope(Token);
+            TArray<FUESynthEncodeJob> Jobs;
+            Jobs.Add(FUESynthEncodeJob{&Image, EUESynthImageCodec::Lz4});
+            UESynthImageEncoder::EncodeAsync(MoveTemp(Jobs), [&Result](bool bSuccess) { Result = bSuccess ? 1 : 0; });
+        }
+        while (Result.load() < 0)
+        {
+            FPlatformProcess::SleepNoStats(0.0f);
+        }
+
+        uesynth::ServerStats Stats;
+        FUESynthServerStats::Get().Fill(&Stats);
+        UESYNTH_TEST_EQUAL(Result.load(), 0, "Encoding for a cancelled call should report failure");
+        UESYNTH_TEST_EQUAL(Image.image_data().size(), size_t(4 * 4 * 4), "The raw pixels should be left as they were");
+        UESYNTH_TEST_TRUE(Stats.dropped_work() > DroppedBefore, "The dropped encode should be counted");
+    }
+
+    return true;
+}
+
+// Test recordings write pushed frames into shards on disk and say what they wrote once stopped
+class FUESynthServiceRecordingTest : public FAutomationTestBase, public UESynthTestBase
+{
+public:
+    FUESynthServiceRecordingTest(const FString& InName, const bool bInComplexTask)
+        : FAutomationTestBase(InName, bInComplexTask)
+    {
+        CurrentTest = this;
+    }
+
+    virtual bool RunTest(const FString& Parameters) override;
+    bool RunTestImpl();
+};
+
+IMPLEMENT_UESYNTH_UNIT_TEST(FUESynthServiceRecordingTest,
+    "UESynth.Unit.ServiceImpl.Recording",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+{
+    const FString TestRoot = FPaths::Combine(FUESynthRecordings::GetRoot(), TEXT("UESynthTest"));
+    uesynth::StartRecordingRequest Request;
+    Request.set_recording_id("test-recording");
+    Request.set_directory(TCHAR_TO_UTF8(*FPaths::Combine(TEXT("UESynthTest"), FGuid::NewGuid().ToString())));
+    const FString Directory = FUESynthRecordings::GetDirectory(Request);
+    UESYNTH_TEST_TRUE(FPaths::IsUnderDirectory(Directory, TestRoot), "A relative directory should be under the recordings root");
+
+    // Test directories outside the recordings root are refused
+    {
+        for (const char* Outside : {"../UESynthOutside", "UESynthTest/../../UESynthOutside", "/tmp/UESynthOutside"})
+        {
+            uesynth::StartRecordingRequest Escaping = Request;
+            Escaping.set_directory(Outside);
+            uesynth::RecordingStats Stats;
+            grpc::Status Status = ServiceImpl->StartRecordingOnGameThread(Escaping, &Stats);
+            UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT,
+                "A directory outside the recordings root should be INVALID_ARGUMENT");
+        }
+    }
+
+    // Test compressed and delta subscriptions are rejected before anything is created
+    {
+        uesynth::StartRecordingRequest Compressed = Request;
+        Compressed.mutable_subscription()->mutable_capture()->set_modalities(uesynth::CAPTURE_MODALITY_RGB);
+        Compressed.mutable_subscription()->mutable_capture()->set_color_codec(uesynth::IMAGE_CODEC_PNG);
+        uesynth::RecordingStats Stats;
+        grpc::Status Status = ServiceImpl->StartRecordingOnGameThread(Compressed, &Stats);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "A PNG recording should be rejected");
+
+        Compressed.mutable_subscription()->mutable_capture()->set_color_codec(uesynth::IMAGE_CODEC_RAW);
+        Compressed.mutable_subscription()->set_delta_tile_size(16);
+        Status = ServiceImpl->StartRecordingOnGameThread(Compressed, &Stats);
+        UESYNTH_TEST_TRUE(Status.error_code() == grpc::StatusCode::INVALID_ARGUMENT, "A delta recording should be rejected");
+        UESYNTH_TEST_FALSE(IFileManager::Get().DirectoryExists(*Directory), "Nothing should be created");
+    }
+
+    // Test a step can't name a recording that isn't running
+    {
+        uesynth::StepRequest Step;
+        Step.set_recording_id("no-such-recording");
+        Step.mutable_capture()->set_modalities(uesynth::CAPTURE_MODALITY_RGB);
+        uesynth::StepResponse Reply;
+        grpc::StatusCode Code = grpc::StatusCode::OK;
+        ServiceImpl->StepOnGameThread(Step, &Reply, [&Code](const grpc::Status& Status) { Code = Status.error_code(); });
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::NOT_FOUND, "An unknown recording should be reported");
+    }
+
+    // Test frames pushed to a recording land in shards, a new one whenever the layout changes
+    {
+        uesynth::RecordingStats Started;
+        AssertGrpcStatusOk(ServiceImpl->StartRecordingOnGameThread(Request, &Started), "StartRecording");
+        UESYNTH_TEST_EQUAL(Started.recording_id(), "test-recording", "Recording ID should be echoed");
+        uesynth::RecordingStats Duplicate;
+        UESYNTH_TEST_FALSE(ServiceImpl->StartRecordingOnGameThread(Request, &Duplicate).ok(), "A running recording ID should be refused");
+
+        const TSharedPtr<FUESynthStreamLink> Link = FUESynthRecordings::Get().FindLink("test-recording");
+        UESYNTH_TEST_TRUE(Link.IsValid(), "The recording should take frames");
+        const auto MakeFrame = [](uint64 FrameNumber, uint32 Width, uint32 Height)
+        {
+            uesynth::FrameResponse Response;
+            uesynth::SubscriptionFrame* Frame = Response.mutable_subscription_frame();
+            Frame->set_frame_number(FrameNumber);
+            Frame->set_world_time_seconds(double(FrameNumber) / 30.0);
+            Frame->mutable_camera_transform()->mutable_location()->set_x(100.0f);
+            uesynth::ImageResponse* Rgb = Frame->mutable_images()->mutable_rgb();
+            Rgb->set_width(Width);
+            Rgb->set_height(Height);
+            Rgb->set_format("rgba");
+            Rgb->set_image_data(std::string(Width * Height * 4, char(FrameNumber)));
+            Frame->mutable_images()->set_modalities(uesynth::CAPTURE_MODALITY_RGB);
+            return Response;
+        };
+        UESYNTH_TEST_TRUE(Link->Push(MakeFrame(1, 4, 2)), "The first frame should be taken");
+        UESYNTH_TEST_TRUE(Link->Push(MakeFrame(2, 4, 2)), "The second frame should be taken");
+        UESYNTH_TEST_TRUE(Link->Push(MakeFrame(3, 2, 2)), "A resized frame should be taken");
+
+        std::atomic<bool> bStopped{false};
+        uesynth::StopRecordingRequest Stop;
+        Stop.set_recording_id("test-recording");
+        uesynth::RecordingStats Stats;
+        grpc::StatusCode Code = grpc::StatusCode::UNKNOWN;
+        ServiceImpl->StopRecordingOnGameThread(Stop, &Stats, [&bStopped, &Code](const grpc::Status& Status)
+        {
+            Code = Status.error_code();
+            bStopped = true;
+        });
+        while (!bStopped.load())
+        {
+            FPlatformProcess::SleepNoStats(0.001f);
+        }
+
+        UESYNTH_TEST_TRUE(Code == grpc::StatusCode::OK, "StopRecording should succeed");
+        UESYNTH_TEST_EQUAL(Stats.error(), "", "Nothing should fail to write");
+        UESYNTH_TEST_EQUAL(Stats.frames_written(), uint64(3), "Every frame should be written");
+        UESYNTH_TEST_EQUAL(Stats.frames_dropped(), uint64(0), "No frame should be dropped");
+        UESYNTH_TEST_EQUAL(Stats.shards(), 2u, "The resize should start a shard");
+        UESYNTH_TEST_FALSE(FUESynthRecordings::Get().FindLink("test-recording").IsValid(), "The recording should be gone");
+
+        IFileManager& FileManager = IFileManager::Get();
+        UESYNTH_TEST_EQUAL(FileManager.FileSize(*FPaths::Combine(Directory, TEXT("rgb-00000.bin"))), int64(2 * 4 * 2 * 4),
+            "The first shard should hold two 4x2 frames");
+        UESYNTH_TEST_EQUAL(FileManager.FileSize(*FPaths::Combine(Directory, TEXT("rgb-00001.bin"))), int64(2 * 2 * 4),
+            "The second shard should hold the 2x2 frame");
+        UESYNTH_TEST_EQUAL(FileManager.FileSize(*FPaths::Combine(Directory, TEXT("index-00000.bin"))),
+            int64(2 * FUESynthRecordings::IndexRecordSize), "Every frame should be indexed");
+
+        FString Manifest;
+        UESYNTH_TEST_TRUE(FFileHelper::LoadFileToString(Manifest, *FPaths::Combine(Directory, FUESynthRecordings::ManifestName)),
+            "The manifest should be written");
+        UESYNTH_TEST_TRUE(Manifest.Contains(TEXT("\"complete\": true")), "The manifest should be final");
+
+        uesynth::RecordingStats Again;
+        UESYNTH_TEST_FALSE(ServiceImpl->StartRecordingOnGameThread(Request, &Again).ok(),
+            "A directory that holds a recording should be refused");
     }
 
+    IFileManager::Get().DeleteDirectory(*TestRoot, false, true);
     return true;
 }
\ No newline at end of file
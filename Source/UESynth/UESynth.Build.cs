@@ -34,6 +34,7 @@ public class UESynth : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"ApplicationCore",
 				"Slate",
 				"SlateCore",
 				"ToolMenus",
@@ -41,6 +42,12 @@ public class UESynth : ModuleRules
 				"EditorWidgets",
 				"UnrealEd",
 				"LevelEditor",
+				"RHI",
+				"RenderCore",
+				"Renderer",
+				"ImageWrapper",
+				"HTTPServer",
+				"Json",
 				"TurboLinkGrpc"
 			}
 		);
@@ -2,23 +2,28 @@
 """
 Quick UESynth Server Status Check
 Fast check to see if the server is running and ready.
+
+Asks GetHealth, which the server answers without waiting for the game thread,
+so it also works against a stalled or busy instance. For the slower end-to-end
+check of camera and capture calls, run test_server_health.py.
 """
 
-import asyncio
 import sys
 from pathlib import Path
 
+import grpc
+
 # Add current directory to path for imports
 sys.path.insert(0, str(Path(__file__).parent))
 
-from test_server_health import ServerHealthChecker
+from uesynth import UESynthClient
 
 
-async def quick_check():
+def quick_check():
     """Quick server status check."""
     print("⚡ Quick UESynth Server Check")
     print("=" * 30)
-    
+
     # Allow custom server address
     server_address = "172.27.224.1:50051"  # Default for WSL
     if len(sys.argv) > 1:
@@ -29,48 +34,40 @@ async def quick_check():
             return 0
         else:
             server_address = sys.argv[1]
-    
+
     print(f"Server: {server_address}")
-    
-    checker = ServerHealthChecker(server_address)
-    
-    # Just test connection and basic functionality
-    print("\n🔌 Testing connection...")
-    if not await checker.check_connection():
-        print("\n❌ Server not reachable")
+
+    print("\n🔌 Asking for the server's health...")
+    client = UESynthClient(server_address)
+    try:
+        health = client.get_health(timeout=5.0)
+    except grpc.RpcError as e:
+        print(f"\n❌ Server not reachable: {e.code().name}")
         print("💡 Make sure:")
         print("   • Unreal Engine is running")
         print("   • UESynth plugin is loaded")
-        print("   • gRPC server is active on port 50051")
+        print("   • gRPC server is active on the port given (50051 by default)")
         return 1
-    
-    print("\n📷 Testing camera operations...")
-    camera_ok = await checker.check_camera_operations()
-    
-    print("\n🎯 Testing capture readiness...")
-    capture_ok = await checker.check_capture_readiness()
-    
-    # Cleanup
-    if checker.client:
-        await checker.client.disconnect()
-    
+    finally:
+        client.disconnect()
+
     # Quick summary
     print(f"\n📋 Quick Status:")
-    print(f"   Connection:  {'✓' if True else '❌'}")
-    print(f"   Camera Ops:  {'✓' if camera_ok else '❌'}")
-    print(f"   Capture:     {'✓' if capture_ok else '❌'}")
-    
-    if camera_ok and capture_ok:
+    print(f"   Listening:   {health.listen_address or server_address}")
+    print(f"   World:       {health.world_name or '❌ none'}")
+    print(f"   FPS:         {health.fps:.1f}{' (lockstep)' if health.lockstep else ''}")
+    print(f"   Queue depth: {health.command_queue_depth}")
+    print(f"   In flight:   {health.calls_in_flight} calls, {health.open_streams} streams")
+
+    if health.ready:
         print("\n🎉 Server is ready for all operations!")
         return 0
-    elif camera_ok:
-        print("\n💡 Server ready for camera ops, enter Play mode for capture")
-        return 0
     else:
-        print("\n⚠ Server needs setup - load a level and enter Play mode")
+        print(f"\n⚠ Server not ready: {health.not_ready_reason}")
+        print("💡 Load a level and enter Play mode")
         return 1
 
 
 if __name__ == "__main__":
-    exit_code = asyncio.run(quick_check())
+    exit_code = quick_check()
     sys.exit(exit_code)
\ No newline at end of file
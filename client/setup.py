@@ -3,12 +3,22 @@
 
 """Setup script for the UESynth Python client library."""
 
-from setuptools import find_packages, setup
+from setuptools import Extension, find_packages, setup
+
+# Decodes images into FramePool buffers without the GIL; the client works
+# without it when no C compiler or zlib headers are around
+speedups = Extension(
+    "uesynth._speedups",
+    sources=["uesynth/_speedups.c"],
+    libraries=["z"],
+    optional=True,
+)
 
 setup(
     name="uesynth",
     version="0.1.0",
     packages=find_packages(),
+    ext_modules=[speedups],
     install_requires=[
         "grpcio",
         "grpcio-tools",
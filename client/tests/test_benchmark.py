@@ -0,0 +1,119 @@
+# Copyright (c) 2025 UESynth Project
+# SPDX-License-Identifier: MIT
+
+"""Tests for the UESynth benchmark suite."""
+
+from typing import Any
+from unittest.mock import Mock
+
+import pytest
+
+from uesynth import benchmark, uesynth_pb2
+
+
+def _report(results: list[dict[str, Any]]) -> dict[str, Any]:
+    return {"schema_version": benchmark.SCHEMA_VERSION, "results": results}
+
+
+class TestBenchmark:
+    """Test cases for the benchmark helpers."""
+
+    def test_latency_stats(self) -> None:
+        """Test that latencies are summarized in milliseconds."""
+        stats = benchmark.latency_stats([0.001 * value for value in range(1, 101)])
+
+        assert stats["p50_ms"] == pytest.approx(50.5)
+        assert stats["p99_ms"] == pytest.approx(99.01)
+        assert stats["min_ms"] == pytest.approx(1.0)
+        assert stats["max_ms"] == pytest.approx(100.0)
+
+    def test_compare_flags_regressions(self) -> None:
+        """Test that only metrics worse than the tolerance are reported."""
+        params = {"batch_size": 100}
+        baseline = _report(
+            [
+                {
+                    "benchmark": "transforms",
+                    "params": params,
+                    "metrics": {"p50_ms": 1.0, "transforms_per_second": 1000.0},
+                },
+                {"benchmark": "capture", "params": {}, "skipped": "no cameras"},
+            ]
+        )
+        current = _report(
+            [
+                {
+                    "benchmark": "transforms",
+                    "params": params,
+                    "metrics": {"p50_ms": 1.05, "transforms_per_second": 800.0},
+                },
+                {
+                    "benchmark": "capture",
+                    "params": {},
+                    "metrics": {"frames_per_second": 1.0},
+                },
+            ]
+        )
+
+        regressions = benchmark.compare(baseline, current, tolerance=0.1)
+
+        assert len(regressions) == 1
+        assert "transforms_per_second" in regressions[0]
+        assert benchmark.compare(baseline, current, tolerance=0.25) == []
+
+    def test_compare_rejects_other_schema(self) -> None:
+        """Test that baselines of another schema version are refused."""
+        with pytest.raises(ValueError):
+            benchmark.compare({"schema_version": 0, "results": []}, _report([]), 0.1)
+
+    def test_transforms_write_back_current_transforms(self) -> None:
+        """Test that the transform sweep cycles the scene and leaves it unchanged."""
+        stub = Mock()
+        stub.ListObjects.return_value = uesynth_pb2.ListObjectsResponse(
+            object_ids=[7, 8]
+        )
+        packed = bytes(range(36)) * 3
+        stub.GetObjectTransformsBatch.return_value = (
+            uesynth_pb2.GetObjectTransformsBatchResponse(packed_transforms=packed)
+        )
+
+        results = benchmark.benchmark_transforms(stub, [3], iterations=4, warmup=1)
+
+        stub.GetObjectTransformsBatch.assert_called_once_with(
+            uesynth_pb2.GetObjectTransformsBatchRequest(object_ids=[7, 8, 7])
+        )
+        request = stub.SetObjectTransformsBatch.call_args.args[0]
+        assert list(request.object_ids) == [7, 8, 7]
+        assert request.packed_transforms == packed
+        assert stub.SetObjectTransformsBatch.call_count == 5
+        assert results[0]["params"] == {"batch_size": 3}
+        assert results[0]["metrics"]["transforms_per_second"] > 0
+
+    def test_transforms_skipped_without_objects(self) -> None:
+        """Test that an empty scene is recorded as skipped instead of failing."""
+        stub = Mock()
+        stub.ListObjects.return_value = uesynth_pb2.ListObjectsResponse()
+
+        results = benchmark.benchmark_transforms(stub, [1], iterations=1, warmup=0)
+
+        assert "skipped" in results[0]
+        stub.SetObjectTransformsBatch.assert_not_called()
+
+    def test_capture_skips_camera_only_modalities(self) -> None:
+        """Test that pooled cameras aren't asked for modalities they can't render."""
+        stub = Mock()
+        stream = Mock()
+
+        results = benchmark.benchmark_capture(
+            stub,
+            stream,
+            [(640, 480)],
+            [("rgb", "segmentation")],
+            [2],
+            iterations=1,
+            warmup=0,
+        )
+
+        assert "skipped" in results[0]
+        stub.CreateCamera.assert_not_called()
+        stream.call.assert_not_called()
@@ -4,9 +4,27 @@
 """Tests for UESynth client."""
 
 import asyncio
+import json
+import zlib
 from unittest.mock import AsyncMock, Mock, patch
 
-from uesynth import AsyncUESynthClient, UESynthClient
+import cv2
+import grpc.aio
+import numpy as np
+import pytest
+
+from uesynth import (
+    CHANNEL_OPTIONS,
+    AsyncUESynthClient,
+    Recording,
+    SceneState,
+    UESynthClient,
+    UESynthPool,
+    read_registrations,
+    uesynth_pb2,
+    unpack_scene_state,
+    unpack_transforms,
+)
 
 
 class TestUESynthClient:
@@ -23,7 +41,7 @@ class TestUESynthClient:
 
         client = UESynthClient("test:1234")
 
-        mock_channel.assert_called_once_with("test:1234")
+        mock_channel.assert_called_once_with("test:1234", options=CHANNEL_OPTIONS)
         mock_stub_class.assert_called_once_with(mock_channel_instance)
         assert client.channel == mock_channel_instance
         assert client.stub == mock_stub_instance
@@ -48,7 +66,9 @@ class TestUESynthClient:
     def test_default_address(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
         """Test client uses default address."""
         UESynthClient()
-        mock_channel.assert_called_once_with("localhost:50051")
+        mock_channel.assert_called_once_with(
+            "localhost:50051", options=CHANNEL_OPTIONS
+        )
 
     @patch("uesynth.grpc.insecure_channel")
     @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
@@ -78,6 +98,32 @@ class TestUESynthClient:
 
         mock_stub_instance.GetCameraTransform.assert_called_once()
 
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_camera_lifecycle(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
+        """Test pooled camera create, resize and destroy requests."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        client = UESynthClient()
+        client.camera.create("rig_front", x=100, width=640, height=480)
+        request = mock_stub_instance.CreateCamera.call_args[0][0]
+        assert request.camera_name == "rig_front"
+        assert request.initial_transform.location.x == 100
+        assert (request.width, request.height) == (640, 480)
+
+        client.camera.set_resolution("rig_front", width=320)
+        request = mock_stub_instance.SetResolution.call_args[0][0]
+        assert (request.camera_name, request.width, request.height) == (
+            "rig_front",
+            320,
+            0,
+        )
+
+        client.camera.destroy("rig_front")
+        request = mock_stub_instance.DestroyCamera.call_args[0][0]
+        assert request.camera_name == "rig_front"
+
     @patch("uesynth.grpc.insecure_channel")
     @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
     def test_capture_rgb(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
@@ -88,6 +134,7 @@ class TestUESynthClient:
         # Mock the response
         mock_response = Mock()
         mock_response.image_data = b"\x00" * (100 * 100 * 3)  # 100x100 RGB image
+        mock_response.format = "rgb"
         mock_response.height = 100
         mock_response.width = 100
         mock_stub_instance.CaptureRgbImage.return_value = mock_response
@@ -98,6 +145,484 @@ class TestUESynthClient:
         mock_stub_instance.CaptureRgbImage.assert_called_once()
         assert image.shape == (100, 100, 3)
 
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_capture_rgb_pixel_format(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test RGB capture requests the asked-for pixel format."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        mock_response = Mock()
+        mock_response.image_data = b"\x00" * (100 * 100)  # 100x100 gray image
+        mock_response.format = "gray"
+        mock_response.height = 100
+        mock_response.width = 100
+        mock_stub_instance.CaptureRgbImage.return_value = mock_response
+
+        client = UESynthClient()
+        image = client.capture.rgb(pixel_format="gray")
+
+        request = mock_stub_instance.CaptureRgbImage.call_args[0][0]
+        assert request.pixel_format == uesynth_pb2.PIXEL_FORMAT_GRAY8
+        assert image.shape == (100, 100, 1)
+
+        with pytest.raises(ValueError):
+            client.capture.rgb(pixel_format="yuv")
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_capture_multi(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
+        """Test multi-modal capture sends the mask and decodes what came back."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        # The server had no segmentation to give, so it only reports rgb and depth
+        response = uesynth_pb2.MultiImageResponse(
+            modalities=uesynth_pb2.CAPTURE_MODALITY_RGB
+            | uesynth_pb2.CAPTURE_MODALITY_DEPTH
+        )
+        response.rgb.image_data = b"\x00" * (4 * 2 * 3)
+        response.rgb.width = 4
+        response.rgb.height = 2
+        response.rgb.format = "rgb"
+        response.depth.image_data = np.full((2, 4), 150.0, dtype="<f4").tobytes()
+        response.depth.width = 4
+        response.depth.height = 2
+        response.depth.format = "depth_f32"
+        mock_stub_instance.CaptureMulti.return_value = response
+
+        client = UESynthClient()
+        images = client.capture.multi(
+            modalities=("rgb", "depth", "segmentation"), pixel_format="rgb"
+        )
+
+        request = mock_stub_instance.CaptureMulti.call_args[0][0]
+        assert request.modalities == (
+            uesynth_pb2.CAPTURE_MODALITY_RGB
+            | uesynth_pb2.CAPTURE_MODALITY_DEPTH
+            | uesynth_pb2.CAPTURE_MODALITY_SEGMENTATION
+        )
+        assert request.pixel_format == uesynth_pb2.PIXEL_FORMAT_RGB8
+        assert sorted(images) == ["depth", "rgb"]
+        assert images["rgb"].shape == (2, 4, 3)
+        assert images["depth"].dtype == np.float32
+        assert images["depth"].shape == (2, 4)
+        assert images["depth"][0, 0] == 150.0
+
+        with pytest.raises(ValueError):
+            client.capture.multi(modalities=())
+        with pytest.raises(ValueError):
+            client.capture.multi(modalities=("thermal",))
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_step(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
+        """Test a step sends its actions and capture in one call."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        response = uesynth_pb2.StepResponse(frame_number=7)
+        response.results.add(request_id="move").command_response.success = True
+        response.images.modalities = uesynth_pb2.CAPTURE_MODALITY_RGB
+        response.images.rgb.image_data = b"\x00" * (4 * 2 * 3)
+        response.images.rgb.width = 4
+        response.images.rgb.height = 2
+        response.images.rgb.format = "rgb"
+        mock_stub_instance.Step.return_value = response
+
+        move = uesynth_pb2.ActionRequest(request_id="move")
+        move.set_object_transform.object_name = "Cube"
+        client = UESynthClient()
+        result, images = client.step(
+            [move], modalities=("rgb",), pixel_format="rgb", delta_seconds=1 / 60
+        )
+
+        request = mock_stub_instance.Step.call_args[0][0]
+        assert [action.request_id for action in request.actions] == ["move"]
+        assert request.capture.modalities == uesynth_pb2.CAPTURE_MODALITY_RGB
+        assert request.delta_seconds == pytest.approx(1 / 60)
+        assert not request.continue_on_error
+        assert result.frame_number == 7
+        assert images["rgb"].shape == (2, 4, 3)
+
+        # Without modalities nothing is captured
+        mock_stub_instance.Step.return_value = uesynth_pb2.StepResponse()
+        _, images = client.step([move])
+        assert not mock_stub_instance.Step.call_args[0][0].HasField("capture")
+        assert images == {}
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_set_lockstep(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
+        """Test lockstep is toggled with its delta and idle timeout."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+        mock_stub_instance.SetLockstep.return_value = uesynth_pb2.LockstepState(
+            enabled=True, fixed_delta_seconds=0.05
+        )
+
+        client = UESynthClient()
+        state = client.set_lockstep(True, fixed_delta_seconds=0.05, idle_timeout_ms=500)
+
+        request = mock_stub_instance.SetLockstep.call_args[0][0]
+        assert request.enabled
+        assert request.fixed_delta_seconds == pytest.approx(0.05)
+        assert request.idle_timeout_ms == 500
+        assert state.enabled
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_get_server_stats(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
+        """Test server stats are fetched, and reset only when asked."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+        mock_stub_instance.GetServerStats.return_value = uesynth_pb2.ServerStats(
+            rpcs=[uesynth_pb2.LatencyHistogram(name="Step", count=3)],
+            command_queue_depth=2,
+        )
+
+        client = UESynthClient()
+        stats = client.get_server_stats()
+        client.get_server_stats(reset=True)
+
+        requests = [call[0][0] for call in mock_stub_instance.GetServerStats.call_args_list]
+        assert [request.reset for request in requests] == [False, True]
+        assert stats.rpcs[0].name == "Step"
+        assert stats.command_queue_depth == 2
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_get_health(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
+        """Test the health is asked for with the given timeout."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+        mock_stub_instance.GetHealth.return_value = uesynth_pb2.HealthStatus(
+            ready=True, fps=60.0, command_queue_depth=3
+        )
+
+        client = UESynthClient()
+        health = client.get_health(timeout=2.0)
+
+        assert mock_stub_instance.GetHealth.call_args[1]["timeout"] == 2.0
+        assert health.ready
+        assert health.command_queue_depth == 3
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_recording(
+        self, mock_stub_class: Mock, mock_channel: Mock, tmp_path
+    ) -> None:
+        """Test recordings are started and stopped, and their shards map back."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+        mock_stub_instance.StartRecording.return_value = (
+            uesynth_pb2.RecordingStats(recording_id="run", directory=str(tmp_path))
+        )
+        mock_stub_instance.StopRecording.return_value = uesynth_pb2.RecordingStats(
+            recording_id="run", frames_written=3, shards=1
+        )
+
+        client = UESynthClient()
+        started = client.start_recording(
+            "run", modalities=("rgb", "depth"), every_n_frames=2, frames_per_shard=500
+        )
+        client.step([], modalities=("rgb",), recording_id="run")
+        stopped = client.stop_recording("run")
+
+        request = mock_stub_instance.StartRecording.call_args[0][0]
+        assert request.recording_id == "run"
+        assert request.subscription.capture.modalities == (
+            uesynth_pb2.CAPTURE_MODALITY_RGB | uesynth_pb2.CAPTURE_MODALITY_DEPTH
+        )
+        assert request.subscription.every_n_frames == 2
+        assert request.frames_per_shard == 500
+        assert mock_stub_instance.Step.call_args[0][0].recording_id == "run"
+        assert mock_stub_instance.StopRecording.call_args[0][0].recording_id == "run"
+        assert started.directory == str(tmp_path)
+        assert stopped.frames_written == 3
+
+        # A shard as the server writes it: three 2x4 RGBA frames, one half written
+        fields = [
+            ("sequence", "<u8", 1),
+            ("frame_number", "<u8", 1),
+            ("world_time_seconds", "<f8", 1),
+            ("location", "<f4", 3),
+            ("rotation", "<f4", 3),
+            ("modalities", "<u4", 1),
+            ("segmentation_revision", "<u4", 1),
+            ("dropped_frames", "<u8", 1),
+        ]
+        record = np.dtype([(n, t, (c,) if c > 1 else ()) for n, t, c in fields])
+        index = np.zeros(3, dtype=record)
+        index["frame_number"] = [10, 12, 14]
+        index["location"][:, 0] = 100.0
+        index.tofile(tmp_path / "index-00000.bin")
+        pixels = np.arange(3 * 2 * 4 * 4, dtype=np.uint8).reshape(3, 2, 4, 4)
+        with open(tmp_path / "rgb-00000.bin", "wb") as file:
+            file.write(pixels[:2].tobytes() + pixels[2].tobytes()[:5])
+        manifest = {
+            "recording_id": "run",
+            "complete": False,
+            "index_record_size": 64,
+            "index_fields": [{"name": n, "dtype": t, "count": c} for n, t, c in fields],
+            "shards": [
+                {
+                    "index": 0,
+                    "frames": 1,
+                    "index_file": "index-00000.bin",
+                    "tensors": {
+                        "rgb": {
+                            "file": "rgb-00000.bin",
+                            "format": "rgba",
+                            "dtype": "|u1",
+                            "shape": [2, 4, 4],
+                            "frame_bytes": 32,
+                        }
+                    },
+                }
+            ],
+        }
+        (tmp_path / "recording.json").write_text(json.dumps(manifest))
+        entry = {"segmentation_id": 1, "object_name": "Cube", "object_id": 7}
+        (tmp_path / "segmentation-3.json").write_text(
+            json.dumps({"revision": 3, "entries": [entry]})
+        )
+
+        recording = Recording(str(tmp_path))
+        shard = recording.shards[0]
+        assert not recording.complete
+        assert len(recording) == 2
+        assert shard.tensors["rgb"].shape == (2, 2, 4, 4)
+        np.testing.assert_array_equal(shard.tensors["rgb"], pixels[:2])
+        assert list(shard.index["frame_number"]) == [10, 12]
+        assert shard.index["location"][1, 0] == pytest.approx(100.0)
+        assert shard.formats["rgb"] == "rgba"
+        assert recording.segmentation_table(3) == {1: "Cube"}
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_capture_depth_uint16(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test quantized depth is read as uint16 and dequantized with its range."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        quantized = np.array([[0, 65535], [13107, 32768]], dtype="<u2")
+        mock_stub_instance.CaptureDepthMap.return_value = uesynth_pb2.ImageResponse(
+            image_data=quantized.tobytes(),
+            width=2,
+            height=2,
+            format="depth_u16:near=10,far=5000",
+        )
+
+        client = UESynthClient()
+        depth = client.capture.depth(encoding="uint16", near=10.0, far=5000.0)
+
+        request = mock_stub_instance.CaptureDepthMap.call_args[0][0]
+        assert request.depth_encoding == uesynth_pb2.DEPTH_ENCODING_UINT16
+        assert request.depth_near == 10.0
+        assert request.depth_far == 5000.0
+        assert depth.dtype == np.uint16
+        assert depth.shape == (2, 2)
+
+        depth_cm = client.capture.depth(
+            encoding="uint16", near=10.0, far=5000.0, dequantize=True
+        )
+        assert depth_cm.dtype == np.float32
+        assert depth_cm[0, 0] == pytest.approx(10.0)
+        assert depth_cm[0, 1] == pytest.approx(5000.0)
+        assert depth_cm[1, 0] == pytest.approx(1008.0, abs=0.1)
+
+        with pytest.raises(ValueError):
+            client.capture.depth(encoding="png")
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_capture_optical_flow(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test optical flow decodes as two float16 channels per pixel."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        flow = np.array(
+            [[[1.5, -2.0], [0.0, 0.25]], [[-8.0, 4.0], [0.5, 0.0]]], dtype="<f2"
+        )
+        mock_stub_instance.CaptureOpticalFlow.return_value = uesynth_pb2.ImageResponse(
+            image_data=flow.tobytes(), width=2, height=2, format="flow_f16"
+        )
+
+        client = UESynthClient()
+        decoded = client.capture.optical_flow(width=2, height=2)
+
+        request = mock_stub_instance.CaptureOpticalFlow.call_args[0][0]
+        assert (request.width, request.height) == (2, 2)
+        assert decoded.dtype == np.float16
+        assert decoded.shape == (2, 2, 2)
+        np.testing.assert_array_equal(decoded, flow)
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_capture_region(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
+        """Test a region and output size are sent for the server to scale."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        rgb = np.zeros((224, 224, 3), dtype=np.uint8)
+        mock_stub_instance.CaptureRgbImage.return_value = uesynth_pb2.ImageResponse(
+            image_data=rgb.tobytes(), width=224, height=224, format="rgb"
+        )
+
+        client = UESynthClient()
+        image = client.capture.rgb(
+            pixel_format="rgb", roi=(100, 50, 448, 448), output_size=(224, 224)
+        )
+
+        request = mock_stub_instance.CaptureRgbImage.call_args[0][0]
+        assert request.HasField("roi")
+        assert (request.roi.x, request.roi.y) == (100, 50)
+        assert (request.roi.width, request.roi.height) == (448, 448)
+        assert (request.output_width, request.output_height) == (224, 224)
+        assert image.shape == (224, 224, 3)
+
+        depth = np.zeros((2, 2), dtype="<f4")
+        mock_stub_instance.CaptureDepthMap.return_value = uesynth_pb2.ImageResponse(
+            image_data=depth.tobytes(), width=2, height=2, format="depth_f32"
+        )
+        client.capture.depth(width=2, height=2)
+        request = mock_stub_instance.CaptureDepthMap.call_args[0][0]
+        assert not request.HasField("roi")
+        assert request.output_width == 0
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_capture_compressed(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test compressed images are requested by codec and decoded on receipt."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        depth = np.arange(6, dtype="<f4").reshape(2, 3)
+        mock_stub_instance.CaptureDepthMap.return_value = uesynth_pb2.ImageResponse(
+            image_data=zlib.compress(depth.tobytes()),
+            width=3,
+            height=2,
+            format="depth_f32",
+            codec=uesynth_pb2.IMAGE_CODEC_ZLIB,
+            raw_size=depth.nbytes,
+        )
+
+        client = UESynthClient()
+        decoded = client.capture.depth(codec="zlib")
+
+        request = mock_stub_instance.CaptureDepthMap.call_args[0][0]
+        assert request.codec == uesynth_pb2.IMAGE_CODEC_ZLIB
+        np.testing.assert_array_equal(decoded, depth)
+
+        rgb = np.zeros((2, 3, 3), dtype=np.uint8)
+        rgb[..., 0] = 255
+        _, png = cv2.imencode(".png", cv2.cvtColor(rgb, cv2.COLOR_RGB2BGR))
+        mock_stub_instance.CaptureRgbImage.return_value = uesynth_pb2.ImageResponse(
+            image_data=png.tobytes(),
+            width=3,
+            height=2,
+            format="rgb",
+            codec=uesynth_pb2.IMAGE_CODEC_PNG,
+            raw_size=rgb.nbytes,
+        )
+
+        image = client.capture.rgb(pixel_format="rgb", codec="png")
+
+        request = mock_stub_instance.CaptureRgbImage.call_args[0][0]
+        assert request.codec == uesynth_pb2.IMAGE_CODEC_PNG
+        np.testing.assert_array_equal(image, rgb)
+
+        with pytest.raises(ValueError):
+            client.capture.rgb(codec="zstd")
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_capture_cameras(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
+        """Test a batched camera capture collects one response per camera."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        def frame(camera_name: str, width: int) -> uesynth_pb2.FrameResponse:
+            response = uesynth_pb2.FrameResponse(request_id="batch")
+            reply = response.multi_image_response
+            reply.camera_name = camera_name
+            reply.modalities = uesynth_pb2.CAPTURE_MODALITY_RGB
+            reply.rgb.image_data = b"\x00" * (width * 2 * 4)
+            reply.rgb.width = width
+            reply.rgb.height = 2
+            reply.rgb.format = "rgba"
+            return response
+
+        # Responses arrive in readback order, not request order
+        mock_stub_instance.ControlStream.return_value = iter(
+            [frame("rig_right", 8), frame("rig_left", 4)]
+        )
+
+        client = UESynthClient()
+        images = client.capture.cameras(["rig_left", "rig_right"])
+
+        (action,) = list(mock_stub_instance.ControlStream.call_args[0][0])
+        assert list(action.capture_cameras.camera_names) == ["rig_left", "rig_right"]
+        assert action.capture_cameras.modalities == uesynth_pb2.CAPTURE_MODALITY_RGB
+        assert sorted(images) == ["rig_left", "rig_right"]
+        assert images["rig_left"]["rgb"].shape == (2, 4, 4)
+        assert images["rig_right"]["rgb"].shape == (2, 8, 4)
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_capture_segmentation_table(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test segmentation IDs decode as uint8 and the table outlives omission."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        ids = np.array([[0, 1], [2, 1]], dtype=np.uint8)
+        first = uesynth_pb2.ImageResponse(
+            image_data=ids.tobytes(),
+            width=2,
+            height=2,
+            format="instance_u8",
+            segmentation_revision=3,
+            segmentation_table=[
+                uesynth_pb2.SegmentationEntry(
+                    segmentation_id=1, object_name="Chair", object_id=7
+                ),
+                uesynth_pb2.SegmentationEntry(
+                    segmentation_id=2, object_name="Table", object_id=9
+                ),
+            ],
+        )
+        # Same revision again: the server leaves the table out
+        second = uesynth_pb2.ImageResponse(
+            image_data=ids.tobytes(),
+            width=2,
+            height=2,
+            format="instance_u8",
+            segmentation_revision=3,
+        )
+        mock_stub_instance.CaptureSegmentationMask.side_effect = [first, second]
+
+        client = UESynthClient()
+        mask = client.capture.segmentation()
+        assert mask.dtype == np.uint8
+        assert mask.shape == (2, 2)
+        assert client.capture.segmentation_table == {1: "Chair", 2: "Table"}
+
+        client.capture.segmentation()
+        request = mock_stub_instance.CaptureSegmentationMask.call_args[0][0]
+        assert request.segmentation_revision == 3
+        assert client.capture.segmentation_table == {1: "Chair", 2: "Table"}
+
     @patch("uesynth.grpc.insecure_channel")
     @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
     def test_objects_set_location(
@@ -113,6 +638,358 @@ class TestUESynthClient:
         mock_stub_instance.SetObjectTransform.assert_called_once()
 
 
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_list_all_with_filters(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test objects list forwards filters and returns names."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+        mock_stub_instance.ListObjects.return_value = Mock(
+            object_names=["Car_01", "Car_02"]
+        )
+
+        client = UESynthClient()
+        names = client.objects.list_all(tag="vehicle", class_name="StaticMeshActor")
+
+        assert names == ["Car_01", "Car_02"]
+        request = mock_stub_instance.ListObjects.call_args[0][0]
+        assert request.tag == "vehicle"
+        assert request.class_name == "StaticMeshActor"
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_set_transforms_batch_packs_ids(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test batched transforms are packed as 9 float32 per object."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        transforms = np.arange(18, dtype=np.float32).reshape(2, 9)
+        client = UESynthClient()
+        client.objects.set_transforms_batch([7, 9], transforms)
+
+        request = mock_stub_instance.SetObjectTransformsBatch.call_args[0][0]
+        assert list(request.object_ids) == [7, 9]
+        assert len(request.object_names) == 0
+        assert np.array_equal(unpack_transforms(request.packed_transforms), transforms)
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_set_transforms_batch_rejects_bad_shape(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test a transform array that doesn't match the object count is rejected."""
+        client = UESynthClient()
+        with pytest.raises(ValueError):
+            client.objects.set_transforms_batch(["A", "B"], np.zeros((3, 9)))
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_get_transforms_batch_unpacks(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test batched transform reads come back as an (N, 9) array."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+        expected = np.ones((3, 9), dtype=np.float32)
+        mock_stub_instance.GetObjectTransformsBatch.return_value = Mock(
+            packed_transforms=expected.tobytes()
+        )
+
+        client = UESynthClient()
+        transforms = client.objects.get_transforms_batch(["A", "B", "C"])
+
+        request = mock_stub_instance.GetObjectTransformsBatch.call_args[0][0]
+        assert list(request.object_names) == ["A", "B", "C"]
+        assert transforms.shape == (3, 9)
+        assert np.array_equal(transforms, expected)
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_get_scene_snapshot(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test scene snapshots are asked for with the sequence and fields given."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        client = UESynthClient()
+        client.objects.get_scene_snapshot(
+            since_sequence=42, velocities=True, tag="vehicle", names=True
+        )
+
+        request = mock_stub_instance.GetSceneSnapshot.call_args[0][0]
+        assert request.since_sequence == 42
+        assert request.include_velocities and not request.include_visibility
+        assert request.tag == "vehicle" and request.include_names
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_preload_then_spawn_resident(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test preloads wait when asked and spawns can refuse to load."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        client = UESynthClient()
+        client.objects.preload_assets(["/Game/SM_Crate.SM_Crate"], wait=True)
+        client.objects.spawn(
+            "Crate_01", "/Game/SM_Crate.SM_Crate", wait_for_asset=False
+        )
+
+        preload = mock_stub_instance.PreloadAssets.call_args[0][0]
+        assert list(preload.asset_paths) == ["/Game/SM_Crate.SM_Crate"]
+        assert preload.wait
+        spawn = mock_stub_instance.SpawnObject.call_args[0][0]
+        assert spawn.if_not_resident == uesynth_pb2.ASSET_MISS_POLICY_FAIL
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_pooled_spawn(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test pooled spawns are flagged and the pool can be limited."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        client = UESynthClient()
+        client.objects.configure_pool(max_parked_per_asset=8)
+        client.objects.spawn("Crate_01", "/Game/SM_Crate.SM_Crate", pooled=True)
+
+        pool = mock_stub_instance.ConfigureActorPool.call_args[0][0]
+        assert pool.max_parked_per_asset == 8
+        assert not pool.clear
+        assert mock_stub_instance.SpawnObject.call_args[0][0].pooled
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_set_material(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test material values become typed parameters, by name or by ID."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        client = UESynthClient()
+        client.objects.set_material(
+            "Cube_1",
+            {"Roughness": 0.25, "Tint": (1.0, 0.0, 0.5), 7: "/Game/T_Noise.T_Noise"},
+        )
+        request = mock_stub_instance.SetMaterial.call_args[0][0]
+        assert request.object_name == "Cube_1"
+        roughness, tint, noise = request.parameters
+        assert roughness.name == "Roughness" and roughness.scalar == 0.25
+        assert tint.vector.b == 0.5 and tint.vector.a == 1.0
+        assert noise.id == 7 and noise.texture == "/Game/T_Noise.T_Noise"
+
+        client.objects.set_materials_batch({42: {"Tint": (0, 1, 0, 1)}})
+        batch = mock_stub_instance.SetMaterialsBatch.call_args[0][0]
+        assert batch.objects[0].object_id == 42
+
+        with pytest.raises(ValueError):
+            client.objects.set_material("Cube_1", {"Tint": (1.0, 0.0)})
+
+    @patch("uesynth.grpc.insecure_channel")
+    @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
+    def test_objects_set_lights_batch(
+        self, mock_stub_class: Mock, mock_channel: Mock
+    ) -> None:
+        """Test lighting updates carry only the values given."""
+        mock_stub_instance = Mock()
+        mock_stub_class.return_value = mock_stub_instance
+
+        client = UESynthClient()
+        client.objects.set_lights_batch(
+            {
+                "PointLight_1": {"intensity": 0.0},
+                7: {"color": (1.0, 0.5, 0.0), "location": (0.0, 0.0, 300.0)},
+            }
+        )
+
+        first, second = mock_stub_instance.SetLightingBatch.call_args[0][0].lights
+        assert first.light_name == "PointLight_1"
+        assert first.HasField("intensity") and first.intensity == 0.0
+        assert not first.HasField("color") and not first.HasField("transform")
+        assert second.object_id == 7 and not second.HasField("intensity")
+        assert second.color.y == 0.5 and second.transform.location.z == 300.0
+        assert not second.transform.HasField("rotation")
+
+
+def _scene_snapshot(
+    ids: list[int], rows: np.ndarray, sequence: int, full: bool, **fields: object
+) -> uesynth_pb2.SceneSnapshot:
+    """A snapshot of rows, one per object, packed into planes as the server does."""
+    rows = np.asarray(rows, dtype="<f4").reshape(len(ids), -1)
+    return uesynth_pb2.SceneSnapshot(
+        sequence=sequence,
+        full=full,
+        object_ids=ids,
+        packed_state=rows.T.tobytes(),
+        num_fields=rows.shape[1],
+        **fields,
+    )
+
+
+class TestSceneState:
+    """Test cases for scene snapshots and SceneState."""
+
+    def test_unpack_scene_state_reads_planes(self) -> None:
+        """Test each field comes back as a column of the planes."""
+        rows = np.arange(26, dtype=np.float32).reshape(2, 13)
+        rows[:, 12] = [1, 0]
+        state = unpack_scene_state(_scene_snapshot([3, 5], rows, 1, True))
+
+        assert list(state["ids"]) == [3, 5]
+        assert np.array_equal(state["location"], rows[:, 0:3])
+        assert np.array_equal(state["scale"], rows[:, 6:9])
+        assert np.array_equal(state["velocity"], rows[:, 9:12])
+        assert list(state["visible"]) == [True, False]
+
+    def test_unpack_scene_state_visibility_without_velocity(self) -> None:
+        """Test a tenth plane is visibility, not the start of velocity."""
+        rows = np.zeros((1, 10), dtype=np.float32)
+        rows[0, 9] = 1
+        state = unpack_scene_state(_scene_snapshot([3], rows, 1, True))
+
+        assert "velocity" not in state
+        assert list(state["visible"]) == [True]
+
+    def test_apply_full_then_diff(self) -> None:
+        """Test diffs replace changed objects, add new ones and drop removed ones."""
+        scene = SceneState()
+        scene.apply(
+            _scene_snapshot(
+                [1, 2, 3], np.ones((3, 9)), 10, True, object_names=["A", "B", "C"]
+            )
+        )
+        assert len(scene) == 3 and scene.sequence == 10
+
+        changed = np.full((2, 9), 7.0)
+        scene.apply(
+            _scene_snapshot(
+                [2, 4], changed, 12, False, object_names=["B", "D"], removed_ids=[3]
+            )
+        )
+
+        assert scene.sequence == 12
+        assert sorted(scene.ids) == [1, 2, 4]
+        order = list(scene.ids)
+        assert np.all(scene.field("location")[order.index(2)] == 7.0)
+        assert np.all(scene.field("location")[order.index(1)] == 1.0)
+        assert scene.names == {1: "A", 2: "B", 4: "D"}
+
+    def test_apply_full_replaces_everything(self) -> None:
+        """Test a full snapshot drops objects the copy had that it doesn't list."""
+        scene = SceneState()
+        scene.apply(_scene_snapshot([1, 2], np.ones((2, 9)), 5, True))
+        scene.apply(_scene_snapshot([9], np.zeros((1, 12)), 6, True))
+
+        assert list(scene.ids) == [9]
+        assert scene.field("velocity").shape == (1, 3)
+        with pytest.raises(KeyError):
+            scene.field("visible")
+
+    def test_apply_rejects_diff_with_other_fields(self) -> None:
+        """Test a diff that can't be merged row by row is refused."""
+        scene = SceneState()
+        scene.apply(_scene_snapshot([1], np.ones((1, 9)), 5, True))
+        with pytest.raises(ValueError):
+            scene.apply(_scene_snapshot([1], np.ones((1, 13)), 6, False))
+
+
+class TestUESynthPool:
+    """Test cases for UESynthPool."""
+
+    @staticmethod
+    def _stubs(health: dict[str, uesynth_pb2.HealthStatus | Exception]) -> tuple:
+        """Channel and stub factories whose stubs answer with health[address]."""
+
+        def make_channel(address: str, options: object = None) -> Mock:
+            channel = Mock()
+            channel.address = address
+            return channel
+
+        def make_stub(channel: Mock) -> Mock:
+            stub = Mock()
+            answer = health[channel.address]
+            if isinstance(answer, Exception):
+                stub.GetHealth.side_effect = answer
+            else:
+                stub.GetHealth.return_value = answer
+            return stub
+
+        return make_channel, make_stub
+
+    def test_episodes_go_to_the_least_loaded_ready_instance(self) -> None:
+        """Test queued work and running episodes both count as load."""
+        health = {
+            "a:1": uesynth_pb2.HealthStatus(ready=True, command_queue_depth=2),
+            "b:2": uesynth_pb2.HealthStatus(ready=True, calls_in_flight=1),
+            "c:3": uesynth_pb2.HealthStatus(ready=False, not_ready_reason="No world"),
+            "d:4": grpc.RpcError(),
+        }
+        make_channel, make_stub = self._stubs(health)
+        with (
+            patch("uesynth.grpc.insecure_channel", side_effect=make_channel),
+            patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub", side_effect=make_stub),
+        ):
+            pool = UESynthPool(list(health), health_interval=60.0)
+            assert pool.refresh()["d:4"] is None
+
+            picked = []
+            with pool.episode() as client:
+                # b's call in flight weighs less than a's 2 queued commands
+                assert client is pool.clients["b:2"]
+                picked.append(pool.acquire()[0])
+                picked.append(pool.acquire()[0])
+            after, _ = pool.acquire()
+
+        # With the episode, b ties with a; each episode after that adds to one
+        assert picked == ["a:1", "b:2"]
+        assert after == "b:2"
+
+    def test_no_ready_instance(self) -> None:
+        """Test acquiring fails when nothing is ready."""
+        health = {"a:1": uesynth_pb2.HealthStatus(ready=False)}
+        make_channel, make_stub = self._stubs(health)
+        with (
+            patch("uesynth.grpc.insecure_channel", side_effect=make_channel),
+            patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub", side_effect=make_stub),
+        ):
+            pool = UESynthPool(["a:1"])
+            with pytest.raises(RuntimeError):
+                pool.acquire()
+
+    def test_registrations(self, tmp_path) -> None:
+        """Test instances are found through their registration files."""
+        (tmp_path / "uesynth-11.json").write_text(
+            json.dumps({"address": "127.0.0.1:50051", "pid": 11})
+        )
+        (tmp_path / "uesynth-12.json.tmp").write_text("{")
+        (tmp_path / "other.json").write_text("{}")
+        assert read_registrations(str(tmp_path)) == [
+            {"address": "127.0.0.1:50051", "pid": 11}
+        ]
+
+        health = {"127.0.0.1:50051": uesynth_pb2.HealthStatus(ready=True)}
+        make_channel, make_stub = self._stubs(health)
+        with (
+            patch("uesynth.grpc.insecure_channel", side_effect=make_channel),
+            patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub", side_effect=make_stub),
+        ):
+            pool = UESynthPool(registration_dir=str(tmp_path))
+            assert list(pool.clients) == ["127.0.0.1:50051"]
+
+            # An instance that unregistered is dropped once it is idle
+            (tmp_path / "uesynth-11.json").unlink()
+            pool.refresh()
+            assert pool.clients == {}
+
+
 class TestAsyncUESynthClient:
     """Test cases for AsyncUESynthClient class."""
 
@@ -148,12 +1025,71 @@ class TestAsyncUESynthClient:
         ) as mock_start_streaming:
             await client.connect()
 
-        mock_channel.assert_called_once_with("test:1234")
+        mock_channel.assert_called_once_with("test:1234", options=CHANNEL_OPTIONS)
         mock_stub_class.assert_called_once_with(mock_channel_instance)
         mock_start_streaming.assert_called_once()
         assert client.channel == mock_channel_instance
         assert client.stub == mock_stub_instance
 
+    async def test_start_streaming_sends_in_flight_window(self) -> None:
+        """Test the in-flight window is passed to ControlStream as metadata."""
+        client = AsyncUESynthClient("test:1234", max_in_flight=8)
+        client.stub = Mock()
+
+        with patch("uesynth.asyncio.create_task"), patch(
+            "uesynth.asyncio.sleep", new_callable=AsyncMock
+        ):
+            await client._start_streaming()
+
+        client.stub.ControlStream.assert_called_once_with(
+            metadata=(("uesynth-max-in-flight", "8"),)
+        )
+
+    async def test_start_streaming_sends_write_queue_options(self) -> None:
+        """Test the write queue depth and policy are passed as metadata."""
+        client = AsyncUESynthClient(
+            "test:1234", write_queue_depth=4, write_queue_policy="drop_oldest"
+        )
+        client.stub = Mock()
+
+        with patch("uesynth.asyncio.create_task"), patch(
+            "uesynth.asyncio.sleep", new_callable=AsyncMock
+        ):
+            await client._start_streaming()
+
+        client.stub.ControlStream.assert_called_once_with(
+            metadata=(
+                ("uesynth-max-in-flight", "1"),
+                ("uesynth-write-queue-depth", "4"),
+                ("uesynth-write-queue-policy", "drop_oldest"),
+            )
+        )
+
+    async def test_start_streaming_sends_session(self) -> None:
+        """Test the session and its level are passed as metadata."""
+        client = AsyncUESynthClient(
+            "test:1234", session="worker-3", session_level="/Game/Maps/Lab"
+        )
+        client.stub = Mock()
+
+        with patch("uesynth.asyncio.create_task"), patch(
+            "uesynth.asyncio.sleep", new_callable=AsyncMock
+        ):
+            await client._start_streaming()
+
+        client.stub.ControlStream.assert_called_once_with(
+            metadata=(
+                ("uesynth-max-in-flight", "1"),
+                ("uesynth-session", "worker-3"),
+                ("uesynth-session-level", "/Game/Maps/Lab"),
+            )
+        )
+
+    def test_unknown_write_queue_policy(self) -> None:
+        """Test an unknown write queue policy is rejected up front."""
+        with pytest.raises(ValueError):
+            AsyncUESynthClient("test:1234", write_queue_policy="drop_all")
+
     @patch("uesynth.grpc.aio.insecure_channel")
     @patch("uesynth.uesynth_pb2_grpc.UESynthServiceStub")
     async def test_disconnect(self, mock_stub_class: Mock, mock_channel: Mock) -> None:
@@ -273,6 +1209,7 @@ class TestAsyncUESynthClient:
         # Mock the response
         mock_response = Mock()
         mock_response.image_data = b"\x00" * (100 * 100 * 3)  # 100x100 RGB image
+        mock_response.format = "rgb"
         mock_response.height = 100
         mock_response.width = 100
         mock_stub_instance.CaptureRgbImage.return_value = mock_response
@@ -342,11 +1279,11 @@ class TestAsyncUESynthClient:
     async def test_get_latest_frame_with_frame(self) -> None:
         """Test get latest frame when frame is available."""
         client = AsyncUESynthClient()
-        client.lock = asyncio.Lock()
 
         # Mock image response
         mock_image_response = Mock()
         mock_image_response.image_data = b"\x00" * (50 * 50 * 3)  # 50x50 RGB image
+        mock_image_response.format = "rgb"
         mock_image_response.height = 50
         mock_image_response.width = 50
 
@@ -357,6 +1294,241 @@ class TestAsyncUESynthClient:
         assert frame is not None
         assert frame.shape == (50, 50, 3)
 
+    async def test_subscribe_until_unsubscribed(self) -> None:
+        """Test pushed frames reach the callback and get_latest_frame."""
+        client = AsyncUESynthClient()
+        client.request_queue = asyncio.Queue()
+        received = []
+
+        subscription_id = await client.capture.subscribe(
+            rate_hz=30.0, callback=received.append
+        )
+        action = client.request_queue.get_nowait()
+        assert action.subscribe.rate_hz == 30.0
+        assert action.subscribe.capture.modalities == uesynth_pb2.CAPTURE_MODALITY_RGB
+
+        ack = uesynth_pb2.FrameResponse(
+            request_id=subscription_id,
+            command_response=uesynth_pb2.CommandResponse(success=True),
+        )
+        frame = uesynth_pb2.FrameResponse(request_id=subscription_id)
+        frame.subscription_frame.sequence = 1
+        images = frame.subscription_frame.images
+        images.modalities = uesynth_pb2.CAPTURE_MODALITY_RGB
+        images.rgb.image_data = b"\x00" * (2 * 2 * 4)
+        images.rgb.width = 2
+        images.rgb.height = 2
+        images.rgb.format = "rgba"
+
+        # The handler outlives any fixed number of responses
+        client.stream = Mock()
+        client.stream.read = AsyncMock(side_effect=[ack, frame, frame, grpc.aio.EOF])
+        client.running = True
+        await client._response_handler()
+
+        assert len(received) == 3
+        image = await client.get_latest_frame()
+        assert image.shape == (2, 2, 4)
+
+        await client.capture.unsubscribe(subscription_id)
+        assert subscription_id not in client.pending
+        action = client.request_queue.get_nowait()
+        assert action.unsubscribe.subscription_id == subscription_id
+
+    async def test_actions_are_awaitable(self) -> None:
+        """Test actions resolve with their answers and hold a window slot until then."""
+        client = AsyncUESynthClient(max_pending=2, action_timeout=None)
+        client.request_queue = asyncio.Queue()
+
+        single = await client.get_stream_stats()
+        cameras = await client.capture.cameras(["a", "b"])
+        assert single == "1"
+        assert cameras == "2"
+        blocked = asyncio.create_task(client.get_stream_stats())
+        await asyncio.sleep(0)
+        assert not blocked.done()
+
+        stats = uesynth_pb2.FrameResponse(request_id=single)
+        stats.stream_stats.queue_depth = 3
+        first = uesynth_pb2.FrameResponse(request_id=cameras)
+        first.multi_image_response.camera_name = "a"
+        second = uesynth_pb2.FrameResponse(request_id=cameras)
+        second.multi_image_response.camera_name = "b"
+        client.stream = Mock()
+        client.stream.read = AsyncMock(
+            side_effect=[stats, first, second, grpc.aio.EOF]
+        )
+        client.running = True
+        await client._response_handler()
+
+        assert (await single).stream_stats.queue_depth == 3
+        answers = await cameras
+        assert [answer.multi_image_response.camera_name for answer in answers] == [
+            "a",
+            "b",
+        ]
+        # The third action gets a freed slot, and fails once the stream closes
+        third = await asyncio.wait_for(blocked, 1.0)
+        assert third == "3"
+        client.stream.read = AsyncMock(side_effect=[grpc.aio.EOF])
+        client.running = True
+        await client._response_handler()
+        with pytest.raises(ConnectionError):
+            await third
+        assert not client.pending
+
+    async def test_unanswered_actions_time_out(self) -> None:
+        """Test an unanswered action fails and frees its slot after action_timeout."""
+        client = AsyncUESynthClient(max_pending=1, action_timeout=0.01)
+        client.request_queue = asyncio.Queue()
+
+        request_id = await client.objects.set_location("missing", 1.0, 2.0, 3.0)
+        with pytest.raises(TimeoutError):
+            await request_id
+
+        await asyncio.wait_for(client.objects.set_location("cube", 0, 0, 0), 1.0)
+        assert request_id not in client.pending
+
+    async def test_next_frame_in_order(self) -> None:
+        """Test queued frames come out in order into pooled arrays, oldest dropped."""
+        client = AsyncUESynthClient(frame_pool_slots=2, frame_queue_size=2)
+
+        def make_frame(value: int) -> uesynth_pb2.FrameResponse:
+            frame = uesynth_pb2.FrameResponse(request_id="capture")
+            frame.image_response.image_data = bytes([value]) * (2 * 2 * 3)
+            frame.image_response.width = 2
+            frame.image_response.height = 2
+            frame.image_response.format = "rgb"
+            return frame
+
+        client.stream = Mock()
+        client.stream.read = AsyncMock(
+            side_effect=[make_frame(1), make_frame(2), make_frame(3), grpc.aio.EOF]
+        )
+        client.running = True
+        await client._response_handler()
+
+        assert client.dropped_frames == 1
+        second = await client.next_frame()
+        third = await client.next_frame()
+        assert second.shape == (2, 2, 3)
+        assert second[0, 0, 0] == 2
+        assert third[0, 0, 0] == 3
+        assert not np.shares_memory(second, third)
+
+    async def test_subscribe_delta_frames(self) -> None:
+        """Test delta frames are rebuilt into whole images from their tiles."""
+        client = AsyncUESynthClient()
+        client.request_queue = asyncio.Queue()
+        received = []
+
+        subscription_id = await client.capture.subscribe(
+            modalities=("segmentation",),
+            data_codec="zlib",
+            delta_tile_size=16,
+            callback=received.append,
+        )
+        action = client.request_queue.get_nowait()
+        assert action.subscribe.delta_tile_size == 16
+        assert action.subscribe.capture.data_codec == uesynth_pb2.IMAGE_CODEC_ZLIB
+
+        # 24x20 IDs in 16 pixel tiles; the bottom right tile is clipped to 8x4
+        ids = np.zeros((20, 24), dtype=np.uint8)
+
+        def make_frame(sequence: int) -> uesynth_pb2.FrameResponse:
+            frame = uesynth_pb2.FrameResponse(request_id=subscription_id)
+            frame.subscription_frame.sequence = sequence
+            images = frame.subscription_frame.images
+            images.modalities = uesynth_pb2.CAPTURE_MODALITY_SEGMENTATION
+            images.segmentation.width = 24
+            images.segmentation.height = 20
+            images.segmentation.format = "instance_u8"
+            images.segmentation.codec = uesynth_pb2.IMAGE_CODEC_ZLIB
+            return frame
+
+        keyframe = make_frame(1)
+        keyframe.subscription_frame.images.segmentation.image_data = zlib.compress(
+            ids.tobytes()
+        )
+        delta = make_frame(2)
+        tile = np.full((4, 8), 7, dtype=np.uint8)
+        segmentation = delta.subscription_frame.images.segmentation
+        segmentation.image_data = zlib.compress(tile.tobytes())
+        segmentation.delta.tile_size = 16
+        segmentation.delta.changed_tiles.append(3)
+        segmentation.delta.base_sequence = 1
+        # A delta against a frame the client never got
+        orphan = make_frame(4)
+        orphan.subscription_frame.images.segmentation.delta.base_sequence = 3
+
+        client.stream = Mock()
+        client.stream.read = AsyncMock(
+            side_effect=[keyframe, delta, orphan, grpc.aio.EOF]
+        )
+        client.running = True
+        await client._response_handler()
+
+        rebuilt = received[1].subscription_frame.images.segmentation
+        assert rebuilt.codec == uesynth_pb2.IMAGE_CODEC_RAW
+        assert not rebuilt.HasField("delta")
+        ids[16:, 16:] = 7
+        assert rebuilt.image_data == ids.tobytes()
+        assert not received[2].subscription_frame.images.modalities
+
+    async def test_shared_memory_images(self) -> None:
+        """Test images sent through shared memory decode from the mapped slots."""
+        from multiprocessing import shared_memory
+
+        client = AsyncUESynthClient()
+        client.request_queue = asyncio.Queue()
+        received = []
+
+        await client.open_shared_memory(slot_count=2, callback=received.append)
+        action = client.request_queue.get_nowait()
+        assert action.open_shared_memory.slot_count == 2
+
+        # The server's layout: a 64 byte header of sequence and size per slot
+        pixels = np.arange(12, dtype=np.uint8).reshape(2, 2, 3)
+        region = shared_memory.SharedMemory(create=True, size=2 * 128)
+        region.buf[128 : 128 + 16] = np.array([5, 12], dtype="<i8").tobytes()
+        region.buf[128 + 64 : 128 + 64 + 12] = pixels.tobytes()
+
+        opened = uesynth_pb2.FrameResponse(request_id=action.request_id)
+        opened.shared_memory.name = region.name
+        opened.shared_memory.slot_count = 2
+        opened.shared_memory.slot_size = 128
+        opened.shared_memory.header_size = 64
+        frame = uesynth_pb2.FrameResponse(request_id="capture")
+        frame.image_response.width = 2
+        frame.image_response.height = 2
+        frame.image_response.format = "rgb"
+        frame.image_response.shared_memory.slot = 1
+        frame.image_response.shared_memory.sequence = 5
+        frame.image_response.shared_memory.size = 12
+
+        client.stream = Mock()
+        client.stream.read = AsyncMock(side_effect=[opened, frame, grpc.aio.EOF])
+        client.running = True
+        try:
+            await client._response_handler()
+            assert client.shared_memory is not None
+
+            assert received[0].shared_memory.name == region.name
+            image = await client.get_latest_frame()
+            assert np.array_equal(image, pixels)
+            del image
+
+            # The server reusing the slot invalidates the reference
+            region.buf[128 : 128 + 8] = np.array([7], dtype="<i8").tobytes()
+            slot = frame.image_response.shared_memory
+            assert not client.shared_memory.is_current(slot)
+            with pytest.raises(ValueError):
+                client.decode_image(frame.image_response)
+        finally:
+            await client.disconnect()
+            region.close()
+            region.unlink()
+
 
 class TestCameraComponents:
     """Test cases for Camera component classes."""
@@ -4,9 +4,16 @@
 """UESynth Python client library for communicating with Unreal Engine via gRPC."""
 
 import asyncio
+import contextlib
+import itertools
+import json
+import os
+import struct
+import threading
 import time
 import uuid
-from collections.abc import Callable
+import zlib
+from collections.abc import Callable, Iterator, Mapping, Sequence
 from typing import Any, Dict, Optional
 
 import cv2
@@ -16,31 +23,1012 @@ import numpy as np
 
 from uesynth import uesynth_pb2, uesynth_pb2_grpc
 
+try:
+    from uesynth import _speedups
+except ImportError:  # Not built; FramePool decodes with numpy and zlib instead
+    _speedups = None
+
+# Floats per object in the batched transform format:
+# location x, y, z, rotation pitch, yaw, roll, scale x, y, z
+PACKED_TRANSFORM_FLOATS = 9
+
+
+def _batch_targets(objects: Sequence[str | int]) -> dict[str, list[Any]]:
+    """Address a batch by registry IDs when every entry is an int, else by name."""
+    if objects and all(isinstance(obj, int) for obj in objects):
+        return {"object_ids": list(objects)}
+    return {"object_names": [str(obj) for obj in objects]}
+
+
+def _pack_transforms(transforms: np.ndarray, count: int) -> bytes:
+    """Pack an (N, 9) array of transforms into the little-endian float32 wire format."""
+    packed = np.ascontiguousarray(transforms, dtype="<f4")
+    if packed.shape != (count, PACKED_TRANSFORM_FLOATS):
+        raise ValueError(
+            f"transforms must have shape ({count}, {PACKED_TRANSFORM_FLOATS}), "
+            f"got {packed.shape}"
+        )
+    return packed.tobytes()
+
+
+# A material parameter value: a scalar, an RGB or RGBA color, or the object
+# path of a loaded texture
+MaterialValue = float | Sequence[float] | str
+
+
+def _material_request(
+    obj: str | int, parameters: Mapping[str | int, MaterialValue]
+) -> uesynth_pb2.SetMaterialRequest:
+    """Build a material update from parameter names or IDs to values."""
+    request = uesynth_pb2.SetMaterialRequest()
+    if isinstance(obj, int):
+        request.object_id = obj
+    else:
+        request.object_name = obj
+    for key, value in parameters.items():
+        parameter = request.parameters.add()
+        if isinstance(key, int):
+            parameter.id = key
+        else:
+            parameter.name = key
+        if isinstance(value, str):
+            parameter.texture = value
+        elif isinstance(value, (int, float)):
+            parameter.scalar = value
+        else:
+            color = [float(c) for c in value]
+            if len(color) not in (3, 4):
+                raise ValueError(f"Colors of {key!r} need 3 or 4 channels")
+            parameter.vector.r, parameter.vector.g, parameter.vector.b = color[:3]
+            parameter.vector.a = color[3] if len(color) == 4 else 1.0
+    return request
+
+
+def _lighting_request(
+    light: str | int,
+    intensity: float | None = None,
+    color: Sequence[float] | None = None,
+    location: Sequence[float] | None = None,
+    rotation: Sequence[float] | None = None,
+) -> uesynth_pb2.SetLightingRequest:
+    """Build a lighting update that changes only the values given."""
+    request = uesynth_pb2.SetLightingRequest()
+    if isinstance(light, int):
+        request.object_id = light
+    else:
+        request.light_name = light
+    if intensity is not None:
+        request.intensity = intensity
+    if color is not None:
+        request.color.x, request.color.y, request.color.z = color
+    if location is not None:
+        loc = request.transform.location
+        loc.x, loc.y, loc.z = location
+    if rotation is not None:
+        rot = request.transform.rotation
+        rot.pitch, rot.yaw, rot.roll = rotation
+    return request
+
+
+# Capture pixel layouts by the name ImageResponse.format reports them under
+PIXEL_FORMATS = {
+    "rgba": uesynth_pb2.PIXEL_FORMAT_RGBA8,
+    "rgb": uesynth_pb2.PIXEL_FORMAT_RGB8,
+    "bgr": uesynth_pb2.PIXEL_FORMAT_BGR8,
+    "gray": uesynth_pb2.PIXEL_FORMAT_GRAY8,
+}
+
+
+def _pixel_format(name: str) -> int:
+    """Resolve a pixel format name to its wire value."""
+    try:
+        return PIXEL_FORMATS[name]
+    except KeyError:
+        raise ValueError(
+            f"pixel_format must be one of {sorted(PIXEL_FORMATS)}, got {name!r}"
+        ) from None
+
+
+# A 4K RGBA frame alone is 33 MB, far past gRPC's default 4 MB receive limit
+CHANNEL_OPTIONS = [("grpc.max_receive_message_length", -1)]
+
+# Multi-modal capture outputs, each named after its MultiImageResponse field
+CAPTURE_MODALITIES = {
+    "rgb": uesynth_pb2.CAPTURE_MODALITY_RGB,
+    "depth": uesynth_pb2.CAPTURE_MODALITY_DEPTH,
+    "segmentation": uesynth_pb2.CAPTURE_MODALITY_SEGMENTATION,
+    "normals": uesynth_pb2.CAPTURE_MODALITY_NORMALS,
+    "optical_flow": uesynth_pb2.CAPTURE_MODALITY_OPTICAL_FLOW,
+}
+
+
+def _capture_region(
+    roi: tuple[int, int, int, int] | None, output_size: tuple[int, int] | None
+) -> dict[str, Any]:
+    """Capture request fields that read roi of the view, scaled to output_size.
+
+    Args:
+        roi: (x, y, width, height) in view pixels; a zero width or height
+            reaches to the view's edge
+        output_size: (width, height) to scale the region to on the server's
+            GPU, so only those pixels are read back and sent; a zero in either
+            keeps the region's aspect ratio
+    """
+    fields: dict[str, Any] = {}
+    if roi is not None:
+        x, y, width, height = roi
+        fields["roi"] = uesynth_pb2.CaptureRegion(
+            x=x, y=y, width=width, height=height
+        )
+    if output_size is not None:
+        fields["output_width"], fields["output_height"] = output_size
+    return fields
+
+
+def _modality_mask(modalities: Sequence[str]) -> int:
+    """Combine modality names into the CaptureModality bitmask."""
+    mask = 0
+    for name in modalities:
+        try:
+            mask |= CAPTURE_MODALITIES[name]
+        except KeyError:
+            raise ValueError(
+                f"modalities must be drawn from {sorted(CAPTURE_MODALITIES)}, "
+                f"got {name!r}"
+            ) from None
+    if not mask:
+        raise ValueError("at least one modality is required")
+    return mask
+
+
+# Depth encodings by name
+DEPTH_ENCODINGS = {
+    "float32": uesynth_pb2.DEPTH_ENCODING_FLOAT32,
+    "float16": uesynth_pb2.DEPTH_ENCODING_FLOAT16,
+    "uint16": uesynth_pb2.DEPTH_ENCODING_UINT16,
+}
+# Single-channel formats, and the dtype each one's payload is read as
+_SCALAR_DTYPES = {
+    "depth_f32": "<f4",
+    "depth_f16": "<f2",
+    "depth_u16": "<u2",
+    "instance_u8": "u1",
+}
+# Two-channel formats, and the dtype of each channel
+_VECTOR_DTYPES = {
+    "flow_f16": "<f2",
+}
+
+
+def _depth_encoding(name: str) -> int:
+    """Resolve a depth encoding name to its wire value."""
+    try:
+        return DEPTH_ENCODINGS[name]
+    except KeyError:
+        raise ValueError(
+            f"encoding must be one of {sorted(DEPTH_ENCODINGS)}, got {name!r}"
+        ) from None
+
+
+# Image codecs by name; JPEG and PNG only apply to color images
+IMAGE_CODECS = {
+    "raw": uesynth_pb2.IMAGE_CODEC_RAW,
+    "jpeg": uesynth_pb2.IMAGE_CODEC_JPEG,
+    "png": uesynth_pb2.IMAGE_CODEC_PNG,
+    "lz4": uesynth_pb2.IMAGE_CODEC_LZ4,
+    "zlib": uesynth_pb2.IMAGE_CODEC_ZLIB,
+}
+
+
+def _image_codec(name: str) -> int:
+    """Resolve an image codec name to its wire value."""
+    try:
+        return IMAGE_CODECS[name]
+    except KeyError:
+        raise ValueError(
+            f"codec must be one of {sorted(IMAGE_CODECS)}, got {name!r}"
+        ) from None
+
+
+def _asset_miss_policy(wait_for_asset: bool) -> int:
+    """What a spawn does when its asset isn't resident yet."""
+    if wait_for_asset:
+        return uesynth_pb2.ASSET_MISS_POLICY_WAIT
+    return uesynth_pb2.ASSET_MISS_POLICY_FAIL
+
+
+class SharedMemoryRing:
+    """A stream's shared-memory image ring, mapped into this process.
+
+    Images read from it are views of the mapping, not copies. Each one stays
+    valid until the server has written slot_count more images; is_current()
+    tells whether it still is.
+    """
+
+    def __init__(self, info: uesynth_pb2.SharedMemoryInfo) -> None:
+        """Map the region info names; it must be on this host."""
+        from multiprocessing import resource_tracker, shared_memory
+
+        name = f"Global\\{info.name}" if os.name == "nt" else info.name
+        try:
+            self._memory = shared_memory.SharedMemory(name=name, track=False)
+        except TypeError:
+            # Before Python 3.13; the server owns the region, so keep this
+            # process from unlinking it at exit
+            self._memory = shared_memory.SharedMemory(name=name)
+            if os.name != "nt":
+                resource_tracker.unregister(self._memory._name, "shared_memory")
+        self.slot_count = info.slot_count
+        self.slot_size = info.slot_size
+        self.header_size = info.header_size
+
+    def is_current(self, ref: uesynth_pb2.SharedMemorySlot) -> bool:
+        """Whether ref's slot still holds the image it was written with."""
+        offset = ref.slot * self.slot_size
+        (sequence,) = struct.unpack_from("<q", self._memory.buf, offset)
+        return sequence == ref.sequence
+
+    def view(self, ref: uesynth_pb2.SharedMemorySlot) -> memoryview:
+        """The payload ref points at, without copying it."""
+        if ref.slot >= self.slot_count or not self.is_current(ref):
+            raise ValueError(
+                f"shared-memory slot {ref.slot} no longer holds image "
+                f"{ref.sequence}; copy images held past slot_count more"
+            )
+        start = ref.slot * self.slot_size + self.header_size
+        return self._memory.buf[start : start + ref.size]
+
+    def close(self) -> None:
+        """Unmap the region, unless arrays still view it."""
+        try:
+            self._memory.close()
+        except BufferError:
+            pass
+
+
+def _image_bytes(
+    response: uesynth_pb2.ImageResponse, ring: SharedMemoryRing | None
+) -> bytes | memoryview:
+    """An image's payload, from the stream's shared memory if it went there."""
+    if ring is None or not response.HasField("shared_memory"):
+        return response.image_data
+    return ring.view(response.shared_memory)
+
+
+def _unpack_image_data(
+    response: uesynth_pb2.ImageResponse, ring: SharedMemoryRing | None = None
+) -> bytes | memoryview:
+    """The raw pixel bytes of an image sent raw, as LZ4 or as zlib."""
+    data = _image_bytes(response, ring)
+    if response.codec == uesynth_pb2.IMAGE_CODEC_ZLIB:
+        return zlib.decompress(data)
+    if response.codec == uesynth_pb2.IMAGE_CODEC_LZ4:
+        try:
+            import lz4.block
+        except ImportError:
+            raise ImportError(
+                "LZ4 images need the lz4 package: pip install lz4"
+            ) from None
+        return lz4.block.decompress(data, uncompressed_size=response.raw_size)
+    return data
+
+
+def _decode_file(
+    response: uesynth_pb2.ImageResponse, ring: SharedMemoryRing | None = None
+) -> np.ndarray:
+    """Decode a JPEG or PNG image into the channel order its format names.
+
+    JPEG has no alpha channel, so an "rgba" capture sent as JPEG comes back RGB.
+    """
+    image = cv2.imdecode(
+        np.frombuffer(_image_bytes(response, ring), dtype=np.uint8),
+        cv2.IMREAD_UNCHANGED,
+    )
+    if image is None:
+        raise ValueError(f"could not decode {response.format!r} image")
+    if image.ndim == 2:
+        return image[:, :, np.newaxis]
+    if response.format == "bgr":
+        return image[:, :, :3]
+    if response.format == "rgba" and image.shape[2] == 4:
+        return cv2.cvtColor(image, cv2.COLOR_BGRA2RGBA)
+    return cv2.cvtColor(image[:, :, :3], cv2.COLOR_BGR2RGB)
+
+
+def _decode_image(
+    response: uesynth_pb2.ImageResponse, ring: SharedMemoryRing | None = None
+) -> np.ndarray:
+    """Decode an ImageResponse, without copying the payload if it was sent raw.
+
+    Depth and segmentation are (height, width) in the dtype their format names,
+    optical flow is (height, width, 2) float16; everything else is uint8
+    (height, width, channels). Raw images sent through ring come back as views
+    of the shared memory.
+    """
+    if response.codec in (uesynth_pb2.IMAGE_CODEC_JPEG, uesynth_pb2.IMAGE_CODEC_PNG):
+        return _decode_file(response, ring)
+    data = _unpack_image_data(response, ring)
+    dtype = _SCALAR_DTYPES.get(response.format.split(":", 1)[0])
+    if dtype is not None:
+        return np.frombuffer(data, dtype=dtype).reshape(response.height, response.width)
+    dtype = _VECTOR_DTYPES.get(response.format)
+    if dtype is not None:
+        return np.frombuffer(data, dtype=dtype).reshape(
+            response.height, response.width, 2
+        )
+    return np.frombuffer(data, dtype=np.uint8).reshape(
+        response.height, response.width, -1
+    )
+
+
+def _raw_image_layout(
+    response: uesynth_pb2.ImageResponse, size: int
+) -> tuple[tuple[int, ...], str]:
+    """The shape and dtype of an image's unpacked pixels, size bytes of them."""
+    dtype = _SCALAR_DTYPES.get(response.format.split(":", 1)[0])
+    if dtype is not None:
+        return (response.height, response.width), dtype
+    dtype = _VECTOR_DTYPES.get(response.format)
+    if dtype is not None:
+        return (response.height, response.width, 2), dtype
+    pixels = response.height * response.width
+    if not pixels or size % pixels:
+        raise ValueError(
+            f"{size} bytes isn't a {response.width}x{response.height} image"
+        )
+    return (response.height, response.width, size // pixels), "u1"
+
+
+class FramePool:
+    """Preallocated arrays that raw, LZ4 and zlib images are decoded into.
+
+    Arrays are kept per shape and dtype and handed out in turn, so decoding a
+    stream of same-sized frames allocates nothing after the first few. An
+    array is overwritten once slots more images of its shape and dtype have
+    been decoded; copy what you keep longer. With the optional _speedups
+    extension built, payloads are copied and inflated without holding the GIL
+    and without an intermediate bytes object. JPEG and PNG images are decoded
+    by OpenCV into new arrays, as before.
+    """
+
+    def __init__(self, slots: int = 4) -> None:
+        """Initialize an empty pool.
+
+        Args:
+            slots: Arrays kept per shape and dtype
+        """
+        if slots < 1:
+            raise ValueError(f"slots must be at least 1, got {slots}")
+        self.slots = slots
+        self._arrays: dict[tuple[tuple[int, ...], str], list[np.ndarray]] = {}
+        self._next: dict[tuple[tuple[int, ...], str], int] = {}
+
+    def acquire(self, shape: tuple[int, ...], dtype: str) -> np.ndarray:
+        """The next array of the given shape and dtype, allocated on first use."""
+        key = (shape, dtype)
+        arrays = self._arrays.get(key)
+        if arrays is None:
+            arrays = [np.empty(shape, dtype=dtype) for _ in range(self.slots)]
+            self._arrays[key] = arrays
+            self._next[key] = 0
+        index = self._next[key]
+        self._next[key] = (index + 1) % self.slots
+        return arrays[index]
+
+    def decode(
+        self,
+        response: uesynth_pb2.ImageResponse,
+        ring: SharedMemoryRing | None = None,
+    ) -> np.ndarray:
+        """Decode an image into one of the pool's arrays.
+
+        Args:
+            response: The image, e.g. response.image_response
+            ring: The stream's shared memory, for images sent through it
+
+        Returns:
+            An array shaped as decode_image() would return it
+        """
+        if response.codec in (
+            uesynth_pb2.IMAGE_CODEC_JPEG,
+            uesynth_pb2.IMAGE_CODEC_PNG,
+        ):
+            return _decode_file(response, ring)
+        data = _image_bytes(response, ring)
+        if response.codec == uesynth_pb2.IMAGE_CODEC_RAW:
+            shape, dtype = _raw_image_layout(response, len(data))
+            out = self.acquire(shape, dtype)
+            if _speedups is not None:
+                _speedups.copy_into(out, data)
+            else:
+                np.copyto(out, np.frombuffer(data, dtype=dtype).reshape(shape))
+            return out
+        shape, dtype = _raw_image_layout(response, response.raw_size)
+        out = self.acquire(shape, dtype)
+        if response.codec == uesynth_pb2.IMAGE_CODEC_ZLIB and _speedups is not None:
+            _speedups.inflate_into(out, data)
+            return out
+        unpacked = _unpack_image_data(response, ring)
+        np.copyto(out, np.frombuffer(unpacked, dtype=dtype).reshape(shape))
+        return out
+
+
+def dequantize_depth(depth: np.ndarray, image_format: str) -> np.ndarray:
+    """Convert a depth capture to float32 cm, whatever encoding it was sent in.
+
+    Args:
+        depth: The array a depth capture returned
+        image_format: The ImageResponse.format it came with,
+            e.g. "depth_u16:near=0,far=6553.5"
+    """
+    kind, _, params = image_format.partition(":")
+    if kind != "depth_u16":
+        return depth.astype(np.float32, copy=False)
+    scale = dict(param.split("=", 1) for param in params.split(","))
+    near, far = float(scale["near"]), float(scale["far"])
+    return near + depth.astype(np.float32) * np.float32((far - near) / 65535.0)
+
+
+def _decode_multi(response: uesynth_pb2.MultiImageResponse) -> dict[str, np.ndarray]:
+    """Decode the modalities a MultiImageResponse actually carries."""
+    return {
+        name: _decode_image(getattr(response, name))
+        for name, bit in CAPTURE_MODALITIES.items()
+        if response.modalities & bit
+    }
+
+
+def _step_request(
+    actions: Sequence[uesynth_pb2.ActionRequest],
+    modalities: Sequence[str],
+    camera_name: str,
+    width: int,
+    height: int,
+    pixel_format: str,
+    segmentation_revision: int,
+    delta_seconds: float,
+    continue_on_error: bool,
+    recording_id: str = "",
+) -> uesynth_pb2.StepRequest:
+    """Build a StepRequest; no modalities means no capture."""
+    request = uesynth_pb2.StepRequest(
+        actions=actions,
+        delta_seconds=delta_seconds,
+        continue_on_error=continue_on_error,
+        recording_id=recording_id,
+    )
+    if modalities:
+        request.capture.CopyFrom(
+            uesynth_pb2.CaptureMultiRequest(
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                modalities=_modality_mask(modalities),
+                pixel_format=_pixel_format(pixel_format),
+                segmentation_revision=segmentation_revision,
+            )
+        )
+    return request
+
+
+class SegmentationTable(dict[int, str]):
+    """Segmentation ID -> object name, as of the server revision it came with.
+
+    The server only resends the table when its revision changes, so each client
+    keeps one and sends its revision back with every segmentation capture.
+    """
+
+    revision: int = 0
+
+    def update_from(self, response: uesynth_pb2.ImageResponse) -> None:
+        """Replace the table if response carries a newer revision of it."""
+        revision = response.segmentation_revision
+        if revision == 0 or revision == self.revision:
+            return
+        self.clear()
+        for entry in response.segmentation_table:
+            self[entry.segmentation_id] = entry.object_name
+        self.revision = revision
+
+
+class DeltaFrames:
+    """Rebuilds the whole images of delta subscriptions from their changed tiles.
+
+    Keeps the last whole image of every subscription and modality, and applies
+    each delta to it in place. A delta for a frame the client never saw can't be
+    applied; that image is left out of the frame until the next keyframe.
+    """
+
+    def __init__(self) -> None:
+        """Start with no images."""
+        # (subscription ID, modality) -> (sequence, (height, width * bpp) pixels)
+        self._images: dict[tuple[str, str], tuple[int, np.ndarray]] = {}
+
+    def apply(
+        self,
+        subscription_id: str,
+        frame: uesynth_pb2.SubscriptionFrame,
+        ring: SharedMemoryRing | None = None,
+    ) -> None:
+        """Turn frame's delta images into whole raw ones, in place."""
+        images = frame.images
+        for name, bit in CAPTURE_MODALITIES.items():
+            if not images.modalities & bit:
+                continue
+            image = getattr(images, name)
+            key = (subscription_id, name)
+            if not image.HasField("delta"):
+                pixels = np.frombuffer(_unpack_image_data(image, ring), dtype=np.uint8)
+                self._images[key] = (
+                    frame.sequence,
+                    pixels.reshape(image.height, -1).copy(),
+                )
+                continue
+
+            base = self._images.get(key)
+            if base is None or base[0] != image.delta.base_sequence:
+                self._images.pop(key, None)
+                images.modalities &= ~bit
+                images.ClearField(name)
+                continue
+            pixels = base[1]
+            self._apply_tiles(image, pixels, ring)
+            self._images[key] = (frame.sequence, pixels)
+            image.image_data = pixels.tobytes()
+            image.codec = uesynth_pb2.IMAGE_CODEC_RAW
+            image.raw_size = 0
+            image.ClearField("delta")
+            image.ClearField("shared_memory")
+
+    def discard(self, subscription_id: str) -> None:
+        """Forget a subscription's images, e.g. once it has ended."""
+        for key in [key for key in self._images if key[0] == subscription_id]:
+            del self._images[key]
+
+    @staticmethod
+    def _apply_tiles(
+        image: uesynth_pb2.ImageResponse,
+        pixels: np.ndarray,
+        ring: SharedMemoryRing | None,
+    ) -> None:
+        """Copy a delta image's tiles into pixels, its (height, width * bpp) base."""
+        tiles = _unpack_image_data(image, ring)
+        size = image.delta.tile_size
+        bpp = pixels.shape[1] // image.width
+        tiles_x = -(-image.width // size)
+        offset = 0
+        for index in image.delta.changed_tiles:
+            y0, x0 = index // tiles_x * size, index % tiles_x * size
+            rows = min(size, image.height - y0)
+            row_bytes = min(size, image.width - x0) * bpp
+            count = rows * row_bytes
+            tile = np.frombuffer(tiles, dtype=np.uint8, count=count, offset=offset)
+            pixels[y0 : y0 + rows, x0 * bpp : x0 * bpp + row_bytes] = tile.reshape(
+                rows, row_bytes
+            )
+            offset += count
+
+
+def _recording_request(
+    recording_id: str,
+    directory: str,
+    modalities: Sequence[str],
+    camera_name: str,
+    width: int,
+    height: int,
+    pixel_format: str,
+    rate_hz: float,
+    every_n_frames: int,
+    max_queued_frames: int,
+    frames_per_shard: int,
+) -> uesynth_pb2.StartRecordingRequest:
+    """Build a StartRecordingRequest; no modalities means steps only."""
+    return uesynth_pb2.StartRecordingRequest(
+        recording_id=recording_id,
+        directory=directory,
+        subscription=uesynth_pb2.SubscribeRequest(
+            capture=uesynth_pb2.CaptureMultiRequest(
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                modalities=_modality_mask(modalities),
+                pixel_format=_pixel_format(pixel_format),
+            ),
+            rate_hz=rate_hz,
+            every_n_frames=every_n_frames,
+            max_queued_frames=max_queued_frames,
+        ),
+        frames_per_shard=frames_per_shard,
+    )
+
+
+class RecordingShard:
+    """One shard of a recording, mapped from disk rather than read.
+
+    Attributes:
+        index: Structured array of the shard's frames, one record each, with the
+            fields the manifest lists (sequence, frame_number, location, ...)
+        tensors: Modality name -> (frames, height, width, channels) array
+        formats: Modality name -> ImageResponse.format of its pixels
+    """
+
+    def __init__(self, directory: str, entry: dict[str, Any], record: np.dtype) -> None:
+        """Map the shard's files; frames still being written are left out."""
+        index_path = os.path.join(directory, entry["index_file"])
+        # The manifest lags behind a recording still going on, the files don't
+        frames = os.path.getsize(index_path) // record.itemsize
+        layouts = {}
+        for name, tensor in entry["tensors"].items():
+            path = os.path.join(directory, tensor["file"])
+            frames = min(frames, os.path.getsize(path) // tensor["frame_bytes"])
+            layouts[name] = (path, np.dtype(tensor["dtype"]), tuple(tensor["shape"]))
+
+        self.formats = {name: t["format"] for name, t in entry["tensors"].items()}
+        # np.memmap can't map an empty file
+        self.index = (
+            np.memmap(index_path, dtype=record, mode="r", shape=(frames,))
+            if frames
+            else np.zeros(0, dtype=record)
+        )
+        self.tensors: dict[str, np.ndarray] = {}
+        for name, (path, dtype, shape) in layouts.items():
+            self.tensors[name] = (
+                np.memmap(path, dtype=dtype, mode="r", shape=(frames, *shape))
+                if frames
+                else np.zeros((0, *shape), dtype=dtype)
+            )
+
+    def __len__(self) -> int:
+        """Frames in the shard."""
+        return len(self.index)
+
+
+class Recording:
+    """A recording made with start_recording(), read back from its directory.
+
+    Each shard maps to numpy arrays without copying, so a recording larger than
+    memory can be sliced, or handed to a data loader, shard by shard. A
+    recording still being written can be opened too; it shows the frames on
+    disk when it was opened.
+    """
+
+    def __init__(self, directory: str) -> None:
+        """Read the manifest and map every shard.
+
+        Args:
+            directory: The recording's directory, RecordingStats.directory
+        """
+        self.directory = directory
+        with open(os.path.join(directory, "recording.json"), encoding="utf-8") as file:
+            self.manifest = json.load(file)
+        record = np.dtype(
+            [
+                (f["name"], f["dtype"], (f["count"],) if f["count"] > 1 else ())
+                for f in self.manifest["index_fields"]
+            ]
+        )
+        if record.itemsize != self.manifest["index_record_size"]:
+            raise ValueError(f"Unexpected index records in {directory}")
+        self.shards = [
+            RecordingShard(directory, entry, record)
+            for entry in self.manifest["shards"]
+        ]
+
+    @property
+    def complete(self) -> bool:
+        """Whether the recording was stopped and every frame is on disk."""
+        return bool(self.manifest["complete"])
+
+    def __len__(self) -> int:
+        """Frames in every shard."""
+        return sum(len(shard) for shard in self.shards)
+
+    def segmentation_table(self, revision: int) -> dict[int, str]:
+        """The segmentation IDs of a revision, as in the index's records.
+
+        Args:
+            revision: segmentation_revision of a frame
+
+        Returns:
+            Segmentation ID -> object name
+        """
+        path = os.path.join(self.directory, f"segmentation-{revision}.json")
+        with open(path, encoding="utf-8") as file:
+            table = json.load(file)
+        return {e["segmentation_id"]: e["object_name"] for e in table["entries"]}
+
+
+def unpack_transforms(packed: bytes) -> np.ndarray:
+    """Unpack batched transforms into an (N, 9) float32 array."""
+    return np.frombuffer(packed, dtype="<f4").reshape(-1, PACKED_TRANSFORM_FLOATS)
+
+
+def _scene_fields(num_fields: int) -> dict[str, slice]:
+    """Where each field's planes are in a scene snapshot of num_fields planes."""
+    fields = {"location": slice(0, 3), "rotation": slice(3, 6), "scale": slice(6, 9)}
+    next_field = PACKED_TRANSFORM_FLOATS
+    if num_fields >= PACKED_TRANSFORM_FLOATS + 3:
+        fields["velocity"] = slice(next_field, next_field + 3)
+        next_field += 3
+    if num_fields > next_field:
+        fields["visible"] = slice(next_field, next_field + 1)
+    return fields
+
+
+def _scene_rows(snapshot: uesynth_pb2.SceneSnapshot) -> np.ndarray:
+    """A snapshot's planes as an (N, num_fields) view, one row per object."""
+    planes = np.frombuffer(snapshot.packed_state, dtype="<f4")
+    return planes.reshape(snapshot.num_fields, len(snapshot.object_ids)).T
+
+
+def unpack_scene_state(snapshot: uesynth_pb2.SceneSnapshot) -> dict[str, np.ndarray]:
+    """Unpack a scene snapshot into arrays, one row per object.
+
+    Returns:
+        ``ids`` (N,) of registry IDs; ``location``, ``rotation`` (pitch, yaw,
+        roll) and ``scale`` (N, 3) float32; ``velocity`` (N, 3) and ``visible``
+        (N,) bool when the snapshot has them. Float arrays are views of the
+        snapshot's bytes.
+    """
+    rows = _scene_rows(snapshot)
+    state: dict[str, np.ndarray] = {
+        "ids": np.asarray(snapshot.object_ids, dtype=np.uint32)
+    }
+    for name, columns in _scene_fields(snapshot.num_fields).items():
+        state[name] = rows[:, columns]
+    if "visible" in state:
+        state["visible"] = state["visible"][:, 0] != 0
+    return state
+
+
+class SceneState:
+    """A copy of the scene's object state, kept current from snapshot diffs.
+
+    Ask for each snapshot with ``since_sequence=state.sequence`` and pass it to
+    ``apply``. The server answers with a full snapshot whenever it can't diff
+    against this copy any more, which ``apply`` then takes whole.
+
+    Attributes:
+        sequence: Of the last snapshot applied, 0 before the first
+        ids: (N,) registry IDs, in no particular order
+        rows: (N, num_fields) float32, the packed planes of each object
+        names: Registry ID -> object name, for snapshots that sent names
+    """
+
+    def __init__(self) -> None:
+        self.sequence = 0
+        self.num_fields = PACKED_TRANSFORM_FLOATS
+        self.ids = np.zeros(0, dtype=np.uint32)
+        self.rows = np.zeros((0, self.num_fields), dtype=np.float32)
+        self.names: dict[int, str] = {}
+
+    def apply(self, snapshot: uesynth_pb2.SceneSnapshot) -> None:
+        """Bring the copy up to date with a snapshot.
+
+        Raises:
+            ValueError: A diff has other fields than the copy, because the
+                request asked for velocities or visibility differently
+        """
+        ids = np.asarray(snapshot.object_ids, dtype=np.uint32)
+        rows = _scene_rows(snapshot)
+        if snapshot.full:
+            self.ids = ids
+            self.rows = rows.copy()
+            self.num_fields = snapshot.num_fields
+            self.names = {}
+        else:
+            if snapshot.num_fields != self.num_fields:
+                raise ValueError(
+                    f"Diff has {snapshot.num_fields} fields, the copy "
+                    f"{self.num_fields}; ask again with since_sequence=0"
+                )
+            gone = np.asarray(snapshot.removed_ids, dtype=np.uint32)
+            keep = ~np.isin(self.ids, np.concatenate([gone, ids]))
+            self.ids = np.concatenate([self.ids[keep], ids])
+            self.rows = np.concatenate([self.rows[keep], rows])
+            for object_id in snapshot.removed_ids:
+                self.names.pop(object_id, None)
+        self.names.update(zip(snapshot.object_ids, snapshot.object_names))
+        self.sequence = snapshot.sequence
+
+    def __len__(self) -> int:
+        return len(self.ids)
+
+    def field(self, name: str) -> np.ndarray:
+        """One field of every object, in the order of ``ids``.
+
+        Args:
+            name: ``location``, ``rotation``, ``scale`` or ``velocity``, each
+                (N, 3), or ``visible``, (N,) bool
+        """
+        columns = _scene_fields(self.num_fields)
+        if name not in columns:
+            raise KeyError(f"The snapshots applied have no {name!r}")
+        values = self.rows[:, columns[name]]
+        return values[:, 0] != 0 if name == "visible" else values
+
+
+# Responses kept in AsyncUESynthClient.latest_responses, by FrameResponse field
+_LATEST_RESPONSE_KEYS = {
+    "image_response": "image",
+    "multi_image_response": "multi_image",
+    "subscription_frame": "subscription_frame",
+    "command_response": "command",
+    "camera_transform": "camera_transform",
+    "object_transform": "object_transform",
+    "objects_list": "objects_list",
+    "stream_stats": "stream_stats",
+    "step_response": "step",
+    "lockstep_state": "lockstep",
+    "preload_assets_response": "preload_assets",
+    "actor_pool_stats": "actor_pool",
+    "materials_set": "materials_set",
+    "material_parameter_ids": "material_parameter_ids",
+    "lighting_set": "lighting_set",
+    "scene_snapshot": "scene_snapshot",
+}
+
+
+class PendingAction(str):
+    """The request ID of a streamed action, which can be awaited for its answer.
+
+    It compares, hashes and prints as the plain ID, so it can be kept and
+    matched against FrameResponse.request_id as before. Awaiting it returns
+    the action's response; a list of them for actions answered several
+    times, like capture.cameras; and the first, the server's acknowledgement,
+    for subscriptions. The server doesn't answer actions that failed or had
+    nothing to return, so the wait ends in TimeoutError after the client's
+    action_timeout, and in ConnectionError if the stream closes first.
+    """
+
+    future: asyncio.Future[Any]
+
+    def __new__(cls, request_id: str, future: asyncio.Future[Any]) -> "PendingAction":
+        """Wrap a request ID and the future its answer settles."""
+        action = super().__new__(cls, request_id)
+        action.future = future
+        return action
+
+    def __await__(self) -> Any:
+        """Wait for the answer."""
+        return self.future.__await__()
+
+
+class _PendingRequest:
+    """A streamed action the client still routes responses to."""
+
+    __slots__ = ("callback", "remaining", "responses", "future", "timer")
+
+    def __init__(
+        self,
+        callback: Callable | None,
+        remaining: int | None,
+        future: asyncio.Future[Any],
+    ) -> None:
+        self.callback = callback
+        # None for subscriptions, which are answered until unsubscribed
+        self.remaining = remaining
+        self.responses: list[uesynth_pb2.FrameResponse] | None = (
+            [] if remaining is not None and remaining > 1 else None
+        )
+        self.future = future
+        self.timer: asyncio.TimerHandle | None = None
+
+    def answer(self, response: uesynth_pb2.FrameResponse) -> bool:
+        """Count a response, settling the future; True once no more are wanted."""
+        if self.remaining is None:
+            if not self.future.done():
+                self.future.set_result(response)
+            # Later frames only matter to a callback
+            return self.callback is None
+        self.remaining -= 1
+        if self.responses is not None:
+            self.responses.append(response)
+        if self.remaining > 0:
+            return False
+        if not self.future.done():
+            self.future.set_result(
+                self.responses if self.responses is not None else response
+            )
+        return True
+
 
 class AsyncUESynthClient:
     """Async client for high-performance interaction with UESynth Unreal Engine plugin via bidirectional gRPC streaming."""
 
-    def __init__(self, address: str = "localhost:50051") -> None:
+    # Metadata key the server reads to size the ControlStream in-flight window
+    MAX_IN_FLIGHT_METADATA_KEY = "uesynth-max-in-flight"
+    # Metadata keys the server reads to bound the ControlStream outbound queue
+    WRITE_QUEUE_DEPTH_METADATA_KEY = "uesynth-write-queue-depth"
+    WRITE_QUEUE_POLICY_METADATA_KEY = "uesynth-write-queue-policy"
+    WRITE_QUEUE_POLICIES = ("block", "drop_oldest", "drop_newest")
+    # Metadata keys the server reads to put the ControlStream in a session's world
+    SESSION_METADATA_KEY = "uesynth-session"
+    SESSION_LEVEL_METADATA_KEY = "uesynth-session-level"
+
+    def __init__(
+        self,
+        address: str = "localhost:50051",
+        max_in_flight: int = 1,
+        write_queue_depth: int | None = None,
+        write_queue_policy: str | None = None,
+        session: str | None = None,
+        session_level: str | None = None,
+        max_pending: int | None = None,
+        action_timeout: float | None = 30.0,
+        frame_pool_slots: int = 0,
+        frame_queue_size: int = 0,
+    ) -> None:
         """Initialize the async UESynth client.
 
         Args:
             address: The server address in format 'host:port'
+            max_in_flight: How many streamed actions the server may work on at
+                once. Values above 1 let responses arrive out of order; they
+                are matched back to their requests by request ID.
+            write_queue_depth: How many responses the server queues for this
+                client before the policy applies, or None for its default
+            write_queue_policy: What the server does with subscription
+                frames once the queue is full: "block" stops taking new
+                actions, "drop_oldest" and "drop_newest" discard a frame.
+                Replies to actions, captures included, are never dropped.
+                None for the default, "block".
+            session: ID of a session to join, or None to act on the editor's
+                own world. Each session has a world, cameras and object IDs of
+                its own; clients that name the same session share them.
+                Sessions capture through cameras made with camera.create.
+            session_level: Level the session's world streams in when this
+                client opens it, e.g. "/Game/Maps/Lab"; None for an empty world
+            max_pending: How many streamed actions may await their answer at
+                once; sending more waits for one to be answered, time out or
+                be cancelled. None for no limit.
+            action_timeout: Seconds after which an unanswered action's
+                PendingAction fails with TimeoutError and stops counting
+                against max_pending, or None to wait forever. The server
+                doesn't answer failed actions.
+            frame_pool_slots: Decode images into a FramePool with this many
+                arrays per shape instead of new arrays; 0 for no pool
+            frame_queue_size: RGB frames kept for next_frame(), oldest dropped
+                first once full; 0 to keep only the latest
         """
+        if (
+            write_queue_policy is not None
+            and write_queue_policy not in self.WRITE_QUEUE_POLICIES
+        ):
+            raise ValueError(
+                f"write_queue_policy must be one of {self.WRITE_QUEUE_POLICIES}, "
+                f"got {write_queue_policy!r}"
+            )
         self.address = address
+        self.max_in_flight = max(1, max_in_flight)
+        self.write_queue_depth = write_queue_depth
+        self.write_queue_policy = write_queue_policy
+        self.session = session
+        self.session_level = session_level
         self.channel = None
         self.stub = None
 
         # Streaming state
         self.stream = None
         self.request_queue = None
-        self.response_handlers = {}  # request_id -> callback
+        self.pending: dict[str, _PendingRequest] = {}  # request_id -> routing
         self.latest_responses = {}  # response_type -> latest_response
+        self.delta_frames = DeltaFrames()  # Bases of delta subscriptions' images
+        self.shared_memory: SharedMemoryRing | None = None  # See open_shared_memory
+        self.max_pending = max_pending
+        self.action_timeout = action_timeout
+        self._window = asyncio.Semaphore(max_pending) if max_pending else None
+        self._request_ids = itertools.count(1)
+        self.frame_pool = FramePool(frame_pool_slots) if frame_pool_slots else None
+        self.frame_queue: asyncio.Queue[uesynth_pb2.ImageResponse] | None = (
+            asyncio.Queue(frame_queue_size) if frame_queue_size else None
+        )
+        self.dropped_frames = 0  # Frames next_frame() never saw
 
         # Async tasks
         self.response_task = None
         self.request_task = None
         self.running = False
-        self.lock = asyncio.Lock()
 
         # Initialize component controllers
         self.camera = self.Camera(self)
@@ -49,7 +1037,9 @@ class AsyncUESynthClient:
 
     async def connect(self) -> None:
         """Connect to the server and initialize streaming."""
-        self.channel = grpc.aio.insecure_channel(self.address)
+        self.channel = grpc.aio.insecure_channel(
+            self.address, options=CHANNEL_OPTIONS
+        )
         self.stub = uesynth_pb2_grpc.UESynthServiceStub(self.channel)
 
         # Initialize streaming
@@ -58,7 +1048,20 @@ class AsyncUESynthClient:
     async def _start_streaming(self) -> None:
         """Start the bidirectional streaming connection."""
         self.running = True
-        self.stream = self.stub.ControlStream()
+        metadata = [(self.MAX_IN_FLIGHT_METADATA_KEY, str(self.max_in_flight))]
+        if self.write_queue_depth is not None:
+            metadata.append(
+                (self.WRITE_QUEUE_DEPTH_METADATA_KEY, str(self.write_queue_depth))
+            )
+        if self.write_queue_policy is not None:
+            metadata.append(
+                (self.WRITE_QUEUE_POLICY_METADATA_KEY, self.write_queue_policy)
+            )
+        if self.session is not None:
+            metadata.append((self.SESSION_METADATA_KEY, self.session))
+            if self.session_level is not None:
+                metadata.append((self.SESSION_LEVEL_METADATA_KEY, self.session_level))
+        self.stream = self.stub.ControlStream(metadata=tuple(metadata))
         self.request_queue = asyncio.Queue()
 
         # Start background tasks
@@ -104,80 +1107,327 @@ class AsyncUESynthClient:
                     if response == grpc.aio.EOF:
                         break
 
-                    # Store latest response by type
-                    async with self.lock:
-                        if response.HasField("image_response"):
-                            self.latest_responses["image"] = response.image_response
-                        elif response.HasField("command_response"):
-                            self.latest_responses["command"] = response.command_response
-                        elif response.HasField("camera_transform"):
-                            self.latest_responses["camera_transform"] = (
-                                response.camera_transform
-                            )
-                        elif response.HasField("object_transform"):
-                            self.latest_responses["object_transform"] = (
-                                response.object_transform
-                            )
-                        elif response.HasField("objects_list"):
-                            self.latest_responses["objects_list"] = (
-                                response.objects_list
-                            )
-
-                    # Call specific response handler if registered
-                    request_id = response.request_id
-                    if request_id in self.response_handlers:
-                        callback = self.response_handlers[request_id]
-                        if asyncio.iscoroutinefunction(callback):
-                            await callback(response)
-                        else:
-                            callback(response)
-                        del self.response_handlers[request_id]
+                    # Everything runs on the event loop, so no lock is needed
+                    self._store_latest(response)
+                    await self._dispatch(response)
 
                 except Exception as e:
                     print(f"Error in response handler: {e}")
                     break
         finally:
             self.running = False
+            self._fail_pending(ConnectionError("the stream closed"))
+
+    def _store_latest(self, response: uesynth_pb2.FrameResponse) -> None:
+        """Keep a response in latest_responses, and apply what it carries."""
+        field = response.WhichOneof("response")
+        if field is None:
+            return
+        message = getattr(response, field)
+        key = _LATEST_RESPONSE_KEYS.get(field)
+        if key is not None:
+            self.latest_responses[key] = message
+
+        if field == "image_response":
+            self.capture.segmentation_table.update_from(message)
+            self._queue_frame(message)
+        elif field == "multi_image_response":
+            self.capture.segmentation_table.update_from(message.segmentation)
+        elif field == "subscription_frame":
+            self.delta_frames.apply(response.request_id, message, self.shared_memory)
+            if message.images.modalities & CAPTURE_MODALITIES["rgb"]:
+                self.latest_responses["image"] = message.images.rgb
+                self._queue_frame(message.images.rgb)
+            self.capture.segmentation_table.update_from(message.images.segmentation)
+        elif field == "step_response":
+            self.capture.segmentation_table.update_from(message.images.segmentation)
+        elif field == "shared_memory":
+            # Every image after this answer may be in the ring
+            if self.shared_memory is None:
+                self.shared_memory = SharedMemoryRing(message)
+
+    async def _dispatch(self, response: uesynth_pb2.FrameResponse) -> None:
+        """Run the callback of the action a response answers and settle its future."""
+        request_id = response.request_id
+        pending = self.pending.get(request_id)
+        if pending is None:
+            return
+        callback = pending.callback
+        if callback is not None:
+            if asyncio.iscoroutinefunction(callback):
+                await callback(response)
+            else:
+                callback(response)
+        if pending.answer(response) and self.pending.get(request_id) is pending:
+            del self.pending[request_id]
+
+    def _queue_frame(self, image: uesynth_pb2.ImageResponse) -> None:
+        """Keep an RGB frame for next_frame(), dropping the oldest once full."""
+        if self.frame_queue is None:
+            return
+        if self.frame_queue.full():
+            self.frame_queue.get_nowait()
+            self.dropped_frames += 1
+        self.frame_queue.put_nowait(image)
+
+    def _settled(self, request_id: str, future: asyncio.Future[Any]) -> None:
+        """Free an action's window slot once its future is done, however it ended."""
+        if self._window is not None:
+            self._window.release()
+        pending = self.pending.get(request_id)
+        if pending is None or pending.future is not future:
+            return
+        if pending.timer is not None:
+            pending.timer.cancel()
+            pending.timer = None
+        # Asking for the exception also keeps asyncio from logging it when
+        # nobody awaited the action
+        if future.cancelled() or future.exception() is not None:
+            del self.pending[request_id]
+
+    def _expire(self, request_id: str) -> None:
+        """Give up on an action the server never answered."""
+        pending = self.pending.get(request_id)
+        if pending is not None and not pending.future.done():
+            pending.future.set_exception(
+                TimeoutError(
+                    f"no answer to request {request_id} in {self.action_timeout}s"
+                )
+            )
+
+    def _forget(self, request_id: str) -> None:
+        """Stop routing responses to an action, cancelling its wait."""
+        pending = self.pending.pop(request_id, None)
+        if pending is None:
+            return
+        if pending.timer is not None:
+            pending.timer.cancel()
+        pending.future.cancel()
+
+    def _fail_pending(self, error: Exception) -> None:
+        """Fail every action still waiting, e.g. once the stream is gone."""
+        pending, self.pending = self.pending, {}
+        for request in pending.values():
+            if request.timer is not None:
+                request.timer.cancel()
+            if not request.future.done():
+                request.future.set_exception(error)
 
     async def _send_action(
         self,
         action_request: uesynth_pb2.ActionRequest,
         callback: Callable | None = None,
-    ) -> str:
+        responses: int | None = 1,
+    ) -> PendingAction:
         """Send an action request to the server.
 
+        Waits for room first when max_pending actions are already waiting.
+
         Args:
             action_request: The action request to send
             callback: Optional callback to handle the response
+            responses: How many responses the action is answered with, or None
+                until it is cancelled; the callback runs for each of them
 
         Returns:
-            Request ID for tracking
+            The request ID, which can be awaited for the answer
         """
-        request_id = str(uuid.uuid4())
+        if self._window is not None:
+            await self._window.acquire()
+
+        # A counter is cheaper than a UUID and still unique per stream
+        request_id = str(next(self._request_ids))
         action_request.request_id = request_id
 
-        if callback:
-            self.response_handlers[request_id] = callback
+        loop = asyncio.get_running_loop()
+        future = loop.create_future()
+        pending = _PendingRequest(callback, responses, future)
+        if self.action_timeout is not None:
+            pending.timer = loop.call_later(
+                self.action_timeout, self._expire, request_id
+            )
+        self.pending[request_id] = pending
+        future.add_done_callback(lambda done: self._settled(request_id, done))
 
         # Queue the request for sending
         await self.request_queue.put(action_request)
 
-        return request_id
+        return PendingAction(request_id, future)
 
     async def get_latest_frame(self) -> np.ndarray | None:
-        """Get the latest captured frame.
+        """Get the latest captured frame, e.g. from an RGB subscription.
 
         Returns:
             Latest RGB image as numpy array, or None if no frame available
         """
-        async with self.lock:
-            if "image" in self.latest_responses:
-                img_response = self.latest_responses["image"]
-                image = np.frombuffer(img_response.image_data, dtype=np.uint8).reshape(
-                    img_response.height, img_response.width, -1
-                )
-                return image
-        return None
+        image = self.latest_responses.get("image")
+        if image is None:
+            return None
+        return self.decode_image(image)
+
+    async def next_frame(self) -> np.ndarray:
+        """Wait for the next RGB frame, in the order frames arrived.
+
+        Unlike get_latest_frame(), no frame is skipped until frame_queue_size
+        of them wait; dropped_frames counts the ones dropped after that.
+
+        Returns:
+            The frame as numpy array, decoded into the frame pool if there is one
+        """
+        if self.frame_queue is None:
+            raise RuntimeError("next_frame() needs a client with frame_queue_size")
+        return self.decode_image(await self.frame_queue.get())
+
+    async def get_stream_stats(self, callback: Callable | None = None) -> str:
+        """Ask for the stream's outbound queue depth and drop counts (non-blocking).
+
+        The answer's stream_stats is also kept as latest_responses["stream_stats"].
+
+        Args:
+            callback: Optional callback to receive the response
+
+        Returns:
+            Request ID for tracking
+        """
+        action_request = uesynth_pb2.ActionRequest()
+        action_request.get_stream_stats.SetInParent()
+
+        return await self._send_action(action_request, callback)
+
+    async def open_shared_memory(
+        self,
+        slot_count: int = 0,
+        slot_size: int = 0,
+        callback: Callable | None = None,
+    ) -> str:
+        """Have the server send images through shared memory (non-blocking).
+
+        Only works when the server runs on this host. Once the answer arrives,
+        the region is mapped as shared_memory and every later image's payload
+        is read from it instead of the stream; decode_image() and
+        get_latest_frame() return views of it, with no copies. A view stays
+        valid until slot_count more images have arrived, so copy what you keep
+        longer or make the ring bigger.
+
+        Args:
+            slot_count: Images the ring holds, up to 64 (0 for 8)
+            slot_size: Bytes per slot, up to 256 MiB (0 for 16 MiB); larger
+                images are still sent inline. The whole ring may be at most
+                1 GiB
+            callback: Optional callback to receive the response
+
+        Returns:
+            Request ID for tracking
+        """
+        action_request = uesynth_pb2.ActionRequest()
+        action_request.open_shared_memory.slot_count = slot_count
+        action_request.open_shared_memory.slot_size = slot_size
+
+        return await self._send_action(action_request, callback)
+
+    async def set_lockstep(
+        self,
+        enabled: bool,
+        fixed_delta_seconds: float = 0.0,
+        idle_timeout_ms: int = 0,
+        callback: Callable | None = None,
+    ) -> str:
+        """Have the engine wait for a step() between frames (non-blocking).
+
+        In lockstep the engine uses a fixed time step and no frame-rate limits,
+        and renders a frame only when a step() lets one through, so datasets
+        are generated as fast as the GPU allows. Other actions still run while
+        it waits; captures outside of a step wait for the next step's frame.
+        The answer's lockstep_state is kept as latest_responses["lockstep"].
+
+        Args:
+            enabled: Whether to enter or leave lockstep
+            fixed_delta_seconds: World seconds per frame (0 for 1/30)
+            idle_timeout_ms: Leave lockstep once no step has arrived for this
+                long (0 for 60 s); lockstep also ends when this client's
+                stream closes
+            callback: Optional callback to receive the response
+
+        Returns:
+            Request ID for tracking
+        """
+        action_request = uesynth_pb2.ActionRequest()
+        action_request.set_lockstep.enabled = enabled
+        action_request.set_lockstep.fixed_delta_seconds = fixed_delta_seconds
+        action_request.set_lockstep.idle_timeout_ms = idle_timeout_ms
+
+        return await self._send_action(action_request, callback)
+
+    def decode_image(self, image: uesynth_pb2.ImageResponse) -> np.ndarray:
+        """Decode an image from any response, reading shared memory if needed.
+
+        With a frame pool, the array is one of the pool's and is overwritten
+        once frame_pool_slots more images of its shape have been decoded.
+
+        Args:
+            image: e.g. response.image_response or a multi-image response's rgb
+        """
+        if self.frame_pool is not None:
+            return self.frame_pool.decode(image, self.shared_memory)
+        return _decode_image(image, self.shared_memory)
+
+    async def step(
+        self,
+        actions: Sequence[uesynth_pb2.ActionRequest],
+        modalities: Sequence[str] = (),
+        camera_name: str = "",
+        width: int = 0,
+        height: int = 0,
+        pixel_format: str = "rgba",
+        delta_seconds: float = 0.0,
+        continue_on_error: bool = False,
+        recording_id: str = "",
+        callback: Callable | None = None,
+    ) -> str:
+        """Apply several actions, then capture, in one game-thread task (non-blocking).
+
+        Nothing else reaches the scene between the actions and the capture, and
+        the capture renders all of them. The answer's step_response holds one
+        result per action run, the errors of those that failed, and the
+        images; it is also kept as latest_responses["step"]. By default the
+        step stops at the first failed action, without ticking or capturing.
+
+        Args:
+            actions: ActionRequests to run in order; they can't capture,
+                subscribe or be steps themselves
+            modalities: Names from CAPTURE_MODALITIES to capture afterwards;
+                empty for no capture
+            camera_name: Name of the camera to capture from (empty for default)
+            width: Desired image width (0 for default)
+            height: Desired image height (0 for default)
+            pixel_format: Layout of the RGB image: "rgba", "rgb", "bgr" or "gray"
+            delta_seconds: Seconds to tick the world by before capturing, for
+                deterministic physics; 0 for no tick of its own
+            continue_on_error: Go on with the rest after an action fails
+            recording_id: Write the capture to this recording instead of the
+                answer; the codecs are raw either way
+            callback: Optional callback to receive the response
+
+        Returns:
+            Request ID for tracking
+        """
+        action_request = uesynth_pb2.ActionRequest()
+        action_request.step.CopyFrom(
+            _step_request(
+                actions,
+                modalities,
+                camera_name,
+                width,
+                height,
+                pixel_format,
+                self.capture.segmentation_table.revision,
+                delta_seconds,
+                continue_on_error,
+                recording_id,
+            )
+        )
+
+        return await self._send_action(action_request, callback)
 
     async def disconnect(self) -> None:
         """Close the gRPC channel and disconnect from the server."""
@@ -204,6 +1454,10 @@ class AsyncUESynthClient:
         if self.channel:
             await self.channel.close()
 
+        if self.shared_memory is not None:
+            self.shared_memory.close()
+            self.shared_memory = None
+
     # Async versions of unary RPC methods
     async def get_camera_location(
         self, camera_name: str = ""
@@ -239,6 +1493,105 @@ class AsyncUESynthClient:
         )
         return await self.stub.SetObjectTransform(request)
 
+    async def start_recording(
+        self,
+        recording_id: str,
+        directory: str = "",
+        modalities: Sequence[str] = (),
+        camera_name: str = "",
+        width: int = 0,
+        height: int = 0,
+        pixel_format: str = "rgba",
+        rate_hz: float = 0.0,
+        every_n_frames: int = 0,
+        max_queued_frames: int = 0,
+        frames_per_shard: int = 0,
+    ) -> uesynth_pb2.RecordingStats:
+        """Write frames to the server's disk instead of sending them (async unary call).
+
+        Frames wait for a writer thread of the server's, so the engine never
+        waits for the disk; when it can't keep up, frames are dropped and
+        counted. Open the directory with Recording once stopped, or meanwhile.
+
+        Args:
+            recording_id: Names the recording for step() and stop_recording()
+            directory: Where to write it, created if missing: a relative
+                path under the project's Saved/UESynth/Recordings (empty for
+                recording_id there); absolute paths and ones leading out of it
+                are refused. It must not hold a recording yet.
+            modalities: Names from CAPTURE_MODALITIES to record from the render
+                loop; empty to only record the steps that name it
+            camera_name: Name of the camera to record from (empty for default)
+            width: Desired image width (0 for default)
+            height: Desired image height (0 for default)
+            pixel_format: Layout of the RGB image: "rgba", "rgb", "bgr" or "gray"
+            rate_hz: Frames per second; 0 to go by every_n_frames instead
+            every_n_frames: One frame every N rendered ones (0 for every frame)
+            max_queued_frames: Frames that may wait for the disk before new
+                ones are dropped (0 for 8)
+            frames_per_shard: Frames per shard file (0 for 1000)
+
+        Returns:
+            The recording's stats, with the absolute directory it writes to
+        """
+        request = _recording_request(
+            recording_id,
+            directory,
+            modalities,
+            camera_name,
+            width,
+            height,
+            pixel_format,
+            rate_hz,
+            every_n_frames,
+            max_queued_frames,
+            frames_per_shard,
+        )
+        return await self.stub.StartRecording(request)
+
+    async def stop_recording(self, recording_id: str) -> uesynth_pb2.RecordingStats:
+        """Stop a recording once its queued frames are written (async unary call).
+
+        Args:
+            recording_id: The ID given to start_recording()
+
+        Returns:
+            The final stats: frames written and dropped, bytes and shards
+        """
+        request = uesynth_pb2.StopRecordingRequest(recording_id=recording_id)
+        return await self.stub.StopRecording(request)
+
+    async def get_server_stats(self, reset: bool = False) -> uesynth_pb2.ServerStats:
+        """Get the server's latency histograms and queue depths (async unary call).
+
+        Answered without waiting for the game thread, so it also shows what a
+        stalled server is stuck on.
+
+        Args:
+            reset: Start every histogram over once this snapshot is taken
+
+        Returns:
+            Per-RPC and per-stage latency histograms and the current gauges
+        """
+        request = uesynth_pb2.GetServerStatsRequest(reset=reset)
+        return await self.stub.GetServerStats(request)
+
+    async def get_health(
+        self, timeout: float | None = None
+    ) -> uesynth_pb2.HealthStatus:
+        """Ask whether the server can take work and how busy it is (async).
+
+        Answered as ``UESynthClient.get_health()`` is, without waiting for the
+        game thread.
+
+        Args:
+            timeout: Seconds to wait for the answer; None waits indefinitely
+
+        Returns:
+            Readiness, fps, command queue depth and calls in flight
+        """
+        return await self.stub.GetHealth(uesynth_pb2.HealthRequest(), timeout=timeout)
+
     class Camera:
         """Camera control and manipulation methods."""
 
@@ -311,6 +1664,8 @@ class AsyncUESynthClient:
             pitch: float = 0,
             yaw: float = 0,
             roll: float = 0,
+            width: int = 0,
+            height: int = 0,
         ) -> str:
             """Create a new camera with specified transform (non-blocking).
 
@@ -322,6 +1677,8 @@ class AsyncUESynthClient:
                 pitch: Initial pitch rotation in degrees
                 yaw: Initial yaw rotation in degrees
                 roll: Initial roll rotation in degrees
+                width: Capture width (0 for the game viewport's)
+                height: Capture height (0 for the game viewport's)
 
             Returns:
                 Request ID for tracking
@@ -331,7 +1688,10 @@ class AsyncUESynthClient:
                 rotation=uesynth_pb2.Rotator(pitch=pitch, yaw=yaw, roll=roll),
             )
             request = uesynth_pb2.CreateCameraRequest(
-                camera_name=camera_name, initial_transform=transform
+                camera_name=camera_name,
+                initial_transform=transform,
+                width=width,
+                height=height,
             )
 
             action_request = uesynth_pb2.ActionRequest()
@@ -339,6 +1699,42 @@ class AsyncUESynthClient:
 
             return await self.client._send_action(action_request)
 
+        async def destroy(self, camera_name: str) -> str:
+            """Destroy a camera made by create (non-blocking).
+
+            Args:
+                camera_name: Name of the camera
+
+            Returns:
+                Request ID for tracking
+            """
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.destroy_camera.camera_name = camera_name
+
+            return await self.client._send_action(action_request)
+
+        async def set_resolution(
+            self, camera_name: str, width: int = 0, height: int = 0
+        ) -> str:
+            """Change the capture size of a camera made by create (non-blocking).
+
+            Args:
+                camera_name: Name of the camera
+                width: New width (0 keeps the current one)
+                height: New height (0 keeps the current one)
+
+            Returns:
+                Request ID for tracking
+            """
+            request = uesynth_pb2.SetResolutionRequest(
+                camera_name=camera_name, width=width, height=height
+            )
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.set_resolution.CopyFrom(request)
+
+            return await self.client._send_action(action_request)
+
         # Async unary method for getting camera location
         async def get_location(
             self, camera_name: str = ""
@@ -363,9 +1759,19 @@ class AsyncUESynthClient:
                 client: The async client instance
             """
             self.client = client
+            # Segmentation ID -> object name, kept current from streamed responses
+            self.segmentation_table = SegmentationTable()
 
         async def rgb(
-            self, camera_name: str = "", width: int = 0, height: int = 0
+            self,
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            pixel_format: str = "rgba",
+            codec: str = "raw",
+            jpeg_quality: int = 0,
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
         ) -> str:
             """Capture RGB image from camera (non-blocking).
 
@@ -373,12 +1779,24 @@ class AsyncUESynthClient:
                 camera_name: Name of the camera to capture from (empty for default)
                 width: Desired image width (0 for default)
                 height: Desired image height (0 for default)
+                pixel_format: "rgba", "rgb", "bgr" or "gray"
+                codec: "raw", "jpeg", "png", "lz4" or "zlib"; decoded on receipt
+                jpeg_quality: JPEG quality in [1, 100] (0 for 85)
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
 
             Returns:
                 Request ID for tracking
             """
             request = uesynth_pb2.CaptureRequest(
-                camera_name=camera_name, width=width, height=height
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                **_capture_region(roi, output_size),
+                pixel_format=_pixel_format(pixel_format),
+                codec=_image_codec(codec),
+                jpeg_quality=jpeg_quality,
             )
 
             action_request = uesynth_pb2.ActionRequest()
@@ -387,7 +1805,16 @@ class AsyncUESynthClient:
             return await self.client._send_action(action_request)
 
         async def depth(
-            self, camera_name: str = "", width: int = 0, height: int = 0
+            self,
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            encoding: str = "float32",
+            near: float = 0.0,
+            far: float = 0.0,
+            codec: str = "raw",
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
         ) -> str:
             """Capture depth map from camera (non-blocking).
 
@@ -395,12 +1822,26 @@ class AsyncUESynthClient:
                 camera_name: Name of the camera to capture from (empty for default)
                 width: Desired image width (0 for default)
                 height: Desired image height (0 for default)
+                encoding: "float32", "float16" or "uint16"
+                near: Start of the uint16 range in cm
+                far: End of the uint16 range in cm (0 and 0 for 1 mm steps)
+                codec: "raw", "lz4" or "zlib"; decoded on receipt
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
 
             Returns:
                 Request ID for tracking
             """
             request = uesynth_pb2.CaptureRequest(
-                camera_name=camera_name, width=width, height=height
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                **_capture_region(roi, output_size),
+                depth_encoding=_depth_encoding(encoding),
+                depth_near=near,
+                depth_far=far,
+                codec=_image_codec(codec),
             )
 
             action_request = uesynth_pb2.ActionRequest()
@@ -409,20 +1850,38 @@ class AsyncUESynthClient:
             return await self.client._send_action(action_request)
 
         async def segmentation(
-            self, camera_name: str = "", width: int = 0, height: int = 0
+            self,
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            codec: str = "raw",
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
         ) -> str:
             """Capture segmentation mask from camera (non-blocking).
 
+            The response updates segmentation_table when the server's ID
+            assignments have changed since the last one.
+
             Args:
                 camera_name: Name of the camera to capture from (empty for default)
                 width: Desired image width (0 for default)
                 height: Desired image height (0 for default)
+                codec: "raw", "lz4" or "zlib"; decoded on receipt
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
 
             Returns:
                 Request ID for tracking
             """
             request = uesynth_pb2.CaptureRequest(
-                camera_name=camera_name, width=width, height=height
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                **_capture_region(roi, output_size),
+                segmentation_revision=self.segmentation_table.revision,
+                codec=_image_codec(codec),
             )
 
             action_request = uesynth_pb2.ActionRequest()
@@ -430,82 +1889,322 @@ class AsyncUESynthClient:
 
             return await self.client._send_action(action_request)
 
-        # Async unary method for direct RGB capture
-        async def rgb_direct(
-            self, camera_name: str = "", width: int = 0, height: int = 0
-        ) -> np.ndarray:
-            """Capture RGB image directly (async unary call).
+        async def optical_flow(
+            self,
+            width: int = 0,
+            height: int = 0,
+            codec: str = "raw",
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
+        ) -> str:
+            """Capture optical flow of the game view (non-blocking).
 
             Args:
-                camera_name: Name of the camera to capture from (empty for default)
                 width: Desired image width (0 for default)
                 height: Desired image height (0 for default)
+                codec: "raw", "lz4" or "zlib"; decoded on receipt
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
 
             Returns:
-                RGB image as numpy array
+                Request ID for tracking
             """
             request = uesynth_pb2.CaptureRequest(
-                camera_name=camera_name, width=width, height=height
-            )
-            response = await self.client.stub.CaptureRgbImage(request)
-            image = np.frombuffer(response.image_data, dtype=np.uint8).reshape(
-                response.height, response.width, -1
+                width=width,
+                height=height,
+                codec=_image_codec(codec),
+                **_capture_region(roi, output_size),
             )
-            return image
 
-    class Objects:
-        """Object spawning and manipulation methods."""
-
-        def __init__(self, client: "AsyncUESynthClient") -> None:
-            """Initialize objects controller.
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.capture_optical_flow.CopyFrom(request)
 
-            Args:
-                client: The async client instance
-            """
-            self.client = client
+            return await self.client._send_action(action_request)
 
-        async def set_location(
-            self, object_name: str, x: float, y: float, z: float
+        async def multi(
+            self,
+            modalities: Sequence[str] = ("rgb", "depth", "normals"),
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            pixel_format: str = "rgba",
+            color_codec: str = "raw",
+            data_codec: str = "raw",
+            jpeg_quality: int = 0,
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
         ) -> str:
-            """Set object location in 3D space (non-blocking).
+            """Capture several modalities from one frame (non-blocking).
 
             Args:
-                object_name: Name of the object to move
-                x: X coordinate
-                y: Y coordinate
-                z: Z coordinate
+                modalities: Names from CAPTURE_MODALITIES; nothing else is read back
+                camera_name: Name of the camera to capture from (empty for default)
+                width: Desired image width (0 for default)
+                height: Desired image height (0 for default)
+                pixel_format: Layout of the RGB image: "rgba", "rgb", "bgr" or "gray"
+                color_codec: Codec of the RGB and normals images: "raw", "jpeg",
+                    "png", "lz4" or "zlib"
+                data_codec: Codec of depth, segmentation and optical flow:
+                    "raw", "lz4" or "zlib"
+                jpeg_quality: JPEG quality in [1, 100] (0 for 85)
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
 
             Returns:
                 Request ID for tracking
             """
-            transform = uesynth_pb2.Transform(
-                location=uesynth_pb2.Vector3(x=x, y=y, z=z)
-            )
-            request = uesynth_pb2.SetObjectTransformRequest(
-                object_name=object_name, transform=transform
+            request = uesynth_pb2.CaptureMultiRequest(
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                **_capture_region(roi, output_size),
+                modalities=_modality_mask(modalities),
+                pixel_format=_pixel_format(pixel_format),
+                segmentation_revision=self.segmentation_table.revision,
+                color_codec=_image_codec(color_codec),
+                data_codec=_image_codec(data_codec),
+                jpeg_quality=jpeg_quality,
             )
 
             action_request = uesynth_pb2.ActionRequest()
-            action_request.set_object_transform.CopyFrom(request)
+            action_request.capture_multi.CopyFrom(request)
 
             return await self.client._send_action(action_request)
 
-        async def spawn(
+        async def cameras(
             self,
-            object_name: str,
-            asset_path: str,
-            x: float = 0,
-            y: float = 0,
-            z: float = 0,
+            camera_names: Sequence[str],
+            modalities: Sequence[str] = ("rgb",),
+            pixel_format: str = "rgba",
+            color_codec: str = "raw",
+            data_codec: str = "raw",
+            jpeg_quality: int = 0,
+            callback: Callable | None = None,
         ) -> str:
-            """Spawn a new object from asset (non-blocking).
+            """Capture several virtual cameras from the same frame (non-blocking).
+
+            The server answers with one multi-image response per camera, all
+            carrying the returned request ID, with camera_name telling them
+            apart. A camera whose readback failed answers with no modalities.
+
+            Args:
+                camera_names: Cameras made with camera.create
+                modalities: "rgb" and/or "depth"; cameras render nothing else
+                pixel_format: Layout of the RGB images: "rgba", "rgb", "bgr" or "gray"
+                color_codec: Codec of the RGB images: "raw", "jpeg", "png", "lz4"
+                    or "zlib"
+                data_codec: Codec of depth: "raw", "lz4" or "zlib"
+                jpeg_quality: JPEG quality in [1, 100] (0 for 85)
+                callback: Optional callback, run once per camera's response
+
+            Returns:
+                Request ID for tracking
+            """
+            request = uesynth_pb2.CaptureCamerasRequest(
+                camera_names=camera_names,
+                modalities=_modality_mask(modalities),
+                pixel_format=_pixel_format(pixel_format),
+                color_codec=_image_codec(color_codec),
+                data_codec=_image_codec(data_codec),
+                jpeg_quality=jpeg_quality,
+            )
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.capture_cameras.CopyFrom(request)
+
+            return await self.client._send_action(
+                action_request, callback, responses=len(camera_names)
+            )
+
+        async def subscribe(
+            self,
+            modalities: Sequence[str] = ("rgb",),
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            pixel_format: str = "rgba",
+            color_codec: str = "raw",
+            data_codec: str = "raw",
+            jpeg_quality: int = 0,
+            rate_hz: float = 0.0,
+            every_n_frames: int = 0,
+            max_queued_frames: int = 0,
+            delta_tile_size: int = 0,
+            keyframe_interval: int = 0,
+            callback: Callable | None = None,
+        ) -> str:
+            """Have the server push captures on its own until unsubscribed.
+
+            The server answers with a command response, then sends
+            subscription_frame responses from its render loop, all carrying the
+            returned ID. get_latest_frame sees the newest RGB frame. When the
+            client falls behind, the server skips frames rather than queueing
+            them and counts them in dropped_frames.
+
+            Args:
+                modalities: Names from CAPTURE_MODALITIES to capture every frame
+                camera_name: Name of the camera to capture from (empty for default)
+                width: Desired image width (0 for default)
+                height: Desired image height (0 for default)
+                pixel_format: Layout of the RGB image: "rgba", "rgb", "bgr" or "gray"
+                color_codec: Codec of the RGB and normals images: "raw", "jpeg",
+                    "png", "lz4" or "zlib"
+                data_codec: Codec of depth, segmentation and optical flow:
+                    "raw", "lz4" or "zlib"
+                jpeg_quality: JPEG quality in [1, 100] (0 for 85)
+                rate_hz: Frames per second; 0 to go by every_n_frames instead
+                every_n_frames: One frame every N rendered ones (0 for every frame)
+                max_queued_frames: Frames that may wait to be written before new
+                    ones are skipped (0 for 1)
+                delta_tile_size: Send only the changed tiles of each image, in
+                    squares of 8 to 256 pixels (0 for whole frames). Whole images
+                    are rebuilt on receipt; JPEG and PNG can't be used with it.
+                keyframe_interval: With delta_tile_size, a whole frame at least
+                    every N frames (0 for 30)
+                callback: Optional callback, run for the reply and every frame
+
+            Returns:
+                Subscription ID for unsubscribe()
+            """
+            request = uesynth_pb2.SubscribeRequest(
+                capture=uesynth_pb2.CaptureMultiRequest(
+                    camera_name=camera_name,
+                    width=width,
+                    height=height,
+                    modalities=_modality_mask(modalities),
+                    pixel_format=_pixel_format(pixel_format),
+                    segmentation_revision=self.segmentation_table.revision,
+                    color_codec=_image_codec(color_codec),
+                    data_codec=_image_codec(data_codec),
+                    jpeg_quality=jpeg_quality,
+                ),
+                rate_hz=rate_hz,
+                every_n_frames=every_n_frames,
+                max_queued_frames=max_queued_frames,
+                delta_tile_size=delta_tile_size,
+                keyframe_interval=keyframe_interval,
+            )
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.subscribe.CopyFrom(request)
+
+            return await self.client._send_action(
+                action_request, callback, responses=None
+            )
+
+        async def unsubscribe(self, subscription_id: str) -> str:
+            """Stop a subscription made by subscribe() (non-blocking).
+
+            Args:
+                subscription_id: The ID subscribe() returned
+
+            Returns:
+                Request ID for tracking
+            """
+            self.client._forget(subscription_id)
+            self.client.delta_frames.discard(subscription_id)
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.unsubscribe.subscription_id = subscription_id
+
+            return await self.client._send_action(action_request)
+
+        # Async unary method for direct RGB capture
+        async def rgb_direct(
+            self,
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            pixel_format: str = "rgba",
+            codec: str = "raw",
+            jpeg_quality: int = 0,
+        ) -> np.ndarray:
+            """Capture RGB image directly (async unary call).
+
+            Args:
+                camera_name: Name of the camera to capture from (empty for default)
+                width: Desired image width (0 for default)
+                height: Desired image height (0 for default)
+                pixel_format: "rgba", "rgb", "bgr" or "gray"
+                codec: "raw", "jpeg", "png", "lz4" or "zlib"; decoded on receipt
+                jpeg_quality: JPEG quality in [1, 100] (0 for 85)
+
+            Returns:
+                Image as an (height, width, channels) numpy array
+            """
+            request = uesynth_pb2.CaptureRequest(
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                pixel_format=_pixel_format(pixel_format),
+                codec=_image_codec(codec),
+                jpeg_quality=jpeg_quality,
+            )
+            response = await self.client.stub.CaptureRgbImage(request)
+            return _decode_image(response)
+
+    class Objects:
+        """Object spawning and manipulation methods."""
+
+        def __init__(self, client: "AsyncUESynthClient") -> None:
+            """Initialize objects controller.
+
+            Args:
+                client: The async client instance
+            """
+            self.client = client
+
+        async def set_location(
+            self, object_name: str, x: float, y: float, z: float
+        ) -> str:
+            """Set object location in 3D space (non-blocking).
+
+            Args:
+                object_name: Name of the object to move
+                x: X coordinate
+                y: Y coordinate
+                z: Z coordinate
+
+            Returns:
+                Request ID for tracking
+            """
+            transform = uesynth_pb2.Transform(
+                location=uesynth_pb2.Vector3(x=x, y=y, z=z)
+            )
+            request = uesynth_pb2.SetObjectTransformRequest(
+                object_name=object_name, transform=transform
+            )
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.set_object_transform.CopyFrom(request)
+
+            return await self.client._send_action(action_request)
+
+        async def spawn(
+            self,
+            object_name: str,
+            asset_path: str,
+            x: float = 0,
+            y: float = 0,
+            z: float = 0,
+            wait_for_asset: bool = True,
+            pooled: bool = False,
+        ) -> str:
+            """Spawn a new object from asset (non-blocking).
 
             Args:
                 object_name: Name for the spawned object
-                asset_path: Path to the asset to spawn
+                asset_path: Object path of a static mesh or actor Blueprint
+                    class, e.g. "/Game/Props/SM_Crate.SM_Crate"
                 x: Initial X coordinate
                 y: Initial Y coordinate
                 z: Initial Z coordinate
+                wait_for_asset: Stream the asset in first if it isn't resident;
+                    otherwise the spawn fails right away. See preload_assets.
+                pooled: Reuse an actor of the same asset parked by destroy, and
+                    park this one when it is destroyed
 
             Returns:
                 Request ID for tracking
@@ -517,6 +2216,8 @@ class AsyncUESynthClient:
                 object_name=object_name,
                 asset_path=asset_path,
                 initial_transform=transform,
+                if_not_resident=_asset_miss_policy(wait_for_asset),
+                pooled=pooled,
             )
 
             action_request = uesynth_pb2.ActionRequest()
@@ -524,6 +2225,278 @@ class AsyncUESynthClient:
 
             return await self.client._send_action(action_request)
 
+        async def preload_assets(
+            self,
+            asset_paths: Sequence[str],
+            wait: bool = False,
+            callback: Callable | None = None,
+        ) -> str:
+            """Stream assets in ahead of the spawns that use them (non-blocking).
+
+            The server keeps loaded assets in a least-recently-used cache
+            within its memory budget. The answer's preload_assets_response has
+            one status per path and is kept as
+            latest_responses["preload_assets"].
+
+            Args:
+                asset_paths: Object paths, as for spawn
+                wait: Answer once every asset is resident or has failed
+                callback: Optional callback to receive the response
+
+            Returns:
+                Request ID for tracking
+            """
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.preload_assets.asset_paths.extend(asset_paths)
+            action_request.preload_assets.wait = wait
+
+            return await self.client._send_action(action_request, callback)
+
+        async def configure_pool(
+            self,
+            max_parked_per_asset: int = 0,
+            clear: bool = False,
+            callback: Callable | None = None,
+        ) -> str:
+            """Limit or clear the pool pooled spawns reuse (non-blocking).
+
+            The answer's actor_pool_stats, with hit and miss counts per asset,
+            is kept as latest_responses["actor_pool"].
+
+            Args:
+                max_parked_per_asset: Actors each asset may keep parked; 0 keeps
+                    the current limit
+                clear: Destroy every parked actor
+                callback: Optional callback to receive the response
+
+            Returns:
+                Request ID for tracking
+            """
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.configure_actor_pool.max_parked_per_asset = (
+                max_parked_per_asset
+            )
+            action_request.configure_actor_pool.clear = clear
+
+            return await self.client._send_action(action_request, callback)
+
+        async def set_material(
+            self,
+            obj: str | int,
+            parameters: Mapping[str | int, MaterialValue],
+            callback: Callable | None = None,
+        ) -> str:
+            """Set material parameters of one object (non-blocking).
+
+            Args:
+                obj: Object name, or registry ID from ``list_all``
+                parameters: Values by parameter name or by ID from
+                    ``resolve_material_parameters``; see ``MaterialValue``
+                callback: Optional callback to receive the response
+
+            Returns:
+                Request ID for tracking
+            """
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.set_material.CopyFrom(_material_request(obj, parameters))
+
+            return await self.client._send_action(action_request, callback)
+
+        async def set_materials_batch(
+            self,
+            updates: Mapping[str | int, Mapping[str | int, MaterialValue]],
+            callback: Callable | None = None,
+        ) -> str:
+            """Set material parameters of many objects in one pass (non-blocking).
+
+            The answer is kept as latest_responses["materials_set"].
+
+            Args:
+                updates: Parameters to set by object name or registry ID
+                callback: Optional callback to receive the response
+
+            Returns:
+                Request ID for tracking
+            """
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.set_materials_batch.objects.extend(
+                _material_request(obj, parameters)
+                for obj, parameters in updates.items()
+            )
+
+            return await self.client._send_action(action_request, callback)
+
+        async def resolve_material_parameters(
+            self, names: Sequence[str], callback: Callable | None = None
+        ) -> str:
+            """Ask for the IDs to send instead of parameter names (non-blocking).
+
+            The answer is kept as latest_responses["material_parameter_ids"].
+
+            Args:
+                names: Material parameter names
+                callback: Optional callback to receive the response
+
+            Returns:
+                Request ID for tracking
+            """
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.resolve_material_parameters.names.extend(names)
+
+            return await self.client._send_action(action_request, callback)
+
+        async def set_light(
+            self,
+            light: str | int,
+            intensity: float | None = None,
+            color: Sequence[float] | None = None,
+            location: Sequence[float] | None = None,
+            rotation: Sequence[float] | None = None,
+            callback: Callable | None = None,
+        ) -> str:
+            """Change the light of an actor (non-blocking).
+
+            Args:
+                light: Name of the light's actor, or its registry ID
+                intensity: New intensity, in the light's own units
+                color: Linear (r, g, b)
+                location: New (x, y, z); the light must be movable
+                rotation: New (pitch, yaw, roll); the light must be movable
+                callback: Optional callback to receive the response
+
+            Returns:
+                Request ID for tracking
+            """
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.set_lighting.CopyFrom(
+                _lighting_request(light, intensity, color, location, rotation)
+            )
+
+            return await self.client._send_action(action_request, callback)
+
+        async def set_lights_batch(
+            self,
+            updates: Mapping[str | int, Mapping[str, Any]],
+            callback: Callable | None = None,
+        ) -> str:
+            """Change many lights in one game-thread pass (non-blocking).
+
+            The answer is kept as latest_responses["lighting_set"].
+
+            Args:
+                updates: ``set_light`` keyword arguments by light name or ID
+                callback: Optional callback to receive the response
+
+            Returns:
+                Request ID for tracking
+            """
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.set_lighting_batch.lights.extend(
+                _lighting_request(light, **update) for light, update in updates.items()
+            )
+
+            return await self.client._send_action(action_request, callback)
+
+        async def set_transforms_batch(
+            self, objects: Sequence[str | int], transforms: np.ndarray
+        ) -> str:
+            """Set many object transforms in one game-thread pass (non-blocking).
+
+            Args:
+                objects: Object names, or registry IDs from ``list_all``
+                transforms: (N, 9) array of location, rotation and scale
+
+            Returns:
+                Request ID for tracking
+            """
+            request = uesynth_pb2.SetObjectTransformsBatchRequest(
+                packed_transforms=_pack_transforms(transforms, len(objects)),
+                **_batch_targets(objects),
+            )
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.set_object_transforms_batch.CopyFrom(request)
+
+            return await self.client._send_action(action_request)
+
+        async def get_transforms_batch(self, objects: Sequence[str | int]) -> str:
+            """Read many object transforms in one game-thread pass (non-blocking).
+
+            Use ``unpack_transforms`` on the response's ``packed_transforms``.
+
+            Args:
+                objects: Object names, or registry IDs from ``list_all``
+
+            Returns:
+                Request ID for tracking
+            """
+            request = uesynth_pb2.GetObjectTransformsBatchRequest(
+                **_batch_targets(objects)
+            )
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.get_object_transforms_batch.CopyFrom(request)
+
+            return await self.client._send_action(action_request)
+
+        async def get_scene_snapshot(
+            self,
+            since_sequence: int = 0,
+            velocities: bool = False,
+            visibility: bool = False,
+            tag: str = "",
+            class_name: str = "",
+            names: bool = False,
+            callback: Callable | None = None,
+        ) -> str:
+            """Read the state of every object, or of those changed (non-blocking).
+
+            The answer is kept as latest_responses["scene_snapshot"], a
+            ``SceneSnapshot`` to apply to a ``SceneState``.
+
+            Args:
+                since_sequence: Sequence of a snapshot already held; 0 for all
+                velocities: Add each object's velocity
+                visibility: Add whether each object was drawn last frame
+                tag: Only objects carrying this actor tag
+                class_name: Only objects of this class or a subclass
+                names: Send object names along with their IDs
+                callback: Optional callback to receive the response
+
+            Returns:
+                Request ID for tracking
+            """
+            request = uesynth_pb2.GetSceneSnapshotRequest(
+                since_sequence=since_sequence,
+                include_velocities=velocities,
+                include_visibility=visibility,
+                tag=tag,
+                class_name=class_name,
+                include_names=names,
+            )
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.get_scene_snapshot.CopyFrom(request)
+
+            return await self.client._send_action(action_request, callback)
+
+        async def list_all(self, tag: str = "", class_name: str = "") -> str:
+            """List scene objects, optionally filtered (non-blocking).
+
+            Args:
+                tag: Only list actors carrying this actor tag
+                class_name: Only list actors of this class or a subclass
+
+            Returns:
+                Request ID for tracking
+            """
+            request = uesynth_pb2.ListObjectsRequest(tag=tag, class_name=class_name)
+
+            action_request = uesynth_pb2.ActionRequest()
+            action_request.list_objects.CopyFrom(request)
+
+            return await self.client._send_action(action_request)
+
         # Async unary method for setting object transform
         async def set_transform_direct(
             self, object_name: str, x: float, y: float, z: float
@@ -551,7 +2524,7 @@ class UESynthClient:
         Args:
             address: The server address in format 'host:port'
         """
-        self.channel = grpc.insecure_channel(address)
+        self.channel = grpc.insecure_channel(address, options=CHANNEL_OPTIONS)
         self.stub = uesynth_pb2_grpc.UESynthServiceStub(self.channel)
         self.camera = self.Camera(self.stub)
         self.capture = self.Capture(self.stub)
@@ -561,6 +2534,188 @@ class UESynthClient:
         """Close the gRPC channel and disconnect from the server."""
         self.channel.close()
 
+    def step(
+        self,
+        actions: Sequence[uesynth_pb2.ActionRequest],
+        modalities: Sequence[str] = (),
+        camera_name: str = "",
+        width: int = 0,
+        height: int = 0,
+        pixel_format: str = "rgba",
+        delta_seconds: float = 0.0,
+        continue_on_error: bool = False,
+        recording_id: str = "",
+    ) -> tuple[uesynth_pb2.StepResponse, dict[str, np.ndarray]]:
+        """Apply several actions, then capture, in one game-thread task.
+
+        Nothing else reaches the scene between the actions and the capture, and
+        the capture renders all of them. By default the step stops at the first
+        failed action, without ticking or capturing.
+
+        Args:
+            actions: ActionRequests to run in order; they can't capture,
+                subscribe or be steps themselves
+            modalities: Names from CAPTURE_MODALITIES to capture afterwards;
+                empty for no capture
+            camera_name: Name of the camera to capture from (empty for default)
+            width: Desired image width (0 for default)
+            height: Desired image height (0 for default)
+            pixel_format: Layout of the RGB image: "rgba", "rgb", "bgr" or "gray"
+            delta_seconds: Seconds to tick the world by before capturing, for
+                deterministic physics; 0 for no tick of its own
+            continue_on_error: Go on with the rest after an action fails
+            recording_id: Write the capture to this recording instead of
+                returning it; the images are then empty
+
+        Returns:
+            The StepResponse, with one result per action run and the errors of
+            those that failed, and its images decoded as by capture.multi()
+        """
+        request = _step_request(
+            actions,
+            modalities,
+            camera_name,
+            width,
+            height,
+            pixel_format,
+            self.capture.segmentation_table.revision,
+            delta_seconds,
+            continue_on_error,
+            recording_id,
+        )
+        response = self.stub.Step(request)
+        self.capture.segmentation_table.update_from(response.images.segmentation)
+        return response, _decode_multi(response.images)
+
+    def set_lockstep(
+        self,
+        enabled: bool,
+        fixed_delta_seconds: float = 0.0,
+        idle_timeout_ms: int = 0,
+    ) -> uesynth_pb2.LockstepState:
+        """Have the engine wait for a step() between frames.
+
+        In lockstep the engine uses a fixed time step and no frame-rate limits,
+        and renders a frame only when a step() lets one through, so datasets
+        are generated as fast as the GPU allows. Other calls still run while it
+        waits; captures outside of a step wait for the next step's frame.
+
+        Args:
+            enabled: Whether to enter or leave lockstep
+            fixed_delta_seconds: World seconds per frame (0 for 1/30)
+            idle_timeout_ms: Leave lockstep once no step has arrived for this
+                long, e.g. if this client goes away (0 for 60 s)
+
+        Returns:
+            The lockstep state after the change
+        """
+        request = uesynth_pb2.SetLockstepRequest(
+            enabled=enabled,
+            fixed_delta_seconds=fixed_delta_seconds,
+            idle_timeout_ms=idle_timeout_ms,
+        )
+        return self.stub.SetLockstep(request)
+
+    def start_recording(
+        self,
+        recording_id: str,
+        directory: str = "",
+        modalities: Sequence[str] = (),
+        camera_name: str = "",
+        width: int = 0,
+        height: int = 0,
+        pixel_format: str = "rgba",
+        rate_hz: float = 0.0,
+        every_n_frames: int = 0,
+        max_queued_frames: int = 0,
+        frames_per_shard: int = 0,
+    ) -> uesynth_pb2.RecordingStats:
+        """Write frames to disk on the server instead of sending them.
+
+        Frames wait for a writer thread of the server's, so the engine never
+        waits for the disk; when it can't keep up, frames are dropped and
+        counted. Open the directory with Recording once stopped, or meanwhile.
+
+        Args:
+            recording_id: Names the recording for step() and stop_recording()
+            directory: Where to write it, created if missing: a relative
+                path under the project's Saved/UESynth/Recordings (empty for
+                recording_id there); absolute paths and ones leading out of it
+                are refused. It must not hold a recording yet.
+            modalities: Names from CAPTURE_MODALITIES to record from the render
+                loop; empty to only record the steps that name it
+            camera_name: Name of the camera to record from (empty for default)
+            width: Desired image width (0 for default)
+            height: Desired image height (0 for default)
+            pixel_format: Layout of the RGB image: "rgba", "rgb", "bgr" or "gray"
+            rate_hz: Frames per second; 0 to go by every_n_frames instead
+            every_n_frames: One frame every N rendered ones (0 for every frame)
+            max_queued_frames: Frames that may wait for the disk before new
+                ones are dropped (0 for 8)
+            frames_per_shard: Frames per shard file (0 for 1000)
+
+        Returns:
+            The recording's stats, with the absolute directory it writes to
+        """
+        request = _recording_request(
+            recording_id,
+            directory,
+            modalities,
+            camera_name,
+            width,
+            height,
+            pixel_format,
+            rate_hz,
+            every_n_frames,
+            max_queued_frames,
+            frames_per_shard,
+        )
+        return self.stub.StartRecording(request)
+
+    def stop_recording(self, recording_id: str) -> uesynth_pb2.RecordingStats:
+        """Stop a recording once its queued frames are written.
+
+        Args:
+            recording_id: The ID given to start_recording()
+
+        Returns:
+            The final stats: frames written and dropped, bytes and shards
+        """
+        request = uesynth_pb2.StopRecordingRequest(recording_id=recording_id)
+        return self.stub.StopRecording(request)
+
+    def get_server_stats(self, reset: bool = False) -> uesynth_pb2.ServerStats:
+        """Get the server's latency histograms and queue depths.
+
+        Every RPC and stream action is timed from arrival until it is answered,
+        and captures are split into stages (queue_wait, game_thread, readback,
+        pixel_convert, encode, write). Answered without waiting for the game
+        thread, so it also shows what a stalled server is stuck on.
+
+        Args:
+            reset: Start every histogram over once this snapshot is taken
+
+        Returns:
+            Per-RPC and per-stage latency histograms and the current gauges
+        """
+        request = uesynth_pb2.GetServerStatsRequest(reset=reset)
+        return self.stub.GetServerStats(request)
+
+    def get_health(self, timeout: float | None = None) -> uesynth_pb2.HealthStatus:
+        """Ask whether the server can take work and how busy it is.
+
+        Answered from what the game thread saw on its last frame, without
+        waiting for it, so it is cheap to poll across a fleet and still
+        answers, as not ready, while the engine is stalled.
+
+        Args:
+            timeout: Seconds to wait for the answer; None waits indefinitely
+
+        Returns:
+            Readiness, fps, command queue depth and calls in flight
+        """
+        return self.stub.GetHealth(uesynth_pb2.HealthRequest(), timeout=timeout)
+
     class Camera:
         """Camera control and manipulation methods."""
 
@@ -637,9 +2792,13 @@ class UESynthClient:
             pitch: float = 0,
             yaw: float = 0,
             roll: float = 0,
+            width: int = 0,
+            height: int = 0,
         ) -> Any:
             """Create a new camera with specified transform.
 
+            The camera renders only when a capture names it in camera_name.
+
             Args:
                 camera_name: Name for the new camera
                 x: Initial X coordinate
@@ -648,6 +2807,8 @@ class UESynthClient:
                 pitch: Initial pitch rotation in degrees
                 yaw: Initial yaw rotation in degrees
                 roll: Initial roll rotation in degrees
+                width: Capture width (0 for the game viewport's)
+                height: Capture height (0 for the game viewport's)
 
             Returns:
                 gRPC response object
@@ -657,10 +2818,46 @@ class UESynthClient:
                 rotation=uesynth_pb2.Rotator(pitch=pitch, yaw=yaw, roll=roll),
             )
             request = uesynth_pb2.CreateCameraRequest(
-                camera_name=camera_name, initial_transform=transform
+                camera_name=camera_name,
+                initial_transform=transform,
+                width=width,
+                height=height,
             )
             return self.stub.CreateCamera(request)
 
+        def destroy(self, camera_name: str) -> Any:
+            """Destroy a camera made by create.
+
+            Args:
+                camera_name: Name of the camera
+
+            Returns:
+                gRPC response object
+            """
+            request = uesynth_pb2.DestroyCameraRequest(camera_name=camera_name)
+            return self.stub.DestroyCamera(request)
+
+        def set_resolution(
+            self, camera_name: str, width: int = 0, height: int = 0
+        ) -> Any:
+            """Change the capture size of a camera made by create.
+
+            Render targets are pooled by size, so switching to a size another
+            camera has used recently doesn't allocate.
+
+            Args:
+                camera_name: Name of the camera
+                width: New width (0 keeps the current one)
+                height: New height (0 keeps the current one)
+
+            Returns:
+                gRPC response object
+            """
+            request = uesynth_pb2.SetResolutionRequest(
+                camera_name=camera_name, width=width, height=height
+            )
+            return self.stub.SetResolution(request)
+
     class Capture:
         """Image and data capture methods."""
 
@@ -671,9 +2868,19 @@ class UESynthClient:
                 stub: The gRPC service stub
             """
             self.stub = stub
+            # Segmentation ID -> object name, as of the last segmentation capture
+            self.segmentation_table = SegmentationTable()
 
         def rgb(
-            self, camera_name: str = "", width: int = 0, height: int = 0
+            self,
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            pixel_format: str = "rgba",
+            codec: str = "raw",
+            jpeg_quality: int = 0,
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
         ) -> np.ndarray:
             """Capture RGB image from camera.
 
@@ -681,21 +2888,41 @@ class UESynthClient:
                 camera_name: Name of the camera to capture from (empty for default)
                 width: Desired image width (0 for default)
                 height: Desired image height (0 for default)
+                pixel_format: "rgba", "rgb", "bgr" or "gray"; the server only
+                    sends the channels asked for
+                codec: "raw", "jpeg", "png", "lz4" or "zlib"; decoded on receipt
+                jpeg_quality: JPEG quality in [1, 100] (0 for 85)
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
 
             Returns:
-                RGB image as numpy array
+                Image as an (height, width, channels) numpy array
             """
             request = uesynth_pb2.CaptureRequest(
-                camera_name=camera_name, width=width, height=height
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                **_capture_region(roi, output_size),
+                pixel_format=_pixel_format(pixel_format),
+                codec=_image_codec(codec),
+                jpeg_quality=jpeg_quality,
             )
             response = self.stub.CaptureRgbImage(request)
-            image = np.frombuffer(response.image_data, dtype=np.uint8).reshape(
-                response.height, response.width, -1
-            )
-            return image
+            return _decode_image(response)
 
         def depth(
-            self, camera_name: str = "", width: int = 0, height: int = 0
+            self,
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            encoding: str = "float32",
+            near: float = 0.0,
+            far: float = 0.0,
+            codec: str = "raw",
+            dequantize: bool = False,
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
         ) -> np.ndarray:
             """Capture depth map from camera.
 
@@ -703,21 +2930,42 @@ class UESynthClient:
                 camera_name: Name of the camera to capture from (empty for default)
                 width: Desired image width (0 for default)
                 height: Desired image height (0 for default)
+                encoding: "float32", "float16" or "uint16"
+                near: Start of the uint16 range in cm
+                far: End of the uint16 range in cm; leaving near and far at 0
+                    quantizes 0 to 6553.5 cm in 1 mm steps
+                codec: "raw", "lz4" or "zlib"; decoded on receipt
+                dequantize: Convert the result to float32 cm
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
 
             Returns:
-                Depth map as numpy array
+                (height, width) view-space depth in the dtype of the encoding:
+                cm for floats, steps of the near..far range for uint16
             """
             request = uesynth_pb2.CaptureRequest(
-                camera_name=camera_name, width=width, height=height
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                **_capture_region(roi, output_size),
+                depth_encoding=_depth_encoding(encoding),
+                depth_near=near,
+                depth_far=far,
+                codec=_image_codec(codec),
             )
             response = self.stub.CaptureDepthMap(request)
-            image = np.frombuffer(response.image_data, dtype=np.uint8).reshape(
-                response.height, response.width, -1
-            )
-            return image
+            depth = _decode_image(response)
+            return dequantize_depth(depth, response.format) if dequantize else depth
 
         def segmentation(
-            self, camera_name: str = "", width: int = 0, height: int = 0
+            self,
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            codec: str = "raw",
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
         ) -> np.ndarray:
             """Capture segmentation mask from camera.
 
@@ -725,18 +2973,163 @@ class UESynthClient:
                 camera_name: Name of the camera to capture from (empty for default)
                 width: Desired image width (0 for default)
                 height: Desired image height (0 for default)
+                codec: "raw", "lz4" or "zlib"; decoded on receipt
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
 
             Returns:
-                Segmentation mask as numpy array
+                (height, width) uint8 segmentation IDs; segmentation_table maps
+                them to object names, and 0 is background or unregistered actors
             """
             request = uesynth_pb2.CaptureRequest(
-                camera_name=camera_name, width=width, height=height
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                **_capture_region(roi, output_size),
+                segmentation_revision=self.segmentation_table.revision,
+                codec=_image_codec(codec),
             )
             response = self.stub.CaptureSegmentationMask(request)
-            image = np.frombuffer(response.image_data, dtype=np.uint8).reshape(
-                response.height, response.width, -1
+            self.segmentation_table.update_from(response)
+            return _decode_image(response)
+
+        def optical_flow(
+            self,
+            width: int = 0,
+            height: int = 0,
+            codec: str = "raw",
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
+        ) -> np.ndarray:
+            """Capture the optical flow of the game view.
+
+            Objects only report their own motion while the velocity pass runs,
+            which it does with TAA or TSR; other pixels get the camera's motion.
+
+            Args:
+                width: Desired image width (0 for default)
+                height: Desired image height (0 for default)
+                codec: "raw", "lz4" or "zlib"; decoded on receipt
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU;
+                    the flow is measured in the scaled image's pixels
+
+            Returns:
+                (height, width, 2) float16 motion since the previous frame in
+                pixels, x right and y down, aligned with an rgb capture of the
+                same size
+            """
+            request = uesynth_pb2.CaptureRequest(
+                width=width,
+                height=height,
+                codec=_image_codec(codec),
+                **_capture_region(roi, output_size),
             )
-            return image
+            response = self.stub.CaptureOpticalFlow(request)
+            return _decode_image(response)
+
+        def multi(
+            self,
+            modalities: Sequence[str] = ("rgb", "depth", "normals"),
+            camera_name: str = "",
+            width: int = 0,
+            height: int = 0,
+            pixel_format: str = "rgba",
+            color_codec: str = "raw",
+            data_codec: str = "raw",
+            jpeg_quality: int = 0,
+            roi: tuple[int, int, int, int] | None = None,
+            output_size: tuple[int, int] | None = None,
+        ) -> dict[str, np.ndarray]:
+            """Capture several modalities from one rendered frame.
+
+            Args:
+                modalities: Names from CAPTURE_MODALITIES; nothing else is read back
+                camera_name: Name of the camera to capture from (empty for default)
+                width: Desired image width (0 for default)
+                height: Desired image height (0 for default)
+                pixel_format: Layout of the RGB image: "rgba", "rgb", "bgr" or "gray"
+                color_codec: Codec of the RGB and normals images: "raw", "jpeg",
+                    "png", "lz4" or "zlib"
+                data_codec: Codec of depth, segmentation and optical flow:
+                    "raw", "lz4" or "zlib"
+                jpeg_quality: JPEG quality in [1, 100] (0 for 85)
+                roi: (x, y, width, height) of the view to capture instead of
+                    width x height from its top-left corner
+                output_size: (width, height) to scale the region to on the GPU
+
+            Returns:
+                Arrays keyed by modality name, for the modalities the server
+                captured. Depth is (height, width) float32 in cm and segmentation
+                (height, width) uint8 IDs; the others are uint8 (height, width,
+                channels). Scene textures come back at render resolution, which
+                can be smaller than the RGB image, unless output_size is set.
+            """
+            request = uesynth_pb2.CaptureMultiRequest(
+                camera_name=camera_name,
+                width=width,
+                height=height,
+                **_capture_region(roi, output_size),
+                modalities=_modality_mask(modalities),
+                pixel_format=_pixel_format(pixel_format),
+                segmentation_revision=self.segmentation_table.revision,
+                color_codec=_image_codec(color_codec),
+                data_codec=_image_codec(data_codec),
+                jpeg_quality=jpeg_quality,
+            )
+            response = self.stub.CaptureMulti(request)
+            self.segmentation_table.update_from(response.segmentation)
+            return _decode_multi(response)
+
+        def cameras(
+            self,
+            camera_names: Sequence[str],
+            modalities: Sequence[str] = ("rgb",),
+            pixel_format: str = "rgba",
+            color_codec: str = "raw",
+            data_codec: str = "raw",
+            jpeg_quality: int = 0,
+        ) -> dict[str, dict[str, np.ndarray]]:
+            """Capture several virtual cameras from the same rendered frame.
+
+            One round trip for the whole rig: the cameras render together and
+            are read back together, instead of one capture call per camera.
+
+            Args:
+                camera_names: Cameras made with camera.create
+                modalities: "rgb" and/or "depth"; cameras render nothing else
+                pixel_format: Layout of the RGB images: "rgba", "rgb", "bgr" or "gray"
+                color_codec: Codec of the RGB images: "raw", "jpeg", "png", "lz4"
+                    or "zlib"
+                data_codec: Codec of depth: "raw", "lz4" or "zlib"
+                jpeg_quality: JPEG quality in [1, 100] (0 for 85)
+
+            Returns:
+                Per camera name, arrays keyed by modality name as in multi().
+                Empty if the server rejected the request, e.g. for an unknown
+                camera.
+            """
+            request = uesynth_pb2.CaptureCamerasRequest(
+                camera_names=camera_names,
+                modalities=_modality_mask(modalities),
+                pixel_format=_pixel_format(pixel_format),
+                color_codec=_image_codec(color_codec),
+                data_codec=_image_codec(data_codec),
+                jpeg_quality=jpeg_quality,
+            )
+            action_request = uesynth_pb2.ActionRequest(
+                request_id=str(uuid.uuid4()), capture_cameras=request
+            )
+
+            # Only streamed actions answer more than once, so this one call
+            # goes through its own short-lived ControlStream
+            images = {}
+            for response in self.stub.ControlStream(iter([action_request])):
+                reply = response.multi_image_response
+                images[reply.camera_name] = _decode_multi(reply)
+            return images
 
     class Objects:
         """Object spawning and manipulation methods."""
@@ -781,6 +3174,111 @@ class UESynthClient:
             request = uesynth_pb2.GetObjectTransformRequest(object_name=object_name)
             return self.stub.GetObjectTransform(request)
 
+        def list_all(self, tag: str = "", class_name: str = "") -> list[str]:
+            """List the names of scene objects, optionally filtered.
+
+            Args:
+                tag: Only list actors carrying this actor tag
+                class_name: Only list actors of this class or a subclass
+
+            Returns:
+                Object names
+            """
+            request = uesynth_pb2.ListObjectsRequest(tag=tag, class_name=class_name)
+            return list(self.stub.ListObjects(request).object_names)
+
+        def set_transforms_batch(
+            self, objects: Sequence[str | int], transforms: np.ndarray
+        ) -> Any:
+            """Set many object transforms in one game-thread pass.
+
+            Args:
+                objects: Object names, or registry IDs from the server
+                transforms: (N, 9) array of location, rotation and scale
+
+            Returns:
+                gRPC response with the applied count and failed indices
+            """
+            request = uesynth_pb2.SetObjectTransformsBatchRequest(
+                packed_transforms=_pack_transforms(transforms, len(objects)),
+                **_batch_targets(objects),
+            )
+            return self.stub.SetObjectTransformsBatch(request)
+
+        def get_transforms_batch(self, objects: Sequence[str | int]) -> np.ndarray:
+            """Read many object transforms in one game-thread pass.
+
+            Args:
+                objects: Object names, or registry IDs from the server
+
+            Returns:
+                (N, 9) float32 array; identity rows for objects that were not found
+            """
+            request = uesynth_pb2.GetObjectTransformsBatchRequest(
+                **_batch_targets(objects)
+            )
+            response = self.stub.GetObjectTransformsBatch(request)
+            return unpack_transforms(response.packed_transforms)
+
+        def get_scene_snapshot(
+            self,
+            since_sequence: int = 0,
+            velocities: bool = False,
+            visibility: bool = False,
+            tag: str = "",
+            class_name: str = "",
+            names: bool = False,
+        ) -> uesynth_pb2.SceneSnapshot:
+            """Read the state of every object, or of those changed, in one call.
+
+            Pass the ``sequence`` of a snapshot already held as since_sequence
+            to get only objects added, moved or removed since, or apply each
+            snapshot to a ``SceneState`` to keep a whole copy current.
+
+            Args:
+                since_sequence: Sequence of a snapshot already held; 0 for all
+                velocities: Add each object's velocity
+                visibility: Add whether each object was drawn last frame
+                tag: Only objects carrying this actor tag
+                class_name: Only objects of this class or a subclass
+                names: Send object names along with their IDs
+
+            Returns:
+                The snapshot; ``unpack_scene_state`` turns it into arrays
+            """
+            request = uesynth_pb2.GetSceneSnapshotRequest(
+                since_sequence=since_sequence,
+                include_velocities=velocities,
+                include_visibility=visibility,
+                tag=tag,
+                class_name=class_name,
+                include_names=names,
+            )
+            return self.stub.GetSceneSnapshot(request)
+
+        def find_by_class(self, class_name: str) -> list[str]:
+            """List the names of objects of an Unreal Engine class.
+
+            Args:
+                class_name: Class name such as "StaticMeshActor"
+
+            Returns:
+                Object names
+            """
+            return self.list_all(class_name=class_name)
+
+        def destroy(self, object_name: str) -> Any:
+            """Destroy an object.
+
+            Args:
+                object_name: Name of the object
+
+            Returns:
+                gRPC response object
+            """
+            request = uesynth_pb2.DestroyObjectRequest(object_name=object_name)
+            return self.stub.DestroyObject(request)
+
         def spawn(
             self,
             object_name: str,
@@ -788,15 +3286,22 @@ class UESynthClient:
             x: float = 0,
             y: float = 0,
             z: float = 0,
+            wait_for_asset: bool = True,
+            pooled: bool = False,
         ) -> Any:
             """Spawn a new object from asset.
 
             Args:
                 object_name: Name for the spawned object
-                asset_path: Path to the asset to spawn
+                asset_path: Object path of a static mesh or actor Blueprint
+                    class, e.g. "/Game/Props/SM_Crate.SM_Crate"
                 x: Initial X coordinate
                 y: Initial Y coordinate
                 z: Initial Z coordinate
+                wait_for_asset: Stream the asset in first if it isn't resident;
+                    otherwise the spawn fails right away. See preload_assets.
+                pooled: Reuse an actor of the same asset parked by destroy, and
+                    park this one when it is destroyed
 
             Returns:
                 gRPC response object
@@ -808,9 +3313,333 @@ class UESynthClient:
                 object_name=object_name,
                 asset_path=asset_path,
                 initial_transform=transform,
+                if_not_resident=_asset_miss_policy(wait_for_asset),
+                pooled=pooled,
             )
             return self.stub.SpawnObject(request)
 
+        def preload_assets(
+            self, asset_paths: Sequence[str], wait: bool = False
+        ) -> uesynth_pb2.PreloadAssetsResponse:
+            """Stream assets in ahead of the spawns that use them.
+
+            The server keeps loaded assets in a least-recently-used cache
+            within its memory budget.
+
+            Args:
+                asset_paths: Object paths, as for spawn
+                wait: Answer once every asset is resident or has failed
+
+            Returns:
+                One status per path, in order, and the cache's totals
+            """
+            request = uesynth_pb2.PreloadAssetsRequest(
+                asset_paths=asset_paths, wait=wait
+            )
+            return self.stub.PreloadAssets(request)
+
+        def configure_pool(
+            self, max_parked_per_asset: int = 0, clear: bool = False
+        ) -> uesynth_pb2.ActorPoolStats:
+            """Limit or clear the pool pooled spawns reuse.
+
+            Args:
+                max_parked_per_asset: Actors each asset may keep parked; 0 keeps
+                    the current limit
+                clear: Destroy every parked actor
+
+            Returns:
+                The pool's limit, size and hit and miss counts per asset
+            """
+            request = uesynth_pb2.ConfigureActorPoolRequest(
+                max_parked_per_asset=max_parked_per_asset, clear=clear
+            )
+            return self.stub.ConfigureActorPool(request)
+
+        def set_material(
+            self, obj: str | int, parameters: Mapping[str | int, MaterialValue]
+        ) -> Any:
+            """Set material parameters of one object.
+
+            Every material slot of the object's meshes gets the values. A
+            texture must be loaded already, for instance by ``preload_assets``.
+
+            Args:
+                obj: Object name, or registry ID from the server
+                parameters: Values by parameter name or by ID from
+                    ``resolve_material_parameters``; see ``MaterialValue``
+
+            Returns:
+                gRPC response with success status
+            """
+            return self.stub.SetMaterial(_material_request(obj, parameters))
+
+        def set_materials_batch(
+            self, updates: Mapping[str | int, Mapping[str | int, MaterialValue]]
+        ) -> Any:
+            """Set material parameters of many objects in one game-thread pass.
+
+            Args:
+                updates: Parameters to set by object name or registry ID
+
+            Returns:
+                gRPC response with the applied count and failed indices, in the
+                order of ``updates``
+            """
+            request = uesynth_pb2.SetMaterialsBatchRequest(
+                objects=[
+                    _material_request(obj, parameters)
+                    for obj, parameters in updates.items()
+                ]
+            )
+            return self.stub.SetMaterialsBatch(request)
+
+        def resolve_material_parameters(self, names: Sequence[str]) -> list[int]:
+            """Get the IDs to send instead of parameter names.
+
+            IDs hold for as long as the server runs, so a randomization loop
+            resolves its names once.
+
+            Args:
+                names: Material parameter names
+
+            Returns:
+                One ID per name, in order
+            """
+            request = uesynth_pb2.ResolveMaterialParametersRequest(names=names)
+            return list(self.stub.ResolveMaterialParameters(request).ids)
+
+        def set_light(
+            self,
+            light: str | int,
+            intensity: float | None = None,
+            color: Sequence[float] | None = None,
+            location: Sequence[float] | None = None,
+            rotation: Sequence[float] | None = None,
+        ) -> Any:
+            """Change the light of an actor; values left out stay as they are.
+
+            Args:
+                light: Name of the light's actor, or its registry ID
+                intensity: New intensity, in the light's own units
+                color: Linear (r, g, b)
+                location: New (x, y, z); the light must be movable
+                rotation: New (pitch, yaw, roll); the light must be movable
+
+            Returns:
+                gRPC response with success status
+            """
+            return self.stub.SetLighting(
+                _lighting_request(light, intensity, color, location, rotation)
+            )
+
+        def set_lights_batch(
+            self, updates: Mapping[str | int, Mapping[str, Any]]
+        ) -> Any:
+            """Change many lights in one game-thread pass.
+
+            Args:
+                updates: ``set_light`` keyword arguments by light name or ID
+
+            Returns:
+                gRPC response with the applied count and failed indices, in the
+                order of ``updates``
+            """
+            request = uesynth_pb2.SetLightingBatchRequest(
+                lights=[
+                    _lighting_request(light, **update)
+                    for light, update in updates.items()
+                ]
+            )
+            return self.stub.SetLightingBatch(request)
+
+
+
+def read_registrations(directory: str) -> list[dict[str, Any]]:
+    """Read the files instances started with a RegistrationDir keep there.
+
+    Each instance writes ``uesynth-<pid>.json`` while it serves, with the
+    ``address`` to connect to, ``pid``, ``hostname`` and ``metrics_port``. A
+    crashed instance leaves its file behind, so check what is listed with
+    ``get_health()``.
+
+    Args:
+        directory: The RegistrationDir the instances were started with
+
+    Returns:
+        The registrations, by file name
+    """
+    registrations = []
+    for name in sorted(os.listdir(directory)):
+        if not (name.startswith("uesynth-") and name.endswith(".json")):
+            continue
+        try:
+            with open(os.path.join(directory, name), encoding="utf-8") as file:
+                registrations.append(json.load(file))
+        except (OSError, ValueError):  # Removed or replaced while listing
+            continue
+    return registrations
+
+
+class UESynthPool:
+    """Episodes spread across a fleet of UESynth instances by their load.
+
+    Every instance gets a UESynthClient of its own. ``episode()`` hands out the
+    ready instance with the least work: the commands queued and calls in
+    flight its GetHealth reports, plus the episodes this pool runs on it. The
+    health is polled again once it is older than ``health_interval``, and with
+    a ``registration_dir`` instances that start or stop later are picked up
+    too. Safe to share between threads.
+    """
+
+    def __init__(
+        self,
+        addresses: Sequence[str] = (),
+        registration_dir: str | None = None,
+        health_timeout: float = 1.0,
+        health_interval: float = 0.5,
+    ) -> None:
+        """Connect to every instance and poll its health.
+
+        Args:
+            addresses: 'host:port' of instances to always include
+            registration_dir: RegistrationDir the instances were started with
+            health_timeout: Seconds an instance has to answer GetHealth before
+                it counts as down until the next poll
+            health_interval: Seconds the latest health is used for
+        """
+        if not addresses and registration_dir is None:
+            raise ValueError("UESynthPool needs addresses or a registration_dir")
+        self.addresses = list(addresses)
+        self.registration_dir = registration_dir
+        self.health_timeout = health_timeout
+        self.health_interval = health_interval
+        self.clients: dict[str, UESynthClient] = {}
+        self._health: dict[str, uesynth_pb2.HealthStatus | None] = {}
+        self._episodes: dict[str, int] = {}
+        self._polled = 0.0
+        self._lock = threading.Lock()
+        self.refresh()
+
+    def refresh(self) -> dict[str, uesynth_pb2.HealthStatus | None]:
+        """Find the instances again and poll the health of each.
+
+        Returns:
+            The health of every instance by address; None for one that didn't
+            answer
+        """
+        addresses = list(self.addresses)
+        if self.registration_dir is not None:
+            addresses += [
+                r["address"] for r in read_registrations(self.registration_dir)
+            ]
+        with self._lock:
+            for address in addresses:
+                if address not in self.clients:
+                    self.clients[address] = UESynthClient(address)
+                    self._episodes[address] = 0
+            # An instance that unregistered stays until its episodes are done
+            gone = [
+                address
+                for address in self.clients
+                if address not in addresses and self._episodes[address] == 0
+            ]
+            for address in gone:
+                self.clients.pop(address).disconnect()
+                del self._episodes[address]
+            clients = dict(self.clients)
+
+        health: dict[str, uesynth_pb2.HealthStatus | None] = {}
+        for address, client in clients.items():
+            try:
+                health[address] = client.get_health(timeout=self.health_timeout)
+            except grpc.RpcError:
+                health[address] = None
+        with self._lock:
+            self._health = health
+            self._polled = time.monotonic()
+        return health
+
+    def _load(self, address: str) -> int:
+        health = self._health[address]
+        assert health is not None
+        return (
+            self._episodes[address]
+            + health.command_queue_depth
+            + health.calls_in_flight
+        )
+
+    def acquire(self) -> tuple[str, UESynthClient]:
+        """Take the least loaded ready instance for an episode.
+
+        Returns:
+            The instance's address, to ``release()`` it with, and its client
+
+        Raises:
+            RuntimeError: If no instance is ready
+        """
+        if time.monotonic() - self._polled > self.health_interval:
+            self.refresh()
+        with self._lock:
+            ready = [
+                address
+                for address, health in self._health.items()
+                if health is not None and health.ready and address in self.clients
+            ]
+            if not ready:
+                raise RuntimeError("No UESynth instance is ready")
+            address = min(ready, key=lambda a: (self._load(a), -self._health[a].fps))
+            self._episodes[address] += 1
+            return address, self.clients[address]
+
+    def release(self, address: str) -> None:
+        """Hand back an instance ``acquire()`` returned, once its episode ended."""
+        with self._lock:
+            if address in self._episodes:
+                self._episodes[address] -= 1
+
+    @contextlib.contextmanager
+    def episode(self) -> Iterator[UESynthClient]:
+        """Run an episode on the least loaded ready instance.
+
+        Yields:
+            The instance's client, counted against it until the block exits
+        """
+        address, client = self.acquire()
+        try:
+            yield client
+        finally:
+            self.release(address)
+
+    def close(self) -> None:
+        """Disconnect from every instance."""
+        with self._lock:
+            for client in self.clients.values():
+                client.disconnect()
+            self.clients.clear()
+            self._episodes.clear()
+            self._health = {}
+
+    def __enter__(self) -> "UESynthPool":
+        return self
+
+    def __exit__(self, *exc_info: Any) -> None:
+        self.close()
+
 
 # Export both clients for different use cases
-__all__ = ["UESynthClient", "AsyncUESynthClient"]
+__all__ = [
+    "UESynthClient",
+    "AsyncUESynthClient",
+    "UESynthPool",
+    "CAPTURE_MODALITIES",
+    "DEPTH_ENCODINGS",
+    "MaterialValue",
+    "PIXEL_FORMATS",
+    "SceneState",
+    "SegmentationTable",
+    "dequantize_depth",
+    "read_registrations",
+    "unpack_scene_state",
+    "unpack_transforms",
+]
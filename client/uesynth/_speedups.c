@@ -0,0 +1,123 @@
+// Copyright (c) 2025 UESynth Project
+// SPDX-License-Identifier: MIT
+
+// Optional decoding helpers for FramePool: unpack image payloads straight into
+// preallocated buffers, without the GIL and without an intermediate bytes
+// object. The client falls back to numpy and zlib when this isn't built.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <string.h>
+#include <zlib.h>
+
+static int get_buffers(PyObject *args, const char *name, Py_buffer *dst,
+                       Py_buffer *src) {
+  if (!PyArg_ParseTuple(args, "w*y*", dst, src)) {
+    return -1;
+  }
+  if (!PyBuffer_IsContiguous(dst, 'C')) {
+    PyErr_Format(PyExc_ValueError, "%s: destination must be contiguous",
+                 name);
+    PyBuffer_Release(dst);
+    PyBuffer_Release(src);
+    return -1;
+  }
+  return 0;
+}
+
+PyDoc_STRVAR(copy_into_doc,
+             "copy_into(dst, src) -> None\n\n"
+             "Copy src into dst, which must be exactly as large.");
+
+static PyObject *copy_into(PyObject *Py_UNUSED(self), PyObject *args) {
+  Py_buffer dst, src;
+  if (get_buffers(args, "copy_into", &dst, &src) < 0) {
+    return NULL;
+  }
+  if (dst.len != src.len) {
+    PyErr_Format(PyExc_ValueError, "copy_into: %zd bytes into %zd", src.len,
+                 dst.len);
+    PyBuffer_Release(&dst);
+    PyBuffer_Release(&src);
+    return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  memcpy(dst.buf, src.buf, (size_t)src.len);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&dst);
+  PyBuffer_Release(&src);
+  Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(inflate_into_doc,
+             "inflate_into(dst, src) -> None\n\n"
+             "Decompress the zlib stream src into dst, which it must fill "
+             "exactly.");
+
+static PyObject *inflate_into(PyObject *Py_UNUSED(self), PyObject *args) {
+  Py_buffer dst, src;
+  if (get_buffers(args, "inflate_into", &dst, &src) < 0) {
+    return NULL;
+  }
+
+  // The sizes are checked against zlib's uInt; frames are far below 4 GiB
+  if ((size_t)dst.len > UINT_MAX || (size_t)src.len > UINT_MAX) {
+    PyErr_SetString(PyExc_OverflowError, "inflate_into: buffer too large");
+    PyBuffer_Release(&dst);
+    PyBuffer_Release(&src);
+    return NULL;
+  }
+
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  stream.next_in = (Bytef *)src.buf;
+  stream.avail_in = (uInt)src.len;
+  stream.next_out = (Bytef *)dst.buf;
+  stream.avail_out = (uInt)dst.len;
+
+  int result;
+  Py_BEGIN_ALLOW_THREADS
+  result = inflateInit(&stream);
+  if (result == Z_OK) {
+    result = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+  }
+  Py_END_ALLOW_THREADS
+
+  const uLong written = stream.total_out;
+  const Py_ssize_t expected = dst.len;
+  PyBuffer_Release(&dst);
+  PyBuffer_Release(&src);
+  if (result != Z_STREAM_END) {
+    PyErr_Format(PyExc_ValueError, "inflate_into: %s",
+                 result == Z_BUF_ERROR ? "payload larger than the destination"
+                                       : "corrupt zlib stream");
+    return NULL;
+  }
+  if (written != (uLong)expected) {
+    PyErr_Format(PyExc_ValueError, "inflate_into: %lu bytes into %zd",
+                 written, expected);
+    return NULL;
+  }
+  Py_RETURN_NONE;
+}
+
+static PyMethodDef speedups_methods[] = {
+    {"copy_into", copy_into, METH_VARARGS, copy_into_doc},
+    {"inflate_into", inflate_into, METH_VARARGS, inflate_into_doc},
+    {NULL, NULL, 0, NULL},
+};
+
+static struct PyModuleDef speedups_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "uesynth._speedups",
+    .m_doc = "Optional image decoding helpers for the UESynth client.",
+    .m_size = -1,
+    .m_methods = speedups_methods,
+};
+
+PyMODINIT_FUNC PyInit__speedups(void) {
+  return PyModule_Create(&speedups_module);
+}
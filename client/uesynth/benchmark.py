@@ -0,0 +1,527 @@
+# Copyright (c) 2025 UESynth Project
+# SPDX-License-Identifier: MIT
+
+"""End-to-end benchmarks of a running UESynth server.
+
+Measures RPC round-trip latency over unary calls and the ControlStream,
+transform throughput across batch sizes, and capture frame rates across a
+resolution x modality x camera-count matrix. Results are written as JSON, and a
+run compared against the results of an earlier plugin release reports every
+metric that got worse by more than a tolerance:
+
+    python -m uesynth.benchmark --address localhost:50051 --output new.json
+    python -m uesynth.benchmark --baseline old.json --tolerance 0.1
+
+The scene is left as it was found: transforms are written back unchanged, and
+the cameras the capture benchmarks create are destroyed again.
+"""
+
+import argparse
+import json
+import platform
+import queue
+import sys
+import time
+from collections.abc import Callable, Iterator, Mapping, Sequence
+from datetime import UTC, datetime
+from typing import Any
+
+import grpc
+import numpy as np
+
+from uesynth import CAPTURE_MODALITIES, CHANNEL_OPTIONS, uesynth_pb2, uesynth_pb2_grpc
+
+# Bumped whenever results change shape, so old baselines aren't misread
+SCHEMA_VERSION = 1
+
+DEFAULT_BATCH_SIZES = (1, 10, 100, 1000)
+DEFAULT_RESOLUTIONS = ((640, 480), (1280, 720), (1920, 1080))
+DEFAULT_MODALITY_SETS = (("rgb",), ("rgb", "depth"), ("rgb", "depth", "segmentation"))
+# 0 captures the game view; more captures that many pooled cameras per frame
+DEFAULT_CAMERA_COUNTS = (0, 1, 4)
+# Pooled cameras render nothing else
+CAMERA_MODALITIES = ("rgb", "depth")
+CAMERA_PREFIX = "UESynthBenchmark_"
+
+# Metrics compared against a baseline, and whether higher values are better
+GATED_METRICS = {
+    "p50_ms": False,
+    "p99_ms": False,
+    "transforms_per_second": True,
+    "frames_per_second": True,
+}
+
+
+class BenchmarkError(RuntimeError):
+    """The server answered a benchmark request with a failure."""
+
+
+def latency_stats(seconds: Sequence[float]) -> dict[str, float]:
+    """Summarize round-trip times given in seconds, in milliseconds.
+
+    Args:
+        seconds: One duration per round trip
+
+    Returns:
+        p50, p99, mean, min and max of the durations
+    """
+    ms = np.asarray(seconds, dtype=np.float64) * 1000.0
+    return {
+        "p50_ms": float(np.percentile(ms, 50)),
+        "p99_ms": float(np.percentile(ms, 99)),
+        "mean_ms": float(ms.mean()),
+        "min_ms": float(ms.min()),
+        "max_ms": float(ms.max()),
+    }
+
+
+def time_calls(call: Callable[[], object], iterations: int, warmup: int) -> list[float]:
+    """Time call back to back, after warmup untimed calls.
+
+    Returns:
+        The duration of each timed call in seconds
+    """
+    for _ in range(warmup):
+        call()
+    samples: list[float] = []
+    for _ in range(iterations):
+        start = time.perf_counter()
+        call()
+        samples.append(time.perf_counter() - start)
+    return samples
+
+
+def compare(
+    baseline: Mapping[str, Any], current: Mapping[str, Any], tolerance: float
+) -> list[str]:
+    """List the gated metrics of current that are worse than baseline's.
+
+    Results are matched by benchmark name and parameters; results only one of
+    the two runs has are ignored.
+
+    Args:
+        baseline: A report from an earlier run
+        current: The report to check
+        tolerance: Relative change allowed, e.g. 0.1 for 10%
+
+    Returns:
+        One line per regression
+    """
+    if baseline.get("schema_version") != current.get("schema_version"):
+        raise ValueError("baseline was written by an incompatible benchmark version")
+
+    def key(result: Mapping[str, Any]) -> str:
+        return json.dumps([result["benchmark"], result["params"]], sort_keys=True)
+
+    earlier = {key(result): result for result in baseline["results"]}
+    regressions: list[str] = []
+    for result in current["results"]:
+        before = earlier.get(key(result))
+        if before is None:
+            continue
+        for name, higher_is_better in GATED_METRICS.items():
+            old = before.get("metrics", {}).get(name)
+            new = result.get("metrics", {}).get(name)
+            if old is None or new is None or old <= 0:
+                continue
+            change = (new - old) / old
+            if (-change if higher_is_better else change) > tolerance:
+                regressions.append(
+                    f"{result['benchmark']} {json.dumps(result['params'])}: "
+                    f"{name} {old:.3f} -> {new:.3f} ({change:+.1%})"
+                )
+    return regressions
+
+
+class ControlStream:
+    """A ControlStream driven one action at a time, so each round trip is timed."""
+
+    def __init__(self, stub: Any) -> None:
+        """Open the stream.
+
+        Args:
+            stub: The gRPC service stub
+        """
+        self._requests: queue.Queue[uesynth_pb2.ActionRequest | None] = queue.Queue()
+        self._responses: Iterator[uesynth_pb2.FrameResponse] = stub.ControlStream(
+            iter(self._requests.get, None)
+        )
+        self._next_id = 0
+
+    def call(
+        self, action: uesynth_pb2.ActionRequest, responses: int = 1
+    ) -> list[uesynth_pb2.FrameResponse]:
+        """Send action and wait for the responses it is answered with."""
+        self._next_id += 1
+        action.request_id = str(self._next_id)
+        self._requests.put(action)
+        return [next(self._responses) for _ in range(responses)]
+
+    def close(self) -> None:
+        """Finish the stream."""
+        self._requests.put(None)
+
+
+def _result(
+    benchmark: str, params: dict[str, Any], metrics: dict[str, float]
+) -> dict[str, Any]:
+    return {"benchmark": benchmark, "params": params, "metrics": metrics}
+
+
+def _skipped(benchmark: str, params: dict[str, Any], reason: str) -> dict[str, Any]:
+    return {"benchmark": benchmark, "params": params, "skipped": reason}
+
+
+def benchmark_latency(
+    stub: Any, stream: ControlStream, iterations: int, warmup: int
+) -> list[dict[str, Any]]:
+    """Round trips of the cheapest query, over a unary call and over the stream."""
+    unary = time_calls(
+        lambda: stub.GetCameraTransform(uesynth_pb2.GetCameraTransformRequest()),
+        iterations,
+        warmup,
+    )
+    streamed = time_calls(
+        lambda: stream.call(
+            uesynth_pb2.ActionRequest(
+                get_camera_transform=uesynth_pb2.GetCameraTransformRequest()
+            )
+        ),
+        iterations,
+        warmup,
+    )
+    return [
+        _result(
+            "rpc_latency",
+            {"transport": "unary", "rpc": "GetCameraTransform"},
+            latency_stats(unary),
+        ),
+        _result(
+            "rpc_latency",
+            {"transport": "stream", "rpc": "GetCameraTransform"},
+            latency_stats(streamed),
+        ),
+    ]
+
+
+def benchmark_transforms(
+    stub: Any, batch_sizes: Sequence[int], iterations: int, warmup: int
+) -> list[dict[str, Any]]:
+    """Batched transform writes per second, for each batch size.
+
+    Every batch writes back the transforms its objects already have, cycling
+    through the scene's objects when the batch is larger than the scene.
+    """
+    ids = list(stub.ListObjects(uesynth_pb2.ListObjectsRequest()).object_ids)
+    results: list[dict[str, Any]] = []
+    for batch_size in batch_sizes:
+        params = {"batch_size": batch_size}
+        if not ids:
+            results.append(_skipped("transforms", params, "the scene has no objects"))
+            continue
+        batch = [ids[index % len(ids)] for index in range(batch_size)]
+        current = stub.GetObjectTransformsBatch(
+            uesynth_pb2.GetObjectTransformsBatchRequest(object_ids=batch)
+        )
+        request = uesynth_pb2.SetObjectTransformsBatchRequest(
+            object_ids=batch, packed_transforms=current.packed_transforms
+        )
+        samples = time_calls(
+            lambda: stub.SetObjectTransformsBatch(request), iterations, warmup
+        )
+        metrics = latency_stats(samples)
+        metrics["transforms_per_second"] = batch_size * len(samples) / sum(samples)
+        results.append(_result("transforms", params, metrics))
+    return results
+
+
+def _check_images(images: uesynth_pb2.MultiImageResponse, wanted: int) -> int:
+    """The payload bytes of a capture, which must carry every wanted modality."""
+    if images.modalities & wanted != wanted:
+        raise BenchmarkError(
+            f"capture returned modalities {images.modalities:#x}, wanted {wanted:#x}"
+        )
+    return sum(
+        len(getattr(images, name).image_data)
+        for name, bit in CAPTURE_MODALITIES.items()
+        if images.modalities & bit
+    )
+
+
+def _capture_config(
+    stub: Any,
+    stream: ControlStream,
+    size: tuple[int, int],
+    modalities: Sequence[str],
+    cameras: int,
+    iterations: int,
+    warmup: int,
+) -> dict[str, float]:
+    """Time one capture configuration; pooled cameras are made and destroyed here."""
+    width, height = size
+    mask = 0
+    for name in modalities:
+        mask |= CAPTURE_MODALITIES[name]
+    frame_bytes: list[int] = []
+
+    if cameras == 0:
+        # The game view has the viewport's size; the server scales it on the GPU
+        action = uesynth_pb2.ActionRequest(
+            capture_multi=uesynth_pb2.CaptureMultiRequest(
+                modalities=mask, output_width=width, output_height=height
+            )
+        )
+
+        def capture() -> None:
+            (response,) = stream.call(action)
+            frame_bytes.append(_check_images(response.multi_image_response, mask))
+
+        samples = time_calls(capture, iterations, warmup)
+    else:
+        names = [f"{CAMERA_PREFIX}{index}" for index in range(cameras)]
+        view = stub.GetCameraTransform(uesynth_pb2.GetCameraTransformRequest())
+        try:
+            for name in names:
+                reply = stub.CreateCamera(
+                    uesynth_pb2.CreateCameraRequest(
+                        camera_name=name,
+                        initial_transform=view.transform,
+                        width=width,
+                        height=height,
+                    )
+                )
+                if not reply.success:
+                    raise BenchmarkError(f"could not create {name}: {reply.message}")
+            action = uesynth_pb2.ActionRequest(
+                capture_cameras=uesynth_pb2.CaptureCamerasRequest(
+                    camera_names=names, modalities=mask
+                )
+            )
+
+            def capture() -> None:
+                responses = stream.call(action, responses=cameras)
+                frame_bytes.append(
+                    sum(
+                        _check_images(response.multi_image_response, mask)
+                        for response in responses
+                    )
+                )
+
+            samples = time_calls(capture, iterations, warmup)
+        finally:
+            for name in names:
+                stub.DestroyCamera(uesynth_pb2.DestroyCameraRequest(camera_name=name))
+
+    metrics = latency_stats(samples)
+    metrics["frames_per_second"] = len(samples) / sum(samples)
+    metrics["bytes_per_frame"] = float(np.mean(frame_bytes[warmup:]))
+    return metrics
+
+
+def benchmark_capture(
+    stub: Any,
+    stream: ControlStream,
+    resolutions: Sequence[tuple[int, int]],
+    modality_sets: Sequence[Sequence[str]],
+    camera_counts: Sequence[int],
+    iterations: int,
+    warmup: int,
+) -> list[dict[str, Any]]:
+    """Capture frames per second for every resolution, modality set and camera count.
+
+    A frame is one capture of every camera, each read back in full.
+    """
+    results: list[dict[str, Any]] = []
+    for width, height in resolutions:
+        for modalities in modality_sets:
+            for cameras in camera_counts:
+                params = {
+                    "width": width,
+                    "height": height,
+                    "modalities": list(modalities),
+                    "cameras": cameras,
+                }
+                if cameras > 0 and not set(modalities) <= set(CAMERA_MODALITIES):
+                    results.append(
+                        _skipped("capture", params, "cameras render rgb and depth only")
+                    )
+                    continue
+                try:
+                    metrics = _capture_config(
+                        stub,
+                        stream,
+                        (width, height),
+                        modalities,
+                        cameras,
+                        iterations,
+                        warmup,
+                    )
+                except (BenchmarkError, grpc.RpcError) as error:
+                    results.append(_skipped("capture", params, str(error)))
+                    continue
+                results.append(_result("capture", params, metrics))
+    return results
+
+
+def _resolution(text: str) -> tuple[int, int]:
+    width, _, height = text.partition("x")
+    return int(width), int(height)
+
+
+def _modality_set(text: str) -> tuple[str, ...]:
+    names = tuple(text.split(","))
+    unknown = set(names) - set(CAPTURE_MODALITIES)
+    if unknown:
+        raise argparse.ArgumentTypeError(f"unknown modalities {sorted(unknown)}")
+    return names
+
+
+def _describe(result: Mapping[str, Any]) -> str:
+    params = " ".join(f"{name}={value}" for name, value in result["params"].items())
+    if "skipped" in result:
+        return f"{result['benchmark']:12} {params}: skipped, {result['skipped']}"
+    metrics = result["metrics"]
+    summary = f"p50 {metrics['p50_ms']:.2f} ms, p99 {metrics['p99_ms']:.2f} ms"
+    for rate in ("transforms_per_second", "frames_per_second"):
+        if rate in metrics:
+            summary += f", {metrics[rate]:.1f} {rate.replace('_', ' ')}"
+    return f"{result['benchmark']:12} {params}: {summary}"
+
+
+def run(
+    address: str,
+    benchmarks: Sequence[str],
+    iterations: int,
+    warmup: int,
+    batch_sizes: Sequence[int] = DEFAULT_BATCH_SIZES,
+    resolutions: Sequence[tuple[int, int]] = DEFAULT_RESOLUTIONS,
+    modality_sets: Sequence[Sequence[str]] = DEFAULT_MODALITY_SETS,
+    camera_counts: Sequence[int] = DEFAULT_CAMERA_COUNTS,
+) -> dict[str, Any]:
+    """Run the named benchmarks against the server at address.
+
+    Returns:
+        The report, ready to be written as JSON
+    """
+    channel = grpc.insecure_channel(address, options=CHANNEL_OPTIONS)
+    stub = uesynth_pb2_grpc.UESynthServiceStub(channel)
+    stream = ControlStream(stub)
+    results: list[dict[str, Any]] = []
+    try:
+        if "latency" in benchmarks:
+            results += benchmark_latency(stub, stream, iterations, warmup)
+        if "transforms" in benchmarks:
+            results += benchmark_transforms(stub, batch_sizes, iterations, warmup)
+        if "capture" in benchmarks:
+            results += benchmark_capture(
+                stub,
+                stream,
+                resolutions,
+                modality_sets,
+                camera_counts,
+                iterations,
+                warmup,
+            )
+    finally:
+        stream.close()
+        channel.close()
+
+    return {
+        "schema_version": SCHEMA_VERSION,
+        "created": datetime.now(UTC).isoformat(),
+        "address": address,
+        "client": {
+            "python": platform.python_version(),
+            "platform": platform.platform(),
+        },
+        "iterations": iterations,
+        "warmup": warmup,
+        "results": results,
+    }
+
+
+def main(argv: Sequence[str] | None = None) -> int:
+    """Run the benchmarks from the command line.
+
+    Returns:
+        0, or 1 when a baseline was given and a metric regressed past tolerance
+    """
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--address", default="localhost:50051")
+    parser.add_argument(
+        "--output", default="-", help="file to write the JSON report to, - for stdout"
+    )
+    parser.add_argument(
+        "--benchmarks",
+        nargs="+",
+        choices=("latency", "transforms", "capture"),
+        default=("latency", "transforms", "capture"),
+    )
+    parser.add_argument("--iterations", type=int, default=200)
+    parser.add_argument("--warmup", type=int, default=20)
+    parser.add_argument(
+        "--batch-sizes", type=int, nargs="+", default=list(DEFAULT_BATCH_SIZES)
+    )
+    parser.add_argument(
+        "--resolutions",
+        type=_resolution,
+        nargs="+",
+        default=list(DEFAULT_RESOLUTIONS),
+        metavar="WxH",
+    )
+    parser.add_argument(
+        "--modalities",
+        type=_modality_set,
+        nargs="+",
+        default=list(DEFAULT_MODALITY_SETS),
+        metavar="NAME[,NAME...]",
+        help="modality sets to capture, e.g. rgb rgb,depth",
+    )
+    parser.add_argument(
+        "--cameras",
+        type=int,
+        nargs="+",
+        default=list(DEFAULT_CAMERA_COUNTS),
+        help="pooled cameras per frame; 0 captures the game view",
+    )
+    parser.add_argument("--baseline", help="report of an earlier run to compare with")
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=0.1,
+        help="relative regression allowed against the baseline",
+    )
+    args = parser.parse_args(argv)
+
+    report = run(
+        args.address,
+        args.benchmarks,
+        args.iterations,
+        args.warmup,
+        args.batch_sizes,
+        args.resolutions,
+        args.modalities,
+        args.cameras,
+    )
+    for result in report["results"]:
+        print(_describe(result), file=sys.stderr)
+
+    regressions: list[str] = []
+    if args.baseline:
+        with open(args.baseline, encoding="utf-8") as file:
+            regressions = compare(json.load(file), report, args.tolerance)
+        report["regressions"] = regressions
+        for regression in regressions:
+            print(f"regression: {regression}", file=sys.stderr)
+
+    text = json.dumps(report, indent=2)
+    if args.output == "-":
+        print(text)
+    else:
+        with open(args.output, "w", encoding="utf-8") as file:
+            file.write(text + "\n")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
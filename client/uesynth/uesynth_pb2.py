@@ -22,60 +22,165 @@ _runtime_version.ValidateProtobufRuntimeVersion(
 _sym_db = _symbol_database.Default()
 
 
-from google.protobuf import empty_pb2 as google_dot_protobuf_dot_empty__pb2
-
-
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\ruesynth.proto\x12\x07uesynth\x1a\x1bgoogle/protobuf/empty.proto\"\xf6\x07\n\rActionRequest\x12\x12\n\nrequest_id\x18\x01 \x01(\t\x12\x42\n\x14set_camera_transform\x18\x02 \x01(\x0b\x32\".uesynth.SetCameraTransformRequestH\x00\x12\x42\n\x14get_camera_transform\x18\x03 \x01(\x0b\x32\".uesynth.GetCameraTransformRequestH\x00\x12.\n\x0b\x63\x61pture_rgb\x18\x04 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x30\n\rcapture_depth\x18\x05 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x37\n\x14\x63\x61pture_segmentation\x18\x06 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x32\n\x0f\x63\x61pture_normals\x18\x07 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x37\n\x14\x63\x61pture_optical_flow\x18\x08 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x42\n\x14set_object_transform\x18\t \x01(\x0b\x32\".uesynth.SetObjectTransformRequestH\x00\x12\x42\n\x14get_object_transform\x18\n \x01(\x0b\x32\".uesynth.GetObjectTransformRequestH\x00\x12\x35\n\rcreate_camera\x18\x0b \x01(\x0b\x32\x1c.uesynth.CreateCameraRequestH\x00\x12\x37\n\x0e\x64\x65stroy_camera\x18\x0c \x01(\x0b\x32\x1d.uesynth.DestroyCameraRequestH\x00\x12\x37\n\x0eset_resolution\x18\r \x01(\x0b\x32\x1d.uesynth.SetResolutionRequestH\x00\x12\x33\n\x0cspawn_object\x18\x0e \x01(\x0b\x32\x1b.uesynth.SpawnObjectRequestH\x00\x12\x37\n\x0e\x64\x65stroy_object\x18\x0f \x01(\x0b\x32\x1d.uesynth.DestroyObjectRequestH\x00\x12\x33\n\x0cset_material\x18\x10 \x01(\x0b\x32\x1b.uesynth.SetMaterialRequestH\x00\x12.\n\x0clist_objects\x18\x11 \x01(\x0b\x32\x16.google.protobuf.EmptyH\x00\x12\x33\n\x0cset_lighting\x18\x12 \x01(\x0b\x32\x1b.uesynth.SetLightingRequestH\x00\x42\x08\n\x06\x61\x63tion\"\xcf\x02\n\rFrameResponse\x12\x12\n\nrequest_id\x18\x01 \x01(\t\x12\x34\n\x10\x63ommand_response\x18\x02 \x01(\x0b\x32\x18.uesynth.CommandResponseH\x00\x12?\n\x10\x63\x61mera_transform\x18\x03 \x01(\x0b\x32#.uesynth.GetCameraTransformResponseH\x00\x12\x30\n\x0eimage_response\x18\x04 \x01(\x0b\x32\x16.uesynth.ImageResponseH\x00\x12?\n\x10object_transform\x18\x05 \x01(\x0b\x32#.uesynth.GetObjectTransformResponseH\x00\x12\x34\n\x0cobjects_list\x18\x06 \x01(\x0b\x32\x1c.uesynth.ListObjectsResponseH\x00\x42\n\n\x08response\"*\n\x07Vector3\x12\t\n\x01x\x18\x01 \x01(\x02\x12\t\n\x01y\x18\x02 \x01(\x02\x12\t\n\x01z\x18\x03 \x01(\x02\"3\n\x07Rotator\x12\r\n\x05pitch\x18\x01 \x01(\x02\x12\x0b\n\x03yaw\x18\x02 \x01(\x02\x12\x0c\n\x04roll\x18\x03 \x01(\x02\"t\n\tTransform\x12\"\n\x08location\x18\x01 \x01(\x0b\x32\x10.uesynth.Vector3\x12\"\n\x08rotation\x18\x02 \x01(\x0b\x32\x10.uesynth.Rotator\x12\x1f\n\x05scale\x18\x03 \x01(\x0b\x32\x10.uesynth.Vector3\"3\n\x0f\x43ommandResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"W\n\x19SetCameraTransformRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12%\n\ttransform\x18\x02 \x01(\x0b\x32\x12.uesynth.Transform\"0\n\x19GetCameraTransformRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\"e\n\x1aGetCameraTransformResponse\x12%\n\ttransform\x18\x01 \x01(\x0b\x32\x12.uesynth.Transform\x12\x0f\n\x07success\x18\x02 \x01(\x08\x12\x0f\n\x07message\x18\x03 \x01(\t\"D\n\x0e\x43\x61ptureRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\"R\n\rImageResponse\x12\x12\n\nimage_data\x18\x01 \x01(\x0c\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x0e\n\x06\x66ormat\x18\x04 \x01(\t\"W\n\x19SetObjectTransformRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\x12%\n\ttransform\x18\x02 \x01(\x0b\x32\x12.uesynth.Transform\"0\n\x19GetObjectTransformRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\"e\n\x1aGetObjectTransformResponse\x12%\n\ttransform\x18\x01 \x01(\x0b\x32\x12.uesynth.Transform\x12\x0f\n\x07success\x18\x02 \x01(\x08\x12\x0f\n\x07message\x18\x03 \x01(\t\"Y\n\x13\x43reateCameraRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12-\n\x11initial_transform\x18\x02 \x01(\x0b\x32\x12.uesynth.Transform\"+\n\x14\x44\x65stroyCameraRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\"J\n\x14SetResolutionRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\"+\n\x13ListObjectsResponse\x12\x14\n\x0cobject_names\x18\x01 \x03(\t\"l\n\x12SpawnObjectRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\x12\x12\n\nasset_path\x18\x02 \x01(\t\x12-\n\x11initial_transform\x18\x03 \x01(\x0b\x32\x12.uesynth.Transform\"+\n\x14\x44\x65stroyObjectRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\"S\n\x12SetMaterialRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\x12\x19\n\x11material_property\x18\x02 \x01(\t\x12\r\n\x05value\x18\x03 \x01(\t\"\x83\x01\n\x12SetLightingRequest\x12\x12\n\nlight_name\x18\x01 \x01(\t\x12\x11\n\tintensity\x18\x02 \x01(\x02\x12\x1f\n\x05\x63olor\x18\x03 \x01(\x0b\x32\x10.uesynth.Vector3\x12%\n\ttransform\x18\x04 \x01(\x0b\x32\x12.uesynth.Transform2\xd6\n\n\x0eUESynthService\x12\x43\n\rControlStream\x12\x16.uesynth.ActionRequest\x1a\x16.uesynth.FrameResponse(\x01\x30\x01\x12R\n\x12SetCameraTransform\x12\".uesynth.SetCameraTransformRequest\x1a\x18.uesynth.CommandResponse\x12]\n\x12GetCameraTransform\x12\".uesynth.GetCameraTransformRequest\x1a#.uesynth.GetCameraTransformResponse\x12\x42\n\x0f\x43\x61ptureRgbImage\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12\x42\n\x0f\x43\x61ptureDepthMap\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12J\n\x17\x43\x61ptureSegmentationMask\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12R\n\x12SetObjectTransform\x12\".uesynth.SetObjectTransformRequest\x1a\x18.uesynth.CommandResponse\x12]\n\x12GetObjectTransform\x12\".uesynth.GetObjectTransformRequest\x1a#.uesynth.GetObjectTransformResponse\x12\x46\n\x0c\x43reateCamera\x12\x1c.uesynth.CreateCameraRequest\x1a\x18.uesynth.CommandResponse\x12H\n\rDestroyCamera\x12\x1d.uesynth.DestroyCameraRequest\x1a\x18.uesynth.CommandResponse\x12H\n\rSetResolution\x12\x1d.uesynth.SetResolutionRequest\x1a\x18.uesynth.CommandResponse\x12\x41\n\x0e\x43\x61ptureNormals\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12\x45\n\x12\x43\x61ptureOpticalFlow\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12\x44\n\x0bSpawnObject\x12\x1b.uesynth.SpawnObjectRequest\x1a\x18.uesynth.CommandResponse\x12H\n\rDestroyObject\x12\x1d.uesynth.DestroyObjectRequest\x1a\x18.uesynth.CommandResponse\x12\x44\n\x0bSetMaterial\x12\x1b.uesynth.SetMaterialRequest\x1a\x18.uesynth.CommandResponse\x12\x43\n\x0bListObjects\x12\x16.google.protobuf.Empty\x1a\x1c.uesynth.ListObjectsResponse\x12\x44\n\x0bSetLighting\x12\x1b.uesynth.SetLightingRequest\x1a\x18.uesynth.CommandResponseb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\ruesynth.proto\x12\x07uesynth\"\xdb\x0f\n\rActionRequest\x12\x12\n\nrequest_id\x18\x01 \x01(\t\x12\x42\n\x14set_camera_transform\x18\x02 \x01(\x0b\x32\".uesynth.SetCameraTransformRequestH\x00\x12\x42\n\x14get_camera_transform\x18\x03 \x01(\x0b\x32\".uesynth.GetCameraTransformRequestH\x00\x12.\n\x0b\x63\x61pture_rgb\x18\x04 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x30\n\rcapture_depth\x18\x05 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x37\n\x14\x63\x61pture_segmentation\x18\x06 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x32\n\x0f\x63\x61pture_normals\x18\x07 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x37\n\x14\x63\x61pture_optical_flow\x18\x08 \x01(\x0b\x32\x17.uesynth.CaptureRequestH\x00\x12\x42\n\x14set_object_transform\x18\t \x01(\x0b\x32\".uesynth.SetObjectTransformRequestH\x00\x12\x42\n\x14get_object_transform\x18\n \x01(\x0b\x32\".uesynth.GetObjectTransformRequestH\x00\x12\x35\n\rcreate_camera\x18\x0b \x01(\x0b\x32\x1c.uesynth.CreateCameraRequestH\x00\x12\x37\n\x0e\x64\x65stroy_camera\x18\x0c \x01(\x0b\x32\x1d.uesynth.DestroyCameraRequestH\x00\x12\x37\n\x0eset_resolution\x18\r \x01(\x0b\x32\x1d.uesynth.SetResolutionRequestH\x00\x12\x33\n\x0cspawn_object\x18\x0e \x01(\x0b\x32\x1b.uesynth.SpawnObjectRequestH\x00\x12\x37\n\x0e\x64\x65stroy_object\x18\x0f \x01(\x0b\x32\x1d.uesynth.DestroyObjectRequestH\x00\x12\x33\n\x0cset_material\x18\x10 \x01(\x0b\x32\x1b.uesynth.SetMaterialRequestH\x00\x12\x33\n\x0clist_objects\x18\x11 \x01(\x0b\x32\x1b.uesynth.ListObjectsRequestH\x00\x12\x33\n\x0cset_lighting\x18\x12 \x01(\x0b\x32\x1b.uesynth.SetLightingRequestH\x00\x12O\n\x1bset_object_transforms_batch\x18\x13 \x01(\x0b\x32(.uesynth.SetObjectTransformsBatchRequestH\x00\x12O\n\x1bget_object_transforms_batch\x18\x14 \x01(\x0b\x32(.uesynth.GetObjectTransformsBatchRequestH\x00\x12\x35\n\rcapture_multi\x18\x15 \x01(\x0b\x32\x1c.uesynth.CaptureMultiRequestH\x00\x12\x39\n\x0f\x63\x61pture_cameras\x18\x16 \x01(\x0b\x32\x1e.uesynth.CaptureCamerasRequestH\x00\x12.\n\tsubscribe\x18\x17 \x01(\x0b\x32\x19.uesynth.SubscribeRequestH\x00\x12\x32\n\x0bunsubscribe\x18\x18 \x01(\x0b\x32\x1b.uesynth.UnsubscribeRequestH\x00\x12:\n\x10get_stream_stats\x18\x19 \x01(\x0b\x32\x1e.uesynth.GetStreamStatsRequestH\x00\x12>\n\x12open_shared_memory\x18\x1a \x01(\x0b\x32 .uesynth.OpenSharedMemoryRequestH\x00\x12$\n\x04step\x18\x1b \x01(\x0b\x32\x14.uesynth.StepRequestH\x00\x12\x33\n\x0cset_lockstep\x18\x1c \x01(\x0b\x32\x1b.uesynth.SetLockstepRequestH\x00\x12\x37\n\x0epreload_assets\x18\x1d \x01(\x0b\x32\x1d.uesynth.PreloadAssetsRequestH\x00\x12\x42\n\x14\x63onfigure_actor_pool\x18\x1e \x01(\x0b\x32\".uesynth.ConfigureActorPoolRequestH\x00\x12@\n\x13set_materials_batch\x18\x1f \x01(\x0b\x32!.uesynth.SetMaterialsBatchRequestH\x00\x12P\n\x1bresolve_material_parameters\x18  \x01(\x0b\x32).uesynth.ResolveMaterialParametersRequestH\x00\x12>\n\x12set_lighting_batch\x18! \x01(\x0b\x32 .uesynth.SetLightingBatchRequestH\x00\x12>\n\x12get_scene_snapshot\x18\" \x01(\x0b\x32 .uesynth.GetSceneSnapshotRequestH\x00\x42\x08\n\x06\x61\x63tion\"\x87\t\n\rFrameResponse\x12\x12\n\nrequest_id\x18\x01 \x01(\t\x12\x34\n\x10\x63ommand_response\x18\x02 \x01(\x0b\x32\x18.uesynth.CommandResponseH\x00\x12?\n\x10\x63\x61mera_transform\x18\x03 \x01(\x0b\x32#.uesynth.GetCameraTransformResponseH\x00\x12\x30\n\x0eimage_response\x18\x04 \x01(\x0b\x32\x16.uesynth.ImageResponseH\x00\x12?\n\x10object_transform\x18\x05 \x01(\x0b\x32#.uesynth.GetObjectTransformResponseH\x00\x12\x34\n\x0cobjects_list\x18\x06 \x01(\x0b\x32\x1c.uesynth.ListObjectsResponseH\x00\x12J\n\x15object_transforms_set\x18\x07 \x01(\x0b\x32).uesynth.SetObjectTransformsBatchResponseH\x00\x12L\n\x17object_transforms_batch\x18\x08 \x01(\x0b\x32).uesynth.GetObjectTransformsBatchResponseH\x00\x12;\n\x14multi_image_response\x18\t \x01(\x0b\x32\x1b.uesynth.MultiImageResponseH\x00\x12\x38\n\x12subscription_frame\x18\n \x01(\x0b\x32\x1a.uesynth.SubscriptionFrameH\x00\x12,\n\x0cstream_stats\x18\x0b \x01(\x0b\x32\x14.uesynth.StreamStatsH\x00\x12\x32\n\rshared_memory\x18\x0c \x01(\x0b\x32\x19.uesynth.SharedMemoryInfoH\x00\x12.\n\rstep_response\x18\r \x01(\x0b\x32\x15.uesynth.StepResponseH\x00\x12\x30\n\x0elockstep_state\x18\x0e \x01(\x0b\x32\x16.uesynth.LockstepStateH\x00\x12\x41\n\x17preload_assets_response\x18\x0f \x01(\x0b\x32\x1e.uesynth.PreloadAssetsResponseH\x00\x12\x33\n\x10\x61\x63tor_pool_stats\x18\x10 \x01(\x0b\x32\x17.uesynth.ActorPoolStatsH\x00\x12;\n\rmaterials_set\x18\x11 \x01(\x0b\x32\".uesynth.SetMaterialsBatchResponseH\x00\x12?\n\x16material_parameter_ids\x18\x12 \x01(\x0b\x32\x1d.uesynth.MaterialParameterIdsH\x00\x12\x39\n\x0clighting_set\x18\x13 \x01(\x0b\x32!.uesynth.SetLightingBatchResponseH\x00\x12\x30\n\x0escene_snapshot\x18\x14 \x01(\x0b\x32\x16.uesynth.SceneSnapshotH\x00\x42\n\n\x08response\"*\n\x07Vector3\x12\t\n\x01x\x18\x01 \x01(\x02\x12\t\n\x01y\x18\x02 \x01(\x02\x12\t\n\x01z\x18\x03 \x01(\x02\"3\n\x07Rotator\x12\r\n\x05pitch\x18\x01 \x01(\x02\x12\x0b\n\x03yaw\x18\x02 \x01(\x02\x12\x0c\n\x04roll\x18\x03 \x01(\x02\"t\n\tTransform\x12\"\n\x08location\x18\x01 \x01(\x0b\x32\x10.uesynth.Vector3\x12\"\n\x08rotation\x18\x02 \x01(\x0b\x32\x10.uesynth.Rotator\x12\x1f\n\x05scale\x18\x03 \x01(\x0b\x32\x10.uesynth.Vector3\"3\n\x0f\x43ommandResponse\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x0f\n\x07message\x18\x02 \x01(\t\"W\n\x19SetCameraTransformRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12%\n\ttransform\x18\x02 \x01(\x0b\x32\x12.uesynth.Transform\"0\n\x19GetCameraTransformRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\"e\n\x1aGetCameraTransformResponse\x12%\n\ttransform\x18\x01 \x01(\x0b\x32\x12.uesynth.Transform\x12\x0f\n\x07success\x18\x02 \x01(\x08\x12\x0f\n\x07message\x18\x03 \x01(\t\"D\n\rCaptureRegion\x12\t\n\x01x\x18\x01 \x01(\r\x12\t\n\x01y\x18\x02 \x01(\r\x12\r\n\x05width\x18\x03 \x01(\r\x12\x0e\n\x06height\x18\x04 \x01(\r\"\xf2\x02\n\x0e\x43\x61ptureRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12*\n\x0cpixel_format\x18\x04 \x01(\x0e\x32\x14.uesynth.PixelFormat\x12.\n\x0e\x64\x65pth_encoding\x18\x05 \x01(\x0e\x32\x16.uesynth.DepthEncoding\x12\x12\n\ndepth_near\x18\x06 \x01(\x02\x12\x11\n\tdepth_far\x18\x07 \x01(\x02\x12\x1d\n\x15segmentation_revision\x18\x08 \x01(\r\x12\"\n\x05\x63odec\x18\t \x01(\x0e\x32\x13.uesynth.ImageCodec\x12\x14\n\x0cjpeg_quality\x18\n \x01(\r\x12#\n\x03roi\x18\x0b \x01(\x0b\x32\x16.uesynth.CaptureRegion\x12\x14\n\x0coutput_width\x18\x0c \x01(\r\x12\x15\n\routput_height\x18\r \x01(\r\"\xb4\x02\n\rImageResponse\x12\x12\n\nimage_data\x18\x01 \x01(\x0c\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x0e\n\x06\x66ormat\x18\x04 \x01(\t\x12\x1d\n\x15segmentation_revision\x18\x05 \x01(\r\x12\x36\n\x12segmentation_table\x18\x06 \x03(\x0b\x32\x1a.uesynth.SegmentationEntry\x12\"\n\x05\x63odec\x18\x07 \x01(\x0e\x32\x13.uesynth.ImageCodec\x12\x10\n\x08raw_size\x18\x08 \x01(\x04\x12!\n\x05\x64\x65lta\x18\t \x01(\x0b\x32\x12.uesynth.TileDelta\x12\x30\n\rshared_memory\x18\n \x01(\x0b\x32\x19.uesynth.SharedMemorySlot\"L\n\tTileDelta\x12\x11\n\ttile_size\x18\x01 \x01(\r\x12\x15\n\rchanged_tiles\x18\x02 \x03(\r\x12\x15\n\rbase_sequence\x18\x03 \x01(\x04\"T\n\x11SegmentationEntry\x12\x17\n\x0fsegmentation_id\x18\x01 \x01(\r\x12\x13\n\x0bobject_name\x18\x02 \x01(\t\x12\x11\n\tobject_id\x18\x03 \x01(\r\"\xba\x03\n\x13\x43\x61ptureMultiRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\x12\x12\n\nmodalities\x18\x04 \x01(\r\x12*\n\x0cpixel_format\x18\x05 \x01(\x0e\x32\x14.uesynth.PixelFormat\x12.\n\x0e\x64\x65pth_encoding\x18\x06 \x01(\x0e\x32\x16.uesynth.DepthEncoding\x12\x12\n\ndepth_near\x18\x07 \x01(\x02\x12\x11\n\tdepth_far\x18\x08 \x01(\x02\x12\x1d\n\x15segmentation_revision\x18\t \x01(\r\x12(\n\x0b\x63olor_codec\x18\n \x01(\x0e\x32\x13.uesynth.ImageCodec\x12\'\n\ndata_codec\x18\x0b \x01(\x0e\x32\x13.uesynth.ImageCodec\x12\x14\n\x0cjpeg_quality\x18\x0c \x01(\r\x12#\n\x03roi\x18\r \x01(\x0b\x32\x16.uesynth.CaptureRegion\x12\x14\n\x0coutput_width\x18\x0e \x01(\r\x12\x15\n\routput_height\x18\x0f \x01(\r\"\x8e\x02\n\x12MultiImageResponse\x12#\n\x03rgb\x18\x01 \x01(\x0b\x32\x16.uesynth.ImageResponse\x12%\n\x05\x64\x65pth\x18\x02 \x01(\x0b\x32\x16.uesynth.ImageResponse\x12,\n\x0csegmentation\x18\x03 \x01(\x0b\x32\x16.uesynth.ImageResponse\x12\'\n\x07normals\x18\x04 \x01(\x0b\x32\x16.uesynth.ImageResponse\x12,\n\x0coptical_flow\x18\x05 \x01(\x0b\x32\x16.uesynth.ImageResponse\x12\x12\n\nmodalities\x18\x06 \x01(\r\x12\x13\n\x0b\x63\x61mera_name\x18\x07 \x01(\t\"\xad\x02\n\x15\x43\x61ptureCamerasRequest\x12\x14\n\x0c\x63\x61mera_names\x18\x01 \x03(\t\x12\x12\n\nmodalities\x18\x02 \x01(\r\x12*\n\x0cpixel_format\x18\x03 \x01(\x0e\x32\x14.uesynth.PixelFormat\x12.\n\x0e\x64\x65pth_encoding\x18\x04 \x01(\x0e\x32\x16.uesynth.DepthEncoding\x12\x12\n\ndepth_near\x18\x05 \x01(\x02\x12\x11\n\tdepth_far\x18\x06 \x01(\x02\x12(\n\x0b\x63olor_codec\x18\x07 \x01(\x0e\x32\x13.uesynth.ImageCodec\x12\'\n\ndata_codec\x18\x08 \x01(\x0e\x32\x13.uesynth.ImageCodec\x12\x14\n\x0cjpeg_quality\x18\t \x01(\r\"\xb9\x01\n\x10SubscribeRequest\x12-\n\x07\x63\x61pture\x18\x01 \x01(\x0b\x32\x1c.uesynth.CaptureMultiRequest\x12\x0f\n\x07rate_hz\x18\x02 \x01(\x02\x12\x16\n\x0e\x65very_n_frames\x18\x03 \x01(\r\x12\x19\n\x11max_queued_frames\x18\x04 \x01(\r\x12\x17\n\x0f\x64\x65lta_tile_size\x18\x05 \x01(\r\x12\x19\n\x11keyframe_interval\x18\x06 \x01(\r\"-\n\x12UnsubscribeRequest\x12\x17\n\x0fsubscription_id\x18\x01 \x01(\t\"\xca\x01\n\x11SubscriptionFrame\x12+\n\x06images\x18\x01 \x01(\x0b\x32\x1b.uesynth.MultiImageResponse\x12\x10\n\x08sequence\x18\x02 \x01(\x04\x12\x16\n\x0e\x64ropped_frames\x18\x03 \x01(\x04\x12\x14\n\x0c\x66rame_number\x18\x04 \x01(\x04\x12,\n\x10\x63\x61mera_transform\x18\x05 \x01(\x0b\x32\x12.uesynth.Transform\x12\x1a\n\x12world_time_seconds\x18\x06 \x01(\x01\"\x17\n\x15GetStreamStatsRequest\"@\n\x17OpenSharedMemoryRequest\x12\x12\n\nslot_count\x18\x01 \x01(\r\x12\x11\n\tslot_size\x18\x02 \x01(\x04\"\\\n\x10SharedMemoryInfo\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x12\n\nslot_count\x18\x02 \x01(\r\x12\x11\n\tslot_size\x18\x03 \x01(\x04\x12\x13\n\x0bheader_size\x18\x04 \x01(\r\"@\n\x10SharedMemorySlot\x12\x0c\n\x04slot\x18\x01 \x01(\r\x12\x10\n\x08sequence\x18\x02 \x01(\x04\x12\x0c\n\x04size\x18\x03 \x01(\x04\"\x7f\n\x0bStreamStats\x12\x13\n\x0bqueue_depth\x18\x01 \x01(\r\x12\x16\n\x0equeue_capacity\x18\x02 \x01(\r\x12\x18\n\x10peak_queue_depth\x18\x03 \x01(\r\x12\x19\n\x11\x64ropped_responses\x18\x04 \x01(\x04\x12\x0e\n\x06policy\x18\x05 \x01(\t\"\xad\x01\n\x0bStepRequest\x12\'\n\x07\x61\x63tions\x18\x01 \x03(\x0b\x32\x16.uesynth.ActionRequest\x12\x15\n\rdelta_seconds\x18\x02 \x01(\x02\x12-\n\x07\x63\x61pture\x18\x03 \x01(\x0b\x32\x1c.uesynth.CaptureMultiRequest\x12\x19\n\x11\x63ontinue_on_error\x18\x04 \x01(\x08\x12\x14\n\x0crecording_id\x18\x05 \x01(\t\"9\n\tStepError\x12\r\n\x05index\x18\x01 \x01(\r\x12\x0c\n\x04\x63ode\x18\x02 \x01(\x05\x12\x0f\n\x07message\x18\x03 \x01(\t\"\xba\x01\n\x0cStepResponse\x12\'\n\x07results\x18\x01 \x03(\x0b\x32\x16.uesynth.FrameResponse\x12\"\n\x06\x65rrors\x18\x02 \x03(\x0b\x32\x12.uesynth.StepError\x12+\n\x06images\x18\x03 \x01(\x0b\x32\x1b.uesynth.MultiImageResponse\x12\x14\n\x0c\x66rame_number\x18\x04 \x01(\x04\x12\x1a\n\x12world_time_seconds\x18\x05 \x01(\x01\"[\n\x12SetLockstepRequest\x12\x0f\n\x07\x65nabled\x18\x01 \x01(\x08\x12\x1b\n\x13\x66ixed_delta_seconds\x18\x02 \x01(\x02\x12\x17\n\x0fidle_timeout_ms\x18\x03 \x01(\r\"n\n\rLockstepState\x12\x0f\n\x07\x65nabled\x18\x01 \x01(\x08\x12\x1b\n\x13\x66ixed_delta_seconds\x18\x02 \x01(\x02\x12\x17\n\x0fidle_timeout_ms\x18\x03 \x01(\r\x12\x16\n\x0e\x66rames_stepped\x18\x04 \x01(\x04\"W\n\x19SetObjectTransformRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\x12%\n\ttransform\x18\x02 \x01(\x0b\x32\x12.uesynth.Transform\"0\n\x19GetObjectTransformRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\"e\n\x1aGetObjectTransformResponse\x12%\n\ttransform\x18\x01 \x01(\x0b\x32\x12.uesynth.Transform\x12\x0f\n\x07success\x18\x02 \x01(\x08\x12\x0f\n\x07message\x18\x03 \x01(\t\"f\n\x1fSetObjectTransformsBatchRequest\x12\x12\n\nobject_ids\x18\x01 \x03(\r\x12\x14\n\x0cobject_names\x18\x02 \x03(\t\x12\x19\n\x11packed_transforms\x18\x03 \x01(\x0c\"b\n SetObjectTransformsBatchResponse\x12\x15\n\rapplied_count\x18\x01 \x01(\r\x12\x16\n\x0e\x66\x61iled_indices\x18\x02 \x03(\r\x12\x0f\n\x07message\x18\x03 \x01(\t\"K\n\x1fGetObjectTransformsBatchRequest\x12\x12\n\nobject_ids\x18\x01 \x03(\r\x12\x14\n\x0cobject_names\x18\x02 \x03(\t\"V\n GetObjectTransformsBatchResponse\x12\x19\n\x11packed_transforms\x18\x01 \x01(\x0c\x12\x17\n\x0fmissing_indices\x18\x02 \x03(\r\"x\n\x13\x43reateCameraRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12-\n\x11initial_transform\x18\x02 \x01(\x0b\x32\x12.uesynth.Transform\x12\r\n\x05width\x18\x03 \x01(\r\x12\x0e\n\x06height\x18\x04 \x01(\r\"+\n\x14\x44\x65stroyCameraRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\"J\n\x14SetResolutionRequest\x12\x13\n\x0b\x63\x61mera_name\x18\x01 \x01(\t\x12\r\n\x05width\x18\x02 \x01(\r\x12\x0e\n\x06height\x18\x03 \x01(\r\"5\n\x12ListObjectsRequest\x12\x0b\n\x03tag\x18\x01 \x01(\t\x12\x12\n\nclass_name\x18\x02 \x01(\t\"?\n\x13ListObjectsResponse\x12\x14\n\x0cobject_names\x18\x01 \x03(\t\x12\x12\n\nobject_ids\x18\x02 \x03(\r\"\xa1\x01\n\x17GetSceneSnapshotRequest\x12\x16\n\x0esince_sequence\x18\x01 \x01(\x04\x12\x1a\n\x12include_velocities\x18\x02 \x01(\x08\x12\x1a\n\x12include_visibility\x18\x03 \x01(\x08\x12\x0b\n\x03tag\x18\x04 \x01(\t\x12\x12\n\nclass_name\x18\x05 \x01(\t\x12\x15\n\rinclude_names\x18\x06 \x01(\x08\"\xca\x01\n\rSceneSnapshot\x12\x10\n\x08sequence\x18\x01 \x01(\x04\x12\x0c\n\x04\x66ull\x18\x02 \x01(\x08\x12\x12\n\nobject_ids\x18\x03 \x03(\r\x12\x14\n\x0cobject_names\x18\x04 \x03(\t\x12\x14\n\x0cpacked_state\x18\x05 \x01(\x0c\x12\x12\n\nnum_fields\x18\x06 \x01(\r\x12\x13\n\x0bremoved_ids\x18\x07 \x03(\r\x12\x14\n\x0c\x66rame_number\x18\x08 \x01(\x04\x12\x1a\n\x12world_time_seconds\x18\t \x01(\x01\"\xaf\x01\n\x12SpawnObjectRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\x12\x12\n\nasset_path\x18\x02 \x01(\t\x12-\n\x11initial_transform\x18\x03 \x01(\x0b\x32\x12.uesynth.Transform\x12\x31\n\x0fif_not_resident\x18\x04 \x01(\x0e\x32\x18.uesynth.AssetMissPolicy\x12\x0e\n\x06pooled\x18\x05 \x01(\x08\"9\n\x14PreloadAssetsRequest\x12\x13\n\x0b\x61sset_paths\x18\x01 \x03(\t\x12\x0c\n\x04wait\x18\x02 \x01(\x08\"]\n\x0b\x41ssetStatus\x12\x12\n\nasset_path\x18\x01 \x01(\t\x12\"\n\x05state\x18\x02 \x01(\x0e\x32\x13.uesynth.AssetState\x12\x16\n\x0eresident_bytes\x18\x03 \x01(\x04\"\x85\x01\n\x15PreloadAssetsResponse\x12$\n\x06\x61ssets\x18\x01 \x03(\x0b\x32\x14.uesynth.AssetStatus\x12\x13\n\x0b\x63\x61\x63he_bytes\x18\x02 \x01(\x04\x12\x1a\n\x12\x63\x61\x63he_budget_bytes\x18\x03 \x01(\x04\x12\x15\n\rcache_entries\x18\x04 \x01(\r\"+\n\x14\x44\x65stroyObjectRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\"H\n\x19\x43onfigureActorPoolRequest\x12\x1c\n\x14max_parked_per_asset\x18\x01 \x01(\r\x12\r\n\x05\x63lear\x18\x02 \x01(\x08\"R\n\x0e\x41\x63torPoolEntry\x12\x12\n\nasset_path\x18\x01 \x01(\t\x12\x0e\n\x06parked\x18\x02 \x01(\r\x12\x0c\n\x04hits\x18\x03 \x01(\x04\x12\x0e\n\x06misses\x18\x04 \x01(\x04\"\x97\x01\n\x0e\x41\x63torPoolStats\x12\x1c\n\x14max_parked_per_asset\x18\x01 \x01(\r\x12\x0e\n\x06parked\x18\x02 \x01(\r\x12\x0c\n\x04hits\x18\x03 \x01(\x04\x12\x0e\n\x06misses\x18\x04 \x01(\x04\x12\x11\n\tdiscarded\x18\x05 \x01(\x04\x12&\n\x05pools\x18\x06 \x03(\x0b\x32\x17.uesynth.ActorPoolEntry\"9\n\x0bLinearColor\x12\t\n\x01r\x18\x01 \x01(\x02\x12\t\n\x01g\x18\x02 \x01(\x02\x12\t\n\x01\x62\x18\x03 \x01(\x02\x12\t\n\x01\x61\x18\x04 \x01(\x02\"\x94\x01\n\x11MaterialParameter\x12\x0e\n\x04name\x18\x01 \x01(\tH\x00\x12\x0c\n\x02id\x18\x02 \x01(\rH\x00\x12\x10\n\x06scalar\x18\x03 \x01(\x02H\x01\x12&\n\x06vector\x18\x04 \x01(\x0b\x32\x14.uesynth.LinearColorH\x01\x12\x11\n\x07texture\x18\x05 \x01(\tH\x01\x42\x0b\n\tparameterB\x07\n\x05value\"\x96\x01\n\x12SetMaterialRequest\x12\x13\n\x0bobject_name\x18\x01 \x01(\t\x12\x19\n\x11material_property\x18\x02 \x01(\t\x12\r\n\x05value\x18\x03 \x01(\t\x12.\n\nparameters\x18\x04 \x03(\x0b\x32\x1a.uesynth.MaterialParameter\x12\x11\n\tobject_id\x18\x05 \x01(\r\"H\n\x18SetMaterialsBatchRequest\x12,\n\x07objects\x18\x01 \x03(\x0b\x32\x1b.uesynth.SetMaterialRequest\"[\n\x19SetMaterialsBatchResponse\x12\x15\n\rapplied_count\x18\x01 \x01(\r\x12\x16\n\x0e\x66\x61iled_indices\x18\x02 \x03(\r\x12\x0f\n\x07message\x18\x03 \x01(\t\"1\n ResolveMaterialParametersRequest\x12\r\n\x05names\x18\x01 \x03(\t\"#\n\x14MaterialParameterIds\x12\x0b\n\x03ids\x18\x01 \x03(\r\"\xa9\x01\n\x12SetLightingRequest\x12\x12\n\nlight_name\x18\x01 \x01(\t\x12\x16\n\tintensity\x18\x02 \x01(\x02H\x00\x88\x01\x01\x12\x1f\n\x05\x63olor\x18\x03 \x01(\x0b\x32\x10.uesynth.Vector3\x12%\n\ttransform\x18\x04 \x01(\x0b\x32\x12.uesynth.Transform\x12\x11\n\tobject_id\x18\x05 \x01(\rB\x0c\n\n_intensity\"F\n\x17SetLightingBatchRequest\x12+\n\x06lights\x18\x01 \x03(\x0b\x32\x1b.uesynth.SetLightingRequest\"Z\n\x18SetLightingBatchResponse\x12\x15\n\rapplied_count\x18\x01 \x01(\r\x12\x16\n\x0e\x66\x61iled_indices\x18\x02 \x03(\r\x12\x0f\n\x07message\x18\x03 \x01(\t\"\x8b\x01\n\x15StartRecordingRequest\x12\x14\n\x0crecording_id\x18\x01 \x01(\t\x12\x11\n\tdirectory\x18\x02 \x01(\t\x12/\n\x0csubscription\x18\x03 \x01(\x0b\x32\x19.uesynth.SubscribeRequest\x12\x18\n\x10\x66rames_per_shard\x18\x04 \x01(\r\",\n\x14StopRecordingRequest\x12\x14\n\x0crecording_id\x18\x01 \x01(\t\"\xb6\x01\n\x0eRecordingStats\x12\x14\n\x0crecording_id\x18\x01 \x01(\t\x12\x11\n\tdirectory\x18\x02 \x01(\t\x12\x16\n\x0e\x66rames_written\x18\x03 \x01(\x04\x12\x16\n\x0e\x66rames_dropped\x18\x04 \x01(\x04\x12\x15\n\rbytes_written\x18\x05 \x01(\x04\x12\x0e\n\x06shards\x18\x06 \x01(\r\x12\x15\n\rqueued_frames\x18\x07 \x01(\r\x12\r\n\x05\x65rror\x18\x08 \x01(\t\"&\n\x15GetServerStatsRequest\x12\r\n\x05reset\x18\x01 \x01(\x08\"\x8f\x01\n\x10LatencyHistogram\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\r\n\x05\x63ount\x18\x02 \x01(\x04\x12\x13\n\x0bsum_seconds\x18\x03 \x01(\x01\x12\x0f\n\x07\x62uckets\x18\x04 \x03(\x04\x12\x0e\n\x06\x65rrors\x18\x05 \x01(\x04\x12\x13\n\x0bp50_seconds\x18\x06 \x01(\x01\x12\x13\n\x0bp99_seconds\x18\x07 \x01(\x01\"\xb3\x02\n\x0bServerStats\x12\x1d\n\x15\x62ucket_bounds_seconds\x18\x01 \x03(\x01\x12\'\n\x04rpcs\x18\x02 \x03(\x0b\x32\x19.uesynth.LatencyHistogram\x12)\n\x06stages\x18\x03 \x03(\x0b\x32\x19.uesynth.LatencyHistogram\x12\x1b\n\x13\x63ommand_queue_depth\x18\x04 \x01(\r\x12 \n\x18peak_command_queue_depth\x18\x05 \x01(\r\x12\x15\n\rheld_commands\x18\x06 \x01(\r\x12\x14\n\x0copen_streams\x18\x07 \x01(\r\x12\x17\n\x0f\x63\x61lls_in_flight\x18\x08 \x01(\r\x12\x16\n\x0euptime_seconds\x18\t \x01(\x01\x12\x14\n\x0c\x64ropped_work\x18\n \x01(\x04\"\x0f\n\rHealthRequest\"\x81\x02\n\x0cHealthStatus\x12\r\n\x05ready\x18\x01 \x01(\x08\x12\x18\n\x10not_ready_reason\x18\x02 \x01(\t\x12\x16\n\x0elisten_address\x18\x03 \x01(\t\x12\x0b\n\x03\x66ps\x18\x04 \x01(\x02\x12\x1b\n\x13\x63ommand_queue_depth\x18\x05 \x01(\r\x12\x17\n\x0f\x63\x61lls_in_flight\x18\x06 \x01(\r\x12\x14\n\x0copen_streams\x18\x07 \x01(\r\x12\x1b\n\x13seconds_since_frame\x18\x08 \x01(\x01\x12\x14\n\x0c\x66rame_number\x18\t \x01(\x04\x12\x10\n\x08lockstep\x18\n \x01(\x08\x12\x12\n\nworld_name\x18\x0b \x01(\t*k\n\x0bPixelFormat\x12\x16\n\x12PIXEL_FORMAT_RGBA8\x10\x00\x12\x15\n\x11PIXEL_FORMAT_RGB8\x10\x01\x12\x15\n\x11PIXEL_FORMAT_BGR8\x10\x02\x12\x16\n\x12PIXEL_FORMAT_GRAY8\x10\x03*b\n\rDepthEncoding\x12\x1a\n\x16\x44\x45PTH_ENCODING_FLOAT32\x10\x00\x12\x1a\n\x16\x44\x45PTH_ENCODING_FLOAT16\x10\x01\x12\x19\n\x15\x44\x45PTH_ENCODING_UINT16\x10\x02*w\n\nImageCodec\x12\x13\n\x0fIMAGE_CODEC_RAW\x10\x00\x12\x14\n\x10IMAGE_CODEC_JPEG\x10\x01\x12\x13\n\x0fIMAGE_CODEC_PNG\x10\x02\x12\x13\n\x0fIMAGE_CODEC_LZ4\x10\x03\x12\x14\n\x10IMAGE_CODEC_ZLIB\x10\x04*\xc6\x01\n\x0f\x43\x61ptureModality\x12\x19\n\x15\x43\x41PTURE_MODALITY_NONE\x10\x00\x12\x18\n\x14\x43\x41PTURE_MODALITY_RGB\x10\x01\x12\x1a\n\x16\x43\x41PTURE_MODALITY_DEPTH\x10\x02\x12!\n\x1d\x43\x41PTURE_MODALITY_SEGMENTATION\x10\x04\x12\x1c\n\x18\x43\x41PTURE_MODALITY_NORMALS\x10\x08\x12!\n\x1d\x43\x41PTURE_MODALITY_OPTICAL_FLOW\x10\x10*I\n\x0f\x41ssetMissPolicy\x12\x1a\n\x16\x41SSET_MISS_POLICY_WAIT\x10\x00\x12\x1a\n\x16\x41SSET_MISS_POLICY_FAIL\x10\x01*s\n\nAssetState\x12\x1a\n\x16\x41SSET_STATE_NOT_LOADED\x10\x00\x12\x17\n\x13\x41SSET_STATE_LOADING\x10\x01\x12\x18\n\x14\x41SSET_STATE_RESIDENT\x10\x02\x12\x16\n\x12\x41SSET_STATE_FAILED\x10\x03\x32\xa6\x14\n\x0eUESynthService\x12\x43\n\rControlStream\x12\x16.uesynth.ActionRequest\x1a\x16.uesynth.FrameResponse(\x01\x30\x01\x12R\n\x12SetCameraTransform\x12\".uesynth.SetCameraTransformRequest\x1a\x18.uesynth.CommandResponse\x12]\n\x12GetCameraTransform\x12\".uesynth.GetCameraTransformRequest\x1a#.uesynth.GetCameraTransformResponse\x12\x42\n\x0f\x43\x61ptureRgbImage\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12\x42\n\x0f\x43\x61ptureDepthMap\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12J\n\x17\x43\x61ptureSegmentationMask\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12R\n\x12SetObjectTransform\x12\".uesynth.SetObjectTransformRequest\x1a\x18.uesynth.CommandResponse\x12]\n\x12GetObjectTransform\x12\".uesynth.GetObjectTransformRequest\x1a#.uesynth.GetObjectTransformResponse\x12o\n\x18SetObjectTransformsBatch\x12(.uesynth.SetObjectTransformsBatchRequest\x1a).uesynth.SetObjectTransformsBatchResponse\x12o\n\x18GetObjectTransformsBatch\x12(.uesynth.GetObjectTransformsBatchRequest\x1a).uesynth.GetObjectTransformsBatchResponse\x12\x46\n\x0c\x43reateCamera\x12\x1c.uesynth.CreateCameraRequest\x1a\x18.uesynth.CommandResponse\x12H\n\rDestroyCamera\x12\x1d.uesynth.DestroyCameraRequest\x1a\x18.uesynth.CommandResponse\x12H\n\rSetResolution\x12\x1d.uesynth.SetResolutionRequest\x1a\x18.uesynth.CommandResponse\x12\x41\n\x0e\x43\x61ptureNormals\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12\x45\n\x12\x43\x61ptureOpticalFlow\x12\x17.uesynth.CaptureRequest\x1a\x16.uesynth.ImageResponse\x12I\n\x0c\x43\x61ptureMulti\x12\x1c.uesynth.CaptureMultiRequest\x1a\x1b.uesynth.MultiImageResponse\x12\x33\n\x04Step\x12\x14.uesynth.StepRequest\x1a\x15.uesynth.StepResponse\x12\x42\n\x0bSetLockstep\x12\x1b.uesynth.SetLockstepRequest\x1a\x16.uesynth.LockstepState\x12\x44\n\x0bSpawnObject\x12\x1b.uesynth.SpawnObjectRequest\x1a\x18.uesynth.CommandResponse\x12N\n\rPreloadAssets\x12\x1d.uesynth.PreloadAssetsRequest\x1a\x1e.uesynth.PreloadAssetsResponse\x12H\n\rDestroyObject\x12\x1d.uesynth.DestroyObjectRequest\x1a\x18.uesynth.CommandResponse\x12Q\n\x12\x43onfigureActorPool\x12\".uesynth.ConfigureActorPoolRequest\x1a\x17.uesynth.ActorPoolStats\x12\x44\n\x0bSetMaterial\x12\x1b.uesynth.SetMaterialRequest\x1a\x18.uesynth.CommandResponse\x12Z\n\x11SetMaterialsBatch\x12!.uesynth.SetMaterialsBatchRequest\x1a\".uesynth.SetMaterialsBatchResponse\x12\x65\n\x19ResolveMaterialParameters\x12).uesynth.ResolveMaterialParametersRequest\x1a\x1d.uesynth.MaterialParameterIds\x12H\n\x0bListObjects\x12\x1b.uesynth.ListObjectsRequest\x1a\x1c.uesynth.ListObjectsResponse\x12L\n\x10GetSceneSnapshot\x12 .uesynth.GetSceneSnapshotRequest\x1a\x16.uesynth.SceneSnapshot\x12\x44\n\x0bSetLighting\x12\x1b.uesynth.SetLightingRequest\x1a\x18.uesynth.CommandResponse\x12W\n\x10SetLightingBatch\x12 .uesynth.SetLightingBatchRequest\x1a!.uesynth.SetLightingBatchResponse\x12I\n\x0eStartRecording\x12\x1e.uesynth.StartRecordingRequest\x1a\x17.uesynth.RecordingStats\x12G\n\rStopRecording\x12\x1d.uesynth.StopRecordingRequest\x1a\x17.uesynth.RecordingStats\x12\x46\n\x0eGetServerStats\x12\x1e.uesynth.GetServerStatsRequest\x1a\x14.uesynth.ServerStats\x12:\n\tGetHealth\x12\x16.uesynth.HealthRequest\x1a\x15.uesynth.HealthStatusb\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'uesynth_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   DESCRIPTOR._loaded_options = None
-  _globals['_ACTIONREQUEST']._serialized_start=56
-  _globals['_ACTIONREQUEST']._serialized_end=1070
-  _globals['_FRAMERESPONSE']._serialized_start=1073
-  _globals['_FRAMERESPONSE']._serialized_end=1408
-  _globals['_VECTOR3']._serialized_start=1410
-  _globals['_VECTOR3']._serialized_end=1452
-  _globals['_ROTATOR']._serialized_start=1454
-  _globals['_ROTATOR']._serialized_end=1505
-  _globals['_TRANSFORM']._serialized_start=1507
-  _globals['_TRANSFORM']._serialized_end=1623
-  _globals['_COMMANDRESPONSE']._serialized_start=1625
-  _globals['_COMMANDRESPONSE']._serialized_end=1676
-  _globals['_SETCAMERATRANSFORMREQUEST']._serialized_start=1678
-  _globals['_SETCAMERATRANSFORMREQUEST']._serialized_end=1765
-  _globals['_GETCAMERATRANSFORMREQUEST']._serialized_start=1767
-  _globals['_GETCAMERATRANSFORMREQUEST']._serialized_end=1815
-  _globals['_GETCAMERATRANSFORMRESPONSE']._serialized_start=1817
-  _globals['_GETCAMERATRANSFORMRESPONSE']._serialized_end=1918
-  _globals['_CAPTUREREQUEST']._serialized_start=1920
-  _globals['_CAPTUREREQUEST']._serialized_end=1988
-  _globals['_IMAGERESPONSE']._serialized_start=1990
-  _globals['_IMAGERESPONSE']._serialized_end=2072
-  _globals['_SETOBJECTTRANSFORMREQUEST']._serialized_start=2074
-  _globals['_SETOBJECTTRANSFORMREQUEST']._serialized_end=2161
-  _globals['_GETOBJECTTRANSFORMREQUEST']._serialized_start=2163
-  _globals['_GETOBJECTTRANSFORMREQUEST']._serialized_end=2211
-  _globals['_GETOBJECTTRANSFORMRESPONSE']._serialized_start=2213
-  _globals['_GETOBJECTTRANSFORMRESPONSE']._serialized_end=2314
-  _globals['_CREATECAMERAREQUEST']._serialized_start=2316
-  _globals['_CREATECAMERAREQUEST']._serialized_end=2405
-  _globals['_DESTROYCAMERAREQUEST']._serialized_start=2407
-  _globals['_DESTROYCAMERAREQUEST']._serialized_end=2450
-  _globals['_SETRESOLUTIONREQUEST']._serialized_start=2452
-  _globals['_SETRESOLUTIONREQUEST']._serialized_end=2526
-  _globals['_LISTOBJECTSRESPONSE']._serialized_start=2528
-  _globals['_LISTOBJECTSRESPONSE']._serialized_end=2571
-  _globals['_SPAWNOBJECTREQUEST']._serialized_start=2573
-  _globals['_SPAWNOBJECTREQUEST']._serialized_end=2681
-  _globals['_DESTROYOBJECTREQUEST']._serialized_start=2683
-  _globals['_DESTROYOBJECTREQUEST']._serialized_end=2726
-  _globals['_SETMATERIALREQUEST']._serialized_start=2728
-  _globals['_SETMATERIALREQUEST']._serialized_end=2811
-  _globals['_SETLIGHTINGREQUEST']._serialized_start=2814
-  _globals['_SETLIGHTINGREQUEST']._serialized_end=2945
-  _globals['_UESYNTHSERVICE']._serialized_start=2948
-  _globals['_UESYNTHSERVICE']._serialized_end=4314
+  _globals['_PIXELFORMAT']._serialized_start=11369
+  _globals['_PIXELFORMAT']._serialized_end=11476
+  _globals['_DEPTHENCODING']._serialized_start=11478
+  _globals['_DEPTHENCODING']._serialized_end=11576
+  _globals['_IMAGECODEC']._serialized_start=11578
+  _globals['_IMAGECODEC']._serialized_end=11697
+  _globals['_CAPTUREMODALITY']._serialized_start=11700
+  _globals['_CAPTUREMODALITY']._serialized_end=11898
+  _globals['_ASSETMISSPOLICY']._serialized_start=11900
+  _globals['_ASSETMISSPOLICY']._serialized_end=11973
+  _globals['_ASSETSTATE']._serialized_start=11975
+  _globals['_ASSETSTATE']._serialized_end=12090
+  _globals['_ACTIONREQUEST']._serialized_start=27
+  _globals['_ACTIONREQUEST']._serialized_end=2038
+  _globals['_FRAMERESPONSE']._serialized_start=2041
+  _globals['_FRAMERESPONSE']._serialized_end=3200
+  _globals['_VECTOR3']._serialized_start=3202
+  _globals['_VECTOR3']._serialized_end=3244
+  _globals['_ROTATOR']._serialized_start=3246
+  _globals['_ROTATOR']._serialized_end=3297
+  _globals['_TRANSFORM']._serialized_start=3299
+  _globals['_TRANSFORM']._serialized_end=3415
+  _globals['_COMMANDRESPONSE']._serialized_start=3417
+  _globals['_COMMANDRESPONSE']._serialized_end=3468
+  _globals['_SETCAMERATRANSFORMREQUEST']._serialized_start=3470
+  _globals['_SETCAMERATRANSFORMREQUEST']._serialized_end=3557
+  _globals['_GETCAMERATRANSFORMREQUEST']._serialized_start=3559
+  _globals['_GETCAMERATRANSFORMREQUEST']._serialized_end=3607
+  _globals['_GETCAMERATRANSFORMRESPONSE']._serialized_start=3609
+  _globals['_GETCAMERATRANSFORMRESPONSE']._serialized_end=3710
+  _globals['_CAPTUREREGION']._serialized_start=3712
+  _globals['_CAPTUREREGION']._serialized_end=3780
+  _globals['_CAPTUREREQUEST']._serialized_start=3783
+  _globals['_CAPTUREREQUEST']._serialized_end=4153
+  _globals['_IMAGERESPONSE']._serialized_start=4156
+  _globals['_IMAGERESPONSE']._serialized_end=4464
+  _globals['_TILEDELTA']._serialized_start=4466
+  _globals['_TILEDELTA']._serialized_end=4542
+  _globals['_SEGMENTATIONENTRY']._serialized_start=4544
+  _globals['_SEGMENTATIONENTRY']._serialized_end=4628
+  _globals['_CAPTUREMULTIREQUEST']._serialized_start=4631
+  _globals['_CAPTUREMULTIREQUEST']._serialized_end=5073
+  _globals['_MULTIIMAGERESPONSE']._serialized_start=5076
+  _globals['_MULTIIMAGERESPONSE']._serialized_end=5346
+  _globals['_CAPTURECAMERASREQUEST']._serialized_start=5349
+  _globals['_CAPTURECAMERASREQUEST']._serialized_end=5650
+  _globals['_SUBSCRIBEREQUEST']._serialized_start=5653
+  _globals['_SUBSCRIBEREQUEST']._serialized_end=5838
+  _globals['_UNSUBSCRIBEREQUEST']._serialized_start=5840
+  _globals['_UNSUBSCRIBEREQUEST']._serialized_end=5885
+  _globals['_SUBSCRIPTIONFRAME']._serialized_start=5888
+  _globals['_SUBSCRIPTIONFRAME']._serialized_end=6090
+  _globals['_GETSTREAMSTATSREQUEST']._serialized_start=6092
+  _globals['_GETSTREAMSTATSREQUEST']._serialized_end=6115
+  _globals['_OPENSHAREDMEMORYREQUEST']._serialized_start=6117
+  _globals['_OPENSHAREDMEMORYREQUEST']._serialized_end=6181
+  _globals['_SHAREDMEMORYINFO']._serialized_start=6183
+  _globals['_SHAREDMEMORYINFO']._serialized_end=6275
+  _globals['_SHAREDMEMORYSLOT']._serialized_start=6277
+  _globals['_SHAREDMEMORYSLOT']._serialized_end=6341
+  _globals['_STREAMSTATS']._serialized_start=6343
+  _globals['_STREAMSTATS']._serialized_end=6470
+  _globals['_STEPREQUEST']._serialized_start=6473
+  _globals['_STEPREQUEST']._serialized_end=6646
+  _globals['_STEPERROR']._serialized_start=6648
+  _globals['_STEPERROR']._serialized_end=6705
+  _globals['_STEPRESPONSE']._serialized_start=6708
+  _globals['_STEPRESPONSE']._serialized_end=6894
+  _globals['_SETLOCKSTEPREQUEST']._serialized_start=6896
+  _globals['_SETLOCKSTEPREQUEST']._serialized_end=6987
+  _globals['_LOCKSTEPSTATE']._serialized_start=6989
+  _globals['_LOCKSTEPSTATE']._serialized_end=7099
+  _globals['_SETOBJECTTRANSFORMREQUEST']._serialized_start=7101
+  _globals['_SETOBJECTTRANSFORMREQUEST']._serialized_end=7188
+  _globals['_GETOBJECTTRANSFORMREQUEST']._serialized_start=7190
+  _globals['_GETOBJECTTRANSFORMREQUEST']._serialized_end=7238
+  _globals['_GETOBJECTTRANSFORMRESPONSE']._serialized_start=7240
+  _globals['_GETOBJECTTRANSFORMRESPONSE']._serialized_end=7341
+  _globals['_SETOBJECTTRANSFORMSBATCHREQUEST']._serialized_start=7343
+  _globals['_SETOBJECTTRANSFORMSBATCHREQUEST']._serialized_end=7445
+  _globals['_SETOBJECTTRANSFORMSBATCHRESPONSE']._serialized_start=7447
+  _globals['_SETOBJECTTRANSFORMSBATCHRESPONSE']._serialized_end=7545
+  _globals['_GETOBJECTTRANSFORMSBATCHREQUEST']._serialized_start=7547
+  _globals['_GETOBJECTTRANSFORMSBATCHREQUEST']._serialized_end=7622
+  _globals['_GETOBJECTTRANSFORMSBATCHRESPONSE']._serialized_start=7624
+  _globals['_GETOBJECTTRANSFORMSBATCHRESPONSE']._serialized_end=7710
+  _globals['_CREATECAMERAREQUEST']._serialized_start=7712
+  _globals['_CREATECAMERAREQUEST']._serialized_end=7832
+  _globals['_DESTROYCAMERAREQUEST']._serialized_start=7834
+  _globals['_DESTROYCAMERAREQUEST']._serialized_end=7877
+  _globals['_SETRESOLUTIONREQUEST']._serialized_start=7879
+  _globals['_SETRESOLUTIONREQUEST']._serialized_end=7953
+  _globals['_LISTOBJECTSREQUEST']._serialized_start=7955
+  _globals['_LISTOBJECTSREQUEST']._serialized_end=8008
+  _globals['_LISTOBJECTSRESPONSE']._serialized_start=8010
+  _globals['_LISTOBJECTSRESPONSE']._serialized_end=8073
+  _globals['_GETSCENESNAPSHOTREQUEST']._serialized_start=8076
+  _globals['_GETSCENESNAPSHOTREQUEST']._serialized_end=8237
+  _globals['_SCENESNAPSHOT']._serialized_start=8240
+  _globals['_SCENESNAPSHOT']._serialized_end=8442
+  _globals['_SPAWNOBJECTREQUEST']._serialized_start=8445
+  _globals['_SPAWNOBJECTREQUEST']._serialized_end=8620
+  _globals['_PRELOADASSETSREQUEST']._serialized_start=8622
+  _globals['_PRELOADASSETSREQUEST']._serialized_end=8679
+  _globals['_ASSETSTATUS']._serialized_start=8681
+  _globals['_ASSETSTATUS']._serialized_end=8774
+  _globals['_PRELOADASSETSRESPONSE']._serialized_start=8777
+  _globals['_PRELOADASSETSRESPONSE']._serialized_end=8910
+  _globals['_DESTROYOBJECTREQUEST']._serialized_start=8912
+  _globals['_DESTROYOBJECTREQUEST']._serialized_end=8955
+  _globals['_CONFIGUREACTORPOOLREQUEST']._serialized_start=8957
+  _globals['_CONFIGUREACTORPOOLREQUEST']._serialized_end=9029
+  _globals['_ACTORPOOLENTRY']._serialized_start=9031
+  _globals['_ACTORPOOLENTRY']._serialized_end=9113
+  _globals['_ACTORPOOLSTATS']._serialized_start=9116
+  _globals['_ACTORPOOLSTATS']._serialized_end=9267
+  _globals['_LINEARCOLOR']._serialized_start=9269
+  _globals['_LINEARCOLOR']._serialized_end=9326
+  _globals['_MATERIALPARAMETER']._serialized_start=9329
+  _globals['_MATERIALPARAMETER']._serialized_end=9477
+  _globals['_SETMATERIALREQUEST']._serialized_start=9480
+  _globals['_SETMATERIALREQUEST']._serialized_end=9630
+  _globals['_SETMATERIALSBATCHREQUEST']._serialized_start=9632
+  _globals['_SETMATERIALSBATCHREQUEST']._serialized_end=9704
+  _globals['_SETMATERIALSBATCHRESPONSE']._serialized_start=9706
+  _globals['_SETMATERIALSBATCHRESPONSE']._serialized_end=9797
+  _globals['_RESOLVEMATERIALPARAMETERSREQUEST']._serialized_start=9799
+  _globals['_RESOLVEMATERIALPARAMETERSREQUEST']._serialized_end=9848
+  _globals['_MATERIALPARAMETERIDS']._serialized_start=9850
+  _globals['_MATERIALPARAMETERIDS']._serialized_end=9885
+  _globals['_SETLIGHTINGREQUEST']._serialized_start=9888
+  _globals['_SETLIGHTINGREQUEST']._serialized_end=10057
+  _globals['_SETLIGHTINGBATCHREQUEST']._serialized_start=10059
+  _globals['_SETLIGHTINGBATCHREQUEST']._serialized_end=10129
+  _globals['_SETLIGHTINGBATCHRESPONSE']._serialized_start=10131
+  _globals['_SETLIGHTINGBATCHRESPONSE']._serialized_end=10221
+  _globals['_STARTRECORDINGREQUEST']._serialized_start=10224
+  _globals['_STARTRECORDINGREQUEST']._serialized_end=10363
+  _globals['_STOPRECORDINGREQUEST']._serialized_start=10365
+  _globals['_STOPRECORDINGREQUEST']._serialized_end=10409
+  _globals['_RECORDINGSTATS']._serialized_start=10412
+  _globals['_RECORDINGSTATS']._serialized_end=10594
+  _globals['_GETSERVERSTATSREQUEST']._serialized_start=10596
+  _globals['_GETSERVERSTATSREQUEST']._serialized_end=10634
+  _globals['_LATENCYHISTOGRAM']._serialized_start=10637
+  _globals['_LATENCYHISTOGRAM']._serialized_end=10780
+  _globals['_SERVERSTATS']._serialized_start=10783
+  _globals['_SERVERSTATS']._serialized_end=11090
+  _globals['_HEALTHREQUEST']._serialized_start=11092
+  _globals['_HEALTHREQUEST']._serialized_end=11107
+  _globals['_HEALTHSTATUS']._serialized_start=11110
+  _globals['_HEALTHSTATUS']._serialized_end=11367
+  _globals['_UESYNTHSERVICE']._serialized_start=12093
+  _globals['_UESYNTHSERVICE']._serialized_end=14691
 # @@protoc_insertion_point(module_scope)
@@ -3,7 +3,6 @@
 import grpc
 import warnings
 
-from google.protobuf import empty_pb2 as google_dot_protobuf_dot_empty__pb2
 from . import uesynth_pb2 as uesynth__pb2
 
 GRPC_GENERATED_VERSION = '1.73.1'
@@ -76,6 +75,16 @@ class UESynthServiceStub(object):
                 request_serializer=uesynth__pb2.GetObjectTransformRequest.SerializeToString,
                 response_deserializer=uesynth__pb2.GetObjectTransformResponse.FromString,
                 _registered_method=True)
+        self.SetObjectTransformsBatch = channel.unary_unary(
+                '/uesynth.UESynthService/SetObjectTransformsBatch',
+                request_serializer=uesynth__pb2.SetObjectTransformsBatchRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.SetObjectTransformsBatchResponse.FromString,
+                _registered_method=True)
+        self.GetObjectTransformsBatch = channel.unary_unary(
+                '/uesynth.UESynthService/GetObjectTransformsBatch',
+                request_serializer=uesynth__pb2.GetObjectTransformsBatchRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.GetObjectTransformsBatchResponse.FromString,
+                _registered_method=True)
         self.CreateCamera = channel.unary_unary(
                 '/uesynth.UESynthService/CreateCamera',
                 request_serializer=uesynth__pb2.CreateCameraRequest.SerializeToString,
@@ -101,31 +110,96 @@ class UESynthServiceStub(object):
                 request_serializer=uesynth__pb2.CaptureRequest.SerializeToString,
                 response_deserializer=uesynth__pb2.ImageResponse.FromString,
                 _registered_method=True)
+        self.CaptureMulti = channel.unary_unary(
+                '/uesynth.UESynthService/CaptureMulti',
+                request_serializer=uesynth__pb2.CaptureMultiRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.MultiImageResponse.FromString,
+                _registered_method=True)
+        self.Step = channel.unary_unary(
+                '/uesynth.UESynthService/Step',
+                request_serializer=uesynth__pb2.StepRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.StepResponse.FromString,
+                _registered_method=True)
+        self.SetLockstep = channel.unary_unary(
+                '/uesynth.UESynthService/SetLockstep',
+                request_serializer=uesynth__pb2.SetLockstepRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.LockstepState.FromString,
+                _registered_method=True)
         self.SpawnObject = channel.unary_unary(
                 '/uesynth.UESynthService/SpawnObject',
                 request_serializer=uesynth__pb2.SpawnObjectRequest.SerializeToString,
                 response_deserializer=uesynth__pb2.CommandResponse.FromString,
                 _registered_method=True)
+        self.PreloadAssets = channel.unary_unary(
+                '/uesynth.UESynthService/PreloadAssets',
+                request_serializer=uesynth__pb2.PreloadAssetsRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.PreloadAssetsResponse.FromString,
+                _registered_method=True)
         self.DestroyObject = channel.unary_unary(
                 '/uesynth.UESynthService/DestroyObject',
                 request_serializer=uesynth__pb2.DestroyObjectRequest.SerializeToString,
                 response_deserializer=uesynth__pb2.CommandResponse.FromString,
                 _registered_method=True)
+        self.ConfigureActorPool = channel.unary_unary(
+                '/uesynth.UESynthService/ConfigureActorPool',
+                request_serializer=uesynth__pb2.ConfigureActorPoolRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.ActorPoolStats.FromString,
+                _registered_method=True)
         self.SetMaterial = channel.unary_unary(
                 '/uesynth.UESynthService/SetMaterial',
                 request_serializer=uesynth__pb2.SetMaterialRequest.SerializeToString,
                 response_deserializer=uesynth__pb2.CommandResponse.FromString,
                 _registered_method=True)
+        self.SetMaterialsBatch = channel.unary_unary(
+                '/uesynth.UESynthService/SetMaterialsBatch',
+                request_serializer=uesynth__pb2.SetMaterialsBatchRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.SetMaterialsBatchResponse.FromString,
+                _registered_method=True)
+        self.ResolveMaterialParameters = channel.unary_unary(
+                '/uesynth.UESynthService/ResolveMaterialParameters',
+                request_serializer=uesynth__pb2.ResolveMaterialParametersRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.MaterialParameterIds.FromString,
+                _registered_method=True)
         self.ListObjects = channel.unary_unary(
                 '/uesynth.UESynthService/ListObjects',
-                request_serializer=google_dot_protobuf_dot_empty__pb2.Empty.SerializeToString,
+                request_serializer=uesynth__pb2.ListObjectsRequest.SerializeToString,
                 response_deserializer=uesynth__pb2.ListObjectsResponse.FromString,
                 _registered_method=True)
+        self.GetSceneSnapshot = channel.unary_unary(
+                '/uesynth.UESynthService/GetSceneSnapshot',
+                request_serializer=uesynth__pb2.GetSceneSnapshotRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.SceneSnapshot.FromString,
+                _registered_method=True)
         self.SetLighting = channel.unary_unary(
                 '/uesynth.UESynthService/SetLighting',
                 request_serializer=uesynth__pb2.SetLightingRequest.SerializeToString,
                 response_deserializer=uesynth__pb2.CommandResponse.FromString,
                 _registered_method=True)
+        self.SetLightingBatch = channel.unary_unary(
+                '/uesynth.UESynthService/SetLightingBatch',
+                request_serializer=uesynth__pb2.SetLightingBatchRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.SetLightingBatchResponse.FromString,
+                _registered_method=True)
+        self.StartRecording = channel.unary_unary(
+                '/uesynth.UESynthService/StartRecording',
+                request_serializer=uesynth__pb2.StartRecordingRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.RecordingStats.FromString,
+                _registered_method=True)
+        self.StopRecording = channel.unary_unary(
+                '/uesynth.UESynthService/StopRecording',
+                request_serializer=uesynth__pb2.StopRecordingRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.RecordingStats.FromString,
+                _registered_method=True)
+        self.GetServerStats = channel.unary_unary(
+                '/uesynth.UESynthService/GetServerStats',
+                request_serializer=uesynth__pb2.GetServerStatsRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.ServerStats.FromString,
+                _registered_method=True)
+        self.GetHealth = channel.unary_unary(
+                '/uesynth.UESynthService/GetHealth',
+                request_serializer=uesynth__pb2.HealthRequest.SerializeToString,
+                response_deserializer=uesynth__pb2.HealthStatus.FromString,
+                _registered_method=True)
 
 
 class UESynthServiceServicer(object):
@@ -186,6 +260,18 @@ class UESynthServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def SetObjectTransformsBatch(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetObjectTransformsBatch(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def CreateCamera(self, request, context):
         """Additional Camera Control
         """
@@ -218,6 +304,27 @@ class UESynthServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def CaptureMulti(self, request, context):
+        """Several modalities read back from one rendered frame
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def Step(self, request, context):
+        """Several actions and a capture of the scene they leave, in one game-thread task
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def SetLockstep(self, request, context):
+        """Has the engine wait for a step between frames, see SetLockstepRequest
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def SpawnObject(self, request, context):
         """Additional Object Manipulation
         """
@@ -225,18 +332,46 @@ class UESynthServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def PreloadAssets(self, request, context):
+        """Streams assets in ahead of the spawns that use them
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def DestroyObject(self, request, context):
         """Missing associated documentation comment in .proto file."""
         context.set_code(grpc.StatusCode.UNIMPLEMENTED)
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def ConfigureActorPool(self, request, context):
+        """Limits and clears the pool of actors pooled spawns reuse, and reports it
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def SetMaterial(self, request, context):
         """Missing associated documentation comment in .proto file."""
         context.set_code(grpc.StatusCode.UNIMPLEMENTED)
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def SetMaterialsBatch(self, request, context):
+        """Material parameters of many objects in one game-thread pass
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def ResolveMaterialParameters(self, request, context):
+        """IDs to send instead of material parameter names
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def ListObjects(self, request, context):
         """Scene Control
         """
@@ -244,12 +379,60 @@ class UESynthServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def GetSceneSnapshot(self, request, context):
+        """Transforms of every registered object in one packed buffer, or only of
+        those changed since a snapshot the client already has
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
     def SetLighting(self, request, context):
         """Missing associated documentation comment in .proto file."""
         context.set_code(grpc.StatusCode.UNIMPLEMENTED)
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def SetLightingBatch(self, request, context):
+        """Many lights in one game-thread pass
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def StartRecording(self, request, context):
+        """Recording
+        Writes captures to files on the server instead of sending them, see
+        StartRecordingRequest
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def StopRecording(self, request, context):
+        """Answers once every frame queued for the recording is on disk
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetServerStats(self, request, context):
+        """Monitoring
+        Per-RPC latency, per-stage timing and queue depths; answered without
+        waiting for the game thread
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetHealth(self, request, context):
+        """Whether the instance can take work and how busy it is, cheap enough to
+        poll across a fleet; also answered without waiting for the game thread
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
 
 def add_UESynthServiceServicer_to_server(servicer, server):
     rpc_method_handlers = {
@@ -293,6 +476,16 @@ def add_UESynthServiceServicer_to_server(servicer, server):
                     request_deserializer=uesynth__pb2.GetObjectTransformRequest.FromString,
                     response_serializer=uesynth__pb2.GetObjectTransformResponse.SerializeToString,
             ),
+            'SetObjectTransformsBatch': grpc.unary_unary_rpc_method_handler(
+                    servicer.SetObjectTransformsBatch,
+                    request_deserializer=uesynth__pb2.SetObjectTransformsBatchRequest.FromString,
+                    response_serializer=uesynth__pb2.SetObjectTransformsBatchResponse.SerializeToString,
+            ),
+            'GetObjectTransformsBatch': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetObjectTransformsBatch,
+                    request_deserializer=uesynth__pb2.GetObjectTransformsBatchRequest.FromString,
+                    response_serializer=uesynth__pb2.GetObjectTransformsBatchResponse.SerializeToString,
+            ),
             'CreateCamera': grpc.unary_unary_rpc_method_handler(
                     servicer.CreateCamera,
                     request_deserializer=uesynth__pb2.CreateCameraRequest.FromString,
@@ -318,31 +511,96 @@ def add_UESynthServiceServicer_to_server(servicer, server):
                     request_deserializer=uesynth__pb2.CaptureRequest.FromString,
                     response_serializer=uesynth__pb2.ImageResponse.SerializeToString,
             ),
+            'CaptureMulti': grpc.unary_unary_rpc_method_handler(
+                    servicer.CaptureMulti,
+                    request_deserializer=uesynth__pb2.CaptureMultiRequest.FromString,
+                    response_serializer=uesynth__pb2.MultiImageResponse.SerializeToString,
+            ),
+            'Step': grpc.unary_unary_rpc_method_handler(
+                    servicer.Step,
+                    request_deserializer=uesynth__pb2.StepRequest.FromString,
+                    response_serializer=uesynth__pb2.StepResponse.SerializeToString,
+            ),
+            'SetLockstep': grpc.unary_unary_rpc_method_handler(
+                    servicer.SetLockstep,
+                    request_deserializer=uesynth__pb2.SetLockstepRequest.FromString,
+                    response_serializer=uesynth__pb2.LockstepState.SerializeToString,
+            ),
             'SpawnObject': grpc.unary_unary_rpc_method_handler(
                     servicer.SpawnObject,
                     request_deserializer=uesynth__pb2.SpawnObjectRequest.FromString,
                     response_serializer=uesynth__pb2.CommandResponse.SerializeToString,
             ),
+            'PreloadAssets': grpc.unary_unary_rpc_method_handler(
+                    servicer.PreloadAssets,
+                    request_deserializer=uesynth__pb2.PreloadAssetsRequest.FromString,
+                    response_serializer=uesynth__pb2.PreloadAssetsResponse.SerializeToString,
+            ),
             'DestroyObject': grpc.unary_unary_rpc_method_handler(
                     servicer.DestroyObject,
                     request_deserializer=uesynth__pb2.DestroyObjectRequest.FromString,
                     response_serializer=uesynth__pb2.CommandResponse.SerializeToString,
             ),
+            'ConfigureActorPool': grpc.unary_unary_rpc_method_handler(
+                    servicer.ConfigureActorPool,
+                    request_deserializer=uesynth__pb2.ConfigureActorPoolRequest.FromString,
+                    response_serializer=uesynth__pb2.ActorPoolStats.SerializeToString,
+            ),
             'SetMaterial': grpc.unary_unary_rpc_method_handler(
                     servicer.SetMaterial,
                     request_deserializer=uesynth__pb2.SetMaterialRequest.FromString,
                     response_serializer=uesynth__pb2.CommandResponse.SerializeToString,
             ),
+            'SetMaterialsBatch': grpc.unary_unary_rpc_method_handler(
+                    servicer.SetMaterialsBatch,
+                    request_deserializer=uesynth__pb2.SetMaterialsBatchRequest.FromString,
+                    response_serializer=uesynth__pb2.SetMaterialsBatchResponse.SerializeToString,
+            ),
+            'ResolveMaterialParameters': grpc.unary_unary_rpc_method_handler(
+                    servicer.ResolveMaterialParameters,
+                    request_deserializer=uesynth__pb2.ResolveMaterialParametersRequest.FromString,
+                    response_serializer=uesynth__pb2.MaterialParameterIds.SerializeToString,
+            ),
             'ListObjects': grpc.unary_unary_rpc_method_handler(
                     servicer.ListObjects,
-                    request_deserializer=google_dot_protobuf_dot_empty__pb2.Empty.FromString,
+                    request_deserializer=uesynth__pb2.ListObjectsRequest.FromString,
                     response_serializer=uesynth__pb2.ListObjectsResponse.SerializeToString,
             ),
+            'GetSceneSnapshot': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetSceneSnapshot,
+                    request_deserializer=uesynth__pb2.GetSceneSnapshotRequest.FromString,
+                    response_serializer=uesynth__pb2.SceneSnapshot.SerializeToString,
+            ),
             'SetLighting': grpc.unary_unary_rpc_method_handler(
                     servicer.SetLighting,
                     request_deserializer=uesynth__pb2.SetLightingRequest.FromString,
                     response_serializer=uesynth__pb2.CommandResponse.SerializeToString,
             ),
+            'SetLightingBatch': grpc.unary_unary_rpc_method_handler(
+                    servicer.SetLightingBatch,
+                    request_deserializer=uesynth__pb2.SetLightingBatchRequest.FromString,
+                    response_serializer=uesynth__pb2.SetLightingBatchResponse.SerializeToString,
+            ),
+            'StartRecording': grpc.unary_unary_rpc_method_handler(
+                    servicer.StartRecording,
+                    request_deserializer=uesynth__pb2.StartRecordingRequest.FromString,
+                    response_serializer=uesynth__pb2.RecordingStats.SerializeToString,
+            ),
+            'StopRecording': grpc.unary_unary_rpc_method_handler(
+                    servicer.StopRecording,
+                    request_deserializer=uesynth__pb2.StopRecordingRequest.FromString,
+                    response_serializer=uesynth__pb2.RecordingStats.SerializeToString,
+            ),
+            'GetServerStats': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetServerStats,
+                    request_deserializer=uesynth__pb2.GetServerStatsRequest.FromString,
+                    response_serializer=uesynth__pb2.ServerStats.SerializeToString,
+            ),
+            'GetHealth': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetHealth,
+                    request_deserializer=uesynth__pb2.HealthRequest.FromString,
+                    response_serializer=uesynth__pb2.HealthStatus.SerializeToString,
+            ),
     }
     generic_handler = grpc.method_handlers_generic_handler(
             'uesynth.UESynthService', rpc_method_handlers)
@@ -571,6 +829,60 @@ class UESynthService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def SetObjectTransformsBatch(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/SetObjectTransformsBatch',
+            uesynth__pb2.SetObjectTransformsBatchRequest.SerializeToString,
+            uesynth__pb2.SetObjectTransformsBatchResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetObjectTransformsBatch(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/GetObjectTransformsBatch',
+            uesynth__pb2.GetObjectTransformsBatchRequest.SerializeToString,
+            uesynth__pb2.GetObjectTransformsBatchResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def CreateCamera(request,
             target,
@@ -706,6 +1018,87 @@ class UESynthService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def CaptureMulti(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/CaptureMulti',
+            uesynth__pb2.CaptureMultiRequest.SerializeToString,
+            uesynth__pb2.MultiImageResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def Step(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/Step',
+            uesynth__pb2.StepRequest.SerializeToString,
+            uesynth__pb2.StepResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def SetLockstep(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/SetLockstep',
+            uesynth__pb2.SetLockstepRequest.SerializeToString,
+            uesynth__pb2.LockstepState.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def SpawnObject(request,
             target,
@@ -733,6 +1126,33 @@ class UESynthService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def PreloadAssets(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/PreloadAssets',
+            uesynth__pb2.PreloadAssetsRequest.SerializeToString,
+            uesynth__pb2.PreloadAssetsResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def DestroyObject(request,
             target,
@@ -760,6 +1180,33 @@ class UESynthService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def ConfigureActorPool(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/ConfigureActorPool',
+            uesynth__pb2.ConfigureActorPoolRequest.SerializeToString,
+            uesynth__pb2.ActorPoolStats.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def SetMaterial(request,
             target,
@@ -787,6 +1234,60 @@ class UESynthService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def SetMaterialsBatch(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/SetMaterialsBatch',
+            uesynth__pb2.SetMaterialsBatchRequest.SerializeToString,
+            uesynth__pb2.SetMaterialsBatchResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def ResolveMaterialParameters(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/ResolveMaterialParameters',
+            uesynth__pb2.ResolveMaterialParametersRequest.SerializeToString,
+            uesynth__pb2.MaterialParameterIds.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def ListObjects(request,
             target,
@@ -802,7 +1303,7 @@ class UESynthService(object):
             request,
             target,
             '/uesynth.UESynthService/ListObjects',
-            google_dot_protobuf_dot_empty__pb2.Empty.SerializeToString,
+            uesynth__pb2.ListObjectsRequest.SerializeToString,
             uesynth__pb2.ListObjectsResponse.FromString,
             options,
             channel_credentials,
@@ -814,6 +1315,33 @@ class UESynthService(object):
             metadata,
             _registered_method=True)
 
+    @staticmethod
+    def GetSceneSnapshot(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/GetSceneSnapshot',
+            uesynth__pb2.GetSceneSnapshotRequest.SerializeToString,
+            uesynth__pb2.SceneSnapshot.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
     @staticmethod
     def SetLighting(request,
             target,
@@ -840,3 +1368,138 @@ class UESynthService(object):
             timeout,
             metadata,
             _registered_method=True)
+
+    @staticmethod
+    def SetLightingBatch(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/SetLightingBatch',
+            uesynth__pb2.SetLightingBatchRequest.SerializeToString,
+            uesynth__pb2.SetLightingBatchResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def StartRecording(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/StartRecording',
+            uesynth__pb2.StartRecordingRequest.SerializeToString,
+            uesynth__pb2.RecordingStats.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def StopRecording(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/StopRecording',
+            uesynth__pb2.StopRecordingRequest.SerializeToString,
+            uesynth__pb2.RecordingStats.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetServerStats(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/GetServerStats',
+            uesynth__pb2.GetServerStatsRequest.SerializeToString,
+            uesynth__pb2.ServerStats.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetHealth(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/uesynth.UESynthService/GetHealth',
+            uesynth__pb2.HealthRequest.SerializeToString,
+            uesynth__pb2.HealthStatus.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)